@@ -0,0 +1,13 @@
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import FloatArrayList as __FloatArrayList
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import FloatArrayListIter as __FloatArrayListIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import DoubleArrayList as __DoubleArrayList
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import DoubleArrayListIter as __DoubleArrayListIter
+
+FloatArrayList = __FloatArrayList.FloatArrayList
+FloatArrayListIter = __FloatArrayListIter.FloatArrayListIter
+DoubleArrayList = __DoubleArrayList.DoubleArrayList
+DoubleArrayListIter = __DoubleArrayListIter.DoubleArrayListIter
@@ -0,0 +1,674 @@
+from typing import overload, Iterable, Iterator, Callable, Any
+from typing_extensions import Buffer
+from .ints import IntArrayList
+
+class FloatArrayList(list[float]):
+    """
+    A specialized version of Python's list for floats, optimized for performance by using a C implementation.
+
+    This class behaves similarly to the standard Python `list`, but it is specifically optimized for storing floats.
+    Elements are kept as C `float` values (float32), half the size of a `DoubleArrayList`, and are rounded
+    to single precision when stored.
+    The storage is 64-byte aligned so the numeric methods can use SIMD.
+
+    Parameters:
+        - `exceptSize` (optional): The expected size of the list. This is used for preallocating memory to avoid
+          frequent resizing when adding elements.
+        - `iterable` (optional): An iterable of floats to initialize the list with.
+
+    Example:
+        >>> my_list = FloatArrayList([1.5, 2.5])
+        >>> my_list.append(4)
+        >>> print(my_list)
+        [1.5, 2.5, 4.0]
+
+    Note:
+        - Elements are compared as the Python floats they turn into, so `x in my_list` and `my_list.index(x)`
+          match exactly what `my_list[i] == x` would.
+    """
+
+    @overload
+    def __init__(self, exceptSize: int) -> None:
+        """
+        Initializes an empty `FloatArrayList` with a preallocated size.
+
+        Parameters:
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing
+                              as elements are added.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[float], exceptSize: int) -> None:
+        """
+        Initializes a `FloatArrayList` from an iterable of floats with a preallocated size.
+
+        Parameters:
+            iterable (Iterable[float]): An iterable of floats to initialize the list with.
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing.
+        """
+        pass
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `FloatArrayList` with no preallocated size.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[float]) -> None:
+        """
+        Initializes a `FloatArrayList` from an iterable of floats.
+
+        Parameters:
+            iterable (Iterable[float]): An iterable of floats to initialize the list with.
+        """
+        pass
+
+    @staticmethod
+    def frombuffer(__buffer: Buffer) -> FloatArrayList:
+        """
+        Creates a `FloatArrayList` from a C-contiguous buffer of float32 or float64, such as a numpy array.
+
+        The elements are copied in native code without creating a Python object per element.
+        float64 buffers are rounded to single precision, values out of range become inf.
+
+        Parameters:
+            __buffer (Buffer): The buffer to copy, a `FloatArrayList` and a `DoubleArrayList` work as well.
+
+        Returns:
+            FloatArrayList: A new `FloatArrayList` with a copy of the elements.
+
+        Raises:
+            TypeError: If the buffer isn't made of float32 or float64.
+            BufferError: If the buffer isn't C-contiguous, some exporters like numpy raise ValueError instead.
+
+        Example:
+            >>> import numpy
+            >>> FloatArrayList.frombuffer(numpy.linspace(0, 1, 3, dtype=numpy.float32))
+            [0.0, 0.5, 1.0]
+        """
+        pass
+
+    def view(self, readonly: bool = False) -> memoryview:
+        """
+        Returns a `memoryview` over the elements of the list, without copying them.
+
+        The list can't change its size while any view, or anything else holding its buffer such as a numpy
+        array made with `numpy.asarray()`, is alive. Operations that would resize it raise `BufferError`.
+
+        Parameters:
+            readonly (bool): Return a read-only view, consumers like numpy then can't write through it.
+
+        Returns:
+            memoryview: A view with format 'f'.
+
+        Example:
+            >>> lst = FloatArrayList([1.5, 2.5])
+            >>> view = lst.view(readonly=True)
+            >>> view.readonly, view.tolist()
+            (True, [1.5, 2.5])
+        """
+        pass
+
+    def resize(self, __size: int) -> None:
+        """
+        Resizes the `FloatArrayList` to the specified size.
+
+        If the new size is larger than the current size, the list will be extended with zeros. If the new size is smaller,
+        excess elements will be removed.
+
+        Parameters:
+            __size (int): The new size of the list.
+
+        Example:
+            >>> my_list = FloatArrayList([1.5, 2.5])
+            >>> my_list.resize(3)
+            >>> print(my_list)
+            [1.5, 2.5, 0.0]
+        """
+        pass
+
+    def to_list(self) -> list[float]:
+        """
+        Converts the `FloatArrayList` to a standard Python list.
+
+        Returns:
+            list[float]: A new list containing all the elements of the `FloatArrayList`.
+
+        Example:
+            >>> FloatArrayList([1.5, 2.5]).to_list()
+            [1.5, 2.5]
+        """
+        pass
+
+    def sort(self, *, key: Callable[[float], Any] | None = None, reverse: bool = False,
+             algorithm: str = "auto") -> None:
+        """
+        Sorts the list in place, natively and with the GIL released.
+
+        The floats are sorted as integers with the same order, using the same algorithms as `IntArrayList.sort()`:
+        `"bitonic"` sorts with SIMD sorting networks and merges, `"radix"` with an LSD radix sort, and `"auto"`
+        uses radix sort on all but small lists.
+
+        Unlike `list.sort()`, NaN has a defined place: it goes last, also when `reverse` is set, like numpy does.
+
+        Parameters:
+            key (Callable[[float], Any] | None): A function computing the sort key of every element.
+            reverse (bool): Sort in descending order.
+            algorithm (str): `"auto"`, `"bitonic"` or `"radix"`.
+
+        Raises:
+            ValueError: If `algorithm` is unknown.
+
+        Example:
+            >>> my_list = FloatArrayList([2.5, float("nan"), -1.0, 0.5])
+            >>> my_list.sort(reverse=True)
+            >>> my_list
+            [2.5, 0.5, -1.0, nan]
+        """
+        pass
+
+    def argsort(self, reverse: bool = False, stable: bool = True) -> IntArrayList:
+        """
+        Returns the indices that would sort the list, without changing the list.
+
+        NaN goes last in either direction, and -0.0 equals 0.0, so a stable sort keeps them in their original order.
+
+        Parameters:
+            reverse (bool): Sort in descending order.
+            stable (bool): Keep equal elements in their original order, also when `reverse` is set, like
+                `sorted(reverse=True)`. Passing `False` allows a faster unstable sort of small lists.
+
+        Returns:
+            IntArrayList: The permutation `p` such that `[self[i] for i in p]` is sorted.
+
+        Raises:
+            OverflowError: If the list has more elements than an `IntArrayList` can index.
+
+        Example:
+            >>> FloatArrayList([3.5, 1.5, 2.5]).argsort()
+            [1, 2, 0]
+        """
+        pass
+
+    def sum(self) -> float:
+        """
+        Returns the sum of all elements, computed natively with SIMD and with the GIL released.
+
+        The sum is accumulated in double precision in several lanes at once, so the last bits may differ from
+        `sum()`, which adds the elements one by one.
+
+        Returns:
+            float: The sum of the list, 0.0 if the list is empty.
+
+        Example:
+            >>> FloatArrayList([1.5, 2.5, 3.0]).sum()
+            7.0
+        """
+        pass
+
+    def min(self) -> float:
+        """
+        Returns the smallest element, computed natively with SIMD and with the GIL released.
+
+        NaN propagates: if any element is NaN, the result is NaN, like `numpy.min()`.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> FloatArrayList([3.5, 1.5, 2.5]).min()
+            1.5
+        """
+        pass
+
+    def max(self) -> float:
+        """
+        Returns the largest element, computed natively with SIMD and with the GIL released.
+
+        NaN propagates: if any element is NaN, the result is NaN, like `numpy.max()`.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> FloatArrayList([3.5, 1.5, 2.5]).max()
+            3.5
+        """
+        pass
+
+    def minmax(self) -> tuple[float, float]:
+        """
+        Returns both the smallest and the largest element in a single pass over the list.
+
+        Both are NaN if any element is NaN.
+
+        Returns:
+            tuple[float, float]: `(min, max)` of the list.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> FloatArrayList([3.5, 1.5, 2.5]).minmax()
+            (1.5, 3.5)
+        """
+        pass
+
+    def argmin(self) -> int:
+        """
+        Returns the index of the smallest element. If it occurs several times, the first index is returned.
+
+        If the list contains NaN, the index of the first NaN is returned, like `numpy.argmin()`.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> FloatArrayList([3.5, 1.5, 2.5, 1.5]).argmin()
+            1
+        """
+        pass
+
+    def argmax(self) -> int:
+        """
+        Returns the index of the largest element. If it occurs several times, the first index is returned.
+
+        If the list contains NaN, the index of the first NaN is returned, like `numpy.argmax()`.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> FloatArrayList([3.5, 1.5, 3.5, 2.5]).argmax()
+            0
+        """
+        pass
+
+    def dot(self, __other: FloatArrayList | DoubleArrayList | Buffer) -> float:
+        """
+        Returns the dot product of this list and `__other`, computed natively with SIMD and with the GIL released.
+
+        Products are accumulated in double precision, so long vectors don't lose the precision a float32 sum would.
+
+        Parameters:
+            __other: A `FloatArrayList`, a `DoubleArrayList` or a C-contiguous buffer of float32 or float64,
+                with the same length as this list.
+
+        Returns:
+            float: The sum of the products of the elements at the same index.
+
+        Raises:
+            TypeError: If `__other` isn't made of float32 or float64.
+            ValueError: If the lengths differ.
+
+        Example:
+            >>> FloatArrayList([1.0, 2.0, 3.0]).dot(FloatArrayList([4.0, 5.0, 6.0]))
+            32.0
+        """
+        pass
+
+
+class FloatArrayListIter(Iterator[float]):
+    """
+    Iterator for FloatArrayList.
+
+    This class provides an iterator over a `FloatArrayList`, allowing you to iterate over the elements
+    of the list one by one.
+
+    Note:
+        This class cannot be directly instantiated by users. It is designed to be used internally by
+        `FloatArrayList` and can only be obtained by calling the `__iter__` method on a `FloatArrayList` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> float:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            float: The next element in the `FloatArrayList`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+        """
+        pass
+
+class DoubleArrayList(list[float]):
+    """
+    A specialized version of Python's list for floats, optimized for performance by using a C implementation.
+
+    This class behaves similarly to the standard Python `list`, but it is specifically optimized for storing floats.
+    Elements are kept as C `double` values (float64), the same precision as Python floats.
+    The storage is 64-byte aligned so the numeric methods can use SIMD.
+
+    Parameters:
+        - `exceptSize` (optional): The expected size of the list. This is used for preallocating memory to avoid
+          frequent resizing when adding elements.
+        - `iterable` (optional): An iterable of floats to initialize the list with.
+
+    Example:
+        >>> my_list = DoubleArrayList([1.5, 2.5])
+        >>> my_list.append(4)
+        >>> print(my_list)
+        [1.5, 2.5, 4.0]
+
+    Note:
+        - Elements are compared as the Python floats they turn into, so `x in my_list` and `my_list.index(x)`
+          match exactly what `my_list[i] == x` would.
+    """
+
+    @overload
+    def __init__(self, exceptSize: int) -> None:
+        """
+        Initializes an empty `DoubleArrayList` with a preallocated size.
+
+        Parameters:
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing
+                              as elements are added.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[float], exceptSize: int) -> None:
+        """
+        Initializes a `DoubleArrayList` from an iterable of floats with a preallocated size.
+
+        Parameters:
+            iterable (Iterable[float]): An iterable of floats to initialize the list with.
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing.
+        """
+        pass
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `DoubleArrayList` with no preallocated size.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[float]) -> None:
+        """
+        Initializes a `DoubleArrayList` from an iterable of floats.
+
+        Parameters:
+            iterable (Iterable[float]): An iterable of floats to initialize the list with.
+        """
+        pass
+
+    @staticmethod
+    def frombuffer(__buffer: Buffer) -> DoubleArrayList:
+        """
+        Creates a `DoubleArrayList` from a C-contiguous buffer of float32 or float64, such as a numpy array.
+
+        The elements are copied in native code without creating a Python object per element.
+
+        Parameters:
+            __buffer (Buffer): The buffer to copy, a `FloatArrayList` and a `DoubleArrayList` work as well.
+
+        Returns:
+            DoubleArrayList: A new `DoubleArrayList` with a copy of the elements.
+
+        Raises:
+            TypeError: If the buffer isn't made of float32 or float64.
+            BufferError: If the buffer isn't C-contiguous, some exporters like numpy raise ValueError instead.
+
+        Example:
+            >>> import numpy
+            >>> DoubleArrayList.frombuffer(numpy.linspace(0, 1, 3, dtype=numpy.float64))
+            [0.0, 0.5, 1.0]
+        """
+        pass
+
+    def view(self, readonly: bool = False) -> memoryview:
+        """
+        Returns a `memoryview` over the elements of the list, without copying them.
+
+        The list can't change its size while any view, or anything else holding its buffer such as a numpy
+        array made with `numpy.asarray()`, is alive. Operations that would resize it raise `BufferError`.
+
+        Parameters:
+            readonly (bool): Return a read-only view, consumers like numpy then can't write through it.
+
+        Returns:
+            memoryview: A view with format 'd'.
+
+        Example:
+            >>> lst = DoubleArrayList([1.5, 2.5])
+            >>> view = lst.view(readonly=True)
+            >>> view.readonly, view.tolist()
+            (True, [1.5, 2.5])
+        """
+        pass
+
+    def resize(self, __size: int) -> None:
+        """
+        Resizes the `DoubleArrayList` to the specified size.
+
+        If the new size is larger than the current size, the list will be extended with zeros. If the new size is smaller,
+        excess elements will be removed.
+
+        Parameters:
+            __size (int): The new size of the list.
+
+        Example:
+            >>> my_list = DoubleArrayList([1.5, 2.5])
+            >>> my_list.resize(3)
+            >>> print(my_list)
+            [1.5, 2.5, 0.0]
+        """
+        pass
+
+    def to_list(self) -> list[float]:
+        """
+        Converts the `DoubleArrayList` to a standard Python list.
+
+        Returns:
+            list[float]: A new list containing all the elements of the `DoubleArrayList`.
+
+        Example:
+            >>> DoubleArrayList([1.5, 2.5]).to_list()
+            [1.5, 2.5]
+        """
+        pass
+
+    def sort(self, *, key: Callable[[float], Any] | None = None, reverse: bool = False,
+             algorithm: str = "auto") -> None:
+        """
+        Sorts the list in place, natively and with the GIL released.
+
+        The floats are sorted as integers with the same order, using the same algorithms as `IntArrayList.sort()`:
+        `"bitonic"` sorts with SIMD sorting networks and merges, `"radix"` with an LSD radix sort, and `"auto"`
+        uses radix sort on all but small lists.
+
+        Unlike `list.sort()`, NaN has a defined place: it goes last, also when `reverse` is set, like numpy does.
+
+        Parameters:
+            key (Callable[[float], Any] | None): A function computing the sort key of every element.
+            reverse (bool): Sort in descending order.
+            algorithm (str): `"auto"`, `"bitonic"` or `"radix"`.
+
+        Raises:
+            ValueError: If `algorithm` is unknown.
+
+        Example:
+            >>> my_list = DoubleArrayList([2.5, float("nan"), -1.0, 0.5])
+            >>> my_list.sort(reverse=True)
+            >>> my_list
+            [2.5, 0.5, -1.0, nan]
+        """
+        pass
+
+    def argsort(self, reverse: bool = False, stable: bool = True) -> IntArrayList:
+        """
+        Returns the indices that would sort the list, without changing the list.
+
+        NaN goes last in either direction, and -0.0 equals 0.0, so a stable sort keeps them in their original order.
+
+        Parameters:
+            reverse (bool): Sort in descending order.
+            stable (bool): Keep equal elements in their original order, also when `reverse` is set, like
+                `sorted(reverse=True)`. Passing `False` allows a faster unstable sort of small lists.
+
+        Returns:
+            IntArrayList: The permutation `p` such that `[self[i] for i in p]` is sorted.
+
+        Raises:
+            OverflowError: If the list has more elements than an `IntArrayList` can index.
+
+        Example:
+            >>> DoubleArrayList([3.5, 1.5, 2.5]).argsort()
+            [1, 2, 0]
+        """
+        pass
+
+    def sum(self) -> float:
+        """
+        Returns the sum of all elements, computed natively with SIMD and with the GIL released.
+
+        The sum is accumulated in double precision in several lanes at once, so the last bits may differ from
+        `sum()`, which adds the elements one by one.
+
+        Returns:
+            float: The sum of the list, 0.0 if the list is empty.
+
+        Example:
+            >>> DoubleArrayList([1.5, 2.5, 3.0]).sum()
+            7.0
+        """
+        pass
+
+    def min(self) -> float:
+        """
+        Returns the smallest element, computed natively with SIMD and with the GIL released.
+
+        NaN propagates: if any element is NaN, the result is NaN, like `numpy.min()`.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> DoubleArrayList([3.5, 1.5, 2.5]).min()
+            1.5
+        """
+        pass
+
+    def max(self) -> float:
+        """
+        Returns the largest element, computed natively with SIMD and with the GIL released.
+
+        NaN propagates: if any element is NaN, the result is NaN, like `numpy.max()`.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> DoubleArrayList([3.5, 1.5, 2.5]).max()
+            3.5
+        """
+        pass
+
+    def minmax(self) -> tuple[float, float]:
+        """
+        Returns both the smallest and the largest element in a single pass over the list.
+
+        Both are NaN if any element is NaN.
+
+        Returns:
+            tuple[float, float]: `(min, max)` of the list.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> DoubleArrayList([3.5, 1.5, 2.5]).minmax()
+            (1.5, 3.5)
+        """
+        pass
+
+    def argmin(self) -> int:
+        """
+        Returns the index of the smallest element. If it occurs several times, the first index is returned.
+
+        If the list contains NaN, the index of the first NaN is returned, like `numpy.argmin()`.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> DoubleArrayList([3.5, 1.5, 2.5, 1.5]).argmin()
+            1
+        """
+        pass
+
+    def argmax(self) -> int:
+        """
+        Returns the index of the largest element. If it occurs several times, the first index is returned.
+
+        If the list contains NaN, the index of the first NaN is returned, like `numpy.argmax()`.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> DoubleArrayList([3.5, 1.5, 3.5, 2.5]).argmax()
+            0
+        """
+        pass
+
+    def dot(self, __other: FloatArrayList | DoubleArrayList | Buffer) -> float:
+        """
+        Returns the dot product of this list and `__other`, computed natively with SIMD and with the GIL released.
+
+        Products are accumulated in double precision, in several lanes at once, so the last bits may differ
+        from a sum of products taken one by one.
+
+        Parameters:
+            __other: A `FloatArrayList`, a `DoubleArrayList` or a C-contiguous buffer of float32 or float64,
+                with the same length as this list.
+
+        Returns:
+            float: The sum of the products of the elements at the same index.
+
+        Raises:
+            TypeError: If `__other` isn't made of float32 or float64.
+            ValueError: If the lengths differ.
+
+        Example:
+            >>> DoubleArrayList([1.0, 2.0, 3.0]).dot(DoubleArrayList([4.0, 5.0, 6.0]))
+            32.0
+        """
+        pass
+
+
+class DoubleArrayListIter(Iterator[float]):
+    """
+    Iterator for DoubleArrayList.
+
+    This class provides an iterator over a `DoubleArrayList`, allowing you to iterate over the elements
+    of the list one by one.
+
+    Note:
+        This class cannot be directly instantiated by users. It is designed to be used internally by
+        `DoubleArrayList` and can only be obtained by calling the `__iter__` method on a `DoubleArrayList` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> float:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            float: The next element in the `DoubleArrayList`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+        """
+        pass
@@ -7,16 +7,94 @@ from .__pyfastutil import BigIntArrayList as __BigIntArrayList
 # noinspection PyUnresolvedReferences
 from .__pyfastutil import BigIntArrayListIter as __BigIntArrayListIter
 # noinspection PyUnresolvedReferences
+from .__pyfastutil import ByteArrayList as __ByteArrayList
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import ByteArrayListIter as __ByteArrayListIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import ShortArrayList as __ShortArrayList
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import ShortArrayListIter as __ShortArrayListIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import UnsignedIntArrayList as __UnsignedIntArrayList
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import UnsignedIntArrayListIter as __UnsignedIntArrayListIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import UnsignedLongArrayList as __UnsignedLongArrayList
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import UnsignedLongArrayListIter as __UnsignedLongArrayListIter
+# noinspection PyUnresolvedReferences
 from .__pyfastutil import IntLinkedList as __IntLinkedList
 # noinspection PyUnresolvedReferences
 from .__pyfastutil import IntLinkedListIter as __IntLinkedListIter
 # noinspection PyUnresolvedReferences
-# from .__pyfastutil import IntIntHashMap as __IntIntHashMap
+from .__pyfastutil import IntArrayDeque as __IntArrayDeque
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import IntArrayDequeIter as __IntArrayDequeIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import LongArrayDeque as __LongArrayDeque
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import LongArrayDequeIter as __LongArrayDequeIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import IntHeapPriorityQueue as __IntHeapPriorityQueue
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import LongHeapPriorityQueue as __LongHeapPriorityQueue
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import IndexedIntHeap as __IndexedIntHeap
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import IntIntHashMap as __IntIntHashMap
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import IntIntHashMapIter as __IntIntHashMapIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import IntHashSet as __IntHashSet
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import IntHashSetIter as __IntHashSetIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import LongHashSet as __LongHashSet
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import LongHashSetIter as __LongHashSetIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import BitSet as __BitSet
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import BitSetIter as __BitSetIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import RoaringBitmap as __RoaringBitmap
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import RoaringBitmapIter as __RoaringBitmapIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import Int2ObjectHashMap as __Int2ObjectHashMap
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import Int2ObjectHashMapIter as __Int2ObjectHashMapIter
 
 IntArrayList = __IntArrayList.IntArrayList
 IntArrayListIter = __IntArrayListIter.IntArrayListIter
 BigIntArrayList = __BigIntArrayList.BigIntArrayList
 BigIntArrayListIter = __BigIntArrayListIter.BigIntArrayListIter
+ByteArrayList = __ByteArrayList.ByteArrayList
+ByteArrayListIter = __ByteArrayListIter.ByteArrayListIter
+ShortArrayList = __ShortArrayList.ShortArrayList
+ShortArrayListIter = __ShortArrayListIter.ShortArrayListIter
+UnsignedIntArrayList = __UnsignedIntArrayList.UnsignedIntArrayList
+UnsignedIntArrayListIter = __UnsignedIntArrayListIter.UnsignedIntArrayListIter
+UnsignedLongArrayList = __UnsignedLongArrayList.UnsignedLongArrayList
+UnsignedLongArrayListIter = __UnsignedLongArrayListIter.UnsignedLongArrayListIter
 IntLinkedList = __IntLinkedList.IntLinkedList
 IntLinkedListIter = __IntLinkedListIter.IntLinkedListIter
-# IntIntHashMap = __IntIntHashMap.IntIntHashMap
+IntArrayDeque = __IntArrayDeque.IntArrayDeque
+IntArrayDequeIter = __IntArrayDequeIter.IntArrayDequeIter
+LongArrayDeque = __LongArrayDeque.LongArrayDeque
+LongArrayDequeIter = __LongArrayDequeIter.LongArrayDequeIter
+IntHeapPriorityQueue = __IntHeapPriorityQueue.IntHeapPriorityQueue
+LongHeapPriorityQueue = __LongHeapPriorityQueue.LongHeapPriorityQueue
+IndexedIntHeap = __IndexedIntHeap.IndexedIntHeap
+IntIntHashMap = __IntIntHashMap.IntIntHashMap
+IntIntHashMapIter = __IntIntHashMapIter.IntIntHashMapIter
+IntHashSet = __IntHashSet.IntHashSet
+IntHashSetIter = __IntHashSetIter.IntHashSetIter
+LongHashSet = __LongHashSet.LongHashSet
+LongHashSetIter = __LongHashSetIter.LongHashSetIter
+BitSet = __BitSet.BitSet
+BitSetIter = __BitSetIter.BitSetIter
+RoaringBitmap = __RoaringBitmap.RoaringBitmap
+RoaringBitmapIter = __RoaringBitmapIter.RoaringBitmapIter
+Int2ObjectHashMap = __Int2ObjectHashMap.Int2ObjectHashMap
+Int2ObjectHashMapIter = __Int2ObjectHashMapIter.Int2ObjectHashMapIter
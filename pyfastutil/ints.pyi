@@ -1,4 +1,9 @@
-from typing import overload, Iterable, SupportsIndex, Iterator
+from typing import overload, Iterable, SupportsIndex, Iterator, Mapping, Generic, TypeVar, Callable, Any, Literal
+from typing_extensions import Buffer
+from collections import deque
+from .objects import ObjectArrayList
+
+_V = TypeVar("_V")
 
 
 class IntArrayList(list[int]):
@@ -111,6 +116,53 @@ class IntArrayList(list[int]):
         """
         pass
 
+    @staticmethod
+    def frombuffer(__buffer: Buffer) -> IntArrayList:
+        """
+        Creates an `IntArrayList` from a C-contiguous buffer of int32 or int64, such as a numpy array.
+
+        The elements are copied in native code without creating a Python object per element.
+        int64 elements are narrowed and must fit in an int32.
+
+        Parameters:
+            __buffer (Buffer): The buffer to copy, an `IntArrayList` and a `BigIntArrayList` work as well.
+
+        Returns:
+            IntArrayList: A new `IntArrayList` with a copy of the elements.
+
+        Raises:
+            TypeError: If the buffer isn't made of int32 or int64.
+            BufferError: If the buffer isn't C-contiguous, some exporters like numpy raise ValueError instead.
+            OverflowError: If an int64 element doesn't fit in an int32.
+
+        Example:
+            >>> import numpy
+            >>> IntArrayList.frombuffer(numpy.arange(5))
+            [0, 1, 2, 3, 4]
+        """
+        pass
+
+    def view(self, readonly: bool = False) -> memoryview:
+        """
+        Returns a `memoryview` over the elements of the list, without copying them.
+
+        The list can't change its size while any view, or anything else holding its buffer such as a numpy
+        array made with `numpy.asarray()`, is alive. Operations that would resize it raise `BufferError`.
+
+        Parameters:
+            readonly (bool): Return a read-only view, consumers like numpy then can't write through it.
+
+        Returns:
+            memoryview: A view with format 'i'.
+
+        Example:
+            >>> lst = IntArrayList([1, 2, 3])
+            >>> view = lst.view(readonly=True)
+            >>> view.readonly, view.tolist()
+            (True, [1, 2, 3])
+        """
+        pass
+
     def resize(self, __size: int) -> None:
         """
         Resizes the `IntArrayList` to the specified size.
@@ -151,340 +203,597 @@ class IntArrayList(list[int]):
         """
         pass
 
+    def sort(self, *, key: Callable[[int], Any] | None = None, reverse: bool = False,
+             parallel: bool = False, threads: int = 0, algorithm: str = "auto") -> None:
+        """
+        Sorts the list in place, natively and with the GIL released.
 
-class IntArrayListIter(Iterator[int]):
-    """
-    Iterator for IntArrayList.
+        `algorithm` picks how: `"bitonic"` sorts with SIMD sorting networks and merges, `"radix"` with an LSD
+        radix sort that needs a scratch copy of the list, and `"auto"` uses radix sort on all but small lists.
 
-    This class provides an iterator over an `IntArrayList`, allowing you to iterate over the elements
-    of the list one by one.
+        With `parallel=True`, the list is split into chunks that are sorted on separate cores of a thread
+        pool shared by the whole module, then merged in parallel. Lists too small to benefit from it are
+        sorted on the calling thread. `parallel` and `threads` are ignored when `key` is given.
 
-    Note:
-        This class cannot be directly instantiated by users. It is designed to be used internally by
-        `IntArrayList` and can only be obtained by calling the `__iter__` method on an `IntArrayList` object.
+        Parameters:
+            key (Callable[[int], Any] | None): A function computing the sort key of every element.
+            reverse (bool): Sort in descending order.
+            parallel (bool): Sort on multiple threads.
+            threads (int): How many chunks to sort at once, 0 for one per hardware thread.
+            algorithm (str): `"auto"`, `"bitonic"` or `"radix"`.
 
-    Example:
-        >>> int_list = IntArrayList([1, 2, 3])
-        >>> iter_obj = iter(int_list)  # This returns an IntArrayListIter instance
-        >>> next(iter_obj)
-        1
-        >>> next(iter_obj)
-        2
-        >>> next(iter_obj)
-        3
-        >>> next(iter_obj)  # Raises StopIteration
+        Raises:
+            ValueError: If `threads` is negative or `algorithm` is unknown.
 
-    Raises:
-        TypeError: If attempted to be instantiated directly.
-    """
+        Example:
+            >>> my_list = IntArrayList.from_range(10_000_000)
+            >>> my_list.reverse()
+            >>> my_list.sort(parallel=True, threads=8)
+            >>> my_list[:3]
+            [0, 1, 2]
+        """
+        pass
 
-    def __next__(self) -> int:
+    def argsort(self, reverse: bool = False, stable: bool = True) -> IntArrayList:
         """
-        Return the next element in the iteration.
+        Returns the indices that would sort the list, without changing the list.
 
-        This method retrieves the next element from the `IntArrayList` that this iterator is associated with.
-        If all elements have been iterated over, it raises a `StopIteration` exception.
+        Large lists are sorted with a radix sort over (value, index) pairs in native code, with the GIL
+        released, so no element is boxed.
+
+        Parameters:
+            reverse (bool): Sort in descending order.
+            stable (bool): Keep equal elements in their original order, also when `reverse` is set, like
+                `sorted(reverse=True)`. Passing `False` allows a faster unstable sort of small lists.
 
         Returns:
-            int: The next integer in the `IntArrayList`.
+            IntArrayList: The permutation `p` such that `[self[i] for i in p]` is sorted.
 
         Raises:
-            StopIteration: If there are no more elements to iterate over.
+            OverflowError: If the list has more elements than an `IntArrayList` can index.
+
+        Example:
+            >>> IntArrayList([30, 10, 20]).argsort()
+            [1, 2, 0]
         """
         pass
 
+    def sort_with(self, other: IntArrayList | BigIntArrayList | ObjectArrayList, reverse: bool = False) -> None:
+        """
+        Sorts the list in place, stably, and reorders `other` with the same permutation.
 
-class BigIntArrayList(list[int]):
-    """
-    A specialized version of Python's list for integers, optimized for performance by using a C implementation.
+        This keeps parallel columns aligned without building tuples: `other` is reordered in native code, and
+        for an `ObjectArrayList` only the references move.
 
-    This class behaves similarly to the standard Python `list`, but it is specifically optimized for storing integers.
-    It may offer better performance characteristics, especially for large data sets, due to its underlying C-based
-    optimizations.
+        Parameters:
+            other: The list to reorder, with the same length as this list.
+            reverse (bool): Sort in descending order.
 
-    The `BigIntArrayList` is restricted to storing integers (`long long`), and it is designed to efficiently store values that
-    fit within the range of standard C long long types, which is typically `LONG_LONG_MIN` to `LONG_LONG_MAX`. Storing values outside
-    of this range may result in undefined behavior.
+        Raises:
+            TypeError: If `other` is not an `IntArrayList`, a `BigIntArrayList` or an `ObjectArrayList`.
+            ValueError: If `other` doesn't have the same length as this list.
 
-    Parameters:
-        - `exceptSize` (optional): The expected size of the list. This is used for preallocating memory to avoid
-          frequent resizing when adding elements.
-        - `iterable` (optional): An iterable of integers to initialize the list with.
+        Example:
+            >>> scores = IntArrayList([30, 10, 20])
+            >>> names = ObjectArrayList(["c", "a", "b"])
+            >>> scores.sort_with(names)
+            >>> scores, names
+            ([10, 20, 30], ['a', 'b', 'c'])
+        """
+        pass
 
-    Example:
-        >>> my_list = BigIntArrayList([1, 2, 3])
-        >>> my_list.append(4)
-        >>> print(my_list)
-        [1, 2, 3, 4]
+    def nth_element(self, k: int) -> int:
+        """
+        Partially sorts the list in place so that the element at index `k` is the one a full sort would put there.
 
-        >>> my_list = BigIntArrayList(10)  # Preallocate space for 10 elements
-        >>> my_list.append(42)
-        >>> print(my_list)
-        [42]
+        Nothing before index `k` is greater than it and nothing after it is smaller, the order on either side is
+        unspecified. This runs in linear time on average, so it is much faster than `sort()` when only one rank
+        is needed, such as a median or a percentile. The GIL is released while partitioning.
 
-    Note:
-        - The `BigIntArrayList` is designed to store integers efficiently within the range of standard C long long types
-          (`LONG_LONG_MIN` to `LONG_LONG_MAX`). Storing values outside of this range is undefined.
-    """
+        Parameters:
+            k (int): The index to select, negative indices count from the end.
 
-    @overload
-    def __init__(self, exceptSize: int) -> None:
+        Returns:
+            int: The element now at index `k`.
+
+        Raises:
+            IndexError: If `k` is out of range.
+
+        Example:
+            >>> lst = IntArrayList([5, 1, 4, 2, 3])
+            >>> lst.nth_element(2)
+            3
         """
-        Initializes an empty `BigIntArrayList` with a preallocated size.
+        pass
+
+    def partial_sort(self, k: int, reverse: bool = False) -> None:
+        """
+        Moves the `k` smallest elements to the front of the list in sorted order, in place.
+
+        The order of the remaining elements is unspecified. Only the first `k` elements are sorted, so this is
+        much faster than `sort()` when `k` is small. The GIL is released while sorting.
 
         Parameters:
-            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing
-                              as elements are added.
+            k (int): How many elements to sort, values larger than the list sort all of it.
+            reverse (bool): Move the `k` largest elements to the front in descending order instead.
+
+        Raises:
+            ValueError: If `k` is negative.
+
+        Example:
+            >>> lst = IntArrayList([5, 1, 4, 2, 3])
+            >>> lst.partial_sort(2)
+            >>> lst[:2]
+            [1, 2]
         """
         pass
 
-    @overload
-    def __init__(self, iterable: Iterable[int], exceptSize: int) -> None:
+    def top_k(self, k: int, reverse: bool = True) -> IntArrayList:
         """
-        Initializes an `BigIntArrayList` from an iterable of integers with a preallocated size.
+        Returns the `k` largest elements in descending order as a new list, leaving this list untouched.
+
+        The GIL is released while selecting.
 
         Parameters:
-            iterable (Iterable[int]): An iterable of integers to initialize the list with.
-            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing.
+            k (int): How many elements to return, values larger than the list return all of it.
+            reverse (bool): Pass False to return the `k` smallest elements in ascending order instead.
+
+        Returns:
+            IntArrayList: A new list with the selected elements.
+
+        Raises:
+            ValueError: If `k` is negative.
+
+        Example:
+            >>> lst = IntArrayList([5, 1, 4, 2, 3])
+            >>> lst.top_k(2)
+            [5, 4]
+            >>> lst.top_k(2, reverse=False)
+            [1, 2]
         """
         pass
 
-    @overload
-    def __init__(self) -> None:
+    def select(self, __mask: BitSet) -> IntArrayList:
         """
-        Initializes an empty `BigIntArrayList` with no preallocated size.
+        Returns the elements whose bit is set in `__mask` as a new list, in order.
+
+        The elements are compacted with SIMD, a whole machine word of the mask at a time.
+
+        Parameters:
+            __mask (BitSet): A mask with one bit per element of the list.
+
+        Returns:
+            IntArrayList: A new list with the selected elements.
+
+        Raises:
+            TypeError: If `__mask` is not a `BitSet`.
+            ValueError: If the size of `__mask` is not the length of the list.
+
+        Example:
+            >>> lst = IntArrayList([10, 20, 30, 40])
+            >>> lst.select(BitSet([True, False, False, True]))
+            [10, 40]
         """
         pass
 
-    @overload
-    def __init__(self, iterable: Iterable[int]) -> None:
+    def to_bitset(self, __universe: int) -> BitSet:
         """
-        Initializes an `BigIntArrayList` from an iterable of integers.
+        Returns a `BitSet` of `__universe` bits in which the bit of every element of the list is set.
 
         Parameters:
-            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+            __universe (int): The size of the returned `BitSet`.
+
+        Returns:
+            BitSet: A new `BitSet`.
+
+        Raises:
+            ValueError: If `__universe` is negative or an element is not in `range(__universe)`.
+
+        Example:
+            >>> ids = IntArrayList([1, 3])
+            >>> ids.to_bitset(5)
+            [False, True, False, True, False]
+            >>> IntArrayList([10, 20, 30, 40]).select(ids.to_bitset(4))
+            [20, 40]
         """
         pass
 
-    @staticmethod
-    @overload
-    def from_range(__start: SupportsIndex, __stop: SupportsIndex, __step: SupportsIndex = 1) -> BigIntArrayList:
+    def sorted_intersect(self, __other: IntArrayList) -> IntArrayList:
         """
-        Creates an `BigIntArrayList` from a range of integers, similar to the built-in `range()` function.
+        Returns the elements of this sorted list that are also in the sorted `__other`, as a new sorted list.
+
+        Both lists are treated as multisets: a value appearing `m` times here and `n` times in `__other`
+        appears `min(m, n)` times in the result. Lists of very different sizes are galloped over, and
+        strictly increasing lists are compared a vector block at a time. The GIL is released meanwhile.
+
+        Both lists must be sorted in ascending order, the result is unspecified otherwise.
 
         Parameters:
-            __start (SupportsIndex): The starting value of the range (inclusive).
-            __stop (SupportsIndex): The stopping value of the range (exclusive).
-            __step (SupportsIndex, optional): The step between each value in the range. Defaults to 1.
+            __other (IntArrayList): Another sorted list.
 
         Returns:
-            BigIntArrayList: A new `BigIntArrayList` object containing the integers in the specified range.
+            IntArrayList: A new sorted list.
+
+        Raises:
+            TypeError: If `__other` is not a `IntArrayList`.
 
         Example:
-            >>> BigIntArrayList.from_range(1, 10, 2)
-            [1, 3, 5, 7, 9]
+            >>> IntArrayList([1, 2, 2, 3]).sorted_intersect(IntArrayList([2, 2, 2, 4]))
+            [2, 2]
         """
         pass
 
-    @staticmethod
-    @overload
-    def from_range(__stop: SupportsIndex) -> BigIntArrayList:
+    def sorted_union(self, __other: IntArrayList) -> IntArrayList:
         """
-        Creates an `BigIntArrayList` from a range of integers starting from 0 to the specified stop value.
+        Returns the elements of this sorted list or the sorted `__other`, as a new sorted list.
+
+        A value appearing `m` times here and `n` times in `__other` appears `max(m, n)` times in the result.
+        Both lists must be sorted in ascending order, the result is unspecified otherwise.
 
         Parameters:
-            __stop (SupportsIndex): The stopping value of the range (exclusive).
+            __other (IntArrayList): Another sorted list.
 
         Returns:
-            BigIntArrayList: A new `BigIntArrayList` object containing the integers from 0 up to `__stop`.
+            IntArrayList: A new sorted list.
+
+        Raises:
+            TypeError: If `__other` is not a `IntArrayList`.
 
         Example:
-            >>> BigIntArrayList.from_range(5)
-            [0, 1, 2, 3, 4]
+            >>> IntArrayList([1, 2, 2]).sorted_union(IntArrayList([2, 3]))
+            [1, 2, 2, 3]
         """
         pass
 
-    def resize(self, __size: int) -> None:
+    def sorted_difference(self, __other: IntArrayList) -> IntArrayList:
         """
-        Resizes the `BigIntArrayList` to the specified size.
+        Returns the elements of this sorted list that are not in the sorted `__other`, as a new sorted list.
 
-        If the new size is larger than the current size, the list will be extended with zeros. If the new size is smaller,
-        excess elements will be removed.
+        A value appearing `m` times here and `n` times in `__other` appears `m - n` times in the result, if positive.
+        Both lists must be sorted in ascending order, the result is unspecified otherwise.
 
         Parameters:
-            __size (int): The new size of the list.
+            __other (IntArrayList): Another sorted list.
 
-        Example:
-            >>> my_list = BigIntArrayList([1, 2, 3])
-            >>> my_list.resize(5)
-            >>> print(my_list)
-            [1, 2, 3, 0, 0]
+        Returns:
+            IntArrayList: A new sorted list.
 
-            >>> my_list.resize(2)
-            >>> print(my_list)
+        Raises:
+            TypeError: If `__other` is not a `IntArrayList`.
+
+        Example:
+            >>> IntArrayList([1, 2, 2, 3]).sorted_difference(IntArrayList([2, 3]))
             [1, 2]
         """
         pass
 
-    def to_list(self) -> list[int]:
+    def merge(self, __other: IntArrayList) -> IntArrayList:
         """
-        Converts the `BigIntArrayList` to a standard Python list.
+        Returns all elements of this sorted list and the sorted `__other` as a new sorted list, keeping duplicates.
 
-        This method returns a new list containing the same elements as the `BigIntArrayList` in the same order. The returned list
-        will be a standard Python list, which can be used with all the usual Python list operations.
+        Both lists must be sorted in ascending order, the result is unspecified otherwise.
+
+        Parameters:
+            __other (IntArrayList): Another sorted list.
 
         Returns:
-            list[int]: A new list containing all the elements of the `BigIntArrayList`.
+            IntArrayList: A new sorted list of `len(self) + len(__other)` elements.
+
+        Raises:
+            TypeError: If `__other` is not a `IntArrayList`.
 
         Example:
-            >>> my_list = BigIntArrayList([1, 2, 3])
-            >>> py_list = my_list.to_list()
-            >>> print(py_list)
-            [1, 2, 3]
+            >>> IntArrayList([1, 3]).merge(IntArrayList([2, 3]))
+            [1, 2, 3, 3]
         """
         pass
 
+    @staticmethod
+    def merge_many(__lists: Iterable[IntArrayList]) -> IntArrayList:
+        """
+        Merges sorted lists into a new sorted list, keeping duplicates.
 
-class BigIntArrayListIter(Iterator[int]):
-    """
-    Iterator for BigIntArrayList.
+        The lists are merged pairwise, halving their number on every pass, with the GIL released.
 
-    This class provides an iterator over an `BigIntArrayList`, allowing you to iterate over the elements
-    of the list one by one.
+        Parameters:
+            __lists (Iterable[IntArrayList]): Sorted lists.
 
-    Note:
-        This class cannot be directly instantiated by users. It is designed to be used internally by
-        `BigIntArrayList` and can only be obtained by calling the `__iter__` method on an `BigIntArrayList` object.
+        Returns:
+            IntArrayList: A new sorted list.
 
-    Example:
-        >>> big_int_list = BigIntArrayList([1, 2, 3])
-        >>> iter_obj = iter(big_int_list)  # This returns an BigIntArrayListIter instance
-        >>> next(iter_obj)
-        1
-        >>> next(iter_obj)
-        2
-        >>> next(iter_obj)
-        3
-        >>> next(iter_obj)  # Raises StopIteration
+        Raises:
+            TypeError: If an element of `__lists` is not a `IntArrayList`.
 
-    Raises:
-        TypeError: If attempted to be instantiated directly.
-    """
+        Example:
+            >>> IntArrayList.merge_many([IntArrayList([1, 4]), IntArrayList([2]), IntArrayList([3, 5])])
+            [1, 2, 3, 4, 5]
+        """
+        pass
 
-    def __next__(self) -> int:
+    def bisect_left(self, x: int, lo: int = 0, hi: int | None = None) -> int:
         """
-        Return the next element in the iteration.
+        Returns the position to insert `x` at to keep this sorted list sorted, before any equal elements.
 
-        This method retrieves the next element from the `BigIntArrayList` that this iterator is associated with.
-        If all elements have been iterated over, it raises a `StopIteration` exception.
+        Works like `bisect.bisect_left`, but compares native elements with a branchless binary search
+        instead of creating an int object for every probe.
+
+        Parameters:
+            x (int): The value to search for.
+            lo (int): The start of the range searched.
+            hi (int, optional): The end of the range searched, the end of the list if None.
 
         Returns:
-            int: The next integer in the `BigIntArrayList`.
+            int: The position, in `range(lo, hi + 1)`.
 
         Raises:
-            StopIteration: If there are no more elements to iterate over.
+            TypeError: If `x` is not an int.
+            ValueError: If `lo` is negative.
+
+        Example:
+            >>> IntArrayList([1, 2, 2, 3]).bisect_left(2)
+            1
         """
         pass
 
-class IntLinkedList(list[int]):
-    """
-    A specialized linked list for integers, optimized for efficient insertion and deletion.
+    def bisect_right(self, x: int, lo: int = 0, hi: int | None = None) -> int:
+        """
+        Returns the position to insert `x` at to keep this sorted list sorted, after any equal elements.
 
-    `IntLinkedList` is implemented as a doubly linked list, providing O(1) time complexity for insertions and deletions
-    at both the head and tail, as well as for operations involving iterators. However, random access by index (e.g., `list[i]`)
-    requires O(n) time, as the list must be traversed to reach the desired element.
+        Works like `bisect.bisect_right`, see `bisect_left`.
 
-    This class behaves similarly to Python's built-in `list`, but is specifically optimized for storing integers and for
-    scenarios where frequent insertions and deletions are required, rather than random access.
+        Parameters:
+            x (int): The value to search for.
+            lo (int): The start of the range searched.
+            hi (int, optional): The end of the range searched, the end of the list if None.
 
-    Example:
-        >>> int_list = IntLinkedList()
-        >>> int_list.append(1)
-        >>> int_list.append(2)
-        >>> int_list.insert(0, 3)
-        >>> print(int_list)
-        [3, 1, 2]
+        Returns:
+            int: The position, in `range(lo, hi + 1)`.
 
-    Note:
-        - Insertion and deletion are O(1).
-        - Accessing elements by index is O(n).
-        - Iteration over the list is O(1) per step, making it efficient for sequential access.
+        Raises:
+            TypeError: If `x` is not an int.
+            ValueError: If `lo` is negative.
 
-    Raises:
-        TypeError: If an invalid operation is attempted.
-    """
+        Example:
+            >>> IntArrayList([1, 2, 2, 3]).bisect_right(2)
+            3
+        """
+        pass
 
-    @staticmethod
-    @overload
-    def from_range(__start: SupportsIndex, __stop: SupportsIndex, __step: SupportsIndex = 1) -> IntLinkedList:
+    def searchsorted(self, values: IntArrayList, side: str = "left") -> IntArrayList:
         """
-        Creates an `IntLinkedList` from a range of integers, similar to the built-in `range()` function.
+        Returns the insertion position of every element of `values` in this sorted list, like `numpy.searchsorted`.
+
+        The GIL is released while searching. Large batches over large lists are searched in a breadth first
+        copy of the list, where the next levels of the search can be prefetched together.
 
         Parameters:
-            __start (SupportsIndex): The starting value of the range (inclusive).
-            __stop (SupportsIndex): The stopping value of the range (exclusive).
-            __step (SupportsIndex, optional): The step between each value in the range. Defaults to 1.
+            values (IntArrayList): The values to search for, in any order.
+            side (str): "left" for the positions `bisect_left` would return, "right" for `bisect_right`.
 
         Returns:
-            IntLinkedList: A new `IntLinkedList` object containing the integers in the specified range.
+            IntArrayList: A new list with the position of every value.
+
+        Raises:
+            TypeError: If `values` is not a `IntArrayList`.
+            ValueError: If `side` is neither "left" nor "right".
 
         Example:
-            >>> IntLinkedList.from_range(1, 10, 2)
-            [1, 3, 5, 7, 9]
+            >>> IntArrayList([10, 20, 30]).searchsorted(IntArrayList([25, 10, 40]))
+            [2, 0, 3]
+            >>> IntArrayList([10, 20, 30]).searchsorted(IntArrayList([25, 10, 40]), side="right")
+            [2, 1, 3]
         """
         pass
 
-    @staticmethod
-    @overload
-    def from_range(__stop: SupportsIndex) -> IntLinkedList:
+    def contains_sorted(self, __value: int) -> bool:
         """
-        Creates an `IntLinkedList` from a range of integers starting from 0 to the specified stop value.
+        Returns if `__value` is in this sorted list, with a binary search instead of the linear scan of `in`.
 
         Parameters:
-            __stop (SupportsIndex): The stopping value of the range (exclusive).
+            __value (int): The value to look for.
 
         Returns:
-            IntLinkedList: A new `IntLinkedList` object containing the integers from 0 up to `__stop`.
+            bool: True if the value is in the list.
 
         Example:
-            >>> IntLinkedList.from_range(5)
-            [0, 1, 2, 3, 4]
+            >>> IntArrayList([1, 3, 5]).contains_sorted(3)
+            True
         """
         pass
 
-    def to_list(self) -> list[int]:
+    def unique(self, sorted: bool = False) -> IntArrayList:
         """
-        Converts the `IntLinkedList` to a standard Python list.
+        Returns every distinct element of the list once, as a new list.
 
-        This method returns a new list containing the same elements as the `IntLinkedList` in the same order. The returned list
-        will be a standard Python list, which can be used with all the usual Python list operations.
+        The GIL is released meanwhile. Few distinct values are collected in a hash set,
+        many by sorting a copy of the list.
+
+        Parameters:
+            sorted (bool): Return the values in ascending order instead of in order of first appearance.
 
         Returns:
-            list[int]: A new list containing all the elements of the `IntLinkedList`.
+            IntArrayList: A new list of the distinct elements.
 
         Example:
-            >>> int_list = IntLinkedList([1, 2, 3])
-            >>> py_list = int_list.to_list()
-            >>> print(py_list)
+            >>> lst = IntArrayList([3, 1, 3, 2, 1])
+            >>> lst.unique()
+            [3, 1, 2]
+            >>> lst.unique(sorted=True)
             [1, 2, 3]
         """
         pass
 
-class IntLinkedListIter(Iterator[int]):
+    def dedupe_sorted(self) -> None:
+        """
+        Removes adjacent duplicates in place, keeping the first of every run of equal elements.
+        On a sorted list this leaves every value once.
+
+        The list is compacted with SIMD compress, a vector of elements at a time.
+
+        Raises:
+            BufferError: If a buffer of the list is exported.
+
+        Example:
+            >>> lst = IntArrayList([1, 1, 2, 3, 3, 3])
+            >>> lst.dedupe_sorted()
+            >>> lst
+            [1, 2, 3]
+        """
+        pass
+
+    @overload
+    def value_counts(self, as_map: Literal[False] = False) -> tuple[IntArrayList, IntArrayList]:
+        """
+        Counts how many times every distinct element appears in the list, like `collections.Counter`
+        without creating an int object per element.
+
+        The counting sorts a copy of the list, with the GIL released.
+
+        Returns:
+            tuple[IntArrayList, IntArrayList]: The distinct values in ascending order and the count of each.
+
+        Raises:
+            OverflowError: If the list is too long for the counts to fit in an int.
+
+        Example:
+            >>> IntArrayList([3, 1, 3]).value_counts()
+            ([1, 3], [1, 2])
+        """
+        pass
+
+    @overload
+    def value_counts(self, as_map: Literal[True]) -> IntIntHashMap:
+        """
+        Counts how many times every distinct element appears in the list, into an `IntIntHashMap` from value to count.
+
+        Raises:
+            OverflowError: If the list is too long for the counts to fit in an int.
+
+        Example:
+            >>> IntArrayList([3, 1, 3]).value_counts(as_map=True)[3]
+            2
+        """
+        pass
+
+    def count_all(self, __values: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> list[int]:
+        """
+        Counts the occurrences of every value of `__values` in a single pass over the list.
+
+        This is much faster than calling `count()` once per value on large lists: a few values are compared
+        against the list with SIMD all at once, and more are looked up in a hash table. The GIL is released
+        while counting.
+
+        Parameters:
+            __values: The values to count, an iterable of ints, an `IntArrayList`, a `BigIntArrayList` or any
+                C-contiguous int32/int64 buffer.
+
+        Returns:
+            list[int]: The count of each value, in the same order as `__values`.
+
+        Example:
+            >>> IntArrayList([1, 2, 2, 3, 3, 3]).count_all([3, 1, 4])
+            [3, 1, 0]
+        """
+        pass
+
+    def sum(self) -> int:
+        """
+        Returns the sum of all elements, computed natively with SIMD and with the GIL released.
+
+        The sum is exact: it is accumulated in 64-bit integers, so it never overflows.
+
+        Returns:
+            int: The sum of the list, 0 if the list is empty.
+
+        Example:
+            >>> IntArrayList([1, 2, 3]).sum()
+            6
+        """
+        pass
+
+    def min(self) -> int:
+        """
+        Returns the smallest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> IntArrayList([3, 1, 2]).min()
+            1
+        """
+        pass
+
+    def max(self) -> int:
+        """
+        Returns the largest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> IntArrayList([3, 1, 2]).max()
+            3
+        """
+        pass
+
+    def minmax(self) -> tuple[int, int]:
+        """
+        Returns both the smallest and the largest element in a single pass over the list.
+
+        Returns:
+            tuple[int, int]: `(min, max)` of the list.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> IntArrayList([3, 1, 2]).minmax()
+            (1, 3)
+        """
+        pass
+
+    def argmin(self) -> int:
+        """
+        Returns the index of the smallest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> IntArrayList([3, 1, 2, 1]).argmin()
+            1
+        """
+        pass
+
+    def argmax(self) -> int:
+        """
+        Returns the index of the largest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> IntArrayList([3, 1, 3, 2]).argmax()
+            0
+        """
+        pass
+
+
+class IntArrayListIter(Iterator[int]):
     """
-    Iterator for `IntLinkedList`.
+    Iterator for IntArrayList.
 
-    This class provides an iterator over an `IntLinkedList`, allowing you to iterate over the elements
-    of the list one by one in O(1) time per step. The iterator maintains a reference to the list and iterates
-    through it in constant time for each element, making it very efficient for sequential access.
+    This class provides an iterator over an `IntArrayList`, allowing you to iterate over the elements
+    of the list one by one.
 
     Note:
         This class cannot be directly instantiated by users. It is designed to be used internally by
-        `IntLinkedList` and can only be obtained by calling the `__iter__` method on an `IntLinkedList` object.
+        `IntArrayList` and can only be obtained by calling the `__iter__` method on an `IntArrayList` object.
 
     Example:
-        >>> int_list = IntLinkedList([1, 2, 3])
-        >>> iter_obj = iter(int_list)  # This returns an IntLinkedListIter instance
+        >>> int_list = IntArrayList([1, 2, 3])
+        >>> iter_obj = iter(int_list)  # This returns an IntArrayListIter instance
         >>> next(iter_obj)
         1
         >>> next(iter_obj)
@@ -501,16 +810,3276 @@ class IntLinkedListIter(Iterator[int]):
         """
         Return the next element in the iteration.
 
-        This method retrieves the next element from the `IntLinkedList` that this iterator is associated with.
+        This method retrieves the next element from the `IntArrayList` that this iterator is associated with.
         If all elements have been iterated over, it raises a `StopIteration` exception.
 
         Returns:
-            int: The next integer in the `IntLinkedList`.
+            int: The next integer in the `IntArrayList`.
 
         Raises:
             StopIteration: If there are no more elements to iterate over.
         """
         pass
 
-# class IntIntHashMap(dict[int, int]):
-#     pass
+
+class BigIntArrayList(list[int]):
+    """
+    A specialized version of Python's list for integers, optimized for performance by using a C implementation.
+
+    This class behaves similarly to the standard Python `list`, but it is specifically optimized for storing integers.
+    It may offer better performance characteristics, especially for large data sets, due to its underlying C-based
+    optimizations.
+
+    The `BigIntArrayList` is restricted to storing integers (`long long`), and it is designed to efficiently store values that
+    fit within the range of standard C long long types, which is typically `LONG_LONG_MIN` to `LONG_LONG_MAX`. Storing values outside
+    of this range may result in undefined behavior.
+
+    Parameters:
+        - `exceptSize` (optional): The expected size of the list. This is used for preallocating memory to avoid
+          frequent resizing when adding elements.
+        - `iterable` (optional): An iterable of integers to initialize the list with.
+
+    Example:
+        >>> my_list = BigIntArrayList([1, 2, 3])
+        >>> my_list.append(4)
+        >>> print(my_list)
+        [1, 2, 3, 4]
+
+        >>> my_list = BigIntArrayList(10)  # Preallocate space for 10 elements
+        >>> my_list.append(42)
+        >>> print(my_list)
+        [42]
+
+    Note:
+        - The `BigIntArrayList` is designed to store integers efficiently within the range of standard C long long types
+          (`LONG_LONG_MIN` to `LONG_LONG_MAX`). Storing values outside of this range is undefined.
+    """
+
+    @overload
+    def __init__(self, exceptSize: int) -> None:
+        """
+        Initializes an empty `BigIntArrayList` with a preallocated size.
+
+        Parameters:
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing
+                              as elements are added.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int], exceptSize: int) -> None:
+        """
+        Initializes an `BigIntArrayList` from an iterable of integers with a preallocated size.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing.
+        """
+        pass
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `BigIntArrayList` with no preallocated size.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int]) -> None:
+        """
+        Initializes an `BigIntArrayList` from an iterable of integers.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+        """
+        pass
+
+    @staticmethod
+    @overload
+    def from_range(__start: SupportsIndex, __stop: SupportsIndex, __step: SupportsIndex = 1) -> BigIntArrayList:
+        """
+        Creates an `BigIntArrayList` from a range of integers, similar to the built-in `range()` function.
+
+        Parameters:
+            __start (SupportsIndex): The starting value of the range (inclusive).
+            __stop (SupportsIndex): The stopping value of the range (exclusive).
+            __step (SupportsIndex, optional): The step between each value in the range. Defaults to 1.
+
+        Returns:
+            BigIntArrayList: A new `BigIntArrayList` object containing the integers in the specified range.
+
+        Example:
+            >>> BigIntArrayList.from_range(1, 10, 2)
+            [1, 3, 5, 7, 9]
+        """
+        pass
+
+    @staticmethod
+    @overload
+    def from_range(__stop: SupportsIndex) -> BigIntArrayList:
+        """
+        Creates an `BigIntArrayList` from a range of integers starting from 0 to the specified stop value.
+
+        Parameters:
+            __stop (SupportsIndex): The stopping value of the range (exclusive).
+
+        Returns:
+            BigIntArrayList: A new `BigIntArrayList` object containing the integers from 0 up to `__stop`.
+
+        Example:
+            >>> BigIntArrayList.from_range(5)
+            [0, 1, 2, 3, 4]
+        """
+        pass
+
+    @staticmethod
+    def frombuffer(__buffer: Buffer) -> BigIntArrayList:
+        """
+        Creates an `BigIntArrayList` from a C-contiguous buffer of int32 or int64, such as a numpy array.
+
+        The elements are copied in native code without creating a Python object per element.
+
+        Parameters:
+            __buffer (Buffer): The buffer to copy, an `IntArrayList` and a `BigIntArrayList` work as well.
+
+        Returns:
+            BigIntArrayList: A new `BigIntArrayList` with a copy of the elements.
+
+        Raises:
+            TypeError: If the buffer isn't made of int32 or int64.
+            BufferError: If the buffer isn't C-contiguous, some exporters like numpy raise ValueError instead.
+
+        Example:
+            >>> import numpy
+            >>> BigIntArrayList.frombuffer(numpy.arange(5))
+            [0, 1, 2, 3, 4]
+        """
+        pass
+
+    def view(self, readonly: bool = False) -> memoryview:
+        """
+        Returns a `memoryview` over the elements of the list, without copying them.
+
+        The list can't change its size while any view, or anything else holding its buffer such as a numpy
+        array made with `numpy.asarray()`, is alive. Operations that would resize it raise `BufferError`.
+
+        Parameters:
+            readonly (bool): Return a read-only view, consumers like numpy then can't write through it.
+
+        Returns:
+            memoryview: A view with format 'q'.
+
+        Example:
+            >>> lst = BigIntArrayList([1, 2, 3])
+            >>> view = lst.view(readonly=True)
+            >>> view.readonly, view.tolist()
+            (True, [1, 2, 3])
+        """
+        pass
+
+    def resize(self, __size: int) -> None:
+        """
+        Resizes the `BigIntArrayList` to the specified size.
+
+        If the new size is larger than the current size, the list will be extended with zeros. If the new size is smaller,
+        excess elements will be removed.
+
+        Parameters:
+            __size (int): The new size of the list.
+
+        Example:
+            >>> my_list = BigIntArrayList([1, 2, 3])
+            >>> my_list.resize(5)
+            >>> print(my_list)
+            [1, 2, 3, 0, 0]
+
+            >>> my_list.resize(2)
+            >>> print(my_list)
+            [1, 2]
+        """
+        pass
+
+    def to_list(self) -> list[int]:
+        """
+        Converts the `BigIntArrayList` to a standard Python list.
+
+        This method returns a new list containing the same elements as the `BigIntArrayList` in the same order. The returned list
+        will be a standard Python list, which can be used with all the usual Python list operations.
+
+        Returns:
+            list[int]: A new list containing all the elements of the `BigIntArrayList`.
+
+        Example:
+            >>> my_list = BigIntArrayList([1, 2, 3])
+            >>> py_list = my_list.to_list()
+            >>> print(py_list)
+            [1, 2, 3]
+        """
+        pass
+
+    def sort(self, *, key: Callable[[int], Any] | None = None, reverse: bool = False,
+             parallel: bool = False, threads: int = 0, algorithm: str = "auto") -> None:
+        """
+        Sorts the list in place, natively and with the GIL released.
+
+        `algorithm` picks how: `"bitonic"` sorts with SIMD sorting networks and merges, `"radix"` with an LSD
+        radix sort that needs a scratch copy of the list, and `"auto"` uses radix sort on all but small lists.
+
+        With `parallel=True`, the list is split into chunks that are sorted on separate cores of a thread
+        pool shared by the whole module, then merged in parallel. Lists too small to benefit from it are
+        sorted on the calling thread. `parallel` and `threads` are ignored when `key` is given.
+
+        Parameters:
+            key (Callable[[int], Any] | None): A function computing the sort key of every element.
+            reverse (bool): Sort in descending order.
+            parallel (bool): Sort on multiple threads.
+            threads (int): How many chunks to sort at once, 0 for one per hardware thread.
+            algorithm (str): `"auto"`, `"bitonic"` or `"radix"`.
+
+        Raises:
+            ValueError: If `threads` is negative or `algorithm` is unknown.
+
+        Example:
+            >>> my_list = BigIntArrayList.from_range(10_000_000)
+            >>> my_list.reverse()
+            >>> my_list.sort(parallel=True, threads=8)
+            >>> my_list[:3]
+            [0, 1, 2]
+        """
+        pass
+
+    def argsort(self, reverse: bool = False, stable: bool = True) -> IntArrayList:
+        """
+        Returns the indices that would sort the list, without changing the list.
+
+        Large lists are sorted with a radix sort over (value, index) pairs in native code, with the GIL
+        released, so no element is boxed.
+
+        Parameters:
+            reverse (bool): Sort in descending order.
+            stable (bool): Keep equal elements in their original order, also when `reverse` is set, like
+                `sorted(reverse=True)`. Passing `False` allows a faster unstable sort of small lists.
+
+        Returns:
+            IntArrayList: The permutation `p` such that `[self[i] for i in p]` is sorted.
+
+        Raises:
+            OverflowError: If the list has more elements than an `IntArrayList` can index.
+
+        Example:
+            >>> BigIntArrayList([30, 10, 20]).argsort()
+            [1, 2, 0]
+        """
+        pass
+
+    def sort_with(self, other: IntArrayList | BigIntArrayList | ObjectArrayList, reverse: bool = False) -> None:
+        """
+        Sorts the list in place, stably, and reorders `other` with the same permutation.
+
+        This keeps parallel columns aligned without building tuples: `other` is reordered in native code, and
+        for an `ObjectArrayList` only the references move.
+
+        Parameters:
+            other: The list to reorder, with the same length as this list.
+            reverse (bool): Sort in descending order.
+
+        Raises:
+            TypeError: If `other` is not an `IntArrayList`, a `BigIntArrayList` or an `ObjectArrayList`.
+            ValueError: If `other` doesn't have the same length as this list.
+
+        Example:
+            >>> scores = BigIntArrayList([30, 10, 20])
+            >>> names = ObjectArrayList(["c", "a", "b"])
+            >>> scores.sort_with(names)
+            >>> scores, names
+            ([10, 20, 30], ['a', 'b', 'c'])
+        """
+        pass
+
+    def nth_element(self, k: int) -> int:
+        """
+        Partially sorts the list in place so that the element at index `k` is the one a full sort would put there.
+
+        Nothing before index `k` is greater than it and nothing after it is smaller, the order on either side is
+        unspecified. This runs in linear time on average, so it is much faster than `sort()` when only one rank
+        is needed, such as a median or a percentile. The GIL is released while partitioning.
+
+        Parameters:
+            k (int): The index to select, negative indices count from the end.
+
+        Returns:
+            int: The element now at index `k`.
+
+        Raises:
+            IndexError: If `k` is out of range.
+
+        Example:
+            >>> lst = BigIntArrayList([5, 1, 4, 2, 3])
+            >>> lst.nth_element(2)
+            3
+        """
+        pass
+
+    def partial_sort(self, k: int, reverse: bool = False) -> None:
+        """
+        Moves the `k` smallest elements to the front of the list in sorted order, in place.
+
+        The order of the remaining elements is unspecified. Only the first `k` elements are sorted, so this is
+        much faster than `sort()` when `k` is small. The GIL is released while sorting.
+
+        Parameters:
+            k (int): How many elements to sort, values larger than the list sort all of it.
+            reverse (bool): Move the `k` largest elements to the front in descending order instead.
+
+        Raises:
+            ValueError: If `k` is negative.
+
+        Example:
+            >>> lst = BigIntArrayList([5, 1, 4, 2, 3])
+            >>> lst.partial_sort(2)
+            >>> lst[:2]
+            [1, 2]
+        """
+        pass
+
+    def top_k(self, k: int, reverse: bool = True) -> BigIntArrayList:
+        """
+        Returns the `k` largest elements in descending order as a new list, leaving this list untouched.
+
+        The GIL is released while selecting.
+
+        Parameters:
+            k (int): How many elements to return, values larger than the list return all of it.
+            reverse (bool): Pass False to return the `k` smallest elements in ascending order instead.
+
+        Returns:
+            BigIntArrayList: A new list with the selected elements.
+
+        Raises:
+            ValueError: If `k` is negative.
+
+        Example:
+            >>> lst = BigIntArrayList([5, 1, 4, 2, 3])
+            >>> lst.top_k(2)
+            [5, 4]
+            >>> lst.top_k(2, reverse=False)
+            [1, 2]
+        """
+        pass
+
+    def sorted_intersect(self, __other: BigIntArrayList) -> BigIntArrayList:
+        """
+        Returns the elements of this sorted list that are also in the sorted `__other`, as a new sorted list.
+
+        Both lists are treated as multisets: a value appearing `m` times here and `n` times in `__other`
+        appears `min(m, n)` times in the result. Lists of very different sizes are galloped over, and
+        strictly increasing lists are compared a vector block at a time. The GIL is released meanwhile.
+
+        Both lists must be sorted in ascending order, the result is unspecified otherwise.
+
+        Parameters:
+            __other (BigIntArrayList): Another sorted list.
+
+        Returns:
+            BigIntArrayList: A new sorted list.
+
+        Raises:
+            TypeError: If `__other` is not a `BigIntArrayList`.
+
+        Example:
+            >>> BigIntArrayList([1, 2, 2, 3]).sorted_intersect(BigIntArrayList([2, 2, 2, 4]))
+            [2, 2]
+        """
+        pass
+
+    def sorted_union(self, __other: BigIntArrayList) -> BigIntArrayList:
+        """
+        Returns the elements of this sorted list or the sorted `__other`, as a new sorted list.
+
+        A value appearing `m` times here and `n` times in `__other` appears `max(m, n)` times in the result.
+        Both lists must be sorted in ascending order, the result is unspecified otherwise.
+
+        Parameters:
+            __other (BigIntArrayList): Another sorted list.
+
+        Returns:
+            BigIntArrayList: A new sorted list.
+
+        Raises:
+            TypeError: If `__other` is not a `BigIntArrayList`.
+
+        Example:
+            >>> BigIntArrayList([1, 2, 2]).sorted_union(BigIntArrayList([2, 3]))
+            [1, 2, 2, 3]
+        """
+        pass
+
+    def sorted_difference(self, __other: BigIntArrayList) -> BigIntArrayList:
+        """
+        Returns the elements of this sorted list that are not in the sorted `__other`, as a new sorted list.
+
+        A value appearing `m` times here and `n` times in `__other` appears `m - n` times in the result, if positive.
+        Both lists must be sorted in ascending order, the result is unspecified otherwise.
+
+        Parameters:
+            __other (BigIntArrayList): Another sorted list.
+
+        Returns:
+            BigIntArrayList: A new sorted list.
+
+        Raises:
+            TypeError: If `__other` is not a `BigIntArrayList`.
+
+        Example:
+            >>> BigIntArrayList([1, 2, 2, 3]).sorted_difference(BigIntArrayList([2, 3]))
+            [1, 2]
+        """
+        pass
+
+    def merge(self, __other: BigIntArrayList) -> BigIntArrayList:
+        """
+        Returns all elements of this sorted list and the sorted `__other` as a new sorted list, keeping duplicates.
+
+        Both lists must be sorted in ascending order, the result is unspecified otherwise.
+
+        Parameters:
+            __other (BigIntArrayList): Another sorted list.
+
+        Returns:
+            BigIntArrayList: A new sorted list of `len(self) + len(__other)` elements.
+
+        Raises:
+            TypeError: If `__other` is not a `BigIntArrayList`.
+
+        Example:
+            >>> BigIntArrayList([1, 3]).merge(BigIntArrayList([2, 3]))
+            [1, 2, 3, 3]
+        """
+        pass
+
+    @staticmethod
+    def merge_many(__lists: Iterable[BigIntArrayList]) -> BigIntArrayList:
+        """
+        Merges sorted lists into a new sorted list, keeping duplicates.
+
+        The lists are merged pairwise, halving their number on every pass, with the GIL released.
+
+        Parameters:
+            __lists (Iterable[BigIntArrayList]): Sorted lists.
+
+        Returns:
+            BigIntArrayList: A new sorted list.
+
+        Raises:
+            TypeError: If an element of `__lists` is not a `BigIntArrayList`.
+
+        Example:
+            >>> BigIntArrayList.merge_many([BigIntArrayList([1, 4]), BigIntArrayList([2]), BigIntArrayList([3, 5])])
+            [1, 2, 3, 4, 5]
+        """
+        pass
+
+    def bisect_left(self, x: int, lo: int = 0, hi: int | None = None) -> int:
+        """
+        Returns the position to insert `x` at to keep this sorted list sorted, before any equal elements.
+
+        Works like `bisect.bisect_left`, but compares native elements with a branchless binary search
+        instead of creating an int object for every probe.
+
+        Parameters:
+            x (int): The value to search for.
+            lo (int): The start of the range searched.
+            hi (int, optional): The end of the range searched, the end of the list if None.
+
+        Returns:
+            int: The position, in `range(lo, hi + 1)`.
+
+        Raises:
+            TypeError: If `x` is not an int.
+            ValueError: If `lo` is negative.
+
+        Example:
+            >>> BigIntArrayList([1, 2, 2, 3]).bisect_left(2)
+            1
+        """
+        pass
+
+    def bisect_right(self, x: int, lo: int = 0, hi: int | None = None) -> int:
+        """
+        Returns the position to insert `x` at to keep this sorted list sorted, after any equal elements.
+
+        Works like `bisect.bisect_right`, see `bisect_left`.
+
+        Parameters:
+            x (int): The value to search for.
+            lo (int): The start of the range searched.
+            hi (int, optional): The end of the range searched, the end of the list if None.
+
+        Returns:
+            int: The position, in `range(lo, hi + 1)`.
+
+        Raises:
+            TypeError: If `x` is not an int.
+            ValueError: If `lo` is negative.
+
+        Example:
+            >>> BigIntArrayList([1, 2, 2, 3]).bisect_right(2)
+            3
+        """
+        pass
+
+    def searchsorted(self, values: BigIntArrayList, side: str = "left") -> IntArrayList:
+        """
+        Returns the insertion position of every element of `values` in this sorted list, like `numpy.searchsorted`.
+
+        The GIL is released while searching. Large batches over large lists are searched in a breadth first
+        copy of the list, where the next levels of the search can be prefetched together.
+
+        Parameters:
+            values (BigIntArrayList): The values to search for, in any order.
+            side (str): "left" for the positions `bisect_left` would return, "right" for `bisect_right`.
+
+        Returns:
+            IntArrayList: A new list with the position of every value.
+
+        Raises:
+            TypeError: If `values` is not a `BigIntArrayList`.
+            ValueError: If `side` is neither "left" nor "right".
+
+        Example:
+            >>> BigIntArrayList([10, 20, 30]).searchsorted(BigIntArrayList([25, 10, 40]))
+            [2, 0, 3]
+            >>> BigIntArrayList([10, 20, 30]).searchsorted(BigIntArrayList([25, 10, 40]), side="right")
+            [2, 1, 3]
+        """
+        pass
+
+    def contains_sorted(self, __value: int) -> bool:
+        """
+        Returns if `__value` is in this sorted list, with a binary search instead of the linear scan of `in`.
+
+        Parameters:
+            __value (int): The value to look for.
+
+        Returns:
+            bool: True if the value is in the list.
+
+        Example:
+            >>> BigIntArrayList([1, 3, 5]).contains_sorted(3)
+            True
+        """
+        pass
+
+    def count_all(self, __values: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> list[int]:
+        """
+        Counts the occurrences of every value of `__values` in a single pass over the list.
+
+        This is much faster than calling `count()` once per value on large lists: a few values are compared
+        against the list with SIMD all at once, and more are looked up in a hash table. The GIL is released
+        while counting.
+
+        Parameters:
+            __values: The values to count, an iterable of ints, an `IntArrayList`, a `BigIntArrayList` or any
+                C-contiguous int32/int64 buffer.
+
+        Returns:
+            list[int]: The count of each value, in the same order as `__values`.
+
+        Example:
+            >>> BigIntArrayList([1, 2, 2, 3, 3, 3]).count_all([3, 1, 4])
+            [3, 1, 0]
+        """
+        pass
+
+    def sum(self) -> int:
+        """
+        Returns the sum of all elements, computed natively with SIMD and with the GIL released.
+
+        The sum is exact: it is accumulated in wide integers, so it never overflows.
+
+        Returns:
+            int: The sum of the list, 0 if the list is empty.
+
+        Example:
+            >>> BigIntArrayList([1, 2, 3]).sum()
+            6
+        """
+        pass
+
+    def min(self) -> int:
+        """
+        Returns the smallest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> BigIntArrayList([3, 1, 2]).min()
+            1
+        """
+        pass
+
+    def max(self) -> int:
+        """
+        Returns the largest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> BigIntArrayList([3, 1, 2]).max()
+            3
+        """
+        pass
+
+    def minmax(self) -> tuple[int, int]:
+        """
+        Returns both the smallest and the largest element in a single pass over the list.
+
+        Returns:
+            tuple[int, int]: `(min, max)` of the list.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> BigIntArrayList([3, 1, 2]).minmax()
+            (1, 3)
+        """
+        pass
+
+    def argmin(self) -> int:
+        """
+        Returns the index of the smallest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> BigIntArrayList([3, 1, 2, 1]).argmin()
+            1
+        """
+        pass
+
+    def argmax(self) -> int:
+        """
+        Returns the index of the largest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+
+        Example:
+            >>> BigIntArrayList([3, 1, 3, 2]).argmax()
+            0
+        """
+        pass
+
+
+class BigIntArrayListIter(Iterator[int]):
+    """
+    Iterator for BigIntArrayList.
+
+    This class provides an iterator over an `BigIntArrayList`, allowing you to iterate over the elements
+    of the list one by one.
+
+    Note:
+        This class cannot be directly instantiated by users. It is designed to be used internally by
+        `BigIntArrayList` and can only be obtained by calling the `__iter__` method on an `BigIntArrayList` object.
+
+    Example:
+        >>> big_int_list = BigIntArrayList([1, 2, 3])
+        >>> iter_obj = iter(big_int_list)  # This returns an BigIntArrayListIter instance
+        >>> next(iter_obj)
+        1
+        >>> next(iter_obj)
+        2
+        >>> next(iter_obj)
+        3
+        >>> next(iter_obj)  # Raises StopIteration
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> int:
+        """
+        Return the next element in the iteration.
+
+        This method retrieves the next element from the `BigIntArrayList` that this iterator is associated with.
+        If all elements have been iterated over, it raises a `StopIteration` exception.
+
+        Returns:
+            int: The next integer in the `BigIntArrayList`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+        """
+        pass
+
+class ByteArrayList(list[int]):
+    """
+    A specialized version of Python's list for 8-bit integers, optimized for memory and speed by using a
+    C implementation.
+
+    This class behaves like `IntArrayList`, but elements are kept as C `signed char` values, so the list takes
+    a quarter of the memory of an `IntArrayList`. Every element must be in the range `[-128, 127]`, anything
+    else raises `OverflowError` instead of being truncated.
+
+    Parameters:
+        - `exceptSize` (optional): The expected size of the list. This is used for preallocating memory to avoid
+          frequent resizing when adding elements.
+        - `iterable` (optional): An iterable of integers to initialize the list with.
+
+    Example:
+        >>> my_list = ByteArrayList([1, 2, 3])
+        >>> my_list.append(4)
+        >>> print(my_list)
+        [1, 2, 3, 4]
+    """
+
+    @overload
+    def __init__(self, exceptSize: int) -> None:
+        """
+        Initializes an empty `ByteArrayList` with a preallocated size.
+
+        Parameters:
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing
+                              as elements are added.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int], exceptSize: int) -> None:
+        """
+        Initializes a `ByteArrayList` from an iterable of integers with a preallocated size.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing.
+
+        Raises:
+            OverflowError: If an element is out of range.
+        """
+        pass
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `ByteArrayList` with no preallocated size.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int]) -> None:
+        """
+        Initializes a `ByteArrayList` from an iterable of integers.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+
+        Raises:
+            OverflowError: If an element is out of range.
+        """
+        pass
+
+    @staticmethod
+    def frombuffer(__buffer: Buffer) -> ByteArrayList:
+        """
+        Creates a `ByteArrayList` from a C-contiguous buffer of int8, such as a numpy array.
+
+        The elements are copied in native code without creating a Python object per element.
+        Buffers of other integer types are not converted, pass them to the constructor to have every element
+        checked instead.
+
+        Parameters:
+            __buffer (Buffer): The buffer to copy, a `ByteArrayList` works as well.
+
+        Returns:
+            ByteArrayList: A new `ByteArrayList` with a copy of the elements.
+
+        Raises:
+            TypeError: If the buffer isn't made of int8.
+            BufferError: If the buffer isn't C-contiguous, some exporters like numpy raise ValueError instead.
+
+        Example:
+            >>> import numpy
+            >>> ByteArrayList.frombuffer(numpy.arange(3, dtype=numpy.int8))
+            [0, 1, 2]
+        """
+        pass
+
+    def view(self, readonly: bool = False) -> memoryview:
+        """
+        Returns a `memoryview` over the elements of the list, without copying them.
+
+        The list can't change its size while any view, or anything else holding its buffer such as a numpy
+        array made with `numpy.asarray()`, is alive. Operations that would resize it raise `BufferError`.
+
+        Parameters:
+            readonly (bool): Return a read-only view, consumers like numpy then can't write through it.
+
+        Returns:
+            memoryview: A view with format 'b'.
+        """
+        pass
+
+    def resize(self, __size: int) -> None:
+        """
+        Resizes the `ByteArrayList` to the specified size.
+
+        If the new size is larger than the current size, the list will be extended with zeros. If the new size is smaller,
+        excess elements will be removed.
+
+        Parameters:
+            __size (int): The new size of the list.
+        """
+        pass
+
+    def to_list(self) -> list[int]:
+        """
+        Converts the `ByteArrayList` to a standard Python list.
+
+        Returns:
+            list[int]: A new list containing all the elements of the `ByteArrayList`.
+        """
+        pass
+
+    def sort(self, *, key: Callable[[int], Any] | None = None, reverse: bool = False,
+             algorithm: str = "auto") -> None:
+        """
+        Sorts the list in place, natively and with the GIL released.
+
+        With so few possible values, `"auto"` counts the elements rather than comparing them, which takes linear
+        time. `"bitonic"` and `"radix"` sort a copy widened to 32-bit with the algorithms of `IntArrayList.sort()`.
+
+        Parameters:
+            key (Callable[[int], Any] | None): A function computing the sort key of every element.
+            reverse (bool): Sort in descending order.
+            algorithm (str): `"auto"`, `"bitonic"` or `"radix"`.
+
+        Raises:
+            ValueError: If `algorithm` is unknown.
+
+        Example:
+            >>> my_list = ByteArrayList([3, 1, 2])
+            >>> my_list.sort(reverse=True)
+            >>> my_list
+            [3, 2, 1]
+        """
+        pass
+
+    def argsort(self, reverse: bool = False, stable: bool = True) -> IntArrayList:
+        """
+        Returns the indices that would sort the list, without changing the list.
+
+        Parameters:
+            reverse (bool): Sort in descending order.
+            stable (bool): Keep equal elements in their original order, also when `reverse` is set, like
+                `sorted(reverse=True)`. Passing `False` allows a faster unstable sort of small lists.
+
+        Returns:
+            IntArrayList: The permutation `p` such that `[self[i] for i in p]` is sorted.
+
+        Raises:
+            OverflowError: If the list has more elements than an `IntArrayList` can index.
+
+        Example:
+            >>> ByteArrayList([3, 1, 2]).argsort()
+            [1, 2, 0]
+        """
+        pass
+
+    def sum(self) -> int:
+        """
+        Returns the sum of all elements, computed natively with SIMD and with the GIL released.
+
+        The sum is exact, it is accumulated in wider integers than the elements.
+
+        Returns:
+            int: The sum of the list, 0 if the list is empty.
+        """
+        pass
+
+    def min(self) -> int:
+        """
+        Returns the smallest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def max(self) -> int:
+        """
+        Returns the largest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def minmax(self) -> tuple[int, int]:
+        """
+        Returns both the smallest and the largest element in a single pass over the list.
+
+        Returns:
+            tuple[int, int]: `(min, max)` of the list.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def argmin(self) -> int:
+        """
+        Returns the index of the smallest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def argmax(self) -> int:
+        """
+        Returns the index of the largest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+
+class ByteArrayListIter(Iterator[int]):
+    """
+    Iterator for ByteArrayList.
+
+    This class provides an iterator over a `ByteArrayList`, allowing you to iterate over the elements
+    of the list one by one.
+
+    Note:
+        This class cannot be directly instantiated by users. It is designed to be used internally by
+        `ByteArrayList` and can only be obtained by calling the `__iter__` method on a `ByteArrayList` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> int:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            int: The next integer in the `ByteArrayList`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+        """
+        pass
+
+
+class ShortArrayList(list[int]):
+    """
+    A specialized version of Python's list for 16-bit integers, optimized for memory and speed by using a
+    C implementation.
+
+    This class behaves like `IntArrayList`, but elements are kept as C `short` values, so the list takes
+    half the memory of an `IntArrayList`. Every element must be in the range `[-32768, 32767]`, anything
+    else raises `OverflowError` instead of being truncated.
+
+    Parameters:
+        - `exceptSize` (optional): The expected size of the list. This is used for preallocating memory to avoid
+          frequent resizing when adding elements.
+        - `iterable` (optional): An iterable of integers to initialize the list with.
+
+    Example:
+        >>> my_list = ShortArrayList([1, 2, 3])
+        >>> my_list.append(4)
+        >>> print(my_list)
+        [1, 2, 3, 4]
+    """
+
+    @overload
+    def __init__(self, exceptSize: int) -> None:
+        """
+        Initializes an empty `ShortArrayList` with a preallocated size.
+
+        Parameters:
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing
+                              as elements are added.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int], exceptSize: int) -> None:
+        """
+        Initializes a `ShortArrayList` from an iterable of integers with a preallocated size.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing.
+
+        Raises:
+            OverflowError: If an element is out of range.
+        """
+        pass
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `ShortArrayList` with no preallocated size.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int]) -> None:
+        """
+        Initializes a `ShortArrayList` from an iterable of integers.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+
+        Raises:
+            OverflowError: If an element is out of range.
+        """
+        pass
+
+    @staticmethod
+    def frombuffer(__buffer: Buffer) -> ShortArrayList:
+        """
+        Creates a `ShortArrayList` from a C-contiguous buffer of int16, such as a numpy array.
+
+        The elements are copied in native code without creating a Python object per element.
+        Buffers of other integer types are not converted, pass them to the constructor to have every element
+        checked instead.
+
+        Parameters:
+            __buffer (Buffer): The buffer to copy, a `ShortArrayList` works as well.
+
+        Returns:
+            ShortArrayList: A new `ShortArrayList` with a copy of the elements.
+
+        Raises:
+            TypeError: If the buffer isn't made of int16.
+            BufferError: If the buffer isn't C-contiguous, some exporters like numpy raise ValueError instead.
+
+        Example:
+            >>> import numpy
+            >>> ShortArrayList.frombuffer(numpy.arange(3, dtype=numpy.int16))
+            [0, 1, 2]
+        """
+        pass
+
+    def view(self, readonly: bool = False) -> memoryview:
+        """
+        Returns a `memoryview` over the elements of the list, without copying them.
+
+        The list can't change its size while any view, or anything else holding its buffer such as a numpy
+        array made with `numpy.asarray()`, is alive. Operations that would resize it raise `BufferError`.
+
+        Parameters:
+            readonly (bool): Return a read-only view, consumers like numpy then can't write through it.
+
+        Returns:
+            memoryview: A view with format 'h'.
+        """
+        pass
+
+    def resize(self, __size: int) -> None:
+        """
+        Resizes the `ShortArrayList` to the specified size.
+
+        If the new size is larger than the current size, the list will be extended with zeros. If the new size is smaller,
+        excess elements will be removed.
+
+        Parameters:
+            __size (int): The new size of the list.
+        """
+        pass
+
+    def to_list(self) -> list[int]:
+        """
+        Converts the `ShortArrayList` to a standard Python list.
+
+        Returns:
+            list[int]: A new list containing all the elements of the `ShortArrayList`.
+        """
+        pass
+
+    def sort(self, *, key: Callable[[int], Any] | None = None, reverse: bool = False,
+             algorithm: str = "auto") -> None:
+        """
+        Sorts the list in place, natively and with the GIL released.
+
+        With so few possible values, `"auto"` counts the elements rather than comparing them, which takes linear
+        time. `"bitonic"` and `"radix"` sort a copy widened to 32-bit with the algorithms of `IntArrayList.sort()`.
+
+        Parameters:
+            key (Callable[[int], Any] | None): A function computing the sort key of every element.
+            reverse (bool): Sort in descending order.
+            algorithm (str): `"auto"`, `"bitonic"` or `"radix"`.
+
+        Raises:
+            ValueError: If `algorithm` is unknown.
+
+        Example:
+            >>> my_list = ShortArrayList([3, 1, 2])
+            >>> my_list.sort(reverse=True)
+            >>> my_list
+            [3, 2, 1]
+        """
+        pass
+
+    def argsort(self, reverse: bool = False, stable: bool = True) -> IntArrayList:
+        """
+        Returns the indices that would sort the list, without changing the list.
+
+        Parameters:
+            reverse (bool): Sort in descending order.
+            stable (bool): Keep equal elements in their original order, also when `reverse` is set, like
+                `sorted(reverse=True)`. Passing `False` allows a faster unstable sort of small lists.
+
+        Returns:
+            IntArrayList: The permutation `p` such that `[self[i] for i in p]` is sorted.
+
+        Raises:
+            OverflowError: If the list has more elements than an `IntArrayList` can index.
+
+        Example:
+            >>> ShortArrayList([3, 1, 2]).argsort()
+            [1, 2, 0]
+        """
+        pass
+
+    def sum(self) -> int:
+        """
+        Returns the sum of all elements, computed natively with SIMD and with the GIL released.
+
+        The sum is exact, it is accumulated in wider integers than the elements.
+
+        Returns:
+            int: The sum of the list, 0 if the list is empty.
+        """
+        pass
+
+    def min(self) -> int:
+        """
+        Returns the smallest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def max(self) -> int:
+        """
+        Returns the largest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def minmax(self) -> tuple[int, int]:
+        """
+        Returns both the smallest and the largest element in a single pass over the list.
+
+        Returns:
+            tuple[int, int]: `(min, max)` of the list.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def argmin(self) -> int:
+        """
+        Returns the index of the smallest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def argmax(self) -> int:
+        """
+        Returns the index of the largest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+
+class ShortArrayListIter(Iterator[int]):
+    """
+    Iterator for ShortArrayList.
+
+    This class provides an iterator over a `ShortArrayList`, allowing you to iterate over the elements
+    of the list one by one.
+
+    Note:
+        This class cannot be directly instantiated by users. It is designed to be used internally by
+        `ShortArrayList` and can only be obtained by calling the `__iter__` method on a `ShortArrayList` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> int:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            int: The next integer in the `ShortArrayList`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+        """
+        pass
+
+
+class UnsignedIntArrayList(list[int]):
+    """
+    A specialized version of Python's list for unsigned 32-bit integers, optimized for memory and speed by using a
+    C implementation.
+
+    This class behaves like `IntArrayList`, but elements are kept as C `unsigned int` values, so the list takes
+    the same as the memory of an `IntArrayList`. Every element must be in the range `[0, 4294967295]`, anything
+    else raises `OverflowError` instead of being truncated.
+
+    Parameters:
+        - `exceptSize` (optional): The expected size of the list. This is used for preallocating memory to avoid
+          frequent resizing when adding elements.
+        - `iterable` (optional): An iterable of integers to initialize the list with.
+
+    Example:
+        >>> my_list = UnsignedIntArrayList([1, 2, 3])
+        >>> my_list.append(4)
+        >>> print(my_list)
+        [1, 2, 3, 4]
+    """
+
+    @overload
+    def __init__(self, exceptSize: int) -> None:
+        """
+        Initializes an empty `UnsignedIntArrayList` with a preallocated size.
+
+        Parameters:
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing
+                              as elements are added.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int], exceptSize: int) -> None:
+        """
+        Initializes a `UnsignedIntArrayList` from an iterable of integers with a preallocated size.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing.
+
+        Raises:
+            OverflowError: If an element is out of range.
+        """
+        pass
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `UnsignedIntArrayList` with no preallocated size.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int]) -> None:
+        """
+        Initializes a `UnsignedIntArrayList` from an iterable of integers.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+
+        Raises:
+            OverflowError: If an element is out of range.
+        """
+        pass
+
+    @staticmethod
+    def frombuffer(__buffer: Buffer) -> UnsignedIntArrayList:
+        """
+        Creates a `UnsignedIntArrayList` from a C-contiguous buffer of uint32, such as a numpy array.
+
+        The elements are copied in native code without creating a Python object per element.
+        Buffers of other integer types are not converted, pass them to the constructor to have every element
+        checked instead.
+
+        Parameters:
+            __buffer (Buffer): The buffer to copy, a `UnsignedIntArrayList` works as well.
+
+        Returns:
+            UnsignedIntArrayList: A new `UnsignedIntArrayList` with a copy of the elements.
+
+        Raises:
+            TypeError: If the buffer isn't made of uint32.
+            BufferError: If the buffer isn't C-contiguous, some exporters like numpy raise ValueError instead.
+
+        Example:
+            >>> import numpy
+            >>> UnsignedIntArrayList.frombuffer(numpy.arange(3, dtype=numpy.uint32))
+            [0, 1, 2]
+        """
+        pass
+
+    def view(self, readonly: bool = False) -> memoryview:
+        """
+        Returns a `memoryview` over the elements of the list, without copying them.
+
+        The list can't change its size while any view, or anything else holding its buffer such as a numpy
+        array made with `numpy.asarray()`, is alive. Operations that would resize it raise `BufferError`.
+
+        Parameters:
+            readonly (bool): Return a read-only view, consumers like numpy then can't write through it.
+
+        Returns:
+            memoryview: A view with format 'I'.
+        """
+        pass
+
+    def resize(self, __size: int) -> None:
+        """
+        Resizes the `UnsignedIntArrayList` to the specified size.
+
+        If the new size is larger than the current size, the list will be extended with zeros. If the new size is smaller,
+        excess elements will be removed.
+
+        Parameters:
+            __size (int): The new size of the list.
+        """
+        pass
+
+    def to_list(self) -> list[int]:
+        """
+        Converts the `UnsignedIntArrayList` to a standard Python list.
+
+        Returns:
+            list[int]: A new list containing all the elements of the `UnsignedIntArrayList`.
+        """
+        pass
+
+    def sort(self, *, key: Callable[[int], Any] | None = None, reverse: bool = False,
+             algorithm: str = "auto") -> None:
+        """
+        Sorts the list in place, natively and with the GIL released.
+
+        The elements are sorted with the algorithms of `IntArrayList.sort()`: `"bitonic"` sorts with SIMD sorting networks
+        and merges, `"radix"` with an LSD radix sort, and `"auto"` uses radix sort on all but small lists.
+
+        Parameters:
+            key (Callable[[int], Any] | None): A function computing the sort key of every element.
+            reverse (bool): Sort in descending order.
+            algorithm (str): `"auto"`, `"bitonic"` or `"radix"`.
+
+        Raises:
+            ValueError: If `algorithm` is unknown.
+
+        Example:
+            >>> my_list = UnsignedIntArrayList([3, 1, 2])
+            >>> my_list.sort(reverse=True)
+            >>> my_list
+            [3, 2, 1]
+        """
+        pass
+
+    def argsort(self, reverse: bool = False, stable: bool = True) -> IntArrayList:
+        """
+        Returns the indices that would sort the list, without changing the list.
+
+        Parameters:
+            reverse (bool): Sort in descending order.
+            stable (bool): Keep equal elements in their original order, also when `reverse` is set, like
+                `sorted(reverse=True)`. Passing `False` allows a faster unstable sort of small lists.
+
+        Returns:
+            IntArrayList: The permutation `p` such that `[self[i] for i in p]` is sorted.
+
+        Raises:
+            OverflowError: If the list has more elements than an `IntArrayList` can index.
+
+        Example:
+            >>> UnsignedIntArrayList([3, 1, 2]).argsort()
+            [1, 2, 0]
+        """
+        pass
+
+    def sum(self) -> int:
+        """
+        Returns the sum of all elements, computed natively with SIMD and with the GIL released.
+
+        The sum is exact, it is accumulated in wider integers than the elements.
+
+        Returns:
+            int: The sum of the list, 0 if the list is empty.
+        """
+        pass
+
+    def min(self) -> int:
+        """
+        Returns the smallest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def max(self) -> int:
+        """
+        Returns the largest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def minmax(self) -> tuple[int, int]:
+        """
+        Returns both the smallest and the largest element in a single pass over the list.
+
+        Returns:
+            tuple[int, int]: `(min, max)` of the list.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def argmin(self) -> int:
+        """
+        Returns the index of the smallest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def argmax(self) -> int:
+        """
+        Returns the index of the largest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+
+class UnsignedIntArrayListIter(Iterator[int]):
+    """
+    Iterator for UnsignedIntArrayList.
+
+    This class provides an iterator over a `UnsignedIntArrayList`, allowing you to iterate over the elements
+    of the list one by one.
+
+    Note:
+        This class cannot be directly instantiated by users. It is designed to be used internally by
+        `UnsignedIntArrayList` and can only be obtained by calling the `__iter__` method on a `UnsignedIntArrayList` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> int:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            int: The next integer in the `UnsignedIntArrayList`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+        """
+        pass
+
+
+class UnsignedLongArrayList(list[int]):
+    """
+    A specialized version of Python's list for unsigned 64-bit integers, optimized for memory and speed by using a
+    C implementation.
+
+    This class behaves like `IntArrayList`, but elements are kept as C `unsigned long long` values, so the list takes
+    twice the memory of an `IntArrayList`. Every element must be in the range `[0, 18446744073709551615]`, anything
+    else raises `OverflowError` instead of being truncated.
+
+    Parameters:
+        - `exceptSize` (optional): The expected size of the list. This is used for preallocating memory to avoid
+          frequent resizing when adding elements.
+        - `iterable` (optional): An iterable of integers to initialize the list with.
+
+    Example:
+        >>> my_list = UnsignedLongArrayList([1, 2, 3])
+        >>> my_list.append(4)
+        >>> print(my_list)
+        [1, 2, 3, 4]
+    """
+
+    @overload
+    def __init__(self, exceptSize: int) -> None:
+        """
+        Initializes an empty `UnsignedLongArrayList` with a preallocated size.
+
+        Parameters:
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing
+                              as elements are added.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int], exceptSize: int) -> None:
+        """
+        Initializes a `UnsignedLongArrayList` from an iterable of integers with a preallocated size.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+            exceptSize (int): The expected size of the list. This preallocates memory for the list to avoid frequent resizing.
+
+        Raises:
+            OverflowError: If an element is out of range.
+        """
+        pass
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `UnsignedLongArrayList` with no preallocated size.
+        """
+        pass
+
+    @overload
+    def __init__(self, iterable: Iterable[int]) -> None:
+        """
+        Initializes a `UnsignedLongArrayList` from an iterable of integers.
+
+        Parameters:
+            iterable (Iterable[int]): An iterable of integers to initialize the list with.
+
+        Raises:
+            OverflowError: If an element is out of range.
+        """
+        pass
+
+    @staticmethod
+    def frombuffer(__buffer: Buffer) -> UnsignedLongArrayList:
+        """
+        Creates a `UnsignedLongArrayList` from a C-contiguous buffer of uint64, such as a numpy array.
+
+        The elements are copied in native code without creating a Python object per element.
+        Buffers of other integer types are not converted, pass them to the constructor to have every element
+        checked instead.
+
+        Parameters:
+            __buffer (Buffer): The buffer to copy, a `UnsignedLongArrayList` works as well.
+
+        Returns:
+            UnsignedLongArrayList: A new `UnsignedLongArrayList` with a copy of the elements.
+
+        Raises:
+            TypeError: If the buffer isn't made of uint64.
+            BufferError: If the buffer isn't C-contiguous, some exporters like numpy raise ValueError instead.
+
+        Example:
+            >>> import numpy
+            >>> UnsignedLongArrayList.frombuffer(numpy.arange(3, dtype=numpy.uint64))
+            [0, 1, 2]
+        """
+        pass
+
+    def view(self, readonly: bool = False) -> memoryview:
+        """
+        Returns a `memoryview` over the elements of the list, without copying them.
+
+        The list can't change its size while any view, or anything else holding its buffer such as a numpy
+        array made with `numpy.asarray()`, is alive. Operations that would resize it raise `BufferError`.
+
+        Parameters:
+            readonly (bool): Return a read-only view, consumers like numpy then can't write through it.
+
+        Returns:
+            memoryview: A view with format 'Q'.
+        """
+        pass
+
+    def resize(self, __size: int) -> None:
+        """
+        Resizes the `UnsignedLongArrayList` to the specified size.
+
+        If the new size is larger than the current size, the list will be extended with zeros. If the new size is smaller,
+        excess elements will be removed.
+
+        Parameters:
+            __size (int): The new size of the list.
+        """
+        pass
+
+    def to_list(self) -> list[int]:
+        """
+        Converts the `UnsignedLongArrayList` to a standard Python list.
+
+        Returns:
+            list[int]: A new list containing all the elements of the `UnsignedLongArrayList`.
+        """
+        pass
+
+    def sort(self, *, key: Callable[[int], Any] | None = None, reverse: bool = False,
+             algorithm: str = "auto") -> None:
+        """
+        Sorts the list in place, natively and with the GIL released.
+
+        The elements are sorted with the algorithms of `BigIntArrayList.sort()`: `"bitonic"` sorts with SIMD sorting networks
+        and merges, `"radix"` with an LSD radix sort, and `"auto"` uses radix sort on all but small lists.
+
+        Parameters:
+            key (Callable[[int], Any] | None): A function computing the sort key of every element.
+            reverse (bool): Sort in descending order.
+            algorithm (str): `"auto"`, `"bitonic"` or `"radix"`.
+
+        Raises:
+            ValueError: If `algorithm` is unknown.
+
+        Example:
+            >>> my_list = UnsignedLongArrayList([3, 1, 2])
+            >>> my_list.sort(reverse=True)
+            >>> my_list
+            [3, 2, 1]
+        """
+        pass
+
+    def argsort(self, reverse: bool = False, stable: bool = True) -> IntArrayList:
+        """
+        Returns the indices that would sort the list, without changing the list.
+
+        Parameters:
+            reverse (bool): Sort in descending order.
+            stable (bool): Keep equal elements in their original order, also when `reverse` is set, like
+                `sorted(reverse=True)`. Passing `False` allows a faster unstable sort of small lists.
+
+        Returns:
+            IntArrayList: The permutation `p` such that `[self[i] for i in p]` is sorted.
+
+        Raises:
+            OverflowError: If the list has more elements than an `IntArrayList` can index.
+
+        Example:
+            >>> UnsignedLongArrayList([3, 1, 2]).argsort()
+            [1, 2, 0]
+        """
+        pass
+
+    def sum(self) -> int:
+        """
+        Returns the sum of all elements, computed natively with SIMD and with the GIL released.
+
+        The sum is exact, it is accumulated in wider integers than the elements.
+
+        Returns:
+            int: The sum of the list, 0 if the list is empty.
+        """
+        pass
+
+    def min(self) -> int:
+        """
+        Returns the smallest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def max(self) -> int:
+        """
+        Returns the largest element, computed natively with SIMD and with the GIL released.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def minmax(self) -> tuple[int, int]:
+        """
+        Returns both the smallest and the largest element in a single pass over the list.
+
+        Returns:
+            tuple[int, int]: `(min, max)` of the list.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def argmin(self) -> int:
+        """
+        Returns the index of the smallest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+    def argmax(self) -> int:
+        """
+        Returns the index of the largest element. If it occurs several times, the first index is returned.
+
+        Raises:
+            ValueError: If the list is empty.
+        """
+        pass
+
+
+class UnsignedLongArrayListIter(Iterator[int]):
+    """
+    Iterator for UnsignedLongArrayList.
+
+    This class provides an iterator over a `UnsignedLongArrayList`, allowing you to iterate over the elements
+    of the list one by one.
+
+    Note:
+        This class cannot be directly instantiated by users. It is designed to be used internally by
+        `UnsignedLongArrayList` and can only be obtained by calling the `__iter__` method on a `UnsignedLongArrayList` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> int:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            int: The next integer in the `UnsignedLongArrayList`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+        """
+        pass
+
+class IntLinkedList(list[int]):
+    """
+    A specialized linked list for integers, optimized for efficient insertion and deletion.
+
+    `IntLinkedList` is implemented as a doubly linked list, providing O(1) time complexity for insertions and deletions
+    at both the head and tail, as well as for operations involving iterators. However, random access by index (e.g., `list[i]`)
+    requires O(n) time, as the list must be traversed to reach the desired element.
+
+    This class behaves similarly to Python's built-in `list`, but is specifically optimized for storing integers and for
+    scenarios where frequent insertions and deletions are required, rather than random access.
+
+    Example:
+        >>> int_list = IntLinkedList()
+        >>> int_list.append(1)
+        >>> int_list.append(2)
+        >>> int_list.insert(0, 3)
+        >>> print(int_list)
+        [3, 1, 2]
+
+    Note:
+        - Insertion and deletion are O(1).
+        - Accessing elements by index is O(n).
+        - Iteration over the list is O(1) per step, making it efficient for sequential access.
+
+    Raises:
+        TypeError: If an invalid operation is attempted.
+    """
+
+    @staticmethod
+    @overload
+    def from_range(__start: SupportsIndex, __stop: SupportsIndex, __step: SupportsIndex = 1) -> IntLinkedList:
+        """
+        Creates an `IntLinkedList` from a range of integers, similar to the built-in `range()` function.
+
+        Parameters:
+            __start (SupportsIndex): The starting value of the range (inclusive).
+            __stop (SupportsIndex): The stopping value of the range (exclusive).
+            __step (SupportsIndex, optional): The step between each value in the range. Defaults to 1.
+
+        Returns:
+            IntLinkedList: A new `IntLinkedList` object containing the integers in the specified range.
+
+        Example:
+            >>> IntLinkedList.from_range(1, 10, 2)
+            [1, 3, 5, 7, 9]
+        """
+        pass
+
+    @staticmethod
+    @overload
+    def from_range(__stop: SupportsIndex) -> IntLinkedList:
+        """
+        Creates an `IntLinkedList` from a range of integers starting from 0 to the specified stop value.
+
+        Parameters:
+            __stop (SupportsIndex): The stopping value of the range (exclusive).
+
+        Returns:
+            IntLinkedList: A new `IntLinkedList` object containing the integers from 0 up to `__stop`.
+
+        Example:
+            >>> IntLinkedList.from_range(5)
+            [0, 1, 2, 3, 4]
+        """
+        pass
+
+    def to_list(self) -> list[int]:
+        """
+        Converts the `IntLinkedList` to a standard Python list.
+
+        This method returns a new list containing the same elements as the `IntLinkedList` in the same order. The returned list
+        will be a standard Python list, which can be used with all the usual Python list operations.
+
+        Returns:
+            list[int]: A new list containing all the elements of the `IntLinkedList`.
+
+        Example:
+            >>> int_list = IntLinkedList([1, 2, 3])
+            >>> py_list = int_list.to_list()
+            >>> print(py_list)
+            [1, 2, 3]
+        """
+        pass
+
+class IntLinkedListIter(Iterator[int]):
+    """
+    Iterator for `IntLinkedList`.
+
+    This class provides an iterator over an `IntLinkedList`, allowing you to iterate over the elements
+    of the list one by one in O(1) time per step. The iterator maintains a reference to the list and iterates
+    through it in constant time for each element, making it very efficient for sequential access.
+
+    Note:
+        This class cannot be directly instantiated by users. It is designed to be used internally by
+        `IntLinkedList` and can only be obtained by calling the `__iter__` method on an `IntLinkedList` object.
+
+    Example:
+        >>> int_list = IntLinkedList([1, 2, 3])
+        >>> iter_obj = iter(int_list)  # This returns an IntLinkedListIter instance
+        >>> next(iter_obj)
+        1
+        >>> next(iter_obj)
+        2
+        >>> next(iter_obj)
+        3
+        >>> next(iter_obj)  # Raises StopIteration
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> int:
+        """
+        Return the next element in the iteration.
+
+        This method retrieves the next element from the `IntLinkedList` that this iterator is associated with.
+        If all elements have been iterated over, it raises a `StopIteration` exception.
+
+        Returns:
+            int: The next integer in the `IntLinkedList`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+        """
+        pass
+
+class IntArrayDeque(deque[int]):
+    """
+    A double-ended queue of integers, stored in a power-of-two sized circular buffer.
+
+    `IntArrayDeque` has the same interface as `collections.deque` (without `maxlen`). Appending and popping at either
+    end are O(1), and unlike `collections.deque`, indexing is O(1) anywhere in the deque, as the elements are
+    one contiguous array that wraps around at most once.
+
+    Example:
+        >>> dq = IntArrayDeque([1, 2, 3])
+        >>> dq.appendleft(0)
+        >>> dq.pop()
+        3
+        >>> print(dq)
+        [0, 1, 2]
+
+    Note:
+        - Iterating over the deque while it is modified raises `RuntimeError`, like `collections.deque`.
+        - Elements are C ints, values out of range raise `OverflowError`.
+    """
+
+    def drain(self, __n: SupportsIndex = -1) -> IntArrayList:
+        """
+        Pops up to `__n` elements from the left of the deque into a new `IntArrayList`, in order.
+
+        The elements are moved with at most two bulk copies, instead of one `popleft` call each.
+
+        Parameters:
+            __n (SupportsIndex, optional): The maximum number of elements to pop. Negative pops all of them. Defaults to -1.
+
+        Returns:
+            IntArrayList: The popped elements, first popped first.
+
+        Example:
+            >>> dq = IntArrayDeque([1, 2, 3])
+            >>> dq.drain(2)
+            [1, 2]
+            >>> print(dq)
+            [3]
+        """
+        pass
+
+    def to_list(self) -> list[int]:
+        """
+        Converts the `IntArrayDeque` to a standard Python list.
+
+        Returns:
+            list[int]: A new list containing all the elements of the `IntArrayDeque`, from left to right.
+
+        Example:
+            >>> IntArrayDeque([1, 2, 3]).to_list()
+            [1, 2, 3]
+        """
+        pass
+
+class IntArrayDequeIter(Iterator[int]):
+    """
+    Iterator for `IntArrayDeque`.
+
+    Note:
+        This class cannot be directly instantiated by users. It can only be obtained by calling the `__iter__` or
+        `__reversed__` method on an `IntArrayDeque` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> int:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            int: The next element in the `IntArrayDeque`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+            RuntimeError: If the deque was modified since the iterator was created.
+        """
+        pass
+
+class LongArrayDeque(deque[int]):
+    """
+    A double-ended queue of integers, stored in a power-of-two sized circular buffer.
+
+    `LongArrayDeque` has the same interface as `collections.deque` (without `maxlen`). Appending and popping at either
+    end are O(1), and unlike `collections.deque`, indexing is O(1) anywhere in the deque, as the elements are
+    one contiguous array that wraps around at most once.
+
+    Example:
+        >>> dq = LongArrayDeque([1, 2, 3])
+        >>> dq.appendleft(0)
+        >>> dq.pop()
+        3
+        >>> print(dq)
+        [0, 1, 2]
+
+    Note:
+        - Iterating over the deque while it is modified raises `RuntimeError`, like `collections.deque`.
+        - Elements are C long longs, values out of range raise `OverflowError`.
+    """
+
+    def drain(self, __n: SupportsIndex = -1) -> BigIntArrayList:
+        """
+        Pops up to `__n` elements from the left of the deque into a new `BigIntArrayList`, in order.
+
+        The elements are moved with at most two bulk copies, instead of one `popleft` call each.
+
+        Parameters:
+            __n (SupportsIndex, optional): The maximum number of elements to pop. Negative pops all of them. Defaults to -1.
+
+        Returns:
+            BigIntArrayList: The popped elements, first popped first.
+
+        Example:
+            >>> dq = LongArrayDeque([1, 2, 3])
+            >>> dq.drain(2)
+            [1, 2]
+            >>> print(dq)
+            [3]
+        """
+        pass
+
+    def to_list(self) -> list[int]:
+        """
+        Converts the `LongArrayDeque` to a standard Python list.
+
+        Returns:
+            list[int]: A new list containing all the elements of the `LongArrayDeque`, from left to right.
+
+        Example:
+            >>> LongArrayDeque([1, 2, 3]).to_list()
+            [1, 2, 3]
+        """
+        pass
+
+class LongArrayDequeIter(Iterator[int]):
+    """
+    Iterator for `LongArrayDeque`.
+
+    Note:
+        This class cannot be directly instantiated by users. It can only be obtained by calling the `__iter__` or
+        `__reversed__` method on a `LongArrayDeque` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> int:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            int: The next element in the `LongArrayDeque`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+            RuntimeError: If the deque was modified since the iterator was created.
+        """
+        pass
+
+class IntHeapPriorityQueue:
+    """
+    A min priority queue of C int priorities, each optionally paired with a C int payload.
+
+    `IntHeapPriorityQueue` is a 4-ary heap: half as deep as the binary heap of `heapq`, and the four children of a node
+    share one cache line. A paired queue stores payloads next to the priorities instead of in tuples,
+    which makes it a drop-in for `heapq` over `(priority, item)` tuples in schedulers and graph searches.
+
+    Example:
+        >>> queue = IntHeapPriorityQueue([5, 1, 3])
+        >>> queue.push(2)
+        >>> queue.pop()
+        1
+        >>> paired = IntHeapPriorityQueue([(5, 50), (1, 10)], paired=True)
+        >>> paired.push(3, 30)
+        >>> paired.pop()
+        (1, 10)
+
+    Note:
+        - Entries with equal priorities pop in no particular order.
+        - Values out of the C int range raise `OverflowError`.
+    """
+
+    def __init__(self, iterable: Iterable[int] | Iterable[tuple[int, int]] = ..., paired: bool = False) -> None:
+        """
+        Creates a `IntHeapPriorityQueue`, heapifying the initial entries in O(n).
+
+        Parameters:
+            iterable (Iterable, optional): The initial priorities, or `(priority, payload)` pairs if paired.
+            paired (bool, optional): Whether every priority is pushed with a payload. Defaults to False.
+        """
+        pass
+
+    def push(self, __priority: int, __payload: int = ...) -> None:
+        """
+        Pushes a priority, with its payload if the queue is paired, in O(log n).
+
+        Raises:
+            TypeError: If the payload is missing from a paired queue, or given to an unpaired one.
+        """
+        pass
+
+    def push_many(self, __priorities: Iterable[int], __payloads: Iterable[int] = ...) -> None:
+        """
+        Pushes many priorities, with as many payloads if the queue is paired.
+        Pushing at least a quarter of the queue's size at once rebuilds the heap in O(n) instead.
+
+        Raises:
+            ValueError: If priorities and payloads differ in length.
+        """
+        pass
+
+    def pop(self) -> int | tuple[int, int]:
+        """
+        Removes and returns the smallest priority, or the `(priority, payload)` pair if the queue is paired.
+
+        Raises:
+            IndexError: If the queue is empty.
+        """
+        pass
+
+    def peek(self) -> int | tuple[int, int]:
+        """
+        Returns what `pop` would, without removing it.
+
+        Raises:
+            IndexError: If the queue is empty.
+        """
+        pass
+
+    def clear(self) -> None:
+        """
+        Removes every entry.
+        """
+        pass
+
+    def is_paired(self) -> bool:
+        """
+        Returns whether the queue pairs every priority with a payload.
+        """
+        pass
+
+    def to_list(self) -> list[int] | list[tuple[int, int]]:
+        """
+        Returns the entries in the order `pop` would return them, leaving the queue unchanged.
+
+        Example:
+            >>> IntHeapPriorityQueue([3, 1, 2]).to_list()
+            [1, 2, 3]
+        """
+        pass
+
+    def __len__(self) -> int:
+        pass
+
+class LongHeapPriorityQueue:
+    """
+    A min priority queue of C long long priorities, each optionally paired with a C long long payload.
+
+    `LongHeapPriorityQueue` is a 4-ary heap: half as deep as the binary heap of `heapq`, and the four children of a node
+    share one cache line. A paired queue stores payloads next to the priorities instead of in tuples,
+    which makes it a drop-in for `heapq` over `(priority, item)` tuples in schedulers and graph searches.
+
+    Example:
+        >>> queue = LongHeapPriorityQueue([5, 1, 3])
+        >>> queue.push(2)
+        >>> queue.pop()
+        1
+        >>> paired = LongHeapPriorityQueue([(5, 50), (1, 10)], paired=True)
+        >>> paired.push(3, 30)
+        >>> paired.pop()
+        (1, 10)
+
+    Note:
+        - Entries with equal priorities pop in no particular order.
+        - Values out of the C long long range raise `OverflowError`.
+    """
+
+    def __init__(self, iterable: Iterable[int] | Iterable[tuple[int, int]] = ..., paired: bool = False) -> None:
+        """
+        Creates a `LongHeapPriorityQueue`, heapifying the initial entries in O(n).
+
+        Parameters:
+            iterable (Iterable, optional): The initial priorities, or `(priority, payload)` pairs if paired.
+            paired (bool, optional): Whether every priority is pushed with a payload. Defaults to False.
+        """
+        pass
+
+    def push(self, __priority: int, __payload: int = ...) -> None:
+        """
+        Pushes a priority, with its payload if the queue is paired, in O(log n).
+
+        Raises:
+            TypeError: If the payload is missing from a paired queue, or given to an unpaired one.
+        """
+        pass
+
+    def push_many(self, __priorities: Iterable[int], __payloads: Iterable[int] = ...) -> None:
+        """
+        Pushes many priorities, with as many payloads if the queue is paired.
+        Pushing at least a quarter of the queue's size at once rebuilds the heap in O(n) instead.
+
+        Raises:
+            ValueError: If priorities and payloads differ in length.
+        """
+        pass
+
+    def pop(self) -> int | tuple[int, int]:
+        """
+        Removes and returns the smallest priority, or the `(priority, payload)` pair if the queue is paired.
+
+        Raises:
+            IndexError: If the queue is empty.
+        """
+        pass
+
+    def peek(self) -> int | tuple[int, int]:
+        """
+        Returns what `pop` would, without removing it.
+
+        Raises:
+            IndexError: If the queue is empty.
+        """
+        pass
+
+    def clear(self) -> None:
+        """
+        Removes every entry.
+        """
+        pass
+
+    def is_paired(self) -> bool:
+        """
+        Returns whether the queue pairs every priority with a payload.
+        """
+        pass
+
+    def to_list(self) -> list[int] | list[tuple[int, int]]:
+        """
+        Returns the entries in the order `pop` would return them, leaving the queue unchanged.
+
+        Example:
+            >>> LongHeapPriorityQueue([3, 1, 2]).to_list()
+            [1, 2, 3]
+        """
+        pass
+
+    def __len__(self) -> int:
+        pass
+
+class IndexedIntHeap:
+    """
+    A min heap of non-negative integer ids by C int priority, which can change the priority of any id in O(log n).
+
+    It keeps the heap position of every id, so `decrease_key` doesn't need the lazy deletion `heapq` based Dijkstra
+    uses. Like `IntHeapPriorityQueue`, it is a 4-ary heap. Ids index a table as large as the largest id,
+    so they should be dense, like the nodes of a graph.
+
+    Example:
+        >>> heap = IndexedIntHeap()
+        >>> heap.push(0, 10)
+        >>> heap.push(1, 5)
+        >>> heap.decrease_key(0, 1)
+        >>> heap.pop()
+        (0, 1)
+        >>> 1 in heap, heap[1]
+        (True, 5)
+    """
+
+    def __init__(self) -> None:
+        pass
+
+    def push(self, __id: int, __priority: int) -> None:
+        """
+        Pushes an id with its priority in O(log n).
+
+        Raises:
+            ValueError: If the id is negative or already in the heap.
+        """
+        pass
+
+    def update(self, __id: int, __priority: int) -> None:
+        """
+        Sets the priority of an id, pushing it if it isn't in the heap, in O(log n).
+        """
+        pass
+
+    def decrease_key(self, __id: int, __priority: int) -> None:
+        """
+        Lowers the priority of an id in the heap in O(log n).
+
+        Raises:
+            KeyError: If the id is not in the heap.
+            ValueError: If the priority is greater than the current one.
+        """
+        pass
+
+    def pop(self) -> tuple[int, int]:
+        """
+        Removes and returns the `(id, priority)` pair with the smallest priority.
+
+        Raises:
+            IndexError: If the heap is empty.
+        """
+        pass
+
+    def peek(self) -> tuple[int, int]:
+        """
+        Returns what `pop` would, without removing it.
+
+        Raises:
+            IndexError: If the heap is empty.
+        """
+        pass
+
+    def remove(self, __id: int) -> int:
+        """
+        Removes an id from the heap in O(log n), returning its priority.
+
+        Raises:
+            KeyError: If the id is not in the heap.
+        """
+        pass
+
+    def clear(self) -> None:
+        """
+        Removes every id.
+        """
+        pass
+
+    def to_list(self) -> list[tuple[int, int]]:
+        """
+        Returns the `(id, priority)` pairs in the order `pop` would return them, leaving the heap unchanged.
+        """
+        pass
+
+    def __getitem__(self, __id: int) -> int:
+        """
+        Returns the priority of an id.
+
+        Raises:
+            KeyError: If the id is not in the heap.
+        """
+        pass
+
+    def __contains__(self, __id: object) -> bool:
+        pass
+
+    def __len__(self) -> int:
+        pass
+
+class IntIntHashMap(dict[int, int]):
+    """
+    A specialized version of Python's dict for integer keys and values, optimized for performance by using a C
+    implementation.
+
+    The map is backed by an open addressing hash table which stores its entries densely, so iteration, `keys()`,
+    `values()` and `copy()` are linear scans over contiguous memory. Both keys and values are restricted to the range
+    of standard C int types (`INT_MIN` to `INT_MAX`), assigning values outside of this range raises `OverflowError`.
+
+    Parameters:
+        - `__map` (optional): An `IntIntHashMap`, a dict, a mapping or an iterable of (key, value) pairs.
+
+    Example:
+        >>> my_map = IntIntHashMap({1: 2})
+        >>> my_map[3] = 4
+        >>> print(my_map)
+        {1: 2, 3: 4}
+
+    Note:
+        - Iteration order is insertion order until an entry is removed, after which the last entry takes the place
+          of the removed one.
+    """
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `IntIntHashMap`.
+        """
+        pass
+
+    @overload
+    def __init__(self, __map: Mapping[int, int] | Iterable[tuple[int, int]]) -> None:
+        """
+        Initializes an `IntIntHashMap` from a mapping or an iterable of (key, value) pairs.
+
+        Parameters:
+            __map (Mapping[int, int] | Iterable[tuple[int, int]]): The entries to initialize the map with.
+        """
+        pass
+
+    def get(self, __key: int, __default: int | None = None) -> int | None:
+        """
+        Returns the value for `__key` if `__key` is in the map, else `__default`.
+
+        Example:
+            >>> IntIntHashMap({1: 2}).get(3, -1)
+            -1
+        """
+        pass
+
+    def pop(self, __key: int, __default: int = ...) -> int:
+        """
+        Removes `__key` and returns its value.
+
+        Raises:
+            KeyError: If `__key` is not in the map and no `__default` is given.
+        """
+        pass
+
+    def setdefault(self, __key: int, __default: int = 0) -> int:
+        """
+        Returns the value for `__key`, inserting `__default` first if `__key` is not in the map.
+        """
+        pass
+
+    def add_to(self, __key: int, __delta: int) -> int:
+        """
+        Adds `__delta` to the value of `__key`, a missing key is treated as 0. Like fastutil's `addTo`, the
+        value wraps around on overflow.
+
+        Returns:
+            int: The previous value of `__key` (0 if it was missing).
+
+        Example:
+            >>> counter = IntIntHashMap()
+            >>> counter.add_to(7, 1)
+            0
+            >>> counter.add_to(7, 1)
+            1
+            >>> counter[7]
+            2
+        """
+        pass
+
+    def items(self) -> list[tuple[int, int]]:
+        """
+        Returns a list of the (key, value) pairs of the map.
+        """
+        pass
+
+    def keys(self) -> IntArrayList:
+        """
+        Returns the keys of the map as a new `IntArrayList`, without boxing every key.
+        """
+        pass
+
+    def values(self) -> IntArrayList:
+        """
+        Returns the values of the map as a new `IntArrayList`, without boxing every value.
+        """
+        pass
+
+    def get_many(self, __keys: IntArrayList | BigIntArrayList | Buffer, __default: int = 0) -> IntArrayList:
+        """
+        Looks up every key of `__keys` in one native loop, with the GIL released. Other threads can still read
+        the map meanwhile, but changing it raises `BufferError` until the call returns.
+
+        Parameters:
+            __keys: An `IntArrayList`, a `BigIntArrayList` or any C-contiguous int32/int64 buffer (e.g. a numpy array).
+            __default (int): The value for missing keys.
+
+        Returns:
+            IntArrayList: The values of the keys, in the same order as `__keys`.
+
+        Example:
+            >>> IntIntHashMap({1: 2, 3: 4}).get_many(IntArrayList([3, 5, 1]), -1)
+            [4, -1, 2]
+        """
+        pass
+
+    def put_many(self, __keys: IntArrayList | BigIntArrayList | Buffer,
+                 __values: IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Puts every (key, value) pair of `__keys` and `__values` into the map in one native loop.
+        The keys are probed with the GIL released, then the values are stored with the GIL held.
+
+        Raises:
+            ValueError: If `__keys` and `__values` don't have the same length.
+            OverflowError: If a key or a value is out of the range of C int, in which case the map is unchanged.
+            BufferError: If another batch call on the map is running, in which case the map is unchanged.
+        """
+        pass
+
+    def contains_many(self, __keys: IntArrayList | BigIntArrayList | Buffer) -> bytes:
+        """
+        Checks every key of `__keys` in one native loop, with the GIL released. Other threads can still read
+        the map meanwhile, but changing it raises `BufferError` until the call returns.
+
+        Returns:
+            bytes: A mask with one byte per key, 1 if the key is in the map else 0. It can be viewed as a bool array
+            without copying, e.g. `numpy.frombuffer(mask, dtype=bool)`.
+        """
+        pass
+
+    def update(self, __map: Mapping[int, int] | Iterable[tuple[int, int]]) -> None:
+        """
+        Puts all entries of `__map` into the map, overwriting existing keys.
+        """
+        pass
+
+    def copy(self) -> IntIntHashMap:
+        """
+        Returns a shallow copy of the map.
+        """
+        pass
+
+    def __iter__(self) -> IntIntHashMapIter:
+        pass
+
+
+class IntIntHashMapIter(Iterator[int]):
+    """
+    Iterator over the keys of an `IntIntHashMap`.
+
+    Note:
+        This class cannot be directly instantiated by users, it is obtained by calling `iter()` on an `IntIntHashMap`.
+
+    Raises:
+        RuntimeError: If the map changed size during iteration.
+    """
+
+    def __next__(self) -> int:
+        pass
+
+
+class IntHashSet(set[int]):
+    """
+    A specialized version of Python's set for integers, optimized for performance by using a C implementation.
+
+    The set is backed by an open addressing hash table which stores its elements densely, so iteration and `copy()`
+    are linear scans over contiguous memory. Elements are restricted to the range of standard C int types (`INT_MIN` to `INT_MAX`), adding an element
+    outside of this range raises `OverflowError`.
+
+    `update()`, `intersection_update()`, `difference_update()` and `symmetric_difference_update()` accept an
+    `IntArrayList`, a `BigIntArrayList` or any C-contiguous int32/int64 buffer (e.g. a numpy array) and read it
+    without boxing any element. The operators `|`, `&`, `-` and `^` (and their in-place forms) work between two
+    `IntHashSet` objects, intersections always probe the larger operand with the smaller one.
+
+    Parameters:
+        - `__iterable` (optional): An iterable of ints, an `IntArrayList`, a `BigIntArrayList` or an int buffer.
+
+    Example:
+        >>> ids = IntHashSet(IntArrayList([3, 1, 3, 2]))
+        >>> ids &= IntHashSet([1, 2, 5])
+        >>> print(ids)
+        {1, 2}
+
+    Note:
+        - Iteration order is insertion order until an element is removed, after which the last element takes the
+          place of the removed one.
+    """
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `IntHashSet`.
+        """
+        pass
+
+    @overload
+    def __init__(self, __iterable: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Initializes a `IntHashSet` with the elements of `__iterable`.
+        """
+        pass
+
+    def add(self, __element: int) -> None:
+        """
+        Adds `__element` to the set.
+        """
+        pass
+
+    def discard(self, __element: int) -> None:
+        """
+        Removes `__element` from the set if it is present.
+        """
+        pass
+
+    def remove(self, __element: int) -> None:
+        """
+        Removes `__element` from the set.
+
+        Raises:
+            KeyError: If `__element` is not in the set.
+        """
+        pass
+
+    def pop(self) -> int:
+        """
+        Removes and returns an arbitrary element, the most recently inserted one is the cheapest to remove.
+
+        Raises:
+            KeyError: If the set is empty.
+        """
+        pass
+
+    def update(self, __other: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Adds every element of `__other` to the set.
+
+        Raises:
+            OverflowError: If an element is out of range, elements before it are still added.
+        """
+        pass
+
+    def intersection_update(self, __other: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Keeps only the elements which are also in `__other`.
+        """
+        pass
+
+    def difference_update(self, __other: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Removes every element of `__other` from the set.
+        """
+        pass
+
+    def symmetric_difference_update(self, __other: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Keeps the elements which are in exactly one of the set and `__other`.
+        """
+        pass
+
+    def copy(self) -> IntHashSet:
+        """
+        Returns a shallow copy of the set.
+        """
+        pass
+
+    def __or__(self, __other: IntHashSet) -> IntHashSet:
+        pass
+
+    def __and__(self, __other: IntHashSet) -> IntHashSet:
+        pass
+
+    def __sub__(self, __other: IntHashSet) -> IntHashSet:
+        pass
+
+    def __xor__(self, __other: IntHashSet) -> IntHashSet:
+        pass
+
+    def __iter__(self) -> IntHashSetIter:
+        pass
+
+
+class IntHashSetIter(Iterator[int]):
+    """
+    Iterator over the elements of an `IntHashSet`.
+
+    Note:
+        This class cannot be directly instantiated by users, it is obtained by calling `iter()` on an `IntHashSet`.
+
+    Raises:
+        RuntimeError: If the set changed size during iteration.
+    """
+
+    def __next__(self) -> int:
+        pass
+
+
+class LongHashSet(set[int]):
+    """
+    A specialized version of Python's set for integers, optimized for performance by using a C implementation.
+
+    The set is backed by an open addressing hash table which stores its elements densely, so iteration and `copy()`
+    are linear scans over contiguous memory. Elements are restricted to the range of C long long (-2 ** 63 to 2 ** 63 - 1), adding an element
+    outside of this range raises `OverflowError`.
+
+    `update()`, `intersection_update()`, `difference_update()` and `symmetric_difference_update()` accept an
+    `IntArrayList`, a `BigIntArrayList` or any C-contiguous int32/int64 buffer (e.g. a numpy array) and read it
+    without boxing any element. The operators `|`, `&`, `-` and `^` (and their in-place forms) work between two
+    `LongHashSet` objects, intersections always probe the larger operand with the smaller one.
+
+    Parameters:
+        - `__iterable` (optional): An iterable of ints, an `IntArrayList`, a `BigIntArrayList` or an int buffer.
+
+    Example:
+        >>> ids = LongHashSet(IntArrayList([3, 1, 3, 2]))
+        >>> ids &= LongHashSet([1, 2, 5])
+        >>> print(ids)
+        {1, 2}
+
+    Note:
+        - Iteration order is insertion order until an element is removed, after which the last element takes the
+          place of the removed one.
+    """
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `LongHashSet`.
+        """
+        pass
+
+    @overload
+    def __init__(self, __iterable: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Initializes a `LongHashSet` with the elements of `__iterable`.
+        """
+        pass
+
+    def add(self, __element: int) -> None:
+        """
+        Adds `__element` to the set.
+        """
+        pass
+
+    def discard(self, __element: int) -> None:
+        """
+        Removes `__element` from the set if it is present.
+        """
+        pass
+
+    def remove(self, __element: int) -> None:
+        """
+        Removes `__element` from the set.
+
+        Raises:
+            KeyError: If `__element` is not in the set.
+        """
+        pass
+
+    def pop(self) -> int:
+        """
+        Removes and returns an arbitrary element, the most recently inserted one is the cheapest to remove.
+
+        Raises:
+            KeyError: If the set is empty.
+        """
+        pass
+
+    def update(self, __other: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Adds every element of `__other` to the set.
+
+        Raises:
+            OverflowError: If an element is out of range, elements before it are still added.
+        """
+        pass
+
+    def intersection_update(self, __other: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Keeps only the elements which are also in `__other`.
+        """
+        pass
+
+    def difference_update(self, __other: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Removes every element of `__other` from the set.
+        """
+        pass
+
+    def symmetric_difference_update(self, __other: Iterable[int] | IntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Keeps the elements which are in exactly one of the set and `__other`.
+        """
+        pass
+
+    def copy(self) -> LongHashSet:
+        """
+        Returns a shallow copy of the set.
+        """
+        pass
+
+    def __or__(self, __other: LongHashSet) -> LongHashSet:
+        pass
+
+    def __and__(self, __other: LongHashSet) -> LongHashSet:
+        pass
+
+    def __sub__(self, __other: LongHashSet) -> LongHashSet:
+        pass
+
+    def __xor__(self, __other: LongHashSet) -> LongHashSet:
+        pass
+
+    def __iter__(self) -> LongHashSetIter:
+        pass
+
+
+class LongHashSetIter(Iterator[int]):
+    """
+    Iterator over the elements of a `LongHashSet`.
+
+    Note:
+        This class cannot be directly instantiated by users, it is obtained by calling `iter()` on a `LongHashSet`.
+
+    Raises:
+        RuntimeError: If the set changed size during iteration.
+    """
+
+    def __next__(self) -> int:
+        pass
+
+
+class BitSet:
+    """
+    A packed sequence of bits, a compact replacement for a list of bools.
+
+    Bits are stored 64 to a machine word, so a mask takes one bit per flag instead of a pointer. `cardinality()`
+    and the operators `&`, `|`, `^` and `~` (and the in-place forms of the first three) run a word at a time
+    with SIMD, and `cardinality()` uses the popcount instructions of AVX-512 VPOPCNTDQ where available.
+    A `BitSet` can be passed to `IntArrayList.select()` to compact a list with it.
+
+    Parameters:
+        - `bits` (optional): An int for that many clear bits, or an iterable whose elements are
+          interpreted as bools.
+
+    Example:
+        >>> mask = BitSet([True, False, True])
+        >>> mask &= BitSet([True, True, False])
+        >>> print(mask)
+        [True, False, False]
+
+    Note:
+        - Binary operators require both operands to have the same size.
+    """
+
+    def __init__(self, bits: Iterable[object] | int = 0) -> None:
+        pass
+
+    def get(self, __index: int) -> bool:
+        """
+        Returns the bit at `__index`, negative indices count from the end.
+
+        Raises:
+            IndexError: If the index is out of range.
+        """
+        pass
+
+    @overload
+    def set(self, __index: int) -> None:
+        """
+        Sets the bit at `__index`, negative indices count from the end.
+
+        Raises:
+            IndexError: If the index is out of range.
+        """
+        pass
+
+    @overload
+    def set(self, __start: int, __stop: int) -> None:
+        """
+        Sets every bit in `[__start, __stop)`, whole words at a time.
+
+        Raises:
+            IndexError: If not `0 <= __start <= __stop <= len(self)`.
+        """
+        pass
+
+    @overload
+    def clear(self) -> None:
+        """
+        Clears every bit, the size is not changed.
+        """
+        pass
+
+    @overload
+    def clear(self, __index: int) -> None:
+        """
+        Clears the bit at `__index`, negative indices count from the end.
+
+        Raises:
+            IndexError: If the index is out of range.
+        """
+        pass
+
+    @overload
+    def clear(self, __start: int, __stop: int) -> None:
+        """
+        Clears every bit in `[__start, __stop)`, whole words at a time.
+
+        Raises:
+            IndexError: If not `0 <= __start <= __stop <= len(self)`.
+        """
+        pass
+
+    @overload
+    def flip(self, __index: int) -> None:
+        """
+        Flips the bit at `__index`, negative indices count from the end.
+
+        Raises:
+            IndexError: If the index is out of range.
+        """
+        pass
+
+    @overload
+    def flip(self, __start: int, __stop: int) -> None:
+        """
+        Flips every bit in `[__start, __stop)`, whole words at a time.
+
+        Raises:
+            IndexError: If not `0 <= __start <= __stop <= len(self)`.
+        """
+        pass
+
+    def cardinality(self) -> int:
+        """
+        Returns the number of set bits.
+        """
+        pass
+
+    def next_set_bit(self, __start: int = 0) -> int:
+        """
+        Returns the index of the first set bit at or after `__start`, or -1 if there is none.
+
+        Example:
+            >>> bits = BitSet([False, True, False, True])
+            >>> i = bits.next_set_bit()
+            >>> while i >= 0:
+            ...     print(i)
+            ...     i = bits.next_set_bit(i + 1)
+            1
+            3
+
+        Raises:
+            ValueError: If `__start` is negative.
+        """
+        pass
+
+    def next_clear_bit(self, __start: int = 0) -> int:
+        """
+        Returns the index of the first clear bit at or after `__start`, or -1 if there is none.
+
+        Raises:
+            ValueError: If `__start` is negative.
+        """
+        pass
+
+    def append(self, __value: object) -> None:
+        """
+        Appends a bit, set if `__value` is true.
+        """
+        pass
+
+    def resize(self, __size: int) -> None:
+        """
+        Changes the number of bits, new bits are clear.
+        """
+        pass
+
+    def copy(self) -> BitSet:
+        pass
+
+    def to_list(self) -> list[bool]:
+        pass
+
+    def __len__(self) -> int:
+        pass
+
+    def __getitem__(self, __index: int) -> bool:
+        pass
+
+    def __setitem__(self, __index: int, __value: object) -> None:
+        pass
+
+    def __iter__(self) -> Iterator[bool]:
+        pass
+
+    def __and__(self, __other: BitSet) -> BitSet:
+        pass
+
+    def __or__(self, __other: BitSet) -> BitSet:
+        pass
+
+    def __xor__(self, __other: BitSet) -> BitSet:
+        pass
+
+    def __invert__(self) -> BitSet:
+        pass
+
+    def __iand__(self, __other: BitSet) -> BitSet:
+        pass
+
+    def __ior__(self, __other: BitSet) -> BitSet:
+        pass
+
+    def __ixor__(self, __other: BitSet) -> BitSet:
+        pass
+
+
+class BitSetIter(Iterator[bool]):
+    """
+    Iterator over the bits of a `BitSet`.
+
+    Note:
+        This class cannot be directly instantiated by users, it is obtained by calling `iter()` on a `BitSet`.
+    """
+
+    def __next__(self) -> bool:
+        pass
+
+
+class RoaringBitmap:
+    """
+    A compressed set of unsigned 32-bit ints, a Roaring bitmap.
+
+    Values are grouped by their high 16 bits, each group stores its low 16 bits as a sorted array (up to 4096
+    values), a 65536-bit bitmap, or a list of runs after `run_optimize()`, whichever is smallest. Sparse and
+    dense data both take a few bytes per value or less. The operators `&`, `|` and `-` (and their in-place
+    forms) work group by group, intersecting two arrays with SIMD compares and combining bitmaps a word at a
+    time with SIMD.
+
+    `serialize()` writes the portable Roaring format, which the CRoaring, Java and Go implementations
+    (and pyroaring) read, and `deserialize()` reads it back.
+
+    Parameters:
+        - `__iterable` (optional): An iterable of ints, an `IntArrayList`, an `UnsignedIntArrayList`,
+          a `BigIntArrayList`, an int buffer or another `RoaringBitmap`.
+
+    Example:
+        >>> ids = RoaringBitmap(IntArrayList([3, 1, 3, 2]))
+        >>> ids.add_range(100, 200)
+        >>> (ids & RoaringBitmap([2, 150, 300])).to_int_array_list()
+        [2, 150]
+
+    Note:
+        - Values must be in `range(2 ** 32)`, adding anything else raises `OverflowError`.
+    """
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `RoaringBitmap`.
+        """
+        pass
+
+    @overload
+    def __init__(self, __iterable: Iterable[int] | IntArrayList | UnsignedIntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Initializes a `RoaringBitmap` with the values of `__iterable`.
+        """
+        pass
+
+    def add(self, __value: int) -> None:
+        """
+        Adds `__value` to the set.
+        """
+        pass
+
+    def discard(self, __value: int) -> None:
+        """
+        Removes `__value` from the set if it is present.
+        """
+        pass
+
+    def remove(self, __value: int) -> None:
+        """
+        Removes `__value` from the set.
+
+        Raises:
+            KeyError: If `__value` is not in the set.
+        """
+        pass
+
+    def clear(self) -> None:
+        pass
+
+    def copy(self) -> RoaringBitmap:
+        pass
+
+    def add_many(self, __values: Iterable[int] | IntArrayList | UnsignedIntArrayList | BigIntArrayList | Buffer) -> None:
+        """
+        Adds every value of `__values`. Lists and buffers are read without boxing any element, and the values are
+        sorted with SIMD before being added group by group.
+
+        Raises:
+            OverflowError: If a value is out of range, nothing is added then.
+        """
+        pass
+
+    def add_range(self, __start: int, __stop: int) -> None:
+        """
+        Adds every value of `range(__start, __stop)`, full groups are stored as a single run.
+
+        Raises:
+            ValueError: If the range isn't within `range(2 ** 32)`.
+        """
+        pass
+
+    def rank(self, __value: int) -> int:
+        """
+        Returns the number of values not greater than `__value`.
+        """
+        pass
+
+    def select(self, __index: int) -> int:
+        """
+        Returns the `__index`-th smallest value, counting from 0.
+
+        Raises:
+            IndexError: If the index is out of range.
+        """
+        pass
+
+    def min(self) -> int:
+        """
+        Raises:
+            ValueError: If the set is empty.
+        """
+        pass
+
+    def max(self) -> int:
+        """
+        Raises:
+            ValueError: If the set is empty.
+        """
+        pass
+
+    def to_int_array_list(self) -> IntArrayList | UnsignedIntArrayList:
+        """
+        Returns the values in ascending order as an `IntArrayList`, or as an `UnsignedIntArrayList` if a value
+        is greater than `INT_MAX`.
+        """
+        pass
+
+    def to_unsigned_int_array_list(self) -> UnsignedIntArrayList:
+        """
+        Returns the values in ascending order as an `UnsignedIntArrayList`, which holds every valid value.
+        """
+        pass
+
+    def run_optimize(self) -> bool:
+        """
+        Stores each group as runs if that takes less room, and back as an array or bitmap if not.
+        Worth calling once a set built from ranges or clustered values is complete.
+
+        Returns:
+            bool: If any group changed.
+        """
+        pass
+
+    def serialize(self) -> bytes:
+        """
+        Returns the set in the portable Roaring format.
+        """
+        pass
+
+    @classmethod
+    def deserialize(cls, __data: Buffer) -> RoaringBitmap:
+        """
+        Reads a set written in the portable Roaring format.
+
+        Raises:
+            ValueError: If `__data` isn't a valid serialized bitmap.
+        """
+        pass
+
+    def __len__(self) -> int:
+        pass
+
+    def __contains__(self, __value: object) -> bool:
+        pass
+
+    def __iter__(self) -> Iterator[int]:
+        pass
+
+    def __and__(self, __other: RoaringBitmap) -> RoaringBitmap:
+        pass
+
+    def __or__(self, __other: RoaringBitmap) -> RoaringBitmap:
+        pass
+
+    def __sub__(self, __other: RoaringBitmap) -> RoaringBitmap:
+        pass
+
+    def __iand__(self, __other: RoaringBitmap) -> RoaringBitmap:
+        pass
+
+    def __ior__(self, __other: RoaringBitmap) -> RoaringBitmap:
+        pass
+
+    def __isub__(self, __other: RoaringBitmap) -> RoaringBitmap:
+        pass
+
+
+class RoaringBitmapIter(Iterator[int]):
+    """
+    Iterator over the values of a `RoaringBitmap` in ascending order.
+    It continues from the last value returned, so changing the set while iterating is safe.
+
+    Note:
+        This class cannot be directly instantiated by users, it is obtained by calling `iter()` on a `RoaringBitmap`.
+    """
+
+    def __next__(self) -> int:
+        pass
+
+
+class Int2ObjectHashMap(dict[int, _V], Generic[_V]):
+    """
+    A specialized version of Python's dict for integer keys and arbitrary values, optimized for performance by using a
+    C implementation.
+
+    Keys are stored unboxed in an open addressing hash table, so compared with a `dict` every entry saves the `int`
+    object of its key and the table itself is denser. Keys are restricted to the range of standard C int types
+    (`INT_MIN` to `INT_MAX`). Values are held by strong references and are visible to the garbage collector, so
+    reference cycles through the map are collected.
+
+    Parameters:
+        - `__map` (optional): An `Int2ObjectHashMap`, a dict, a mapping or an iterable of (key, value) pairs.
+
+    Example:
+        >>> names = Int2ObjectHashMap({1: "one"})
+        >>> names[2] = "two"
+        >>> print(names)
+        {1: 'one', 2: 'two'}
+
+    Note:
+        - Iteration order is insertion order until an entry is removed, after which the last entry takes the place
+          of the removed one.
+    """
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `Int2ObjectHashMap`.
+        """
+        pass
+
+    @overload
+    def __init__(self, __map: Mapping[int, _V] | Iterable[tuple[int, _V]]) -> None:
+        """
+        Initializes an `Int2ObjectHashMap` from a mapping or an iterable of (key, value) pairs.
+        """
+        pass
+
+    def get(self, __key: int, __default: _V | None = None) -> _V | None:
+        """
+        Returns the value for `__key` if `__key` is in the map, else `__default`.
+        """
+        pass
+
+    def pop(self, __key: int, __default: _V = ...) -> _V:
+        """
+        Removes `__key` and returns its value.
+
+        Raises:
+            KeyError: If `__key` is not in the map and no `__default` is given.
+        """
+        pass
+
+    def setdefault(self, __key: int, __default: _V | None = None) -> _V | None:
+        """
+        Returns the value for `__key`, inserting `__default` first if `__key` is not in the map.
+        """
+        pass
+
+    def items(self) -> list[tuple[int, _V]]:
+        """
+        Returns a list of the (key, value) pairs of the map.
+        """
+        pass
+
+    def keys(self) -> IntArrayList:
+        """
+        Returns the keys of the map as a new `IntArrayList`, without boxing every key.
+        """
+        pass
+
+    def values(self) -> list[_V]:
+        """
+        Returns a list of the values of the map.
+        """
+        pass
+
+    def update(self, __map: Mapping[int, _V] | Iterable[tuple[int, _V]]) -> None:
+        """
+        Puts all entries of `__map` into the map, overwriting existing keys.
+        """
+        pass
+
+    def copy(self) -> Int2ObjectHashMap[_V]:
+        """
+        Returns a shallow copy of the map.
+        """
+        pass
+
+    def __iter__(self) -> Int2ObjectHashMapIter:
+        pass
+
+
+class Int2ObjectHashMapIter(Iterator[int]):
+    """
+    Iterator over the keys of an `Int2ObjectHashMap`.
+
+    Note:
+        This class cannot be directly instantiated by users, it is obtained by calling `iter()` on an
+        `Int2ObjectHashMap`.
+
+    Raises:
+        RuntimeError: If the map changed size during iteration.
+    """
+
+    def __next__(self) -> int:
+        pass
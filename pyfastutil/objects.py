@@ -6,8 +6,20 @@ from .__pyfastutil import ObjectArrayListIter as __ObjectArrayListIter
 from .__pyfastutil import ObjectLinkedList as __ObjectLinkedList
 # noinspection PyUnresolvedReferences
 from .__pyfastutil import ObjectLinkedListIter as __ObjectLinkedListIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import ObjectArrayDeque as __ObjectArrayDeque
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import ObjectArrayDequeIter as __ObjectArrayDequeIter
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import Object2IntHashMap as __Object2IntHashMap
+# noinspection PyUnresolvedReferences
+from .__pyfastutil import Object2IntHashMapIter as __Object2IntHashMapIter
 
 ObjectArrayList = __ObjectArrayList.ObjectArrayList
 ObjectArrayListIter = __ObjectArrayListIter.ObjectArrayListIter
 ObjectLinkedList = __ObjectLinkedList.ObjectLinkedList
 ObjectLinkedListIter = __ObjectLinkedListIter.ObjectLinkedListIter
+ObjectArrayDeque = __ObjectArrayDeque.ObjectArrayDeque
+ObjectArrayDequeIter = __ObjectArrayDequeIter.ObjectArrayDequeIter
+Object2IntHashMap = __Object2IntHashMap.Object2IntHashMap
+Object2IntHashMapIter = __Object2IntHashMapIter.Object2IntHashMapIter
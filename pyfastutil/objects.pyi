@@ -1,6 +1,10 @@
-from typing import overload, Iterable, Iterator, Generic, TypeVar
+from typing import overload, Iterable, Iterator, Generic, TypeVar, Mapping, Hashable, SupportsIndex
+from collections import deque
+
+from .ints import IntArrayList
 
 _T = TypeVar("_T")
+_K = TypeVar("_K", bound=Hashable)
 
 
 class ObjectArrayList(list[_T], Generic[_T]):
@@ -245,3 +249,207 @@ class ObjectLinkedListIter(Iterator[_T]):
             StopIteration: If there are no more elements to iterate over.
         """
         pass
+
+
+class ObjectArrayDeque(deque[_T], Generic[_T]):
+    """
+    A double-ended queue of Python objects, stored in a power-of-two sized circular buffer.
+
+    `ObjectArrayDeque` has the same interface as `collections.deque` (without `maxlen`). Appending and popping at either
+    end are O(1), and unlike `collections.deque`, indexing is O(1) anywhere in the deque, as the elements are
+    one contiguous array that wraps around at most once.
+
+    Example:
+        >>> dq = ObjectArrayDeque([1, 2, 3])
+        >>> dq.appendleft(0)
+        >>> dq.pop()
+        3
+        >>> print(dq)
+        [0, 1, 2]
+
+    Note:
+        - Iterating over the deque while it is modified raises `RuntimeError`, like `collections.deque`.
+        - Elements are compared by equality, like `collections.deque`.
+    """
+
+    def drain(self, __n: SupportsIndex = -1) -> ObjectArrayList[_T]:
+        """
+        Pops up to `__n` elements from the left of the deque into a new `ObjectArrayList[_T]`, in order.
+
+        The elements are moved with at most two bulk copies, instead of one `popleft` call each.
+
+        Parameters:
+            __n (SupportsIndex, optional): The maximum number of elements to pop. Negative pops all of them. Defaults to -1.
+
+        Returns:
+            ObjectArrayList[_T]: The popped elements, first popped first.
+
+        Example:
+            >>> dq = ObjectArrayDeque([1, 2, 3])
+            >>> dq.drain(2)
+            [1, 2]
+            >>> print(dq)
+            [3]
+        """
+        pass
+
+    def to_list(self) -> list[_T]:
+        """
+        Converts the `ObjectArrayDeque` to a standard Python list.
+
+        Returns:
+            list[_T]: A new list containing all the elements of the `ObjectArrayDeque`, from left to right.
+
+        Example:
+            >>> ObjectArrayDeque([1, 2, 3]).to_list()
+            [1, 2, 3]
+        """
+        pass
+
+class ObjectArrayDequeIter(Iterator[_T]):
+    """
+    Iterator for `ObjectArrayDeque`.
+
+    Note:
+        This class cannot be directly instantiated by users. It can only be obtained by calling the `__iter__` or
+        `__reversed__` method on an `ObjectArrayDeque` object.
+
+    Raises:
+        TypeError: If attempted to be instantiated directly.
+    """
+
+    def __next__(self) -> _T:
+        """
+        Return the next element in the iteration.
+
+        Returns:
+            _T: The next element in the `ObjectArrayDeque`.
+
+        Raises:
+            StopIteration: If there are no more elements to iterate over.
+            RuntimeError: If the deque was modified since the iterator was created.
+        """
+        pass
+
+
+class Object2IntHashMap(dict[_K, int], Generic[_K]):
+    """
+    A specialized version of Python's dict for hashable keys and integer values, optimized for performance by using a
+    C implementation.
+
+    Every entry stores its key together with the key's cached hash and an unboxed C int value, so compared with a
+    `dict` every entry saves the `int` object of its value, and rehashing never calls `__hash__` again. Keys are
+    compared like `dict` does (identity, then hash, then `__eq__`), with a fast path for `str`. Values are restricted
+    to the range of standard C int types (`INT_MIN` to `INT_MAX`). Keys are visible to the garbage collector.
+
+    Parameters:
+        - `__map` (optional): An `Object2IntHashMap`, a dict, a mapping or an iterable of (key, value) pairs.
+
+    Example:
+        >>> ids = Object2IntHashMap()
+        >>> ids.setdefault("alice", len(ids))
+        0
+        >>> ids.add_to("alice", 10)
+        0
+        >>> print(ids)
+        {'alice': 10}
+
+    Note:
+        - Iteration order is insertion order until an entry is removed, after which the last entry takes the place
+          of the removed one.
+        - A key whose `__eq__` mutates the map it is being looked up in is not supported.
+    """
+
+    @overload
+    def __init__(self) -> None:
+        """
+        Initializes an empty `Object2IntHashMap`.
+        """
+        pass
+
+    @overload
+    def __init__(self, __map: Mapping[_K, int] | Iterable[tuple[_K, int]]) -> None:
+        """
+        Initializes an `Object2IntHashMap` from a mapping or an iterable of (key, value) pairs.
+        """
+        pass
+
+    def get(self, __key: _K, __default: int | None = None) -> int | None:
+        """
+        Returns the value for `__key` if `__key` is in the map, else `__default`.
+        """
+        pass
+
+    def pop(self, __key: _K, __default: int = ...) -> int:
+        """
+        Removes `__key` and returns its value.
+
+        Raises:
+            KeyError: If `__key` is not in the map and no `__default` is given.
+        """
+        pass
+
+    def setdefault(self, __key: _K, __default: int = 0) -> int:
+        """
+        Returns the value for `__key`, inserting `__default` first if `__key` is not in the map.
+        """
+        pass
+
+    def add_to(self, __key: _K, __delta: int) -> int:
+        """
+        Adds `__delta` to the value of `__key`, a missing key is treated as 0. Like fastutil's `addTo`, the
+        value wraps around on overflow.
+
+        Returns:
+            int: The previous value of `__key` (0 if it was missing).
+        """
+        pass
+
+    def items(self) -> list[tuple[_K, int]]:
+        """
+        Returns a list of the (key, value) pairs of the map.
+        """
+        pass
+
+    def keys(self) -> list[_K]:
+        """
+        Returns a list of the keys of the map.
+        """
+        pass
+
+    def values(self) -> IntArrayList:
+        """
+        Returns the values of the map as a new `IntArrayList`, without boxing every value.
+        """
+        pass
+
+    def update(self, __map: Mapping[_K, int] | Iterable[tuple[_K, int]]) -> None:
+        """
+        Puts all entries of `__map` into the map, overwriting the values of existing keys.
+        """
+        pass
+
+    def copy(self) -> Object2IntHashMap[_K]:
+        """
+        Returns a shallow copy of the map.
+        """
+        pass
+
+    def __iter__(self) -> Object2IntHashMapIter[_K]:
+        pass
+
+
+class Object2IntHashMapIter(Iterator[_K], Generic[_K]):
+    """
+    Iterator over the keys of an `Object2IntHashMap`.
+
+    Note:
+        This class cannot be directly instantiated by users, it is obtained by calling `iter()` on an
+        `Object2IntHashMap`.
+
+    Raises:
+        RuntimeError: If the map changed size during iteration.
+    """
+
+    def __next__(self) -> _K:
+        pass
@@ -3,18 +3,58 @@
 //
 
 #include "PyFastUtil.h"
+#include "utils/simd/SIMDUtils.h"
 #include "utils/simd/BitonicSort.h"
+#include "utils/simd/Reduction.h"
+#include "utils/simd/Search.h"
+#include "utils/simd/Select.h"
+#include "utils/simd/BitOps.h"
+#include "utils/simd/SetOps.h"
 #include "ints/IntArrayList.h"
 #include "ints/IntArrayListIter.h"
 #include "ints/BigIntArrayList.h"
 #include "ints/BigIntArrayListIter.h"
+#include "ints/ByteArrayList.h"
+#include "ints/ByteArrayListIter.h"
+#include "ints/ShortArrayList.h"
+#include "ints/ShortArrayListIter.h"
+#include "ints/UnsignedIntArrayList.h"
+#include "ints/UnsignedIntArrayListIter.h"
+#include "ints/UnsignedLongArrayList.h"
+#include "ints/UnsignedLongArrayListIter.h"
 #include "ints/IntLinkedList.h"
 #include "ints/IntLinkedListIter.h"
+#include "ints/IntArrayDeque.h"
+#include "ints/IntArrayDequeIter.h"
+#include "ints/LongArrayDeque.h"
+#include "ints/LongArrayDequeIter.h"
+#include "ints/IntHeapPriorityQueue.h"
+#include "ints/LongHeapPriorityQueue.h"
+#include "ints/IndexedIntHeap.h"
 #include "ints/IntIntHashMap.h"
+#include "ints/IntIntHashMapIter.h"
+#include "ints/IntHashSet.h"
+#include "ints/IntHashSetIter.h"
+#include "ints/LongHashSet.h"
+#include "ints/LongHashSetIter.h"
+#include "ints/BitSet.h"
+#include "ints/BitSetIter.h"
+#include "ints/RoaringBitmap.h"
+#include "ints/RoaringBitmapIter.h"
+#include "ints/Int2ObjectHashMap.h"
+#include "ints/Int2ObjectHashMapIter.h"
+#include "floats/FloatArrayList.h"
+#include "floats/FloatArrayListIter.h"
+#include "floats/DoubleArrayList.h"
+#include "floats/DoubleArrayListIter.h"
 #include "objects/ObjectArrayList.h"
 #include "objects/ObjectArrayListIter.h"
 #include "objects/ObjectLinkedList.h"
 #include "objects/ObjectLinkedListIter.h"
+#include "objects/ObjectArrayDeque.h"
+#include "objects/ObjectArrayDequeIter.h"
+#include "objects/Object2IntHashMap.h"
+#include "objects/Object2IntHashMapIter.h"
 #include "unsafe/Unsafe.h"
 #include "unsafe/SIMD.h"
 #include "unsafe/SIMDLowAVX512.h"
@@ -32,7 +72,13 @@ static struct PyModuleDef pyfastutilModule = {
 #pragma ide diagnostic ignored "bugprone-reserved-identifier"
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit___pyfastutil() {
+    simd::initSIMDUtils();
     simd::initBitonicSort();
+    simd::initReduction();
+    simd::initSearch();
+    simd::initSelect();
+    simd::initBitOps();
+    simd::initSetOps();
 
     PyObject *parent = PyModule_Create(&pyfastutilModule);
     if (parent == nullptr)
@@ -42,14 +88,49 @@ PyMODINIT_FUNC PyInit___pyfastutil() {
     PyModule_AddObject(parent, "IntArrayListIter", PyInit_IntArrayListIter());
     PyModule_AddObject(parent, "BigIntArrayList", PyInit_BigIntArrayList());
     PyModule_AddObject(parent, "BigIntArrayListIter", PyInit_BigIntArrayListIter());
+    PyModule_AddObject(parent, "ByteArrayList", PyInit_ByteArrayList());
+    PyModule_AddObject(parent, "ByteArrayListIter", PyInit_ByteArrayListIter());
+    PyModule_AddObject(parent, "ShortArrayList", PyInit_ShortArrayList());
+    PyModule_AddObject(parent, "ShortArrayListIter", PyInit_ShortArrayListIter());
+    PyModule_AddObject(parent, "UnsignedIntArrayList", PyInit_UnsignedIntArrayList());
+    PyModule_AddObject(parent, "UnsignedIntArrayListIter", PyInit_UnsignedIntArrayListIter());
+    PyModule_AddObject(parent, "UnsignedLongArrayList", PyInit_UnsignedLongArrayList());
+    PyModule_AddObject(parent, "UnsignedLongArrayListIter", PyInit_UnsignedLongArrayListIter());
     PyModule_AddObject(parent, "IntLinkedList", PyInit_IntLinkedList());
     PyModule_AddObject(parent, "IntLinkedListIter", PyInit_IntLinkedListIter());
-//    PyModule_AddObject(parent, "IntIntHashMap", PyInit_IntIntHashMap());
+    PyModule_AddObject(parent, "IntArrayDeque", PyInit_IntArrayDeque());
+    PyModule_AddObject(parent, "IntArrayDequeIter", PyInit_IntArrayDequeIter());
+    PyModule_AddObject(parent, "LongArrayDeque", PyInit_LongArrayDeque());
+    PyModule_AddObject(parent, "LongArrayDequeIter", PyInit_LongArrayDequeIter());
+    PyModule_AddObject(parent, "IntHeapPriorityQueue", PyInit_IntHeapPriorityQueue());
+    PyModule_AddObject(parent, "LongHeapPriorityQueue", PyInit_LongHeapPriorityQueue());
+    PyModule_AddObject(parent, "IndexedIntHeap", PyInit_IndexedIntHeap());
+    PyModule_AddObject(parent, "IntIntHashMap", PyInit_IntIntHashMap());
+    PyModule_AddObject(parent, "IntIntHashMapIter", PyInit_IntIntHashMapIter());
+    PyModule_AddObject(parent, "IntHashSet", PyInit_IntHashSet());
+    PyModule_AddObject(parent, "IntHashSetIter", PyInit_IntHashSetIter());
+    PyModule_AddObject(parent, "LongHashSet", PyInit_LongHashSet());
+    PyModule_AddObject(parent, "LongHashSetIter", PyInit_LongHashSetIter());
+    PyModule_AddObject(parent, "BitSet", PyInit_BitSet());
+    PyModule_AddObject(parent, "BitSetIter", PyInit_BitSetIter());
+    PyModule_AddObject(parent, "RoaringBitmap", PyInit_RoaringBitmap());
+    PyModule_AddObject(parent, "RoaringBitmapIter", PyInit_RoaringBitmapIter());
+    PyModule_AddObject(parent, "Int2ObjectHashMap", PyInit_Int2ObjectHashMap());
+    PyModule_AddObject(parent, "Int2ObjectHashMapIter", PyInit_Int2ObjectHashMapIter());
+
+    PyModule_AddObject(parent, "FloatArrayList", PyInit_FloatArrayList());
+    PyModule_AddObject(parent, "FloatArrayListIter", PyInit_FloatArrayListIter());
+    PyModule_AddObject(parent, "DoubleArrayList", PyInit_DoubleArrayList());
+    PyModule_AddObject(parent, "DoubleArrayListIter", PyInit_DoubleArrayListIter());
 
     PyModule_AddObject(parent, "ObjectArrayList", PyInit_ObjectArrayList());
     PyModule_AddObject(parent, "ObjectArrayListIter", PyInit_ObjectArrayListIter());
     PyModule_AddObject(parent, "ObjectLinkedList", PyInit_ObjectLinkedList());
     PyModule_AddObject(parent, "ObjectLinkedListIter", PyInit_ObjectLinkedListIter());
+    PyModule_AddObject(parent, "ObjectArrayDeque", PyInit_ObjectArrayDeque());
+    PyModule_AddObject(parent, "ObjectArrayDequeIter", PyInit_ObjectArrayDequeIter());
+    PyModule_AddObject(parent, "Object2IntHashMap", PyInit_Object2IntHashMap());
+    PyModule_AddObject(parent, "Object2IntHashMapIter", PyInit_Object2IntHashMapIter());
 
     PyModule_AddObject(parent, "Unsafe", PyInit_Unsafe());
     PyModule_AddObject(parent, "SIMD", PyInit_SIMD());
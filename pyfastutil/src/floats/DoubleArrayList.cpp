@@ -0,0 +1,1361 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#include "DoubleArrayList.h"
+#include <cmath>
+#include <climits>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+#include "utils/FloatBuffer.h"
+#include "utils/KeySort.h"
+#include "utils/simd/BitonicSort.h"
+#include "utils/simd/FloatSort.h"
+#include "utils/simd/SIMDUtils.h"
+#include "utils/simd/Reduction.h"
+#include "utils/memory/AlignedAllocator.h"
+#include "ints/IntArrayList.h"
+#include "floats/DoubleArrayListIter.h"
+
+extern "C" {
+
+PyTypeObject DoubleArrayListType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+/**
+ * Refuse to change the size while buffers are exported, their pointer and shape would go stale.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool DoubleArrayList_checkResizable(const DoubleArrayList *self) noexcept {
+    if (self->exports > 0) {
+        PyErr_SetString(PyExc_BufferError, "Existing exports of data: object cannot be re-sized");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Replace the elements of self with the elements of buffer, without boxing them.
+ */
+static void DoubleArrayList_assignBuffer(DoubleArrayList *self, const FloatBuffer &buffer) {
+    self->vector.resize(buffer.size);
+    if (buffer.doubles != nullptr) {
+        simd::simdMemCpy(const_cast<double *>(buffer.doubles), self->vector.data(), buffer.size);
+    } else {
+        std::copy(buffer.floats, buffer.floats + buffer.size, self->vector.begin());
+    }
+}
+
+/**
+ * Read a python float, or anything float() accepts without parsing a string.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool DoubleArrayList_asValue(PyObject *object, double &value) noexcept {
+    const double result = PyFloat_AsDouble(object);
+    if (result == -1.0 && PyErr_Occurred()) {
+        return false;
+    }
+    value = static_cast<double>(result);
+    return true;
+}
+
+static __forceinline void DoubleArrayList_parseArgs(PyObject *&args, PyObject *&kwargs, PyObject *&pyIterable,
+                                       Py_ssize_t &pySize) {
+    static constexpr const char *kwlist[] = {"iterable", "exceptSize", nullptr};
+
+    PyObject *arg1 = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|On", const_cast<char **>(kwlist), &arg1, &pySize)) {
+        return;
+    }
+
+    if (arg1 == nullptr) return;
+
+    if (PyLong_Check(arg1)) {
+        pySize = PyLong_AsSsize_t(arg1);
+    } else {
+        pyIterable = arg1;
+    }
+}
+
+static int DoubleArrayList_init(DoubleArrayList *self, PyObject *args, PyObject *kwargs) {
+    new(&self->vector) std::vector<double, AlignedAllocator<double, 64>>();
+
+    PyObject *pyIterable = nullptr;
+    Py_ssize_t pySize = -1;
+
+    DoubleArrayList_parseArgs(args, kwargs, pyIterable, pySize);
+    if (PyErr_Occurred()) {
+        return -1;
+    }
+
+    // init vector
+    try {
+        if (pySize > 0) {
+            self->vector.reserve(static_cast<size_t>(pySize));
+        }
+
+        if (pyIterable != nullptr) {
+            if (Py_TYPE(pyIterable) == &DoubleArrayListType) {  // DoubleArrayList is a final class
+                auto *iter = reinterpret_cast<DoubleArrayList *>(pyIterable);
+                self->vector = iter->vector;
+                return 0;
+            }
+
+            if (PyList_Check(pyIterable) || PyTuple_Check(pyIterable)) {  // fast operation
+                auto fastKeys = PySequence_Fast(pyIterable, "Shouldn't be happen (DoubleArrayList).");
+                if (fastKeys == nullptr) {
+                    return -1;
+                }
+
+                const auto size = PySequence_Fast_GET_SIZE(fastKeys);
+                auto items = PySequence_Fast_ITEMS(fastKeys);
+                self->vector.reserve(static_cast<size_t>(size));
+                for (Py_ssize_t i = 0; i < size; ++i) {
+                    double value;
+                    if (!DoubleArrayList_asValue(items[i], value)) {
+                        SAFE_DECREF(fastKeys);
+                        return -1;
+                    }
+                    self->vector.push_back(value);
+                }
+                SAFE_DECREF(fastKeys);
+                return 0;
+            }
+
+            if (PyObject_CheckBuffer(pyIterable)) {  // numpy arrays and other float buffers, no boxing
+                FloatBuffer buffer;
+                if (FloatBuffer_open(pyIterable, buffer)) {
+                    DoubleArrayList_assignBuffer(self, buffer);
+                    FloatBuffer_release(buffer);
+                    return 0;
+                }
+                // other formats, like int arrays, are still iterable
+                PyErr_Clear();
+            }
+
+            PyObject *iter = PyObject_GetIter(pyIterable);
+            if (iter == nullptr) {
+                PyErr_SetString(PyExc_TypeError, "Arg '__iterable' is not iterable.");
+                return -1;
+            }
+
+            PyObject *item;
+            while ((item = PyIter_Next(iter)) != nullptr) {
+                double value;
+                const bool success = DoubleArrayList_asValue(item, value);
+                SAFE_DECREF(item);
+                if (!success) {
+                    SAFE_DECREF(iter);
+                    return -1;
+                }
+                self->vector.push_back(value);
+            }
+            SAFE_DECREF(iter);
+            if (PyErr_Occurred()) return -1;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
+static void DoubleArrayList_dealloc(DoubleArrayList *self) {
+    self->vector.~vector();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *DoubleArrayList_frombuffer([[maybe_unused]] PyObject *cls, PyObject *obj) {
+    FloatBuffer buffer;
+    if (!FloatBuffer_open(obj, buffer)) {
+        return nullptr;
+    }
+
+    auto *list = Py_CreateObj<DoubleArrayList>(DoubleArrayListType);
+    if (list == nullptr) {
+        FloatBuffer_release(buffer);
+        return nullptr;
+    }
+
+    try {
+        DoubleArrayList_assignBuffer(list, buffer);
+    } catch (const std::exception &e) {
+        FloatBuffer_release(buffer);
+        Py_DECREF(list);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    FloatBuffer_release(buffer);
+    return reinterpret_cast<PyObject *>(list);
+}
+
+static PyObject *DoubleArrayList_view(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    int readonly = 0;  // default: false
+    static constexpr const char *kwlist[] = {"readonly", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", const_cast<char **>(kwlist), &readonly)) {
+        return nullptr;
+    }
+
+    PyObject *view = PyMemoryView_FromObject(pySelf);
+    if (view == nullptr || !readonly) {
+        return view;
+    }
+
+    PyObject *result = PyObject_CallMethod(view, "toreadonly", nullptr);
+    Py_DECREF(view);
+    return result;
+}
+
+static PyObject *DoubleArrayList_resize(PyObject *pySelf, PyObject *pySize) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (!DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    if (!PyLong_Check(pySize)) {
+        PyErr_SetString(PyExc_TypeError, "Expected an int object.");
+        return nullptr;
+    }
+
+    Py_ssize_t pySSize = PyLong_AsSsize_t(pySize);
+    if (pySSize < 0) {
+        PyErr_SetString(PyExc_ValueError, "Invalid size.");
+        return nullptr;
+    }
+
+    try {
+        self->vector.resize(static_cast<size_t>(pySSize));
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *DoubleArrayList_to_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    const auto size = static_cast<Py_ssize_t>(self->vector.size());
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *item = PyFloat_FromDouble(self->vector[i]);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+
+        PyList_SET_ITEM(result, i, item);  // PyList_SET_ITEM handle this ref
+    }
+
+    return result;
+}
+
+static PyObject *DoubleArrayList_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    auto *copy = Py_CreateObj<DoubleArrayList>(DoubleArrayListType);
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    try {
+        copy->vector = self->vector;
+    } catch (const std::exception &e) {
+        Py_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *DoubleArrayList_append(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (!DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    double value;
+    if (!DoubleArrayList_asValue(object, value)) {
+        return nullptr;
+    }
+
+    try {
+        self->vector.push_back(value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+/**
+ * Append every element of iterable to self.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool DoubleArrayList_extendIterable(DoubleArrayList *self, PyObject *iterable) {
+    // fast extend
+    if (Py_TYPE(iterable) == &DoubleArrayListType) {
+        auto *iter = reinterpret_cast<DoubleArrayList *>(iterable);
+        self->vector.insert(self->vector.end(), iter->vector.begin(), iter->vector.end());
+        return true;
+    }
+
+    // python iterable extend
+    PyObject *iter = PyObject_GetIter(iterable);
+    if (iter == nullptr) {
+        return false;
+    }
+
+    // pre alloc
+    Py_ssize_t hint = PyObject_LengthHint(iterable, 0);
+    if (hint > 0) {
+        self->vector.reserve(self->vector.size() + hint);
+    }
+
+    // do extend
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        double value;
+        const bool success = DoubleArrayList_asValue(item, value);
+        SAFE_DECREF(item);
+
+        if (!success) {
+            SAFE_DECREF(iter);
+            return false;
+        }
+
+        self->vector.push_back(value);
+    }
+
+    SAFE_DECREF(iter);
+    return !PyErr_Occurred();
+}
+
+static PyObject *DoubleArrayList_extend(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (!DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    // FASTCALL ensure args != nullptr
+    if (nargs != 1) {
+        PyErr_SetString(PyExc_TypeError, "extend() takes exactly one argument");
+        return nullptr;
+    }
+
+    try {
+        if (!DoubleArrayList_extendIterable(self, args[0])) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *DoubleArrayList_pop(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from empty list");
+        return nullptr;
+    }
+
+    if (!DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    Py_ssize_t index = vecSize - 1;
+
+    if (nargs == 1) {
+        index = PyLong_AsSsize_t(args[0]);
+        if (index == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+
+        if (index < 0) {
+            index += vecSize;
+        }
+
+        if (index < 0 || index >= vecSize) {
+            PyErr_SetString(PyExc_IndexError, "index out of range");
+            return nullptr;
+        }
+    } else if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "pop() takes at most 1 argument");
+        return nullptr;
+    }
+
+    const auto popped = self->vector[static_cast<size_t>(index)];
+    self->vector.erase(self->vector.begin() + index);
+
+    return PyFloat_FromDouble(popped);
+}
+
+static PyObject *DoubleArrayList_index(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    double value;
+    Py_ssize_t start = 0;
+    auto stop = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (!PyArg_ParseTuple(args, "d|nn", &value, &start, &stop)) {
+        return nullptr;
+    }
+
+    if (start < 0) {
+        start += static_cast<Py_ssize_t>(self->vector.size());
+    }
+    if (stop < 0) {
+        stop += static_cast<Py_ssize_t>(self->vector.size());
+    }
+
+    if (start < 0) {
+        start = 0;
+    }
+    if (stop > static_cast<Py_ssize_t>(self->vector.size())) {
+        stop = static_cast<Py_ssize_t>(self->vector.size());
+    }
+
+    if (start > stop) {
+        PyErr_SetString(PyExc_ValueError, "start index cannot be greater than stop index.");
+        return nullptr;
+    }
+
+    // compared as doubles, like the python floats the elements turn into
+    const auto begin = self->vector.begin();
+    const auto found = std::find(begin + start, begin + stop, value);
+
+    if (found == begin + stop) {
+        PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+        return nullptr;
+    }
+
+    return PyLong_FromSsize_t(found - begin);
+}
+
+static PyObject *DoubleArrayList_count(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    const double value = PyFloat_AsDouble(object);
+    if (value == -1.0 && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    return PyLong_FromSsize_t(std::count(self->vector.begin(), self->vector.end(), value));
+}
+
+static PyObject *DoubleArrayList_insert(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (!DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    Py_ssize_t index;
+    double value;
+
+    if (!PyArg_ParseTuple(args, "nd", &index, &value)) {
+        return nullptr;
+    }
+
+    // fix index
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    if (index < 0) {
+        index = std::max(static_cast<Py_ssize_t>(0), vecSize + index);
+    } else if (index > vecSize) {
+        index = vecSize;
+    }
+
+    // do insert
+    try {
+        self->vector.insert(self->vector.begin() + index, static_cast<double>(value));
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *DoubleArrayList_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (!DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    const double value = PyFloat_AsDouble(object);
+    if (value == -1.0 && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    const auto found = std::find(self->vector.begin(), self->vector.end(), value);
+    if (found == self->vector.end()) {
+        PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+        return nullptr;
+    }
+    self->vector.erase(found);
+
+    Py_RETURN_NONE;
+}
+
+/**
+ * Parse the algorithm argument of sort(), None means auto.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool DoubleArrayList_parseSortAlgorithm(const char *name, simd::SortAlgorithm &algorithm) {
+    if (name == nullptr || strcmp(name, "auto") == 0) {
+        algorithm = simd::SortAlgorithm::AUTO;
+    } else if (strcmp(name, "bitonic") == 0) {
+        algorithm = simd::SortAlgorithm::BITONIC;
+    } else if (strcmp(name, "radix") == 0) {
+        algorithm = simd::SortAlgorithm::RADIX;
+    } else {
+        PyErr_Format(PyExc_ValueError, "algorithm must be 'auto', 'bitonic' or 'radix', got '%s'", name);
+        return false;
+    }
+    return true;
+}
+
+static PyObject *DoubleArrayList_sort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    PyObject *keyFunc = Py_None;
+    int reverse = 0;  // default: false
+    const char *algorithmName = nullptr;  // default: auto
+    static constexpr const char *kwlist[] = {"key", "reverse", "algorithm", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Op$s", const_cast<char **>(kwlist),
+                                     &keyFunc, &reverse, &algorithmName)) {
+        return nullptr;
+    }
+
+    simd::SortAlgorithm algorithm;
+    if (!DoubleArrayList_parseSortAlgorithm(algorithmName, algorithm)) {
+        return nullptr;
+    }
+
+    // do sort
+    try {
+        if (keyFunc == Py_None) {
+            // exceptions can't leave the block without the GIL, so rethrow them after it
+            std::exception_ptr error;
+            Py_BEGIN_ALLOW_THREADS
+                try {
+                    simd::simdsort(self->vector.data(), self->vector.size(), reverse, algorithm);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            Py_END_ALLOW_THREADS
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        } else if (!KeySort_sort(self->vector, keyFunc, reverse,
+                                 [](const double value) { return PyFloat_FromDouble(value); },
+                                 [](PyObject *item) { return static_cast<double>(PyFloat_AS_DOUBLE(item)); })) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *DoubleArrayList_argsort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    int reverse = 0;  // default: false
+    int stable = 1;  // default: true
+    static constexpr const char *kwlist[] = {"reverse", "stable", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|pp", const_cast<char **>(kwlist), &reverse, &stable)) {
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    if (size > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "list is too large to be indexed by an IntArrayList");
+        return nullptr;
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(size);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::argsort(self->vector.data(), size, reverse, stable, result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static Py_ssize_t DoubleArrayList_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->vector.size());
+}
+
+static PyObject *DoubleArrayList_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    auto iter = DoubleArrayListIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *DoubleArrayList_getitem(PyObject *pySelf, Py_ssize_t pyIndex) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    auto size = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (pyIndex < 0) {
+        pyIndex = size + pyIndex;
+    }
+
+    if (pyIndex < 0 || pyIndex >= size) {
+        PyErr_SetString(PyExc_IndexError, "index out of range.");
+        return nullptr;
+    }
+
+    return PyFloat_FromDouble(self->vector[static_cast<size_t>(pyIndex)]);
+}
+
+static PyObject *DoubleArrayList_getitem_slice(PyObject *pySelf, PyObject *slice) {
+    if (PyIndex_Check(slice)) {
+        Py_ssize_t pyIndex = PyNumber_AsSsize_t(slice, PyExc_IndexError);
+        if (pyIndex == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        return DoubleArrayList_getitem(pySelf, pyIndex);
+    }
+
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    Py_ssize_t start, stop, step, sliceLength;
+    if (PySlice_Unpack(slice, &start, &stop, &step) < 0) {
+        return nullptr;
+    }
+
+    sliceLength = PySlice_AdjustIndices(static_cast<Py_ssize_t>(self->vector.size()), &start, &stop, step);
+
+    PyObject *result = PyList_New(sliceLength);
+    if (!result) {
+        return nullptr;
+    }
+
+    for (Py_ssize_t i = 0; i < sliceLength; i++) {
+        Py_ssize_t index = start + i * step;
+        PyObject *item = PyFloat_FromDouble(self->vector[static_cast<size_t>(index)]);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+    return result;
+}
+
+static int DoubleArrayList_setitem(PyObject *pySelf, Py_ssize_t pyIndex, PyObject *pyValue) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    auto size = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (pyIndex < 0) {
+        pyIndex = size + pyIndex;
+    }
+    if (pyIndex < 0 || pyIndex >= size) {
+        PyErr_SetString(PyExc_IndexError, "index out of range.");
+        return -1;
+    }
+
+    if (pyValue == nullptr) {
+        if (!DoubleArrayList_checkResizable(self)) {
+            return -1;
+        }
+        self->vector.erase(self->vector.begin() + pyIndex);
+        return 0;
+    }
+
+    double value;
+    if (!DoubleArrayList_asValue(pyValue, value)) {
+        return -1;
+    }
+    self->vector[static_cast<size_t>(pyIndex)] = value;
+    return 0;
+}
+
+static int DoubleArrayList_setitem_slice(PyObject *pySelf, PyObject *slice, PyObject *value) {
+    if (PyIndex_Check(slice)) {
+        Py_ssize_t index = PyNumber_AsSsize_t(slice, PyExc_IndexError);
+        if (index == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        return DoubleArrayList_setitem(pySelf, index, value);
+    }
+
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    Py_ssize_t start, stop, step, sliceLength;
+    if (PySlice_Unpack(slice, &start, &stop, &step) < 0) {
+        return -1;
+    }
+
+    sliceLength = PySlice_AdjustIndices(static_cast<Py_ssize_t>(self->vector.size()), &start, &stop, step);
+
+    if (step != 1) {
+        PyErr_SetString(PyExc_NotImplementedError, "step must be 1 for slice assignment");
+        return -1;
+    }
+
+    // convert everything first, so a bad element leaves the list unchanged
+    std::vector<double> values;
+    if (value != nullptr) {
+        PyObject *fast = PySequence_Fast(value, "can only assign an iterable");
+        if (fast == nullptr) {
+            return -1;
+        }
+
+        const Py_ssize_t newLength = PySequence_Fast_GET_SIZE(fast);
+        PyObject **items = PySequence_Fast_ITEMS(fast);
+        try {
+            values.resize(static_cast<size_t>(newLength));
+        } catch (const std::exception &e) {
+            SAFE_DECREF(fast);
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return -1;
+        }
+        for (Py_ssize_t i = 0; i < newLength; ++i) {
+            if (!DoubleArrayList_asValue(items[i], values[i])) {
+                SAFE_DECREF(fast);
+                return -1;
+            }
+        }
+        SAFE_DECREF(fast);
+    }
+
+    const auto newLength = static_cast<Py_ssize_t>(values.size());
+    if (newLength != sliceLength && !DoubleArrayList_checkResizable(self)) {
+        return -1;
+    }
+
+    try {
+        const auto begin = self->vector.begin() + start;
+        if (newLength <= sliceLength) {
+            std::copy(values.begin(), values.end(), begin);
+            self->vector.erase(begin + newLength, begin + sliceLength);
+        } else {
+            std::copy(values.begin(), values.begin() + sliceLength, begin);
+            self->vector.insert(begin + sliceLength, values.begin() + sliceLength, values.end());
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
+static PyObject *DoubleArrayList_add(PyObject *pySelf, PyObject *pyValue) {
+    if (Py_TYPE(pyValue) == &DoubleArrayListType) {
+        // fast add -> DoubleArrayList
+        auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+        auto *value = reinterpret_cast<DoubleArrayList *>(pyValue);
+
+        auto *result = Py_CreateObj<DoubleArrayList>(DoubleArrayListType);
+        if (result == nullptr) {
+            return PyErr_NoMemory();
+        }
+
+        try {
+            result->vector.reserve(self->vector.size() + value->vector.size());
+            result->vector.insert(result->vector.end(), self->vector.begin(), self->vector.end());
+            result->vector.insert(result->vector.end(), value->vector.begin(), value->vector.end());
+            return reinterpret_cast<PyObject *>(result);
+        } catch (const std::exception &e) {
+            SAFE_DECREF(result);
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return nullptr;
+        }
+    }
+
+    // add -> list[float]
+    PyObject *selfList = DoubleArrayList_to_list(pySelf);
+    if (selfList == nullptr) {
+        return nullptr;
+    }
+
+    PyObject *result = PySequence_Concat(selfList, pyValue);
+    SAFE_DECREF(selfList);
+    return result;
+}
+
+static PyObject *DoubleArrayList_iadd(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (!DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    try {
+        if (!DoubleArrayList_extendIterable(self, iterable)) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *DoubleArrayList_mul(PyObject *pySelf, Py_ssize_t n) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (n < 0) {
+        n = 0;
+    }
+
+    auto *result = Py_CreateObj<DoubleArrayList>(DoubleArrayListType);
+    if (result == nullptr) {
+        return PyErr_NoMemory();
+    }
+
+    if (n == 0) {
+        return reinterpret_cast<PyObject *>(result);
+    }
+
+    try {
+        const auto selfSize = self->vector.size();
+
+        result->vector.resize(selfSize * n);
+        Py_BEGIN_ALLOW_THREADS
+            for (Py_ssize_t i = 0; i < n; ++i) {
+                simd::simdMemCpy(self->vector.data(), result->vector.data() + selfSize * i, selfSize);
+            }
+        Py_END_ALLOW_THREADS
+
+        return reinterpret_cast<PyObject *>(result);
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static PyObject *DoubleArrayList_rmul(PyObject *pySelf, PyObject *pyValue) {
+    if (PyLong_Check(pyValue)) {
+        Py_ssize_t n = PyLong_AsSsize_t(pyValue);
+        if (PyErr_Occurred()) {
+            return nullptr;
+        }
+
+        return DoubleArrayList_mul(pySelf, n);
+    }
+
+    PyErr_SetString(PyExc_TypeError, "Expected an integer on the left-hand side of *");
+    return nullptr;
+}
+
+static PyObject *DoubleArrayList_imul(PyObject *pySelf, Py_ssize_t n) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (n < 0) {
+        n = 0;
+    }
+
+    if (n != 1 && !DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    try {
+        if (n == 0) {
+            self->vector.clear();
+        } else {
+            const auto selfSize = self->vector.size();
+
+            self->vector.resize(selfSize * n);
+            Py_BEGIN_ALLOW_THREADS
+                for (Py_ssize_t i = 1; i < n; ++i) {
+                    simd::simdMemCpy(
+                            self->vector.data(),
+                            self->vector.data() + selfSize * i,
+                            selfSize
+                    );
+                }
+            Py_END_ALLOW_THREADS
+        }
+
+        Py_INCREF(pySelf);
+        return pySelf;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static int DoubleArrayList_contains(PyObject *pySelf, PyObject *key) {
+    if (!PyFloat_Check(key) && !PyLong_Check(key)) {
+        return 0;
+    }
+
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    const double value = PyFloat_AsDouble(key);
+    if (value == -1.0 && PyErr_Occurred()) {
+        // an int too large for a double can't equal any element
+        PyErr_Clear();
+        return 0;
+    }
+
+    return std::find(self->vector.begin(), self->vector.end(), value) != self->vector.end() ? 1 : 0;
+}
+
+static PyObject *DoubleArrayList_reversed(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    auto iter = DoubleArrayListIter_create(self, true);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *DoubleArrayList_reverse(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    Py_BEGIN_ALLOW_THREADS
+        simd::simdReverse(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    Py_RETURN_NONE;
+}
+
+static PyObject *DoubleArrayList_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (!DoubleArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    self->vector.clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *DoubleArrayList_sum(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    double result;
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdSum(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyFloat_FromDouble(result);
+}
+
+static PyObject *DoubleArrayList_min(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "min() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<double> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyFloat_FromDouble(result.min);
+}
+
+static PyObject *DoubleArrayList_max(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "max() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<double> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyFloat_FromDouble(result.max);
+}
+
+static PyObject *DoubleArrayList_minmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "minmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<double> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+
+    PyObject *min = PyFloat_FromDouble(result.min);
+    if (min == nullptr) {
+        return nullptr;
+    }
+    PyObject *max = PyFloat_FromDouble(result.max);
+    if (max == nullptr) {
+        Py_DECREF(min);
+        return nullptr;
+    }
+
+    PyObject *tuple = PyTuple_Pack(2, min, max);
+    Py_DECREF(min);
+    Py_DECREF(max);
+    return tuple;
+}
+
+/**
+ * The first index of value, or of the first NaN if value is NaN.
+ */
+static __forceinline size_t DoubleArrayList_find(const DoubleArrayList *self, double value) {
+    const auto &vector = self->vector;
+    if (std::isnan(value)) {
+        return std::find_if(vector.begin(), vector.end(), [](double element) { return std::isnan(element); })
+               - vector.begin();
+    }
+    return std::find(vector.begin(), vector.end(), value) - vector.begin();
+}
+
+static PyObject *DoubleArrayList_argmin(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmin() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the min, the first NaN if there is one
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        index = DoubleArrayList_find(self, simd::simdMinMax(self->vector.data(), self->vector.size()).min);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *DoubleArrayList_argmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the max, the first NaN if there is one
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        index = DoubleArrayList_find(self, simd::simdMinMax(self->vector.data(), self->vector.size()).max);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *DoubleArrayList_dot(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    FloatBuffer buffer;
+    if (!FloatBuffer_open(other, buffer)) {
+        return nullptr;
+    }
+
+    if (buffer.size != self->vector.size()) {
+        FloatBuffer_release(buffer);
+        PyErr_SetString(PyExc_ValueError, "dot() arguments must have the same length");
+        return nullptr;
+    }
+
+    double result;
+    Py_BEGIN_ALLOW_THREADS
+        if (buffer.doubles != nullptr) {
+            result = simd::simdDot(self->vector.data(), buffer.doubles, buffer.size);
+        } else {
+            // mixed precision is rare enough to not need its own kernel
+            result = 0;
+            for (size_t i = 0; i < buffer.size; ++i) {
+                result += static_cast<double>(self->vector[i]) * static_cast<double>(buffer.floats[i]);
+            }
+        }
+    Py_END_ALLOW_THREADS
+
+    FloatBuffer_release(buffer);
+    return PyFloat_FromDouble(result);
+}
+
+static PyObject *DoubleArrayList_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    if (Py_TYPE(pyValue) != &DoubleArrayListType) {
+        if (!PySequence_Check(pyValue))
+            Py_RETURN_FALSE;
+
+        // for others, compare like two lists of python floats
+        PyObject *selfList = DoubleArrayList_to_list(pySelf);
+        if (selfList == nullptr) {
+            return nullptr;
+        }
+        PyObject *valueList = PySequence_List(pyValue);
+        if (valueList == nullptr) {
+            SAFE_DECREF(selfList);
+            return nullptr;
+        }
+
+        PyObject *result = PyObject_RichCompare(selfList, valueList, op);
+        SAFE_DECREF(selfList);
+        SAFE_DECREF(valueList);
+        return result;
+    }
+
+    // fast compare, the first elements that differ decide, like list; NaN never equals anything
+    const auto &a = self->vector;
+    const auto &b = reinterpret_cast<DoubleArrayList *>(pyValue)->vector;
+    const auto [itA, itB] = std::mismatch(a.begin(), a.end(), b.begin(), b.end());
+
+    if (itA == a.end() || itB == b.end()) {
+        switch (op) {
+            case Py_EQ: Py_RETURN_BOOL(a.size() == b.size())
+            case Py_NE: Py_RETURN_BOOL(a.size() != b.size())
+            case Py_LT: Py_RETURN_BOOL(a.size() < b.size())
+            case Py_LE: Py_RETURN_BOOL(a.size() <= b.size())
+            case Py_GT: Py_RETURN_BOOL(a.size() > b.size())
+            case Py_GE: Py_RETURN_BOOL(a.size() >= b.size())
+            default:
+                break;
+        }
+    } else {
+        switch (op) {
+            case Py_EQ: Py_RETURN_FALSE;
+            case Py_NE: Py_RETURN_TRUE;
+            case Py_LT: Py_RETURN_BOOL(*itA < *itB)
+            case Py_LE: Py_RETURN_BOOL(*itA <= *itB)
+            case Py_GT: Py_RETURN_BOOL(*itA > *itB)
+            case Py_GE: Py_RETURN_BOOL(*itA >= *itB)
+            default:
+                break;
+        }
+    }
+
+    PyErr_SetString(PyExc_AssertionError, "Invalid comparison operation.");
+    return nullptr;
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *DoubleArrayList_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static __forceinline PyObject *DoubleArrayList_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    const auto &vec = self->vector;
+
+    if (vec.empty()) {
+        return PyUnicode_FromString("[]");
+    }
+
+    size_t size = vec.size();
+    auto str = std::string("[");
+    str.reserve(size * 8);
+
+    for (size_t i = 0; i < size; ++i) {
+        if (i != 0) {
+            str += ", ";
+        }
+
+        // same digits as repr(float)
+        char *buffer = PyOS_double_to_string(vec[i], 'r', 0, Py_DTSF_ADD_DOT_0, nullptr);
+        if (buffer == nullptr) {
+            return PyErr_NoMemory();
+        }
+        str += buffer;
+        PyMem_Free(buffer);
+    }
+
+    str += "]";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
+static PyObject *DoubleArrayList_str(PyObject *pySelf) {
+    return DoubleArrayList_repr(pySelf);
+}
+
+static int DoubleArrayList_get_buffer(PyObject *pySelf, Py_buffer *view, int flags) {
+    auto *self = reinterpret_cast<DoubleArrayList *>(pySelf);
+
+    // every export shares this shape, it can't change while any of them is alive
+    self->shape = static_cast<Py_ssize_t>(self->vector.size());
+
+    Py_INCREF(pySelf);
+    view->obj = pySelf;
+    view->buf = self->vector.data();
+    view->len = static_cast<Py_ssize_t>(self->vector.size() * sizeof(double));
+    view->itemsize = sizeof(double);
+    view->readonly = 0;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? const_cast<char *>("d") : nullptr;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? &self->shape : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &view->itemsize : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+
+    ++self->exports;
+    return 0;
+}
+
+static void DoubleArrayList_release_buffer(PyObject *pySelf, [[maybe_unused]] Py_buffer *view) {
+    --reinterpret_cast<DoubleArrayList *>(pySelf)->exports;
+}
+
+static PyMethodDef DoubleArrayList_methods[] = {
+        {"frombuffer", (PyCFunction) DoubleArrayList_frombuffer, METH_O | METH_STATIC},
+        {"view", (PyCFunction) DoubleArrayList_view, METH_VARARGS | METH_KEYWORDS},
+        {"resize", (PyCFunction) DoubleArrayList_resize, METH_O},
+        {"to_list", (PyCFunction) DoubleArrayList_to_list, METH_NOARGS},
+        {"copy", (PyCFunction) DoubleArrayList_copy, METH_NOARGS},
+        {"append", (PyCFunction) DoubleArrayList_append, METH_O},
+        {"extend", (PyCFunction) DoubleArrayList_extend, METH_FASTCALL},
+        {"pop", (PyCFunction) DoubleArrayList_pop, METH_FASTCALL},
+        {"index", (PyCFunction) DoubleArrayList_index, METH_VARARGS},
+        {"count", (PyCFunction) DoubleArrayList_count, METH_O},
+        {"insert", (PyCFunction) DoubleArrayList_insert, METH_VARARGS},
+        {"remove", (PyCFunction) DoubleArrayList_remove, METH_O},
+        {"sort", (PyCFunction) DoubleArrayList_sort, METH_VARARGS | METH_KEYWORDS},
+        {"argsort", (PyCFunction) DoubleArrayList_argsort, METH_VARARGS | METH_KEYWORDS},
+        {"reverse", (PyCFunction) DoubleArrayList_reverse, METH_NOARGS},
+        {"clear", (PyCFunction) DoubleArrayList_clear, METH_NOARGS},
+        {"sum", (PyCFunction) DoubleArrayList_sum, METH_NOARGS},
+        {"min", (PyCFunction) DoubleArrayList_min, METH_NOARGS},
+        {"max", (PyCFunction) DoubleArrayList_max, METH_NOARGS},
+        {"minmax", (PyCFunction) DoubleArrayList_minmax, METH_NOARGS},
+        {"argmin", (PyCFunction) DoubleArrayList_argmin, METH_NOARGS},
+        {"argmax", (PyCFunction) DoubleArrayList_argmax, METH_NOARGS},
+        {"dot", (PyCFunction) DoubleArrayList_dot, METH_O},
+        {"__rmul__", (PyCFunction) DoubleArrayList_rmul, METH_O},
+        {"__reversed__", (PyCFunction) DoubleArrayList_reversed, METH_NOARGS},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) DoubleArrayList_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef DoubleArrayList_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.DoubleArrayList",
+        "An DoubleArrayList_module that creates an DoubleArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods DoubleArrayList_asSequence = {
+        DoubleArrayList_len,
+        DoubleArrayList_add,
+        DoubleArrayList_mul,
+        DoubleArrayList_getitem,
+        nullptr,
+        DoubleArrayList_setitem,
+        nullptr,
+        DoubleArrayList_contains,
+        DoubleArrayList_iadd,
+        DoubleArrayList_imul
+};
+
+static PyMappingMethods DoubleArrayList_asMapping = {
+        DoubleArrayList_len,
+        DoubleArrayList_getitem_slice,
+        DoubleArrayList_setitem_slice
+};
+
+static PyBufferProcs DoubleArrayList_asBuffer = {
+        DoubleArrayList_get_buffer,
+        DoubleArrayList_release_buffer
+};
+
+void initializeDoubleArrayListType(PyTypeObject &type) {
+    type.tp_name = "DoubleArrayList";
+    type.tp_basicsize = sizeof(DoubleArrayList);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &DoubleArrayList_asSequence;
+    type.tp_as_mapping = &DoubleArrayList_asMapping;
+    type.tp_iter = DoubleArrayList_iter;
+    type.tp_methods = DoubleArrayList_methods;
+    type.tp_init = (initproc) DoubleArrayList_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) DoubleArrayList_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = DoubleArrayList_compare;
+    type.tp_repr = DoubleArrayList_repr;
+    type.tp_str = DoubleArrayList_str;
+    type.tp_as_buffer = &DoubleArrayList_asBuffer;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_DoubleArrayList() {
+    initializeDoubleArrayListType(DoubleArrayListType);
+    if (PyType_Ready(&DoubleArrayListType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&DoubleArrayList_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&DoubleArrayListType);
+    if (PyModule_AddObject(object, "DoubleArrayList", (PyObject *) &DoubleArrayListType) < 0) {
+        Py_DECREF(&DoubleArrayListType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
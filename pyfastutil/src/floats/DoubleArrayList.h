@@ -0,0 +1,27 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#ifndef PYFASTUTIL_DOUBLEARRAYLIST_H
+#define PYFASTUTIL_DOUBLEARRAYLIST_H
+
+#include "utils/PythonPCH.h"
+#include "utils/memory/AlignedAllocator.h"
+#include <vector>
+
+extern "C" {
+typedef struct DoubleArrayList {
+    PyObject_HEAD;
+    // 64 bytes aligned like IntArrayList, for faster SIMD
+    std::vector<double, AlignedAllocator<double, 64>> vector;
+    Py_ssize_t shape = 0;
+    // live buffer exports, the vector must not be resized while there are any
+    Py_ssize_t exports = 0;
+} DoubleArrayList;
+
+extern PyTypeObject DoubleArrayListType;
+}
+
+PyMODINIT_FUNC PyInit_DoubleArrayList();
+
+#endif //PYFASTUTIL_DOUBLEARRAYLIST_H
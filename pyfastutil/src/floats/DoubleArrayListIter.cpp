@@ -0,0 +1,124 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#include "DoubleArrayListIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject DoubleArrayListIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+DoubleArrayListIter *DoubleArrayListIter_create(DoubleArrayList *list, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<DoubleArrayListIter>(DoubleArrayListIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(list);
+    instance->container = list;
+    if (reversed) {
+        instance->index = (!list->vector.empty()) ? list->vector.size() - 1 : 0;
+        instance->reversed = true;
+    } else {
+        instance->index = 0;
+        instance->reversed = false;
+    }
+
+    return instance;
+}
+
+static void DoubleArrayListIter_dealloc(DoubleArrayListIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *DoubleArrayListIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<DoubleArrayListIter *>(pySelf);
+
+    if (self->container->vector.empty()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    if (self->reversed) {
+        if (self->index == 0) {
+            // last iteration
+            double element = self->container->vector[self->index];
+            self->index = SIZE_MAX;
+            return PyFloat_FromDouble(element);
+        }
+        if (self->index == SIZE_MAX) {
+            // already finish iteration
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        double element = self->container->vector[self->index];
+        self->index--;
+        return PyFloat_FromDouble(element);
+    } else {
+        if (self->index >= self->container->vector.size()) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        double element = self->container->vector[self->index];
+        self->index++;
+        return PyFloat_FromDouble(element);
+    }
+}
+
+static PyObject *DoubleArrayListIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef DoubleArrayListIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef DoubleArrayListIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.DoubleArrayListIter",
+        "An DoubleArrayListIter_module that creates an DoubleArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeDoubleArrayListIterType(PyTypeObject &type) {
+    type.tp_name = "DoubleArrayListIter";
+    type.tp_basicsize = sizeof(DoubleArrayListIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = DoubleArrayListIter_iter;
+    type.tp_iternext = DoubleArrayListIter_next;
+    type.tp_methods = DoubleArrayListIter_methods;
+    type.tp_dealloc = (destructor) DoubleArrayListIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_DoubleArrayListIter() {
+    initializeDoubleArrayListIterType(DoubleArrayListIterType);
+    if (PyType_Ready(&DoubleArrayListIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&DoubleArrayListIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&DoubleArrayListIterType);
+    if (PyModule_AddObject(object, "DoubleArrayListIter", (PyObject *) &DoubleArrayListIterType) < 0) {
+        Py_DECREF(&DoubleArrayListIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#ifndef PYFASTUTIL_DOUBLEARRAYLISTITER_H
+#define PYFASTUTIL_DOUBLEARRAYLISTITER_H
+
+#include "utils/PythonPCH.h"
+#include "DoubleArrayList.h"
+
+extern "C" {
+typedef struct DoubleArrayListIter {
+    PyObject_HEAD;
+    DoubleArrayList *container;
+    size_t index;
+    bool reversed;
+} DoubleArrayListIter;
+
+DoubleArrayListIter *DoubleArrayListIter_create(DoubleArrayList *list, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_DoubleArrayListIter();
+
+#endif //PYFASTUTIL_DOUBLEARRAYLISTITER_H
@@ -0,0 +1,1362 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#include "FloatArrayList.h"
+#include <cmath>
+#include <climits>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+#include "utils/FloatBuffer.h"
+#include "utils/KeySort.h"
+#include "utils/simd/BitonicSort.h"
+#include "utils/simd/FloatSort.h"
+#include "utils/simd/SIMDUtils.h"
+#include "utils/simd/Reduction.h"
+#include "utils/memory/AlignedAllocator.h"
+#include "ints/IntArrayList.h"
+#include "floats/FloatArrayListIter.h"
+
+extern "C" {
+
+PyTypeObject FloatArrayListType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+/**
+ * Refuse to change the size while buffers are exported, their pointer and shape would go stale.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool FloatArrayList_checkResizable(const FloatArrayList *self) noexcept {
+    if (self->exports > 0) {
+        PyErr_SetString(PyExc_BufferError, "Existing exports of data: object cannot be re-sized");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Replace the elements of self with the elements of buffer, without boxing them.
+ */
+static void FloatArrayList_assignBuffer(FloatArrayList *self, const FloatBuffer &buffer) {
+    self->vector.resize(buffer.size);
+    if (buffer.floats != nullptr) {
+        simd::simdMemCpy(const_cast<float *>(buffer.floats), self->vector.data(), buffer.size);
+    } else {
+        // out of range doubles become inf, like numpy astype
+        std::copy(buffer.doubles, buffer.doubles + buffer.size, self->vector.begin());
+    }
+}
+
+/**
+ * Read a python float, or anything float() accepts without parsing a string.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool FloatArrayList_asValue(PyObject *object, float &value) noexcept {
+    const double result = PyFloat_AsDouble(object);
+    if (result == -1.0 && PyErr_Occurred()) {
+        return false;
+    }
+    value = static_cast<float>(result);
+    return true;
+}
+
+static __forceinline void FloatArrayList_parseArgs(PyObject *&args, PyObject *&kwargs, PyObject *&pyIterable,
+                                       Py_ssize_t &pySize) {
+    static constexpr const char *kwlist[] = {"iterable", "exceptSize", nullptr};
+
+    PyObject *arg1 = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|On", const_cast<char **>(kwlist), &arg1, &pySize)) {
+        return;
+    }
+
+    if (arg1 == nullptr) return;
+
+    if (PyLong_Check(arg1)) {
+        pySize = PyLong_AsSsize_t(arg1);
+    } else {
+        pyIterable = arg1;
+    }
+}
+
+static int FloatArrayList_init(FloatArrayList *self, PyObject *args, PyObject *kwargs) {
+    new(&self->vector) std::vector<float, AlignedAllocator<float, 64>>();
+
+    PyObject *pyIterable = nullptr;
+    Py_ssize_t pySize = -1;
+
+    FloatArrayList_parseArgs(args, kwargs, pyIterable, pySize);
+    if (PyErr_Occurred()) {
+        return -1;
+    }
+
+    // init vector
+    try {
+        if (pySize > 0) {
+            self->vector.reserve(static_cast<size_t>(pySize));
+        }
+
+        if (pyIterable != nullptr) {
+            if (Py_TYPE(pyIterable) == &FloatArrayListType) {  // FloatArrayList is a final class
+                auto *iter = reinterpret_cast<FloatArrayList *>(pyIterable);
+                self->vector = iter->vector;
+                return 0;
+            }
+
+            if (PyList_Check(pyIterable) || PyTuple_Check(pyIterable)) {  // fast operation
+                auto fastKeys = PySequence_Fast(pyIterable, "Shouldn't be happen (FloatArrayList).");
+                if (fastKeys == nullptr) {
+                    return -1;
+                }
+
+                const auto size = PySequence_Fast_GET_SIZE(fastKeys);
+                auto items = PySequence_Fast_ITEMS(fastKeys);
+                self->vector.reserve(static_cast<size_t>(size));
+                for (Py_ssize_t i = 0; i < size; ++i) {
+                    float value;
+                    if (!FloatArrayList_asValue(items[i], value)) {
+                        SAFE_DECREF(fastKeys);
+                        return -1;
+                    }
+                    self->vector.push_back(value);
+                }
+                SAFE_DECREF(fastKeys);
+                return 0;
+            }
+
+            if (PyObject_CheckBuffer(pyIterable)) {  // numpy arrays and other float buffers, no boxing
+                FloatBuffer buffer;
+                if (FloatBuffer_open(pyIterable, buffer)) {
+                    FloatArrayList_assignBuffer(self, buffer);
+                    FloatBuffer_release(buffer);
+                    return 0;
+                }
+                // other formats, like int arrays, are still iterable
+                PyErr_Clear();
+            }
+
+            PyObject *iter = PyObject_GetIter(pyIterable);
+            if (iter == nullptr) {
+                PyErr_SetString(PyExc_TypeError, "Arg '__iterable' is not iterable.");
+                return -1;
+            }
+
+            PyObject *item;
+            while ((item = PyIter_Next(iter)) != nullptr) {
+                float value;
+                const bool success = FloatArrayList_asValue(item, value);
+                SAFE_DECREF(item);
+                if (!success) {
+                    SAFE_DECREF(iter);
+                    return -1;
+                }
+                self->vector.push_back(value);
+            }
+            SAFE_DECREF(iter);
+            if (PyErr_Occurred()) return -1;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
+static void FloatArrayList_dealloc(FloatArrayList *self) {
+    self->vector.~vector();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *FloatArrayList_frombuffer([[maybe_unused]] PyObject *cls, PyObject *obj) {
+    FloatBuffer buffer;
+    if (!FloatBuffer_open(obj, buffer)) {
+        return nullptr;
+    }
+
+    auto *list = Py_CreateObj<FloatArrayList>(FloatArrayListType);
+    if (list == nullptr) {
+        FloatBuffer_release(buffer);
+        return nullptr;
+    }
+
+    try {
+        FloatArrayList_assignBuffer(list, buffer);
+    } catch (const std::exception &e) {
+        FloatBuffer_release(buffer);
+        Py_DECREF(list);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    FloatBuffer_release(buffer);
+    return reinterpret_cast<PyObject *>(list);
+}
+
+static PyObject *FloatArrayList_view(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    int readonly = 0;  // default: false
+    static constexpr const char *kwlist[] = {"readonly", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", const_cast<char **>(kwlist), &readonly)) {
+        return nullptr;
+    }
+
+    PyObject *view = PyMemoryView_FromObject(pySelf);
+    if (view == nullptr || !readonly) {
+        return view;
+    }
+
+    PyObject *result = PyObject_CallMethod(view, "toreadonly", nullptr);
+    Py_DECREF(view);
+    return result;
+}
+
+static PyObject *FloatArrayList_resize(PyObject *pySelf, PyObject *pySize) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (!FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    if (!PyLong_Check(pySize)) {
+        PyErr_SetString(PyExc_TypeError, "Expected an int object.");
+        return nullptr;
+    }
+
+    Py_ssize_t pySSize = PyLong_AsSsize_t(pySize);
+    if (pySSize < 0) {
+        PyErr_SetString(PyExc_ValueError, "Invalid size.");
+        return nullptr;
+    }
+
+    try {
+        self->vector.resize(static_cast<size_t>(pySSize));
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *FloatArrayList_to_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    const auto size = static_cast<Py_ssize_t>(self->vector.size());
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *item = PyFloat_FromDouble(self->vector[i]);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+
+        PyList_SET_ITEM(result, i, item);  // PyList_SET_ITEM handle this ref
+    }
+
+    return result;
+}
+
+static PyObject *FloatArrayList_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    auto *copy = Py_CreateObj<FloatArrayList>(FloatArrayListType);
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    try {
+        copy->vector = self->vector;
+    } catch (const std::exception &e) {
+        Py_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *FloatArrayList_append(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (!FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    float value;
+    if (!FloatArrayList_asValue(object, value)) {
+        return nullptr;
+    }
+
+    try {
+        self->vector.push_back(value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+/**
+ * Append every element of iterable to self.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool FloatArrayList_extendIterable(FloatArrayList *self, PyObject *iterable) {
+    // fast extend
+    if (Py_TYPE(iterable) == &FloatArrayListType) {
+        auto *iter = reinterpret_cast<FloatArrayList *>(iterable);
+        self->vector.insert(self->vector.end(), iter->vector.begin(), iter->vector.end());
+        return true;
+    }
+
+    // python iterable extend
+    PyObject *iter = PyObject_GetIter(iterable);
+    if (iter == nullptr) {
+        return false;
+    }
+
+    // pre alloc
+    Py_ssize_t hint = PyObject_LengthHint(iterable, 0);
+    if (hint > 0) {
+        self->vector.reserve(self->vector.size() + hint);
+    }
+
+    // do extend
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        float value;
+        const bool success = FloatArrayList_asValue(item, value);
+        SAFE_DECREF(item);
+
+        if (!success) {
+            SAFE_DECREF(iter);
+            return false;
+        }
+
+        self->vector.push_back(value);
+    }
+
+    SAFE_DECREF(iter);
+    return !PyErr_Occurred();
+}
+
+static PyObject *FloatArrayList_extend(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (!FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    // FASTCALL ensure args != nullptr
+    if (nargs != 1) {
+        PyErr_SetString(PyExc_TypeError, "extend() takes exactly one argument");
+        return nullptr;
+    }
+
+    try {
+        if (!FloatArrayList_extendIterable(self, args[0])) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *FloatArrayList_pop(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from empty list");
+        return nullptr;
+    }
+
+    if (!FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    Py_ssize_t index = vecSize - 1;
+
+    if (nargs == 1) {
+        index = PyLong_AsSsize_t(args[0]);
+        if (index == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+
+        if (index < 0) {
+            index += vecSize;
+        }
+
+        if (index < 0 || index >= vecSize) {
+            PyErr_SetString(PyExc_IndexError, "index out of range");
+            return nullptr;
+        }
+    } else if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "pop() takes at most 1 argument");
+        return nullptr;
+    }
+
+    const auto popped = self->vector[static_cast<size_t>(index)];
+    self->vector.erase(self->vector.begin() + index);
+
+    return PyFloat_FromDouble(popped);
+}
+
+static PyObject *FloatArrayList_index(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    double value;
+    Py_ssize_t start = 0;
+    auto stop = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (!PyArg_ParseTuple(args, "d|nn", &value, &start, &stop)) {
+        return nullptr;
+    }
+
+    if (start < 0) {
+        start += static_cast<Py_ssize_t>(self->vector.size());
+    }
+    if (stop < 0) {
+        stop += static_cast<Py_ssize_t>(self->vector.size());
+    }
+
+    if (start < 0) {
+        start = 0;
+    }
+    if (stop > static_cast<Py_ssize_t>(self->vector.size())) {
+        stop = static_cast<Py_ssize_t>(self->vector.size());
+    }
+
+    if (start > stop) {
+        PyErr_SetString(PyExc_ValueError, "start index cannot be greater than stop index.");
+        return nullptr;
+    }
+
+    // compared as doubles, like the python floats the elements turn into
+    const auto begin = self->vector.begin();
+    const auto found = std::find(begin + start, begin + stop, value);
+
+    if (found == begin + stop) {
+        PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+        return nullptr;
+    }
+
+    return PyLong_FromSsize_t(found - begin);
+}
+
+static PyObject *FloatArrayList_count(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    const double value = PyFloat_AsDouble(object);
+    if (value == -1.0 && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    return PyLong_FromSsize_t(std::count(self->vector.begin(), self->vector.end(), value));
+}
+
+static PyObject *FloatArrayList_insert(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (!FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    Py_ssize_t index;
+    double value;
+
+    if (!PyArg_ParseTuple(args, "nd", &index, &value)) {
+        return nullptr;
+    }
+
+    // fix index
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    if (index < 0) {
+        index = std::max(static_cast<Py_ssize_t>(0), vecSize + index);
+    } else if (index > vecSize) {
+        index = vecSize;
+    }
+
+    // do insert
+    try {
+        self->vector.insert(self->vector.begin() + index, static_cast<float>(value));
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *FloatArrayList_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (!FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    const double value = PyFloat_AsDouble(object);
+    if (value == -1.0 && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    const auto found = std::find(self->vector.begin(), self->vector.end(), value);
+    if (found == self->vector.end()) {
+        PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+        return nullptr;
+    }
+    self->vector.erase(found);
+
+    Py_RETURN_NONE;
+}
+
+/**
+ * Parse the algorithm argument of sort(), None means auto.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool FloatArrayList_parseSortAlgorithm(const char *name, simd::SortAlgorithm &algorithm) {
+    if (name == nullptr || strcmp(name, "auto") == 0) {
+        algorithm = simd::SortAlgorithm::AUTO;
+    } else if (strcmp(name, "bitonic") == 0) {
+        algorithm = simd::SortAlgorithm::BITONIC;
+    } else if (strcmp(name, "radix") == 0) {
+        algorithm = simd::SortAlgorithm::RADIX;
+    } else {
+        PyErr_Format(PyExc_ValueError, "algorithm must be 'auto', 'bitonic' or 'radix', got '%s'", name);
+        return false;
+    }
+    return true;
+}
+
+static PyObject *FloatArrayList_sort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    PyObject *keyFunc = Py_None;
+    int reverse = 0;  // default: false
+    const char *algorithmName = nullptr;  // default: auto
+    static constexpr const char *kwlist[] = {"key", "reverse", "algorithm", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Op$s", const_cast<char **>(kwlist),
+                                     &keyFunc, &reverse, &algorithmName)) {
+        return nullptr;
+    }
+
+    simd::SortAlgorithm algorithm;
+    if (!FloatArrayList_parseSortAlgorithm(algorithmName, algorithm)) {
+        return nullptr;
+    }
+
+    // do sort
+    try {
+        if (keyFunc == Py_None) {
+            // exceptions can't leave the block without the GIL, so rethrow them after it
+            std::exception_ptr error;
+            Py_BEGIN_ALLOW_THREADS
+                try {
+                    simd::simdsort(self->vector.data(), self->vector.size(), reverse, algorithm);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            Py_END_ALLOW_THREADS
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        } else if (!KeySort_sort(self->vector, keyFunc, reverse,
+                                 [](const float value) { return PyFloat_FromDouble(value); },
+                                 [](PyObject *item) { return static_cast<float>(PyFloat_AS_DOUBLE(item)); })) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *FloatArrayList_argsort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    int reverse = 0;  // default: false
+    int stable = 1;  // default: true
+    static constexpr const char *kwlist[] = {"reverse", "stable", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|pp", const_cast<char **>(kwlist), &reverse, &stable)) {
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    if (size > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "list is too large to be indexed by an IntArrayList");
+        return nullptr;
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(size);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::argsort(self->vector.data(), size, reverse, stable, result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static Py_ssize_t FloatArrayList_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->vector.size());
+}
+
+static PyObject *FloatArrayList_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    auto iter = FloatArrayListIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *FloatArrayList_getitem(PyObject *pySelf, Py_ssize_t pyIndex) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    auto size = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (pyIndex < 0) {
+        pyIndex = size + pyIndex;
+    }
+
+    if (pyIndex < 0 || pyIndex >= size) {
+        PyErr_SetString(PyExc_IndexError, "index out of range.");
+        return nullptr;
+    }
+
+    return PyFloat_FromDouble(self->vector[static_cast<size_t>(pyIndex)]);
+}
+
+static PyObject *FloatArrayList_getitem_slice(PyObject *pySelf, PyObject *slice) {
+    if (PyIndex_Check(slice)) {
+        Py_ssize_t pyIndex = PyNumber_AsSsize_t(slice, PyExc_IndexError);
+        if (pyIndex == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        return FloatArrayList_getitem(pySelf, pyIndex);
+    }
+
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    Py_ssize_t start, stop, step, sliceLength;
+    if (PySlice_Unpack(slice, &start, &stop, &step) < 0) {
+        return nullptr;
+    }
+
+    sliceLength = PySlice_AdjustIndices(static_cast<Py_ssize_t>(self->vector.size()), &start, &stop, step);
+
+    PyObject *result = PyList_New(sliceLength);
+    if (!result) {
+        return nullptr;
+    }
+
+    for (Py_ssize_t i = 0; i < sliceLength; i++) {
+        Py_ssize_t index = start + i * step;
+        PyObject *item = PyFloat_FromDouble(self->vector[static_cast<size_t>(index)]);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+    return result;
+}
+
+static int FloatArrayList_setitem(PyObject *pySelf, Py_ssize_t pyIndex, PyObject *pyValue) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    auto size = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (pyIndex < 0) {
+        pyIndex = size + pyIndex;
+    }
+    if (pyIndex < 0 || pyIndex >= size) {
+        PyErr_SetString(PyExc_IndexError, "index out of range.");
+        return -1;
+    }
+
+    if (pyValue == nullptr) {
+        if (!FloatArrayList_checkResizable(self)) {
+            return -1;
+        }
+        self->vector.erase(self->vector.begin() + pyIndex);
+        return 0;
+    }
+
+    float value;
+    if (!FloatArrayList_asValue(pyValue, value)) {
+        return -1;
+    }
+    self->vector[static_cast<size_t>(pyIndex)] = value;
+    return 0;
+}
+
+static int FloatArrayList_setitem_slice(PyObject *pySelf, PyObject *slice, PyObject *value) {
+    if (PyIndex_Check(slice)) {
+        Py_ssize_t index = PyNumber_AsSsize_t(slice, PyExc_IndexError);
+        if (index == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        return FloatArrayList_setitem(pySelf, index, value);
+    }
+
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    Py_ssize_t start, stop, step, sliceLength;
+    if (PySlice_Unpack(slice, &start, &stop, &step) < 0) {
+        return -1;
+    }
+
+    sliceLength = PySlice_AdjustIndices(static_cast<Py_ssize_t>(self->vector.size()), &start, &stop, step);
+
+    if (step != 1) {
+        PyErr_SetString(PyExc_NotImplementedError, "step must be 1 for slice assignment");
+        return -1;
+    }
+
+    // convert everything first, so a bad element leaves the list unchanged
+    std::vector<float> values;
+    if (value != nullptr) {
+        PyObject *fast = PySequence_Fast(value, "can only assign an iterable");
+        if (fast == nullptr) {
+            return -1;
+        }
+
+        const Py_ssize_t newLength = PySequence_Fast_GET_SIZE(fast);
+        PyObject **items = PySequence_Fast_ITEMS(fast);
+        try {
+            values.resize(static_cast<size_t>(newLength));
+        } catch (const std::exception &e) {
+            SAFE_DECREF(fast);
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return -1;
+        }
+        for (Py_ssize_t i = 0; i < newLength; ++i) {
+            if (!FloatArrayList_asValue(items[i], values[i])) {
+                SAFE_DECREF(fast);
+                return -1;
+            }
+        }
+        SAFE_DECREF(fast);
+    }
+
+    const auto newLength = static_cast<Py_ssize_t>(values.size());
+    if (newLength != sliceLength && !FloatArrayList_checkResizable(self)) {
+        return -1;
+    }
+
+    try {
+        const auto begin = self->vector.begin() + start;
+        if (newLength <= sliceLength) {
+            std::copy(values.begin(), values.end(), begin);
+            self->vector.erase(begin + newLength, begin + sliceLength);
+        } else {
+            std::copy(values.begin(), values.begin() + sliceLength, begin);
+            self->vector.insert(begin + sliceLength, values.begin() + sliceLength, values.end());
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
+static PyObject *FloatArrayList_add(PyObject *pySelf, PyObject *pyValue) {
+    if (Py_TYPE(pyValue) == &FloatArrayListType) {
+        // fast add -> FloatArrayList
+        auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+        auto *value = reinterpret_cast<FloatArrayList *>(pyValue);
+
+        auto *result = Py_CreateObj<FloatArrayList>(FloatArrayListType);
+        if (result == nullptr) {
+            return PyErr_NoMemory();
+        }
+
+        try {
+            result->vector.reserve(self->vector.size() + value->vector.size());
+            result->vector.insert(result->vector.end(), self->vector.begin(), self->vector.end());
+            result->vector.insert(result->vector.end(), value->vector.begin(), value->vector.end());
+            return reinterpret_cast<PyObject *>(result);
+        } catch (const std::exception &e) {
+            SAFE_DECREF(result);
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return nullptr;
+        }
+    }
+
+    // add -> list[float]
+    PyObject *selfList = FloatArrayList_to_list(pySelf);
+    if (selfList == nullptr) {
+        return nullptr;
+    }
+
+    PyObject *result = PySequence_Concat(selfList, pyValue);
+    SAFE_DECREF(selfList);
+    return result;
+}
+
+static PyObject *FloatArrayList_iadd(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (!FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    try {
+        if (!FloatArrayList_extendIterable(self, iterable)) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *FloatArrayList_mul(PyObject *pySelf, Py_ssize_t n) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (n < 0) {
+        n = 0;
+    }
+
+    auto *result = Py_CreateObj<FloatArrayList>(FloatArrayListType);
+    if (result == nullptr) {
+        return PyErr_NoMemory();
+    }
+
+    if (n == 0) {
+        return reinterpret_cast<PyObject *>(result);
+    }
+
+    try {
+        const auto selfSize = self->vector.size();
+
+        result->vector.resize(selfSize * n);
+        Py_BEGIN_ALLOW_THREADS
+            for (Py_ssize_t i = 0; i < n; ++i) {
+                simd::simdMemCpy(self->vector.data(), result->vector.data() + selfSize * i, selfSize);
+            }
+        Py_END_ALLOW_THREADS
+
+        return reinterpret_cast<PyObject *>(result);
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static PyObject *FloatArrayList_rmul(PyObject *pySelf, PyObject *pyValue) {
+    if (PyLong_Check(pyValue)) {
+        Py_ssize_t n = PyLong_AsSsize_t(pyValue);
+        if (PyErr_Occurred()) {
+            return nullptr;
+        }
+
+        return FloatArrayList_mul(pySelf, n);
+    }
+
+    PyErr_SetString(PyExc_TypeError, "Expected an integer on the left-hand side of *");
+    return nullptr;
+}
+
+static PyObject *FloatArrayList_imul(PyObject *pySelf, Py_ssize_t n) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (n < 0) {
+        n = 0;
+    }
+
+    if (n != 1 && !FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    try {
+        if (n == 0) {
+            self->vector.clear();
+        } else {
+            const auto selfSize = self->vector.size();
+
+            self->vector.resize(selfSize * n);
+            Py_BEGIN_ALLOW_THREADS
+                for (Py_ssize_t i = 1; i < n; ++i) {
+                    simd::simdMemCpy(
+                            self->vector.data(),
+                            self->vector.data() + selfSize * i,
+                            selfSize
+                    );
+                }
+            Py_END_ALLOW_THREADS
+        }
+
+        Py_INCREF(pySelf);
+        return pySelf;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static int FloatArrayList_contains(PyObject *pySelf, PyObject *key) {
+    if (!PyFloat_Check(key) && !PyLong_Check(key)) {
+        return 0;
+    }
+
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    const double value = PyFloat_AsDouble(key);
+    if (value == -1.0 && PyErr_Occurred()) {
+        // an int too large for a double can't equal any element
+        PyErr_Clear();
+        return 0;
+    }
+
+    return std::find(self->vector.begin(), self->vector.end(), value) != self->vector.end() ? 1 : 0;
+}
+
+static PyObject *FloatArrayList_reversed(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    auto iter = FloatArrayListIter_create(self, true);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *FloatArrayList_reverse(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    Py_BEGIN_ALLOW_THREADS
+        simd::simdReverse(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    Py_RETURN_NONE;
+}
+
+static PyObject *FloatArrayList_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (!FloatArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    self->vector.clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *FloatArrayList_sum(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    double result;
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdSum(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyFloat_FromDouble(result);
+}
+
+static PyObject *FloatArrayList_min(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "min() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<float> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyFloat_FromDouble(result.min);
+}
+
+static PyObject *FloatArrayList_max(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "max() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<float> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyFloat_FromDouble(result.max);
+}
+
+static PyObject *FloatArrayList_minmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "minmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<float> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+
+    PyObject *min = PyFloat_FromDouble(result.min);
+    if (min == nullptr) {
+        return nullptr;
+    }
+    PyObject *max = PyFloat_FromDouble(result.max);
+    if (max == nullptr) {
+        Py_DECREF(min);
+        return nullptr;
+    }
+
+    PyObject *tuple = PyTuple_Pack(2, min, max);
+    Py_DECREF(min);
+    Py_DECREF(max);
+    return tuple;
+}
+
+/**
+ * The first index of value, or of the first NaN if value is NaN.
+ */
+static __forceinline size_t FloatArrayList_find(const FloatArrayList *self, float value) {
+    const auto &vector = self->vector;
+    if (std::isnan(value)) {
+        return std::find_if(vector.begin(), vector.end(), [](float element) { return std::isnan(element); })
+               - vector.begin();
+    }
+    return std::find(vector.begin(), vector.end(), value) - vector.begin();
+}
+
+static PyObject *FloatArrayList_argmin(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmin() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the min, the first NaN if there is one
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        index = FloatArrayList_find(self, simd::simdMinMax(self->vector.data(), self->vector.size()).min);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *FloatArrayList_argmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the max, the first NaN if there is one
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        index = FloatArrayList_find(self, simd::simdMinMax(self->vector.data(), self->vector.size()).max);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *FloatArrayList_dot(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    FloatBuffer buffer;
+    if (!FloatBuffer_open(other, buffer)) {
+        return nullptr;
+    }
+
+    if (buffer.size != self->vector.size()) {
+        FloatBuffer_release(buffer);
+        PyErr_SetString(PyExc_ValueError, "dot() arguments must have the same length");
+        return nullptr;
+    }
+
+    double result;
+    Py_BEGIN_ALLOW_THREADS
+        if (buffer.floats != nullptr) {
+            result = simd::simdDot(self->vector.data(), buffer.floats, buffer.size);
+        } else {
+            // mixed precision is rare enough to not need its own kernel
+            result = 0;
+            for (size_t i = 0; i < buffer.size; ++i) {
+                result += static_cast<double>(self->vector[i]) * static_cast<double>(buffer.doubles[i]);
+            }
+        }
+    Py_END_ALLOW_THREADS
+
+    FloatBuffer_release(buffer);
+    return PyFloat_FromDouble(result);
+}
+
+static PyObject *FloatArrayList_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    if (Py_TYPE(pyValue) != &FloatArrayListType) {
+        if (!PySequence_Check(pyValue))
+            Py_RETURN_FALSE;
+
+        // for others, compare like two lists of python floats
+        PyObject *selfList = FloatArrayList_to_list(pySelf);
+        if (selfList == nullptr) {
+            return nullptr;
+        }
+        PyObject *valueList = PySequence_List(pyValue);
+        if (valueList == nullptr) {
+            SAFE_DECREF(selfList);
+            return nullptr;
+        }
+
+        PyObject *result = PyObject_RichCompare(selfList, valueList, op);
+        SAFE_DECREF(selfList);
+        SAFE_DECREF(valueList);
+        return result;
+    }
+
+    // fast compare, the first elements that differ decide, like list; NaN never equals anything
+    const auto &a = self->vector;
+    const auto &b = reinterpret_cast<FloatArrayList *>(pyValue)->vector;
+    const auto [itA, itB] = std::mismatch(a.begin(), a.end(), b.begin(), b.end());
+
+    if (itA == a.end() || itB == b.end()) {
+        switch (op) {
+            case Py_EQ: Py_RETURN_BOOL(a.size() == b.size())
+            case Py_NE: Py_RETURN_BOOL(a.size() != b.size())
+            case Py_LT: Py_RETURN_BOOL(a.size() < b.size())
+            case Py_LE: Py_RETURN_BOOL(a.size() <= b.size())
+            case Py_GT: Py_RETURN_BOOL(a.size() > b.size())
+            case Py_GE: Py_RETURN_BOOL(a.size() >= b.size())
+            default:
+                break;
+        }
+    } else {
+        switch (op) {
+            case Py_EQ: Py_RETURN_FALSE;
+            case Py_NE: Py_RETURN_TRUE;
+            case Py_LT: Py_RETURN_BOOL(*itA < *itB)
+            case Py_LE: Py_RETURN_BOOL(*itA <= *itB)
+            case Py_GT: Py_RETURN_BOOL(*itA > *itB)
+            case Py_GE: Py_RETURN_BOOL(*itA >= *itB)
+            default:
+                break;
+        }
+    }
+
+    PyErr_SetString(PyExc_AssertionError, "Invalid comparison operation.");
+    return nullptr;
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *FloatArrayList_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static __forceinline PyObject *FloatArrayList_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    const auto &vec = self->vector;
+
+    if (vec.empty()) {
+        return PyUnicode_FromString("[]");
+    }
+
+    size_t size = vec.size();
+    auto str = std::string("[");
+    str.reserve(size * 8);
+
+    for (size_t i = 0; i < size; ++i) {
+        if (i != 0) {
+            str += ", ";
+        }
+
+        // same digits as repr(float)
+        char *buffer = PyOS_double_to_string(vec[i], 'r', 0, Py_DTSF_ADD_DOT_0, nullptr);
+        if (buffer == nullptr) {
+            return PyErr_NoMemory();
+        }
+        str += buffer;
+        PyMem_Free(buffer);
+    }
+
+    str += "]";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
+static PyObject *FloatArrayList_str(PyObject *pySelf) {
+    return FloatArrayList_repr(pySelf);
+}
+
+static int FloatArrayList_get_buffer(PyObject *pySelf, Py_buffer *view, int flags) {
+    auto *self = reinterpret_cast<FloatArrayList *>(pySelf);
+
+    // every export shares this shape, it can't change while any of them is alive
+    self->shape = static_cast<Py_ssize_t>(self->vector.size());
+
+    Py_INCREF(pySelf);
+    view->obj = pySelf;
+    view->buf = self->vector.data();
+    view->len = static_cast<Py_ssize_t>(self->vector.size() * sizeof(float));
+    view->itemsize = sizeof(float);
+    view->readonly = 0;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? const_cast<char *>("f") : nullptr;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? &self->shape : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &view->itemsize : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+
+    ++self->exports;
+    return 0;
+}
+
+static void FloatArrayList_release_buffer(PyObject *pySelf, [[maybe_unused]] Py_buffer *view) {
+    --reinterpret_cast<FloatArrayList *>(pySelf)->exports;
+}
+
+static PyMethodDef FloatArrayList_methods[] = {
+        {"frombuffer", (PyCFunction) FloatArrayList_frombuffer, METH_O | METH_STATIC},
+        {"view", (PyCFunction) FloatArrayList_view, METH_VARARGS | METH_KEYWORDS},
+        {"resize", (PyCFunction) FloatArrayList_resize, METH_O},
+        {"to_list", (PyCFunction) FloatArrayList_to_list, METH_NOARGS},
+        {"copy", (PyCFunction) FloatArrayList_copy, METH_NOARGS},
+        {"append", (PyCFunction) FloatArrayList_append, METH_O},
+        {"extend", (PyCFunction) FloatArrayList_extend, METH_FASTCALL},
+        {"pop", (PyCFunction) FloatArrayList_pop, METH_FASTCALL},
+        {"index", (PyCFunction) FloatArrayList_index, METH_VARARGS},
+        {"count", (PyCFunction) FloatArrayList_count, METH_O},
+        {"insert", (PyCFunction) FloatArrayList_insert, METH_VARARGS},
+        {"remove", (PyCFunction) FloatArrayList_remove, METH_O},
+        {"sort", (PyCFunction) FloatArrayList_sort, METH_VARARGS | METH_KEYWORDS},
+        {"argsort", (PyCFunction) FloatArrayList_argsort, METH_VARARGS | METH_KEYWORDS},
+        {"reverse", (PyCFunction) FloatArrayList_reverse, METH_NOARGS},
+        {"clear", (PyCFunction) FloatArrayList_clear, METH_NOARGS},
+        {"sum", (PyCFunction) FloatArrayList_sum, METH_NOARGS},
+        {"min", (PyCFunction) FloatArrayList_min, METH_NOARGS},
+        {"max", (PyCFunction) FloatArrayList_max, METH_NOARGS},
+        {"minmax", (PyCFunction) FloatArrayList_minmax, METH_NOARGS},
+        {"argmin", (PyCFunction) FloatArrayList_argmin, METH_NOARGS},
+        {"argmax", (PyCFunction) FloatArrayList_argmax, METH_NOARGS},
+        {"dot", (PyCFunction) FloatArrayList_dot, METH_O},
+        {"__rmul__", (PyCFunction) FloatArrayList_rmul, METH_O},
+        {"__reversed__", (PyCFunction) FloatArrayList_reversed, METH_NOARGS},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) FloatArrayList_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef FloatArrayList_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.FloatArrayList",
+        "An FloatArrayList_module that creates an FloatArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods FloatArrayList_asSequence = {
+        FloatArrayList_len,
+        FloatArrayList_add,
+        FloatArrayList_mul,
+        FloatArrayList_getitem,
+        nullptr,
+        FloatArrayList_setitem,
+        nullptr,
+        FloatArrayList_contains,
+        FloatArrayList_iadd,
+        FloatArrayList_imul
+};
+
+static PyMappingMethods FloatArrayList_asMapping = {
+        FloatArrayList_len,
+        FloatArrayList_getitem_slice,
+        FloatArrayList_setitem_slice
+};
+
+static PyBufferProcs FloatArrayList_asBuffer = {
+        FloatArrayList_get_buffer,
+        FloatArrayList_release_buffer
+};
+
+void initializeFloatArrayListType(PyTypeObject &type) {
+    type.tp_name = "FloatArrayList";
+    type.tp_basicsize = sizeof(FloatArrayList);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &FloatArrayList_asSequence;
+    type.tp_as_mapping = &FloatArrayList_asMapping;
+    type.tp_iter = FloatArrayList_iter;
+    type.tp_methods = FloatArrayList_methods;
+    type.tp_init = (initproc) FloatArrayList_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) FloatArrayList_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = FloatArrayList_compare;
+    type.tp_repr = FloatArrayList_repr;
+    type.tp_str = FloatArrayList_str;
+    type.tp_as_buffer = &FloatArrayList_asBuffer;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_FloatArrayList() {
+    initializeFloatArrayListType(FloatArrayListType);
+    if (PyType_Ready(&FloatArrayListType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&FloatArrayList_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&FloatArrayListType);
+    if (PyModule_AddObject(object, "FloatArrayList", (PyObject *) &FloatArrayListType) < 0) {
+        Py_DECREF(&FloatArrayListType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,27 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#ifndef PYFASTUTIL_FLOATARRAYLIST_H
+#define PYFASTUTIL_FLOATARRAYLIST_H
+
+#include "utils/PythonPCH.h"
+#include "utils/memory/AlignedAllocator.h"
+#include <vector>
+
+extern "C" {
+typedef struct FloatArrayList {
+    PyObject_HEAD;
+    // 64 bytes aligned like IntArrayList, for faster SIMD
+    std::vector<float, AlignedAllocator<float, 64>> vector;
+    Py_ssize_t shape = 0;
+    // live buffer exports, the vector must not be resized while there are any
+    Py_ssize_t exports = 0;
+} FloatArrayList;
+
+extern PyTypeObject FloatArrayListType;
+}
+
+PyMODINIT_FUNC PyInit_FloatArrayList();
+
+#endif //PYFASTUTIL_FLOATARRAYLIST_H
@@ -0,0 +1,124 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#include "FloatArrayListIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject FloatArrayListIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+FloatArrayListIter *FloatArrayListIter_create(FloatArrayList *list, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<FloatArrayListIter>(FloatArrayListIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(list);
+    instance->container = list;
+    if (reversed) {
+        instance->index = (!list->vector.empty()) ? list->vector.size() - 1 : 0;
+        instance->reversed = true;
+    } else {
+        instance->index = 0;
+        instance->reversed = false;
+    }
+
+    return instance;
+}
+
+static void FloatArrayListIter_dealloc(FloatArrayListIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *FloatArrayListIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<FloatArrayListIter *>(pySelf);
+
+    if (self->container->vector.empty()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    if (self->reversed) {
+        if (self->index == 0) {
+            // last iteration
+            float element = self->container->vector[self->index];
+            self->index = SIZE_MAX;
+            return PyFloat_FromDouble(element);
+        }
+        if (self->index == SIZE_MAX) {
+            // already finish iteration
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        float element = self->container->vector[self->index];
+        self->index--;
+        return PyFloat_FromDouble(element);
+    } else {
+        if (self->index >= self->container->vector.size()) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        float element = self->container->vector[self->index];
+        self->index++;
+        return PyFloat_FromDouble(element);
+    }
+}
+
+static PyObject *FloatArrayListIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef FloatArrayListIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef FloatArrayListIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.FloatArrayListIter",
+        "An FloatArrayListIter_module that creates an FloatArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeFloatArrayListIterType(PyTypeObject &type) {
+    type.tp_name = "FloatArrayListIter";
+    type.tp_basicsize = sizeof(FloatArrayListIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = FloatArrayListIter_iter;
+    type.tp_iternext = FloatArrayListIter_next;
+    type.tp_methods = FloatArrayListIter_methods;
+    type.tp_dealloc = (destructor) FloatArrayListIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_FloatArrayListIter() {
+    initializeFloatArrayListIterType(FloatArrayListIterType);
+    if (PyType_Ready(&FloatArrayListIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&FloatArrayListIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&FloatArrayListIterType);
+    if (PyModule_AddObject(object, "FloatArrayListIter", (PyObject *) &FloatArrayListIterType) < 0) {
+        Py_DECREF(&FloatArrayListIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#ifndef PYFASTUTIL_FLOATARRAYLISTITER_H
+#define PYFASTUTIL_FLOATARRAYLISTITER_H
+
+#include "utils/PythonPCH.h"
+#include "FloatArrayList.h"
+
+extern "C" {
+typedef struct FloatArrayListIter {
+    PyObject_HEAD;
+    FloatArrayList *container;
+    size_t index;
+    bool reversed;
+} FloatArrayListIter;
+
+FloatArrayListIter *FloatArrayListIter_create(FloatArrayList *list, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_FloatArrayListIter();
+
+#endif //PYFASTUTIL_FLOATARRAYLISTITER_H
@@ -3,23 +3,64 @@
 //
 
 #include "BigIntArrayList.h"
+#include <climits>
+#include <cstring>
 #include <vector>
 #include <algorithm>
+#include <exception>
 #include <stdexcept>
 #include "utils/PythonUtils.h"
+#include "utils/IntBuffer.h"
+#include "utils/Permutation.h"
+#include "utils/KeySort.h"
 #include "utils/include/TimSort.h"
 #include "utils/simd/BitonicSort.h"
+#include "utils/simd/RadixSort.h"
 #include "utils/simd/SIMDUtils.h"
+#include "utils/simd/Reduction.h"
+#include "utils/simd/Search.h"
+#include "utils/simd/Select.h"
+#include "utils/simd/SetOps.h"
+#include "utils/simd/BinarySearch.h"
 #include "utils/memory/AlignedAllocator.h"
 #include "ints/BigIntArrayListIter.h"
-#include "utils/include/CPythonSort.h"
 
 extern "C" {
 
-static PyTypeObject BigIntArrayListType = {
+PyTypeObject BigIntArrayListType = {
         PyVarObject_HEAD_INIT(&PyType_Type, 0)
 };
 
+/**
+ * Refuse to change the size while buffers are exported, their pointer and shape would go stale.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool BigIntArrayList_checkResizable(const BigIntArrayList *self) noexcept {
+    if (self->exports > 0) {
+        PyErr_SetString(PyExc_BufferError, "Existing exports of data: object cannot be re-sized");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Replace the elements of self with the elements of buffer, without boxing them.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool BigIntArrayList_assignBuffer(BigIntArrayList *self, const IntBuffer &buffer) {
+    if (buffer.longs != nullptr) {
+        self->vector.resize(buffer.size);
+        simd::simdMemCpy(const_cast<long long *>(buffer.longs), self->vector.data(), buffer.size);
+        return true;
+    }
+
+    self->vector.resize(buffer.size);
+    std::copy(buffer.ints, buffer.ints + buffer.size, self->vector.begin());
+    return true;
+}
+
 __forceinline void parseArgs(PyObject *&args, PyObject *&kwargs, PyObject *&pyIterable, Py_ssize_t &pySize) {
     static constexpr const char *kwlist[] = {"iterable", "exceptSize", nullptr};
 
@@ -81,6 +122,17 @@ static int BigIntArrayList_init(BigIntArrayList *self, PyObject *args, PyObject
                 return 0;
             }
 
+            if (PyObject_CheckBuffer(pyIterable)) {  // numpy arrays and other int buffers, no boxing
+                IntBuffer buffer;
+                if (IntBuffer_open(pyIterable, buffer)) {
+                    const bool success = BigIntArrayList_assignBuffer(self, buffer);
+                    IntBuffer_release(buffer);
+                    return success ? 0 : -1;
+                }
+                // other formats, like bytes, are still iterable
+                PyErr_Clear();
+            }
+
             PyObject *iter = PyObject_GetIter(pyIterable);
             if (iter == nullptr) {
                 PyErr_SetString(PyExc_TypeError, "Arg '__iterable' is not iterable.");
@@ -157,9 +209,60 @@ static PyObject *BigIntArrayList_from_range([[maybe_unused]] PyObject *cls, PyOb
     return reinterpret_cast<PyObject *>(list);
 }
 
+static PyObject *BigIntArrayList_frombuffer([[maybe_unused]] PyObject *cls, PyObject *obj) {
+    IntBuffer buffer;
+    if (!IntBuffer_open(obj, buffer)) {
+        return nullptr;
+    }
+
+    auto *list = Py_CreateObj<BigIntArrayList>(BigIntArrayListType);
+    if (list == nullptr) {
+        IntBuffer_release(buffer);
+        return nullptr;
+    }
+
+    try {
+        if (!BigIntArrayList_assignBuffer(list, buffer)) {
+            IntBuffer_release(buffer);
+            Py_DECREF(list);
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        IntBuffer_release(buffer);
+        Py_DECREF(list);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    IntBuffer_release(buffer);
+    return reinterpret_cast<PyObject *>(list);
+}
+
+static PyObject *BigIntArrayList_view(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    int readonly = 0;  // default: false
+    static constexpr const char *kwlist[] = {"readonly", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", const_cast<char **>(kwlist), &readonly)) {
+        return nullptr;
+    }
+
+    PyObject *view = PyMemoryView_FromObject(pySelf);
+    if (view == nullptr || !readonly) {
+        return view;
+    }
+
+    PyObject *result = PyObject_CallMethod(view, "toreadonly", nullptr);
+    Py_DECREF(view);
+    return result;
+}
+
 static PyObject *BigIntArrayList_resize(PyObject *pySelf, PyObject *pySize) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
+    if (!BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     if (!PyLong_Check(pySize)) {
         PyErr_SetString(PyExc_TypeError, "Expected an int object.");
         return nullptr;
@@ -221,6 +324,10 @@ static PyObject *BigIntArrayList_copy(PyObject *pySelf) {
 static PyObject *BigIntArrayList_append(PyObject *pySelf, PyObject *object) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
+    if (!BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     long long value = PyLong_AsLongLong(object);
     if (PyErr_Occurred()) {
         return nullptr;
@@ -239,6 +346,10 @@ static PyObject *BigIntArrayList_append(PyObject *pySelf, PyObject *object) {
 static PyObject *BigIntArrayList_extend(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
+    if (!BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     // FASTCALL ensure args != nullptr
     if (nargs != 1) {
         PyErr_SetString(PyExc_TypeError, "extend() takes exactly one argument");
@@ -298,6 +409,10 @@ static PyObject *BigIntArrayList_pop(PyObject *pySelf, PyObject *const *args, co
         return nullptr;
     }
 
+    if (!BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
     Py_ssize_t index = vecSize - 1;
 
@@ -361,15 +476,15 @@ static PyObject *BigIntArrayList_index(PyObject *pySelf, PyObject *args) {
         return nullptr;
     }
 
-    auto it = std::find(self->vector.begin() + start, self->vector.begin() + stop, value);
+    const size_t index = static_cast<size_t>(start) + simd::simdFind(
+            self->vector.data() + start, static_cast<size_t>(stop - start), value);
 
-    if (it == self->vector.begin() + stop) {
+    if (index == static_cast<size_t>(stop)) {
         PyErr_SetString(PyExc_ValueError, "Value is not in list.");
         return nullptr;
     }
 
-    Py_ssize_t index = std::distance(self->vector.begin(), it);
-    return PyLong_FromSsize_t(index);
+    return PyLong_FromSize_t(index);
 }
 
 static PyObject *BigIntArrayList_count(PyObject *pySelf, PyObject *object) {
@@ -381,7 +496,7 @@ static PyObject *BigIntArrayList_count(PyObject *pySelf, PyObject *object) {
     }
 
     try {
-        size_t result = std::count(self->vector.begin(), self->vector.end(), value);
+        size_t result = simd::simdCount(self->vector.data(), self->vector.size(), value);
 
         return PyLong_FromSize_t(result);
     } catch (const std::exception &e) {
@@ -390,9 +505,55 @@ static PyObject *BigIntArrayList_count(PyObject *pySelf, PyObject *object) {
     }
 }
 
+static PyObject *BigIntArrayList_count_all(PyObject *pySelf, PyObject *pyValues) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    try {
+        std::vector<long long> needles;
+        if (!IntBuffer_collect(pyValues, needles)) {
+            return nullptr;
+        }
+
+        std::vector<size_t> counts(needles.size());
+        bool noMemory = false;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::simdCountAll(self->vector.data(), self->vector.size(),
+                                   needles.data(), needles.size(), counts.data());
+            } catch (const std::bad_alloc &) {
+                noMemory = true;
+            }
+        Py_END_ALLOW_THREADS
+        if (noMemory) {
+            return PyErr_NoMemory();
+        }
+
+        PyObject *pyResult = PyList_New(static_cast<Py_ssize_t>(counts.size()));
+        if (pyResult == nullptr) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < counts.size(); ++i) {
+            PyObject *count = PyLong_FromSize_t(counts[i]);
+            if (count == nullptr) {
+                Py_DECREF(pyResult);
+                return nullptr;
+            }
+            PyList_SET_ITEM(pyResult, static_cast<Py_ssize_t>(i), count);
+        }
+        return pyResult;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
 static PyObject *BigIntArrayList_insert(PyObject *pySelf, PyObject *args) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
+    if (!BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     Py_ssize_t index;
     long long value;
 
@@ -422,16 +583,20 @@ static PyObject *BigIntArrayList_insert(PyObject *pySelf, PyObject *args) {
 static PyObject *BigIntArrayList_remove(PyObject *pySelf, PyObject *object) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
+    if (!BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     long long value = PyLong_AsLongLong(object);
     if (PyErr_Occurred()) {
         return nullptr;
     }
 
     try {
-        auto it = std::find(self->vector.begin(), self->vector.end(), value);
+        const size_t index = simd::simdFind(self->vector.data(), self->vector.size(), value);
 
-        if (it != self->vector.end()) {
-            self->vector.erase(it);
+        if (index != self->vector.size()) {
+            self->vector.erase(self->vector.begin() + static_cast<Py_ssize_t>(index));
         } else {
             PyErr_SetString(PyExc_ValueError, "Value is not in list.");
             return nullptr;
@@ -444,14 +609,47 @@ static PyObject *BigIntArrayList_remove(PyObject *pySelf, PyObject *object) {
     Py_RETURN_NONE;
 }
 
+/**
+ * Parse the algorithm argument of sort(), None means auto.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool parseSortAlgorithm(const char *name, simd::SortAlgorithm &algorithm) {
+    if (name == nullptr || strcmp(name, "auto") == 0) {
+        algorithm = simd::SortAlgorithm::AUTO;
+    } else if (strcmp(name, "bitonic") == 0) {
+        algorithm = simd::SortAlgorithm::BITONIC;
+    } else if (strcmp(name, "radix") == 0) {
+        algorithm = simd::SortAlgorithm::RADIX;
+    } else {
+        PyErr_Format(PyExc_ValueError, "algorithm must be 'auto', 'bitonic' or 'radix', got '%s'", name);
+        return false;
+    }
+    return true;
+}
+
 static PyObject *BigIntArrayList_sort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
     PyObject *keyFunc = Py_None;
     int reverseInt = 0;  // default: false
-    static constexpr const char *kwlist[] = {"key", "reverse", nullptr};
+    int parallel = 0;  // default: false
+    Py_ssize_t threads = 0;  // default: one per hardware thread
+    const char *algorithmName = nullptr;  // default: auto
+    static constexpr const char *kwlist[] = {"key", "reverse", "parallel", "threads", "algorithm", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Oi$pns", const_cast<char **>(kwlist),
+                                     &keyFunc, &reverseInt, &parallel, &threads, &algorithmName)) {
+        return nullptr;
+    }
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Oi", const_cast<char **>(kwlist), &keyFunc, &reverseInt)) {
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError, "threads must be non-negative");
+        return nullptr;
+    }
+
+    simd::SortAlgorithm algorithm;
+    if (!parseSortAlgorithm(algorithmName, algorithm)) {
         return nullptr;
     }
 
@@ -461,31 +659,200 @@ static PyObject *BigIntArrayList_sort(PyObject *pySelf, PyObject *args, PyObject
     try {
         if (keyFunc == Py_None) {
             // simd sort with auto-fallback
+            // exceptions can't leave the block without the GIL, so rethrow them after it
+            const size_t size = self->vector.size();
+            std::exception_ptr error;
             Py_BEGIN_ALLOW_THREADS
-                simd::simdsort(self->vector, reverse);
+                try {
+                    if (parallel) {
+                        simd::simdsortParallel(self->vector, reverse, static_cast<size_t>(threads), algorithm);
+                    } else if (simd::resolveSortAlgorithm<long long>(algorithm, size) == simd::SortAlgorithm::RADIX) {
+                        simd::radixsort(self->vector, reverse);
+                    } else {
+                        simd::simdsort(self->vector, reverse);
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
             Py_END_ALLOW_THREADS
-        } else {
-            // sort with key function, costs extra memory
-            const auto vecSize = self->vector.size();
-            auto vecData = self->vector.data();
-            auto **pyData = static_cast<PyObject **>(PyMem_Malloc(sizeof(PyObject *) * vecSize));
-            if (pyData == nullptr) {
-                PyErr_NoMemory();
-                return nullptr;
+            if (error) {
+                std::rethrow_exception(error);
             }
+        } else if (!KeySort_sort(self->vector, keyFunc, reverse,
+                                 [](const long long value) { return PyLong_FromLongLong(value); },
+                                 [](PyObject *item) { return PyLong_AsLongLong(item); })) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
 
-            for (size_t i = 0; i < vecSize; ++i) {
-                pyData[i] = PyLong_FromLongLong(vecData[i]);
+    Py_RETURN_NONE;
+}
+
+static PyObject *BigIntArrayList_argsort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    int reverse = 0;  // default: false
+    int stable = 1;  // default: true
+    static constexpr const char *kwlist[] = {"reverse", "stable", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|pp", const_cast<char **>(kwlist), &reverse, &stable)) {
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    if (size > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "list is too large to be indexed by an IntArrayList");
+        return nullptr;
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(size);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::argsort(self->vector.data(), size, reverse, stable, result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
             }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *BigIntArrayList_sort_with(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    PyObject *other;
+    int reverse = 0;  // default: false
+    static constexpr const char *kwlist[] = {"other", "reverse", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p", const_cast<char **>(kwlist), &other, &reverse)) {
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    if (!Permutation_check(other, size)) {
+        return nullptr;
+    }
+    if (size > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "list is too large to be sorted with another list");
+        return nullptr;
+    }
+
+    try {
+        // sort a copy with its indices, so nothing changes until everything is allocated
+        std::vector<long long, AlignedAllocator<long long, 64>> sorted(size);
+        std::vector<int> indices(size);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::argsort(self->vector.data(), size, reverse, true, indices.data(), sorted.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        // self is already sorted by the copy below
+        if (other != pySelf) {
+            Permutation_apply(other, indices.data());
+        }
+        simd::simdMemCpy(sorted.data(), self->vector.data(), size);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
 
-            CPython_sort(pyData, static_cast<Py_ssize_t>(vecSize), keyFunc, reverseInt);
+    Py_RETURN_NONE;
+}
+
+static PyObject *BigIntArrayList_nth_element(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
-            for (size_t i = 0; i < vecSize; ++i) {
-                vecData[i] = PyLong_AsLongLong(pyData[i]);
-                Py_DECREF(pyData[i]);
+    Py_ssize_t k;
+    static constexpr const char *kwlist[] = {"k", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "n", const_cast<char **>(kwlist), &k)) {
+        return nullptr;
+    }
+
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    if (k < 0) {
+        k += vecSize;
+    }
+    if (k < 0 || k >= vecSize) {
+        PyErr_SetString(PyExc_IndexError, "index out of range");
+        return nullptr;
+    }
+
+    try {
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::simdNthElement(self->vector.data(), self->vector.size(), static_cast<size_t>(k));
+            } catch (...) {
+                error = std::current_exception();
             }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return PyLong_FromLongLong(self->vector[k]);
+}
+
+static PyObject *BigIntArrayList_partial_sort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    Py_ssize_t k;
+    int reverse = 0;  // default: false
+    static constexpr const char *kwlist[] = {"k", "reverse", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "n|p", const_cast<char **>(kwlist), &k, &reverse)) {
+        return nullptr;
+    }
 
-            PyMem_FREE(pyData);
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "k must not be negative");
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    const size_t count = std::min(static_cast<size_t>(k), size);
+
+    try {
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::simdPartialSort(self->vector.data(), size, count, reverse);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
         }
     } catch (const std::exception &e) {
         PyErr_SetString(PyExc_RuntimeError, e.what());
@@ -495,6 +862,344 @@ static PyObject *BigIntArrayList_sort(PyObject *pySelf, PyObject *args, PyObject
     Py_RETURN_NONE;
 }
 
+static PyObject *BigIntArrayList_top_k(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    Py_ssize_t k;
+    int reverse = 1;  // default: true
+    static constexpr const char *kwlist[] = {"k", "reverse", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "n|p", const_cast<char **>(kwlist), &k, &reverse)) {
+        return nullptr;
+    }
+
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "k must not be negative");
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    const size_t count = std::min(static_cast<size_t>(k), size);
+
+    auto *result = Py_CreateObj<BigIntArrayList>(BigIntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(count);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::simdTopK(self->vector.data(), size, count, reverse, result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+enum class SortedOp {
+    INTERSECT, UNION, DIFFERENCE, MERGE
+};
+
+static PyObject *BigIntArrayList_sortedOp(PyObject *pySelf, PyObject *pyOther, SortedOp op) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    if (Py_TYPE(pyOther) != &BigIntArrayListType) {
+        PyErr_SetString(PyExc_TypeError, "Expected an BigIntArrayList object.");
+        return nullptr;
+    }
+    auto *other = reinterpret_cast<BigIntArrayList *>(pyOther);
+
+    const size_t leftSize = self->vector.size();
+    const size_t rightSize = other->vector.size();
+    size_t capacity;
+    switch (op) {
+        case SortedOp::INTERSECT:
+            capacity = std::min(leftSize, rightSize) + simd::INTERSECT_PADDING;
+            break;
+        case SortedOp::DIFFERENCE:
+            capacity = leftSize;
+            break;
+        default:
+            capacity = leftSize + rightSize;
+            break;
+    }
+
+    auto *result = Py_CreateObj<BigIntArrayList>(BigIntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(capacity);
+        const long long *left = self->vector.data();
+        const long long *right = other->vector.data();
+        long long *out = result->vector.data();
+
+        size_t count = capacity;
+        Py_BEGIN_ALLOW_THREADS
+            switch (op) {
+                case SortedOp::INTERSECT:
+                    count = simd::sortedIntersect(left, leftSize, right, rightSize, out);
+                    break;
+                case SortedOp::UNION:
+                    count = simd::sortedUnion(left, leftSize, right, rightSize, out);
+                    break;
+                case SortedOp::DIFFERENCE:
+                    count = simd::sortedDifference(left, leftSize, right, rightSize, out);
+                    break;
+                case SortedOp::MERGE:
+                    simd::sortedMerge(left, leftSize, right, rightSize, out);
+                    break;
+            }
+        Py_END_ALLOW_THREADS
+        result->vector.resize(count);
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *BigIntArrayList_sorted_intersect(PyObject *pySelf, PyObject *pyOther) {
+    return BigIntArrayList_sortedOp(pySelf, pyOther, SortedOp::INTERSECT);
+}
+
+static PyObject *BigIntArrayList_sorted_union(PyObject *pySelf, PyObject *pyOther) {
+    return BigIntArrayList_sortedOp(pySelf, pyOther, SortedOp::UNION);
+}
+
+static PyObject *BigIntArrayList_sorted_difference(PyObject *pySelf, PyObject *pyOther) {
+    return BigIntArrayList_sortedOp(pySelf, pyOther, SortedOp::DIFFERENCE);
+}
+
+static PyObject *BigIntArrayList_merge(PyObject *pySelf, PyObject *pyOther) {
+    return BigIntArrayList_sortedOp(pySelf, pyOther, SortedOp::MERGE);
+}
+
+static PyObject *BigIntArrayList_merge_many(PyObject *Py_UNUSED(cls), PyObject *pyLists) {
+    PyObject *fast = PySequence_Fast(pyLists, "Expected an iterable of BigIntArrayList objects.");
+    if (fast == nullptr) {
+        return nullptr;
+    }
+
+    const Py_ssize_t listCount = PySequence_Fast_GET_SIZE(fast);
+    PyObject **lists = PySequence_Fast_ITEMS(fast);
+    std::vector<size_t> bounds;
+    bounds.reserve(static_cast<size_t>(listCount) + 1);
+    bounds.push_back(0);
+    for (Py_ssize_t i = 0; i < listCount; ++i) {
+        if (Py_TYPE(lists[i]) != &BigIntArrayListType) {
+            SAFE_DECREF(fast);
+            PyErr_SetString(PyExc_TypeError, "Expected an iterable of BigIntArrayList objects.");
+            return nullptr;
+        }
+        bounds.push_back(bounds.back() + reinterpret_cast<BigIntArrayList *>(lists[i])->vector.size());
+    }
+
+    auto *result = Py_CreateObj<BigIntArrayList>(BigIntArrayListType);
+    if (result == nullptr) {
+        SAFE_DECREF(fast);
+        return nullptr;
+    }
+
+    try {
+        result->vector.resize(bounds.back());
+        for (Py_ssize_t i = 0; i < listCount; ++i) {
+            const auto &vector = reinterpret_cast<BigIntArrayList *>(lists[i])->vector;
+            std::copy(vector.begin(), vector.end(), result->vector.begin() + static_cast<Py_ssize_t>(bounds[i]));
+        }
+        SAFE_DECREF(fast);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::sortedMergeRuns(result->vector.data(), bounds);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_XDECREF(fast);
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+/**
+ * Read a value to search for. Ints out of the element range still have a position,
+ * before every element (beyond = -1) or after all of them (beyond = 1).
+ * @return false with an exception set if pyValue isn't an int
+ */
+static bool BigIntArrayList_searchValue(PyObject *pyValue, long long &value, int &beyond) {
+    if (!PyLong_Check(pyValue)) {
+        PyErr_SetString(PyExc_TypeError, "Expected an int object.");
+        return false;
+    }
+
+    int overflow;
+    const long long wide = PyLong_AsLongLongAndOverflow(pyValue, &overflow);
+    if (wide == -1 && PyErr_Occurred()) {
+        return false;
+    }
+
+    beyond = overflow;
+    value = static_cast<long long>(wide);
+    return true;
+}
+
+static PyObject *BigIntArrayList_bisect(PyObject *pySelf, PyObject *args, PyObject *kwargs, bool right) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    PyObject *pyValue;
+    Py_ssize_t lo = 0;
+    PyObject *pyHi = Py_None;
+    static constexpr const char *kwlist[] = {"x", "lo", "hi", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|nO", const_cast<char **>(kwlist), &pyValue, &lo, &pyHi)) {
+        return nullptr;
+    }
+
+    if (lo < 0) {
+        PyErr_SetString(PyExc_ValueError, "lo must be non-negative");
+        return nullptr;
+    }
+
+    const auto size = static_cast<Py_ssize_t>(self->vector.size());
+    Py_ssize_t hi = size;
+    if (pyHi != Py_None) {
+        hi = PyLong_AsSsize_t(pyHi);
+        if (hi == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        hi = std::min(hi, size);
+    }
+
+    long long value;
+    int beyond;
+    if (!BigIntArrayList_searchValue(pyValue, value, beyond)) {
+        return nullptr;
+    }
+
+    if (lo >= hi || beyond < 0) {
+        return PyLong_FromSsize_t(lo);
+    }
+    if (beyond > 0) {
+        return PyLong_FromSsize_t(hi);
+    }
+
+    const long long *data = self->vector.data() + lo;
+    const auto count = static_cast<size_t>(hi - lo);
+    const size_t index = right ? simd::bisectRight(data, count, value) : simd::bisectLeft(data, count, value);
+    return PyLong_FromSize_t(static_cast<size_t>(lo) + index);
+}
+
+static PyObject *BigIntArrayList_bisect_left(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    return BigIntArrayList_bisect(pySelf, args, kwargs, false);
+}
+
+static PyObject *BigIntArrayList_bisect_right(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    return BigIntArrayList_bisect(pySelf, args, kwargs, true);
+}
+
+static PyObject *BigIntArrayList_contains_sorted(PyObject *pySelf, PyObject *pyValue) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    if (!PyLong_Check(pyValue)) {
+        Py_RETURN_FALSE;
+    }
+
+    long long value;
+    int beyond;
+    if (!BigIntArrayList_searchValue(pyValue, value, beyond)) {
+        return nullptr;
+    }
+    if (beyond != 0) {
+        Py_RETURN_FALSE;
+    }
+
+    const size_t size = self->vector.size();
+    const size_t index = simd::bisectLeft(self->vector.data(), size, value);
+    Py_RETURN_BOOL(index < size && self->vector[index] == value);
+}
+
+static PyObject *BigIntArrayList_searchsorted(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    PyObject *pyValues;
+    const char *side = "left";
+    static constexpr const char *kwlist[] = {"values", "side", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|s", const_cast<char **>(kwlist), &pyValues, &side)) {
+        return nullptr;
+    }
+
+    if (Py_TYPE(pyValues) != &BigIntArrayListType) {
+        PyErr_SetString(PyExc_TypeError, "Expected an BigIntArrayList object.");
+        return nullptr;
+    }
+    auto *values = reinterpret_cast<BigIntArrayList *>(pyValues);
+
+    bool right;
+    if (std::strcmp(side, "left") == 0) {
+        right = false;
+    } else if (std::strcmp(side, "right") == 0) {
+        right = true;
+    } else {
+        PyErr_SetString(PyExc_ValueError, "side must be 'left' or 'right'");
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    if (size > static_cast<size_t>(INT_MAX)) {
+        PyErr_SetString(PyExc_OverflowError, "positions don't fit in an IntArrayList");
+        return nullptr;
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        const size_t needleCount = values->vector.size();
+        result->vector.resize(needleCount);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::searchSorted(self->vector.data(), size, values->vector.data(), needleCount, right,
+                                   result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
 static Py_ssize_t BigIntArrayList_len(PyObject *pySelf) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
@@ -582,6 +1287,9 @@ static int BigIntArrayList_setitem(PyObject *pySelf, Py_ssize_t pyIndex, PyObjec
 
     try {
         if (pyValue == nullptr) {
+            if (!BigIntArrayList_checkResizable(self)) {
+                return -1;
+            }
             self->vector.erase(self->vector.begin() + pyIndex);
         } else {
             long long value = PyLong_AsLongLong(pyValue);
@@ -629,6 +1337,10 @@ static int BigIntArrayList_setitem_slice(PyObject *pySelf, PyObject *slice, PyOb
         return -1;
     }
 
+    if (newLength != sliceLength && !BigIntArrayList_checkResizable(self)) {
+        return -1;
+    }
+
     PyObject *item = nullptr;
     try {
         if (newLength == sliceLength) {  // only change elements
@@ -740,6 +1452,10 @@ static PyObject *BigIntArrayList_add(PyObject *pySelf, PyObject *pyValue) {
 static PyObject *BigIntArrayList_iadd(PyObject *pySelf, PyObject *iterable) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
+    if (!BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     // fast extend
     if (Py_TYPE(iterable) == &BigIntArrayListType) {
         auto *iter = reinterpret_cast<BigIntArrayList *>(iterable);
@@ -806,7 +1522,7 @@ static PyObject *BigIntArrayList_mul(PyObject *pySelf, Py_ssize_t n) {
         Py_BEGIN_ALLOW_THREADS
             result->vector.resize(selfSize * n);
             for (Py_ssize_t i = 0; i < n; ++i) {
-                simd::simdMemCpyAligned(self->vector.data(), result->vector.data() + selfSize * i, selfSize);
+                simd::simdMemCpy(self->vector.data(), result->vector.data() + selfSize * i, selfSize);
             }
         Py_END_ALLOW_THREADS
 
@@ -839,6 +1555,10 @@ static PyObject *BigIntArrayList_imul(PyObject *pySelf, Py_ssize_t n) {
         n = 0;
     }
 
+    if (n != 1 && !BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     try {
         if (n == 0) {
             self->vector.clear();
@@ -848,9 +1568,9 @@ static PyObject *BigIntArrayList_imul(PyObject *pySelf, Py_ssize_t n) {
             Py_BEGIN_ALLOW_THREADS
                 self->vector.resize(selfSize * n);
                 for (Py_ssize_t i = 1; i < n; ++i) {
-                    simd::simdMemCpyAligned(
+                    simd::simdMemCpy(
                             self->vector.data(),
-                            self->vector.data() + selfSize * sizeof(long long) * i,
+                            self->vector.data() + selfSize * i,
                             selfSize
                     );
                 }
@@ -878,7 +1598,8 @@ static int BigIntArrayList_contains(PyObject *pySelf, PyObject *key) {
     }
 
     try {
-        if (std::find(self->vector.begin(), self->vector.end(), value) != self->vector.end()) {
+        const auto size = self->vector.size();
+        if (simd::simdFind(self->vector.data(), size, value) != size) {
             return 1;  // true
         } else {
             return 0;  // false
@@ -909,10 +1630,149 @@ static PyObject *BigIntArrayList_reverse(PyObject *pySelf) {
 static PyObject *BigIntArrayList_clear(PyObject *pySelf) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
+    if (!BigIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     self->vector.clear();
     Py_RETURN_NONE;
 }
 
+static PyObject *BigIntArrayList_sum(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    const long long *data = self->vector.data();
+    const size_t size = self->vector.size();
+
+    PyObject *result = PyLong_FromLong(0);
+    if (result == nullptr) {
+        return nullptr;
+    }
+
+    // a long long sum may not fit in 64 bits, so add up the exact parts of each chunk as python ints
+    for (size_t i = 0; i < size; i += simd::SUM_CHUNK_SIZE) {
+        const size_t chunkSize = std::min(simd::SUM_CHUNK_SIZE, size - i);
+
+        simd::LongLongSum chunk{};
+        Py_BEGIN_ALLOW_THREADS
+            chunk = simd::simdSum(data + i, chunkSize);
+        Py_END_ALLOW_THREADS
+
+        PyObject *low = PyLong_FromUnsignedLongLong(chunk.low);
+        PyObject *high = PyLong_FromLongLong(chunk.high);
+        PyObject *shift = PyLong_FromLong(32);
+        PyObject *shifted = high != nullptr && shift != nullptr ? PyNumber_Lshift(high, shift) : nullptr;
+        PyObject *chunkSum = low != nullptr && shifted != nullptr ? PyNumber_Add(low, shifted) : nullptr;
+        Py_XDECREF(low);
+        Py_XDECREF(high);
+        Py_XDECREF(shift);
+        Py_XDECREF(shifted);
+
+        PyObject *newResult = chunkSum != nullptr ? PyNumber_Add(result, chunkSum) : nullptr;
+        Py_XDECREF(chunkSum);
+        Py_DECREF(result);
+        if (newResult == nullptr) {
+            return nullptr;
+        }
+        result = newResult;
+    }
+
+    return result;
+}
+
+static PyObject *BigIntArrayList_min(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "min() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<long long> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyLong_FromLongLong(result.min);
+}
+
+static PyObject *BigIntArrayList_max(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "max() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<long long> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyLong_FromLongLong(result.max);
+}
+
+static PyObject *BigIntArrayList_minmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "minmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<long long> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+
+    PyObject *min = PyLong_FromLongLong(result.min);
+    if (min == nullptr) {
+        return nullptr;
+    }
+    PyObject *max = PyLong_FromLongLong(result.max);
+    if (max == nullptr) {
+        Py_DECREF(min);
+        return nullptr;
+    }
+
+    PyObject *tuple = PyTuple_Pack(2, min, max);
+    Py_DECREF(min);
+    Py_DECREF(max);
+    return tuple;
+}
+
+static PyObject *BigIntArrayList_argmin(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmin() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the min, like list.index(min(list))
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        const long long min = simd::simdMinMax(self->vector.data(), self->vector.size()).min;
+        index = simd::simdFind(self->vector.data(), self->vector.size(), min);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *BigIntArrayList_argmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the max, like list.index(max(list))
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        const long long max = simd::simdMinMax(self->vector.data(), self->vector.size()).max;
+        index = simd::simdFind(self->vector.data(), self->vector.size(), max);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
 static __forceinline PyObject *BigIntArrayList_eq(PyObject *pySelf, PyObject *pyValue) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
@@ -1152,27 +2012,37 @@ static PyObject *BigIntArrayList_str(PyObject *pySelf) {
     return BigIntArrayList_repr(pySelf);
 }
 
-static int BigIntArrayList_get_buffer(PyObject *pySelf, Py_buffer *view, [[maybe_unused]] int flags) {
-    if (view == nullptr) return -1;
+static int BigIntArrayList_get_buffer(PyObject *pySelf, Py_buffer *view, int flags) {
     auto *self = reinterpret_cast<BigIntArrayList *>(pySelf);
 
+    // every export shares this shape, it can't change while any of them is alive
     self->shape = static_cast<Py_ssize_t>(self->vector.size());
-    view->format = const_cast<char *>("q");
+
+    Py_INCREF(pySelf);
+    view->obj = pySelf;
     view->buf = self->vector.data();
     view->len = static_cast<Py_ssize_t>(self->vector.size() * sizeof(long long));
     view->itemsize = sizeof(long long);
     view->readonly = 0;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? const_cast<char *>("q") : nullptr;
     view->ndim = 1;
-    view->shape = &self->shape;
-    view->strides = nullptr;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? &self->shape : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &view->itemsize : nullptr;
     view->suboffsets = nullptr;
     view->internal = nullptr;
 
+    ++self->exports;
     return 0;
 }
 
+static void BigIntArrayList_release_buffer(PyObject *pySelf, [[maybe_unused]] Py_buffer *view) {
+    --reinterpret_cast<BigIntArrayList *>(pySelf)->exports;
+}
+
 static PyMethodDef BigIntArrayList_methods[] = {
         {"from_range", (PyCFunction) BigIntArrayList_from_range, METH_VARARGS | METH_STATIC},
+        {"frombuffer", (PyCFunction) BigIntArrayList_frombuffer, METH_O | METH_STATIC},
+        {"view", (PyCFunction) BigIntArrayList_view, METH_VARARGS | METH_KEYWORDS},
         {"resize", (PyCFunction) BigIntArrayList_resize, METH_O},
         {"to_list", (PyCFunction) BigIntArrayList_to_list, METH_NOARGS},
         {"copy", (PyCFunction) BigIntArrayList_copy, METH_NOARGS},
@@ -1181,11 +2051,32 @@ static PyMethodDef BigIntArrayList_methods[] = {
         {"pop", (PyCFunction) BigIntArrayList_pop, METH_FASTCALL},
         {"index", (PyCFunction) BigIntArrayList_index, METH_VARARGS},
         {"count", (PyCFunction) BigIntArrayList_count, METH_O},
+        {"count_all", (PyCFunction) BigIntArrayList_count_all, METH_O},
         {"insert", (PyCFunction) BigIntArrayList_insert, METH_VARARGS},
         {"remove", (PyCFunction) BigIntArrayList_remove, METH_O},
         {"sort", (PyCFunction) BigIntArrayList_sort, METH_VARARGS | METH_KEYWORDS},
+        {"argsort", (PyCFunction) BigIntArrayList_argsort, METH_VARARGS | METH_KEYWORDS},
+        {"sort_with", (PyCFunction) BigIntArrayList_sort_with, METH_VARARGS | METH_KEYWORDS},
+        {"nth_element", (PyCFunction) BigIntArrayList_nth_element, METH_VARARGS | METH_KEYWORDS},
+        {"partial_sort", (PyCFunction) BigIntArrayList_partial_sort, METH_VARARGS | METH_KEYWORDS},
+        {"top_k", (PyCFunction) BigIntArrayList_top_k, METH_VARARGS | METH_KEYWORDS},
+        {"sorted_intersect", (PyCFunction) BigIntArrayList_sorted_intersect, METH_O},
+        {"sorted_union", (PyCFunction) BigIntArrayList_sorted_union, METH_O},
+        {"sorted_difference", (PyCFunction) BigIntArrayList_sorted_difference, METH_O},
+        {"merge", (PyCFunction) BigIntArrayList_merge, METH_O},
+        {"merge_many", (PyCFunction) BigIntArrayList_merge_many, METH_O | METH_STATIC},
+        {"bisect_left", (PyCFunction) BigIntArrayList_bisect_left, METH_VARARGS | METH_KEYWORDS},
+        {"bisect_right", (PyCFunction) BigIntArrayList_bisect_right, METH_VARARGS | METH_KEYWORDS},
+        {"searchsorted", (PyCFunction) BigIntArrayList_searchsorted, METH_VARARGS | METH_KEYWORDS},
+        {"contains_sorted", (PyCFunction) BigIntArrayList_contains_sorted, METH_O},
         {"reverse", (PyCFunction) BigIntArrayList_reverse, METH_NOARGS},
         {"clear", (PyCFunction) BigIntArrayList_clear, METH_NOARGS},
+        {"sum", (PyCFunction) BigIntArrayList_sum, METH_NOARGS},
+        {"min", (PyCFunction) BigIntArrayList_min, METH_NOARGS},
+        {"max", (PyCFunction) BigIntArrayList_max, METH_NOARGS},
+        {"minmax", (PyCFunction) BigIntArrayList_minmax, METH_NOARGS},
+        {"argmin", (PyCFunction) BigIntArrayList_argmin, METH_NOARGS},
+        {"argmax", (PyCFunction) BigIntArrayList_argmax, METH_NOARGS},
         {"__rmul__", (PyCFunction) BigIntArrayList_rmul, METH_O},
         {"__reversed__", (PyCFunction) BigIntArrayList_reversed, METH_NOARGS},
 #ifdef IS_PYTHON_39_OR_LATER
@@ -1223,7 +2114,7 @@ static PyMappingMethods BigIntArrayList_asMapping = {
 
 static PyBufferProcs BigIntArrayList_asBuffer = {
         BigIntArrayList_get_buffer,
-        nullptr
+        BigIntArrayList_release_buffer
 };
 
 void initializeBigIntArrayListType(PyTypeObject &type) {
@@ -1251,6 +2142,8 @@ void initializeBigIntArrayListType(PyTypeObject &type) {
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_BigIntArrayList() {
     initializeBigIntArrayListType(BigIntArrayListType);
+    if (PyType_Ready(&BigIntArrayListType) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&BigIntArrayList_module);
     if (object == nullptr)
@@ -15,7 +15,11 @@ typedef struct BigIntArrayList {
     // we use 64 bytes memory aligned to support faster SIMD, suggestion by ChatGPT.
     std::vector<long long, AlignedAllocator<long long, 64>> vector;
     Py_ssize_t shape = 0;
+    // live buffer exports, the vector must not be resized while there are any
+    Py_ssize_t exports = 0;
 } BigIntArrayList;
+
+extern PyTypeObject BigIntArrayListType;
 }
 
 PyMODINIT_FUNC PyInit_BigIntArrayList();
@@ -0,0 +1,688 @@
+//
+// Created by xia__mc on 2024/12/19.
+//
+
+#include "BitSet.h"
+#include <bit>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+#include "utils/simd/BitOps.h"
+#include "utils/memory/AlignedAllocator.h"
+#include "ints/BitSetIter.h"
+
+static constexpr size_t WORD_BITS = 64;
+
+static constexpr unsigned long long ALL_BITS = ~0ULL;
+
+enum class RangeOp {
+    SET, CLEAR, FLIP
+};
+
+static __forceinline size_t BitSet_wordCount(size_t size) {
+    return (size + WORD_BITS - 1) / WORD_BITS;
+}
+
+static __forceinline bool BitSet_get(const BitSet *self, size_t index) {
+    return (self->words[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+}
+
+/**
+ * Clear the bits from size to the end of the last word, after an operation that may have set them.
+ */
+static __forceinline void BitSet_clearTail(BitSet *self) {
+    if (self->size % WORD_BITS != 0) {
+        self->words.back() &= ~(ALL_BITS << (self->size % WORD_BITS));
+    }
+}
+
+/**
+ * Change the size of self, new bits are clear.
+ * Throws std::bad_alloc if the words can't be allocated.
+ */
+static void BitSet_resizeBits(BitSet *self, size_t size) {
+    self->words.resize(BitSet_wordCount(size), 0);
+    self->size = size;
+    BitSet_clearTail(self);
+}
+
+/**
+ * Append a bit to self.
+ * Throws std::bad_alloc if the words can't be allocated.
+ */
+static __forceinline void BitSet_push(BitSet *self, bool value) {
+    if (self->size % WORD_BITS == 0) {
+        self->words.push_back(0);
+    }
+    self->words.back() |= static_cast<unsigned long long>(value) << (self->size % WORD_BITS);
+    ++self->size;
+}
+
+template<RangeOp Op>
+static __forceinline void BitSet_applyMask(unsigned long long &word, unsigned long long mask) {
+    if constexpr (Op == RangeOp::SET) {
+        word |= mask;
+    } else if constexpr (Op == RangeOp::CLEAR) {
+        word &= ~mask;
+    } else {
+        word ^= mask;
+    }
+}
+
+/**
+ * Set, clear or flip every bit in [start, stop), whole words at a time.
+ */
+template<RangeOp Op>
+static void BitSet_applyRange(BitSet *self, size_t start, size_t stop) {
+    if (start >= stop) {
+        return;
+    }
+
+    unsigned long long *words = self->words.data();
+    const size_t first = start / WORD_BITS;
+    const size_t last = (stop - 1) / WORD_BITS;
+    const unsigned long long firstMask = ALL_BITS << (start % WORD_BITS);
+    const unsigned long long lastMask = ALL_BITS >> (WORD_BITS - 1 - (stop - 1) % WORD_BITS);
+
+    if (first == last) {
+        BitSet_applyMask<Op>(words[first], firstMask & lastMask);
+        return;
+    }
+
+    BitSet_applyMask<Op>(words[first], firstMask);
+    if constexpr (Op == RangeOp::SET) {
+        std::fill(words + first + 1, words + last, ALL_BITS);
+    } else if constexpr (Op == RangeOp::CLEAR) {
+        std::fill(words + first + 1, words + last, 0ULL);
+    } else {
+        simd::simdNot(words + first + 1, last - first - 1);
+    }
+    BitSet_applyMask<Op>(words[last], lastMask);
+}
+
+/**
+ * Read the bits an index, or a [start, stop) range if stop was given, refers to. Only the index may be negative.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool BitSet_parseRange(const BitSet *self, Py_ssize_t start, Py_ssize_t stop, bool hasStop,
+                              size_t &from, size_t &to) {
+    const auto size = static_cast<Py_ssize_t>(self->size);
+
+    if (!hasStop) {
+        if (start < 0) {
+            start += size;
+        }
+        if (start < 0 || start >= size) {
+            PyErr_SetString(PyExc_IndexError, "index out of range.");
+            return false;
+        }
+        from = static_cast<size_t>(start);
+        to = from + 1;
+        return true;
+    }
+
+    if (start < 0 || start > stop || stop > size) {
+        PyErr_Format(PyExc_IndexError, "range [%zd, %zd) out of range for a BitSet of size %zd.", start, stop, size);
+        return false;
+    }
+    from = static_cast<size_t>(start);
+    to = static_cast<size_t>(stop);
+    return true;
+}
+
+template<RangeOp Op>
+static PyObject *BitSet_range_method(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    Py_ssize_t start;
+    Py_ssize_t stop = PY_SSIZE_T_MIN;
+    if (!PyArg_ParseTuple(args, "n|n", &start, &stop)) {
+        return nullptr;
+    }
+
+    size_t from, to;
+    if (!BitSet_parseRange(self, start, stop, stop != PY_SSIZE_T_MIN, from, to)) {
+        return nullptr;
+    }
+
+    BitSet_applyRange<Op>(self, from, to);
+    Py_RETURN_NONE;
+}
+
+/**
+ * Index of the first bit from start on which is set (or clear if Clear), or -1 if there's none.
+ */
+template<bool Clear>
+static PyObject *BitSet_next_bit(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    Py_ssize_t start = 0;
+    if (!PyArg_ParseTuple(args, "|n", &start)) {
+        return nullptr;
+    }
+    if (start < 0) {
+        PyErr_SetString(PyExc_ValueError, "start must not be negative");
+        return nullptr;
+    }
+
+    const size_t size = self->size;
+    const auto from = static_cast<size_t>(start);
+    if (from >= size) {
+        return PyLong_FromLong(-1);
+    }
+
+    const unsigned long long *words = self->words.data();
+    const size_t wordCount = self->words.size();
+    size_t w = from / WORD_BITS;
+    unsigned long long word = (Clear ? ~words[w] : words[w]) & (ALL_BITS << (from % WORD_BITS));
+    while (word == 0) {
+        if (++w == wordCount) {
+            return PyLong_FromLong(-1);
+        }
+        word = Clear ? ~words[w] : words[w];
+    }
+
+    // the clear bits past size don't count
+    const size_t index = w * WORD_BITS + static_cast<size_t>(std::countr_zero(word));
+    if (index >= size) {
+        return PyLong_FromLong(-1);
+    }
+    return PyLong_FromSize_t(index);
+}
+
+/**
+ * Check that both operands are BitSets of the same size.
+ * If not successful, function will raise python exception.
+ * @return 1 if they are, 0 if the operation isn't implemented for them, -1 if the sizes differ
+ */
+static int BitSet_checkOperands(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &BitSetType || Py_TYPE(pyRight) != &BitSetType) {
+        return 0;
+    }
+
+    const auto *left = reinterpret_cast<BitSet *>(pyLeft);
+    const auto *right = reinterpret_cast<BitSet *>(pyRight);
+    if (left->size != right->size) {
+        PyErr_Format(PyExc_ValueError, "BitSets must have the same size, got %zu and %zu.", left->size, right->size);
+        return -1;
+    }
+    return 1;
+}
+
+using BitOpKernel = void (*)(const unsigned long long *left, const unsigned long long *right,
+                             unsigned long long *out, size_t size);
+
+template<BitOpKernel Kernel>
+static PyObject *BitSet_binary(PyObject *pyLeft, PyObject *pyRight) {
+    const int check = BitSet_checkOperands(pyLeft, pyRight);
+    if (check == 0) Py_RETURN_NOTIMPLEMENTED;
+    if (check < 0) return nullptr;
+
+    const auto *left = reinterpret_cast<BitSet *>(pyLeft);
+    const auto *right = reinterpret_cast<BitSet *>(pyRight);
+
+    auto *result = BitSet_create(left->size);
+    if (result == nullptr) return nullptr;
+
+    Kernel(left->words.data(), right->words.data(), result->words.data(), left->words.size());
+    return reinterpret_cast<PyObject *>(result);
+}
+
+template<BitOpKernel Kernel>
+static PyObject *BitSet_inplace(PyObject *pySelf, PyObject *other) {
+    const int check = BitSet_checkOperands(pySelf, other);
+    if (check == 0) Py_RETURN_NOTIMPLEMENTED;
+    if (check < 0) return nullptr;
+
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+    const auto *right = reinterpret_cast<BitSet *>(other);
+
+    Kernel(self->words.data(), right->words.data(), self->words.data(), self->words.size());
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+
+extern "C" {
+
+PyTypeObject BitSetType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+BitSet *BitSet_create(size_t size) {
+    auto *result = Py_CreateObj<BitSet>(BitSetType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        BitSet_resizeBits(result, size);
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return result;
+}
+
+static int BitSet_init(BitSet *self, PyObject *args, PyObject *kwargs) {
+    new(&self->words) std::vector<unsigned long long, AlignedAllocator<unsigned long long, 64>>();
+    self->size = 0;
+
+    static constexpr const char *kwlist[] = {"bits", nullptr};
+
+    PyObject *arg = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &arg)) {
+        return -1;
+    }
+
+    if (arg == nullptr) {
+        return 0;
+    }
+
+    try {
+        if (PyLong_Check(arg)) {
+            const Py_ssize_t size = PyLong_AsSsize_t(arg);
+            if (size == -1 && PyErr_Occurred()) {
+                return -1;
+            }
+            if (size < 0) {
+                PyErr_SetString(PyExc_ValueError, "Invalid size.");
+                return -1;
+            }
+            BitSet_resizeBits(self, static_cast<size_t>(size));
+            return 0;
+        }
+
+        if (Py_TYPE(arg) == &BitSetType) {  // BitSet is a final class
+            auto *other = reinterpret_cast<BitSet *>(arg);
+            self->words = other->words;
+            self->size = other->size;
+            return 0;
+        }
+
+        if (PyList_Check(arg) || PyTuple_Check(arg)) {  // fast operation
+            PyObject *fast = PySequence_Fast(arg, "Shouldn't be happen (BitSet).");
+            if (fast == nullptr) {
+                return -1;
+            }
+
+            const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast);
+            PyObject **items = PySequence_Fast_ITEMS(fast);
+            self->words.reserve(BitSet_wordCount(static_cast<size_t>(size)));
+            for (Py_ssize_t i = 0; i < size; ++i) {
+                const int value = PyObject_IsTrue(items[i]);
+                if (value < 0) {
+                    SAFE_DECREF(fast);
+                    return -1;
+                }
+                BitSet_push(self, value);
+            }
+            SAFE_DECREF(fast);
+            return 0;
+        }
+
+        PyObject *iter = PyObject_GetIter(arg);
+        if (iter == nullptr) {
+            PyErr_SetString(PyExc_TypeError, "Arg 'bits' is neither an int nor iterable.");
+            return -1;
+        }
+
+        PyObject *item;
+        while ((item = PyIter_Next(iter)) != nullptr) {
+            const int value = PyObject_IsTrue(item);
+            SAFE_DECREF(item);
+            if (value < 0) {
+                SAFE_DECREF(iter);
+                return -1;
+            }
+            BitSet_push(self, value);
+        }
+        SAFE_DECREF(iter);
+        if (PyErr_Occurred()) return -1;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
+static void BitSet_dealloc(BitSet *self) {
+    self->words.~vector();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *BitSet_get_method(PyObject *pySelf, PyObject *pyIndex) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    const Py_ssize_t index = PyNumber_AsSsize_t(pyIndex, PyExc_IndexError);
+    if (index == -1 && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    size_t from, to;
+    if (!BitSet_parseRange(self, index, 0, false, from, to)) {
+        return nullptr;
+    }
+    Py_RETURN_BOOL(BitSet_get(self, from));
+}
+
+static PyObject *BitSet_set(PyObject *pySelf, PyObject *args) {
+    return BitSet_range_method<RangeOp::SET>(pySelf, args);
+}
+
+static PyObject *BitSet_clear(PyObject *pySelf, PyObject *args) {
+    if (PyTuple_GET_SIZE(args) == 0) {
+        auto *self = reinterpret_cast<BitSet *>(pySelf);
+        std::fill(self->words.begin(), self->words.end(), 0ULL);
+        Py_RETURN_NONE;
+    }
+    return BitSet_range_method<RangeOp::CLEAR>(pySelf, args);
+}
+
+static PyObject *BitSet_flip(PyObject *pySelf, PyObject *args) {
+    return BitSet_range_method<RangeOp::FLIP>(pySelf, args);
+}
+
+static PyObject *BitSet_cardinality(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    return PyLong_FromSize_t(simd::simdPopcount(self->words.data(), self->words.size()));
+}
+
+static PyObject *BitSet_next_set_bit(PyObject *pySelf, PyObject *args) {
+    return BitSet_next_bit<false>(pySelf, args);
+}
+
+static PyObject *BitSet_next_clear_bit(PyObject *pySelf, PyObject *args) {
+    return BitSet_next_bit<true>(pySelf, args);
+}
+
+static PyObject *BitSet_append(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    const int value = PyObject_IsTrue(object);
+    if (value < 0) {
+        return nullptr;
+    }
+
+    try {
+        BitSet_push(self, value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *BitSet_resize(PyObject *pySelf, PyObject *pySize) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    if (!PyLong_Check(pySize)) {
+        PyErr_SetString(PyExc_TypeError, "Expected an int object.");
+        return nullptr;
+    }
+
+    const Py_ssize_t size = PyLong_AsSsize_t(pySize);
+    if (size < 0) {
+        if (!PyErr_Occurred()) {
+            PyErr_SetString(PyExc_ValueError, "Invalid size.");
+        }
+        return nullptr;
+    }
+
+    try {
+        BitSet_resizeBits(self, static_cast<size_t>(size));
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *BitSet_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    auto *copy = Py_CreateObj<BitSet>(BitSetType);
+    if (copy == nullptr) return nullptr;
+
+    try {
+        copy->words = self->words;
+        copy->size = self->size;
+    } catch (const std::exception &e) {
+        SAFE_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *BitSet_to_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    const auto size = static_cast<Py_ssize_t>(self->size);
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return nullptr;
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *item = BitSet_get(self, static_cast<size_t>(i)) ? Py_True : Py_False;
+        Py_INCREF(item);
+        PyList_SET_ITEM(result, i, item);  // PyList_SET_ITEM handle this ref
+    }
+
+    return result;
+}
+
+static Py_ssize_t BitSet_len(PyObject *pySelf) {
+    return static_cast<Py_ssize_t>(reinterpret_cast<BitSet *>(pySelf)->size);
+}
+
+static PyObject *BitSet_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    auto iter = BitSetIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+/**
+ * Check an index passed to the sequence slots, python already added the size to negative ones.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool BitSet_checkItemIndex(const BitSet *self, Py_ssize_t index) {
+    if (index < 0 || static_cast<size_t>(index) >= self->size) {
+        PyErr_SetString(PyExc_IndexError, "index out of range.");
+        return false;
+    }
+    return true;
+}
+
+static PyObject *BitSet_getitem(PyObject *pySelf, Py_ssize_t pyIndex) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    if (!BitSet_checkItemIndex(self, pyIndex)) {
+        return nullptr;
+    }
+    Py_RETURN_BOOL(BitSet_get(self, static_cast<size_t>(pyIndex)));
+}
+
+static int BitSet_setitem(PyObject *pySelf, Py_ssize_t pyIndex, PyObject *pyValue) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    if (pyValue == nullptr) {
+        PyErr_SetString(PyExc_TypeError, "BitSet doesn't support item deletion, use resize() instead.");
+        return -1;
+    }
+
+    if (!BitSet_checkItemIndex(self, pyIndex)) {
+        return -1;
+    }
+
+    const auto index = static_cast<size_t>(pyIndex);
+    const int value = PyObject_IsTrue(pyValue);
+    if (value < 0) {
+        return -1;
+    }
+
+    if (value) {
+        BitSet_applyMask<RangeOp::SET>(self->words[index / WORD_BITS], 1ULL << (index % WORD_BITS));
+    } else {
+        BitSet_applyMask<RangeOp::CLEAR>(self->words[index / WORD_BITS], 1ULL << (index % WORD_BITS));
+    }
+    return 0;
+}
+
+static PyObject *BitSet_and(PyObject *pyLeft, PyObject *pyRight) {
+    return BitSet_binary<simd::simdAnd>(pyLeft, pyRight);
+}
+
+static PyObject *BitSet_or(PyObject *pyLeft, PyObject *pyRight) {
+    return BitSet_binary<simd::simdOr>(pyLeft, pyRight);
+}
+
+static PyObject *BitSet_xor(PyObject *pyLeft, PyObject *pyRight) {
+    return BitSet_binary<simd::simdXor>(pyLeft, pyRight);
+}
+
+static PyObject *BitSet_iand(PyObject *pySelf, PyObject *other) {
+    return BitSet_inplace<simd::simdAnd>(pySelf, other);
+}
+
+static PyObject *BitSet_ior(PyObject *pySelf, PyObject *other) {
+    return BitSet_inplace<simd::simdOr>(pySelf, other);
+}
+
+static PyObject *BitSet_ixor(PyObject *pySelf, PyObject *other) {
+    return BitSet_inplace<simd::simdXor>(pySelf, other);
+}
+
+static PyObject *BitSet_invert(PyObject *pySelf) {
+    auto *result = reinterpret_cast<BitSet *>(BitSet_copy(pySelf));
+    if (result == nullptr) return nullptr;
+
+    simd::simdNot(result->words.data(), result->words.size());
+    BitSet_clearTail(result);
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *BitSet_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    if ((op != Py_EQ && op != Py_NE) || Py_TYPE(pyValue) != &BitSetType) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    const auto *self = reinterpret_cast<BitSet *>(pySelf);
+    const auto *value = reinterpret_cast<BitSet *>(pyValue);
+
+    // the bits past size are always clear, so whole words can be compared
+    const bool equal = self->size == value->size && self->words == value->words;
+    Py_RETURN_BOOL(equal == (op == Py_EQ));
+}
+
+static PyObject *BitSet_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BitSet *>(pySelf);
+
+    if (self->size == 0) {
+        return PyUnicode_FromString("[]");
+    }
+
+    auto str = std::string("[");
+    str.reserve(self->size * 7);
+
+    const size_t lastIdx = self->size - 1;
+    for (size_t i = 0; i < lastIdx; ++i) {
+        str += BitSet_get(self, i) ? "True, " : "False, ";
+    }
+    str += BitSet_get(self, lastIdx) ? "True]" : "False]";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
+static PyMethodDef BitSet_methods[] = {
+        {"get", (PyCFunction) BitSet_get_method, METH_O},
+        {"set", (PyCFunction) BitSet_set, METH_VARARGS},
+        {"clear", (PyCFunction) BitSet_clear, METH_VARARGS},
+        {"flip", (PyCFunction) BitSet_flip, METH_VARARGS},
+        {"cardinality", (PyCFunction) BitSet_cardinality, METH_NOARGS},
+        {"next_set_bit", (PyCFunction) BitSet_next_set_bit, METH_VARARGS},
+        {"next_clear_bit", (PyCFunction) BitSet_next_clear_bit, METH_VARARGS},
+        {"append", (PyCFunction) BitSet_append, METH_O},
+        {"resize", (PyCFunction) BitSet_resize, METH_O},
+        {"copy", (PyCFunction) BitSet_copy, METH_NOARGS},
+        {"to_list", (PyCFunction) BitSet_to_list, METH_NOARGS},
+        {nullptr}
+};
+
+static struct PyModuleDef BitSet_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.BitSet",
+        "A BitSet_module that creates a BitSet",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods BitSet_asSequence = {
+        .sq_length = BitSet_len,
+        .sq_item = BitSet_getitem,
+        .sq_ass_item = BitSet_setitem,
+};
+
+static PyNumberMethods BitSet_asNumber = {
+        .nb_invert = BitSet_invert,
+        .nb_and = BitSet_and,
+        .nb_xor = BitSet_xor,
+        .nb_or = BitSet_or,
+        .nb_inplace_and = BitSet_iand,
+        .nb_inplace_xor = BitSet_ixor,
+        .nb_inplace_or = BitSet_ior,
+};
+
+void initializeBitSetType(PyTypeObject &type) {
+    type.tp_name = "BitSet";
+    type.tp_basicsize = sizeof(BitSet);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &BitSet_asSequence;
+    type.tp_as_number = &BitSet_asNumber;
+    type.tp_iter = BitSet_iter;
+    type.tp_methods = BitSet_methods;
+    type.tp_init = (initproc) BitSet_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) BitSet_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = BitSet_compare;
+    type.tp_repr = BitSet_repr;
+    type.tp_str = BitSet_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_BitSet() {
+    initializeBitSetType(BitSetType);
+    if (PyType_Ready(&BitSetType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&BitSet_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&BitSetType);
+    if (PyModule_AddObject(object, "BitSet", (PyObject *) &BitSetType) < 0) {
+        Py_DECREF(&BitSetType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,31 @@
+//
+// Created by xia__mc on 2024/12/19.
+//
+
+#ifndef PYFASTUTIL_BITSET_H
+#define PYFASTUTIL_BITSET_H
+
+#include "utils/PythonPCH.h"
+#include "utils/memory/AlignedAllocator.h"
+#include <vector>
+
+extern "C" {
+typedef struct BitSet {
+    PyObject_HEAD;
+    // bit i is bit i % 64 of words[i / 64], the bits from size to the end of the last word are always clear
+    std::vector<unsigned long long, AlignedAllocator<unsigned long long, 64>> words;
+    size_t size = 0;
+} BitSet;
+
+extern PyTypeObject BitSetType;
+
+/**
+ * Create a BitSet of size clear bits.
+ * If not successful, function will raise python exception.
+ */
+BitSet *BitSet_create(size_t size);
+}
+
+PyMODINIT_FUNC PyInit_BitSet();
+
+#endif //PYFASTUTIL_BITSET_H
@@ -0,0 +1,94 @@
+//
+// Created by xia__mc on 2024/12/19.
+//
+
+#include "BitSetIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject BitSetIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+BitSetIter *BitSetIter_create(BitSet *bitSet) {
+    auto *instance = Py_CreateObjNoInit<BitSetIter>(BitSetIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(bitSet);
+    instance->container = bitSet;
+    instance->index = 0;
+
+    return instance;
+}
+
+static void BitSetIter_dealloc(BitSetIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *BitSetIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<BitSetIter *>(pySelf);
+
+    if (self->index >= self->container->size) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    const size_t index = self->index++;
+    Py_RETURN_BOOL((self->container->words[index / 64] >> (index % 64)) & 1);
+}
+
+static PyObject *BitSetIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef BitSetIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef BitSetIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.BitSetIter",
+        "A BitSetIter_module that creates a BitSetIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeBitSetIterType(PyTypeObject &type) {
+    type.tp_name = "BitSetIter";
+    type.tp_basicsize = sizeof(BitSetIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = BitSetIter_iter;
+    type.tp_iternext = BitSetIter_next;
+    type.tp_methods = BitSetIter_methods;
+    type.tp_dealloc = (destructor) BitSetIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_BitSetIter() {
+    initializeBitSetIterType(BitSetIterType);
+    if (PyType_Ready(&BitSetIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&BitSetIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&BitSetIterType);
+    if (PyModule_AddObject(object, "BitSetIter", (PyObject *) &BitSetIterType) < 0) {
+        Py_DECREF(&BitSetIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,24 @@
+//
+// Created by xia__mc on 2024/12/19.
+//
+
+#ifndef PYFASTUTIL_BITSETITER_H
+#define PYFASTUTIL_BITSETITER_H
+
+#include "utils/PythonPCH.h"
+#include "BitSet.h"
+
+extern "C" {
+typedef struct BitSetIter {
+    PyObject_HEAD;
+    BitSet *container;
+    size_t index;
+} BitSetIter;
+
+BitSetIter *BitSetIter_create(BitSet *bitSet);
+
+}
+
+PyMODINIT_FUNC PyInit_BitSetIter();
+
+#endif //PYFASTUTIL_BITSETITER_H
@@ -0,0 +1,124 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#include "ByteArrayListIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject ByteArrayListIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+ByteArrayListIter *ByteArrayListIter_create(ByteArrayList *list, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<ByteArrayListIter>(ByteArrayListIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(list);
+    instance->container = list;
+    if (reversed) {
+        instance->index = (!list->vector.empty()) ? list->vector.size() - 1 : 0;
+        instance->reversed = true;
+    } else {
+        instance->index = 0;
+        instance->reversed = false;
+    }
+
+    return instance;
+}
+
+static void ByteArrayListIter_dealloc(ByteArrayListIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *ByteArrayListIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ByteArrayListIter *>(pySelf);
+
+    if (self->container->vector.empty()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    if (self->reversed) {
+        if (self->index == 0) {
+            // last iteration
+            signed char element = self->container->vector[self->index];
+            self->index = SIZE_MAX;
+            return PyFast_FromInt(element);
+        }
+        if (self->index == SIZE_MAX) {
+            // already finish iteration
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        signed char element = self->container->vector[self->index];
+        self->index--;
+        return PyFast_FromInt(element);
+    } else {
+        if (self->index >= self->container->vector.size()) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        signed char element = self->container->vector[self->index];
+        self->index++;
+        return PyFast_FromInt(element);
+    }
+}
+
+static PyObject *ByteArrayListIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef ByteArrayListIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef ByteArrayListIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.ByteArrayListIter",
+        "An ByteArrayListIter_module that creates an ByteArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeByteArrayListIterType(PyTypeObject &type) {
+    type.tp_name = "ByteArrayListIter";
+    type.tp_basicsize = sizeof(ByteArrayListIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = ByteArrayListIter_iter;
+    type.tp_iternext = ByteArrayListIter_next;
+    type.tp_methods = ByteArrayListIter_methods;
+    type.tp_dealloc = (destructor) ByteArrayListIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_ByteArrayListIter() {
+    initializeByteArrayListIterType(ByteArrayListIterType);
+    if (PyType_Ready(&ByteArrayListIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&ByteArrayListIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&ByteArrayListIterType);
+    if (PyModule_AddObject(object, "ByteArrayListIter", (PyObject *) &ByteArrayListIterType) < 0) {
+        Py_DECREF(&ByteArrayListIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
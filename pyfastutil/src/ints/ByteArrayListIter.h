@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#ifndef PYFASTUTIL_BYTEARRAYLISTITER_H
+#define PYFASTUTIL_BYTEARRAYLISTITER_H
+
+#include "utils/PythonPCH.h"
+#include "ByteArrayList.h"
+
+extern "C" {
+typedef struct ByteArrayListIter {
+    PyObject_HEAD;
+    ByteArrayList *container;
+    size_t index;
+    bool reversed;
+} ByteArrayListIter;
+
+ByteArrayListIter *ByteArrayListIter_create(ByteArrayList *list, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_ByteArrayListIter();
+
+#endif //PYFASTUTIL_BYTEARRAYLISTITER_H
@@ -0,0 +1,347 @@
+//
+// Created by xia__mc on 2024/12/25.
+//
+
+#include "IndexedIntHeap.h"
+#include <climits>
+#include <exception>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+
+/**
+ * Convert a python object to C int, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, int &result) {
+    const long value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+#if LONG_MAX > INT_MAX
+    if (UNLIKELY(value > INT_MAX || value < INT_MIN)) {
+        PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+        return false;
+    }
+#endif
+    result = static_cast<int>(value);
+    return true;
+}
+
+/**
+ * Convert a python object to an id, raise TypeError, OverflowError or ValueError (if negative) if not possible.
+ * @return if successful
+ */
+static __forceinline bool convertId(PyObject *obj, size_t &result) {
+    const Py_ssize_t value = PyLong_AsSsize_t(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+    if (value < 0) {
+        PyErr_SetString(PyExc_ValueError, "id must be non-negative.");
+        return false;
+    }
+    result = static_cast<size_t>(value);
+    return true;
+}
+
+/**
+ * Parse the (id, priority) arguments of a method.
+ * @return if successful
+ */
+static bool parseEntry(const char *name, PyObject *const *args, const Py_ssize_t nargs, size_t &id, int &priority) {
+    if (nargs != 2) {
+        PyErr_Format(PyExc_TypeError, "%s() takes an id and a priority (%zd given)", name, nargs);
+        return false;
+    }
+    return convertId(args[0], id) && convert(args[1], priority);
+}
+
+static __forceinline PyObject *topToPython(const IndexedDaryHeap<int> &heap) {
+    return Py_BuildValue("(ni)", static_cast<Py_ssize_t>(heap.topId()), heap.topKey());
+}
+
+extern "C" {
+
+static PyTypeObject IndexedIntHeapType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+static int IndexedIntHeap_init(IndexedIntHeap *self, PyObject *args, PyObject *kwargs) {
+    new(&self->heap) IndexedDaryHeap<int>();
+
+    static constexpr const char *kwlist[] = {nullptr};
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "", const_cast<char **>(kwlist))) {
+        return -1;
+    }
+
+    return 0;
+}
+
+static void IndexedIntHeap_dealloc(IndexedIntHeap *self) {
+    self->heap.~IndexedDaryHeap();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *IndexedIntHeap_push(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    size_t id;
+    int priority;
+    if (!parseEntry("push", args, nargs, id, priority)) return nullptr;
+
+    if (self->heap.contains(id)) {
+        PyErr_Format(PyExc_ValueError, "id %zu is already in the heap.", id);
+        return nullptr;
+    }
+
+    try {
+        self->heap.push(id, priority);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IndexedIntHeap_update(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    size_t id;
+    int priority;
+    if (!parseEntry("update", args, nargs, id, priority)) return nullptr;
+
+    try {
+        if (self->heap.contains(id)) {
+            self->heap.update(id, priority);
+        } else {
+            self->heap.push(id, priority);
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IndexedIntHeap_decrease_key(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    size_t id;
+    int priority;
+    if (!parseEntry("decrease_key", args, nargs, id, priority)) return nullptr;
+
+    if (!self->heap.contains(id)) {
+        PyErr_SetObject(PyExc_KeyError, args[0]);
+        return nullptr;
+    }
+    if (priority > self->heap.keyOf(id)) {
+        PyErr_SetString(PyExc_ValueError, "New priority is greater than the current one.");
+        return nullptr;
+    }
+
+    self->heap.update(id, priority);
+    Py_RETURN_NONE;
+}
+
+static PyObject *IndexedIntHeap_pop(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    if (self->heap.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from an empty heap");
+        return nullptr;
+    }
+
+    PyObject *result = topToPython(self->heap);
+    if (result == nullptr) return nullptr;
+    self->heap.remove(self->heap.topId());
+    return result;
+}
+
+static PyObject *IndexedIntHeap_peek(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    if (self->heap.empty()) {
+        PyErr_SetString(PyExc_IndexError, "peek from an empty heap");
+        return nullptr;
+    }
+
+    return topToPython(self->heap);
+}
+
+static PyObject *IndexedIntHeap_remove(PyObject *pySelf, PyObject *pyId) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    size_t id;
+    if (!convertId(pyId, id)) return nullptr;
+
+    if (!self->heap.contains(id)) {
+        PyErr_SetObject(PyExc_KeyError, pyId);
+        return nullptr;
+    }
+
+    const int priority = self->heap.keyOf(id);
+    self->heap.remove(id);
+    return PyFast_FromInt(priority);
+}
+
+static PyObject *IndexedIntHeap_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    self->heap.clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *IndexedIntHeap_to_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    PyObject *result = PyList_New(static_cast<Py_ssize_t>(self->heap.size()));
+    if (result == nullptr) return nullptr;
+
+    try {
+        // pop a copy, so the list is in pop order
+        IndexedDaryHeap<int> heap = self->heap;
+        for (Py_ssize_t i = 0; !heap.empty(); ++i) {
+            PyObject *item = topToPython(heap);
+            if (item == nullptr) {
+                SAFE_DECREF(result);
+                return nullptr;
+            }
+            PyList_SET_ITEM(result, i, item);
+            heap.remove(heap.topId());
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return result;
+}
+
+static Py_ssize_t IndexedIntHeap_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->heap.size());
+}
+
+static int IndexedIntHeap_contains(PyObject *pySelf, PyObject *key) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    if (!PyLong_Check(key)) {
+        return 0;
+    }
+
+    const Py_ssize_t id = PyLong_AsSsize_t(key);
+    if (id == -1 && PyErr_Occurred()) {
+        if (!PyErr_ExceptionMatches(PyExc_OverflowError)) {
+            return -1;
+        }
+        PyErr_Clear();
+        return 0;
+    }
+    return id >= 0 && self->heap.contains(static_cast<size_t>(id));
+}
+
+static PyObject *IndexedIntHeap_getitem(PyObject *pySelf, PyObject *pyId) {
+    auto *self = reinterpret_cast<IndexedIntHeap *>(pySelf);
+
+    size_t id;
+    if (!convertId(pyId, id)) return nullptr;
+
+    if (!self->heap.contains(id)) {
+        PyErr_SetObject(PyExc_KeyError, pyId);
+        return nullptr;
+    }
+    return PyFast_FromInt(self->heap.keyOf(id));
+}
+
+static PyObject *IndexedIntHeap_repr(PyObject *pySelf) {
+    PyObject *list = IndexedIntHeap_to_list(pySelf);
+    if (list == nullptr) return nullptr;
+
+    PyObject *result = PyUnicode_FromFormat("IndexedIntHeap(%R)", list);
+    SAFE_DECREF(list);
+    return result;
+}
+
+static PyMethodDef IndexedIntHeap_methods[] = {
+        {"push", (PyCFunction) IndexedIntHeap_push, METH_FASTCALL},
+        {"update", (PyCFunction) IndexedIntHeap_update, METH_FASTCALL},
+        {"decrease_key", (PyCFunction) IndexedIntHeap_decrease_key, METH_FASTCALL},
+        {"pop", (PyCFunction) IndexedIntHeap_pop, METH_NOARGS},
+        {"peek", (PyCFunction) IndexedIntHeap_peek, METH_NOARGS},
+        {"remove", (PyCFunction) IndexedIntHeap_remove, METH_O},
+        {"clear", (PyCFunction) IndexedIntHeap_clear, METH_NOARGS},
+        {"to_list", (PyCFunction) IndexedIntHeap_to_list, METH_NOARGS},
+        {nullptr}
+};
+
+static struct PyModuleDef IndexedIntHeap_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.IndexedIntHeap",
+        "An IndexedIntHeap_module that creates an IndexedIntHeap",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods IndexedIntHeap_asSequence = {
+        IndexedIntHeap_len,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        IndexedIntHeap_contains
+};
+
+static PyMappingMethods IndexedIntHeap_asMapping = {
+        IndexedIntHeap_len,
+        IndexedIntHeap_getitem
+};
+
+void initializeIndexedIntHeapType(PyTypeObject &type) {
+    type.tp_name = "IndexedIntHeap";
+    type.tp_basicsize = sizeof(IndexedIntHeap);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &IndexedIntHeap_asSequence;
+    type.tp_as_mapping = &IndexedIntHeap_asMapping;
+    type.tp_methods = IndexedIntHeap_methods;
+    type.tp_init = (initproc) IndexedIntHeap_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) IndexedIntHeap_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_repr = IndexedIntHeap_repr;
+    type.tp_str = IndexedIntHeap_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_IndexedIntHeap() {
+    initializeIndexedIntHeapType(IndexedIntHeapType);
+    if (PyType_Ready(&IndexedIntHeapType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&IndexedIntHeap_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&IndexedIntHeapType);
+    if (PyModule_AddObject(object, "IndexedIntHeap", (PyObject *) &IndexedIntHeapType) < 0) {
+        Py_DECREF(&IndexedIntHeapType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,20 @@
+//
+// Created by xia__mc on 2024/12/25.
+//
+
+#ifndef PYFASTUTIL_INDEXEDINTHEAP_H
+#define PYFASTUTIL_INDEXEDINTHEAP_H
+
+#include "utils/PythonPCH.h"
+#include "utils/DaryHeap.h"
+
+extern "C" {
+typedef struct IndexedIntHeap {
+    PyObject_HEAD;
+    IndexedDaryHeap<int> heap;
+} IndexedIntHeap;
+}
+
+PyMODINIT_FUNC PyInit_IndexedIntHeap();
+
+#endif //PYFASTUTIL_INDEXEDINTHEAP_H
@@ -0,0 +1,700 @@
+//
+// Created by xia__mc on 2024/12/4.
+//
+
+#include "Int2ObjectHashMap.h"
+#include <climits>
+#include "utils/PythonUtils.h"
+#include "ints/IntArrayList.h"
+#include "ints/Int2ObjectHashMapIter.h"
+
+extern "C" {
+
+PyTypeObject Int2ObjectHashMapType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+/**
+ * Convert a python object to C int, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, int &result) {
+    const long value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+#if LONG_MAX > INT_MAX
+    if (UNLIKELY(value > INT_MAX || value < INT_MIN)) {
+        PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+        return false;
+    }
+#endif
+    result = static_cast<int>(value);
+    return true;
+}
+
+/**
+ * Convert a lookup key. Unlike convert, keys which can't be a C int are simply "not in the map".
+ * @return 1 if converted, 0 if the key can't be in the map, -1 if error
+ */
+static __forceinline int convertKey(PyObject *obj, int &result) {
+    if (!PyLong_Check(obj)) {
+        return 0;
+    }
+
+    int overflow = 0;
+    const long value = PyLong_AsLongAndOverflow(obj, &overflow);
+    if (value == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (overflow != 0 || value > INT_MAX || value < INT_MIN) {
+        return 0;
+    }
+    result = static_cast<int>(value);
+    return 1;
+}
+
+static __forceinline void setKeyError(PyObject *key) {
+    PyObject *tuple = PyTuple_Pack(1, key);
+    if (tuple == nullptr) return;
+    PyErr_SetObject(PyExc_KeyError, tuple);
+    Py_DECREF(tuple);
+}
+
+/**
+ * Put key -> value, taking a new reference to value.
+ * The replaced value is released after the map is consistent again, as its __del__ may touch the map.
+ */
+static __forceinline void put(Int2ObjectHashMap *self, const int key, PyObject *value) {
+    Py_INCREF(value);
+    const auto result = self->map.try_emplace(key, value);
+    if (!result.second) {
+        PyObject *old = result.first->second;
+        result.first->second = value;
+        SAFE_DECREF(old);
+    }
+}
+
+/**
+ * Remove every entry, values are released after the map is already empty.
+ */
+static __forceinline void clearMap(Int2ObjectHashMap *self) {
+    ankerl::unordered_dense::map<int, PyObject *> map;
+    map.swap(self->map);
+    for (const auto &entry: map.values()) {
+        Py_DECREF(entry.second);
+    }
+}
+
+static __forceinline bool updateFromEntry(Int2ObjectHashMap *self, PyObject *entry) {
+    PyObject *fastEntry = PySequence_Fast(entry, "expected an iterable of (key, value) pairs.");
+    if (fastEntry == nullptr) {
+        return false;
+    }
+
+    if (PySequence_Fast_GET_SIZE(fastEntry) != 2) {
+        SAFE_DECREF(fastEntry);
+        PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
+        return false;
+    }
+
+    int key;
+    auto items = PySequence_Fast_ITEMS(fastEntry);
+    if (!convert(items[0], key)) {
+        SAFE_DECREF(fastEntry);
+        return false;
+    }
+
+    put(self, key, items[1]);
+    SAFE_DECREF(fastEntry);
+    return true;
+}
+
+/**
+ * Put all entries of an Int2ObjectHashMap, a dict, a mapping or an iterable of pairs into self.
+ * @return 0 if successful, -1 if error
+ */
+static int Int2ObjectHashMap_updateFrom(Int2ObjectHashMap *self, PyObject *other) {
+    try {
+        if (Py_TYPE(other) == &Int2ObjectHashMapType) {
+            auto *map = reinterpret_cast<Int2ObjectHashMap *>(other);
+            if (map == self) return 0;
+
+            if (self->map.empty()) {
+                self->map = map->map;
+                for (const auto &entry: self->map.values()) {
+                    Py_INCREF(entry.second);
+                }
+            } else {
+                self->map.reserve(self->map.size() + map->map.size());
+                for (const auto &entry: map->map.values()) {
+                    put(self, entry.first, entry.second);
+                }
+            }
+            return 0;
+        }
+
+        if (PyDict_Check(other)) {
+            PyObject *pyKey, *pyValue;
+            Py_ssize_t pos = 0;
+
+            self->map.reserve(self->map.size() + static_cast<size_t>(PyDict_GET_SIZE(other)));
+            while (PyDict_Next(other, &pos, &pyKey, &pyValue)) {
+                int key;
+                if (!convert(pyKey, key)) {
+                    return -1;
+                }
+                put(self, key, pyValue);
+            }
+            return 0;
+        }
+
+        static PyObject *keysAttr = PyUnicode_InternFromString("keys");
+
+        if (PyMapping_Check(other) && PyObject_HasAttr(other, keysAttr)) {
+            PyObject *keys = PyMapping_Keys(other);
+            if (keys == nullptr) {
+                return -1;
+            }
+
+            PyObject *iter = PyObject_GetIter(keys);
+            SAFE_DECREF(keys);
+            if (iter == nullptr) {
+                return -1;
+            }
+
+            PyObject *pyKey;
+            while ((pyKey = PyIter_Next(iter)) != nullptr) {
+                PyObject *pyValue = PyObject_GetItem(other, pyKey);
+                int key;
+                const bool success = pyValue != nullptr && convert(pyKey, key);
+                if (success) {
+                    put(self, key, pyValue);
+                }
+                SAFE_DECREF(pyKey);
+                Py_XDECREF(pyValue);
+                if (!success) {
+                    SAFE_DECREF(iter);
+                    return -1;
+                }
+            }
+            SAFE_DECREF(iter);
+            return PyErr_Occurred() ? -1 : 0;
+        }
+
+        PyObject *iter = PyObject_GetIter(other);
+        if (iter == nullptr) {
+            PyErr_SetString(PyExc_TypeError, "expected a iterable or a mapping");
+            return -1;
+        }
+
+        PyObject *entry;
+        while ((entry = PyIter_Next(iter)) != nullptr) {
+            const bool success = updateFromEntry(self, entry);
+            SAFE_DECREF(entry);
+            if (!success) {
+                SAFE_DECREF(iter);
+                return -1;
+            }
+        }
+        SAFE_DECREF(iter);
+        return PyErr_Occurred() ? -1 : 0;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+}
+
+static PyObject *Int2ObjectHashMap_new(PyTypeObject *type, PyObject *args, PyObject *kwargs) {
+    // the map must be valid before the first gc traversal, which may happen before __init__
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(PyType_GenericNew(type, args, kwargs));
+    if (self == nullptr) return nullptr;
+
+    new(&self->map) ankerl::unordered_dense::map<int, PyObject *>();
+    return reinterpret_cast<PyObject *>(self);
+}
+
+static int Int2ObjectHashMap_init(Int2ObjectHashMap *self, PyObject *args, PyObject *kwargs) {
+    static constexpr const char *kwlist[] = {"__map", nullptr};
+
+    PyObject *arg = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &arg)) {
+        return -1;
+    }
+
+    if (arg == nullptr) {
+        return 0;
+    }
+    return Int2ObjectHashMap_updateFrom(self, arg);
+}
+
+static int Int2ObjectHashMap_traverse(Int2ObjectHashMap *self, visitproc visit, void *arg) {
+    for (const auto &entry: self->map.values()) {
+        Py_VISIT(entry.second);
+    }
+    return 0;
+}
+
+static int Int2ObjectHashMap_clear_refs(Int2ObjectHashMap *self) {
+    clearMap(self);
+    return 0;
+}
+
+static void Int2ObjectHashMap_dealloc(Int2ObjectHashMap *self) {
+    PyObject_GC_UnTrack(self);
+    clearMap(self);
+    self->map.~table();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *Int2ObjectHashMap_copy(PyObject *pySelf) {
+    auto *copy = Py_CreateObj<Int2ObjectHashMap>(Int2ObjectHashMapType);
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    if (Int2ObjectHashMap_updateFrom(copy, pySelf) == -1) {
+        SAFE_DECREF(copy);
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *Int2ObjectHashMap_get(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "get() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    int key;
+    const int converted = convertKey(args[0], key);
+    if (converted == -1) return nullptr;
+
+    PyObject *result = nargs == 2 ? args[1] : Py_None;
+    if (converted == 1) {
+        const auto it = self->map.find(key);
+        if (it != self->map.end()) {
+            result = it->second;
+        }
+    }
+
+    Py_INCREF(result);
+    return result;
+}
+
+static PyObject *Int2ObjectHashMap_pop(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "pop() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    int key;
+    const int converted = convertKey(args[0], key);
+    if (converted == -1) return nullptr;
+
+    if (converted == 1) {
+        const auto it = self->map.find(key);
+        if (it != self->map.end()) {
+            PyObject *value = it->second;  // the map's reference is handed to the caller
+            self->map.erase(it);
+            return value;
+        }
+    }
+
+    if (nargs == 2) {
+        Py_INCREF(args[1]);
+        return args[1];
+    }
+
+    setKeyError(args[0]);
+    return nullptr;
+}
+
+static PyObject *Int2ObjectHashMap_setdefault(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "setdefault() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    int key;
+    if (!convert(args[0], key)) return nullptr;
+    PyObject *defaultValue = nargs == 2 ? args[1] : Py_None;
+
+    try {
+        const auto result = self->map.try_emplace(key, defaultValue);
+        if (result.second) {
+            Py_INCREF(defaultValue);
+        }
+        Py_INCREF(result.first->second);
+        return result.first->second;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static PyObject *Int2ObjectHashMap_items(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    const auto &values = self->map.values();
+    const auto size = static_cast<Py_ssize_t>(values.size());
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *key = PyFast_FromInt(values[i].first);
+        PyObject *item = key != nullptr ? PyTuple_Pack(2, key, values[i].second) : nullptr;
+        Py_XDECREF(key);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+
+        PyList_SET_ITEM(result, i, item);  // PyList_SET_ITEM handle this ref
+    }
+
+    return result;
+}
+
+static PyObject *Int2ObjectHashMap_keys(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        const auto &values = self->map.values();
+        result->vector.resize(values.size());
+        auto data = result->vector.data();
+        for (const auto &entry: values) {
+            *data++ = entry.first;
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *Int2ObjectHashMap_values(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    const auto &values = self->map.values();
+    const auto size = static_cast<Py_ssize_t>(values.size());
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        Py_INCREF(values[i].second);
+        PyList_SET_ITEM(result, i, values[i].second);
+    }
+
+    return result;
+}
+
+static PyObject *Int2ObjectHashMap_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    if (Int2ObjectHashMap_updateFrom(self, other) == -1) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *Int2ObjectHashMap_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    clearMap(self);
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t Int2ObjectHashMap_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->map.size());
+}
+
+static PyObject *Int2ObjectHashMap_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    auto iter = Int2ObjectHashMapIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *Int2ObjectHashMap_getitem(PyObject *pySelf, PyObject *pyKey) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    int key;
+    const int converted = convertKey(pyKey, key);
+    if (converted == -1) return nullptr;
+
+    if (converted == 1) {
+        const auto it = self->map.find(key);
+        if (it != self->map.end()) {
+            Py_INCREF(it->second);
+            return it->second;
+        }
+    }
+
+    setKeyError(pyKey);
+    return nullptr;
+}
+
+static int Int2ObjectHashMap_setitem(PyObject *pySelf, PyObject *pyKey, PyObject *pyValue) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    if (pyValue == nullptr) {  // del map[key]
+        int key;
+        const int converted = convertKey(pyKey, key);
+        if (converted == -1) return -1;
+
+        const auto it = converted == 1 ? self->map.find(key) : self->map.end();
+        if (it == self->map.end()) {
+            setKeyError(pyKey);
+            return -1;
+        }
+
+        PyObject *old = it->second;
+        self->map.erase(it);
+        SAFE_DECREF(old);
+        return 0;
+    }
+
+    int key;
+    if (!convert(pyKey, key)) return -1;
+
+    try {
+        put(self, key, pyValue);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+    return 0;
+}
+
+static int Int2ObjectHashMap_contains(PyObject *pySelf, PyObject *pyKey) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    int key;
+    const int converted = convertKey(pyKey, key);
+    if (converted != 1) return converted;
+
+    return self->map.contains(key) ? 1 : 0;
+}
+
+/**
+ * Compare the value of key with value.
+ * @return 1 if equal, 0 if not equal or missing, -1 if error
+ */
+static __forceinline int valueEquals(Int2ObjectHashMap *self, const int key, PyObject *value) {
+    const auto it = self->map.find(key);
+    if (it == self->map.end()) return 0;
+
+    // __eq__ may mutate the map, so hold the value
+    PyObject *ourValue = it->second;
+    Py_INCREF(ourValue);
+    const int result = PyObject_RichCompareBool(ourValue, value, Py_EQ);
+    SAFE_DECREF(ourValue);
+    return result;
+}
+
+static __forceinline PyObject *Int2ObjectHashMap_eq(PyObject *pySelf, PyObject *pyValue) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    if (Py_TYPE(pyValue) == &Int2ObjectHashMapType) {
+        auto *value = reinterpret_cast<Int2ObjectHashMap *>(pyValue);
+        if (value->map.size() != self->map.size())
+            Py_RETURN_FALSE;
+
+        // index based, entries may move if __eq__ mutates either map
+        for (size_t i = 0; i < value->map.size(); ++i) {
+            const int key = value->map.values()[i].first;
+            PyObject *item = value->map.values()[i].second;
+            Py_INCREF(item);
+            const int equals = valueEquals(self, key, item);
+            SAFE_DECREF(item);
+            if (equals == -1) return nullptr;
+            if (equals == 0) Py_RETURN_FALSE;
+        }
+        Py_RETURN_TRUE;
+    }
+
+    if (!PyDict_Check(pyValue))
+        Py_RETURN_NOTIMPLEMENTED;
+
+    // for dict
+    if (PyDict_GET_SIZE(pyValue) != static_cast<Py_ssize_t>(self->map.size()))
+        Py_RETURN_FALSE;
+
+    PyObject *pyKey, *pyItem;
+    Py_ssize_t pos = 0;
+    while (PyDict_Next(pyValue, &pos, &pyKey, &pyItem)) {
+        int key;
+        const int converted = convertKey(pyKey, key);
+        if (converted == -1) return nullptr;
+        if (converted == 0)
+            Py_RETURN_FALSE;
+
+        Py_INCREF(pyItem);
+        const int equals = valueEquals(self, key, pyItem);
+        SAFE_DECREF(pyItem);
+        if (equals == -1) return nullptr;
+        if (equals == 0) Py_RETURN_FALSE;
+    }
+
+    Py_RETURN_TRUE;
+}
+
+static PyObject *Int2ObjectHashMap_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    PyObject *isEq;
+    switch (op) {
+        case Py_EQ:  // ==
+            return Int2ObjectHashMap_eq(pySelf, pyValue);
+        case Py_NE:  // !=
+            isEq = Int2ObjectHashMap_eq(pySelf, pyValue);
+            if (isEq == nullptr || isEq == Py_NotImplemented)
+                return isEq;
+            if (isEq == Py_True) {
+                SAFE_DECREF(isEq);
+                Py_RETURN_FALSE;
+            } else {
+                SAFE_DECREF(isEq);
+                Py_RETURN_TRUE;
+            }
+        default:
+            Py_RETURN_NOTIMPLEMENTED;
+    }
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *Int2ObjectHashMap_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static PyObject *Int2ObjectHashMap_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Int2ObjectHashMap *>(pySelf);
+
+    if (self->map.empty()) {
+        return PyUnicode_FromString("{}");
+    }
+
+    // a map may contain itself
+    const int status = Py_ReprEnter(pySelf);
+    if (status != 0) {
+        return status > 0 ? PyUnicode_FromString("{...}") : nullptr;
+    }
+
+    PyObject *reprList = PyUnicode_FromString("{");
+    for (size_t i = 0; reprList != nullptr && i < self->map.size(); ++i) {
+        const auto &entry = self->map.values()[i];
+        PyObject *value = entry.second;
+        Py_INCREF(value);
+        PyObject *itemRepr = PyUnicode_FromFormat(i == 0 ? "%d: %R" : ", %d: %R", entry.first, value);
+        SAFE_DECREF(value);
+        PyUnicode_AppendAndDel(&reprList, itemRepr);
+    }
+    PyUnicode_AppendAndDel(&reprList, PyUnicode_FromString("}"));
+
+    Py_ReprLeave(pySelf);
+    return reprList;
+}
+
+static PyMethodDef Int2ObjectHashMap_methods[] = {
+        {"copy", (PyCFunction) Int2ObjectHashMap_copy, METH_NOARGS},
+        {"get", (PyCFunction) Int2ObjectHashMap_get, METH_FASTCALL},
+        {"pop", (PyCFunction) Int2ObjectHashMap_pop, METH_FASTCALL},
+        {"setdefault", (PyCFunction) Int2ObjectHashMap_setdefault, METH_FASTCALL},
+        {"items", (PyCFunction) Int2ObjectHashMap_items, METH_NOARGS},
+        {"keys", (PyCFunction) Int2ObjectHashMap_keys, METH_NOARGS},
+        {"values", (PyCFunction) Int2ObjectHashMap_values, METH_NOARGS},
+        {"update", (PyCFunction) Int2ObjectHashMap_update, METH_O},
+        {"clear", (PyCFunction) Int2ObjectHashMap_clear, METH_NOARGS},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) Int2ObjectHashMap_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef Int2ObjectHashMap_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.Int2ObjectHashMap",
+        "An Int2ObjectHashMap_module that creates an Int2ObjectHashMap",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods Int2ObjectHashMap_asSequence = {
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        Int2ObjectHashMap_contains,
+        nullptr,
+        nullptr
+};
+
+static PyMappingMethods Int2ObjectHashMap_asMapping = {
+        Int2ObjectHashMap_len,
+        Int2ObjectHashMap_getitem,
+        Int2ObjectHashMap_setitem
+};
+
+void initializeInt2ObjectHashMapType(PyTypeObject &type) {
+    type.tp_name = "Int2ObjectHashMap";
+    type.tp_basicsize = sizeof(Int2ObjectHashMap);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC;
+    type.tp_as_sequence = &Int2ObjectHashMap_asSequence;
+    type.tp_as_mapping = &Int2ObjectHashMap_asMapping;
+    type.tp_iter = Int2ObjectHashMap_iter;
+    type.tp_methods = Int2ObjectHashMap_methods;
+    type.tp_init = (initproc) Int2ObjectHashMap_init;
+    type.tp_new = Int2ObjectHashMap_new;
+    type.tp_dealloc = (destructor) Int2ObjectHashMap_dealloc;
+    type.tp_traverse = (traverseproc) Int2ObjectHashMap_traverse;
+    type.tp_clear = (inquiry) Int2ObjectHashMap_clear_refs;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_GC_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = Int2ObjectHashMap_compare;
+    type.tp_repr = Int2ObjectHashMap_repr;
+    type.tp_str = Int2ObjectHashMap_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_Int2ObjectHashMap() {
+    initializeInt2ObjectHashMapType(Int2ObjectHashMapType);
+    if (PyType_Ready(&Int2ObjectHashMapType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&Int2ObjectHashMap_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&Int2ObjectHashMapType);
+    if (PyModule_AddObject(object, "Int2ObjectHashMap", (PyObject *) &Int2ObjectHashMapType) < 0) {
+        Py_DECREF(&Int2ObjectHashMapType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,22 @@
+//
+// Created by xia__mc on 2024/12/4.
+//
+
+#ifndef PYFASTUTIL_INT2OBJECTHASHMAP_H
+#define PYFASTUTIL_INT2OBJECTHASHMAP_H
+
+#include "utils/PythonPCH.h"
+#include "utils/include/UnorderedDense.h"
+
+extern "C" {
+typedef struct Int2ObjectHashMap {
+    PyObject_HEAD;
+    ankerl::unordered_dense::map<int, PyObject *> map;  // owns a strong reference to every value
+} Int2ObjectHashMap;
+
+extern PyTypeObject Int2ObjectHashMapType;
+}
+
+PyMODINIT_FUNC PyInit_Int2ObjectHashMap();
+
+#endif //PYFASTUTIL_INT2OBJECTHASHMAP_H
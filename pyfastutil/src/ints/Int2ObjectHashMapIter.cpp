@@ -0,0 +1,101 @@
+//
+// Created by xia__mc on 2024/12/4.
+//
+
+#include "Int2ObjectHashMapIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject Int2ObjectHashMapIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+Int2ObjectHashMapIter *Int2ObjectHashMapIter_create(Int2ObjectHashMap *map) {
+    auto *instance = Py_CreateObjNoInit<Int2ObjectHashMapIter>(Int2ObjectHashMapIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(map);
+    instance->container = map;
+    instance->index = 0;
+    instance->size = map->map.size();
+
+    return instance;
+}
+
+static void Int2ObjectHashMapIter_dealloc(Int2ObjectHashMapIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *Int2ObjectHashMapIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Int2ObjectHashMapIter *>(pySelf);
+
+    // entries are stored densely, so iterating keys is just walking the values vector
+    const auto &values = self->container->map.values();
+    if (UNLIKELY(values.size() != self->size)) {
+        PyErr_SetString(PyExc_RuntimeError, "Int2ObjectHashMap changed size during iteration");
+        return nullptr;
+    }
+
+    if (self->index >= values.size()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    return PyFast_FromInt(values[self->index++].first);
+}
+
+static PyObject *Int2ObjectHashMapIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef Int2ObjectHashMapIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef Int2ObjectHashMapIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.Int2ObjectHashMapIter",
+        "An Int2ObjectHashMapIter_module that creates an Int2ObjectHashMapIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeInt2ObjectHashMapIterType(PyTypeObject &type) {
+    type.tp_name = "Int2ObjectHashMapIter";
+    type.tp_basicsize = sizeof(Int2ObjectHashMapIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = Int2ObjectHashMapIter_iter;
+    type.tp_iternext = Int2ObjectHashMapIter_next;
+    type.tp_methods = Int2ObjectHashMapIter_methods;
+    type.tp_dealloc = (destructor) Int2ObjectHashMapIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_Int2ObjectHashMapIter() {
+    initializeInt2ObjectHashMapIterType(Int2ObjectHashMapIterType);
+    if (PyType_Ready(&Int2ObjectHashMapIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&Int2ObjectHashMapIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&Int2ObjectHashMapIterType);
+    if (PyModule_AddObject(object, "Int2ObjectHashMapIter", (PyObject *) &Int2ObjectHashMapIterType) < 0) {
+        Py_DECREF(&Int2ObjectHashMapIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/4.
+//
+
+#ifndef PYFASTUTIL_INT2OBJECTHASHMAPITER_H
+#define PYFASTUTIL_INT2OBJECTHASHMAPITER_H
+
+#include "utils/PythonPCH.h"
+#include "Int2ObjectHashMap.h"
+
+extern "C" {
+typedef struct Int2ObjectHashMapIter {
+    PyObject_HEAD;
+    Int2ObjectHashMap *container;
+    size_t index;
+    size_t size;  // size when the iterator was created, used to detect modification
+} Int2ObjectHashMapIter;
+
+Int2ObjectHashMapIter *Int2ObjectHashMapIter_create(Int2ObjectHashMap *map);
+
+}
+
+PyMODINIT_FUNC PyInit_Int2ObjectHashMapIter();
+
+#endif //PYFASTUTIL_INT2OBJECTHASHMAPITER_H
@@ -0,0 +1,794 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#include "IntArrayDeque.h"
+#include <climits>
+#include <string>
+#include <vector>
+#include <exception>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+#include "utils/simd/Search.h"
+#include "ints/IntArrayList.h"
+#include "ints/IntArrayDequeIter.h"
+
+/**
+ * Convert a python object to C int, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, int &result) {
+    const long value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+#if LONG_MAX > INT_MAX
+    if (UNLIKELY(value > INT_MAX || value < INT_MIN)) {
+        PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+        return false;
+    }
+#endif
+    result = static_cast<int>(value);
+    return true;
+}
+
+/**
+ * Convert a lookup value. Unlike convert, values which can't be a C int are simply "not in the deque".
+ * @return 1 if converted, 0 if the value can't be in the deque, -1 if error
+ */
+static __forceinline int convertKey(PyObject *obj, int &result) {
+    if (!PyLong_Check(obj)) {
+        return 0;
+    }
+
+    int overflow = 0;
+    const long long value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+    if (value == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (overflow != 0 || value > INT_MAX || value < INT_MIN) {
+        return 0;
+    }
+    result = static_cast<int>(value);
+    return 1;
+}
+
+/**
+ * Index of the first element equal to value in [start, stop), or stop if there's none.
+ */
+static size_t find(const RingBuffer<int> &deque, size_t start, size_t stop, int value) {
+    size_t result = stop;
+    deque.forEachChunk(start, stop, [&](const int *values, size_t n, size_t index) {
+        const size_t found = simd::simdFind(values, n, value);
+        if (found == n) {
+            return false;
+        }
+        result = index + found;
+        return true;
+    });
+    return result;
+}
+
+extern "C" {
+
+PyTypeObject IntArrayDequeType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+static __forceinline IntArrayDeque *IntArrayDeque_new() {
+    return Py_CreateObj<IntArrayDeque>(IntArrayDequeType);
+}
+
+/**
+ * Push every element of iterable at the back, or one by one at the front if left, which reverses them.
+ * If not successful, function will raise python exception. The elements pushed before the error stay.
+ */
+static bool IntArrayDeque_extendFrom(IntArrayDeque *self, PyObject *iterable, const bool left) {
+    self->modCount++;
+
+    try {
+        if (Py_TYPE(iterable) == &IntArrayDequeType || Py_TYPE(iterable) == &IntArrayListType) {
+            // copy first, iterable may be self
+            std::vector<int> values;
+            if (Py_TYPE(iterable) == &IntArrayDequeType) {
+                const auto &other = reinterpret_cast<IntArrayDeque *>(iterable)->deque;
+                values.reserve(other.size());
+                other.forEachChunk([&values](const int *chunk, size_t n) {
+                    values.insert(values.end(), chunk, chunk + n);
+                });
+            } else {
+                const auto &vector = reinterpret_cast<IntArrayList *>(iterable)->vector;
+                values.assign(vector.begin(), vector.end());
+            }
+
+            if (left) {
+                self->deque.reserve(self->deque.size() + values.size());
+                for (const int value: values) {
+                    self->deque.push_front(value);
+                }
+            } else {
+                self->deque.append(values.data(), values.size());
+            }
+            return true;
+        }
+
+        if (PyList_CheckExact(iterable) || PyTuple_CheckExact(iterable)) {  // fast operation
+            const Py_ssize_t size = PySequence_Fast_GET_SIZE(iterable);
+            PyObject **items = PySequence_Fast_ITEMS(iterable);
+            std::vector<int> values(static_cast<size_t>(size));
+            for (Py_ssize_t i = 0; i < size; ++i) {
+                if (!convert(items[i], values[i])) {
+                    return false;
+                }
+            }
+
+            if (left) {
+                self->deque.reserve(self->deque.size() + values.size());
+                for (const int value: values) {
+                    self->deque.push_front(value);
+                }
+            } else {
+                self->deque.append(values.data(), values.size());
+            }
+            return true;
+        }
+
+        PyObject *iter = PyObject_GetIter(iterable);
+        if (iter == nullptr) {
+            return false;
+        }
+
+        PyObject *item;
+        while ((item = PyIter_Next(iter)) != nullptr) {
+            int value;
+            const bool success = convert(item, value);
+            SAFE_DECREF(item);
+            if (!success) {
+                SAFE_DECREF(iter);
+                return false;
+            }
+
+            if (left) {
+                self->deque.push_front(value);
+            } else {
+                self->deque.push_back(value);
+            }
+        }
+        SAFE_DECREF(iter);
+        return !PyErr_Occurred();
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return false;
+    }
+}
+
+static int IntArrayDeque_init(IntArrayDeque *self, PyObject *args, PyObject *kwargs) {
+    new(&self->deque) RingBuffer<int>();
+    self->modCount = 0;
+
+    PyObject *pyIterable = nullptr;
+
+    static constexpr const char *kwlist[] = {"iterable", nullptr};
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &pyIterable)) {
+        return -1;
+    }
+
+    if (pyIterable == nullptr) {
+        return 0;
+    }
+    return IntArrayDeque_extendFrom(self, pyIterable, false) ? 0 : -1;
+}
+
+static void IntArrayDeque_dealloc(IntArrayDeque *self) {
+    self->deque.~RingBuffer();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *IntArrayDeque_to_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    const auto &deque = self->deque;
+    PyObject *result = PyList_New(static_cast<Py_ssize_t>(deque.size()));
+    if (result == nullptr) return nullptr;
+
+    for (size_t i = 0; i < deque.size(); ++i) {
+        PyObject *item = PyFast_FromInt(deque[i]);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+        PyList_SET_ITEM(result, static_cast<Py_ssize_t>(i), item);
+    }
+
+    return result;
+}
+
+static PyObject *IntArrayDeque_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    auto *copy = IntArrayDeque_new();
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    try {
+        copy->deque = self->deque;
+    } catch (const std::exception &e) {
+        SAFE_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *IntArrayDeque_append(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    int value;
+    if (!convert(object, value)) return nullptr;
+
+    try {
+        self->deque.push_back(value);
+        self->modCount++;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayDeque_appendleft(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    int value;
+    if (!convert(object, value)) return nullptr;
+
+    try {
+        self->deque.push_front(value);
+        self->modCount++;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayDeque_pop(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    if (self->deque.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from an empty deque");
+        return nullptr;
+    }
+
+    self->modCount++;
+    return PyFast_FromInt(self->deque.pop_back());
+}
+
+static PyObject *IntArrayDeque_popleft(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    if (self->deque.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from an empty deque");
+        return nullptr;
+    }
+
+    self->modCount++;
+    return PyFast_FromInt(self->deque.pop_front());
+}
+
+static PyObject *IntArrayDeque_extend(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    if (!IntArrayDeque_extendFrom(self, iterable, false)) return nullptr;
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayDeque_extendleft(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    if (!IntArrayDeque_extendFrom(self, iterable, true)) return nullptr;
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayDeque_drain(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "drain() takes at most 1 argument");
+        return nullptr;
+    }
+
+    size_t count = self->deque.size();
+    if (nargs == 1) {
+        const Py_ssize_t n = PyLong_AsSsize_t(args[0]);
+        if (n == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        if (n >= 0) {
+            count = std::min(count, static_cast<size_t>(n));
+        }
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        result->vector.resize(count);
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    self->deque.popFront(result->vector.data(), count);
+    self->modCount++;
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntArrayDeque_rotate(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "rotate() takes at most 1 argument");
+        return nullptr;
+    }
+
+    Py_ssize_t n = 1;
+    if (nargs == 1) {
+        n = PyLong_AsSsize_t(args[0]);
+        if (n == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+    }
+
+    self->deque.rotate(n);
+    self->modCount++;
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayDeque_reverse(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    self->deque.reverse();
+    self->modCount++;
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayDeque_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    self->deque.clear();
+    self->modCount++;
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayDeque_index(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    PyObject *object;
+    Py_ssize_t start = 0;
+    const auto size = static_cast<Py_ssize_t>(self->deque.size());
+    Py_ssize_t stop = size;
+
+    if (!PyArg_ParseTuple(args, "O|nn", &object, &start, &stop)) {
+        return nullptr;
+    }
+
+    if (start < 0) {
+        start = std::max(static_cast<Py_ssize_t>(0), start + size);
+    }
+    if (stop < 0) {
+        stop += size;
+    }
+    stop = std::min(stop, size);
+
+    int value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+
+    if (converted == 1 && start < stop) {
+        const size_t index = find(self->deque, static_cast<size_t>(start), static_cast<size_t>(stop), value);
+        if (index != static_cast<size_t>(stop)) {
+            return PyLong_FromSize_t(index);
+        }
+    }
+
+    PyErr_SetString(PyExc_ValueError, "Value is not in deque.");
+    return nullptr;
+}
+
+static PyObject *IntArrayDeque_count(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    int value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+    if (converted == 0) return PyLong_FromLong(0);
+
+    size_t result = 0;
+    self->deque.forEachChunk([&](const int *values, size_t n) {
+        result += simd::simdCount(values, n, value);
+    });
+    return PyLong_FromSize_t(result);
+}
+
+static PyObject *IntArrayDeque_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    int value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+
+    if (converted == 1) {
+        const size_t index = find(self->deque, 0, self->deque.size(), value);
+        if (index != self->deque.size()) {
+            self->deque.erase(index);
+            self->modCount++;
+            Py_RETURN_NONE;
+        }
+    }
+
+    PyErr_SetString(PyExc_ValueError, "Value is not in deque.");
+    return nullptr;
+}
+
+static PyObject *IntArrayDeque_insert(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    Py_ssize_t index;
+    PyObject *object;
+
+    if (!PyArg_ParseTuple(args, "nO", &index, &object)) {
+        return nullptr;
+    }
+
+    int value;
+    if (!convert(object, value)) return nullptr;
+
+    // fix index
+    const auto size = static_cast<Py_ssize_t>(self->deque.size());
+    if (index < 0) {
+        index = std::max(static_cast<Py_ssize_t>(0), size + index);
+    } else if (index > size) {
+        index = size;
+    }
+
+    try {
+        self->deque.insert(static_cast<size_t>(index), value);
+        self->modCount++;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t IntArrayDeque_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->deque.size());
+}
+
+static PyObject *IntArrayDeque_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    auto iter = IntArrayDequeIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *IntArrayDeque_reversed(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    auto iter = IntArrayDequeIter_create(self, true);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *IntArrayDeque_getitem(PyObject *pySelf, Py_ssize_t index) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    const auto size = static_cast<Py_ssize_t>(self->deque.size());
+    if (index < 0) {
+        index += size;
+    }
+    if (index < 0 || index >= size) {
+        PyErr_SetString(PyExc_IndexError, "deque index out of range");
+        return nullptr;
+    }
+
+    return PyFast_FromInt(self->deque[static_cast<size_t>(index)]);
+}
+
+static int IntArrayDeque_setitem(PyObject *pySelf, Py_ssize_t index, PyObject *pyValue) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    const auto size = static_cast<Py_ssize_t>(self->deque.size());
+    if (index < 0) {
+        index += size;
+    }
+    if (index < 0 || index >= size) {
+        PyErr_SetString(PyExc_IndexError, "deque index out of range");
+        return -1;
+    }
+
+    if (pyValue == nullptr) {
+        self->deque.erase(static_cast<size_t>(index));
+        self->modCount++;
+        return 0;
+    }
+
+    int value;
+    if (!convert(pyValue, value)) return -1;
+    self->deque[static_cast<size_t>(index)] = value;
+    return 0;
+}
+
+static int IntArrayDeque_contains(PyObject *pySelf, PyObject *key) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    int value;
+    const int converted = convertKey(key, value);
+    if (converted != 1) return converted;
+
+    return find(self->deque, 0, self->deque.size(), value) != self->deque.size();
+}
+
+static PyObject *IntArrayDeque_add(PyObject *pySelf, PyObject *pyValue) {
+    if (Py_TYPE(pyValue) != &IntArrayDequeType) {
+        PyErr_Format(PyExc_TypeError, "can only concatenate IntArrayDeque (not \"%.200s\") to IntArrayDeque",
+                     Py_TYPE(pyValue)->tp_name);
+        return nullptr;
+    }
+
+    auto *result = reinterpret_cast<IntArrayDeque *>(IntArrayDeque_copy(pySelf));
+    if (result == nullptr) return nullptr;
+
+    if (!IntArrayDeque_extendFrom(result, pyValue, false)) {
+        SAFE_DECREF(result);
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntArrayDeque_iadd(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    if (!IntArrayDeque_extendFrom(self, iterable, false)) return nullptr;
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+/**
+ * Append the first size elements of deque to it until it holds them n times.
+ */
+static void repeat(RingBuffer<int> &deque, Py_ssize_t n) {
+    if (n <= 0) {
+        deque.clear();
+        return;
+    }
+
+    std::vector<int> values(deque.size());
+    deque.popFront(values.data(), values.size());
+    deque.reserve(values.size() * static_cast<size_t>(n));
+    for (Py_ssize_t i = 0; i < n; ++i) {
+        deque.append(values.data(), values.size());
+    }
+}
+
+static PyObject *IntArrayDeque_mul(PyObject *pySelf, Py_ssize_t n) {
+    auto *result = reinterpret_cast<IntArrayDeque *>(IntArrayDeque_copy(pySelf));
+    if (result == nullptr) return nullptr;
+
+    try {
+        repeat(result->deque, n);
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntArrayDeque_imul(PyObject *pySelf, Py_ssize_t n) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    self->modCount++;
+    try {
+        repeat(self->deque, n);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static __forceinline PyObject *IntArrayDeque_eq(PyObject *pySelf, PyObject *pyValue) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+    const auto &deque = self->deque;
+
+    if (Py_TYPE(pyValue) == &IntArrayDequeType) {
+        // fast compare
+        const auto &other = reinterpret_cast<IntArrayDeque *>(pyValue)->deque;
+        if (other.size() != deque.size())
+            Py_RETURN_FALSE;
+
+        for (size_t i = 0; i < deque.size(); i++) {
+            if (deque[i] != other[i])
+                Py_RETURN_FALSE;
+        }
+        Py_RETURN_TRUE;
+    }
+
+    if (!PySequence_Check(pyValue))
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const Py_ssize_t size = PySequence_Size(pyValue);
+    if (size < 0) return nullptr;
+    if (static_cast<size_t>(size) != deque.size())
+        Py_RETURN_FALSE;
+
+    for (Py_ssize_t i = 0; i < size; i++) {
+        PyObject *item = PySequence_GetItem(pyValue, i);
+        if (item == nullptr) return nullptr;
+
+        int value;
+        const int converted = convertKey(item, value);
+        SAFE_DECREF(item);
+        if (converted == -1) return nullptr;
+        if (converted == 0 || value != deque[static_cast<size_t>(i)])
+            Py_RETURN_FALSE;
+    }
+
+    Py_RETURN_TRUE;
+}
+
+static PyObject *IntArrayDeque_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    PyObject *isEq;
+    switch (op) {
+        case Py_EQ:  // ==
+            return IntArrayDeque_eq(pySelf, pyValue);
+        case Py_NE:  // !=
+            isEq = IntArrayDeque_eq(pySelf, pyValue);
+            if (isEq == nullptr || isEq == Py_NotImplemented)
+                return isEq;
+            if (isEq == Py_True) {
+                SAFE_DECREF(isEq);
+                Py_RETURN_FALSE;
+            } else {
+                SAFE_DECREF(isEq);
+                Py_RETURN_TRUE;
+            }
+        default:
+            Py_RETURN_NOTIMPLEMENTED;
+    }
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *IntArrayDeque_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static PyObject *IntArrayDeque_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDeque *>(pySelf);
+
+    const auto &deque = self->deque;
+
+    if (deque.empty()) {
+        return PyUnicode_FromString("[]");
+    }
+
+    auto str = std::string("[");
+    str.reserve(deque.size() * 4);
+
+    char buffer[32];
+
+    deque.forEachChunk([&](const int *values, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            // to string
+            int len = snprintf(buffer, sizeof(buffer), "%d, ", values[i]);
+            str.append(buffer, len);
+        }
+    });
+
+    str.resize(str.size() - 2);
+    str += "]";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
+static PyMethodDef IntArrayDeque_methods[] = {
+        {"to_list", (PyCFunction) IntArrayDeque_to_list, METH_NOARGS},
+        {"copy", (PyCFunction) IntArrayDeque_copy, METH_NOARGS},
+        {"append", (PyCFunction) IntArrayDeque_append, METH_O},
+        {"appendleft", (PyCFunction) IntArrayDeque_appendleft, METH_O},
+        {"pop", (PyCFunction) IntArrayDeque_pop, METH_NOARGS},
+        {"popleft", (PyCFunction) IntArrayDeque_popleft, METH_NOARGS},
+        {"extend", (PyCFunction) IntArrayDeque_extend, METH_O},
+        {"extendleft", (PyCFunction) IntArrayDeque_extendleft, METH_O},
+        {"drain", (PyCFunction) IntArrayDeque_drain, METH_FASTCALL},
+        {"rotate", (PyCFunction) IntArrayDeque_rotate, METH_FASTCALL},
+        {"reverse", (PyCFunction) IntArrayDeque_reverse, METH_NOARGS},
+        {"clear", (PyCFunction) IntArrayDeque_clear, METH_NOARGS},
+        {"index", (PyCFunction) IntArrayDeque_index, METH_VARARGS},
+        {"count", (PyCFunction) IntArrayDeque_count, METH_O},
+        {"remove", (PyCFunction) IntArrayDeque_remove, METH_O},
+        {"insert", (PyCFunction) IntArrayDeque_insert, METH_VARARGS},
+        {"__reversed__", (PyCFunction) IntArrayDeque_reversed, METH_NOARGS},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) IntArrayDeque_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef IntArrayDeque_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.IntArrayDeque",
+        "An IntArrayDeque_module that creates an IntArrayDeque",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods IntArrayDeque_asSequence = {
+        IntArrayDeque_len,
+        IntArrayDeque_add,
+        IntArrayDeque_mul,
+        IntArrayDeque_getitem,
+        nullptr,
+        IntArrayDeque_setitem,
+        nullptr,
+        IntArrayDeque_contains,
+        IntArrayDeque_iadd,
+        IntArrayDeque_imul
+};
+
+void initializeIntArrayDequeType(PyTypeObject &type) {
+    type.tp_name = "IntArrayDeque";
+    type.tp_basicsize = sizeof(IntArrayDeque);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &IntArrayDeque_asSequence;
+    type.tp_iter = IntArrayDeque_iter;
+    type.tp_methods = IntArrayDeque_methods;
+    type.tp_init = (initproc) IntArrayDeque_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) IntArrayDeque_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = IntArrayDeque_compare;
+    type.tp_repr = IntArrayDeque_repr;
+    type.tp_str = IntArrayDeque_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_IntArrayDeque() {
+    initializeIntArrayDequeType(IntArrayDequeType);
+    if (PyType_Ready(&IntArrayDequeType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&IntArrayDeque_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&IntArrayDequeType);
+    if (PyModule_AddObject(object, "IntArrayDeque", (PyObject *) &IntArrayDequeType) < 0) {
+        Py_DECREF(&IntArrayDequeType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
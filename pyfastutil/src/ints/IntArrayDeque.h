@@ -0,0 +1,24 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#ifndef PYFASTUTIL_INTARRAYDEQUE_H
+#define PYFASTUTIL_INTARRAYDEQUE_H
+
+#include "utils/PythonPCH.h"
+#include "utils/RingBuffer.h"
+
+extern "C" {
+typedef struct IntArrayDeque {
+    PyObject_HEAD;
+    RingBuffer<int> deque;
+    // bumped by every change of the elements' positions, iterators use it to detect mutation
+    uint64_t modCount;
+} IntArrayDeque;
+
+extern PyTypeObject IntArrayDequeType;
+}
+
+PyMODINIT_FUNC PyInit_IntArrayDeque();
+
+#endif //PYFASTUTIL_INTARRAYDEQUE_H
@@ -0,0 +1,109 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#include "IntArrayDequeIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject IntArrayDequeIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+IntArrayDequeIter *IntArrayDequeIter_create(IntArrayDeque *deque, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<IntArrayDequeIter>(IntArrayDequeIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(deque);
+    instance->container = deque;
+    instance->index = reversed ? deque->deque.size() : 0;
+    instance->modCount = deque->modCount;
+    instance->reversed = reversed;
+
+    return instance;
+}
+
+static void IntArrayDequeIter_dealloc(IntArrayDequeIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *IntArrayDequeIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayDequeIter *>(pySelf);
+
+    // positions shift with every push and pop at the front, so there is nothing sensible to resume from
+    if (UNLIKELY(self->modCount != self->container->modCount)) {
+        PyErr_SetString(PyExc_RuntimeError, "IntArrayDeque mutated during iteration");
+        return nullptr;
+    }
+
+    const auto &deque = self->container->deque;
+    if (self->reversed) {
+        if (self->index == 0) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+        return PyFast_FromInt(deque[--self->index]);
+    }
+
+    if (self->index >= deque.size()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+    return PyFast_FromInt(deque[self->index++]);
+}
+
+static PyObject *IntArrayDequeIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef IntArrayDequeIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef IntArrayDequeIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.IntArrayDequeIter",
+        "An IntArrayDequeIter_module that creates an IntArrayDequeIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeIntArrayDequeIterType(PyTypeObject &type) {
+    type.tp_name = "IntArrayDequeIter";
+    type.tp_basicsize = sizeof(IntArrayDequeIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = IntArrayDequeIter_iter;
+    type.tp_iternext = IntArrayDequeIter_next;
+    type.tp_methods = IntArrayDequeIter_methods;
+    type.tp_dealloc = (destructor) IntArrayDequeIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_IntArrayDequeIter() {
+    initializeIntArrayDequeIterType(IntArrayDequeIterType);
+    if (PyType_Ready(&IntArrayDequeIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&IntArrayDequeIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&IntArrayDequeIterType);
+    if (PyModule_AddObject(object, "IntArrayDequeIter", (PyObject *) &IntArrayDequeIterType) < 0) {
+        Py_DECREF(&IntArrayDequeIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
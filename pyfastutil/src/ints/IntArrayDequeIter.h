@@ -0,0 +1,26 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#ifndef PYFASTUTIL_INTARRAYDEQUEITER_H
+#define PYFASTUTIL_INTARRAYDEQUEITER_H
+
+#include "utils/PythonPCH.h"
+#include "IntArrayDeque.h"
+
+extern "C" {
+typedef struct IntArrayDequeIter {
+    PyObject_HEAD;
+    IntArrayDeque *container;
+    size_t index;  // reversed, the count of elements left to return
+    uint64_t modCount;
+    bool reversed;
+} IntArrayDequeIter;
+
+IntArrayDequeIter *IntArrayDequeIter_create(IntArrayDeque *deque, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_IntArrayDequeIter();
+
+#endif //PYFASTUTIL_INTARRAYDEQUEITER_H
@@ -3,23 +3,77 @@
 //
 
 #include "IntArrayList.h"
+#include <climits>
+#include <cstring>
 #include <vector>
 #include <algorithm>
+#include <exception>
 #include <stdexcept>
 #include "utils/PythonUtils.h"
+#include "utils/IntBuffer.h"
+#include "utils/Permutation.h"
+#include "utils/KeySort.h"
 #include "utils/include/TimSort.h"
 #include "utils/simd/BitonicSort.h"
+#include "utils/simd/RadixSort.h"
 #include "utils/simd/SIMDUtils.h"
+#include "utils/simd/Reduction.h"
+#include "utils/simd/Search.h"
+#include "utils/simd/Select.h"
+#include "utils/simd/BitOps.h"
+#include "utils/simd/SetOps.h"
+#include "utils/simd/BinarySearch.h"
 #include "utils/memory/AlignedAllocator.h"
+#include "utils/include/UnorderedDense.h"
 #include "ints/IntArrayListIter.h"
-#include "utils/include/CPythonSort.h"
+#include "ints/BitSet.h"
+#include "ints/IntIntHashMap.h"
 
 extern "C" {
 
-static PyTypeObject IntArrayListType = {
+PyTypeObject IntArrayListType = {
         PyVarObject_HEAD_INIT(&PyType_Type, 0)
 };
 
+/**
+ * Refuse to change the size while buffers are exported, their pointer and shape would go stale.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool IntArrayList_checkResizable(const IntArrayList *self) noexcept {
+    if (self->exports > 0) {
+        PyErr_SetString(PyExc_BufferError, "Existing exports of data: object cannot be re-sized");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Replace the elements of self with the elements of buffer, without boxing them.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool IntArrayList_assignBuffer(IntArrayList *self, const IntBuffer &buffer) {
+    if (buffer.ints != nullptr) {
+        self->vector.resize(buffer.size);
+        simd::simdMemCpy(const_cast<int *>(buffer.ints), self->vector.data(), buffer.size);
+        return true;
+    }
+
+    // narrow int64, after checking that every element fits
+    if (buffer.size != 0) {
+        const auto minMax = simd::simdMinMax(buffer.longs, buffer.size);
+        if (minMax.min < INT_MIN || minMax.max > INT_MAX) {
+            PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+            return false;
+        }
+    }
+    self->vector.resize(buffer.size);
+    std::transform(buffer.longs, buffer.longs + buffer.size, self->vector.begin(),
+                   [](const long long value) { return static_cast<int>(value); });
+    return true;
+}
+
 __forceinline void parseArgs(PyObject *&args, PyObject *&kwargs, PyObject *&pyIterable, Py_ssize_t &pySize) {
     static constexpr const char *kwlist[] = {"iterable", "exceptSize", nullptr};
 
@@ -81,6 +135,17 @@ static int IntArrayList_init(IntArrayList *self, PyObject *args, PyObject *kwarg
                 return 0;
             }
 
+            if (PyObject_CheckBuffer(pyIterable)) {  // numpy arrays and other int buffers, no boxing
+                IntBuffer buffer;
+                if (IntBuffer_open(pyIterable, buffer)) {
+                    const bool success = IntArrayList_assignBuffer(self, buffer);
+                    IntBuffer_release(buffer);
+                    return success ? 0 : -1;
+                }
+                // other formats, like bytes, are still iterable
+                PyErr_Clear();
+            }
+
             PyObject *iter = PyObject_GetIter(pyIterable);
             if (iter == nullptr) {
                 PyErr_SetString(PyExc_TypeError, "Arg '__iterable' is not iterable.");
@@ -157,9 +222,60 @@ static PyObject *IntArrayList_from_range([[maybe_unused]] PyObject *cls, PyObjec
     return reinterpret_cast<PyObject *>(list);
 }
 
+static PyObject *IntArrayList_frombuffer([[maybe_unused]] PyObject *cls, PyObject *obj) {
+    IntBuffer buffer;
+    if (!IntBuffer_open(obj, buffer)) {
+        return nullptr;
+    }
+
+    auto *list = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (list == nullptr) {
+        IntBuffer_release(buffer);
+        return nullptr;
+    }
+
+    try {
+        if (!IntArrayList_assignBuffer(list, buffer)) {
+            IntBuffer_release(buffer);
+            Py_DECREF(list);
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        IntBuffer_release(buffer);
+        Py_DECREF(list);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    IntBuffer_release(buffer);
+    return reinterpret_cast<PyObject *>(list);
+}
+
+static PyObject *IntArrayList_view(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    int readonly = 0;  // default: false
+    static constexpr const char *kwlist[] = {"readonly", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", const_cast<char **>(kwlist), &readonly)) {
+        return nullptr;
+    }
+
+    PyObject *view = PyMemoryView_FromObject(pySelf);
+    if (view == nullptr || !readonly) {
+        return view;
+    }
+
+    PyObject *result = PyObject_CallMethod(view, "toreadonly", nullptr);
+    Py_DECREF(view);
+    return result;
+}
+
 static PyObject *IntArrayList_resize(PyObject *pySelf, PyObject *pySize) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
+    if (!IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     if (!PyLong_Check(pySize)) {
         PyErr_SetString(PyExc_TypeError, "Expected an int object.");
         return nullptr;
@@ -221,6 +337,10 @@ static PyObject *IntArrayList_copy(PyObject *pySelf) {
 static PyObject *IntArrayList_append(PyObject *pySelf, PyObject *object) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
+    if (!IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     int value = PyLong_AsLong(object);
     if (PyErr_Occurred()) {
         return nullptr;
@@ -239,6 +359,10 @@ static PyObject *IntArrayList_append(PyObject *pySelf, PyObject *object) {
 static PyObject *IntArrayList_extend(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
+    if (!IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     // FASTCALL ensure args != nullptr
     if (nargs != 1) {
         PyErr_SetString(PyExc_TypeError, "extend() takes exactly one argument");
@@ -285,217 +409,1101 @@ static PyObject *IntArrayList_extend(PyObject *pySelf, PyObject *const *args, co
         return nullptr;
     }
 
-    SAFE_DECREF(iter);
-    Py_RETURN_NONE;
-}
+    SAFE_DECREF(iter);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *IntArrayList_pop(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from empty list");
+        return nullptr;
+    }
+
+    if (!IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    Py_ssize_t index = vecSize - 1;
+
+    int popped;
+    switch (nargs) {
+        case 0:
+            popped = self->vector.back();
+            self->vector.pop_back();
+
+            return PyFast_FromInt(popped);
+        case 1:
+            index = PyLong_AsSsize_t(args[0]);
+            if (index == -1 && PyErr_Occurred()) {
+                return nullptr;
+            }
+
+            if (index < 0) {
+                index += vecSize;
+            }
+
+            if (index < 0 || index >= vecSize) {
+                PyErr_SetString(PyExc_IndexError, "index out of range");
+                return nullptr;
+            }
+
+            popped = self->vector[static_cast<size_t>(index)];
+            self->vector.erase(self->vector.begin() + index);
+
+            return PyFast_FromInt(popped);
+        default:
+            PyErr_SetString(PyExc_TypeError, "pop() takes at most 1 argument");
+            return nullptr;
+    }
+    Py_UNREACHABLE();
+}
+
+static PyObject *IntArrayList_index(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    int value;
+    Py_ssize_t start = 0;
+    auto stop = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (!PyArg_ParseTuple(args, "i|nn", &value, &start, &stop)) {
+        return nullptr;
+    }
+
+    if (start < 0) {
+        start += static_cast<Py_ssize_t>(self->vector.size());
+    }
+    if (stop < 0) {
+        stop += static_cast<Py_ssize_t>(self->vector.size());
+    }
+
+    if (start < 0) {
+        start = 0;
+    }
+    if (stop > static_cast<Py_ssize_t>(self->vector.size())) {
+        stop = static_cast<Py_ssize_t>(self->vector.size());
+    }
+
+    if (start > stop) {
+        PyErr_SetString(PyExc_ValueError, "start index cannot be greater than stop index.");
+        return nullptr;
+    }
+
+    const size_t index = static_cast<size_t>(start) + simd::simdFind(
+            self->vector.data() + start, static_cast<size_t>(stop - start), value);
+
+    if (index == static_cast<size_t>(stop)) {
+        PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+        return nullptr;
+    }
+
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *IntArrayList_count(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    int value = PyLong_AsLong(object);
+    if (value == -1 && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    try {
+        size_t result = simd::simdCount(self->vector.data(), self->vector.size(), value);
+
+        return PyLong_FromSize_t(result);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static PyObject *IntArrayList_count_all(PyObject *pySelf, PyObject *pyValues) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    try {
+        std::vector<long long> values;
+        if (!IntBuffer_collect(pyValues, values)) {
+            return nullptr;
+        }
+
+        // needles out of the range of C int can't be in the list, they just count 0
+        std::vector<int> needles;
+        std::vector<size_t> positions;
+        needles.reserve(values.size());
+        positions.reserve(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (values[i] >= INT_MIN && values[i] <= INT_MAX) {
+                needles.push_back(static_cast<int>(values[i]));
+                positions.push_back(i);
+            }
+        }
+
+        std::vector<size_t> counts(needles.size());
+        bool noMemory = false;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::simdCountAll(self->vector.data(), self->vector.size(),
+                                   needles.data(), needles.size(), counts.data());
+            } catch (const std::bad_alloc &) {
+                noMemory = true;
+            }
+        Py_END_ALLOW_THREADS
+        if (noMemory) {
+            return PyErr_NoMemory();
+        }
+
+        std::vector<size_t> result(values.size(), 0);
+        for (size_t i = 0; i < positions.size(); ++i) {
+            result[positions[i]] = counts[i];
+        }
+
+        PyObject *pyResult = PyList_New(static_cast<Py_ssize_t>(result.size()));
+        if (pyResult == nullptr) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < result.size(); ++i) {
+            PyObject *count = PyLong_FromSize_t(result[i]);
+            if (count == nullptr) {
+                Py_DECREF(pyResult);
+                return nullptr;
+            }
+            PyList_SET_ITEM(pyResult, static_cast<Py_ssize_t>(i), count);
+        }
+        return pyResult;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static PyObject *IntArrayList_insert(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (!IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    Py_ssize_t index;
+    int value;
+
+    if (!PyArg_ParseTuple(args, "ni", &index, &value)) {
+        return nullptr;
+    }
+
+    // fix index
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    if (index < 0) {
+        index = std::max(static_cast<Py_ssize_t>(0), vecSize + index);
+    } else if (index > vecSize) {
+        index = vecSize;
+    }
+
+    // do insert
+    try {
+        self->vector.insert(self->vector.begin() + index, value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayList_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (!IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    int value = PyLong_AsLong(object);
+    if (PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    try {
+        const size_t index = simd::simdFind(self->vector.data(), self->vector.size(), value);
+
+        if (index != self->vector.size()) {
+            self->vector.erase(self->vector.begin() + static_cast<Py_ssize_t>(index));
+        } else {
+            PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+/**
+ * Parse the algorithm argument of sort(), None means auto.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool parseSortAlgorithm(const char *name, simd::SortAlgorithm &algorithm) {
+    if (name == nullptr || strcmp(name, "auto") == 0) {
+        algorithm = simd::SortAlgorithm::AUTO;
+    } else if (strcmp(name, "bitonic") == 0) {
+        algorithm = simd::SortAlgorithm::BITONIC;
+    } else if (strcmp(name, "radix") == 0) {
+        algorithm = simd::SortAlgorithm::RADIX;
+    } else {
+        PyErr_Format(PyExc_ValueError, "algorithm must be 'auto', 'bitonic' or 'radix', got '%s'", name);
+        return false;
+    }
+    return true;
+}
+
+static PyObject *IntArrayList_sort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    PyObject *keyFunc = nullptr;
+    int reverseInt = 0;  // default: false
+    int parallel = 0;  // default: false
+    Py_ssize_t threads = 0;  // default: one per hardware thread
+    const char *algorithmName = nullptr;  // default: auto
+    static constexpr const char *kwlist[] = {"key", "reverse", "parallel", "threads", "algorithm", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Oi$pns", const_cast<char **>(kwlist),
+                                     &keyFunc, &reverseInt, &parallel, &threads, &algorithmName)) {
+        return nullptr;
+    }
+
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError, "threads must be non-negative");
+        return nullptr;
+    }
+
+    simd::SortAlgorithm algorithm;
+    if (!parseSortAlgorithm(algorithmName, algorithm)) {
+        return nullptr;
+    }
+
+    const bool reverse = reverseInt == 1;
+
+    // do sort
+    try {
+        if (keyFunc == nullptr || keyFunc == Py_None) {
+            // simd sort with auto-fallback
+            // exceptions can't leave the block without the GIL, so rethrow them after it
+            const size_t size = self->vector.size();
+            std::exception_ptr error;
+            Py_BEGIN_ALLOW_THREADS
+                try {
+                    if (parallel) {
+                        simd::simdsortParallel(self->vector, reverse, static_cast<size_t>(threads), algorithm);
+                    } else if (simd::resolveSortAlgorithm<int>(algorithm, size) == simd::SortAlgorithm::RADIX) {
+                        simd::radixsort(self->vector, reverse);
+                    } else {
+                        simd::simdsort(self->vector, reverse);
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            Py_END_ALLOW_THREADS
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        } else if (!KeySort_sort(self->vector, keyFunc, reverse,
+                                 [](const int value) { return PyFast_FromInt(value); },
+                                 [](PyObject *item) { return static_cast<int>(PyLong_AsLong(item)); })) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayList_argsort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    int reverse = 0;  // default: false
+    int stable = 1;  // default: true
+    static constexpr const char *kwlist[] = {"reverse", "stable", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|pp", const_cast<char **>(kwlist), &reverse, &stable)) {
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    if (size > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "list is too large to be indexed by an IntArrayList");
+        return nullptr;
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(size);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::argsort(self->vector.data(), size, reverse, stable, result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntArrayList_sort_with(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    PyObject *other;
+    int reverse = 0;  // default: false
+    static constexpr const char *kwlist[] = {"other", "reverse", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p", const_cast<char **>(kwlist), &other, &reverse)) {
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    if (!Permutation_check(other, size)) {
+        return nullptr;
+    }
+    if (size > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "list is too large to be sorted with another list");
+        return nullptr;
+    }
+
+    try {
+        // sort a copy with its indices, so nothing changes until everything is allocated
+        std::vector<int, AlignedAllocator<int, 64>> sorted(size);
+        std::vector<int> indices(size);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::argsort(self->vector.data(), size, reverse, true, indices.data(), sorted.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        // self is already sorted by the copy below
+        if (other != pySelf) {
+            Permutation_apply(other, indices.data());
+        }
+        simd::simdMemCpy(sorted.data(), self->vector.data(), size);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayList_nth_element(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    Py_ssize_t k;
+    static constexpr const char *kwlist[] = {"k", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "n", const_cast<char **>(kwlist), &k)) {
+        return nullptr;
+    }
+
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    if (k < 0) {
+        k += vecSize;
+    }
+    if (k < 0 || k >= vecSize) {
+        PyErr_SetString(PyExc_IndexError, "index out of range");
+        return nullptr;
+    }
+
+    try {
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::simdNthElement(self->vector.data(), self->vector.size(), static_cast<size_t>(k));
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return PyFast_FromInt(self->vector[k]);
+}
+
+static PyObject *IntArrayList_partial_sort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    Py_ssize_t k;
+    int reverse = 0;  // default: false
+    static constexpr const char *kwlist[] = {"k", "reverse", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "n|p", const_cast<char **>(kwlist), &k, &reverse)) {
+        return nullptr;
+    }
+
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "k must not be negative");
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    const size_t count = std::min(static_cast<size_t>(k), size);
+
+    try {
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::simdPartialSort(self->vector.data(), size, count, reverse);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntArrayList_top_k(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    Py_ssize_t k;
+    int reverse = 1;  // default: true
+    static constexpr const char *kwlist[] = {"k", "reverse", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "n|p", const_cast<char **>(kwlist), &k, &reverse)) {
+        return nullptr;
+    }
+
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "k must not be negative");
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    const size_t count = std::min(static_cast<size_t>(k), size);
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(count);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::simdTopK(self->vector.data(), size, count, reverse, result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntArrayList_select(PyObject *pySelf, PyObject *pyMask) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (Py_TYPE(pyMask) != &BitSetType) {
+        PyErr_SetString(PyExc_TypeError, "Expected a BitSet object.");
+        return nullptr;
+    }
+
+    auto *mask = reinterpret_cast<BitSet *>(pyMask);
+    const size_t size = self->vector.size();
+    if (mask->size != size) {
+        PyErr_Format(PyExc_ValueError, "mask has %zu bits but the list has %zu elements", mask->size, size);
+        return nullptr;
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        const size_t count = simd::simdPopcount(mask->words.data(), mask->words.size());
+        result->vector.resize(count + simd::COMPRESS_PADDING);
+        simd::simdCompress(self->vector.data(), size, mask->words.data(), result->vector.data());
+        result->vector.resize(count);
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntArrayList_to_bitset(PyObject *pySelf, PyObject *pyUniverse) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    const Py_ssize_t universe = PyNumber_AsSsize_t(pyUniverse, PyExc_OverflowError);
+    if (universe == -1 && PyErr_Occurred()) {
+        return nullptr;
+    }
+    if (universe < 0) {
+        PyErr_SetString(PyExc_ValueError, "universe must not be negative");
+        return nullptr;
+    }
+
+    auto *result = BitSet_create(static_cast<size_t>(universe));
+    if (result == nullptr) return nullptr;
+
+    unsigned long long *words = result->words.data();
+    for (const int value: self->vector) {
+        const auto index = static_cast<size_t>(value);
+        if (value < 0 || index >= static_cast<size_t>(universe)) {
+            Py_DECREF(result);
+            PyErr_Format(PyExc_ValueError, "%d is not in range(%zd)", value, universe);
+            return nullptr;
+        }
+        words[index / 64] |= 1ULL << (index % 64);
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+enum class SortedOp {
+    INTERSECT, UNION, DIFFERENCE, MERGE
+};
+
+static PyObject *IntArrayList_sortedOp(PyObject *pySelf, PyObject *pyOther, SortedOp op) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (Py_TYPE(pyOther) != &IntArrayListType) {
+        PyErr_SetString(PyExc_TypeError, "Expected an IntArrayList object.");
+        return nullptr;
+    }
+    auto *other = reinterpret_cast<IntArrayList *>(pyOther);
+
+    const size_t leftSize = self->vector.size();
+    const size_t rightSize = other->vector.size();
+    size_t capacity;
+    switch (op) {
+        case SortedOp::INTERSECT:
+            capacity = std::min(leftSize, rightSize) + simd::INTERSECT_PADDING;
+            break;
+        case SortedOp::DIFFERENCE:
+            capacity = leftSize;
+            break;
+        default:
+            capacity = leftSize + rightSize;
+            break;
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(capacity);
+        const int *left = self->vector.data();
+        const int *right = other->vector.data();
+        int *out = result->vector.data();
+
+        size_t count = capacity;
+        Py_BEGIN_ALLOW_THREADS
+            switch (op) {
+                case SortedOp::INTERSECT:
+                    count = simd::sortedIntersect(left, leftSize, right, rightSize, out);
+                    break;
+                case SortedOp::UNION:
+                    count = simd::sortedUnion(left, leftSize, right, rightSize, out);
+                    break;
+                case SortedOp::DIFFERENCE:
+                    count = simd::sortedDifference(left, leftSize, right, rightSize, out);
+                    break;
+                case SortedOp::MERGE:
+                    simd::sortedMerge(left, leftSize, right, rightSize, out);
+                    break;
+            }
+        Py_END_ALLOW_THREADS
+        result->vector.resize(count);
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntArrayList_sorted_intersect(PyObject *pySelf, PyObject *pyOther) {
+    return IntArrayList_sortedOp(pySelf, pyOther, SortedOp::INTERSECT);
+}
+
+static PyObject *IntArrayList_sorted_union(PyObject *pySelf, PyObject *pyOther) {
+    return IntArrayList_sortedOp(pySelf, pyOther, SortedOp::UNION);
+}
+
+static PyObject *IntArrayList_sorted_difference(PyObject *pySelf, PyObject *pyOther) {
+    return IntArrayList_sortedOp(pySelf, pyOther, SortedOp::DIFFERENCE);
+}
+
+static PyObject *IntArrayList_merge(PyObject *pySelf, PyObject *pyOther) {
+    return IntArrayList_sortedOp(pySelf, pyOther, SortedOp::MERGE);
+}
+
+static PyObject *IntArrayList_merge_many(PyObject *Py_UNUSED(cls), PyObject *pyLists) {
+    PyObject *fast = PySequence_Fast(pyLists, "Expected an iterable of IntArrayList objects.");
+    if (fast == nullptr) {
+        return nullptr;
+    }
+
+    const Py_ssize_t listCount = PySequence_Fast_GET_SIZE(fast);
+    PyObject **lists = PySequence_Fast_ITEMS(fast);
+    std::vector<size_t> bounds;
+    bounds.reserve(static_cast<size_t>(listCount) + 1);
+    bounds.push_back(0);
+    for (Py_ssize_t i = 0; i < listCount; ++i) {
+        if (Py_TYPE(lists[i]) != &IntArrayListType) {
+            SAFE_DECREF(fast);
+            PyErr_SetString(PyExc_TypeError, "Expected an iterable of IntArrayList objects.");
+            return nullptr;
+        }
+        bounds.push_back(bounds.back() + reinterpret_cast<IntArrayList *>(lists[i])->vector.size());
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) {
+        SAFE_DECREF(fast);
+        return nullptr;
+    }
+
+    try {
+        result->vector.resize(bounds.back());
+        for (Py_ssize_t i = 0; i < listCount; ++i) {
+            const auto &vector = reinterpret_cast<IntArrayList *>(lists[i])->vector;
+            std::copy(vector.begin(), vector.end(), result->vector.begin() + static_cast<Py_ssize_t>(bounds[i]));
+        }
+        SAFE_DECREF(fast);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::sortedMergeRuns(result->vector.data(), bounds);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_XDECREF(fast);
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+/**
+ * Read a value to search for. Ints out of the element range still have a position,
+ * before every element (beyond = -1) or after all of them (beyond = 1).
+ * @return false with an exception set if pyValue isn't an int
+ */
+static bool IntArrayList_searchValue(PyObject *pyValue, int &value, int &beyond) {
+    if (!PyLong_Check(pyValue)) {
+        PyErr_SetString(PyExc_TypeError, "Expected an int object.");
+        return false;
+    }
+
+    int overflow;
+    const long long wide = PyLong_AsLongLongAndOverflow(pyValue, &overflow);
+    if (wide == -1 && PyErr_Occurred()) {
+        return false;
+    }
 
+    if (overflow != 0) {
+        beyond = overflow;
+    } else {
+        beyond = wide > INT_MAX ? 1 : wide < INT_MIN ? -1 : 0;
+    }
+    value = static_cast<int>(wide);
+    return true;
+}
 
-static PyObject *IntArrayList_pop(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+static PyObject *IntArrayList_bisect(PyObject *pySelf, PyObject *args, PyObject *kwargs, bool right) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
-    if (self->vector.empty()) {
-        PyErr_SetString(PyExc_IndexError, "pop from empty list");
+    PyObject *pyValue;
+    Py_ssize_t lo = 0;
+    PyObject *pyHi = Py_None;
+    static constexpr const char *kwlist[] = {"x", "lo", "hi", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|nO", const_cast<char **>(kwlist), &pyValue, &lo, &pyHi)) {
         return nullptr;
     }
 
-    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
-    Py_ssize_t index = vecSize - 1;
+    if (lo < 0) {
+        PyErr_SetString(PyExc_ValueError, "lo must be non-negative");
+        return nullptr;
+    }
 
-    int popped;
-    switch (nargs) {
-        case 0:
-            popped = self->vector.back();
-            self->vector.pop_back();
+    const auto size = static_cast<Py_ssize_t>(self->vector.size());
+    Py_ssize_t hi = size;
+    if (pyHi != Py_None) {
+        hi = PyLong_AsSsize_t(pyHi);
+        if (hi == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        hi = std::min(hi, size);
+    }
 
-            return PyFast_FromInt(popped);
-        case 1:
-            index = PyLong_AsSsize_t(args[0]);
-            if (index == -1 && PyErr_Occurred()) {
-                return nullptr;
-            }
+    int value;
+    int beyond;
+    if (!IntArrayList_searchValue(pyValue, value, beyond)) {
+        return nullptr;
+    }
 
-            if (index < 0) {
-                index += vecSize;
-            }
+    if (lo >= hi || beyond < 0) {
+        return PyLong_FromSsize_t(lo);
+    }
+    if (beyond > 0) {
+        return PyLong_FromSsize_t(hi);
+    }
 
-            if (index < 0 || index >= vecSize) {
-                PyErr_SetString(PyExc_IndexError, "index out of range");
-                return nullptr;
-            }
+    const int *data = self->vector.data() + lo;
+    const auto count = static_cast<size_t>(hi - lo);
+    const size_t index = right ? simd::bisectRight(data, count, value) : simd::bisectLeft(data, count, value);
+    return PyLong_FromSize_t(static_cast<size_t>(lo) + index);
+}
 
-            popped = self->vector[static_cast<size_t>(index)];
-            self->vector.erase(self->vector.begin() + index);
+static PyObject *IntArrayList_bisect_left(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    return IntArrayList_bisect(pySelf, args, kwargs, false);
+}
 
-            return PyFast_FromInt(popped);
-        default:
-            PyErr_SetString(PyExc_TypeError, "pop() takes at most 1 argument");
-            return nullptr;
-    }
-    Py_UNREACHABLE();
+static PyObject *IntArrayList_bisect_right(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    return IntArrayList_bisect(pySelf, args, kwargs, true);
 }
 
-static PyObject *IntArrayList_index(PyObject *pySelf, PyObject *args) {
+static PyObject *IntArrayList_contains_sorted(PyObject *pySelf, PyObject *pyValue) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
-    int value;
-    Py_ssize_t start = 0;
-    auto stop = static_cast<Py_ssize_t>(self->vector.size());
-
-    if (!PyArg_ParseTuple(args, "i|nn", &value, &start, &stop)) {
-        return nullptr;
+    if (!PyLong_Check(pyValue)) {
+        Py_RETURN_FALSE;
     }
 
-    if (start < 0) {
-        start += static_cast<Py_ssize_t>(self->vector.size());
+    int value;
+    int beyond;
+    if (!IntArrayList_searchValue(pyValue, value, beyond)) {
+        return nullptr;
     }
-    if (stop < 0) {
-        stop += static_cast<Py_ssize_t>(self->vector.size());
+    if (beyond != 0) {
+        Py_RETURN_FALSE;
     }
 
-    if (start < 0) {
-        start = 0;
-    }
-    if (stop > static_cast<Py_ssize_t>(self->vector.size())) {
-        stop = static_cast<Py_ssize_t>(self->vector.size());
-    }
+    const size_t size = self->vector.size();
+    const size_t index = simd::bisectLeft(self->vector.data(), size, value);
+    Py_RETURN_BOOL(index < size && self->vector[index] == value);
+}
 
-    if (start > stop) {
-        PyErr_SetString(PyExc_ValueError, "start index cannot be greater than stop index.");
-        return nullptr;
-    }
+static PyObject *IntArrayList_searchsorted(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
-    auto it = std::find(self->vector.begin() + start, self->vector.begin() + stop, value);
+    PyObject *pyValues;
+    const char *side = "left";
+    static constexpr const char *kwlist[] = {"values", "side", nullptr};
 
-    if (it == self->vector.begin() + stop) {
-        PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|s", const_cast<char **>(kwlist), &pyValues, &side)) {
         return nullptr;
     }
 
-    Py_ssize_t index = std::distance(self->vector.begin(), it);
-    return PyLong_FromSsize_t(index);
-}
+    if (Py_TYPE(pyValues) != &IntArrayListType) {
+        PyErr_SetString(PyExc_TypeError, "Expected an IntArrayList object.");
+        return nullptr;
+    }
+    auto *values = reinterpret_cast<IntArrayList *>(pyValues);
 
-static PyObject *IntArrayList_count(PyObject *pySelf, PyObject *object) {
-    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+    bool right;
+    if (std::strcmp(side, "left") == 0) {
+        right = false;
+    } else if (std::strcmp(side, "right") == 0) {
+        right = true;
+    } else {
+        PyErr_SetString(PyExc_ValueError, "side must be 'left' or 'right'");
+        return nullptr;
+    }
 
-    int value = PyLong_AsLong(object);
-    if (value == -1 && PyErr_Occurred()) {
+    const size_t size = self->vector.size();
+    if (size > static_cast<size_t>(INT_MAX)) {
+        PyErr_SetString(PyExc_OverflowError, "positions don't fit in an IntArrayList");
         return nullptr;
     }
 
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
     try {
-        size_t result = std::count(self->vector.begin(), self->vector.end(), value);
+        const size_t needleCount = values->vector.size();
+        result->vector.resize(needleCount);
 
-        return PyLong_FromSize_t(result);
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::searchSorted(self->vector.data(), size, values->vector.data(), needleCount, right,
+                                   result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
     } catch (const std::exception &e) {
+        Py_DECREF(result);
         PyErr_SetString(PyExc_RuntimeError, e.what());
         return nullptr;
     }
+
+    return reinterpret_cast<PyObject *>(result);
 }
 
-static PyObject *IntArrayList_insert(PyObject *pySelf, PyObject *args) {
-    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+/**
+ * Sort values ascending, with the algorithm sort() picks for them by default.
+ */
+static void IntArrayList_sortAscending(std::vector<int, AlignedAllocator<int, 64>> &values) {
+    if (simd::resolveSortAlgorithm<int>(simd::SortAlgorithm::AUTO, values.size()) == simd::SortAlgorithm::RADIX) {
+        simd::radixsort(values, false);
+    } else {
+        simd::simdsort(values, false);
+    }
+}
 
-    Py_ssize_t index;
-    int value;
+/**
+ * A hash set of this many ints still fits in the caches, more distinct values are found faster by sorting.
+ */
+static constexpr size_t UNIQUE_HASH_LIMIT = 1 << 18;
+
+/**
+ * Set values to the distinct elements of data, in order of first appearance.
+ * Throws std::bad_alloc if the scratch space can't be allocated.
+ */
+static void IntArrayList_firstAppearances(const int *data, size_t size,
+                                          std::vector<int, AlignedAllocator<int, 64>> &values) {
+    {
+        // The set keeps its values in a vector in insertion order, which is first appearance
+        ankerl::unordered_dense::set<int> seen;
+        size_t i = 0;
+        for (; i < size && (seen.size() <= UNIQUE_HASH_LIMIT || size > static_cast<size_t>(INT_MAX)); i++) {
+            seen.insert(data[i]);
+        }
+        if (i == size) {
+            values.assign(seen.values().begin(), seen.values().end());
+            return;
+        }
+    }
 
-    if (!PyArg_ParseTuple(args, "ni", &index, &value)) {
-        return nullptr;
+    // A stable argsort puts the first appearance of every value at the front of its run
+    std::vector<int> indices(size);
+    std::vector<int, AlignedAllocator<int, 64>> sorted(size);
+    simd::argsort(data, size, false, true, indices.data(), sorted.data());
+
+    size_t runs = 0;
+    for (size_t i = 0; i < size; i++) {
+        indices[runs] = indices[i];
+        runs += i == 0 || sorted[i] != sorted[i - 1];
     }
+    simd::radixsort(indices.data(), runs);
 
-    // fix index
-    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
-    if (index < 0) {
-        index = std::max(static_cast<Py_ssize_t>(0), vecSize + index);
-    } else if (index > vecSize) {
-        index = vecSize;
+    values.resize(runs);
+    for (size_t run = 0; run < runs; run++) {
+        values[run] = data[indices[run]];
     }
+}
 
-    // do insert
-    try {
-        self->vector.insert(self->vector.begin() + index, value);
-    } catch (const std::exception &e) {
-        PyErr_SetString(PyExc_RuntimeError, e.what());
+static PyObject *IntArrayList_dedupe_sorted(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (!IntArrayList_checkResizable(self)) {
         return nullptr;
     }
 
+    self->vector.resize(simd::sortedDedupe(self->vector.data(), self->vector.size()));
     Py_RETURN_NONE;
 }
 
-static PyObject *IntArrayList_remove(PyObject *pySelf, PyObject *object) {
+static PyObject *IntArrayList_unique(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
-    int value = PyLong_AsLong(object);
-    if (PyErr_Occurred()) {
+    int sorted = 0;  // default: false
+    static constexpr const char *kwlist[] = {"sorted", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", const_cast<char **>(kwlist), &sorted)) {
         return nullptr;
     }
 
-    try {
-        auto it = std::find(self->vector.begin(), self->vector.end(), value);
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
 
-        if (it != self->vector.end()) {
-            self->vector.erase(it);
+    try {
+        const auto &data = self->vector;
+        auto &values = result->vector;
+        // Sorted data has its values in order of first appearance already
+        const bool alreadySorted = std::is_sorted(data.begin(), data.end());
+
+        std::exception_ptr error;
+        if (sorted || alreadySorted) {
+            values.assign(data.begin(), data.end());
+            Py_BEGIN_ALLOW_THREADS
+                try {
+                    if (!alreadySorted) {
+                        IntArrayList_sortAscending(values);
+                    }
+                    values.resize(simd::sortedDedupe(values.data(), values.size()));
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            Py_END_ALLOW_THREADS
         } else {
-            PyErr_SetString(PyExc_ValueError, "Value is not in list.");
-            return nullptr;
+            Py_BEGIN_ALLOW_THREADS
+                try {
+                    IntArrayList_firstAppearances(data.data(), data.size(), values);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            Py_END_ALLOW_THREADS
+        }
+        if (error) {
+            std::rethrow_exception(error);
         }
     } catch (const std::exception &e) {
+        Py_DECREF(result);
         PyErr_SetString(PyExc_RuntimeError, e.what());
         return nullptr;
     }
 
-    Py_RETURN_NONE;
+    return reinterpret_cast<PyObject *>(result);
 }
 
-static PyObject *IntArrayList_sort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+static PyObject *IntArrayList_value_counts(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
-    PyObject *keyFunc = nullptr;
-    int reverseInt = 0;  // default: false
-    static constexpr const char *kwlist[] = {"key", "reverse", nullptr};
+    int asMap = 0;  // default: false
+    static constexpr const char *kwlist[] = {"as_map", nullptr};
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Oi", const_cast<char **>(kwlist), &keyFunc, &reverseInt)) {
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", const_cast<char **>(kwlist), &asMap)) {
         return nullptr;
     }
 
-    const bool reverse = reverseInt == 1;
+    const size_t size = self->vector.size();
+    if (size > static_cast<size_t>(INT_MAX)) {
+        PyErr_SetString(PyExc_OverflowError, "counts don't fit in an int");
+        return nullptr;
+    }
 
-    // do sort
-    try {
-        if (keyFunc == nullptr || keyFunc == Py_None) {
-            // simd sort with auto-fallback
-            Py_BEGIN_ALLOW_THREADS
-                simd::simdsort(self->vector, reverse);
-            Py_END_ALLOW_THREADS
-        } else {
-            // sort with key function, costs extra memory
-            const auto vecSize = self->vector.size();
-            auto vecData = self->vector.data();
-            auto **pyData = static_cast<PyObject **>(PyMem_Malloc(sizeof(PyObject *) * vecSize));
-            if (pyData == nullptr) {
-                PyErr_NoMemory();
-                return nullptr;
-            }
+    auto *values = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (values == nullptr) return nullptr;
+    auto *counts = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (counts == nullptr) {
+        Py_DECREF(values);
+        return nullptr;
+    }
 
-            for (size_t i = 0; i < vecSize; ++i) {
-                pyData[i] = PyFast_FromInt(vecData[i]);
-            }
+    try {
+        values->vector.assign(self->vector.begin(), self->vector.end());
+        counts->vector.resize(size + 1);
 
-            CPython_sort(pyData, static_cast<Py_ssize_t>(vecSize), keyFunc, reverseInt);
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                int *sorted = values->vector.data();
+                int *starts = counts->vector.data();
+                IntArrayList_sortAscending(values->vector);
+
+                // Every position is written to the next free slot, and kept there only if it starts a run
+                size_t runs = 0;
+                for (size_t i = 0; i < size; i++) {
+                    starts[runs] = static_cast<int>(i);
+                    runs += i == 0 || sorted[i] != sorted[i - 1];
+                }
+                starts[runs] = static_cast<int>(size);
 
-            for (size_t i = 0; i < vecSize; ++i) {
-                vecData[i] = PyFast_AsInt(pyData[i]);
-                Py_DECREF(pyData[i]);
+                // starts[run] >= run, so both can be compacted in place from the front
+                for (size_t run = 0; run < runs; run++) {
+                    sorted[run] = sorted[starts[run]];
+                    starts[run] = starts[run + 1] - starts[run];
+                }
+                values->vector.resize(runs);
+                counts->vector.resize(runs);
+            } catch (...) {
+                error = std::current_exception();
             }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
 
-            PyMem_FREE(pyData);
+        if (asMap) {
+            auto *map = Py_CreateObj<IntIntHashMap>(IntIntHashMapType);
+            if (map == nullptr) {
+                Py_DECREF(values);
+                Py_DECREF(counts);
+                return nullptr;
+            }
+            try {
+                map->map.reserve(values->vector.size());
+                for (size_t run = 0; run < values->vector.size(); run++) {
+                    map->map.emplace(values->vector[run], counts->vector[run]);
+                }
+            } catch (...) {
+                Py_DECREF(map);
+                throw;
+            }
+            Py_DECREF(values);
+            Py_DECREF(counts);
+            return reinterpret_cast<PyObject *>(map);
         }
     } catch (const std::exception &e) {
+        Py_DECREF(values);
+        Py_DECREF(counts);
         PyErr_SetString(PyExc_RuntimeError, e.what());
         return nullptr;
     }
 
-    Py_RETURN_NONE;
+    PyObject *pair = PyTuple_Pack(2, values, counts);
+    Py_DECREF(values);
+    Py_DECREF(counts);
+    return pair;
 }
 
 static Py_ssize_t IntArrayList_len(PyObject *pySelf) {
@@ -580,6 +1588,9 @@ static int IntArrayList_setitem(PyObject *pySelf, Py_ssize_t pyIndex, PyObject *
 
     try {
         if (pyValue == nullptr) {
+            if (!IntArrayList_checkResizable(self)) {
+                return -1;
+            }
             self->vector.erase(self->vector.begin() + pyIndex);
         } else {
             int value = PyLong_AsLong(pyValue);
@@ -627,6 +1638,10 @@ static int IntArrayList_setitem_slice(PyObject *pySelf, PyObject *slice, PyObjec
         return -1;
     }
 
+    if (newLength != sliceLength && !IntArrayList_checkResizable(self)) {
+        return -1;
+    }
+
     PyObject *item = nullptr;
     try {
         if (newLength == sliceLength) {  // only change elements
@@ -738,6 +1753,10 @@ static PyObject *IntArrayList_add(PyObject *pySelf, PyObject *pyValue) {
 static PyObject *IntArrayList_iadd(PyObject *pySelf, PyObject *iterable) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
+    if (!IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     // fast extend
     if (Py_TYPE(iterable) == &IntArrayListType) {
         auto *iter = reinterpret_cast<IntArrayList *>(iterable);
@@ -804,7 +1823,7 @@ static PyObject *IntArrayList_mul(PyObject *pySelf, Py_ssize_t n) {
         Py_BEGIN_ALLOW_THREADS
             result->vector.resize(selfSize * n);
             for (Py_ssize_t i = 0; i < n; ++i) {
-                simd::simdMemCpyAligned(self->vector.data(), result->vector.data() + selfSize * i, selfSize);
+                simd::simdMemCpy(self->vector.data(), result->vector.data() + selfSize * i, selfSize);
             }
         Py_END_ALLOW_THREADS
 
@@ -837,6 +1856,10 @@ static PyObject *IntArrayList_imul(PyObject *pySelf, Py_ssize_t n) {
         n = 0;
     }
 
+    if (n != 1 && !IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     try {
         if (n == 0) {
             self->vector.clear();
@@ -846,9 +1869,9 @@ static PyObject *IntArrayList_imul(PyObject *pySelf, Py_ssize_t n) {
             Py_BEGIN_ALLOW_THREADS
                 self->vector.resize(selfSize * n);
                 for (Py_ssize_t i = 1; i < n; ++i) {
-                    simd::simdMemCpyAligned(
+                    simd::simdMemCpy(
                             self->vector.data(),
-                            self->vector.data() + selfSize * sizeof(int) * i,
+                            self->vector.data() + selfSize * i,
                             selfSize
                     );
                 }
@@ -876,7 +1899,12 @@ static int IntArrayList_contains(PyObject *pySelf, PyObject *key) {
     }
 
     try {
-        if (std::find(self->vector.begin(), self->vector.end(), static_cast<int>(value)) != self->vector.end()) {
+        if (value < INT_MIN || value > INT_MAX) {
+            return 0;  // false
+        }
+
+        const auto size = self->vector.size();
+        if (simd::simdFind(self->vector.data(), size, static_cast<int>(value)) != size) {
             return 1;  // true
         } else {
             return 0;  // false
@@ -907,10 +1935,117 @@ static PyObject *IntArrayList_reverse(PyObject *pySelf) {
 static PyObject *IntArrayList_clear(PyObject *pySelf) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
+    if (!IntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
     self->vector.clear();
     Py_RETURN_NONE;
 }
 
+static PyObject *IntArrayList_sum(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    long long result;
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdSum(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyLong_FromLongLong(result);
+}
+
+static PyObject *IntArrayList_min(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "min() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<int> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyFast_FromInt(result.min);
+}
+
+static PyObject *IntArrayList_max(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "max() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<int> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyFast_FromInt(result.max);
+}
+
+static PyObject *IntArrayList_minmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "minmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<int> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+
+    PyObject *min = PyFast_FromInt(result.min);
+    if (min == nullptr) {
+        return nullptr;
+    }
+    PyObject *max = PyFast_FromInt(result.max);
+    if (max == nullptr) {
+        Py_DECREF(min);
+        return nullptr;
+    }
+
+    PyObject *tuple = PyTuple_Pack(2, min, max);
+    Py_DECREF(min);
+    Py_DECREF(max);
+    return tuple;
+}
+
+static PyObject *IntArrayList_argmin(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmin() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the min, like list.index(min(list))
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        const int min = simd::simdMinMax(self->vector.data(), self->vector.size()).min;
+        index = simd::simdFind(self->vector.data(), self->vector.size(), min);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *IntArrayList_argmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the max, like list.index(max(list))
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        const int max = simd::simdMinMax(self->vector.data(), self->vector.size()).max;
+        index = simd::simdFind(self->vector.data(), self->vector.size(), max);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
 static __forceinline PyObject *IntArrayList_eq(PyObject *pySelf, PyObject *pyValue) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
@@ -1150,27 +2285,37 @@ static PyObject *IntArrayList_str(PyObject *pySelf) {
     return IntArrayList_repr(pySelf);
 }
 
-static int IntArrayList_get_buffer(PyObject *pySelf, Py_buffer *view, [[maybe_unused]] int flags) {
-    if (view == nullptr) return -1;
+static int IntArrayList_get_buffer(PyObject *pySelf, Py_buffer *view, int flags) {
     auto *self = reinterpret_cast<IntArrayList *>(pySelf);
 
+    // every export shares this shape, it can't change while any of them is alive
     self->shape = static_cast<Py_ssize_t>(self->vector.size());
-    view->format = const_cast<char *>("i");
+
+    Py_INCREF(pySelf);
+    view->obj = pySelf;
     view->buf = self->vector.data();
     view->len = static_cast<Py_ssize_t>(self->vector.size() * sizeof(int));
     view->itemsize = sizeof(int);
     view->readonly = 0;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? const_cast<char *>("i") : nullptr;
     view->ndim = 1;
-    view->shape = &self->shape;
-    view->strides = nullptr;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? &self->shape : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &view->itemsize : nullptr;
     view->suboffsets = nullptr;
     view->internal = nullptr;
 
+    ++self->exports;
     return 0;
 }
 
+static void IntArrayList_release_buffer(PyObject *pySelf, [[maybe_unused]] Py_buffer *view) {
+    --reinterpret_cast<IntArrayList *>(pySelf)->exports;
+}
+
 static PyMethodDef IntArrayList_methods[] = {
         {"from_range", (PyCFunction) IntArrayList_from_range, METH_VARARGS | METH_STATIC},
+        {"frombuffer", (PyCFunction) IntArrayList_frombuffer, METH_O | METH_STATIC},
+        {"view", (PyCFunction) IntArrayList_view, METH_VARARGS | METH_KEYWORDS},
         {"resize", (PyCFunction) IntArrayList_resize, METH_O},
         {"to_list", (PyCFunction) IntArrayList_to_list, METH_NOARGS},
         {"copy", (PyCFunction) IntArrayList_copy, METH_NOARGS},
@@ -1179,11 +2324,37 @@ static PyMethodDef IntArrayList_methods[] = {
         {"pop", (PyCFunction) IntArrayList_pop, METH_FASTCALL},
         {"index", (PyCFunction) IntArrayList_index, METH_VARARGS},
         {"count", (PyCFunction) IntArrayList_count, METH_O},
+        {"count_all", (PyCFunction) IntArrayList_count_all, METH_O},
         {"insert", (PyCFunction) IntArrayList_insert, METH_VARARGS},
         {"remove", (PyCFunction) IntArrayList_remove, METH_O},
         {"sort", (PyCFunction) IntArrayList_sort, METH_VARARGS | METH_KEYWORDS},
+        {"argsort", (PyCFunction) IntArrayList_argsort, METH_VARARGS | METH_KEYWORDS},
+        {"sort_with", (PyCFunction) IntArrayList_sort_with, METH_VARARGS | METH_KEYWORDS},
+        {"nth_element", (PyCFunction) IntArrayList_nth_element, METH_VARARGS | METH_KEYWORDS},
+        {"partial_sort", (PyCFunction) IntArrayList_partial_sort, METH_VARARGS | METH_KEYWORDS},
+        {"top_k", (PyCFunction) IntArrayList_top_k, METH_VARARGS | METH_KEYWORDS},
+        {"select", (PyCFunction) IntArrayList_select, METH_O},
+        {"to_bitset", (PyCFunction) IntArrayList_to_bitset, METH_O},
+        {"sorted_intersect", (PyCFunction) IntArrayList_sorted_intersect, METH_O},
+        {"sorted_union", (PyCFunction) IntArrayList_sorted_union, METH_O},
+        {"sorted_difference", (PyCFunction) IntArrayList_sorted_difference, METH_O},
+        {"merge", (PyCFunction) IntArrayList_merge, METH_O},
+        {"merge_many", (PyCFunction) IntArrayList_merge_many, METH_O | METH_STATIC},
+        {"bisect_left", (PyCFunction) IntArrayList_bisect_left, METH_VARARGS | METH_KEYWORDS},
+        {"bisect_right", (PyCFunction) IntArrayList_bisect_right, METH_VARARGS | METH_KEYWORDS},
+        {"searchsorted", (PyCFunction) IntArrayList_searchsorted, METH_VARARGS | METH_KEYWORDS},
+        {"contains_sorted", (PyCFunction) IntArrayList_contains_sorted, METH_O},
+        {"dedupe_sorted", (PyCFunction) IntArrayList_dedupe_sorted, METH_NOARGS},
+        {"unique", (PyCFunction) IntArrayList_unique, METH_VARARGS | METH_KEYWORDS},
+        {"value_counts", (PyCFunction) IntArrayList_value_counts, METH_VARARGS | METH_KEYWORDS},
         {"reverse", (PyCFunction) IntArrayList_reverse, METH_NOARGS},
         {"clear", (PyCFunction) IntArrayList_clear, METH_NOARGS},
+        {"sum", (PyCFunction) IntArrayList_sum, METH_NOARGS},
+        {"min", (PyCFunction) IntArrayList_min, METH_NOARGS},
+        {"max", (PyCFunction) IntArrayList_max, METH_NOARGS},
+        {"minmax", (PyCFunction) IntArrayList_minmax, METH_NOARGS},
+        {"argmin", (PyCFunction) IntArrayList_argmin, METH_NOARGS},
+        {"argmax", (PyCFunction) IntArrayList_argmax, METH_NOARGS},
         {"__rmul__", (PyCFunction) IntArrayList_rmul, METH_O},
         {"__reversed__", (PyCFunction) IntArrayList_reversed, METH_NOARGS},
 #ifdef IS_PYTHON_39_OR_LATER
@@ -1221,7 +2392,7 @@ static PyMappingMethods IntArrayList_asMapping = {
 
 static PyBufferProcs IntArrayList_asBuffer = {
         IntArrayList_get_buffer,
-        nullptr
+        IntArrayList_release_buffer
 };
 
 void initializeIntArrayListType(PyTypeObject &type) {
@@ -1249,6 +2420,8 @@ void initializeIntArrayListType(PyTypeObject &type) {
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_IntArrayList() {
     initializeIntArrayListType(IntArrayListType);
+    if (PyType_Ready(&IntArrayListType) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&IntArrayList_module);
     if (object == nullptr)
@@ -15,7 +15,11 @@ typedef struct IntArrayList {
     // we use 64 bytes memory aligned to support faster SIMD, suggestion by ChatGPT.
     std::vector<int, AlignedAllocator<int, 64>> vector;
     Py_ssize_t shape = 0;
+    // live buffer exports, the vector must not be resized while there are any
+    Py_ssize_t exports = 0;
 } IntArrayList;
+
+extern PyTypeObject IntArrayListType;
 }
 
 PyMODINIT_FUNC PyInit_IntArrayList();
@@ -0,0 +1,814 @@
+//
+// Created by xia__mc on 2024/12/3.
+//
+
+#include "IntHashSet.h"
+#include <climits>
+#include <string>
+#include "utils/PythonUtils.h"
+#include "utils/IntBuffer.h"
+#include "ints/IntHashSetIter.h"
+
+static __forceinline bool isIntRange(const long long value) {
+    return value >= INT_MIN && value <= INT_MAX;
+}
+
+/**
+ * Add every element of buffer to set.
+ * @return false if an element is out of the range of C int, elements before it are still added
+ */
+static __forceinline bool addAll(ankerl::unordered_dense::set<int> &set, const IntBuffer &buffer) {
+    bool inRange = true;
+    set.reserve(set.size() + buffer.size);
+    IntBuffer_forEach(buffer, [&set, &inRange](const auto value) {
+        if (LIKELY(isIntRange(value))) {
+            set.insert(static_cast<int>(value));
+        } else {
+            inRange = false;
+        }
+    });
+    return inRange;
+}
+
+/**
+ * Keep only the elements of set which are also in buffer.
+ */
+static __forceinline void retainAll(ankerl::unordered_dense::set<int> &set, const IntBuffer &buffer) {
+    ankerl::unordered_dense::set<int> result;
+    IntBuffer_forEach(buffer, [&set, &result](const auto value) {
+        if (isIntRange(value) && set.contains(static_cast<int>(value))) {
+            result.insert(static_cast<int>(value));
+        }
+    });
+    set.swap(result);
+}
+
+static __forceinline void removeAll(ankerl::unordered_dense::set<int> &set, const IntBuffer &buffer) {
+    IntBuffer_forEach(buffer, [&set](const auto value) {
+        if (isIntRange(value)) {
+            set.erase(static_cast<int>(value));
+        }
+    });
+}
+
+/**
+ * Python set semantics: duplicated elements in buffer are only toggled once.
+ * @return false if an element is out of the range of C int
+ */
+static __forceinline bool toggleAll(ankerl::unordered_dense::set<int> &set, const IntBuffer &buffer) {
+    ankerl::unordered_dense::set<int> other;
+    if (!addAll(other, buffer)) return false;
+
+    for (const int value: other) {
+        if (set.erase(value) == 0) {
+            set.insert(value);
+        }
+    }
+    return true;
+}
+
+/**
+ * Run op(set, buffer) over an IntArrayList, a BigIntArrayList or a buffer without boxing elements.
+ * @return if successful
+ */
+template<typename Op>
+static __forceinline bool withIntBuffer(ankerl::unordered_dense::set<int> &set, PyObject *other, Op op) {
+    IntBuffer buffer;
+    if (!IntBuffer_open(other, buffer)) return false;
+
+    bool inRange;
+    try {
+        inRange = op(set, buffer);
+    } catch (...) {
+        IntBuffer_release(buffer);
+        throw;
+    }
+    IntBuffer_release(buffer);
+
+    if (!inRange) {
+        PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+    }
+    return inRange;
+}
+
+
+extern "C" {
+
+PyTypeObject IntHashSetType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+/**
+ * Convert a python object to C int, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, int &result) {
+    const long value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+#if LONG_MAX > INT_MAX
+    if (UNLIKELY(value > INT_MAX || value < INT_MIN)) {
+        PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+        return false;
+    }
+#endif
+    result = static_cast<int>(value);
+    return true;
+}
+
+/**
+ * Convert a lookup key. Unlike convert, keys which can't be a C int are simply "not in the set".
+ * @return 1 if converted, 0 if the key can't be in the set, -1 if error
+ */
+static __forceinline int convertKey(PyObject *obj, int &result) {
+    if (!PyLong_Check(obj)) {
+        return 0;
+    }
+
+    int overflow = 0;
+    const long value = PyLong_AsLongAndOverflow(obj, &overflow);
+    if (value == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (overflow != 0 || value > INT_MAX || value < INT_MIN) {
+        return 0;
+    }
+    result = static_cast<int>(value);
+    return 1;
+}
+
+static __forceinline bool isIntBuffer(PyObject *obj) {
+    return Py_TYPE(obj) == &IntArrayListType || Py_TYPE(obj) == &BigIntArrayListType || PyObject_CheckBuffer(obj);
+}
+
+static __forceinline IntHashSet *IntHashSet_new() {
+    return Py_CreateObj<IntHashSet>(IntHashSetType);
+}
+
+/**
+ * Collect an iterable of python ints into a temporary set.
+ * If strict is false, elements which can't be in the set (wrong type or out of range) are skipped instead of raising.
+ * @return if successful
+ */
+static bool collectIterable(PyObject *iterable, ankerl::unordered_dense::set<int> &result, const bool strict) {
+    PyObject *iter = PyObject_GetIter(iterable);
+    if (iter == nullptr) {
+        return false;
+    }
+
+    Py_ssize_t hint = PyObject_LengthHint(iterable, 0);
+    if (hint > 0) {
+        result.reserve(static_cast<size_t>(hint));
+    }
+
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        int value;
+        const int converted = strict ? (convert(item, value) ? 1 : -1) : convertKey(item, value);
+        SAFE_DECREF(item);
+        if (converted == -1) {
+            SAFE_DECREF(iter);
+            return false;
+        }
+        if (converted == 1) {
+            result.insert(value);
+        }
+    }
+    SAFE_DECREF(iter);
+    return !PyErr_Occurred();
+}
+
+static int IntHashSet_updateFrom(IntHashSet *self, PyObject *other) {
+    try {
+        if (Py_TYPE(other) == &IntHashSetType) {
+            const auto &set = reinterpret_cast<IntHashSet *>(other)->set;
+            if (self->set.empty()) {
+                self->set = set;
+            } else {
+                self->set.insert(set.begin(), set.end());
+            }
+            return 0;
+        }
+
+        if (isIntBuffer(other)) {
+            return withIntBuffer(self->set, other, addAll) ? 0 : -1;
+        }
+
+        PyObject *iter = PyObject_GetIter(other);
+        if (iter == nullptr) {
+            return -1;
+        }
+
+        Py_ssize_t hint = PyObject_LengthHint(other, 0);
+        if (hint > 0) {
+            self->set.reserve(self->set.size() + static_cast<size_t>(hint));
+        }
+
+        PyObject *item;
+        while ((item = PyIter_Next(iter)) != nullptr) {
+            int value;
+            const bool success = convert(item, value);
+            SAFE_DECREF(item);
+            if (!success) {
+                SAFE_DECREF(iter);
+                return -1;
+            }
+            self->set.insert(value);
+        }
+        SAFE_DECREF(iter);
+        return PyErr_Occurred() ? -1 : 0;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+}
+
+static int IntHashSet_init(IntHashSet *self, PyObject *args, PyObject *kwargs) {
+    new(&self->set) ankerl::unordered_dense::set<int>();
+
+    static constexpr const char *kwlist[] = {"iterable", nullptr};
+
+    PyObject *arg = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &arg)) {
+        return -1;
+    }
+
+    if (arg == nullptr) {
+        return 0;
+    }
+    return IntHashSet_updateFrom(self, arg);
+}
+
+static void IntHashSet_dealloc(IntHashSet *self) {
+    self->set.~table();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *IntHashSet_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    auto *copy = IntHashSet_new();
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    try {
+        copy->set = self->set;
+    } catch (const std::exception &e) {
+        SAFE_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *IntHashSet_add(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    int value;
+    if (!convert(object, value)) return nullptr;
+
+    try {
+        self->set.insert(value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntHashSet_discard(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    int value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+
+    if (converted == 1) {
+        self->set.erase(value);
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntHashSet_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    int value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+
+    if (converted == 0 || self->set.erase(value) == 0) {
+        PyErr_SetObject(PyExc_KeyError, object);
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntHashSet_pop(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    if (self->set.empty()) {
+        PyErr_SetString(PyExc_KeyError, "pop from an empty set");
+        return nullptr;
+    }
+
+    // the last element is the cheapest to remove, nothing needs to be moved
+    const int value = self->set.values().back();
+    self->set.erase(value);
+    return PyFast_FromInt(value);
+}
+
+static PyObject *IntHashSet_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    self->set.clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntHashSet_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    if (IntHashSet_updateFrom(self, other) == -1) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntHashSet_intersection_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    try {
+        if (Py_TYPE(other) == &IntHashSetType) {
+            const auto &set = reinterpret_cast<IntHashSet *>(other)->set;
+            if (&set != &self->set) {
+                std::erase_if(self->set, [&set](const int value) { return !set.contains(value); });
+            }
+            Py_RETURN_NONE;
+        }
+
+        if (isIntBuffer(other)) {
+            if (!withIntBuffer(self->set, other, [](auto &set, const IntBuffer &buffer) {
+                retainAll(set, buffer);
+                return true;
+            })) {
+                return nullptr;
+            }
+            Py_RETURN_NONE;
+        }
+
+        ankerl::unordered_dense::set<int> set;
+        if (!collectIterable(other, set, false)) return nullptr;
+        std::erase_if(self->set, [&set](const int value) { return !set.contains(value); });
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntHashSet_difference_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    try {
+        if (Py_TYPE(other) == &IntHashSetType) {
+            const auto &set = reinterpret_cast<IntHashSet *>(other)->set;
+            if (&set == &self->set) {
+                self->set.clear();
+            } else if (set.size() < self->set.size()) {
+                for (const int value: set) {
+                    self->set.erase(value);
+                }
+            } else {
+                std::erase_if(self->set, [&set](const int value) { return set.contains(value); });
+            }
+            Py_RETURN_NONE;
+        }
+
+        if (isIntBuffer(other)) {
+            if (!withIntBuffer(self->set, other, [](auto &set, const IntBuffer &buffer) {
+                removeAll(set, buffer);
+                return true;
+            })) {
+                return nullptr;
+            }
+            Py_RETURN_NONE;
+        }
+
+        ankerl::unordered_dense::set<int> set;
+        if (!collectIterable(other, set, false)) return nullptr;
+        for (const int value: set) {
+            self->set.erase(value);
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntHashSet_symmetric_difference_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    try {
+        if (Py_TYPE(other) == &IntHashSetType) {
+            if (other == pySelf) {
+                self->set.clear();
+                Py_RETURN_NONE;
+            }
+            for (const int value: reinterpret_cast<IntHashSet *>(other)->set) {
+                if (self->set.erase(value) == 0) {
+                    self->set.insert(value);
+                }
+            }
+            Py_RETURN_NONE;
+        }
+
+        if (isIntBuffer(other)) {
+            if (!withIntBuffer(self->set, other, toggleAll)) return nullptr;
+            Py_RETURN_NONE;
+        }
+
+        ankerl::unordered_dense::set<int> set;
+        if (!collectIterable(other, set, true)) return nullptr;
+        for (const int value: set) {
+            if (self->set.erase(value) == 0) {
+                self->set.insert(value);
+            }
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t IntHashSet_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->set.size());
+}
+
+static PyObject *IntHashSet_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    auto iter = IntHashSetIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static int IntHashSet_contains(PyObject *pySelf, PyObject *key) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    int value;
+    const int converted = convertKey(key, value);
+    if (converted != 1) return converted;
+
+    return self->set.contains(value) ? 1 : 0;
+}
+
+// set algebra, like python's set both operands must be sets
+
+static PyObject *IntHashSet_or(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &IntHashSetType || Py_TYPE(pyRight) != &IntHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const auto &left = reinterpret_cast<IntHashSet *>(pyLeft)->set;
+    const auto &right = reinterpret_cast<IntHashSet *>(pyRight)->set;
+    const auto &larger = left.size() >= right.size() ? left : right;
+    const auto &smaller = left.size() >= right.size() ? right : left;
+
+    auto *result = IntHashSet_new();
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        result->set = larger;
+        result->set.insert(smaller.begin(), smaller.end());
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntHashSet_and(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &IntHashSetType || Py_TYPE(pyRight) != &IntHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const auto &left = reinterpret_cast<IntHashSet *>(pyLeft)->set;
+    const auto &right = reinterpret_cast<IntHashSet *>(pyRight)->set;
+    const auto &larger = left.size() >= right.size() ? left : right;
+    const auto &smaller = left.size() >= right.size() ? right : left;
+
+    auto *result = IntHashSet_new();
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        // probe the larger set with the elements of the smaller one
+        for (const int value: smaller) {
+            if (larger.contains(value)) {
+                result->set.insert(value);
+            }
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntHashSet_sub(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &IntHashSetType || Py_TYPE(pyRight) != &IntHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const auto &left = reinterpret_cast<IntHashSet *>(pyLeft)->set;
+    const auto &right = reinterpret_cast<IntHashSet *>(pyRight)->set;
+
+    auto *result = IntHashSet_new();
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        for (const int value: left) {
+            if (!right.contains(value)) {
+                result->set.insert(value);
+            }
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntHashSet_xor(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &IntHashSetType || Py_TYPE(pyRight) != &IntHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const auto &left = reinterpret_cast<IntHashSet *>(pyLeft)->set;
+    const auto &right = reinterpret_cast<IntHashSet *>(pyRight)->set;
+
+    auto *result = IntHashSet_new();
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        for (const int value: left) {
+            if (!right.contains(value)) {
+                result->set.insert(value);
+            }
+        }
+        for (const int value: right) {
+            if (!left.contains(value)) {
+                result->set.insert(value);
+            }
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntHashSet_ior(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &IntHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    if (IntHashSet_updateFrom(reinterpret_cast<IntHashSet *>(pySelf), other) == -1) {
+        return nullptr;
+    }
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *IntHashSet_iand(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &IntHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    PyObject *result = IntHashSet_intersection_update(pySelf, other);
+    if (result == nullptr) return nullptr;
+    Py_DECREF(result);
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *IntHashSet_isub(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &IntHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    PyObject *result = IntHashSet_difference_update(pySelf, other);
+    if (result == nullptr) return nullptr;
+    Py_DECREF(result);
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *IntHashSet_ixor(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &IntHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    PyObject *result = IntHashSet_symmetric_difference_update(pySelf, other);
+    if (result == nullptr) return nullptr;
+    Py_DECREF(result);
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static __forceinline PyObject *IntHashSet_eq(PyObject *pySelf, PyObject *pyValue) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    if (Py_TYPE(pyValue) == &IntHashSetType) {
+        // fast compare
+        const auto &set = reinterpret_cast<IntHashSet *>(pyValue)->set;
+        if (set.size() != self->set.size())
+            Py_RETURN_FALSE;
+
+        for (const int value: self->set) {
+            if (!set.contains(value))
+                Py_RETURN_FALSE;
+        }
+        Py_RETURN_TRUE;
+    }
+
+    if (!PyAnySet_Check(pyValue))
+        Py_RETURN_NOTIMPLEMENTED;
+
+    // for set and frozenset
+    if (PySet_GET_SIZE(pyValue) != static_cast<Py_ssize_t>(self->set.size()))
+        Py_RETURN_FALSE;
+
+    PyObject *iter = PyObject_GetIter(pyValue);
+    if (iter == nullptr) return nullptr;
+
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        int value;
+        const int converted = convertKey(item, value);
+        SAFE_DECREF(item);
+        if (converted == -1) {
+            SAFE_DECREF(iter);
+            return nullptr;
+        }
+        if (converted == 0 || !self->set.contains(value)) {
+            SAFE_DECREF(iter);
+            Py_RETURN_FALSE;
+        }
+    }
+    SAFE_DECREF(iter);
+    if (PyErr_Occurred()) return nullptr;
+
+    Py_RETURN_TRUE;
+}
+
+static PyObject *IntHashSet_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    PyObject *isEq;
+    switch (op) {
+        case Py_EQ:  // ==
+            return IntHashSet_eq(pySelf, pyValue);
+        case Py_NE:  // !=
+            isEq = IntHashSet_eq(pySelf, pyValue);
+            if (isEq == nullptr || isEq == Py_NotImplemented)
+                return isEq;
+            if (isEq == Py_True) {
+                SAFE_DECREF(isEq);
+                Py_RETURN_FALSE;
+            } else {
+                SAFE_DECREF(isEq);
+                Py_RETURN_TRUE;
+            }
+        default:
+            Py_RETURN_NOTIMPLEMENTED;
+    }
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *IntHashSet_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static PyObject *IntHashSet_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntHashSet *>(pySelf);
+
+    const auto &values = self->set.values();
+
+    if (values.empty()) {
+        return PyUnicode_FromString("set()");
+    }
+
+    auto str = std::string("{");
+    str.reserve(values.size() * 4);
+
+    char buffer[32];
+
+    for (const int value: values) {
+        // to string
+        int len = snprintf(buffer, sizeof(buffer), "%d, ", value);
+        str.append(buffer, len);
+    }
+
+    str.resize(str.size() - 2);
+    str += "}";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
+static PyMethodDef IntHashSet_methods[] = {
+        {"copy", (PyCFunction) IntHashSet_copy, METH_NOARGS},
+        {"add", (PyCFunction) IntHashSet_add, METH_O},
+        {"discard", (PyCFunction) IntHashSet_discard, METH_O},
+        {"remove", (PyCFunction) IntHashSet_remove, METH_O},
+        {"pop", (PyCFunction) IntHashSet_pop, METH_NOARGS},
+        {"clear", (PyCFunction) IntHashSet_clear, METH_NOARGS},
+        {"update", (PyCFunction) IntHashSet_update, METH_O},
+        {"intersection_update", (PyCFunction) IntHashSet_intersection_update, METH_O},
+        {"difference_update", (PyCFunction) IntHashSet_difference_update, METH_O},
+        {"symmetric_difference_update", (PyCFunction) IntHashSet_symmetric_difference_update, METH_O},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) IntHashSet_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef IntHashSet_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.IntHashSet",
+        "An IntHashSet_module that creates an IntHashSet",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods IntHashSet_asSequence = {
+        IntHashSet_len,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        IntHashSet_contains,
+        nullptr,
+        nullptr
+};
+
+static PyNumberMethods IntHashSet_asNumber = {
+        .nb_subtract = IntHashSet_sub,
+        .nb_and = IntHashSet_and,
+        .nb_xor = IntHashSet_xor,
+        .nb_or = IntHashSet_or,
+        .nb_inplace_subtract = IntHashSet_isub,
+        .nb_inplace_and = IntHashSet_iand,
+        .nb_inplace_xor = IntHashSet_ixor,
+        .nb_inplace_or = IntHashSet_ior,
+};
+
+void initializeIntHashSetType(PyTypeObject &type) {
+    type.tp_name = "IntHashSet";
+    type.tp_basicsize = sizeof(IntHashSet);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &IntHashSet_asSequence;
+    type.tp_as_number = &IntHashSet_asNumber;
+    type.tp_iter = IntHashSet_iter;
+    type.tp_methods = IntHashSet_methods;
+    type.tp_init = (initproc) IntHashSet_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) IntHashSet_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = IntHashSet_compare;
+    type.tp_repr = IntHashSet_repr;
+    type.tp_str = IntHashSet_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_IntHashSet() {
+    initializeIntHashSetType(IntHashSetType);
+    if (PyType_Ready(&IntHashSetType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&IntHashSet_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&IntHashSetType);
+    if (PyModule_AddObject(object, "IntHashSet", (PyObject *) &IntHashSetType) < 0) {
+        Py_DECREF(&IntHashSetType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
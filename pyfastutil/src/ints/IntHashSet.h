@@ -0,0 +1,22 @@
+//
+// Created by xia__mc on 2024/12/3.
+//
+
+#ifndef PYFASTUTIL_INTHASHSET_H
+#define PYFASTUTIL_INTHASHSET_H
+
+#include "utils/PythonPCH.h"
+#include "utils/include/UnorderedDense.h"
+
+extern "C" {
+typedef struct IntHashSet {
+    PyObject_HEAD;
+    ankerl::unordered_dense::set<int> set;
+} IntHashSet;
+
+extern PyTypeObject IntHashSetType;
+}
+
+PyMODINIT_FUNC PyInit_IntHashSet();
+
+#endif //PYFASTUTIL_INTHASHSET_H
@@ -0,0 +1,101 @@
+//
+// Created by xia__mc on 2024/12/3.
+//
+
+#include "IntHashSetIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject IntHashSetIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+IntHashSetIter *IntHashSetIter_create(IntHashSet *set) {
+    auto *instance = Py_CreateObjNoInit<IntHashSetIter>(IntHashSetIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(set);
+    instance->container = set;
+    instance->index = 0;
+    instance->size = set->set.size();
+
+    return instance;
+}
+
+static void IntHashSetIter_dealloc(IntHashSetIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *IntHashSetIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntHashSetIter *>(pySelf);
+
+    // elements are stored densely, so iterating is just walking the values vector
+    const auto &values = self->container->set.values();
+    if (UNLIKELY(values.size() != self->size)) {
+        PyErr_SetString(PyExc_RuntimeError, "IntHashSet changed size during iteration");
+        return nullptr;
+    }
+
+    if (self->index >= values.size()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    return PyFast_FromInt(values[self->index++]);
+}
+
+static PyObject *IntHashSetIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef IntHashSetIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef IntHashSetIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.IntHashSetIter",
+        "An IntHashSetIter_module that creates an IntHashSetIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeIntHashSetIterType(PyTypeObject &type) {
+    type.tp_name = "IntHashSetIter";
+    type.tp_basicsize = sizeof(IntHashSetIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = IntHashSetIter_iter;
+    type.tp_iternext = IntHashSetIter_next;
+    type.tp_methods = IntHashSetIter_methods;
+    type.tp_dealloc = (destructor) IntHashSetIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_IntHashSetIter() {
+    initializeIntHashSetIterType(IntHashSetIterType);
+    if (PyType_Ready(&IntHashSetIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&IntHashSetIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&IntHashSetIterType);
+    if (PyModule_AddObject(object, "IntHashSetIter", (PyObject *) &IntHashSetIterType) < 0) {
+        Py_DECREF(&IntHashSetIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
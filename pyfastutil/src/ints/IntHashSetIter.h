@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/3.
+//
+
+#ifndef PYFASTUTIL_INTHASHSETITER_H
+#define PYFASTUTIL_INTHASHSETITER_H
+
+#include "utils/PythonPCH.h"
+#include "IntHashSet.h"
+
+extern "C" {
+typedef struct IntHashSetIter {
+    PyObject_HEAD;
+    IntHashSet *container;
+    size_t index;
+    size_t size;  // size when the iterator was created, used to detect modification
+} IntHashSetIter;
+
+IntHashSetIter *IntHashSetIter_create(IntHashSet *set);
+
+}
+
+PyMODINIT_FUNC PyInit_IntHashSetIter();
+
+#endif //PYFASTUTIL_INTHASHSETITER_H
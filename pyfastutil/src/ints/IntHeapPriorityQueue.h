@@ -0,0 +1,20 @@
+//
+// Created by xia__mc on 2024/12/25.
+//
+
+#ifndef PYFASTUTIL_INTHEAPPRIORITYQUEUE_H
+#define PYFASTUTIL_INTHEAPPRIORITYQUEUE_H
+
+#include "utils/PythonPCH.h"
+#include "utils/DaryHeap.h"
+
+extern "C" {
+typedef struct IntHeapPriorityQueue {
+    PyObject_HEAD;
+    DaryHeap<int, int> heap;
+} IntHeapPriorityQueue;
+}
+
+PyMODINIT_FUNC PyInit_IntHeapPriorityQueue();
+
+#endif //PYFASTUTIL_INTHEAPPRIORITYQUEUE_H
@@ -3,247 +3,290 @@
 //
 
 #include "IntIntHashMap.h"
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include "utils/PythonUtils.h"
+#include "utils/IntBuffer.h"
+#include "utils/memory/PreFetch.h"
+#include "ints/IntArrayList.h"
+#include "ints/IntIntHashMapIter.h"
+
+// how many keys ahead of the current one a batched operation prefetches buckets for
+static constexpr size_t BATCH_PREFETCH_DISTANCE = 16;
+
+static __forceinline bool isIntRange(const long long value) {
+    return value >= INT_MIN && value <= INT_MAX;
+}
+
+static __forceinline bool checkIntRange(const IntBuffer &buffer) {
+    if (buffer.longs == nullptr) return true;
+
+    bool inRange = true;
+    Py_BEGIN_ALLOW_THREADS
+        for (size_t i = 0; i < buffer.size; ++i) {
+            inRange &= isIntRange(buffer.longs[i]);
+        }
+    Py_END_ALLOW_THREADS
+
+    if (!inRange) {
+        PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+    }
+    return inRange;
+}
+
+/**
+ * Look up every key in keys, prefetching the buckets of the keys a few steps ahead so the cache misses
+ * of a large batch overlap instead of being paid one by one.
+ * @param consumer called with (index, iterator) for every key, iterator is end() if the key is missing
+ */
+template<typename T, typename Consumer>
+static __forceinline void lookupMany(const ankerl::unordered_dense::map<int, int> &map,
+                                     const T *keys, const size_t size, Consumer consumer) {
+    const auto end = map.end();
+
+    for (size_t i = 0; i < size; ++i) {
+        if (i + BATCH_PREFETCH_DISTANCE < size) {
+            const T ahead = keys[i + BATCH_PREFETCH_DISTANCE];
+            if (isIntRange(ahead)) {
+                prefetchL1(map.bucket_address(static_cast<int>(ahead)));
+            }
+        }
+
+        const T key = keys[i];
+        consumer(i, isIntRange(key) ? map.find(static_cast<int>(key)) : end);
+    }
+}
 
 
 extern "C" {
 
-static PyTypeObject IntIntHashMapType = {
+PyTypeObject IntIntHashMapType = {
         PyVarObject_HEAD_INIT(&PyType_Type, 0)
 };
 
-static __forceinline int convert(PyObject *&obj) {  // maybe I will take it to IntArrayList or something else
-    return PyLong_Check(obj) ? PyFast_AsInt(obj) : PyLong_AsLong(obj);
+/**
+ * Convert a python object to C int, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, int &result) {
+    const long value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+#if LONG_MAX > INT_MAX
+    if (UNLIKELY(value > INT_MAX || value < INT_MIN)) {
+        PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+        return false;
+    }
+#endif
+    result = static_cast<int>(value);
+    return true;
 }
 
-static int IntIntHashMap_init(IntIntHashMap *self, PyObject *args, PyObject *kwargs) {
-    new(&self->map) ankerl::unordered_dense::map<int, int>();
-
-    IntIntHashMap *map = nullptr;
-    PyObject *pyDict = nullptr;
-    PyObject *pyMapping = nullptr;
-
-    PyObject *pyIterable = nullptr;
-    PyObject *extraKwargs = nullptr;
+/**
+ * Convert a lookup key. Unlike convert, keys which can't be a C int are simply "not in the map".
+ * @return 1 if converted, 0 if the key can't be in the map, -1 if error
+ */
+static __forceinline int convertKey(PyObject *obj, int &result) {
+    if (!PyLong_Check(obj)) {
+        return 0;
+    }
 
-    // parse args
-    if (PyTuple_GET_SIZE(args) > 1) {
-        PyErr_SetString(PyExc_TypeError, "expected at most 1 argument");
+    int overflow = 0;
+    const long value = PyLong_AsLongAndOverflow(obj, &overflow);
+    if (value == -1 && PyErr_Occurred()) {
         return -1;
     }
+    if (overflow != 0 || value > INT_MAX || value < INT_MIN) {
+        return 0;
+    }
+    result = static_cast<int>(value);
+    return 1;
+}
 
-    static constexpr const char *kwlist[] = {"__map", "__iterable", nullptr};
+static __forceinline void setKeyError(PyObject *key) {
+    PyObject *tuple = PyTuple_Pack(1, key);
+    if (tuple == nullptr) return;
+    PyErr_SetObject(PyExc_KeyError, tuple);
+    Py_DECREF(tuple);
+}
 
-    PyObject *arg1 = nullptr;
-    PyObject *arg2 = nullptr;
+/**
+ * Check that no batch call is probing the map with the GIL released.
+ * If not, function will raise BufferError.
+ * @return if the map can be changed
+ */
+static __forceinline bool IntIntHashMap_checkMutable(const IntIntHashMap *self) noexcept {
+    if (self->batches > 0) {
+        PyErr_SetString(PyExc_BufferError, "IntIntHashMap cannot be changed while a batch call is running");
+        return false;
+    }
+    return true;
+}
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", const_cast<char **>(kwlist), &arg1, &arg2, &extraKwargs)) {
-        return -1;
+static __forceinline bool updateFromEntry(IntIntHashMap *self, PyObject *entry) {
+    PyObject *fastEntry = PySequence_Fast(entry, "expected an iterable of (key, value) pairs.");
+    if (fastEntry == nullptr) {
+        return false;
     }
 
-    static const auto keyAttr = PyUnicode_FromString("keys");
-
-    if (arg1 != nullptr) {
-        if (Py_TYPE(arg1) == &IntIntHashMapType) {
-            map = reinterpret_cast<IntIntHashMap *>(arg1);
-            pyIterable = arg2;
-        } else if (PyDict_Check(arg1)) {
-            pyDict = arg1;
-            pyIterable = arg2;
-        } else if (PyIter_Check(arg1)) {
-            pyIterable = arg1;
-            pyMapping = arg2;
-        } else if (PyMapping_Check(arg1) && PyObject_HasAttr(arg1, keyAttr)) {
-            pyMapping = arg1;
-            pyIterable = arg2;
-        } else {
-            PyErr_SetString(PyExc_TypeError, "expected a iterable or a mapping");
-            return -1;
-        }
+    if (PySequence_Fast_GET_SIZE(fastEntry) != 2) {
+        SAFE_DECREF(fastEntry);
+        PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
+        return false;
     }
 
-    // init map
-    static const auto processExtraKwargs = [&self, &extraKwargs]() -> int {
-        if (extraKwargs != nullptr) {
-            PyObject *key, *value;
-            Py_ssize_t pos = 0;
+    int key, value;
+    auto items = PySequence_Fast_ITEMS(fastEntry);
+    if (!convert(items[0], key) || !convert(items[1], value)) {
+        SAFE_DECREF(fastEntry);
+        return false;
+    }
+    SAFE_DECREF(fastEntry);
 
-            while (PyDict_Next(extraKwargs, &pos, &key, &value)) {
-                self->map.emplace(convert(key), convert(value));
-            }
-            if (PyErr_Occurred()) return -1;
-        }
-        return 0;
-    };
+    // converting may run python code, so check right before changing the map
+    if (!IntIntHashMap_checkMutable(self)) {
+        return false;
+    }
+    self->map.insert_or_assign(key, value);
+    return true;
+}
+
+/**
+ * Put all entries of an IntIntHashMap, a dict, a mapping or an iterable of pairs into self.
+ * @return 0 if successful, -1 if error
+ */
+static int IntIntHashMap_updateFrom(IntIntHashMap *self, PyObject *other) {
+    if (!IntIntHashMap_checkMutable(self)) {
+        return -1;
+    }
 
     try {
-        if (map != nullptr) {
-            self->map = map->map;
-            return processExtraKwargs();
-        } else if (processExtraKwargs() == -1) {
-            return -1;
+        if (Py_TYPE(other) == &IntIntHashMapType) {
+            auto *map = reinterpret_cast<IntIntHashMap *>(other);
+            if (map == self) return 0;
+
+            if (self->map.empty()) {
+                self->map = map->map;
+            } else {
+                self->map.reserve(self->map.size() + map->map.size());
+                for (const auto &entry: map->map.values()) {
+                    self->map.insert_or_assign(entry.first, entry.second);
+                }
+            }
+            return 0;
         }
 
-        if (pyDict != nullptr) {
-            PyObject *key, *value;
+        if (PyDict_Check(other)) {
+            PyObject *pyKey, *pyValue;
             Py_ssize_t pos = 0;
 
-            while (PyDict_Next(pyDict, &pos, &key, &value)) {
-                self->map.emplace(convert(key), convert(value));
+            self->map.reserve(self->map.size() + static_cast<size_t>(PyDict_GET_SIZE(other)));
+            while (PyDict_Next(other, &pos, &pyKey, &pyValue)) {
+                int key, value;
+                if (!convert(pyKey, key) || !convert(pyValue, value) || !IntIntHashMap_checkMutable(self)) {
+                    return -1;
+                }
+                self->map.insert_or_assign(key, value);
             }
-            if (PyErr_Occurred()) return -1;
             return 0;
         }
 
-        if (pyMapping != nullptr) {
-            auto keys = PyMapping_Keys(pyMapping);
+        static PyObject *keysAttr = PyUnicode_InternFromString("keys");
+
+        if (PyMapping_Check(other) && PyObject_HasAttr(other, keysAttr)) {
+            PyObject *keys = PyMapping_Keys(other);
             if (keys == nullptr) {
                 return -1;
             }
 
-            if (PyList_Check(keys) || PyTuple_Check(keys)) {
-                // fast method
-                auto fastKeys = PySequence_Fast(keys, "Shouldn't be happen (IntIntHashMap).");
-                SAFE_DECREF(keys);
-                if (fastKeys == nullptr) {
+            PyObject *iter = PyObject_GetIter(keys);
+            SAFE_DECREF(keys);
+            if (iter == nullptr) {
+                return -1;
+            }
+
+            PyObject *pyKey;
+            while ((pyKey = PyIter_Next(iter)) != nullptr) {
+                PyObject *pyValue = PyObject_GetItem(other, pyKey);
+                int key, value;
+                const bool success = pyValue != nullptr && convert(pyKey, key) && convert(pyValue, value)
+                                     && IntIntHashMap_checkMutable(self);
+                SAFE_DECREF(pyKey);
+                Py_XDECREF(pyValue);
+                if (!success) {
+                    SAFE_DECREF(iter);
                     return -1;
                 }
+                self->map.insert_or_assign(key, value);
+            }
+            SAFE_DECREF(iter);
+            return PyErr_Occurred() ? -1 : 0;
+        }
 
-                const auto size = PySequence_Fast_GET_SIZE(fastKeys);
-                auto items = PySequence_Fast_ITEMS(fastKeys);
-                for (Py_ssize_t i = 0; i < size; ++i) {
-                    auto key = items[i];
-                    auto value = PyObject_GetItem(pyMapping, key);
-                    if (value == nullptr) {
-                        SAFE_DECREF(fastKeys);
-                        return -1;
-                    }
-
-                    self->map.emplace(convert(key), convert(value));
-                    SAFE_DECREF(value);
-                }
-                SAFE_DECREF(fastKeys);
-            } else {
-                const auto size = PyObject_Size(keys);
-                for (Py_ssize_t i = 0; i < size; ++i) {
-                    auto index = PyLong_FromSsize_t(i);
-                    auto key = PyObject_GetItem(keys, index);
-                    auto value = PyObject_GetItem(pyMapping, key);
-                    self->map.emplace(convert(key), convert(value));
-                    SAFE_DECREF(key);
-                    SAFE_DECREF(value);
-                    SAFE_DECREF(index);
-                    SAFE_DECREF(keys);
-                    if (PyErr_Occurred()) return -1;
+        if (PyList_Check(other) || PyTuple_Check(other)) {  // fast operation
+            PyObject *fastIter = PySequence_Fast(other, "Shouldn't be happen (IntIntHashMap).");
+            if (fastIter == nullptr) {
+                return -1;
+            }
+
+            const auto size = PySequence_Fast_GET_SIZE(fastIter);
+            auto items = PySequence_Fast_ITEMS(fastIter);
+            self->map.reserve(self->map.size() + static_cast<size_t>(size));
+            for (Py_ssize_t i = 0; i < size; ++i) {
+                if (!updateFromEntry(self, items[i])) {
+                    SAFE_DECREF(fastIter);
+                    return -1;
                 }
             }
-            SAFE_DECREF(keys);
+            SAFE_DECREF(fastIter);
             return 0;
         }
 
-        if (pyIterable != nullptr) {
-            if (PyList_Check(pyIterable) || PyTuple_Check(pyIterable)) {
-                auto fastIter = PySequence_Fast(pyIterable, "Shouldn't be happen (IntIntHashMap).");
-
-                const auto size = PySequence_Fast_GET_SIZE(fastIter);
-                auto items = PySequence_Fast_ITEMS(fastIter);
-                for (Py_ssize_t i = 0; i < size; ++i) {
-                    auto entry = items[i];
-
-                    if (PyList_Check(entry)) {
-                        if (PyList_GET_SIZE(entry) != 2) {
-                            PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
-                            return -1;
-                        }
-
-                        self->map.emplace(
-                                convert(PyTuple_GET_ITEM(entry, 0)),
-                                convert(PyTuple_GET_ITEM(entry, 1)));
-                    } else if (PyTuple_Check(entry)) {
-                        if (PyTuple_GET_SIZE(entry) != 2) {
-                            PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
-                            return -1;
-                        }
-                        self->map.emplace(
-                                convert(PyTuple_GET_ITEM(entry, 0)),
-                                convert(PyTuple_GET_ITEM(entry, 1)));
-                    } else {
-                        auto entryIter = PyObject_GetIter(entry);
-
-                        auto key = PyIter_Next(entryIter);
-                        auto value = PyIter_Next(entryIter);
-                        if (key == nullptr || value == nullptr) {
-                            PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
-                            return -1;
-                        }
-
-                        self->map.emplace(convert(key), convert(value));
-                        SAFE_DECREF(entryIter);
-                        SAFE_DECREF(key);
-                        SAFE_DECREF(value);
-                    }
-
-                    if (PyErr_Occurred()) {
-                        SAFE_DECREF(fastIter);
-                        return -1;
-                    }
-                }
-                SAFE_DECREF(fastIter);
-            } else {
-                auto iter = PyObject_GetIter(pyIterable);
-                if (iter == nullptr) {
-                    PyErr_SetString(PyExc_TypeError, "Arg '__iterable' is not iterable.");
-                    return -1;
-                }
+        PyObject *iter = PyObject_GetIter(other);
+        if (iter == nullptr) {
+            PyErr_SetString(PyExc_TypeError, "expected a iterable or a mapping");
+            return -1;
+        }
 
-                PyObject *entry;
-                while ((entry = PyIter_Next(iter)) != nullptr) {
-                    if (PyList_Check(entry)) {
-                        if (PyList_GET_SIZE(entry) != 2) {
-                            PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
-                            return -1;
-                        }
-
-                        self->map[PyLong_AsLong(PyList_GET_ITEM(entry, 0))] = PyLong_AsLong(PyList_GET_ITEM(entry, 1));
-                    } else if (PyTuple_Check(entry)) {
-                        if (PyTuple_GET_SIZE(entry) != 2) {
-                            PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
-                            return -1;
-                        }
-
-                        self->map.emplace(
-                                convert(PyTuple_GET_ITEM(entry, 0)),
-                                convert(PyTuple_GET_ITEM(entry, 1)));
-                    } else {
-                        auto entryIter = PyObject_GetIter(entry);
-
-                        auto key = PyIter_Next(entryIter);
-                        auto value = PyIter_Next(entryIter);
-                        if (key == nullptr || value == nullptr) {
-                            PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
-                            return -1;
-                        }
-
-                        self->map.emplace(convert(key), convert(value));
-                        SAFE_DECREF(entryIter);
-                        SAFE_DECREF(key);
-                        SAFE_DECREF(value);
-                    }
-
-                    if (PyErr_Occurred()) {
-                        SAFE_DECREF(iter);
-                        return -1;
-                    }
-                }
+        PyObject *entry;
+        while ((entry = PyIter_Next(iter)) != nullptr) {
+            const bool success = updateFromEntry(self, entry);
+            SAFE_DECREF(entry);
+            if (!success) {
                 SAFE_DECREF(iter);
+                return -1;
             }
         }
+        SAFE_DECREF(iter);
+        return PyErr_Occurred() ? -1 : 0;
     } catch (const std::exception &e) {
         PyErr_SetString(PyExc_RuntimeError, e.what());
         return -1;
     }
+}
 
-    return 0;
+static int IntIntHashMap_init(IntIntHashMap *self, PyObject *args, PyObject *kwargs) {
+    if (!IntIntHashMap_checkMutable(self)) {
+        return -1;
+    }
+    new(&self->map) ankerl::unordered_dense::map<int, int>();
+
+    static constexpr const char *kwlist[] = {"__map", nullptr};
+
+    PyObject *arg = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &arg)) {
+        return -1;
+    }
+
+    if (arg == nullptr) {
+        return 0;
+    }
+    return IntIntHashMap_updateFrom(self, arg);
 }
 
 static void IntIntHashMap_dealloc(IntIntHashMap *self) {
@@ -260,7 +303,7 @@ static PyObject *IntIntHashMap_copy(PyObject *pySelf) {
     try {
         copy->map = self->map;
     } catch (const std::exception &e) {
-        PyObject_Del(copy);
+        SAFE_DECREF(copy);
         PyErr_SetString(PyExc_RuntimeError, e.what());
         return nullptr;
     }
@@ -268,14 +311,542 @@ static PyObject *IntIntHashMap_copy(PyObject *pySelf) {
     return reinterpret_cast<PyObject *>(copy);
 }
 
+static PyObject *IntIntHashMap_get(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "get() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    int key;
+    const int converted = convertKey(args[0], key);
+    if (converted == -1) return nullptr;
+
+    if (converted == 1) {
+        const auto it = self->map.find(key);
+        if (it != self->map.end()) {
+            return PyFast_FromInt(it->second);
+        }
+    }
+
+    PyObject *defaultValue = nargs == 2 ? args[1] : Py_None;
+    Py_INCREF(defaultValue);
+    return defaultValue;
+}
+
+static PyObject *IntIntHashMap_pop(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "pop() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    int key;
+    const int converted = convertKey(args[0], key);
+    if (converted == -1) return nullptr;
+    if (!IntIntHashMap_checkMutable(self)) return nullptr;
+
+    if (converted == 1) {
+        const auto it = self->map.find(key);
+        if (it != self->map.end()) {
+            const int value = it->second;
+            self->map.erase(it);
+            return PyFast_FromInt(value);
+        }
+    }
+
+    if (nargs == 2) {
+        Py_INCREF(args[1]);
+        return args[1];
+    }
+
+    setKeyError(args[0]);
+    return nullptr;
+}
+
+static PyObject *IntIntHashMap_setdefault(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "setdefault() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    int key;
+    int value = 0;
+    if (!convert(args[0], key)) return nullptr;
+    if (nargs == 2 && !convert(args[1], value)) return nullptr;
+    if (!IntIntHashMap_checkMutable(self)) return nullptr;
+
+    try {
+        const auto result = self->map.try_emplace(key, value);
+        return PyFast_FromInt(result.first->second);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+/**
+ * Like fastutil's addTo, add delta to the value of key (a missing key counts as 0).
+ * @return the previous value
+ */
+static PyObject *IntIntHashMap_add_to(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "add_to() takes exactly 2 arguments");
+        return nullptr;
+    }
+
+    int key, delta;
+    if (!convert(args[0], key) || !convert(args[1], delta)) return nullptr;
+    if (!IntIntHashMap_checkMutable(self)) return nullptr;
+
+    try {
+        auto &value = self->map.try_emplace(key, 0).first->second;
+        const int previous = value;
+        // wrap around on overflow like java does, signed overflow is UB in C++
+        value = static_cast<int>(static_cast<unsigned int>(previous) + static_cast<unsigned int>(delta));
+        return PyFast_FromInt(previous);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static PyObject *IntIntHashMap_items(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    const auto &values = self->map.values();
+    const auto size = static_cast<Py_ssize_t>(values.size());
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *key = PyFast_FromInt(values[i].first);
+        PyObject *value = PyFast_FromInt(values[i].second);
+        PyObject *item = (key != nullptr && value != nullptr) ? PyTuple_Pack(2, key, value) : nullptr;
+        Py_XDECREF(key);
+        Py_XDECREF(value);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+
+        PyList_SET_ITEM(result, i, item);  // PyList_SET_ITEM handle this ref
+    }
+
+    return result;
+}
+
+static __forceinline PyObject *IntIntHashMap_toIntArrayList(IntIntHashMap *self, const bool keys) {
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        const auto &values = self->map.values();
+        result->vector.resize(values.size());
+        auto data = result->vector.data();
+        for (const auto &entry: values) {
+            *data++ = keys ? entry.first : entry.second;
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntIntHashMap_keys(PyObject *pySelf) {
+    return IntIntHashMap_toIntArrayList(reinterpret_cast<IntIntHashMap *>(pySelf), true);
+}
+
+static PyObject *IntIntHashMap_values(PyObject *pySelf) {
+    return IntIntHashMap_toIntArrayList(reinterpret_cast<IntIntHashMap *>(pySelf), false);
+}
+
+static PyObject *IntIntHashMap_get_many(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "get_many() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    int defaultValue = 0;
+    if (nargs == 2 && !convert(args[1], defaultValue)) return nullptr;
+
+    IntBuffer keys;
+    if (!IntBuffer_open(args[0], keys)) return nullptr;
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) {
+        IntBuffer_release(keys);
+        return PyErr_NoMemory();
+    }
+
+    try {
+        result->vector.resize(keys.size);
+    } catch (const std::exception &e) {
+        IntBuffer_release(keys);
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    const auto &map = self->map;
+    int *out = result->vector.data();
+    const auto consumer = [&map, out, defaultValue](const size_t i, const auto it) {
+        out[i] = it != map.end() ? it->second : defaultValue;
+    };
+
+    // other threads may read the map meanwhile, but not change it
+    self->batches++;
+    Py_BEGIN_ALLOW_THREADS
+        if (keys.ints != nullptr) {
+            lookupMany(map, keys.ints, keys.size, consumer);
+        } else {
+            lookupMany(map, keys.longs, keys.size, consumer);
+        }
+    Py_END_ALLOW_THREADS
+    self->batches--;
+
+    IntBuffer_release(keys);
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *IntIntHashMap_contains_many(PyObject *pySelf, PyObject *pyKeys) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    IntBuffer keys;
+    if (!IntBuffer_open(pyKeys, keys)) return nullptr;
+
+    // one byte per key, so the result can be used as a bool mask directly (e.g. numpy.frombuffer(mask, bool))
+    PyObject *result = PyBytes_FromStringAndSize(nullptr, static_cast<Py_ssize_t>(keys.size));
+    if (result == nullptr) {
+        IntBuffer_release(keys);
+        return nullptr;
+    }
+
+    const auto &map = self->map;
+    auto *out = reinterpret_cast<unsigned char *>(PyBytes_AS_STRING(result));
+    const auto consumer = [&map, out](const size_t i, const auto it) {
+        out[i] = it != map.end() ? 1 : 0;
+    };
+
+    // other threads may read the map meanwhile, but not change it
+    self->batches++;
+    Py_BEGIN_ALLOW_THREADS
+        if (keys.ints != nullptr) {
+            lookupMany(map, keys.ints, keys.size, consumer);
+        } else {
+            lookupMany(map, keys.longs, keys.size, consumer);
+        }
+    Py_END_ALLOW_THREADS
+    self->batches--;
+
+    IntBuffer_release(keys);
+    return result;
+}
+
+/**
+ * Put every (keys[i], values[i]) into self, keys and values being the same length and in int range.
+ * The entries of the keys already in the map are found by a probe-only pass with the GIL released,
+ * then the values are stored and the missing keys inserted with the GIL held.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool IntIntHashMap_putMany(IntIntHashMap *self, const IntBuffer &keys, const IntBuffer &values) {
+    static constexpr size_t MISSING = SIZE_MAX;
+    const size_t size = keys.size;
+
+    if (!IntIntHashMap_checkMutable(self)) return false;
+
+    auto &map = self->map;
+    // no rehash while inserting, and entry indices stay valid as inserting only appends
+    map.reserve(map.size() + size);
+    std::vector<size_t> entries(size);
+
+    const auto &constMap = map;
+    const auto begin = constMap.begin();
+    const auto end = constMap.end();
+    size_t *out = entries.data();
+    const auto consumer = [begin, end, out](const size_t i, const auto it) {
+        out[i] = it != end ? static_cast<size_t>(it - begin) : MISSING;
+    };
+
+    self->batches++;
+    Py_BEGIN_ALLOW_THREADS
+        if (keys.ints != nullptr) {
+            lookupMany(constMap, keys.ints, size, consumer);
+        } else {
+            lookupMany(constMap, keys.longs, size, consumer);
+        }
+    Py_END_ALLOW_THREADS
+    self->batches--;
+
+    // another batch call may have started probing while the GIL was released
+    if (!IntIntHashMap_checkMutable(self)) return false;
+
+    const auto entryBegin = map.begin();
+    const auto store = [&](const auto *keyData, const auto *valueData) {
+        for (size_t i = 0; i < size; ++i) {
+            const int value = static_cast<int>(valueData[i]);
+            if (entries[i] != MISSING) {
+                (entryBegin + static_cast<ptrdiff_t>(entries[i]))->second = value;
+            } else {
+                map.insert_or_assign(static_cast<int>(keyData[i]), value);
+            }
+        }
+    };
+
+    if (keys.ints != nullptr && values.ints != nullptr) {
+        store(keys.ints, values.ints);
+    } else if (keys.ints != nullptr) {
+        store(keys.ints, values.longs);
+    } else if (values.ints != nullptr) {
+        store(keys.longs, values.ints);
+    } else {
+        store(keys.longs, values.longs);
+    }
+    return true;
+}
+
+static PyObject *IntIntHashMap_put_many(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "put_many() takes exactly 2 arguments");
+        return nullptr;
+    }
+
+    IntBuffer keys, values;
+    if (!IntBuffer_open(args[0], keys)) return nullptr;
+    if (!IntBuffer_open(args[1], values)) {
+        IntBuffer_release(keys);
+        return nullptr;
+    }
+
+    if (keys.size != values.size) {
+        PyErr_SetString(PyExc_ValueError, "keys and values must have the same length.");
+    } else if (checkIntRange(keys) && checkIntRange(values)) {
+        try {
+            IntIntHashMap_putMany(self, keys, values);
+        } catch (const std::exception &e) {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+        }
+    }
+
+    IntBuffer_release(keys);
+    IntBuffer_release(values);
+
+    if (PyErr_Occurred()) return nullptr;
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntIntHashMap_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (IntIntHashMap_updateFrom(self, other) == -1) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *IntIntHashMap_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (!IntIntHashMap_checkMutable(self)) return nullptr;
+    self->map.clear();
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t IntIntHashMap_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->map.size());
+}
+
+static PyObject *IntIntHashMap_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    auto iter = IntIntHashMapIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *IntIntHashMap_getitem(PyObject *pySelf, PyObject *pyKey) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    int key;
+    const int converted = convertKey(pyKey, key);
+    if (converted == -1) return nullptr;
+
+    if (converted == 1) {
+        const auto it = self->map.find(key);
+        if (it != self->map.end()) {
+            return PyFast_FromInt(it->second);
+        }
+    }
+
+    setKeyError(pyKey);
+    return nullptr;
+}
+
+static int IntIntHashMap_setitem(PyObject *pySelf, PyObject *pyKey, PyObject *pyValue) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (pyValue == nullptr) {  // del map[key]
+        int key;
+        const int converted = convertKey(pyKey, key);
+        if (converted == -1) return -1;
+        if (!IntIntHashMap_checkMutable(self)) return -1;
+
+        if (converted == 0 || self->map.erase(key) == 0) {
+            setKeyError(pyKey);
+            return -1;
+        }
+        return 0;
+    }
+
+    int key, value;
+    if (!convert(pyKey, key) || !convert(pyValue, value)) return -1;
+    if (!IntIntHashMap_checkMutable(self)) return -1;
+
+    try {
+        self->map.insert_or_assign(key, value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+    return 0;
+}
+
+static int IntIntHashMap_contains(PyObject *pySelf, PyObject *pyKey) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    int key;
+    const int converted = convertKey(pyKey, key);
+    if (converted != 1) return converted;
+
+    return self->map.contains(key) ? 1 : 0;
+}
+
+static __forceinline PyObject *IntIntHashMap_eq(PyObject *pySelf, PyObject *pyValue) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    if (Py_TYPE(pyValue) == &IntIntHashMapType) {
+        // fast compare
+        auto *value = reinterpret_cast<IntIntHashMap *>(pyValue);
+        if (value->map.size() != self->map.size())
+            Py_RETURN_FALSE;
+
+        for (const auto &entry: self->map.values()) {
+            const auto it = value->map.find(entry.first);
+            if (it == value->map.end() || it->second != entry.second)
+                Py_RETURN_FALSE;
+        }
+        Py_RETURN_TRUE;
+    }
+
+    if (!PyDict_Check(pyValue))
+        Py_RETURN_NOTIMPLEMENTED;
+
+    // for dict
+    if (PyDict_GET_SIZE(pyValue) != static_cast<Py_ssize_t>(self->map.size()))
+        Py_RETURN_FALSE;
+
+    PyObject *pyKey, *pyItem;
+    Py_ssize_t pos = 0;
+    while (PyDict_Next(pyValue, &pos, &pyKey, &pyItem)) {
+        int key, value;
+        const int converted = convertKey(pyKey, key);
+        if (converted == -1) return nullptr;
+        if (converted == 0 || convertKey(pyItem, value) != 1) {
+            PyErr_Clear();
+            Py_RETURN_FALSE;
+        }
+
+        const auto it = self->map.find(key);
+        if (it == self->map.end() || it->second != value)
+            Py_RETURN_FALSE;
+    }
+
+    Py_RETURN_TRUE;
+}
+
+static PyObject *IntIntHashMap_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    PyObject *isEq;
+    switch (op) {
+        case Py_EQ:  // ==
+            return IntIntHashMap_eq(pySelf, pyValue);
+        case Py_NE:  // !=
+            isEq = IntIntHashMap_eq(pySelf, pyValue);
+            if (isEq == nullptr || isEq == Py_NotImplemented)
+                return isEq;
+            if (isEq == Py_True) {
+                SAFE_DECREF(isEq);
+                Py_RETURN_FALSE;
+            } else {
+                SAFE_DECREF(isEq);
+                Py_RETURN_TRUE;
+            }
+        default:
+            Py_RETURN_NOTIMPLEMENTED;
+    }
+}
+
 #ifdef IS_PYTHON_39_OR_LATER
 static PyObject *IntIntHashMap_class_getitem(PyObject *cls, PyObject *item) {
     return Py_GenericAlias(cls, item);
 }
 #endif
 
+static PyObject *IntIntHashMap_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntIntHashMap *>(pySelf);
+
+    const auto &values = self->map.values();
+
+    if (values.empty()) {
+        return PyUnicode_FromString("{}");
+    }
+
+    auto str = std::string("{");
+    str.reserve(values.size() * 8);
+
+    char buffer[32];
+
+    for (const auto &entry: values) {
+        // to string
+        int len = snprintf(buffer, sizeof(buffer), "%d: %d, ", entry.first, entry.second);
+        str.append(buffer, len);
+    }
+
+    str.resize(str.size() - 2);
+    str += "}";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
 static PyMethodDef IntIntHashMap_methods[] = {
         {"copy", (PyCFunction) IntIntHashMap_copy, METH_NOARGS},
+        {"get", (PyCFunction) IntIntHashMap_get, METH_FASTCALL},
+        {"pop", (PyCFunction) IntIntHashMap_pop, METH_FASTCALL},
+        {"setdefault", (PyCFunction) IntIntHashMap_setdefault, METH_FASTCALL},
+        {"add_to", (PyCFunction) IntIntHashMap_add_to, METH_FASTCALL},
+        {"items", (PyCFunction) IntIntHashMap_items, METH_NOARGS},
+        {"keys", (PyCFunction) IntIntHashMap_keys, METH_NOARGS},
+        {"values", (PyCFunction) IntIntHashMap_values, METH_NOARGS},
+        {"get_many", (PyCFunction) IntIntHashMap_get_many, METH_FASTCALL},
+        {"put_many", (PyCFunction) IntIntHashMap_put_many, METH_FASTCALL},
+        {"contains_many", (PyCFunction) IntIntHashMap_contains_many, METH_O},
+        {"update", (PyCFunction) IntIntHashMap_update, METH_O},
+        {"clear", (PyCFunction) IntIntHashMap_clear, METH_NOARGS},
 #ifdef IS_PYTHON_39_OR_LATER
         {"__class_getitem__", (PyCFunction) IntIntHashMap_class_getitem, METH_O | METH_CLASS},
 #endif
@@ -290,11 +861,33 @@ static struct PyModuleDef IntIntHashMap_module = {
         nullptr, nullptr, nullptr, nullptr, nullptr
 };
 
+static PySequenceMethods IntIntHashMap_asSequence = {
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        IntIntHashMap_contains,
+        nullptr,
+        nullptr
+};
+
+static PyMappingMethods IntIntHashMap_asMapping = {
+        IntIntHashMap_len,
+        IntIntHashMap_getitem,
+        IntIntHashMap_setitem
+};
+
 void initializeIntIntHashMapType(PyTypeObject &type) {
     type.tp_name = "IntIntHashMap";
     type.tp_basicsize = sizeof(IntIntHashMap);
     type.tp_itemsize = 0;
     type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &IntIntHashMap_asSequence;
+    type.tp_as_mapping = &IntIntHashMap_asMapping;
+    type.tp_iter = IntIntHashMap_iter;
     type.tp_methods = IntIntHashMap_methods;
     type.tp_init = (initproc) IntIntHashMap_init;
     type.tp_new = PyType_GenericNew;
@@ -302,12 +895,17 @@ void initializeIntIntHashMapType(PyTypeObject &type) {
     type.tp_alloc = PyType_GenericAlloc;
     type.tp_free = PyObject_Del;
     type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = IntIntHashMap_compare;
+    type.tp_repr = IntIntHashMap_repr;
+    type.tp_str = IntIntHashMap_repr;
 }
 
 #pragma clang diagnostic push
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_IntIntHashMap() {
     initializeIntIntHashMapType(IntIntHashMapType);
+    if (PyType_Ready(&IntIntHashMapType) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&IntIntHashMap_module);
     if (object == nullptr)
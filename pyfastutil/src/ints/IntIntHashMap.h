@@ -12,8 +12,11 @@ extern "C" {
 typedef struct IntIntHashMap {
     PyObject_HEAD;
     ankerl::unordered_dense::map<int, int> map;
-    Py_ssize_t shape = 0;
+    // batch calls probing the map with the GIL released, the map must not be changed while there are any
+    Py_ssize_t batches = 0;
 } IntIntHashMap;
+
+extern PyTypeObject IntIntHashMapType;
 }
 
 PyMODINIT_FUNC PyInit_IntIntHashMap();
@@ -0,0 +1,101 @@
+//
+// Created by xia__mc on 2024/11/24.
+//
+
+#include "IntIntHashMapIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject IntIntHashMapIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+IntIntHashMapIter *IntIntHashMapIter_create(IntIntHashMap *map) {
+    auto *instance = Py_CreateObjNoInit<IntIntHashMapIter>(IntIntHashMapIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(map);
+    instance->container = map;
+    instance->index = 0;
+    instance->size = map->map.size();
+
+    return instance;
+}
+
+static void IntIntHashMapIter_dealloc(IntIntHashMapIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *IntIntHashMapIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<IntIntHashMapIter *>(pySelf);
+
+    // entries are stored densely, so iterating keys is just walking the values vector
+    const auto &values = self->container->map.values();
+    if (UNLIKELY(values.size() != self->size)) {
+        PyErr_SetString(PyExc_RuntimeError, "IntIntHashMap changed size during iteration");
+        return nullptr;
+    }
+
+    if (self->index >= values.size()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    return PyFast_FromInt(values[self->index++].first);
+}
+
+static PyObject *IntIntHashMapIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef IntIntHashMapIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef IntIntHashMapIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.IntIntHashMapIter",
+        "An IntIntHashMapIter_module that creates an IntIntHashMapIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeIntIntHashMapIterType(PyTypeObject &type) {
+    type.tp_name = "IntIntHashMapIter";
+    type.tp_basicsize = sizeof(IntIntHashMapIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = IntIntHashMapIter_iter;
+    type.tp_iternext = IntIntHashMapIter_next;
+    type.tp_methods = IntIntHashMapIter_methods;
+    type.tp_dealloc = (destructor) IntIntHashMapIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_IntIntHashMapIter() {
+    initializeIntIntHashMapIterType(IntIntHashMapIterType);
+    if (PyType_Ready(&IntIntHashMapIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&IntIntHashMapIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&IntIntHashMapIterType);
+    if (PyModule_AddObject(object, "IntIntHashMapIter", (PyObject *) &IntIntHashMapIterType) < 0) {
+        Py_DECREF(&IntIntHashMapIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/11/24.
+//
+
+#ifndef PYFASTUTIL_INTINTHASHMAPITER_H
+#define PYFASTUTIL_INTINTHASHMAPITER_H
+
+#include "utils/PythonPCH.h"
+#include "IntIntHashMap.h"
+
+extern "C" {
+typedef struct IntIntHashMapIter {
+    PyObject_HEAD;
+    IntIntHashMap *container;
+    size_t index;
+    size_t size;  // size when the iterator was created, used to detect modification
+} IntIntHashMapIter;
+
+IntIntHashMapIter *IntIntHashMapIter_create(IntIntHashMap *map);
+
+}
+
+PyMODINIT_FUNC PyInit_IntIntHashMapIter();
+
+#endif //PYFASTUTIL_INTINTHASHMAPITER_H
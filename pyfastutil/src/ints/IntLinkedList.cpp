@@ -3,17 +3,17 @@
 //
 
 #include "IntLinkedList.h"
-#include <list>
+#include <vector>
 #include <algorithm>
 #include <stdexcept>
 #include "utils/PythonUtils.h"
 #include "utils/include/TimSort.h"
 #include "utils/simd/BitonicSort.h"
 #include "utils/simd/SIMDUtils.h"
+#include "utils/simd/Search.h"
 #include "utils/memory/AlignedAllocator.h"
 #include "ints/IntLinkedListIter.h"
 #include "utils/include/CPythonSort.h"
-#include "utils/Utils.h"
 
 extern "C" {
 static PyTypeObject IntLinkedListType = {
@@ -21,7 +21,7 @@ static PyTypeObject IntLinkedListType = {
 };
 
 static int IntLinkedList_init(IntLinkedList *self, PyObject *args, PyObject *kwargs) {
-    new(&self->list) std::list<PyObject *>();
+    new(&self->list) UnrolledList<int>();
     self->modCount = 0;
 
     PyObject *pyIterable = nullptr;
@@ -93,7 +93,7 @@ static int IntLinkedList_init(IntLinkedList *self, PyObject *args, PyObject *kwa
 }
 
 static void IntLinkedList_dealloc(IntLinkedList *self) {
-    self->list.~list();
+    self->list.~UnrolledList();
     Py_TYPE(self)->tp_free((PyObject *) self);
 }
 
@@ -128,7 +128,7 @@ static PyObject *IntLinkedList_from_range([[maybe_unused]] PyObject *cls, PyObje
         }
 
     } catch (const std::exception &e) {
-        list->list.~list();
+        list->list.~UnrolledList();
         PyObject_Del(list);
         PyErr_SetString(PyExc_RuntimeError, e.what());
         return nullptr;
@@ -275,10 +275,11 @@ static PyObject *IntLinkedList_pop(PyObject *pySelf, PyObject *const *args, cons
         return PyFast_FromInt(popped);
     }
 
-    auto popped = at(self->list, index);
+    auto popped = self->list.at(static_cast<size_t>(index));
+    const int value = *popped;
     self->list.erase(popped);
     self->modCount++;
-    return PyFast_FromInt(*popped);
+    return PyFast_FromInt(value);
 }
 
 static PyObject *IntLinkedList_index(PyObject *pySelf, PyObject *args) {
@@ -311,15 +312,15 @@ static PyObject *IntLinkedList_index(PyObject *pySelf, PyObject *args) {
         return nullptr;
     }
 
-    auto stopIter = at(self->list, stop);
-    auto it = std::find(at(self->list, start), stopIter, value);
+    auto stopIter = self->list.at(static_cast<size_t>(stop));
+    auto it = std::find(self->list.at(static_cast<size_t>(start)), stopIter, value);
 
     if (it == stopIter) {
         PyErr_SetString(PyExc_ValueError, "Value is not in list.");
         return nullptr;
     }
 
-    Py_ssize_t index = std::distance(self->list.begin(), it);
+    Py_ssize_t index = static_cast<Py_ssize_t>(UnrolledList<int>::distance(self->list.begin(), it));
     return PyLong_FromSsize_t(index);
 }
 
@@ -332,7 +333,10 @@ static PyObject *IntLinkedList_count(PyObject *pySelf, PyObject *object) {
     }
 
     try {
-        size_t result = std::count(self->list.begin(), self->list.end(), value);
+        size_t result = 0;
+        self->list.forEachChunk([&](const int *values, size_t count) {
+            result += simd::simdCount(values, count, value);
+        });
 
         return PyLong_FromSize_t(result);
     } catch (const std::exception &e) {
@@ -361,7 +365,7 @@ static PyObject *IntLinkedList_insert(PyObject *pySelf, PyObject *args) {
 
     // do insert
     try {
-        self->list.insert(at(self->list, index), value);
+        self->list.insert(self->list.at(static_cast<size_t>(index)), value);
         self->modCount++;
     } catch (const std::exception &e) {
         PyErr_SetString(PyExc_RuntimeError, e.what());
@@ -409,10 +413,14 @@ static PyObject *IntLinkedList_sort(PyObject *pySelf, PyObject *args, PyObject *
     }
 
     if (keyFunc == Py_None) {
-        if (reverseInt == 1) {
-            self->list.sort(std::greater());
-        } else {
-            self->list.sort();
+        // sort a contiguous copy, nodes are too small for the SIMD sort to pay off one by one
+        try {
+            std::vector<int, AlignedAllocator<int, 64>> values(self->list.begin(), self->list.end());
+            simd::simdsort(values, reverseInt == 1);
+            std::copy(values.begin(), values.end(), self->list.begin());
+        } catch (const std::exception &e) {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return nullptr;
         }
         self->modCount++;
     } else {
@@ -476,7 +484,7 @@ static PyObject *IntLinkedList_getitem(PyObject *pySelf, Py_ssize_t pyIndex) {
     }
 
     try {
-        PyObject *item = PyFast_FromInt(*at(self->list, static_cast<size_t>(pyIndex)));
+        PyObject *item = PyFast_FromInt(*self->list.at(static_cast<size_t>(pyIndex)));
         Py_INCREF(item);
         return item;
     } catch (const std::exception &e) {
@@ -510,7 +518,7 @@ static PyObject *IntLinkedList_getitem_slice(PyObject *pySelf, PyObject *slice)
 
     for (Py_ssize_t i = 0; i < sliceLength; i++) {
         Py_ssize_t index = start + i * step;
-        PyObject *item = PyFast_FromInt(*at(self->list, static_cast<size_t>(index)));
+        PyObject *item = PyFast_FromInt(*self->list.at(static_cast<size_t>(index)));
         Py_INCREF(item);
         if (item == nullptr) {
             SAFE_DECREF(result);
@@ -536,15 +544,16 @@ static int IntLinkedList_setitem(PyObject *pySelf, Py_ssize_t pyIndex, PyObject
 
     try {
         if (pyValue == nullptr) {
-            auto iter = at(self->list, static_cast<size_t>(pyIndex));
+            auto iter = self->list.at(static_cast<size_t>(pyIndex));
             self->list.erase(iter);
+            self->modCount++;
         } else {
             PyObject *value = pyValue;
             if (PyErr_Occurred()) {
                 return -1;
             }
 
-            *at(self->list, static_cast<size_t>(pyIndex)) = PyLong_AsLong(value);
+            *self->list.at(static_cast<size_t>(pyIndex)) = PyLong_AsLong(value);
         }
     } catch (const std::exception &e) {
         PyErr_SetString(PyExc_RuntimeError, e.what());
@@ -572,6 +581,32 @@ static int IntLinkedList_setitem_slice(PyObject *pySelf, PyObject *slice, PyObje
 
     sliceLength = PySlice_AdjustIndices(static_cast<Py_ssize_t>(self->list.size()), &start, &stop, step);
 
+    if (value == nullptr) {  // del list[start:stop:step]
+        if (sliceLength == 0) {
+            return 0;
+        }
+
+        try {
+            if (step == 1) {
+                const auto first = self->list.at(static_cast<size_t>(start));
+                const auto last = self->list.at(static_cast<size_t>(stop));
+                self->list.erase(first, last);
+            } else {
+                // erase the highest index first, so the indices left to erase stay put
+                for (Py_ssize_t i = 0; i < sliceLength; i++) {
+                    const Py_ssize_t index = step > 0 ? start + (sliceLength - 1 - i) * step : start + i * step;
+                    const auto iter = self->list.at(static_cast<size_t>(index));
+                    self->list.erase(iter);
+                }
+            }
+            self->modCount++;
+        } catch (const std::exception &e) {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return -1;
+        }
+        return 0;
+    }
+
     if (!PySequence_Check(value)) {
         PyErr_SetString(PyExc_TypeError, "can only assign an iterable");
         return -1;
@@ -585,7 +620,7 @@ static int IntLinkedList_setitem_slice(PyObject *pySelf, PyObject *slice, PyObje
     }
 
     try {
-        auto iter = at(self->list, static_cast<size_t>(start));
+        auto iter = self->list.at(static_cast<size_t>(start));
 
         if (newLength == sliceLength) {  // only change elements
             for (Py_ssize_t i = 0; i < sliceLength; i++) {
@@ -623,6 +658,7 @@ static int IntLinkedList_setitem_slice(PyObject *pySelf, PyObject *slice, PyObje
                 ++iter;
             }
             self->list.erase(eraseStart, iter);
+            self->modCount++;
         } else {  // more elements
             for (Py_ssize_t i = 0; i < sliceLength; i++) {
                 PyObject *item = PySequence_GetItem(value, i);
@@ -645,7 +681,9 @@ static int IntLinkedList_setitem_slice(PyObject *pySelf, PyObject *slice, PyObje
                     return -1;
                 }
 
-                self->list.insert(iter, PyLong_AsLong(item));
+                // every insertion invalidates the iterators, go on from the returned one
+                iter = std::next(self->list.insert(iter, PyLong_AsLong(item)));
+                self->modCount++;
                 SAFE_DECREF(item);
                 if (PyErr_Occurred()) {
                     return -1;
@@ -703,7 +741,9 @@ static PyObject *IntLinkedList_iadd(PyObject *pySelf, PyObject *iterable) {
     if (Py_TYPE(iterable) == &IntLinkedListType) {
         auto *iter = reinterpret_cast<IntLinkedList *>(iterable);
         self->list.insert(self->list.end(), iter->list.begin(), iter->list.end());
-        Py_RETURN_NONE;
+        self->modCount++;
+        Py_INCREF(pySelf);
+        return pySelf;
     }
 
     // python iterable extend
@@ -724,6 +764,7 @@ static PyObject *IntLinkedList_iadd(PyObject *pySelf, PyObject *iterable) {
         self->list.push_back(PyLong_AsLong(item));
         SAFE_DECREF(item);
     }
+    self->modCount++;
 
     if (PyErr_Occurred()) {
         SAFE_DECREF(iter);
@@ -753,8 +794,9 @@ static PyObject *IntLinkedList_mul(PyObject *pySelf, Py_ssize_t n) {
     }
 
     try {
+        const std::vector<int> values(self->list.begin(), self->list.end());
         for (Py_ssize_t i = 0; i < n; ++i) {
-            result->list.insert(result->list.end(), self->list.begin(), self->list.end());
+            result->list.append(values.data(), values.size());
         }
 
         return reinterpret_cast<PyObject *>(result);
@@ -790,12 +832,12 @@ static PyObject *IntLinkedList_imul(PyObject *pySelf, Py_ssize_t n) {
         if (n == 0) {
             self->list.clear();
         } else {
-            const auto begin = self->list.begin();
-            const auto end = self->list.end();
+            const std::vector<int> values(self->list.begin(), self->list.end());
             for (Py_ssize_t i = 1; i < n; ++i) {
-                self->list.insert(self->list.end(), begin, end);
+                self->list.append(values.data(), values.size());
             }
         }
+        self->modCount++;
 
         Py_INCREF(pySelf);
         return pySelf;
@@ -841,7 +883,7 @@ static PyObject *IntLinkedList_reverse(PyObject *pySelf) {
     auto *self = reinterpret_cast<IntLinkedList *>(pySelf);
 
     Py_BEGIN_ALLOW_THREADS
-        std::reverse(self->list.begin(), self->list.end());
+        self->list.reverse();
     Py_END_ALLOW_THREADS
     Py_RETURN_NONE;
 }
@@ -850,6 +892,7 @@ static PyObject *IntLinkedList_clear(PyObject *pySelf) {
     auto *self = reinterpret_cast<IntLinkedList *>(pySelf);
 
     self->list.clear();
+    self->modCount++;
     Py_RETURN_NONE;
 }
 
@@ -1073,7 +1116,7 @@ static __forceinline PyObject *IntLinkedList_repr(PyObject *pySelf) {
         str += ", ";
     }
 
-    int len = snprintf(buffer, sizeof(buffer), "%d", *at(vec, lastIdx));
+    int len = snprintf(buffer, sizeof(buffer), "%d", vec.back());
     str.append(buffer, len);
 
     str += "]";
@@ -1158,6 +1201,8 @@ void initializeIntLinkedListType(PyTypeObject &type) {
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_IntLinkedList() {
     initializeIntLinkedListType(IntLinkedListType);
+    if (PyType_Ready(&IntLinkedListType) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&IntLinkedList_module);
     if (object == nullptr)
@@ -6,12 +6,12 @@
 #define PYFASTUTIL_INTLINKEDLIST_H
 
 #include "utils/PythonPCH.h"
-#include <list>
+#include "utils/UnrolledList.h"
 
 extern "C" {
 typedef struct IntLinkedList {
     PyObject_HEAD;
-    std::list<int> list;
+    UnrolledList<int> list;
     uint64_t modCount;
 } IntLinkedList;
 }
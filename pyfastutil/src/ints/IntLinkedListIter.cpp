@@ -4,7 +4,6 @@
 
 #include "IntLinkedListIter.h"
 #include "utils/PythonUtils.h"
-#include "utils/Utils.h"
 
 extern "C" {
 
@@ -18,10 +17,11 @@ IntLinkedListIter *IntLinkedListIter_create(IntLinkedList *list, bool reversed)
 
     Py_INCREF(list);
     instance->container = list;
+    // cacheIter is always the position of index. Reversed, index is the count of elements left to return.
     if (reversed) {
-        instance->index = (!list->list.empty()) ? list->list.size() - 1 : 0;
+        instance->index = list->list.size();
         instance->reversed = true;
-        instance->cacheIter = --list->list.end();
+        instance->cacheIter = list->list.end();
     } else {
         instance->index = 0;
         instance->reversed = false;
@@ -37,47 +37,29 @@ static void IntLinkedListIter_dealloc(IntLinkedListIter *self) {
     Py_TYPE(self)->tp_free((PyObject *) self);
 }
 
-static __forceinline void updateCache(IntLinkedListIter *&self) {
+static __forceinline void updateCache(IntLinkedListIter *self) {
     if (self->cacheModCount == self->container->modCount) {
         return;
     }
 
-    auto newIter = at(self->container->list, self->index);
-    if (self->reversed) {
-        self->index--;
-    } else {
-        self->index++;
-    }
-    self->cacheIter = newIter;
+    // the list changed under us, so the cached position may point anywhere
+    self->cacheIter = self->container->list.at(self->index);
     self->cacheModCount = self->container->modCount;
 }
 
 static PyObject *IntLinkedListIter_next(PyObject *pySelf) {
     auto *self = reinterpret_cast<IntLinkedListIter *>(pySelf);
 
-    if (self->container->list.empty()) {
-        PyErr_SetNone(PyExc_StopIteration);
-        return nullptr;
-    }
-
     if (self->reversed) {
-        if (self->index == 0) {
-            // last iteration
-            int element = *(--self->container->list.end());
-            self->index = SIZE_MAX;
-            return PyFast_FromInt(element);
-        }
-        if (self->index == SIZE_MAX) {
-            // already finish iteration
+        if (self->index == 0 || self->index > self->container->list.size()) {
             PyErr_SetNone(PyExc_StopIteration);
             return nullptr;
         }
 
         updateCache(self);
-        int element = *self->cacheIter;
         self->index--;
         self->cacheIter--;
-        return PyFast_FromInt(element);
+        return PyFast_FromInt(*self->cacheIter);
     } else {
         if (self->index >= self->container->list.size()) {
             PyErr_SetNone(PyExc_StopIteration);
@@ -126,6 +108,8 @@ void initializeIntLinkedListIterType(PyTypeObject &type) {
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_IntLinkedListIter() {
     initializeIntLinkedListIterType(IntLinkedListIterType);
+    if (PyType_Ready(&IntLinkedListIterType) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&IntLinkedListIter_module);
     if (object == nullptr)
@@ -13,7 +13,7 @@ typedef struct IntLinkedListIter { // NOLINT(*-pro-type-member-init)
     PyObject_HEAD;
     IntLinkedList *container;
     size_t index;
-    std::list<int>::iterator cacheIter;
+    UnrolledList<int>::iterator cacheIter;
     uint64_t cacheModCount;
     bool reversed;
 } IntLinkedListIter;
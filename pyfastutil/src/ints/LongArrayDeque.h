@@ -0,0 +1,24 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#ifndef PYFASTUTIL_LONGARRAYDEQUE_H
+#define PYFASTUTIL_LONGARRAYDEQUE_H
+
+#include "utils/PythonPCH.h"
+#include "utils/RingBuffer.h"
+
+extern "C" {
+typedef struct LongArrayDeque {
+    PyObject_HEAD;
+    RingBuffer<long long> deque;
+    // bumped by every change of the elements' positions, iterators use it to detect mutation
+    uint64_t modCount;
+} LongArrayDeque;
+
+extern PyTypeObject LongArrayDequeType;
+}
+
+PyMODINIT_FUNC PyInit_LongArrayDeque();
+
+#endif //PYFASTUTIL_LONGARRAYDEQUE_H
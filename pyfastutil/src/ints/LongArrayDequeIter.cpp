@@ -0,0 +1,109 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#include "LongArrayDequeIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject LongArrayDequeIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+LongArrayDequeIter *LongArrayDequeIter_create(LongArrayDeque *deque, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<LongArrayDequeIter>(LongArrayDequeIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(deque);
+    instance->container = deque;
+    instance->index = reversed ? deque->deque.size() : 0;
+    instance->modCount = deque->modCount;
+    instance->reversed = reversed;
+
+    return instance;
+}
+
+static void LongArrayDequeIter_dealloc(LongArrayDequeIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *LongArrayDequeIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongArrayDequeIter *>(pySelf);
+
+    // positions shift with every push and pop at the front, so there is nothing sensible to resume from
+    if (UNLIKELY(self->modCount != self->container->modCount)) {
+        PyErr_SetString(PyExc_RuntimeError, "LongArrayDeque mutated during iteration");
+        return nullptr;
+    }
+
+    const auto &deque = self->container->deque;
+    if (self->reversed) {
+        if (self->index == 0) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+        return PyLong_FromLongLong(deque[--self->index]);
+    }
+
+    if (self->index >= deque.size()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+    return PyLong_FromLongLong(deque[self->index++]);
+}
+
+static PyObject *LongArrayDequeIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef LongArrayDequeIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef LongArrayDequeIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.LongArrayDequeIter",
+        "A LongArrayDequeIter_module that creates a LongArrayDequeIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeLongArrayDequeIterType(PyTypeObject &type) {
+    type.tp_name = "LongArrayDequeIter";
+    type.tp_basicsize = sizeof(LongArrayDequeIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = LongArrayDequeIter_iter;
+    type.tp_iternext = LongArrayDequeIter_next;
+    type.tp_methods = LongArrayDequeIter_methods;
+    type.tp_dealloc = (destructor) LongArrayDequeIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_LongArrayDequeIter() {
+    initializeLongArrayDequeIterType(LongArrayDequeIterType);
+    if (PyType_Ready(&LongArrayDequeIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&LongArrayDequeIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&LongArrayDequeIterType);
+    if (PyModule_AddObject(object, "LongArrayDequeIter", (PyObject *) &LongArrayDequeIterType) < 0) {
+        Py_DECREF(&LongArrayDequeIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
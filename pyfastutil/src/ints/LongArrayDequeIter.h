@@ -0,0 +1,26 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#ifndef PYFASTUTIL_LONGARRAYDEQUEITER_H
+#define PYFASTUTIL_LONGARRAYDEQUEITER_H
+
+#include "utils/PythonPCH.h"
+#include "LongArrayDeque.h"
+
+extern "C" {
+typedef struct LongArrayDequeIter {
+    PyObject_HEAD;
+    LongArrayDeque *container;
+    size_t index;  // reversed, the count of elements left to return
+    uint64_t modCount;
+    bool reversed;
+} LongArrayDequeIter;
+
+LongArrayDequeIter *LongArrayDequeIter_create(LongArrayDeque *deque, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_LongArrayDequeIter();
+
+#endif //PYFASTUTIL_LONGARRAYDEQUEITER_H
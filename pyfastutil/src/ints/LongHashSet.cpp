@@ -0,0 +1,793 @@
+//
+// Created by xia__mc on 2024/12/3.
+//
+
+#include "LongHashSet.h"
+#include <string>
+#include "utils/PythonUtils.h"
+#include "utils/IntBuffer.h"
+#include "ints/LongHashSetIter.h"
+
+/**
+ * Add every element of buffer to set.
+ * @return always true, every int32 and int64 fits
+ */
+static __forceinline bool addAll(ankerl::unordered_dense::set<long long> &set, const IntBuffer &buffer) {
+    set.reserve(set.size() + buffer.size);
+    IntBuffer_forEach(buffer, [&set](const long long value) {
+        set.insert(value);
+    });
+    return true;
+}
+
+/**
+ * Keep only the elements of set which are also in buffer.
+ */
+static __forceinline void retainAll(ankerl::unordered_dense::set<long long> &set, const IntBuffer &buffer) {
+    ankerl::unordered_dense::set<long long> result;
+    IntBuffer_forEach(buffer, [&set, &result](const long long value) {
+        if (set.contains(value)) {
+            result.insert(value);
+        }
+    });
+    set.swap(result);
+}
+
+static __forceinline void removeAll(ankerl::unordered_dense::set<long long> &set, const IntBuffer &buffer) {
+    IntBuffer_forEach(buffer, [&set](const long long value) {
+        set.erase(value);
+    });
+}
+
+/**
+ * Python set semantics: duplicated elements in buffer are only toggled once.
+ * @return always true
+ */
+static __forceinline bool toggleAll(ankerl::unordered_dense::set<long long> &set, const IntBuffer &buffer) {
+    ankerl::unordered_dense::set<long long> other;
+    addAll(other, buffer);
+
+    for (const long long value: other) {
+        if (set.erase(value) == 0) {
+            set.insert(value);
+        }
+    }
+    return true;
+}
+
+/**
+ * Run op(set, buffer) over an IntArrayList, a BigIntArrayList or a buffer without boxing elements.
+ * @return if successful
+ */
+template<typename Op>
+static __forceinline bool withIntBuffer(ankerl::unordered_dense::set<long long> &set, PyObject *other, Op op) {
+    IntBuffer buffer;
+    if (!IntBuffer_open(other, buffer)) return false;
+
+    bool inRange;
+    try {
+        inRange = op(set, buffer);
+    } catch (...) {
+        IntBuffer_release(buffer);
+        throw;
+    }
+    IntBuffer_release(buffer);
+
+    return inRange;
+}
+
+
+extern "C" {
+
+PyTypeObject LongHashSetType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+/**
+ * Convert a python object to C long long, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, long long &result) {
+    const long long value = PyLong_AsLongLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+    result = value;
+    return true;
+}
+
+/**
+ * Convert a lookup key. Unlike convert, keys which can't be a C long long are simply "not in the set".
+ * @return 1 if converted, 0 if the key can't be in the set, -1 if error
+ */
+static __forceinline int convertKey(PyObject *obj, long long &result) {
+    if (!PyLong_Check(obj)) {
+        return 0;
+    }
+
+    int overflow = 0;
+    const long long value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+    if (value == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (overflow != 0) {
+        return 0;
+    }
+    result = value;
+    return 1;
+}
+
+static __forceinline bool isIntBuffer(PyObject *obj) {
+    return Py_TYPE(obj) == &IntArrayListType || Py_TYPE(obj) == &BigIntArrayListType || PyObject_CheckBuffer(obj);
+}
+
+static __forceinline LongHashSet *LongHashSet_new() {
+    return Py_CreateObj<LongHashSet>(LongHashSetType);
+}
+
+/**
+ * Collect an iterable of python ints into a temporary set.
+ * If strict is false, elements which can't be in the set (wrong type or out of range) are skipped instead of raising.
+ * @return if successful
+ */
+static bool collectIterable(PyObject *iterable, ankerl::unordered_dense::set<long long> &result, const bool strict) {
+    PyObject *iter = PyObject_GetIter(iterable);
+    if (iter == nullptr) {
+        return false;
+    }
+
+    Py_ssize_t hint = PyObject_LengthHint(iterable, 0);
+    if (hint > 0) {
+        result.reserve(static_cast<size_t>(hint));
+    }
+
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        long long value;
+        const int converted = strict ? (convert(item, value) ? 1 : -1) : convertKey(item, value);
+        SAFE_DECREF(item);
+        if (converted == -1) {
+            SAFE_DECREF(iter);
+            return false;
+        }
+        if (converted == 1) {
+            result.insert(value);
+        }
+    }
+    SAFE_DECREF(iter);
+    return !PyErr_Occurred();
+}
+
+static int LongHashSet_updateFrom(LongHashSet *self, PyObject *other) {
+    try {
+        if (Py_TYPE(other) == &LongHashSetType) {
+            const auto &set = reinterpret_cast<LongHashSet *>(other)->set;
+            if (self->set.empty()) {
+                self->set = set;
+            } else {
+                self->set.insert(set.begin(), set.end());
+            }
+            return 0;
+        }
+
+        if (isIntBuffer(other)) {
+            return withIntBuffer(self->set, other, addAll) ? 0 : -1;
+        }
+
+        PyObject *iter = PyObject_GetIter(other);
+        if (iter == nullptr) {
+            return -1;
+        }
+
+        Py_ssize_t hint = PyObject_LengthHint(other, 0);
+        if (hint > 0) {
+            self->set.reserve(self->set.size() + static_cast<size_t>(hint));
+        }
+
+        PyObject *item;
+        while ((item = PyIter_Next(iter)) != nullptr) {
+            long long value;
+            const bool success = convert(item, value);
+            SAFE_DECREF(item);
+            if (!success) {
+                SAFE_DECREF(iter);
+                return -1;
+            }
+            self->set.insert(value);
+        }
+        SAFE_DECREF(iter);
+        return PyErr_Occurred() ? -1 : 0;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+}
+
+static int LongHashSet_init(LongHashSet *self, PyObject *args, PyObject *kwargs) {
+    new(&self->set) ankerl::unordered_dense::set<long long>();
+
+    static constexpr const char *kwlist[] = {"iterable", nullptr};
+
+    PyObject *arg = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &arg)) {
+        return -1;
+    }
+
+    if (arg == nullptr) {
+        return 0;
+    }
+    return LongHashSet_updateFrom(self, arg);
+}
+
+static void LongHashSet_dealloc(LongHashSet *self) {
+    self->set.~table();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *LongHashSet_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    auto *copy = LongHashSet_new();
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    try {
+        copy->set = self->set;
+    } catch (const std::exception &e) {
+        SAFE_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *LongHashSet_add(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    long long value;
+    if (!convert(object, value)) return nullptr;
+
+    try {
+        self->set.insert(value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHashSet_discard(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    long long value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+
+    if (converted == 1) {
+        self->set.erase(value);
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHashSet_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    long long value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+
+    if (converted == 0 || self->set.erase(value) == 0) {
+        PyErr_SetObject(PyExc_KeyError, object);
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHashSet_pop(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    if (self->set.empty()) {
+        PyErr_SetString(PyExc_KeyError, "pop from an empty set");
+        return nullptr;
+    }
+
+    // the last element is the cheapest to remove, nothing needs to be moved
+    const long long value = self->set.values().back();
+    self->set.erase(value);
+    return PyLong_FromLongLong(value);
+}
+
+static PyObject *LongHashSet_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    self->set.clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHashSet_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    if (LongHashSet_updateFrom(self, other) == -1) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHashSet_intersection_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    try {
+        if (Py_TYPE(other) == &LongHashSetType) {
+            const auto &set = reinterpret_cast<LongHashSet *>(other)->set;
+            if (&set != &self->set) {
+                std::erase_if(self->set, [&set](const long long value) { return !set.contains(value); });
+            }
+            Py_RETURN_NONE;
+        }
+
+        if (isIntBuffer(other)) {
+            if (!withIntBuffer(self->set, other, [](auto &set, const IntBuffer &buffer) {
+                retainAll(set, buffer);
+                return true;
+            })) {
+                return nullptr;
+            }
+            Py_RETURN_NONE;
+        }
+
+        ankerl::unordered_dense::set<long long> set;
+        if (!collectIterable(other, set, false)) return nullptr;
+        std::erase_if(self->set, [&set](const long long value) { return !set.contains(value); });
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHashSet_difference_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    try {
+        if (Py_TYPE(other) == &LongHashSetType) {
+            const auto &set = reinterpret_cast<LongHashSet *>(other)->set;
+            if (&set == &self->set) {
+                self->set.clear();
+            } else if (set.size() < self->set.size()) {
+                for (const long long value: set) {
+                    self->set.erase(value);
+                }
+            } else {
+                std::erase_if(self->set, [&set](const long long value) { return set.contains(value); });
+            }
+            Py_RETURN_NONE;
+        }
+
+        if (isIntBuffer(other)) {
+            if (!withIntBuffer(self->set, other, [](auto &set, const IntBuffer &buffer) {
+                removeAll(set, buffer);
+                return true;
+            })) {
+                return nullptr;
+            }
+            Py_RETURN_NONE;
+        }
+
+        ankerl::unordered_dense::set<long long> set;
+        if (!collectIterable(other, set, false)) return nullptr;
+        for (const long long value: set) {
+            self->set.erase(value);
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHashSet_symmetric_difference_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    try {
+        if (Py_TYPE(other) == &LongHashSetType) {
+            if (other == pySelf) {
+                self->set.clear();
+                Py_RETURN_NONE;
+            }
+            for (const long long value: reinterpret_cast<LongHashSet *>(other)->set) {
+                if (self->set.erase(value) == 0) {
+                    self->set.insert(value);
+                }
+            }
+            Py_RETURN_NONE;
+        }
+
+        if (isIntBuffer(other)) {
+            if (!withIntBuffer(self->set, other, toggleAll)) return nullptr;
+            Py_RETURN_NONE;
+        }
+
+        ankerl::unordered_dense::set<long long> set;
+        if (!collectIterable(other, set, true)) return nullptr;
+        for (const long long value: set) {
+            if (self->set.erase(value) == 0) {
+                self->set.insert(value);
+            }
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t LongHashSet_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->set.size());
+}
+
+static PyObject *LongHashSet_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    auto iter = LongHashSetIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static int LongHashSet_contains(PyObject *pySelf, PyObject *key) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    long long value;
+    const int converted = convertKey(key, value);
+    if (converted != 1) return converted;
+
+    return self->set.contains(value) ? 1 : 0;
+}
+
+// set algebra, like python's set both operands must be sets
+
+static PyObject *LongHashSet_or(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &LongHashSetType || Py_TYPE(pyRight) != &LongHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const auto &left = reinterpret_cast<LongHashSet *>(pyLeft)->set;
+    const auto &right = reinterpret_cast<LongHashSet *>(pyRight)->set;
+    const auto &larger = left.size() >= right.size() ? left : right;
+    const auto &smaller = left.size() >= right.size() ? right : left;
+
+    auto *result = LongHashSet_new();
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        result->set = larger;
+        result->set.insert(smaller.begin(), smaller.end());
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *LongHashSet_and(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &LongHashSetType || Py_TYPE(pyRight) != &LongHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const auto &left = reinterpret_cast<LongHashSet *>(pyLeft)->set;
+    const auto &right = reinterpret_cast<LongHashSet *>(pyRight)->set;
+    const auto &larger = left.size() >= right.size() ? left : right;
+    const auto &smaller = left.size() >= right.size() ? right : left;
+
+    auto *result = LongHashSet_new();
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        // probe the larger set with the elements of the smaller one
+        for (const long long value: smaller) {
+            if (larger.contains(value)) {
+                result->set.insert(value);
+            }
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *LongHashSet_sub(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &LongHashSetType || Py_TYPE(pyRight) != &LongHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const auto &left = reinterpret_cast<LongHashSet *>(pyLeft)->set;
+    const auto &right = reinterpret_cast<LongHashSet *>(pyRight)->set;
+
+    auto *result = LongHashSet_new();
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        for (const long long value: left) {
+            if (!right.contains(value)) {
+                result->set.insert(value);
+            }
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *LongHashSet_xor(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &LongHashSetType || Py_TYPE(pyRight) != &LongHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const auto &left = reinterpret_cast<LongHashSet *>(pyLeft)->set;
+    const auto &right = reinterpret_cast<LongHashSet *>(pyRight)->set;
+
+    auto *result = LongHashSet_new();
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        for (const long long value: left) {
+            if (!right.contains(value)) {
+                result->set.insert(value);
+            }
+        }
+        for (const long long value: right) {
+            if (!left.contains(value)) {
+                result->set.insert(value);
+            }
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *LongHashSet_ior(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &LongHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    if (LongHashSet_updateFrom(reinterpret_cast<LongHashSet *>(pySelf), other) == -1) {
+        return nullptr;
+    }
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *LongHashSet_iand(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &LongHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    PyObject *result = LongHashSet_intersection_update(pySelf, other);
+    if (result == nullptr) return nullptr;
+    Py_DECREF(result);
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *LongHashSet_isub(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &LongHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    PyObject *result = LongHashSet_difference_update(pySelf, other);
+    if (result == nullptr) return nullptr;
+    Py_DECREF(result);
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *LongHashSet_ixor(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &LongHashSetType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    PyObject *result = LongHashSet_symmetric_difference_update(pySelf, other);
+    if (result == nullptr) return nullptr;
+    Py_DECREF(result);
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static __forceinline PyObject *LongHashSet_eq(PyObject *pySelf, PyObject *pyValue) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    if (Py_TYPE(pyValue) == &LongHashSetType) {
+        // fast compare
+        const auto &set = reinterpret_cast<LongHashSet *>(pyValue)->set;
+        if (set.size() != self->set.size())
+            Py_RETURN_FALSE;
+
+        for (const long long value: self->set) {
+            if (!set.contains(value))
+                Py_RETURN_FALSE;
+        }
+        Py_RETURN_TRUE;
+    }
+
+    if (!PyAnySet_Check(pyValue))
+        Py_RETURN_NOTIMPLEMENTED;
+
+    // for set and frozenset
+    if (PySet_GET_SIZE(pyValue) != static_cast<Py_ssize_t>(self->set.size()))
+        Py_RETURN_FALSE;
+
+    PyObject *iter = PyObject_GetIter(pyValue);
+    if (iter == nullptr) return nullptr;
+
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        long long value;
+        const int converted = convertKey(item, value);
+        SAFE_DECREF(item);
+        if (converted == -1) {
+            SAFE_DECREF(iter);
+            return nullptr;
+        }
+        if (converted == 0 || !self->set.contains(value)) {
+            SAFE_DECREF(iter);
+            Py_RETURN_FALSE;
+        }
+    }
+    SAFE_DECREF(iter);
+    if (PyErr_Occurred()) return nullptr;
+
+    Py_RETURN_TRUE;
+}
+
+static PyObject *LongHashSet_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    PyObject *isEq;
+    switch (op) {
+        case Py_EQ:  // ==
+            return LongHashSet_eq(pySelf, pyValue);
+        case Py_NE:  // !=
+            isEq = LongHashSet_eq(pySelf, pyValue);
+            if (isEq == nullptr || isEq == Py_NotImplemented)
+                return isEq;
+            if (isEq == Py_True) {
+                SAFE_DECREF(isEq);
+                Py_RETURN_FALSE;
+            } else {
+                SAFE_DECREF(isEq);
+                Py_RETURN_TRUE;
+            }
+        default:
+            Py_RETURN_NOTIMPLEMENTED;
+    }
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *LongHashSet_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static PyObject *LongHashSet_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHashSet *>(pySelf);
+
+    const auto &values = self->set.values();
+
+    if (values.empty()) {
+        return PyUnicode_FromString("set()");
+    }
+
+    auto str = std::string("{");
+    str.reserve(values.size() * 4);
+
+    char buffer[32];
+
+    for (const long long value: values) {
+        // to string
+        int len = snprintf(buffer, sizeof(buffer), "%lld, ", value);
+        str.append(buffer, len);
+    }
+
+    str.resize(str.size() - 2);
+    str += "}";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
+static PyMethodDef LongHashSet_methods[] = {
+        {"copy", (PyCFunction) LongHashSet_copy, METH_NOARGS},
+        {"add", (PyCFunction) LongHashSet_add, METH_O},
+        {"discard", (PyCFunction) LongHashSet_discard, METH_O},
+        {"remove", (PyCFunction) LongHashSet_remove, METH_O},
+        {"pop", (PyCFunction) LongHashSet_pop, METH_NOARGS},
+        {"clear", (PyCFunction) LongHashSet_clear, METH_NOARGS},
+        {"update", (PyCFunction) LongHashSet_update, METH_O},
+        {"intersection_update", (PyCFunction) LongHashSet_intersection_update, METH_O},
+        {"difference_update", (PyCFunction) LongHashSet_difference_update, METH_O},
+        {"symmetric_difference_update", (PyCFunction) LongHashSet_symmetric_difference_update, METH_O},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) LongHashSet_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef LongHashSet_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.LongHashSet",
+        "An LongHashSet_module that creates an LongHashSet",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods LongHashSet_asSequence = {
+        LongHashSet_len,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        LongHashSet_contains,
+        nullptr,
+        nullptr
+};
+
+static PyNumberMethods LongHashSet_asNumber = {
+        .nb_subtract = LongHashSet_sub,
+        .nb_and = LongHashSet_and,
+        .nb_xor = LongHashSet_xor,
+        .nb_or = LongHashSet_or,
+        .nb_inplace_subtract = LongHashSet_isub,
+        .nb_inplace_and = LongHashSet_iand,
+        .nb_inplace_xor = LongHashSet_ixor,
+        .nb_inplace_or = LongHashSet_ior,
+};
+
+void initializeLongHashSetType(PyTypeObject &type) {
+    type.tp_name = "LongHashSet";
+    type.tp_basicsize = sizeof(LongHashSet);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &LongHashSet_asSequence;
+    type.tp_as_number = &LongHashSet_asNumber;
+    type.tp_iter = LongHashSet_iter;
+    type.tp_methods = LongHashSet_methods;
+    type.tp_init = (initproc) LongHashSet_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) LongHashSet_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = LongHashSet_compare;
+    type.tp_repr = LongHashSet_repr;
+    type.tp_str = LongHashSet_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_LongHashSet() {
+    initializeLongHashSetType(LongHashSetType);
+    if (PyType_Ready(&LongHashSetType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&LongHashSet_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&LongHashSetType);
+    if (PyModule_AddObject(object, "LongHashSet", (PyObject *) &LongHashSetType) < 0) {
+        Py_DECREF(&LongHashSetType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,22 @@
+//
+// Created by xia__mc on 2024/12/3.
+//
+
+#ifndef PYFASTUTIL_LONGHASHSET_H
+#define PYFASTUTIL_LONGHASHSET_H
+
+#include "utils/PythonPCH.h"
+#include "utils/include/UnorderedDense.h"
+
+extern "C" {
+typedef struct LongHashSet {
+    PyObject_HEAD;
+    ankerl::unordered_dense::set<long long> set;
+} LongHashSet;
+
+extern PyTypeObject LongHashSetType;
+}
+
+PyMODINIT_FUNC PyInit_LongHashSet();
+
+#endif //PYFASTUTIL_LONGHASHSET_H
@@ -0,0 +1,101 @@
+//
+// Created by xia__mc on 2024/12/3.
+//
+
+#include "LongHashSetIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject LongHashSetIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+LongHashSetIter *LongHashSetIter_create(LongHashSet *set) {
+    auto *instance = Py_CreateObjNoInit<LongHashSetIter>(LongHashSetIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(set);
+    instance->container = set;
+    instance->index = 0;
+    instance->size = set->set.size();
+
+    return instance;
+}
+
+static void LongHashSetIter_dealloc(LongHashSetIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *LongHashSetIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHashSetIter *>(pySelf);
+
+    // elements are stored densely, so iterating is just walking the values vector
+    const auto &values = self->container->set.values();
+    if (UNLIKELY(values.size() != self->size)) {
+        PyErr_SetString(PyExc_RuntimeError, "LongHashSet changed size during iteration");
+        return nullptr;
+    }
+
+    if (self->index >= values.size()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    return PyLong_FromLongLong(values[self->index++]);
+}
+
+static PyObject *LongHashSetIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef LongHashSetIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef LongHashSetIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.LongHashSetIter",
+        "An LongHashSetIter_module that creates an LongHashSetIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeLongHashSetIterType(PyTypeObject &type) {
+    type.tp_name = "LongHashSetIter";
+    type.tp_basicsize = sizeof(LongHashSetIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = LongHashSetIter_iter;
+    type.tp_iternext = LongHashSetIter_next;
+    type.tp_methods = LongHashSetIter_methods;
+    type.tp_dealloc = (destructor) LongHashSetIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_LongHashSetIter() {
+    initializeLongHashSetIterType(LongHashSetIterType);
+    if (PyType_Ready(&LongHashSetIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&LongHashSetIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&LongHashSetIterType);
+    if (PyModule_AddObject(object, "LongHashSetIter", (PyObject *) &LongHashSetIterType) < 0) {
+        Py_DECREF(&LongHashSetIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/3.
+//
+
+#ifndef PYFASTUTIL_LONGHASHSETITER_H
+#define PYFASTUTIL_LONGHASHSETITER_H
+
+#include "utils/PythonPCH.h"
+#include "LongHashSet.h"
+
+extern "C" {
+typedef struct LongHashSetIter {
+    PyObject_HEAD;
+    LongHashSet *container;
+    size_t index;
+    size_t size;  // size when the iterator was created, used to detect modification
+} LongHashSetIter;
+
+LongHashSetIter *LongHashSetIter_create(LongHashSet *set);
+
+}
+
+PyMODINIT_FUNC PyInit_LongHashSetIter();
+
+#endif //PYFASTUTIL_LONGHASHSETITER_H
@@ -0,0 +1,343 @@
+//
+// Created by xia__mc on 2024/12/25.
+//
+
+#include "LongHeapPriorityQueue.h"
+#include <vector>
+#include <exception>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+#include "ints/BigIntArrayList.h"
+
+/**
+ * Convert a python object to C long long, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, long long &result) {
+    const long long value = PyLong_AsLongLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+    result = value;
+    return true;
+}
+
+/**
+ * Convert every element of iterable, appending them to result.
+ * @return if successful
+ */
+static bool collect(PyObject *iterable, std::vector<long long> &result) {
+    if (Py_TYPE(iterable) == &BigIntArrayListType) {
+        const auto &vector = reinterpret_cast<BigIntArrayList *>(iterable)->vector;
+        result.insert(result.end(), vector.begin(), vector.end());
+        return true;
+    }
+
+    PyObject *fast = PySequence_Fast(iterable, "Expected an iterable of ints.");
+    if (fast == nullptr) {
+        return false;
+    }
+
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast);
+    PyObject **items = PySequence_Fast_ITEMS(fast);
+    result.reserve(result.size() + static_cast<size_t>(size));
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        long long value;
+        if (!convert(items[i], value)) {
+            SAFE_DECREF(fast);
+            return false;
+        }
+        result.push_back(value);
+    }
+
+    SAFE_DECREF(fast);
+    return true;
+}
+
+/**
+ * Convert an iterable of (priority, payload) pairs, appending them to priorities and payloads.
+ * @return if successful
+ */
+static bool collectPairs(PyObject *iterable, std::vector<long long> &priorities, std::vector<long long> &payloads) {
+    PyObject *fast = PySequence_Fast(iterable, "Expected an iterable of (priority, payload) pairs.");
+    if (fast == nullptr) {
+        return false;
+    }
+
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast);
+    PyObject **items = PySequence_Fast_ITEMS(fast);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        long long priority;
+        long long payload;
+        if (!PyTuple_Check(items[i]) || PyTuple_GET_SIZE(items[i]) != 2) {
+            SAFE_DECREF(fast);
+            PyErr_SetString(PyExc_TypeError, "Expected an iterable of (priority, payload) pairs.");
+            return false;
+        }
+        if (!convert(PyTuple_GET_ITEM(items[i], 0), priority) || !convert(PyTuple_GET_ITEM(items[i], 1), payload)) {
+            SAFE_DECREF(fast);
+            return false;
+        }
+        priorities.push_back(priority);
+        payloads.push_back(payload);
+    }
+
+    SAFE_DECREF(fast);
+    return true;
+}
+
+/**
+ * The top of the heap as python object: the priority, or a (priority, payload) tuple if paired.
+ */
+static __forceinline PyObject *topToPython(const DaryHeap<long long, long long> &heap) {
+    if (heap.isPaired()) {
+        return Py_BuildValue("(LL)", heap.topKey(), heap.topValue());
+    }
+    return PyLong_FromLongLong(heap.topKey());
+}
+
+extern "C" {
+
+static PyTypeObject LongHeapPriorityQueueType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+static int LongHeapPriorityQueue_init(LongHeapPriorityQueue *self, PyObject *args, PyObject *kwargs) {
+    new(&self->heap) DaryHeap<long long, long long>();
+
+    PyObject *pyIterable = nullptr;
+    int paired = false;
+
+    static constexpr const char *kwlist[] = {"iterable", "paired", nullptr};
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Op", const_cast<char **>(kwlist), &pyIterable, &paired)) {
+        return -1;
+    }
+
+    try {
+        self->heap = DaryHeap<long long, long long>(paired);
+        if (pyIterable == nullptr) {
+            return 0;
+        }
+
+        std::vector<long long> priorities;
+        std::vector<long long> payloads;
+        if (!(paired ? collectPairs(pyIterable, priorities, payloads) : collect(pyIterable, priorities))) {
+            return -1;
+        }
+        self->heap.pushAll(priorities.data(), payloads.data(), priorities.size());
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
+static void LongHeapPriorityQueue_dealloc(LongHeapPriorityQueue *self) {
+    self->heap.~DaryHeap();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *LongHeapPriorityQueue_push(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<LongHeapPriorityQueue *>(pySelf);
+
+    const Py_ssize_t expected = self->heap.isPaired() ? 2 : 1;
+    if (nargs != expected) {
+        PyErr_Format(PyExc_TypeError,
+                     self->heap.isPaired() ? "push() takes a priority and a payload (%zd given)"
+                                           : "push() takes only a priority (%zd given)", nargs);
+        return nullptr;
+    }
+
+    long long priority;
+    long long payload = 0;
+    if (!convert(args[0], priority)) return nullptr;
+    if (nargs == 2 && !convert(args[1], payload)) return nullptr;
+
+    try {
+        self->heap.push(priority, payload);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHeapPriorityQueue_push_many(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<LongHeapPriorityQueue *>(pySelf);
+
+    const Py_ssize_t expected = self->heap.isPaired() ? 2 : 1;
+    if (nargs != expected) {
+        PyErr_Format(PyExc_TypeError,
+                     self->heap.isPaired() ? "push_many() takes priorities and payloads (%zd given)"
+                                           : "push_many() takes only priorities (%zd given)", nargs);
+        return nullptr;
+    }
+
+    try {
+        std::vector<long long> priorities;
+        std::vector<long long> payloads;
+        if (!collect(args[0], priorities)) return nullptr;
+        if (nargs == 2) {
+            if (!collect(args[1], payloads)) return nullptr;
+            if (payloads.size() != priorities.size()) {
+                PyErr_SetString(PyExc_ValueError, "priorities and payloads must have the same length.");
+                return nullptr;
+            }
+        }
+
+        self->heap.pushAll(priorities.data(), payloads.data(), priorities.size());
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHeapPriorityQueue_pop(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHeapPriorityQueue *>(pySelf);
+
+    if (self->heap.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from an empty priority queue");
+        return nullptr;
+    }
+
+    PyObject *result = topToPython(self->heap);
+    if (result == nullptr) return nullptr;
+    self->heap.pop();
+    return result;
+}
+
+static PyObject *LongHeapPriorityQueue_peek(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHeapPriorityQueue *>(pySelf);
+
+    if (self->heap.empty()) {
+        PyErr_SetString(PyExc_IndexError, "peek from an empty priority queue");
+        return nullptr;
+    }
+
+    return topToPython(self->heap);
+}
+
+static PyObject *LongHeapPriorityQueue_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHeapPriorityQueue *>(pySelf);
+
+    self->heap.clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *LongHeapPriorityQueue_to_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHeapPriorityQueue *>(pySelf);
+
+    PyObject *result = PyList_New(static_cast<Py_ssize_t>(self->heap.size()));
+    if (result == nullptr) return nullptr;
+
+    try {
+        // pop a copy, so the list is in pop order
+        DaryHeap<long long, long long> heap = self->heap;
+        for (Py_ssize_t i = 0; !heap.empty(); ++i) {
+            PyObject *item = topToPython(heap);
+            if (item == nullptr) {
+                SAFE_DECREF(result);
+                return nullptr;
+            }
+            PyList_SET_ITEM(result, i, item);
+            heap.pop();
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return result;
+}
+
+static PyObject *LongHeapPriorityQueue_is_paired(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHeapPriorityQueue *>(pySelf);
+
+    Py_RETURN_BOOL(self->heap.isPaired());
+}
+
+static Py_ssize_t LongHeapPriorityQueue_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<LongHeapPriorityQueue *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->heap.size());
+}
+
+static PyObject *LongHeapPriorityQueue_repr(PyObject *pySelf) {
+    PyObject *list = LongHeapPriorityQueue_to_list(pySelf);
+    if (list == nullptr) return nullptr;
+
+    PyObject *result = PyUnicode_FromFormat("LongHeapPriorityQueue(%R)", list);
+    SAFE_DECREF(list);
+    return result;
+}
+
+static PyMethodDef LongHeapPriorityQueue_methods[] = {
+        {"push", (PyCFunction) LongHeapPriorityQueue_push, METH_FASTCALL},
+        {"push_many", (PyCFunction) LongHeapPriorityQueue_push_many, METH_FASTCALL},
+        {"pop", (PyCFunction) LongHeapPriorityQueue_pop, METH_NOARGS},
+        {"peek", (PyCFunction) LongHeapPriorityQueue_peek, METH_NOARGS},
+        {"clear", (PyCFunction) LongHeapPriorityQueue_clear, METH_NOARGS},
+        {"to_list", (PyCFunction) LongHeapPriorityQueue_to_list, METH_NOARGS},
+        {"is_paired", (PyCFunction) LongHeapPriorityQueue_is_paired, METH_NOARGS},
+        {nullptr}
+};
+
+static struct PyModuleDef LongHeapPriorityQueue_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.LongHeapPriorityQueue",
+        "A LongHeapPriorityQueue_module that creates a LongHeapPriorityQueue",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods LongHeapPriorityQueue_asSequence = {
+        LongHeapPriorityQueue_len
+};
+
+void initializeLongHeapPriorityQueueType(PyTypeObject &type) {
+    type.tp_name = "LongHeapPriorityQueue";
+    type.tp_basicsize = sizeof(LongHeapPriorityQueue);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &LongHeapPriorityQueue_asSequence;
+    type.tp_methods = LongHeapPriorityQueue_methods;
+    type.tp_init = (initproc) LongHeapPriorityQueue_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) LongHeapPriorityQueue_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_repr = LongHeapPriorityQueue_repr;
+    type.tp_str = LongHeapPriorityQueue_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_LongHeapPriorityQueue() {
+    initializeLongHeapPriorityQueueType(LongHeapPriorityQueueType);
+    if (PyType_Ready(&LongHeapPriorityQueueType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&LongHeapPriorityQueue_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&LongHeapPriorityQueueType);
+    if (PyModule_AddObject(object, "LongHeapPriorityQueue", (PyObject *) &LongHeapPriorityQueueType) < 0) {
+        Py_DECREF(&LongHeapPriorityQueueType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,20 @@
+//
+// Created by xia__mc on 2024/12/25.
+//
+
+#ifndef PYFASTUTIL_LONGHEAPPRIORITYQUEUE_H
+#define PYFASTUTIL_LONGHEAPPRIORITYQUEUE_H
+
+#include "utils/PythonPCH.h"
+#include "utils/DaryHeap.h"
+
+extern "C" {
+typedef struct LongHeapPriorityQueue {
+    PyObject_HEAD;
+    DaryHeap<long long, long long> heap;
+} LongHeapPriorityQueue;
+}
+
+PyMODINIT_FUNC PyInit_LongHeapPriorityQueue();
+
+#endif //PYFASTUTIL_LONGHEAPPRIORITYQUEUE_H
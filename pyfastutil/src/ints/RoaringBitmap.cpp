@@ -0,0 +1,1624 @@
+//
+// Created by xia__mc on 2024/12/20.
+//
+
+#include "RoaringBitmap.h"
+#include <bit>
+#include <climits>
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+#include "utils/IntBuffer.h"
+#include "utils/simd/BitOps.h"
+#include "utils/simd/SetOps.h"
+#include "utils/simd/IntegerSort.h"
+#include "ints/IntArrayList.h"
+#include "ints/UnsignedIntArrayList.h"
+#include "ints/RoaringBitmapIter.h"
+
+using RoaringWords = std::vector<unsigned long long, AlignedAllocator<unsigned long long, 64>>;
+
+static constexpr size_t WORD_BITS = 64;
+
+static constexpr unsigned long long ALL_BITS = ~0ULL;
+
+static constexpr unsigned int CONTAINER_VALUES = 65536;
+
+static constexpr size_t BITMAP_WORDS = CONTAINER_VALUES / WORD_BITS;
+
+// past this an array takes more room than the 8KB bitmap
+static constexpr unsigned int ARRAY_MAX_SIZE = 4096;
+
+// the portable format, https://github.com/RoaringBitmap/RoaringFormatSpec
+static constexpr unsigned int SERIAL_COOKIE_NO_RUNCONTAINER = 12346;
+static constexpr unsigned int SERIAL_COOKIE = 12347;
+static constexpr size_t NO_OFFSET_THRESHOLD = 4;
+static constexpr size_t BITMAP_BYTES = CONTAINER_VALUES / 8;
+
+enum class SetOp {
+    AND, OR, AND_NOT
+};
+
+static __forceinline bool RoaringContainer_testBit(const RoaringWords &bitmap, unsigned int value) {
+    return (bitmap[value / WORD_BITS] >> (value % WORD_BITS)) & 1;
+}
+
+/**
+ * Set the bits from start to stop, stop not included.
+ */
+static void RoaringContainer_setBits(unsigned long long *words, unsigned int start, unsigned int stop) {
+    if (start >= stop) return;
+
+    const size_t first = start / WORD_BITS;
+    const size_t last = (stop - 1) / WORD_BITS;
+    const unsigned long long firstMask = ALL_BITS << (start % WORD_BITS);
+    const unsigned long long lastMask = ALL_BITS >> (WORD_BITS - 1 - (stop - 1) % WORD_BITS);
+    if (first == last) {
+        words[first] |= firstMask & lastMask;
+        return;
+    }
+
+    words[first] |= firstMask;
+    std::fill(words + first + 1, words + last, ALL_BITS);
+    words[last] |= lastMask;
+}
+
+static __forceinline bool RoaringContainer_isFull(const RoaringContainer &container) {
+    return container.cardinality == CONTAINER_VALUES;
+}
+
+template<typename Func>
+static __forceinline void RoaringContainer_forEach(const RoaringContainer &container, Func func) {
+    switch (container.type) {
+        case RoaringContainerType::ARRAY:
+            for (const unsigned short value: container.array) {
+                func(static_cast<unsigned int>(value));
+            }
+            break;
+        case RoaringContainerType::BITMAP:
+            for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                unsigned long long word = container.bitmap[w];
+                while (word != 0) {
+                    func(static_cast<unsigned int>(w * WORD_BITS + std::countr_zero(word)));
+                    word &= word - 1;
+                }
+            }
+            break;
+        case RoaringContainerType::RUN:
+            for (const RoaringRun &run: container.runs) {
+                const unsigned int end = static_cast<unsigned int>(run.start) + run.length;
+                for (unsigned int value = run.start; value <= end; ++value) {
+                    func(value);
+                }
+            }
+            break;
+    }
+}
+
+/**
+ * Free the members the current type doesn't use.
+ */
+static __forceinline void RoaringContainer_release(RoaringContainer &container) {
+    if (container.type != RoaringContainerType::ARRAY) std::vector<unsigned short>().swap(container.array);
+    if (container.type != RoaringContainerType::BITMAP) RoaringWords().swap(container.bitmap);
+    if (container.type != RoaringContainerType::RUN) std::vector<RoaringRun>().swap(container.runs);
+}
+
+static void RoaringContainer_toBitmap(RoaringContainer &container) {
+    RoaringWords bitmap(BITMAP_WORDS, 0);
+    if (container.type == RoaringContainerType::ARRAY) {
+        for (const unsigned short value: container.array) {
+            bitmap[value / WORD_BITS] |= 1ULL << (value % WORD_BITS);
+        }
+    } else {
+        for (const RoaringRun &run: container.runs) {
+            RoaringContainer_setBits(bitmap.data(), run.start, static_cast<unsigned int>(run.start) + run.length + 1);
+        }
+    }
+
+    container.bitmap = std::move(bitmap);
+    container.type = RoaringContainerType::BITMAP;
+    RoaringContainer_release(container);
+}
+
+static void RoaringContainer_toArray(RoaringContainer &container) {
+    std::vector<unsigned short> array;
+    array.reserve(container.cardinality);
+    RoaringContainer_forEach(container, [&array](unsigned int value) {
+        array.push_back(static_cast<unsigned short>(value));
+    });
+
+    container.array = std::move(array);
+    container.type = RoaringContainerType::ARRAY;
+    RoaringContainer_release(container);
+}
+
+/**
+ * Pick the array or bitmap form by cardinality, runs become one of them too.
+ * Everything but the run aware paths works on these two only.
+ */
+static void RoaringContainer_normalize(RoaringContainer &container) {
+    if (container.cardinality <= ARRAY_MAX_SIZE) {
+        if (container.type != RoaringContainerType::ARRAY) RoaringContainer_toArray(container);
+    } else if (container.type != RoaringContainerType::BITMAP) {
+        RoaringContainer_toBitmap(container);
+    }
+}
+
+/**
+ * container itself if it's an array or a bitmap, else its array or bitmap form built in scratch.
+ */
+static const RoaringContainer &RoaringContainer_plain(const RoaringContainer &container, RoaringContainer &scratch) {
+    if (container.type != RoaringContainerType::RUN) {
+        return container;
+    }
+
+    scratch.type = RoaringContainerType::RUN;
+    scratch.cardinality = container.cardinality;
+    scratch.runs = container.runs;
+    RoaringContainer_normalize(scratch);
+    return scratch;
+}
+
+/**
+ * The first run starting after value.
+ */
+static __forceinline std::vector<RoaringRun>::const_iterator RoaringContainer_runAfter(
+        const std::vector<RoaringRun> &runs, unsigned int value) {
+    return std::upper_bound(runs.begin(), runs.end(), value, [](unsigned int v, const RoaringRun &run) {
+        return v < run.start;
+    });
+}
+
+static bool RoaringContainer_contains(const RoaringContainer &container, unsigned short value) {
+    switch (container.type) {
+        case RoaringContainerType::ARRAY:
+            return std::binary_search(container.array.begin(), container.array.end(), value);
+        case RoaringContainerType::BITMAP:
+            return RoaringContainer_testBit(container.bitmap, value);
+        case RoaringContainerType::RUN: {
+            const auto after = RoaringContainer_runAfter(container.runs, value);
+            if (after == container.runs.begin()) return false;
+            const RoaringRun &run = *(after - 1);
+            return value <= static_cast<unsigned int>(run.start) + run.length;
+        }
+    }
+    return false;
+}
+
+/**
+ * @return if value wasn't there
+ */
+static bool RoaringContainer_add(RoaringContainer &container, unsigned short value) {
+    if (container.type == RoaringContainerType::RUN) {
+        if (RoaringContainer_contains(container, value)) return false;
+        RoaringContainer_normalize(container);
+    }
+
+    if (container.type == RoaringContainerType::ARRAY) {
+        const auto it = std::lower_bound(container.array.begin(), container.array.end(), value);
+        if (it != container.array.end() && *it == value) return false;
+        if (container.cardinality < ARRAY_MAX_SIZE) {
+            container.array.insert(it, value);
+            ++container.cardinality;
+            return true;
+        }
+        RoaringContainer_toBitmap(container);
+    }
+
+    unsigned long long &word = container.bitmap[value / WORD_BITS];
+    const unsigned long long bit = 1ULL << (value % WORD_BITS);
+    if ((word & bit) != 0) return false;
+    word |= bit;
+    ++container.cardinality;
+    return true;
+}
+
+/**
+ * @return if value was there
+ */
+static bool RoaringContainer_remove(RoaringContainer &container, unsigned short value) {
+    if (!RoaringContainer_contains(container, value)) return false;
+    if (container.type == RoaringContainerType::RUN) {
+        RoaringContainer_normalize(container);
+    }
+
+    if (container.type == RoaringContainerType::ARRAY) {
+        container.array.erase(std::lower_bound(container.array.begin(), container.array.end(), value));
+    } else {
+        container.bitmap[value / WORD_BITS] &= ~(1ULL << (value % WORD_BITS));
+    }
+    --container.cardinality;
+
+    if (container.type == RoaringContainerType::BITMAP && container.cardinality <= ARRAY_MAX_SIZE) {
+        RoaringContainer_toArray(container);
+    }
+    return true;
+}
+
+/**
+ * Number of values not greater than value.
+ */
+static unsigned int RoaringContainer_rank(const RoaringContainer &container, unsigned short value) {
+    switch (container.type) {
+        case RoaringContainerType::ARRAY:
+            return static_cast<unsigned int>(
+                    std::upper_bound(container.array.begin(), container.array.end(), value) - container.array.begin());
+        case RoaringContainerType::BITMAP: {
+            const size_t w = value / WORD_BITS;
+            const unsigned long long mask = ALL_BITS >> (WORD_BITS - 1 - value % WORD_BITS);
+            return static_cast<unsigned int>(simd::simdPopcount(container.bitmap.data(), w)
+                                             + std::popcount(container.bitmap[w] & mask));
+        }
+        case RoaringContainerType::RUN: {
+            unsigned int rank = 0;
+            for (const RoaringRun &run: container.runs) {
+                if (run.start > value) break;
+                const unsigned int end = std::min<unsigned int>(value, static_cast<unsigned int>(run.start) + run.length);
+                rank += end - run.start + 1;
+            }
+            return rank;
+        }
+    }
+    return 0;
+}
+
+/**
+ * The index-th smallest value, index must be less than the cardinality.
+ */
+static unsigned short RoaringContainer_select(const RoaringContainer &container, unsigned int index) {
+    switch (container.type) {
+        case RoaringContainerType::ARRAY:
+            return container.array[index];
+        case RoaringContainerType::BITMAP:
+            for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                unsigned long long word = container.bitmap[w];
+                const auto count = static_cast<unsigned int>(std::popcount(word));
+                if (index < count) {
+                    for (; index > 0; --index) {
+                        word &= word - 1;
+                    }
+                    return static_cast<unsigned short>(w * WORD_BITS + std::countr_zero(word));
+                }
+                index -= count;
+            }
+            break;
+        case RoaringContainerType::RUN:
+            for (const RoaringRun &run: container.runs) {
+                if (index <= run.length) {
+                    return static_cast<unsigned short>(run.start + index);
+                }
+                index -= static_cast<unsigned int>(run.length) + 1;
+            }
+            break;
+    }
+    return 0;
+}
+
+static unsigned short RoaringContainer_max(const RoaringContainer &container) {
+    switch (container.type) {
+        case RoaringContainerType::ARRAY:
+            return container.array.back();
+        case RoaringContainerType::BITMAP:
+            for (size_t w = BITMAP_WORDS; w-- > 0;) {
+                if (container.bitmap[w] != 0) {
+                    return static_cast<unsigned short>(w * WORD_BITS + WORD_BITS - 1
+                                                       - std::countl_zero(container.bitmap[w]));
+                }
+            }
+            break;
+        case RoaringContainerType::RUN:
+            return static_cast<unsigned short>(container.runs.back().start + container.runs.back().length);
+    }
+    return 0;
+}
+
+/**
+ * Find the smallest value not less than from.
+ * @return if there is one
+ */
+static bool RoaringContainer_next(const RoaringContainer &container, unsigned int from, unsigned int &value) {
+    switch (container.type) {
+        case RoaringContainerType::ARRAY: {
+            const auto it = std::lower_bound(container.array.begin(), container.array.end(), from);
+            if (it == container.array.end()) return false;
+            value = *it;
+            return true;
+        }
+        case RoaringContainerType::BITMAP: {
+            size_t w = from / WORD_BITS;
+            unsigned long long word = container.bitmap[w] & (ALL_BITS << (from % WORD_BITS));
+            while (word == 0) {
+                if (++w == BITMAP_WORDS) return false;
+                word = container.bitmap[w];
+            }
+            value = static_cast<unsigned int>(w * WORD_BITS + std::countr_zero(word));
+            return true;
+        }
+        case RoaringContainerType::RUN: {
+            const auto after = RoaringContainer_runAfter(container.runs, from);
+            if (after != container.runs.begin()
+                && from <= static_cast<unsigned int>((after - 1)->start) + (after - 1)->length) {
+                value = from;
+                return true;
+            }
+            if (after == container.runs.end()) return false;
+            value = after->start;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool RoaringContainer_equal(const RoaringContainer &left, const RoaringContainer &right) {
+    if (left.cardinality != right.cardinality) return false;
+
+    if (left.type == right.type) {
+        switch (left.type) {
+            case RoaringContainerType::ARRAY:
+                return left.array == right.array;
+            case RoaringContainerType::BITMAP:
+                return left.bitmap == right.bitmap;
+            case RoaringContainerType::RUN:
+                // runs are kept maximal, so the same values are the same runs
+                return left.runs == right.runs;
+        }
+    }
+
+    // with the same cardinality both normalize to the same type
+    RoaringContainer leftScratch, rightScratch;
+    return RoaringContainer_equal(RoaringContainer_plain(left, leftScratch), RoaringContainer_plain(right, rightScratch));
+}
+
+static size_t RoaringContainer_runCount(const RoaringContainer &container) {
+    switch (container.type) {
+        case RoaringContainerType::ARRAY: {
+            size_t count = 0;
+            for (size_t i = 0; i < container.array.size(); ++i) {
+                count += i == 0 || container.array[i] != container.array[i - 1] + 1;
+            }
+            return count;
+        }
+        case RoaringContainerType::BITMAP: {
+            // a run starts at every set bit whose lower neighbour is clear
+            size_t count = 0;
+            unsigned long long carry = 0;
+            for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                const unsigned long long word = container.bitmap[w];
+                count += std::popcount(word & ~(word << 1 | carry));
+                carry = word >> (WORD_BITS - 1);
+            }
+            return count;
+        }
+        case RoaringContainerType::RUN:
+            return container.runs.size();
+    }
+    return 0;
+}
+
+/**
+ * Use runs if they take less room than the array or bitmap, and go back if not.
+ * @return if the type changed
+ */
+static bool RoaringContainer_runOptimize(RoaringContainer &container) {
+    const size_t runBytes = 2 + 4 * RoaringContainer_runCount(container);
+    const size_t plainBytes = container.cardinality <= ARRAY_MAX_SIZE ? 2 * container.cardinality : BITMAP_BYTES;
+
+    if (runBytes >= plainBytes) {
+        if (container.type != RoaringContainerType::RUN) return false;
+        RoaringContainer_normalize(container);
+        return true;
+    }
+    if (container.type == RoaringContainerType::RUN) return false;
+
+    std::vector<RoaringRun> runs;
+    RoaringContainer_forEach(container, [&runs](unsigned int value) {
+        if (!runs.empty() && value == static_cast<unsigned int>(runs.back().start) + runs.back().length + 1) {
+            ++runs.back().length;
+        } else {
+            runs.push_back({static_cast<unsigned short>(value), 0});
+        }
+    });
+
+    container.runs = std::move(runs);
+    container.type = RoaringContainerType::RUN;
+    RoaringContainer_release(container);
+    return true;
+}
+
+static RoaringContainer RoaringContainer_intersect(const RoaringContainer &leftContainer, const RoaringContainer &rightContainer) {
+    if (RoaringContainer_isFull(leftContainer)) return rightContainer;
+    if (RoaringContainer_isFull(rightContainer)) return leftContainer;
+
+    RoaringContainer leftScratch, rightScratch;
+    const RoaringContainer *left = &RoaringContainer_plain(leftContainer, leftScratch);
+    const RoaringContainer *right = &RoaringContainer_plain(rightContainer, rightScratch);
+    if (left->type == RoaringContainerType::BITMAP && right->type == RoaringContainerType::ARRAY) {
+        std::swap(left, right);
+    }
+
+    RoaringContainer result;
+    if (left->type == RoaringContainerType::ARRAY && right->type == RoaringContainerType::ARRAY) {
+        result.array.resize(std::min(left->array.size(), right->array.size()) + simd::INTERSECT_PADDING);
+        const size_t count = simd::simdIntersect(left->array.data(), left->array.size(),
+                                                 right->array.data(), right->array.size(), result.array.data());
+        result.array.resize(count);
+        result.cardinality = static_cast<unsigned int>(count);
+    } else if (left->type == RoaringContainerType::ARRAY) {
+        result.array.reserve(left->array.size());
+        for (const unsigned short value: left->array) {
+            if (RoaringContainer_testBit(right->bitmap, value)) {
+                result.array.push_back(value);
+            }
+        }
+        result.cardinality = static_cast<unsigned int>(result.array.size());
+    } else {
+        result.type = RoaringContainerType::BITMAP;
+        result.bitmap.resize(BITMAP_WORDS);
+        simd::simdAnd(left->bitmap.data(), right->bitmap.data(), result.bitmap.data(), BITMAP_WORDS);
+        result.cardinality = static_cast<unsigned int>(simd::simdPopcount(result.bitmap.data(), BITMAP_WORDS));
+        RoaringContainer_normalize(result);
+    }
+    return result;
+}
+
+static RoaringContainer RoaringContainer_unite(const RoaringContainer &leftContainer, const RoaringContainer &rightContainer) {
+    if (RoaringContainer_isFull(leftContainer)) return leftContainer;
+    if (RoaringContainer_isFull(rightContainer)) return rightContainer;
+
+    RoaringContainer leftScratch, rightScratch;
+    const RoaringContainer *left = &RoaringContainer_plain(leftContainer, leftScratch);
+    const RoaringContainer *right = &RoaringContainer_plain(rightContainer, rightScratch);
+    if (left->type == RoaringContainerType::ARRAY && right->type == RoaringContainerType::BITMAP) {
+        std::swap(left, right);
+    }
+
+    RoaringContainer result;
+    if (left->type == RoaringContainerType::ARRAY) {  // both arrays
+        if (left->cardinality + right->cardinality <= ARRAY_MAX_SIZE) {
+            result.array.resize(left->array.size() + right->array.size());
+            const auto end = std::set_union(left->array.begin(), left->array.end(),
+                                            right->array.begin(), right->array.end(), result.array.begin());
+            result.array.resize(static_cast<size_t>(end - result.array.begin()));
+            result.cardinality = static_cast<unsigned int>(result.array.size());
+            return result;
+        }
+
+        result.type = RoaringContainerType::BITMAP;
+        result.bitmap.assign(BITMAP_WORDS, 0);
+        for (const unsigned short value: left->array) {
+            result.bitmap[value / WORD_BITS] |= 1ULL << (value % WORD_BITS);
+        }
+        for (const unsigned short value: right->array) {
+            result.bitmap[value / WORD_BITS] |= 1ULL << (value % WORD_BITS);
+        }
+        result.cardinality = static_cast<unsigned int>(simd::simdPopcount(result.bitmap.data(), BITMAP_WORDS));
+    } else if (right->type == RoaringContainerType::ARRAY) {
+        result.type = RoaringContainerType::BITMAP;
+        result.bitmap = left->bitmap;
+        result.cardinality = left->cardinality;
+        for (const unsigned short value: right->array) {
+            unsigned long long &word = result.bitmap[value / WORD_BITS];
+            const unsigned long long bit = 1ULL << (value % WORD_BITS);
+            result.cardinality += (word & bit) == 0;
+            word |= bit;
+        }
+    } else {
+        result.type = RoaringContainerType::BITMAP;
+        result.bitmap.resize(BITMAP_WORDS);
+        simd::simdOr(left->bitmap.data(), right->bitmap.data(), result.bitmap.data(), BITMAP_WORDS);
+        result.cardinality = static_cast<unsigned int>(simd::simdPopcount(result.bitmap.data(), BITMAP_WORDS));
+    }
+    RoaringContainer_normalize(result);
+    return result;
+}
+
+static RoaringContainer RoaringContainer_difference(const RoaringContainer &leftContainer, const RoaringContainer &rightContainer) {
+    if (RoaringContainer_isFull(rightContainer)) return {};
+
+    RoaringContainer leftScratch, rightScratch;
+    const RoaringContainer &left = RoaringContainer_plain(leftContainer, leftScratch);
+    const RoaringContainer &right = RoaringContainer_plain(rightContainer, rightScratch);
+
+    RoaringContainer result;
+    if (left.type == RoaringContainerType::ARRAY) {
+        if (right.type == RoaringContainerType::ARRAY) {
+            result.array.resize(left.array.size());
+            const auto end = std::set_difference(left.array.begin(), left.array.end(),
+                                                 right.array.begin(), right.array.end(), result.array.begin());
+            result.array.resize(static_cast<size_t>(end - result.array.begin()));
+        } else {
+            result.array.reserve(left.array.size());
+            for (const unsigned short value: left.array) {
+                if (!RoaringContainer_testBit(right.bitmap, value)) {
+                    result.array.push_back(value);
+                }
+            }
+        }
+        result.cardinality = static_cast<unsigned int>(result.array.size());
+        return result;
+    }
+
+    result.type = RoaringContainerType::BITMAP;
+    if (right.type == RoaringContainerType::ARRAY) {
+        result.bitmap = left.bitmap;
+        result.cardinality = left.cardinality;
+        for (const unsigned short value: right.array) {
+            unsigned long long &word = result.bitmap[value / WORD_BITS];
+            const unsigned long long bit = 1ULL << (value % WORD_BITS);
+            result.cardinality -= (word & bit) != 0;
+            word &= ~bit;
+        }
+    } else {
+        result.bitmap.resize(BITMAP_WORDS);
+        simd::simdAndNot(left.bitmap.data(), right.bitmap.data(), result.bitmap.data(), BITMAP_WORDS);
+        result.cardinality = static_cast<unsigned int>(simd::simdPopcount(result.bitmap.data(), BITMAP_WORDS));
+    }
+    RoaringContainer_normalize(result);
+    return result;
+}
+
+/**
+ * The keys and containers of a set, without the python object around them.
+ */
+struct RoaringChunks {
+    std::vector<unsigned short> keys;
+    std::vector<RoaringContainer> containers;
+};
+
+/**
+ * Merge left and right key by key into keys and containers, empty results are dropped.
+ * Throws std::bad_alloc if the containers can't be allocated.
+ */
+template<SetOp Op, typename Left, typename Right>
+static void RoaringBitmap_combine(const Left &left, const Right &right,
+                                  std::vector<unsigned short> &keys, std::vector<RoaringContainer> &containers) {
+    const size_t leftSize = left.keys.size();
+    const size_t rightSize = right.keys.size();
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < leftSize && j < rightSize) {
+        const unsigned short leftKey = left.keys[i];
+        const unsigned short rightKey = right.keys[j];
+        if (leftKey < rightKey) {
+            if constexpr (Op != SetOp::AND) {
+                keys.push_back(leftKey);
+                containers.push_back(left.containers[i]);
+            }
+            ++i;
+        } else if (rightKey < leftKey) {
+            if constexpr (Op == SetOp::OR) {
+                keys.push_back(rightKey);
+                containers.push_back(right.containers[j]);
+            }
+            ++j;
+        } else {
+            RoaringContainer container;
+            if constexpr (Op == SetOp::AND) {
+                container = RoaringContainer_intersect(left.containers[i], right.containers[j]);
+            } else if constexpr (Op == SetOp::OR) {
+                container = RoaringContainer_unite(left.containers[i], right.containers[j]);
+            } else {
+                container = RoaringContainer_difference(left.containers[i], right.containers[j]);
+            }
+            if (container.cardinality != 0) {
+                keys.push_back(leftKey);
+                containers.push_back(std::move(container));
+            }
+            ++i;
+            ++j;
+        }
+    }
+
+    if constexpr (Op != SetOp::AND) {
+        for (; i < leftSize; ++i) {
+            keys.push_back(left.keys[i]);
+            containers.push_back(left.containers[i]);
+        }
+    }
+    if constexpr (Op == SetOp::OR) {
+        for (; j < rightSize; ++j) {
+            keys.push_back(right.keys[j]);
+            containers.push_back(right.containers[j]);
+        }
+    }
+}
+
+/**
+ * Replace the content of self with self op other.
+ */
+template<SetOp Op, typename Other>
+static void RoaringBitmap_update(RoaringBitmap *self, const Other &other) {
+    std::vector<unsigned short> keys;
+    std::vector<RoaringContainer> containers;
+    RoaringBitmap_combine<Op>(*self, other, keys, containers);
+    self->keys = std::move(keys);
+    self->containers = std::move(containers);
+}
+
+/**
+ * Add values, which must be sorted ascending but may repeat.
+ * Throws std::bad_alloc if the containers can't be allocated.
+ */
+static void RoaringBitmap_addSorted(RoaringBitmap *self, const unsigned int *values, size_t size) {
+    RoaringChunks chunks;
+
+    size_t i = 0;
+    while (i < size) {
+        const auto key = static_cast<unsigned short>(values[i] >> 16);
+
+        RoaringContainer container;
+        for (; i < size && values[i] >> 16 == key; ++i) {
+            const auto low = static_cast<unsigned short>(values[i]);
+            if (container.array.empty() || container.array.back() != low) {
+                container.array.push_back(low);
+            }
+        }
+        container.cardinality = static_cast<unsigned int>(container.array.size());
+        RoaringContainer_normalize(container);
+
+        chunks.keys.push_back(key);
+        chunks.containers.push_back(std::move(container));
+    }
+
+    if (self->keys.empty()) {
+        self->keys = std::move(chunks.keys);
+        self->containers = std::move(chunks.containers);
+    } else {
+        RoaringBitmap_update<SetOp::OR>(self, chunks);
+    }
+}
+
+/**
+ * Add the values from start to stop, stop not included. stop must not be greater than 2 ** 32.
+ * Throws std::bad_alloc if the containers can't be allocated.
+ */
+static void RoaringBitmap_addRange(RoaringBitmap *self, unsigned long long start, unsigned long long stop) {
+    if (start >= stop) return;
+
+    RoaringChunks chunks;
+    for (unsigned long long key = start >> 16; key <= (stop - 1) >> 16; ++key) {
+        const unsigned long long low = std::max(start, key << 16) & 0xFFFF;
+        const unsigned long long high = std::min(stop - 1, (key << 16) | 0xFFFF) & 0xFFFF;
+
+        RoaringContainer container;
+        container.type = RoaringContainerType::RUN;
+        container.cardinality = static_cast<unsigned int>(high - low + 1);
+        container.runs.push_back({static_cast<unsigned short>(low), static_cast<unsigned short>(high - low)});
+
+        chunks.keys.push_back(static_cast<unsigned short>(key));
+        chunks.containers.push_back(std::move(container));
+    }
+
+    RoaringBitmap_update<SetOp::OR>(self, chunks);
+}
+
+static __forceinline size_t RoaringBitmap_find(const RoaringBitmap *self, unsigned short key) {
+    return static_cast<size_t>(std::lower_bound(self->keys.begin(), self->keys.end(), key) - self->keys.begin());
+}
+
+static bool RoaringBitmap_containsValue(const RoaringBitmap *self, unsigned int value) {
+    const auto key = static_cast<unsigned short>(value >> 16);
+    const size_t index = RoaringBitmap_find(self, key);
+    return index < self->keys.size() && self->keys[index] == key
+           && RoaringContainer_contains(self->containers[index], static_cast<unsigned short>(value));
+}
+
+/**
+ * Throws std::bad_alloc if the container can't be allocated.
+ */
+static void RoaringBitmap_addValue(RoaringBitmap *self, unsigned int value) {
+    const auto key = static_cast<unsigned short>(value >> 16);
+    const size_t index = RoaringBitmap_find(self, key);
+    if (index == self->keys.size() || self->keys[index] != key) {
+        self->keys.insert(self->keys.begin() + static_cast<Py_ssize_t>(index), key);
+        self->containers.emplace(self->containers.begin() + static_cast<Py_ssize_t>(index));
+    }
+    RoaringContainer_add(self->containers[index], static_cast<unsigned short>(value));
+}
+
+/**
+ * @return if value was there
+ */
+static bool RoaringBitmap_removeValue(RoaringBitmap *self, unsigned int value) {
+    const auto key = static_cast<unsigned short>(value >> 16);
+    const size_t index = RoaringBitmap_find(self, key);
+    if (index == self->keys.size() || self->keys[index] != key
+        || !RoaringContainer_remove(self->containers[index], static_cast<unsigned short>(value))) {
+        return false;
+    }
+
+    if (self->containers[index].cardinality == 0) {
+        self->keys.erase(self->keys.begin() + static_cast<Py_ssize_t>(index));
+        self->containers.erase(self->containers.begin() + static_cast<Py_ssize_t>(index));
+    }
+    return true;
+}
+
+static unsigned long long RoaringBitmap_cardinality(const RoaringBitmap *self) {
+    unsigned long long cardinality = 0;
+    for (const RoaringContainer &container: self->containers) {
+        cardinality += container.cardinality;
+    }
+    return cardinality;
+}
+
+template<typename Func>
+static __forceinline void RoaringBitmap_forEach(const RoaringBitmap *self, Func func) {
+    for (size_t i = 0; i < self->keys.size(); ++i) {
+        const unsigned int high = static_cast<unsigned int>(self->keys[i]) << 16;
+        RoaringContainer_forEach(self->containers[i], [&func, high](unsigned int low) {
+            func(high | low);
+        });
+    }
+}
+
+static __forceinline void RoaringBitmap_writeShort(char *&out, unsigned int value) {
+    out[0] = static_cast<char>(value & 0xFF);
+    out[1] = static_cast<char>(value >> 8 & 0xFF);
+    out += 2;
+}
+
+static __forceinline void RoaringBitmap_writeInt(char *&out, unsigned int value) {
+    RoaringBitmap_writeShort(out, value & 0xFFFF);
+    RoaringBitmap_writeShort(out, value >> 16);
+}
+
+static __forceinline unsigned int RoaringBitmap_readShort(const unsigned char *&in) {
+    const unsigned int value = in[0] | static_cast<unsigned int>(in[1]) << 8;
+    in += 2;
+    return value;
+}
+
+static __forceinline unsigned int RoaringBitmap_readInt(const unsigned char *&in) {
+    const unsigned int low = RoaringBitmap_readShort(in);
+    return low | RoaringBitmap_readShort(in) << 16;
+}
+
+static __forceinline bool RoaringBitmap_hasRuns(const RoaringBitmap *self) {
+    return std::any_of(self->containers.begin(), self->containers.end(), [](const RoaringContainer &container) {
+        return container.type == RoaringContainerType::RUN;
+    });
+}
+
+static __forceinline size_t RoaringContainer_serializedSize(const RoaringContainer &container) {
+    if (container.type == RoaringContainerType::RUN) {
+        return 2 + 4 * container.runs.size();
+    }
+    return container.type == RoaringContainerType::ARRAY ? 2 * container.array.size() : BITMAP_BYTES;
+}
+
+static size_t RoaringBitmap_serializedSize(const RoaringBitmap *self) {
+    const size_t count = self->keys.size();
+    const bool hasRuns = RoaringBitmap_hasRuns(self);
+
+    size_t size = hasRuns ? 4 + (count + 7) / 8 : 8;
+    size += 4 * count;
+    if (!hasRuns || count >= NO_OFFSET_THRESHOLD) {
+        size += 4 * count;
+    }
+    for (const RoaringContainer &container: self->containers) {
+        size += RoaringContainer_serializedSize(container);
+    }
+    return size;
+}
+
+/**
+ * Write self in the portable format, out must have RoaringBitmap_serializedSize(self) bytes.
+ */
+static void RoaringBitmap_serialize(const RoaringBitmap *self, char *out) {
+    const char *begin = out;
+    const size_t count = self->keys.size();
+    const bool hasRuns = RoaringBitmap_hasRuns(self);
+
+    if (hasRuns) {
+        RoaringBitmap_writeInt(out, SERIAL_COOKIE | static_cast<unsigned int>(count - 1) << 16);
+        std::memset(out, 0, (count + 7) / 8);
+        for (size_t i = 0; i < count; ++i) {
+            if (self->containers[i].type == RoaringContainerType::RUN) {
+                out[i / 8] = static_cast<char>(out[i / 8] | 1 << (i % 8));
+            }
+        }
+        out += (count + 7) / 8;
+    } else {
+        RoaringBitmap_writeInt(out, SERIAL_COOKIE_NO_RUNCONTAINER);
+        RoaringBitmap_writeInt(out, static_cast<unsigned int>(count));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        RoaringBitmap_writeShort(out, self->keys[i]);
+        RoaringBitmap_writeShort(out, self->containers[i].cardinality - 1);
+    }
+
+    if (!hasRuns || count >= NO_OFFSET_THRESHOLD) {
+        auto offset = static_cast<unsigned int>(out - begin + 4 * count);
+        for (const RoaringContainer &container: self->containers) {
+            RoaringBitmap_writeInt(out, offset);
+            offset += static_cast<unsigned int>(RoaringContainer_serializedSize(container));
+        }
+    }
+
+    for (const RoaringContainer &container: self->containers) {
+        switch (container.type) {
+            case RoaringContainerType::ARRAY:
+                for (const unsigned short value: container.array) {
+                    RoaringBitmap_writeShort(out, value);
+                }
+                break;
+            case RoaringContainerType::BITMAP:
+                for (const unsigned long long word: container.bitmap) {
+                    RoaringBitmap_writeInt(out, static_cast<unsigned int>(word));
+                    RoaringBitmap_writeInt(out, static_cast<unsigned int>(word >> 32));
+                }
+                break;
+            case RoaringContainerType::RUN:
+                RoaringBitmap_writeShort(out, static_cast<unsigned int>(container.runs.size()));
+                for (const RoaringRun &run: container.runs) {
+                    RoaringBitmap_writeShort(out, run.start);
+                    RoaringBitmap_writeShort(out, run.length);
+                }
+                break;
+        }
+    }
+}
+
+/**
+ * Read the portable format into keys and containers, checking everything.
+ * Throws std::bad_alloc if the containers can't be allocated.
+ * @return false if data isn't a valid serialized bitmap
+ */
+static bool RoaringBitmap_deserialize(const unsigned char *data, size_t size, RoaringChunks &result) {
+    const unsigned char *in = data;
+    const unsigned char *const end = data + size;
+    const auto remains = [&in, end](size_t bytes) {
+        return static_cast<size_t>(end - in) >= bytes;
+    };
+
+    if (!remains(4)) return false;
+    const unsigned int cookie = RoaringBitmap_readInt(in);
+
+    size_t count;
+    const unsigned char *runFlags = nullptr;
+    if ((cookie & 0xFFFF) == SERIAL_COOKIE) {
+        count = (cookie >> 16) + 1;
+        if (!remains((count + 7) / 8)) return false;
+        runFlags = in;
+        in += (count + 7) / 8;
+    } else if (cookie == SERIAL_COOKIE_NO_RUNCONTAINER) {
+        if (!remains(4)) return false;
+        count = RoaringBitmap_readInt(in);
+        if (count > CONTAINER_VALUES) return false;
+    } else {
+        return false;
+    }
+
+    if (!remains(4 * count)) return false;
+    std::vector<unsigned int> cardinalities(count);
+    result.keys.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        result.keys[i] = static_cast<unsigned short>(RoaringBitmap_readShort(in));
+        cardinalities[i] = RoaringBitmap_readShort(in) + 1;
+        if (i > 0 && result.keys[i] <= result.keys[i - 1]) return false;
+    }
+
+    // containers are stored in order, the offsets are only for random access
+    if (runFlags == nullptr || count >= NO_OFFSET_THRESHOLD) {
+        if (!remains(4 * count)) return false;
+        in += 4 * count;
+    }
+
+    result.containers.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        RoaringContainer &container = result.containers[i];
+        const unsigned int cardinality = cardinalities[i];
+
+        if (runFlags != nullptr && (runFlags[i / 8] >> (i % 8) & 1) != 0) {
+            if (!remains(2)) return false;
+            const unsigned int runCount = RoaringBitmap_readShort(in);
+            if (!remains(4 * static_cast<size_t>(runCount))) return false;
+
+            container.type = RoaringContainerType::RUN;
+            container.runs.reserve(runCount);
+            long long previousEnd = -1;
+            for (unsigned int r = 0; r < runCount; ++r) {
+                const unsigned int start = RoaringBitmap_readShort(in);
+                const unsigned int length = RoaringBitmap_readShort(in);
+                if (start + length >= CONTAINER_VALUES || static_cast<long long>(start) <= previousEnd) return false;
+
+                // other writers may leave adjacent runs apart, join them to keep runs maximal
+                if (static_cast<long long>(start) == previousEnd + 1 && !container.runs.empty()) {
+                    container.runs.back().length = static_cast<unsigned short>(container.runs.back().length + length + 1);
+                } else {
+                    container.runs.push_back({static_cast<unsigned short>(start), static_cast<unsigned short>(length)});
+                }
+                container.cardinality += length + 1;
+                previousEnd = start + length;
+            }
+            if (container.cardinality != cardinality) return false;
+        } else if (cardinality <= ARRAY_MAX_SIZE) {
+            if (!remains(2 * static_cast<size_t>(cardinality))) return false;
+
+            container.array.resize(cardinality);
+            for (unsigned int v = 0; v < cardinality; ++v) {
+                container.array[v] = static_cast<unsigned short>(RoaringBitmap_readShort(in));
+                if (v > 0 && container.array[v] <= container.array[v - 1]) return false;
+            }
+            container.cardinality = cardinality;
+        } else {
+            if (!remains(BITMAP_BYTES)) return false;
+
+            container.type = RoaringContainerType::BITMAP;
+            container.bitmap.resize(BITMAP_WORDS);
+            for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                const unsigned long long low = RoaringBitmap_readInt(in);
+                container.bitmap[w] = low | static_cast<unsigned long long>(RoaringBitmap_readInt(in)) << 32;
+            }
+            container.cardinality = static_cast<unsigned int>(simd::simdPopcount(container.bitmap.data(), BITMAP_WORDS));
+            if (container.cardinality != cardinality) return false;
+        }
+    }
+
+    return in == end;
+}
+
+static __forceinline bool isIntBuffer(PyObject *obj) {
+    return Py_TYPE(obj) == &IntArrayListType || Py_TYPE(obj) == &BigIntArrayListType || PyObject_CheckBuffer(obj);
+}
+
+static __forceinline bool isUnsignedIntRange(const long long value) {
+    return value >= 0 && value <= UINT_MAX;
+}
+
+static __forceinline void setRangeError() {
+    PyErr_SetString(PyExc_OverflowError, "RoaringBitmap values must be in range(2 ** 32)");
+}
+
+static __forceinline RoaringBitmap *RoaringBitmap_new() {
+    return Py_CreateObj<RoaringBitmap>(RoaringBitmapType);
+}
+
+// set algebra, like python's set both operands must be RoaringBitmaps
+
+template<SetOp Op>
+static PyObject *RoaringBitmap_binary(PyObject *pyLeft, PyObject *pyRight) {
+    if (Py_TYPE(pyLeft) != &RoaringBitmapType || Py_TYPE(pyRight) != &RoaringBitmapType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    auto *result = RoaringBitmap_new();
+    if (result == nullptr) return nullptr;
+
+    try {
+        RoaringBitmap_combine<Op>(*reinterpret_cast<RoaringBitmap *>(pyLeft), *reinterpret_cast<RoaringBitmap *>(pyRight),
+                                  result->keys, result->containers);
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+template<SetOp Op>
+static PyObject *RoaringBitmap_inplace(PyObject *pySelf, PyObject *other) {
+    if (Py_TYPE(other) != &RoaringBitmapType)
+        Py_RETURN_NOTIMPLEMENTED;
+
+    try {
+        RoaringBitmap_update<Op>(reinterpret_cast<RoaringBitmap *>(pySelf), *reinterpret_cast<RoaringBitmap *>(other));
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+
+/**
+ * Copy the values of self in ascending order into a new list of listType.
+ * If not successful, function will raise python exception.
+ */
+template<typename List>
+static PyObject *RoaringBitmap_toList(RoaringBitmap *self, PyTypeObject &listType) {
+    auto *result = Py_CreateObj<List>(listType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        auto &vector = result->vector;
+        vector.resize(RoaringBitmap_cardinality(self));
+        using Value = typename decltype(List::vector)::value_type;
+        Value *out = vector.data();
+        RoaringBitmap_forEach(self, [&out](unsigned int value) {
+            *out++ = static_cast<Value>(value);
+        });
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+
+extern "C" {
+
+PyTypeObject RoaringBitmapType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+/**
+ * Convert a python object to a value of the set, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, unsigned int &result) {
+    const long long value = PyLong_AsLongLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+    if (UNLIKELY(!isUnsignedIntRange(value))) {
+        setRangeError();
+        return false;
+    }
+    result = static_cast<unsigned int>(value);
+    return true;
+}
+
+/**
+ * Convert a lookup key. Unlike convert, keys which can't be a value are simply "not in the set".
+ * @return 1 if converted, 0 if the key can't be in the set, -1 if error
+ */
+static __forceinline int convertKey(PyObject *obj, unsigned int &result) {
+    if (!PyLong_Check(obj)) {
+        return 0;
+    }
+
+    int overflow = 0;
+    const long long value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+    if (value == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (overflow != 0 || !isUnsignedIntRange(value)) {
+        return 0;
+    }
+    result = static_cast<unsigned int>(value);
+    return 1;
+}
+
+/**
+ * Collect the values of an UnsignedIntArrayList, an IntArrayList, a BigIntArrayList, an int buffer
+ * or any iterable of ints.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool RoaringBitmap_collect(PyObject *obj, std::vector<unsigned int> &values) {
+    if (Py_TYPE(obj) == &UnsignedIntArrayListType) {
+        const auto &vector = reinterpret_cast<UnsignedIntArrayList *>(obj)->vector;
+        values.assign(vector.begin(), vector.end());
+        return true;
+    }
+
+    if (isIntBuffer(obj)) {
+        IntBuffer buffer;
+        if (!IntBuffer_open(obj, buffer)) {
+            return false;
+        }
+
+        bool inRange = true;
+        values.reserve(buffer.size);
+        IntBuffer_forEach(buffer, [&values, &inRange](const long long value) {
+            inRange &= isUnsignedIntRange(value);
+            values.push_back(static_cast<unsigned int>(value));
+        });
+        IntBuffer_release(buffer);
+
+        if (!inRange) {
+            setRangeError();
+        }
+        return inRange;
+    }
+
+    PyObject *iter = PyObject_GetIter(obj);
+    if (iter == nullptr) {
+        return false;
+    }
+
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        unsigned int value;
+        const bool success = convert(item, value);
+        SAFE_DECREF(item);
+        if (!success) {
+            SAFE_DECREF(iter);
+            return false;
+        }
+        values.push_back(value);
+    }
+    SAFE_DECREF(iter);
+    return !PyErr_Occurred();
+}
+
+static int RoaringBitmap_addFrom(RoaringBitmap *self, PyObject *obj) {
+    try {
+        if (Py_TYPE(obj) == &RoaringBitmapType) {
+            RoaringBitmap_update<SetOp::OR>(self, *reinterpret_cast<RoaringBitmap *>(obj));
+            return 0;
+        }
+
+        std::vector<unsigned int> values;
+        if (!RoaringBitmap_collect(obj, values)) {
+            return -1;
+        }
+
+        if (!std::is_sorted(values.begin(), values.end())) {
+            simd::simdsort(values.data(), values.size(), false);
+        }
+        RoaringBitmap_addSorted(self, values.data(), values.size());
+        return 0;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+}
+
+bool RoaringBitmap_nextValue(const RoaringBitmap *self, unsigned long long from, unsigned int &value) {
+    if (from > UINT_MAX) return false;
+
+    const auto key = static_cast<unsigned short>(from >> 16);
+    for (size_t i = RoaringBitmap_find(self, key); i < self->keys.size(); ++i) {
+        const unsigned int low = self->keys[i] == key ? static_cast<unsigned int>(from & 0xFFFF) : 0;
+        unsigned int found;
+        if (RoaringContainer_next(self->containers[i], low, found)) {
+            value = static_cast<unsigned int>(self->keys[i]) << 16 | found;
+            return true;
+        }
+    }
+    return false;
+}
+
+static int RoaringBitmap_init(RoaringBitmap *self, PyObject *args, PyObject *kwargs) {
+    new(&self->keys) std::vector<unsigned short>();
+    new(&self->containers) std::vector<RoaringContainer>();
+
+    static constexpr const char *kwlist[] = {"iterable", nullptr};
+
+    PyObject *arg = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &arg)) {
+        return -1;
+    }
+
+    if (arg == nullptr) {
+        return 0;
+    }
+    return RoaringBitmap_addFrom(self, arg);
+}
+
+static void RoaringBitmap_dealloc(RoaringBitmap *self) {
+    self->keys.~vector();
+    self->containers.~vector();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *RoaringBitmap_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    auto *copy = RoaringBitmap_new();
+    if (copy == nullptr) return nullptr;
+
+    try {
+        copy->keys = self->keys;
+        copy->containers = self->containers;
+    } catch (const std::exception &e) {
+        SAFE_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *RoaringBitmap_add(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    unsigned int value;
+    if (!convert(object, value)) return nullptr;
+
+    try {
+        RoaringBitmap_addValue(self, value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *RoaringBitmap_discard(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    unsigned int value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+
+    try {
+        if (converted == 1) {
+            RoaringBitmap_removeValue(self, value);
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *RoaringBitmap_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    unsigned int value;
+    const int converted = convertKey(object, value);
+    if (converted == -1) return nullptr;
+
+    try {
+        if (converted == 0 || !RoaringBitmap_removeValue(self, value)) {
+            PyErr_SetObject(PyExc_KeyError, object);
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *RoaringBitmap_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    self->keys.clear();
+    self->containers.clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *RoaringBitmap_add_many(PyObject *pySelf, PyObject *object) {
+    if (RoaringBitmap_addFrom(reinterpret_cast<RoaringBitmap *>(pySelf), object) < 0) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *RoaringBitmap_add_range(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    long long start, stop;
+    if (!PyArg_ParseTuple(args, "LL", &start, &stop)) {
+        return nullptr;
+    }
+    if (start < 0 || stop > static_cast<long long>(UINT_MAX) + 1) {
+        PyErr_SetString(PyExc_ValueError, "range must be within range(2 ** 32)");
+        return nullptr;
+    }
+
+    try {
+        RoaringBitmap_addRange(self, static_cast<unsigned long long>(start), static_cast<unsigned long long>(stop));
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *RoaringBitmap_rank(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    unsigned int value;
+    if (!convert(object, value)) return nullptr;
+
+    const auto key = static_cast<unsigned short>(value >> 16);
+    unsigned long long rank = 0;
+    for (size_t i = 0; i < self->keys.size() && self->keys[i] <= key; ++i) {
+        rank += self->keys[i] < key
+                ? self->containers[i].cardinality
+                : RoaringContainer_rank(self->containers[i], static_cast<unsigned short>(value));
+    }
+    return PyLong_FromUnsignedLongLong(rank);
+}
+
+static PyObject *RoaringBitmap_select(PyObject *pySelf, PyObject *pyIndex) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    const Py_ssize_t index = PyNumber_AsSsize_t(pyIndex, PyExc_IndexError);
+    if (index == -1 && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    if (index >= 0) {
+        auto remaining = static_cast<unsigned long long>(index);
+        for (size_t i = 0; i < self->keys.size(); ++i) {
+            const RoaringContainer &container = self->containers[i];
+            if (remaining < container.cardinality) {
+                const unsigned int low = RoaringContainer_select(container, static_cast<unsigned int>(remaining));
+                return PyLong_FromUnsignedLong(static_cast<unsigned int>(self->keys[i]) << 16 | low);
+            }
+            remaining -= container.cardinality;
+        }
+    }
+
+    PyErr_SetString(PyExc_IndexError, "index out of range.");
+    return nullptr;
+}
+
+static PyObject *RoaringBitmap_min(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    if (self->keys.empty()) {
+        PyErr_SetString(PyExc_ValueError, "min() of an empty RoaringBitmap");
+        return nullptr;
+    }
+    const unsigned int low = RoaringContainer_select(self->containers.front(), 0);
+    return PyLong_FromUnsignedLong(static_cast<unsigned int>(self->keys.front()) << 16 | low);
+}
+
+static PyObject *RoaringBitmap_max(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    if (self->keys.empty()) {
+        PyErr_SetString(PyExc_ValueError, "max() of an empty RoaringBitmap");
+        return nullptr;
+    }
+    const unsigned int low = RoaringContainer_max(self->containers.back());
+    return PyLong_FromUnsignedLong(static_cast<unsigned int>(self->keys.back()) << 16 | low);
+}
+
+static PyObject *RoaringBitmap_to_int_array_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    // values above INT_MAX don't fit an IntArrayList, but are still valid, so widen to unsigned
+    if (!self->keys.empty() && self->keys.back() > INT_MAX >> 16) {
+        return RoaringBitmap_toList<UnsignedIntArrayList>(self, UnsignedIntArrayListType);
+    }
+    return RoaringBitmap_toList<IntArrayList>(self, IntArrayListType);
+}
+
+static PyObject *RoaringBitmap_to_unsigned_int_array_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    return RoaringBitmap_toList<UnsignedIntArrayList>(self, UnsignedIntArrayListType);
+}
+
+static PyObject *RoaringBitmap_run_optimize(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    bool changed = false;
+    try {
+        for (RoaringContainer &container: self->containers) {
+            changed |= RoaringContainer_runOptimize(container);
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    Py_RETURN_BOOL(changed);
+}
+
+static PyObject *RoaringBitmap_serialize_method(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    const size_t size = RoaringBitmap_serializedSize(self);
+    PyObject *result = PyBytes_FromStringAndSize(nullptr, static_cast<Py_ssize_t>(size));
+    if (result == nullptr) return nullptr;
+
+    RoaringBitmap_serialize(self, PyBytes_AS_STRING(result));
+    return result;
+}
+
+static PyObject *RoaringBitmap_deserialize_method(PyObject *Py_UNUSED(cls), PyObject *object) {
+    Py_buffer view;
+    if (PyObject_GetBuffer(object, &view, PyBUF_C_CONTIGUOUS) != 0) {
+        return nullptr;
+    }
+
+    auto *result = RoaringBitmap_new();
+    if (result == nullptr) {
+        PyBuffer_Release(&view);
+        return nullptr;
+    }
+
+    bool valid;
+    RoaringChunks chunks;
+    try {
+        valid = RoaringBitmap_deserialize(static_cast<const unsigned char *>(view.buf),
+                                          static_cast<size_t>(view.len), chunks);
+    } catch (const std::exception &e) {
+        PyBuffer_Release(&view);
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    PyBuffer_Release(&view);
+
+    if (!valid) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_ValueError, "Invalid serialized RoaringBitmap.");
+        return nullptr;
+    }
+    result->keys = std::move(chunks.keys);
+    result->containers = std::move(chunks.containers);
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static Py_ssize_t RoaringBitmap_len(PyObject *pySelf) {
+    return static_cast<Py_ssize_t>(RoaringBitmap_cardinality(reinterpret_cast<RoaringBitmap *>(pySelf)));
+}
+
+static int RoaringBitmap_contains(PyObject *pySelf, PyObject *key) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    unsigned int value;
+    const int converted = convertKey(key, value);
+    if (converted != 1) return converted;
+
+    return RoaringBitmap_containsValue(self, value) ? 1 : 0;
+}
+
+static PyObject *RoaringBitmap_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    auto iter = RoaringBitmapIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *RoaringBitmap_and(PyObject *pyLeft, PyObject *pyRight) {
+    return RoaringBitmap_binary<SetOp::AND>(pyLeft, pyRight);
+}
+
+static PyObject *RoaringBitmap_or(PyObject *pyLeft, PyObject *pyRight) {
+    return RoaringBitmap_binary<SetOp::OR>(pyLeft, pyRight);
+}
+
+static PyObject *RoaringBitmap_sub(PyObject *pyLeft, PyObject *pyRight) {
+    return RoaringBitmap_binary<SetOp::AND_NOT>(pyLeft, pyRight);
+}
+
+static PyObject *RoaringBitmap_iand(PyObject *pySelf, PyObject *other) {
+    return RoaringBitmap_inplace<SetOp::AND>(pySelf, other);
+}
+
+static PyObject *RoaringBitmap_ior(PyObject *pySelf, PyObject *other) {
+    return RoaringBitmap_inplace<SetOp::OR>(pySelf, other);
+}
+
+static PyObject *RoaringBitmap_isub(PyObject *pySelf, PyObject *other) {
+    return RoaringBitmap_inplace<SetOp::AND_NOT>(pySelf, other);
+}
+
+static PyObject *RoaringBitmap_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    if ((op != Py_EQ && op != Py_NE) || Py_TYPE(pyValue) != &RoaringBitmapType) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    const auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+    const auto *value = reinterpret_cast<RoaringBitmap *>(pyValue);
+
+    bool equal = self->keys == value->keys;
+    for (size_t i = 0; equal && i < self->keys.size(); ++i) {
+        equal = RoaringContainer_equal(self->containers[i], value->containers[i]);
+    }
+    Py_RETURN_BOOL(equal == (op == Py_EQ));
+}
+
+static PyObject *RoaringBitmap_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmap *>(pySelf);
+
+    if (self->keys.empty()) {
+        return PyUnicode_FromString("RoaringBitmap()");
+    }
+
+    auto str = std::string("RoaringBitmap({");
+    str.reserve(RoaringBitmap_cardinality(self) * 8);
+
+    char buffer[32];
+    RoaringBitmap_forEach(self, [&str, &buffer](unsigned int value) {
+        // to string
+        int len = snprintf(buffer, sizeof(buffer), "%u, ", value);
+        str.append(buffer, len);
+    });
+
+    str.resize(str.size() - 2);
+    str += "})";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
+static PyMethodDef RoaringBitmap_methods[] = {
+        {"copy", (PyCFunction) RoaringBitmap_copy, METH_NOARGS},
+        {"add", (PyCFunction) RoaringBitmap_add, METH_O},
+        {"discard", (PyCFunction) RoaringBitmap_discard, METH_O},
+        {"remove", (PyCFunction) RoaringBitmap_remove, METH_O},
+        {"clear", (PyCFunction) RoaringBitmap_clear, METH_NOARGS},
+        {"add_many", (PyCFunction) RoaringBitmap_add_many, METH_O},
+        {"add_range", (PyCFunction) RoaringBitmap_add_range, METH_VARARGS},
+        {"rank", (PyCFunction) RoaringBitmap_rank, METH_O},
+        {"select", (PyCFunction) RoaringBitmap_select, METH_O},
+        {"min", (PyCFunction) RoaringBitmap_min, METH_NOARGS},
+        {"max", (PyCFunction) RoaringBitmap_max, METH_NOARGS},
+        {"to_int_array_list", (PyCFunction) RoaringBitmap_to_int_array_list, METH_NOARGS},
+        {"to_unsigned_int_array_list", (PyCFunction) RoaringBitmap_to_unsigned_int_array_list, METH_NOARGS},
+        {"run_optimize", (PyCFunction) RoaringBitmap_run_optimize, METH_NOARGS},
+        {"serialize", (PyCFunction) RoaringBitmap_serialize_method, METH_NOARGS},
+        {"deserialize", (PyCFunction) RoaringBitmap_deserialize_method, METH_O | METH_CLASS},
+        {nullptr}
+};
+
+static struct PyModuleDef RoaringBitmap_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.RoaringBitmap",
+        "A RoaringBitmap_module that creates a RoaringBitmap",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods RoaringBitmap_asSequence = {
+        .sq_length = RoaringBitmap_len,
+        .sq_contains = RoaringBitmap_contains,
+};
+
+static PyNumberMethods RoaringBitmap_asNumber = {
+        .nb_subtract = RoaringBitmap_sub,
+        .nb_and = RoaringBitmap_and,
+        .nb_or = RoaringBitmap_or,
+        .nb_inplace_subtract = RoaringBitmap_isub,
+        .nb_inplace_and = RoaringBitmap_iand,
+        .nb_inplace_or = RoaringBitmap_ior,
+};
+
+void initializeRoaringBitmapType(PyTypeObject &type) {
+    type.tp_name = "RoaringBitmap";
+    type.tp_basicsize = sizeof(RoaringBitmap);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &RoaringBitmap_asSequence;
+    type.tp_as_number = &RoaringBitmap_asNumber;
+    type.tp_iter = RoaringBitmap_iter;
+    type.tp_methods = RoaringBitmap_methods;
+    type.tp_init = (initproc) RoaringBitmap_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) RoaringBitmap_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = RoaringBitmap_compare;
+    type.tp_repr = RoaringBitmap_repr;
+    type.tp_str = RoaringBitmap_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_RoaringBitmap() {
+    initializeRoaringBitmapType(RoaringBitmapType);
+    if (PyType_Ready(&RoaringBitmapType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&RoaringBitmap_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&RoaringBitmapType);
+    if (PyModule_AddObject(object, "RoaringBitmap", (PyObject *) &RoaringBitmapType) < 0) {
+        Py_DECREF(&RoaringBitmapType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,57 @@
+//
+// Created by xia__mc on 2024/12/20.
+//
+
+#ifndef PYFASTUTIL_ROARINGBITMAP_H
+#define PYFASTUTIL_ROARINGBITMAP_H
+
+#include "utils/PythonPCH.h"
+#include "utils/memory/AlignedAllocator.h"
+#include <vector>
+
+enum class RoaringContainerType : unsigned char {
+    ARRAY, BITMAP, RUN
+};
+
+struct RoaringRun {
+    // the values from start to start + length, both included, like the portable format stores them
+    unsigned short start;
+    unsigned short length;
+
+    bool operator==(const RoaringRun &other) const = default;
+};
+
+/**
+ * The low 16 bits of the values sharing the same high 16 bits.
+ * Up to 4096 values are a sorted array, more are a 65536 bit bitmap. Runs are only made by
+ * run_optimize(), add_range() and deserialize(), and are kept sorted, disjoint and never adjacent.
+ * Only the member of the current type holds anything.
+ */
+struct RoaringContainer {
+    RoaringContainerType type = RoaringContainerType::ARRAY;
+    unsigned int cardinality = 0;
+    std::vector<unsigned short> array;
+    std::vector<unsigned long long, AlignedAllocator<unsigned long long, 64>> bitmap;
+    std::vector<RoaringRun> runs;
+};
+
+extern "C" {
+typedef struct RoaringBitmap {
+    PyObject_HEAD;
+    // sorted ascending, containers[i] holds the values whose high 16 bits are keys[i] and is never empty
+    std::vector<unsigned short> keys;
+    std::vector<RoaringContainer> containers;
+} RoaringBitmap;
+
+extern PyTypeObject RoaringBitmapType;
+
+/**
+ * Find the smallest value of self not less than from.
+ * @return if there is one
+ */
+bool RoaringBitmap_nextValue(const RoaringBitmap *self, unsigned long long from, unsigned int &value);
+}
+
+PyMODINIT_FUNC PyInit_RoaringBitmap();
+
+#endif //PYFASTUTIL_ROARINGBITMAP_H
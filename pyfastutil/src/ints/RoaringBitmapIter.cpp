@@ -0,0 +1,96 @@
+//
+// Created by xia__mc on 2024/12/20.
+//
+
+#include "RoaringBitmapIter.h"
+#include <climits>
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject RoaringBitmapIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+RoaringBitmapIter *RoaringBitmapIter_create(RoaringBitmap *bitmap) {
+    auto *instance = Py_CreateObjNoInit<RoaringBitmapIter>(RoaringBitmapIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(bitmap);
+    instance->container = bitmap;
+    instance->next = 0;
+
+    return instance;
+}
+
+static void RoaringBitmapIter_dealloc(RoaringBitmapIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *RoaringBitmapIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<RoaringBitmapIter *>(pySelf);
+
+    unsigned int value;
+    if (self->next > UINT_MAX || !RoaringBitmap_nextValue(self->container, self->next, value)) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    self->next = static_cast<unsigned long long>(value) + 1;
+    return PyLong_FromUnsignedLong(value);
+}
+
+static PyObject *RoaringBitmapIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef RoaringBitmapIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef RoaringBitmapIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.RoaringBitmapIter",
+        "A RoaringBitmapIter_module that creates a RoaringBitmapIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeRoaringBitmapIterType(PyTypeObject &type) {
+    type.tp_name = "RoaringBitmapIter";
+    type.tp_basicsize = sizeof(RoaringBitmapIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = RoaringBitmapIter_iter;
+    type.tp_iternext = RoaringBitmapIter_next;
+    type.tp_methods = RoaringBitmapIter_methods;
+    type.tp_dealloc = (destructor) RoaringBitmapIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_RoaringBitmapIter() {
+    initializeRoaringBitmapIterType(RoaringBitmapIterType);
+    if (PyType_Ready(&RoaringBitmapIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&RoaringBitmapIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&RoaringBitmapIterType);
+    if (PyModule_AddObject(object, "RoaringBitmapIter", (PyObject *) &RoaringBitmapIterType) < 0) {
+        Py_DECREF(&RoaringBitmapIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
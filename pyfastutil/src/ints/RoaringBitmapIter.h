@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/20.
+//
+
+#ifndef PYFASTUTIL_ROARINGBITMAPITER_H
+#define PYFASTUTIL_ROARINGBITMAPITER_H
+
+#include "utils/PythonPCH.h"
+#include "RoaringBitmap.h"
+
+extern "C" {
+typedef struct RoaringBitmapIter {
+    PyObject_HEAD;
+    RoaringBitmap *container;
+    // the next value to look for, so changes to the bitmap while iterating are safe
+    unsigned long long next;
+} RoaringBitmapIter;
+
+RoaringBitmapIter *RoaringBitmapIter_create(RoaringBitmap *bitmap);
+
+}
+
+PyMODINIT_FUNC PyInit_RoaringBitmapIter();
+
+#endif //PYFASTUTIL_ROARINGBITMAPITER_H
@@ -0,0 +1,27 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#ifndef PYFASTUTIL_SHORTARRAYLIST_H
+#define PYFASTUTIL_SHORTARRAYLIST_H
+
+#include "utils/PythonPCH.h"
+#include "utils/memory/AlignedAllocator.h"
+#include <vector>
+
+extern "C" {
+typedef struct ShortArrayList {
+    PyObject_HEAD;
+    // 64 bytes aligned like IntArrayList, for faster SIMD
+    std::vector<short, AlignedAllocator<short, 64>> vector;
+    Py_ssize_t shape = 0;
+    // live buffer exports, the vector must not be resized while there are any
+    Py_ssize_t exports = 0;
+} ShortArrayList;
+
+extern PyTypeObject ShortArrayListType;
+}
+
+PyMODINIT_FUNC PyInit_ShortArrayList();
+
+#endif //PYFASTUTIL_SHORTARRAYLIST_H
@@ -0,0 +1,124 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#include "ShortArrayListIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject ShortArrayListIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+ShortArrayListIter *ShortArrayListIter_create(ShortArrayList *list, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<ShortArrayListIter>(ShortArrayListIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(list);
+    instance->container = list;
+    if (reversed) {
+        instance->index = (!list->vector.empty()) ? list->vector.size() - 1 : 0;
+        instance->reversed = true;
+    } else {
+        instance->index = 0;
+        instance->reversed = false;
+    }
+
+    return instance;
+}
+
+static void ShortArrayListIter_dealloc(ShortArrayListIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *ShortArrayListIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ShortArrayListIter *>(pySelf);
+
+    if (self->container->vector.empty()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    if (self->reversed) {
+        if (self->index == 0) {
+            // last iteration
+            short element = self->container->vector[self->index];
+            self->index = SIZE_MAX;
+            return PyFast_FromInt(element);
+        }
+        if (self->index == SIZE_MAX) {
+            // already finish iteration
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        short element = self->container->vector[self->index];
+        self->index--;
+        return PyFast_FromInt(element);
+    } else {
+        if (self->index >= self->container->vector.size()) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        short element = self->container->vector[self->index];
+        self->index++;
+        return PyFast_FromInt(element);
+    }
+}
+
+static PyObject *ShortArrayListIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef ShortArrayListIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef ShortArrayListIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.ShortArrayListIter",
+        "An ShortArrayListIter_module that creates an ShortArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeShortArrayListIterType(PyTypeObject &type) {
+    type.tp_name = "ShortArrayListIter";
+    type.tp_basicsize = sizeof(ShortArrayListIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = ShortArrayListIter_iter;
+    type.tp_iternext = ShortArrayListIter_next;
+    type.tp_methods = ShortArrayListIter_methods;
+    type.tp_dealloc = (destructor) ShortArrayListIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_ShortArrayListIter() {
+    initializeShortArrayListIterType(ShortArrayListIterType);
+    if (PyType_Ready(&ShortArrayListIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&ShortArrayListIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&ShortArrayListIterType);
+    if (PyModule_AddObject(object, "ShortArrayListIter", (PyObject *) &ShortArrayListIterType) < 0) {
+        Py_DECREF(&ShortArrayListIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
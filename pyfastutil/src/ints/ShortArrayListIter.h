@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#ifndef PYFASTUTIL_SHORTARRAYLISTITER_H
+#define PYFASTUTIL_SHORTARRAYLISTITER_H
+
+#include "utils/PythonPCH.h"
+#include "ShortArrayList.h"
+
+extern "C" {
+typedef struct ShortArrayListIter {
+    PyObject_HEAD;
+    ShortArrayList *container;
+    size_t index;
+    bool reversed;
+} ShortArrayListIter;
+
+ShortArrayListIter *ShortArrayListIter_create(ShortArrayList *list, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_ShortArrayListIter();
+
+#endif //PYFASTUTIL_SHORTARRAYLISTITER_H
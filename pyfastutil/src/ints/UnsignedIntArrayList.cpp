@@ -0,0 +1,1388 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#include "UnsignedIntArrayList.h"
+#include <climits>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+#include "utils/KeySort.h"
+#include "utils/simd/IntegerSort.h"
+#include "utils/simd/SIMDUtils.h"
+#include "utils/simd/Search.h"
+#include "utils/simd/Reduction.h"
+#include "utils/memory/AlignedAllocator.h"
+#include "ints/IntArrayList.h"
+#include "ints/UnsignedIntArrayListIter.h"
+
+extern "C" {
+
+PyTypeObject UnsignedIntArrayListType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+/**
+ * Refuse to change the size while buffers are exported, their pointer and shape would go stale.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool UnsignedIntArrayList_checkResizable(const UnsignedIntArrayList *self) noexcept {
+    if (self->exports > 0) {
+        PyErr_SetString(PyExc_BufferError, "Existing exports of data: object cannot be re-sized");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Open a view over a C-contiguous buffer of uint32, the only format copied without boxing.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool UnsignedIntArrayList_openBuffer(PyObject *obj, Py_buffer &view) noexcept {
+    if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+        return false;
+    }
+
+    // native or little endian only, same as what numpy gives us on x86 and arm
+    const char *format = view.format == nullptr ? "B" : view.format;
+    if (*format == '@' || *format == '=' || *format == '<') {
+        format++;
+    }
+
+    if (strlen(format) != 1 || strchr("IL", *format) == nullptr || view.itemsize != sizeof(unsigned int)) {
+        PyErr_Format(PyExc_TypeError, "expected a buffer of uint32, got format '%s'", view.format);
+        PyBuffer_Release(&view);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Replace the elements of self with the elements of view, without boxing them.
+ */
+static void UnsignedIntArrayList_assignBuffer(UnsignedIntArrayList *self, const Py_buffer &view) {
+    const auto size = static_cast<size_t>(view.len / view.itemsize);
+    self->vector.resize(size);
+    simd::simdMemCpy(static_cast<unsigned int *>(view.buf), self->vector.data(), size);
+}
+
+/**
+ * Read an int as an element, without raising if it doesn't fit.
+ * If not successful, function will raise python exception.
+ * @return 1 if it was read, 0 if it's out of range, -1 on error
+ */
+static __forceinline int UnsignedIntArrayList_asElement(PyObject *object, unsigned int &value) noexcept {
+    int overflow;
+    const long long result = PyLong_AsLongLongAndOverflow(object, &overflow);
+    if (result == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (overflow != 0 || result < 0 || result > 4294967295) {
+        return 0;
+    }
+    value = static_cast<unsigned int>(result);
+    return 1;
+}
+
+/**
+ * Read an int that must fit an element.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool UnsignedIntArrayList_asValue(PyObject *object, unsigned int &value) noexcept {
+    const int result = UnsignedIntArrayList_asElement(object, value);
+    if (result == 0) {
+        PyErr_SetString(PyExc_OverflowError, "UnsignedIntArrayList values must be in [0, 4294967295]");
+    }
+    return result == 1;
+}
+
+static __forceinline void UnsignedIntArrayList_parseArgs(PyObject *&args, PyObject *&kwargs, PyObject *&pyIterable,
+                                       Py_ssize_t &pySize) {
+    static constexpr const char *kwlist[] = {"iterable", "exceptSize", nullptr};
+
+    PyObject *arg1 = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|On", const_cast<char **>(kwlist), &arg1, &pySize)) {
+        return;
+    }
+
+    if (arg1 == nullptr) return;
+
+    if (PyLong_Check(arg1)) {
+        pySize = PyLong_AsSsize_t(arg1);
+    } else {
+        pyIterable = arg1;
+    }
+}
+
+static int UnsignedIntArrayList_init(UnsignedIntArrayList *self, PyObject *args, PyObject *kwargs) {
+    new(&self->vector) std::vector<unsigned int, AlignedAllocator<unsigned int, 64>>();
+
+    PyObject *pyIterable = nullptr;
+    Py_ssize_t pySize = -1;
+
+    UnsignedIntArrayList_parseArgs(args, kwargs, pyIterable, pySize);
+    if (PyErr_Occurred()) {
+        return -1;
+    }
+
+    // init vector
+    try {
+        if (pySize > 0) {
+            self->vector.reserve(static_cast<size_t>(pySize));
+        }
+
+        if (pyIterable != nullptr) {
+            if (Py_TYPE(pyIterable) == &UnsignedIntArrayListType) {  // UnsignedIntArrayList is a final class
+                auto *iter = reinterpret_cast<UnsignedIntArrayList *>(pyIterable);
+                self->vector = iter->vector;
+                return 0;
+            }
+
+            if (PyList_Check(pyIterable) || PyTuple_Check(pyIterable)) {  // fast operation
+                auto fastKeys = PySequence_Fast(pyIterable, "Shouldn't be happen (UnsignedIntArrayList).");
+                if (fastKeys == nullptr) {
+                    return -1;
+                }
+
+                const auto size = PySequence_Fast_GET_SIZE(fastKeys);
+                auto items = PySequence_Fast_ITEMS(fastKeys);
+                self->vector.reserve(static_cast<size_t>(size));
+                for (Py_ssize_t i = 0; i < size; ++i) {
+                    unsigned int value;
+                    if (!UnsignedIntArrayList_asValue(items[i], value)) {
+                        SAFE_DECREF(fastKeys);
+                        return -1;
+                    }
+                    self->vector.push_back(value);
+                }
+                SAFE_DECREF(fastKeys);
+                return 0;
+            }
+
+            if (PyObject_CheckBuffer(pyIterable)) {  // numpy arrays of the same dtype, no boxing
+                Py_buffer view;
+                if (UnsignedIntArrayList_openBuffer(pyIterable, view)) {
+                    UnsignedIntArrayList_assignBuffer(self, view);
+                    PyBuffer_Release(&view);
+                    return 0;
+                }
+                // other formats are still iterable, and every element is checked
+                PyErr_Clear();
+            }
+
+            PyObject *iter = PyObject_GetIter(pyIterable);
+            if (iter == nullptr) {
+                PyErr_SetString(PyExc_TypeError, "Arg '__iterable' is not iterable.");
+                return -1;
+            }
+
+            PyObject *item;
+            while ((item = PyIter_Next(iter)) != nullptr) {
+                unsigned int value;
+                const bool success = UnsignedIntArrayList_asValue(item, value);
+                SAFE_DECREF(item);
+                if (!success) {
+                    SAFE_DECREF(iter);
+                    return -1;
+                }
+                self->vector.push_back(value);
+            }
+            SAFE_DECREF(iter);
+            if (PyErr_Occurred()) return -1;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
+static void UnsignedIntArrayList_dealloc(UnsignedIntArrayList *self) {
+    self->vector.~vector();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *UnsignedIntArrayList_frombuffer([[maybe_unused]] PyObject *cls, PyObject *obj) {
+    Py_buffer view;
+    if (!UnsignedIntArrayList_openBuffer(obj, view)) {
+        return nullptr;
+    }
+
+    auto *list = Py_CreateObj<UnsignedIntArrayList>(UnsignedIntArrayListType);
+    if (list == nullptr) {
+        PyBuffer_Release(&view);
+        return nullptr;
+    }
+
+    try {
+        UnsignedIntArrayList_assignBuffer(list, view);
+    } catch (const std::exception &e) {
+        PyBuffer_Release(&view);
+        Py_DECREF(list);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    PyBuffer_Release(&view);
+    return reinterpret_cast<PyObject *>(list);
+}
+
+static PyObject *UnsignedIntArrayList_view(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    int readonly = 0;  // default: false
+    static constexpr const char *kwlist[] = {"readonly", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", const_cast<char **>(kwlist), &readonly)) {
+        return nullptr;
+    }
+
+    PyObject *view = PyMemoryView_FromObject(pySelf);
+    if (view == nullptr || !readonly) {
+        return view;
+    }
+
+    PyObject *result = PyObject_CallMethod(view, "toreadonly", nullptr);
+    Py_DECREF(view);
+    return result;
+}
+
+static PyObject *UnsignedIntArrayList_resize(PyObject *pySelf, PyObject *pySize) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (!UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    if (!PyLong_Check(pySize)) {
+        PyErr_SetString(PyExc_TypeError, "Expected an int object.");
+        return nullptr;
+    }
+
+    Py_ssize_t pySSize = PyLong_AsSsize_t(pySize);
+    if (pySSize < 0) {
+        PyErr_SetString(PyExc_ValueError, "Invalid size.");
+        return nullptr;
+    }
+
+    try {
+        self->vector.resize(static_cast<size_t>(pySSize));
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *UnsignedIntArrayList_to_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    const auto size = static_cast<Py_ssize_t>(self->vector.size());
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *item = PyLong_FromUnsignedLong(self->vector[i]);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+
+        PyList_SET_ITEM(result, i, item);  // PyList_SET_ITEM handle this ref
+    }
+
+    return result;
+}
+
+static PyObject *UnsignedIntArrayList_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    auto *copy = Py_CreateObj<UnsignedIntArrayList>(UnsignedIntArrayListType);
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    try {
+        copy->vector = self->vector;
+    } catch (const std::exception &e) {
+        Py_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *UnsignedIntArrayList_append(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (!UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    unsigned int value;
+    if (!UnsignedIntArrayList_asValue(object, value)) {
+        return nullptr;
+    }
+
+    try {
+        self->vector.push_back(value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+/**
+ * Append every element of iterable to self.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static bool UnsignedIntArrayList_extendIterable(UnsignedIntArrayList *self, PyObject *iterable) {
+    // fast extend
+    if (Py_TYPE(iterable) == &UnsignedIntArrayListType) {
+        auto *iter = reinterpret_cast<UnsignedIntArrayList *>(iterable);
+        self->vector.insert(self->vector.end(), iter->vector.begin(), iter->vector.end());
+        return true;
+    }
+
+    // python iterable extend
+    PyObject *iter = PyObject_GetIter(iterable);
+    if (iter == nullptr) {
+        return false;
+    }
+
+    // pre alloc
+    Py_ssize_t hint = PyObject_LengthHint(iterable, 0);
+    if (hint > 0) {
+        self->vector.reserve(self->vector.size() + hint);
+    }
+
+    // do extend
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        unsigned int value;
+        const bool success = UnsignedIntArrayList_asValue(item, value);
+        SAFE_DECREF(item);
+
+        if (!success) {
+            SAFE_DECREF(iter);
+            return false;
+        }
+
+        self->vector.push_back(value);
+    }
+
+    SAFE_DECREF(iter);
+    return !PyErr_Occurred();
+}
+
+static PyObject *UnsignedIntArrayList_extend(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (!UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    // FASTCALL ensure args != nullptr
+    if (nargs != 1) {
+        PyErr_SetString(PyExc_TypeError, "extend() takes exactly one argument");
+        return nullptr;
+    }
+
+    try {
+        if (!UnsignedIntArrayList_extendIterable(self, args[0])) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *UnsignedIntArrayList_pop(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from empty list");
+        return nullptr;
+    }
+
+    if (!UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    Py_ssize_t index = vecSize - 1;
+
+    if (nargs == 1) {
+        index = PyLong_AsSsize_t(args[0]);
+        if (index == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+
+        if (index < 0) {
+            index += vecSize;
+        }
+
+        if (index < 0 || index >= vecSize) {
+            PyErr_SetString(PyExc_IndexError, "index out of range");
+            return nullptr;
+        }
+    } else if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "pop() takes at most 1 argument");
+        return nullptr;
+    }
+
+    const auto popped = self->vector[static_cast<size_t>(index)];
+    self->vector.erase(self->vector.begin() + index);
+
+    return PyLong_FromUnsignedLong(popped);
+}
+
+static PyObject *UnsignedIntArrayList_index(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    PyObject *object;
+    Py_ssize_t start = 0;
+    auto stop = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (!PyArg_ParseTuple(args, "O|nn", &object, &start, &stop)) {
+        return nullptr;
+    }
+
+    unsigned int value;
+    const int read = UnsignedIntArrayList_asElement(object, value);
+    if (read < 0) {
+        return nullptr;
+    }
+
+    if (start < 0) {
+        start += static_cast<Py_ssize_t>(self->vector.size());
+    }
+    if (stop < 0) {
+        stop += static_cast<Py_ssize_t>(self->vector.size());
+    }
+
+    if (start < 0) {
+        start = 0;
+    }
+    if (stop > static_cast<Py_ssize_t>(self->vector.size())) {
+        stop = static_cast<Py_ssize_t>(self->vector.size());
+    }
+
+    if (start > stop) {
+        PyErr_SetString(PyExc_ValueError, "start index cannot be greater than stop index.");
+        return nullptr;
+    }
+
+    // an int out of range is never in the list
+    const size_t index = read == 0 ? static_cast<size_t>(stop) : static_cast<size_t>(start) + simd::simdFind(
+            self->vector.data() + start, static_cast<size_t>(stop - start), value);
+
+    if (index == static_cast<size_t>(stop)) {
+        PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+        return nullptr;
+    }
+
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *UnsignedIntArrayList_count(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    unsigned int value;
+    const int read = UnsignedIntArrayList_asElement(object, value);
+    if (read < 0) {
+        return nullptr;
+    }
+
+    if (read == 0) {
+        return PyLong_FromLong(0);
+    }
+    return PyLong_FromSize_t(simd::simdCount(self->vector.data(), self->vector.size(), value));
+}
+
+static PyObject *UnsignedIntArrayList_insert(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (!UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    Py_ssize_t index;
+    PyObject *object;
+
+    if (!PyArg_ParseTuple(args, "nO", &index, &object)) {
+        return nullptr;
+    }
+
+    unsigned int value;
+    if (!UnsignedIntArrayList_asValue(object, value)) {
+        return nullptr;
+    }
+
+    // fix index
+    const auto vecSize = static_cast<Py_ssize_t>(self->vector.size());
+    if (index < 0) {
+        index = std::max(static_cast<Py_ssize_t>(0), vecSize + index);
+    } else if (index > vecSize) {
+        index = vecSize;
+    }
+
+    // do insert
+    try {
+        self->vector.insert(self->vector.begin() + index, value);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *UnsignedIntArrayList_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (!UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    unsigned int value;
+    const int read = UnsignedIntArrayList_asElement(object, value);
+    if (read < 0) {
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    const size_t index = read == 0 ? size : simd::simdFind(self->vector.data(), size, value);
+    if (index == size) {
+        PyErr_SetString(PyExc_ValueError, "Value is not in list.");
+        return nullptr;
+    }
+    self->vector.erase(self->vector.begin() + static_cast<Py_ssize_t>(index));
+
+    Py_RETURN_NONE;
+}
+
+/**
+ * Parse the algorithm argument of sort(), None means auto.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool UnsignedIntArrayList_parseSortAlgorithm(const char *name, simd::SortAlgorithm &algorithm) {
+    if (name == nullptr || strcmp(name, "auto") == 0) {
+        algorithm = simd::SortAlgorithm::AUTO;
+    } else if (strcmp(name, "bitonic") == 0) {
+        algorithm = simd::SortAlgorithm::BITONIC;
+    } else if (strcmp(name, "radix") == 0) {
+        algorithm = simd::SortAlgorithm::RADIX;
+    } else {
+        PyErr_Format(PyExc_ValueError, "algorithm must be 'auto', 'bitonic' or 'radix', got '%s'", name);
+        return false;
+    }
+    return true;
+}
+
+static PyObject *UnsignedIntArrayList_sort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    PyObject *keyFunc = Py_None;
+    int reverse = 0;  // default: false
+    const char *algorithmName = nullptr;  // default: auto
+    static constexpr const char *kwlist[] = {"key", "reverse", "algorithm", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Op$s", const_cast<char **>(kwlist),
+                                     &keyFunc, &reverse, &algorithmName)) {
+        return nullptr;
+    }
+
+    simd::SortAlgorithm algorithm;
+    if (!UnsignedIntArrayList_parseSortAlgorithm(algorithmName, algorithm)) {
+        return nullptr;
+    }
+
+    // do sort
+    try {
+        if (keyFunc == Py_None) {
+            // exceptions can't leave the block without the GIL, so rethrow them after it
+            std::exception_ptr error;
+            Py_BEGIN_ALLOW_THREADS
+                try {
+                    simd::simdsort(self->vector.data(), self->vector.size(), reverse, algorithm);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            Py_END_ALLOW_THREADS
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        } else if (!KeySort_sort(self->vector, keyFunc, reverse,
+                                 [](const unsigned int value) { return PyLong_FromUnsignedLong(value); },
+                                 [](PyObject *item) { return static_cast<unsigned int>(PyLong_AsUnsignedLong(item)); })) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *UnsignedIntArrayList_argsort(PyObject *pySelf, PyObject *args, PyObject *kwargs) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    int reverse = 0;  // default: false
+    int stable = 1;  // default: true
+    static constexpr const char *kwlist[] = {"reverse", "stable", nullptr};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|pp", const_cast<char **>(kwlist), &reverse, &stable)) {
+        return nullptr;
+    }
+
+    const size_t size = self->vector.size();
+    if (size > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "list is too large to be indexed by an IntArrayList");
+        return nullptr;
+    }
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return nullptr;
+
+    try {
+        result->vector.resize(size);
+
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::argsort(self->vector.data(), size, reverse, stable, result->vector.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } catch (const std::exception &e) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static Py_ssize_t UnsignedIntArrayList_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->vector.size());
+}
+
+static PyObject *UnsignedIntArrayList_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    auto iter = UnsignedIntArrayListIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *UnsignedIntArrayList_getitem(PyObject *pySelf, Py_ssize_t pyIndex) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    auto size = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (pyIndex < 0) {
+        pyIndex = size + pyIndex;
+    }
+
+    if (pyIndex < 0 || pyIndex >= size) {
+        PyErr_SetString(PyExc_IndexError, "index out of range.");
+        return nullptr;
+    }
+
+    return PyLong_FromUnsignedLong(self->vector[static_cast<size_t>(pyIndex)]);
+}
+
+static PyObject *UnsignedIntArrayList_getitem_slice(PyObject *pySelf, PyObject *slice) {
+    if (PyIndex_Check(slice)) {
+        Py_ssize_t pyIndex = PyNumber_AsSsize_t(slice, PyExc_IndexError);
+        if (pyIndex == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        return UnsignedIntArrayList_getitem(pySelf, pyIndex);
+    }
+
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    Py_ssize_t start, stop, step, sliceLength;
+    if (PySlice_Unpack(slice, &start, &stop, &step) < 0) {
+        return nullptr;
+    }
+
+    sliceLength = PySlice_AdjustIndices(static_cast<Py_ssize_t>(self->vector.size()), &start, &stop, step);
+
+    PyObject *result = PyList_New(sliceLength);
+    if (!result) {
+        return nullptr;
+    }
+
+    for (Py_ssize_t i = 0; i < sliceLength; i++) {
+        Py_ssize_t index = start + i * step;
+        PyObject *item = PyLong_FromUnsignedLong(self->vector[static_cast<size_t>(index)]);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+    return result;
+}
+
+static int UnsignedIntArrayList_setitem(PyObject *pySelf, Py_ssize_t pyIndex, PyObject *pyValue) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    auto size = static_cast<Py_ssize_t>(self->vector.size());
+
+    if (pyIndex < 0) {
+        pyIndex = size + pyIndex;
+    }
+    if (pyIndex < 0 || pyIndex >= size) {
+        PyErr_SetString(PyExc_IndexError, "index out of range.");
+        return -1;
+    }
+
+    if (pyValue == nullptr) {
+        if (!UnsignedIntArrayList_checkResizable(self)) {
+            return -1;
+        }
+        self->vector.erase(self->vector.begin() + pyIndex);
+        return 0;
+    }
+
+    unsigned int value;
+    if (!UnsignedIntArrayList_asValue(pyValue, value)) {
+        return -1;
+    }
+    self->vector[static_cast<size_t>(pyIndex)] = value;
+    return 0;
+}
+
+static int UnsignedIntArrayList_setitem_slice(PyObject *pySelf, PyObject *slice, PyObject *value) {
+    if (PyIndex_Check(slice)) {
+        Py_ssize_t index = PyNumber_AsSsize_t(slice, PyExc_IndexError);
+        if (index == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        return UnsignedIntArrayList_setitem(pySelf, index, value);
+    }
+
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    Py_ssize_t start, stop, step, sliceLength;
+    if (PySlice_Unpack(slice, &start, &stop, &step) < 0) {
+        return -1;
+    }
+
+    sliceLength = PySlice_AdjustIndices(static_cast<Py_ssize_t>(self->vector.size()), &start, &stop, step);
+
+    if (step != 1) {
+        PyErr_SetString(PyExc_NotImplementedError, "step must be 1 for slice assignment");
+        return -1;
+    }
+
+    // convert everything first, so a bad element leaves the list unchanged
+    std::vector<unsigned int> values;
+    if (value != nullptr) {
+        PyObject *fast = PySequence_Fast(value, "can only assign an iterable");
+        if (fast == nullptr) {
+            return -1;
+        }
+
+        const Py_ssize_t newLength = PySequence_Fast_GET_SIZE(fast);
+        PyObject **items = PySequence_Fast_ITEMS(fast);
+        try {
+            values.resize(static_cast<size_t>(newLength));
+        } catch (const std::exception &e) {
+            SAFE_DECREF(fast);
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return -1;
+        }
+        for (Py_ssize_t i = 0; i < newLength; ++i) {
+            if (!UnsignedIntArrayList_asValue(items[i], values[i])) {
+                SAFE_DECREF(fast);
+                return -1;
+            }
+        }
+        SAFE_DECREF(fast);
+    }
+
+    const auto newLength = static_cast<Py_ssize_t>(values.size());
+    if (newLength != sliceLength && !UnsignedIntArrayList_checkResizable(self)) {
+        return -1;
+    }
+
+    try {
+        const auto begin = self->vector.begin() + start;
+        if (newLength <= sliceLength) {
+            std::copy(values.begin(), values.end(), begin);
+            self->vector.erase(begin + newLength, begin + sliceLength);
+        } else {
+            std::copy(values.begin(), values.begin() + sliceLength, begin);
+            self->vector.insert(begin + sliceLength, values.begin() + sliceLength, values.end());
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+
+    return 0;
+}
+
+static PyObject *UnsignedIntArrayList_add(PyObject *pySelf, PyObject *pyValue) {
+    if (Py_TYPE(pyValue) == &UnsignedIntArrayListType) {
+        // fast add -> UnsignedIntArrayList
+        auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+        auto *value = reinterpret_cast<UnsignedIntArrayList *>(pyValue);
+
+        auto *result = Py_CreateObj<UnsignedIntArrayList>(UnsignedIntArrayListType);
+        if (result == nullptr) {
+            return PyErr_NoMemory();
+        }
+
+        try {
+            result->vector.reserve(self->vector.size() + value->vector.size());
+            result->vector.insert(result->vector.end(), self->vector.begin(), self->vector.end());
+            result->vector.insert(result->vector.end(), value->vector.begin(), value->vector.end());
+            return reinterpret_cast<PyObject *>(result);
+        } catch (const std::exception &e) {
+            SAFE_DECREF(result);
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return nullptr;
+        }
+    }
+
+    // add -> list[int]
+    PyObject *selfList = UnsignedIntArrayList_to_list(pySelf);
+    if (selfList == nullptr) {
+        return nullptr;
+    }
+
+    PyObject *result = PySequence_Concat(selfList, pyValue);
+    SAFE_DECREF(selfList);
+    return result;
+}
+
+static PyObject *UnsignedIntArrayList_iadd(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (!UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    try {
+        if (!UnsignedIntArrayList_extendIterable(self, iterable)) {
+            return nullptr;
+        }
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyObject *UnsignedIntArrayList_mul(PyObject *pySelf, Py_ssize_t n) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (n < 0) {
+        n = 0;
+    }
+
+    auto *result = Py_CreateObj<UnsignedIntArrayList>(UnsignedIntArrayListType);
+    if (result == nullptr) {
+        return PyErr_NoMemory();
+    }
+
+    if (n == 0) {
+        return reinterpret_cast<PyObject *>(result);
+    }
+
+    try {
+        const auto selfSize = self->vector.size();
+
+        result->vector.resize(selfSize * n);
+        Py_BEGIN_ALLOW_THREADS
+            for (Py_ssize_t i = 0; i < n; ++i) {
+                simd::simdMemCpy(self->vector.data(), result->vector.data() + selfSize * i, selfSize);
+            }
+        Py_END_ALLOW_THREADS
+
+        return reinterpret_cast<PyObject *>(result);
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static PyObject *UnsignedIntArrayList_rmul(PyObject *pySelf, PyObject *pyValue) {
+    if (PyLong_Check(pyValue)) {
+        Py_ssize_t n = PyLong_AsSsize_t(pyValue);
+        if (PyErr_Occurred()) {
+            return nullptr;
+        }
+
+        return UnsignedIntArrayList_mul(pySelf, n);
+    }
+
+    PyErr_SetString(PyExc_TypeError, "Expected an integer on the left-hand side of *");
+    return nullptr;
+}
+
+static PyObject *UnsignedIntArrayList_imul(PyObject *pySelf, Py_ssize_t n) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (n < 0) {
+        n = 0;
+    }
+
+    if (n != 1 && !UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    try {
+        if (n == 0) {
+            self->vector.clear();
+        } else {
+            const auto selfSize = self->vector.size();
+
+            self->vector.resize(selfSize * n);
+            Py_BEGIN_ALLOW_THREADS
+                for (Py_ssize_t i = 1; i < n; ++i) {
+                    simd::simdMemCpy(
+                            self->vector.data(),
+                            self->vector.data() + selfSize * i,
+                            selfSize
+                    );
+                }
+            Py_END_ALLOW_THREADS
+        }
+
+        Py_INCREF(pySelf);
+        return pySelf;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static int UnsignedIntArrayList_contains(PyObject *pySelf, PyObject *key) {
+    if (!PyLong_Check(key)) {
+        return 0;
+    }
+
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    unsigned int value;
+    const int read = UnsignedIntArrayList_asElement(key, value);
+    if (read <= 0) {
+        return read;  // an int out of range is never in the list
+    }
+
+    const size_t size = self->vector.size();
+    return simd::simdFind(self->vector.data(), size, value) != size ? 1 : 0;
+}
+
+static PyObject *UnsignedIntArrayList_reversed(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    auto iter = UnsignedIntArrayListIter_create(self, true);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *UnsignedIntArrayList_reverse(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    Py_BEGIN_ALLOW_THREADS
+        simd::simdReverse(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    Py_RETURN_NONE;
+}
+
+static PyObject *UnsignedIntArrayList_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (!UnsignedIntArrayList_checkResizable(self)) {
+        return nullptr;
+    }
+
+    self->vector.clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *UnsignedIntArrayList_sum(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    const unsigned int *data = self->vector.data();
+    const size_t size = self->vector.size();
+
+    PyObject *result = PyLong_FromLong(0);
+    if (result == nullptr) {
+        return nullptr;
+    }
+
+    // each chunk fits in 64 bits, their total may not
+    for (size_t i = 0; i < size; i += simd::SUM_CHUNK_SIZE) {
+        const size_t chunkSize = std::min(simd::SUM_CHUNK_SIZE, size - i);
+
+        unsigned long long chunk;
+        Py_BEGIN_ALLOW_THREADS
+            chunk = simd::simdSum(data + i, chunkSize);
+        Py_END_ALLOW_THREADS
+
+        PyObject *chunkSum = PyLong_FromUnsignedLongLong(chunk);
+        PyObject *newResult = chunkSum != nullptr ? PyNumber_Add(result, chunkSum) : nullptr;
+        Py_XDECREF(chunkSum);
+        Py_DECREF(result);
+        if (newResult == nullptr) {
+            return nullptr;
+        }
+        result = newResult;
+    }
+
+    return result;
+}
+
+static PyObject *UnsignedIntArrayList_min(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "min() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<unsigned int> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyLong_FromUnsignedLong(result.min);
+}
+
+static PyObject *UnsignedIntArrayList_max(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "max() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<unsigned int> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+    return PyLong_FromUnsignedLong(result.max);
+}
+
+static PyObject *UnsignedIntArrayList_minmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "minmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    simd::MinMax<unsigned int> result{};
+    Py_BEGIN_ALLOW_THREADS
+        result = simd::simdMinMax(self->vector.data(), self->vector.size());
+    Py_END_ALLOW_THREADS
+
+    PyObject *min = PyLong_FromUnsignedLong(result.min);
+    if (min == nullptr) {
+        return nullptr;
+    }
+    PyObject *max = PyLong_FromUnsignedLong(result.max);
+    if (max == nullptr) {
+        Py_DECREF(min);
+        return nullptr;
+    }
+
+    PyObject *tuple = PyTuple_Pack(2, min, max);
+    Py_DECREF(min);
+    Py_DECREF(max);
+    return tuple;
+}
+
+static PyObject *UnsignedIntArrayList_argmin(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmin() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the min, like list.index(min(list))
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        const unsigned int min = simd::simdMinMax(self->vector.data(), self->vector.size()).min;
+        index = simd::simdFind(self->vector.data(), self->vector.size(), min);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *UnsignedIntArrayList_argmax(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (self->vector.empty()) {
+        PyErr_SetString(PyExc_ValueError, "argmax() arg is an empty sequence");
+        return nullptr;
+    }
+
+    // the first index of the max, like list.index(max(list))
+    size_t index;
+    Py_BEGIN_ALLOW_THREADS
+        const unsigned int max = simd::simdMinMax(self->vector.data(), self->vector.size()).max;
+        index = simd::simdFind(self->vector.data(), self->vector.size(), max);
+    Py_END_ALLOW_THREADS
+    return PyLong_FromSize_t(index);
+}
+
+static PyObject *UnsignedIntArrayList_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    if (Py_TYPE(pyValue) != &UnsignedIntArrayListType) {
+        if (!PySequence_Check(pyValue))
+            Py_RETURN_FALSE;
+
+        // for others, compare like two lists of python ints
+        PyObject *selfList = UnsignedIntArrayList_to_list(pySelf);
+        if (selfList == nullptr) {
+            return nullptr;
+        }
+        PyObject *valueList = PySequence_List(pyValue);
+        if (valueList == nullptr) {
+            SAFE_DECREF(selfList);
+            return nullptr;
+        }
+
+        PyObject *result = PyObject_RichCompare(selfList, valueList, op);
+        SAFE_DECREF(selfList);
+        SAFE_DECREF(valueList);
+        return result;
+    }
+
+    // fast compare, the first elements that differ decide, like list
+    const auto &a = self->vector;
+    const auto &b = reinterpret_cast<UnsignedIntArrayList *>(pyValue)->vector;
+    const auto [itA, itB] = std::mismatch(a.begin(), a.end(), b.begin(), b.end());
+
+    if (itA == a.end() || itB == b.end()) {
+        switch (op) {
+            case Py_EQ: Py_RETURN_BOOL(a.size() == b.size())
+            case Py_NE: Py_RETURN_BOOL(a.size() != b.size())
+            case Py_LT: Py_RETURN_BOOL(a.size() < b.size())
+            case Py_LE: Py_RETURN_BOOL(a.size() <= b.size())
+            case Py_GT: Py_RETURN_BOOL(a.size() > b.size())
+            case Py_GE: Py_RETURN_BOOL(a.size() >= b.size())
+            default:
+                break;
+        }
+    } else {
+        switch (op) {
+            case Py_EQ: Py_RETURN_FALSE;
+            case Py_NE: Py_RETURN_TRUE;
+            case Py_LT: Py_RETURN_BOOL(*itA < *itB)
+            case Py_LE: Py_RETURN_BOOL(*itA <= *itB)
+            case Py_GT: Py_RETURN_BOOL(*itA > *itB)
+            case Py_GE: Py_RETURN_BOOL(*itA >= *itB)
+            default:
+                break;
+        }
+    }
+
+    PyErr_SetString(PyExc_AssertionError, "Invalid comparison operation.");
+    return nullptr;
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *UnsignedIntArrayList_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static __forceinline PyObject *UnsignedIntArrayList_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    const auto &vec = self->vector;
+
+    if (vec.empty()) {
+        return PyUnicode_FromString("[]");
+    }
+
+    size_t size = vec.size();
+    auto str = std::string("[");
+    str.reserve(size * 8);
+
+    for (size_t i = 0; i < size; ++i) {
+        if (i != 0) {
+            str += ", ";
+        }
+        str += std::to_string(vec[i]);
+    }
+
+    str += "]";
+
+    return PyUnicode_FromString(str.c_str());
+}
+
+static PyObject *UnsignedIntArrayList_str(PyObject *pySelf) {
+    return UnsignedIntArrayList_repr(pySelf);
+}
+
+static int UnsignedIntArrayList_get_buffer(PyObject *pySelf, Py_buffer *view, int flags) {
+    auto *self = reinterpret_cast<UnsignedIntArrayList *>(pySelf);
+
+    // every export shares this shape, it can't change while any of them is alive
+    self->shape = static_cast<Py_ssize_t>(self->vector.size());
+
+    Py_INCREF(pySelf);
+    view->obj = pySelf;
+    view->buf = self->vector.data();
+    view->len = static_cast<Py_ssize_t>(self->vector.size() * sizeof(unsigned int));
+    view->itemsize = sizeof(unsigned int);
+    view->readonly = 0;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? const_cast<char *>("I") : nullptr;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? &self->shape : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &view->itemsize : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+
+    ++self->exports;
+    return 0;
+}
+
+static void UnsignedIntArrayList_release_buffer(PyObject *pySelf, [[maybe_unused]] Py_buffer *view) {
+    --reinterpret_cast<UnsignedIntArrayList *>(pySelf)->exports;
+}
+
+static PyMethodDef UnsignedIntArrayList_methods[] = {
+        {"frombuffer", (PyCFunction) UnsignedIntArrayList_frombuffer, METH_O | METH_STATIC},
+        {"view", (PyCFunction) UnsignedIntArrayList_view, METH_VARARGS | METH_KEYWORDS},
+        {"resize", (PyCFunction) UnsignedIntArrayList_resize, METH_O},
+        {"to_list", (PyCFunction) UnsignedIntArrayList_to_list, METH_NOARGS},
+        {"copy", (PyCFunction) UnsignedIntArrayList_copy, METH_NOARGS},
+        {"append", (PyCFunction) UnsignedIntArrayList_append, METH_O},
+        {"extend", (PyCFunction) UnsignedIntArrayList_extend, METH_FASTCALL},
+        {"pop", (PyCFunction) UnsignedIntArrayList_pop, METH_FASTCALL},
+        {"index", (PyCFunction) UnsignedIntArrayList_index, METH_VARARGS},
+        {"count", (PyCFunction) UnsignedIntArrayList_count, METH_O},
+        {"insert", (PyCFunction) UnsignedIntArrayList_insert, METH_VARARGS},
+        {"remove", (PyCFunction) UnsignedIntArrayList_remove, METH_O},
+        {"sort", (PyCFunction) UnsignedIntArrayList_sort, METH_VARARGS | METH_KEYWORDS},
+        {"argsort", (PyCFunction) UnsignedIntArrayList_argsort, METH_VARARGS | METH_KEYWORDS},
+        {"reverse", (PyCFunction) UnsignedIntArrayList_reverse, METH_NOARGS},
+        {"clear", (PyCFunction) UnsignedIntArrayList_clear, METH_NOARGS},
+        {"sum", (PyCFunction) UnsignedIntArrayList_sum, METH_NOARGS},
+        {"min", (PyCFunction) UnsignedIntArrayList_min, METH_NOARGS},
+        {"max", (PyCFunction) UnsignedIntArrayList_max, METH_NOARGS},
+        {"minmax", (PyCFunction) UnsignedIntArrayList_minmax, METH_NOARGS},
+        {"argmin", (PyCFunction) UnsignedIntArrayList_argmin, METH_NOARGS},
+        {"argmax", (PyCFunction) UnsignedIntArrayList_argmax, METH_NOARGS},
+        {"__rmul__", (PyCFunction) UnsignedIntArrayList_rmul, METH_O},
+        {"__reversed__", (PyCFunction) UnsignedIntArrayList_reversed, METH_NOARGS},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) UnsignedIntArrayList_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef UnsignedIntArrayList_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.UnsignedIntArrayList",
+        "An UnsignedIntArrayList_module that creates an UnsignedIntArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods UnsignedIntArrayList_asSequence = {
+        UnsignedIntArrayList_len,
+        UnsignedIntArrayList_add,
+        UnsignedIntArrayList_mul,
+        UnsignedIntArrayList_getitem,
+        nullptr,
+        UnsignedIntArrayList_setitem,
+        nullptr,
+        UnsignedIntArrayList_contains,
+        UnsignedIntArrayList_iadd,
+        UnsignedIntArrayList_imul
+};
+
+static PyMappingMethods UnsignedIntArrayList_asMapping = {
+        UnsignedIntArrayList_len,
+        UnsignedIntArrayList_getitem_slice,
+        UnsignedIntArrayList_setitem_slice
+};
+
+static PyBufferProcs UnsignedIntArrayList_asBuffer = {
+        UnsignedIntArrayList_get_buffer,
+        UnsignedIntArrayList_release_buffer
+};
+
+void initializeUnsignedIntArrayListType(PyTypeObject &type) {
+    type.tp_name = "UnsignedIntArrayList";
+    type.tp_basicsize = sizeof(UnsignedIntArrayList);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_as_sequence = &UnsignedIntArrayList_asSequence;
+    type.tp_as_mapping = &UnsignedIntArrayList_asMapping;
+    type.tp_iter = UnsignedIntArrayList_iter;
+    type.tp_methods = UnsignedIntArrayList_methods;
+    type.tp_init = (initproc) UnsignedIntArrayList_init;
+    type.tp_new = PyType_GenericNew;
+    type.tp_dealloc = (destructor) UnsignedIntArrayList_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = UnsignedIntArrayList_compare;
+    type.tp_repr = UnsignedIntArrayList_repr;
+    type.tp_str = UnsignedIntArrayList_str;
+    type.tp_as_buffer = &UnsignedIntArrayList_asBuffer;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_UnsignedIntArrayList() {
+    initializeUnsignedIntArrayListType(UnsignedIntArrayListType);
+    if (PyType_Ready(&UnsignedIntArrayListType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&UnsignedIntArrayList_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&UnsignedIntArrayListType);
+    if (PyModule_AddObject(object, "UnsignedIntArrayList", (PyObject *) &UnsignedIntArrayListType) < 0) {
+        Py_DECREF(&UnsignedIntArrayListType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
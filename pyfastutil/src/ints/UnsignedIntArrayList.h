@@ -0,0 +1,27 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#ifndef PYFASTUTIL_UNSIGNEDINTARRAYLIST_H
+#define PYFASTUTIL_UNSIGNEDINTARRAYLIST_H
+
+#include "utils/PythonPCH.h"
+#include "utils/memory/AlignedAllocator.h"
+#include <vector>
+
+extern "C" {
+typedef struct UnsignedIntArrayList {
+    PyObject_HEAD;
+    // 64 bytes aligned like IntArrayList, for faster SIMD
+    std::vector<unsigned int, AlignedAllocator<unsigned int, 64>> vector;
+    Py_ssize_t shape = 0;
+    // live buffer exports, the vector must not be resized while there are any
+    Py_ssize_t exports = 0;
+} UnsignedIntArrayList;
+
+extern PyTypeObject UnsignedIntArrayListType;
+}
+
+PyMODINIT_FUNC PyInit_UnsignedIntArrayList();
+
+#endif //PYFASTUTIL_UNSIGNEDINTARRAYLIST_H
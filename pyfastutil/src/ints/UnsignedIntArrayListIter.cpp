@@ -0,0 +1,124 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#include "UnsignedIntArrayListIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject UnsignedIntArrayListIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+UnsignedIntArrayListIter *UnsignedIntArrayListIter_create(UnsignedIntArrayList *list, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<UnsignedIntArrayListIter>(UnsignedIntArrayListIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(list);
+    instance->container = list;
+    if (reversed) {
+        instance->index = (!list->vector.empty()) ? list->vector.size() - 1 : 0;
+        instance->reversed = true;
+    } else {
+        instance->index = 0;
+        instance->reversed = false;
+    }
+
+    return instance;
+}
+
+static void UnsignedIntArrayListIter_dealloc(UnsignedIntArrayListIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *UnsignedIntArrayListIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedIntArrayListIter *>(pySelf);
+
+    if (self->container->vector.empty()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    if (self->reversed) {
+        if (self->index == 0) {
+            // last iteration
+            unsigned int element = self->container->vector[self->index];
+            self->index = SIZE_MAX;
+            return PyLong_FromUnsignedLong(element);
+        }
+        if (self->index == SIZE_MAX) {
+            // already finish iteration
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        unsigned int element = self->container->vector[self->index];
+        self->index--;
+        return PyLong_FromUnsignedLong(element);
+    } else {
+        if (self->index >= self->container->vector.size()) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        unsigned int element = self->container->vector[self->index];
+        self->index++;
+        return PyLong_FromUnsignedLong(element);
+    }
+}
+
+static PyObject *UnsignedIntArrayListIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef UnsignedIntArrayListIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef UnsignedIntArrayListIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.UnsignedIntArrayListIter",
+        "An UnsignedIntArrayListIter_module that creates an UnsignedIntArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeUnsignedIntArrayListIterType(PyTypeObject &type) {
+    type.tp_name = "UnsignedIntArrayListIter";
+    type.tp_basicsize = sizeof(UnsignedIntArrayListIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = UnsignedIntArrayListIter_iter;
+    type.tp_iternext = UnsignedIntArrayListIter_next;
+    type.tp_methods = UnsignedIntArrayListIter_methods;
+    type.tp_dealloc = (destructor) UnsignedIntArrayListIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_UnsignedIntArrayListIter() {
+    initializeUnsignedIntArrayListIterType(UnsignedIntArrayListIterType);
+    if (PyType_Ready(&UnsignedIntArrayListIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&UnsignedIntArrayListIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&UnsignedIntArrayListIterType);
+    if (PyModule_AddObject(object, "UnsignedIntArrayListIter", (PyObject *) &UnsignedIntArrayListIterType) < 0) {
+        Py_DECREF(&UnsignedIntArrayListIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#ifndef PYFASTUTIL_UNSIGNEDINTARRAYLISTITER_H
+#define PYFASTUTIL_UNSIGNEDINTARRAYLISTITER_H
+
+#include "utils/PythonPCH.h"
+#include "UnsignedIntArrayList.h"
+
+extern "C" {
+typedef struct UnsignedIntArrayListIter {
+    PyObject_HEAD;
+    UnsignedIntArrayList *container;
+    size_t index;
+    bool reversed;
+} UnsignedIntArrayListIter;
+
+UnsignedIntArrayListIter *UnsignedIntArrayListIter_create(UnsignedIntArrayList *list, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_UnsignedIntArrayListIter();
+
+#endif //PYFASTUTIL_UNSIGNEDINTARRAYLISTITER_H
@@ -0,0 +1,27 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#ifndef PYFASTUTIL_UNSIGNEDLONGARRAYLIST_H
+#define PYFASTUTIL_UNSIGNEDLONGARRAYLIST_H
+
+#include "utils/PythonPCH.h"
+#include "utils/memory/AlignedAllocator.h"
+#include <vector>
+
+extern "C" {
+typedef struct UnsignedLongArrayList {
+    PyObject_HEAD;
+    // 64 bytes aligned like IntArrayList, for faster SIMD
+    std::vector<unsigned long long, AlignedAllocator<unsigned long long, 64>> vector;
+    Py_ssize_t shape = 0;
+    // live buffer exports, the vector must not be resized while there are any
+    Py_ssize_t exports = 0;
+} UnsignedLongArrayList;
+
+extern PyTypeObject UnsignedLongArrayListType;
+}
+
+PyMODINIT_FUNC PyInit_UnsignedLongArrayList();
+
+#endif //PYFASTUTIL_UNSIGNEDLONGARRAYLIST_H
@@ -0,0 +1,124 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#include "UnsignedLongArrayListIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject UnsignedLongArrayListIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+UnsignedLongArrayListIter *UnsignedLongArrayListIter_create(UnsignedLongArrayList *list, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<UnsignedLongArrayListIter>(UnsignedLongArrayListIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(list);
+    instance->container = list;
+    if (reversed) {
+        instance->index = (!list->vector.empty()) ? list->vector.size() - 1 : 0;
+        instance->reversed = true;
+    } else {
+        instance->index = 0;
+        instance->reversed = false;
+    }
+
+    return instance;
+}
+
+static void UnsignedLongArrayListIter_dealloc(UnsignedLongArrayListIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *UnsignedLongArrayListIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<UnsignedLongArrayListIter *>(pySelf);
+
+    if (self->container->vector.empty()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    if (self->reversed) {
+        if (self->index == 0) {
+            // last iteration
+            unsigned long long element = self->container->vector[self->index];
+            self->index = SIZE_MAX;
+            return PyLong_FromUnsignedLongLong(element);
+        }
+        if (self->index == SIZE_MAX) {
+            // already finish iteration
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        unsigned long long element = self->container->vector[self->index];
+        self->index--;
+        return PyLong_FromUnsignedLongLong(element);
+    } else {
+        if (self->index >= self->container->vector.size()) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+
+        unsigned long long element = self->container->vector[self->index];
+        self->index++;
+        return PyLong_FromUnsignedLongLong(element);
+    }
+}
+
+static PyObject *UnsignedLongArrayListIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef UnsignedLongArrayListIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef UnsignedLongArrayListIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.UnsignedLongArrayListIter",
+        "An UnsignedLongArrayListIter_module that creates an UnsignedLongArrayList",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeUnsignedLongArrayListIterType(PyTypeObject &type) {
+    type.tp_name = "UnsignedLongArrayListIter";
+    type.tp_basicsize = sizeof(UnsignedLongArrayListIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = UnsignedLongArrayListIter_iter;
+    type.tp_iternext = UnsignedLongArrayListIter_next;
+    type.tp_methods = UnsignedLongArrayListIter_methods;
+    type.tp_dealloc = (destructor) UnsignedLongArrayListIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_UnsignedLongArrayListIter() {
+    initializeUnsignedLongArrayListIterType(UnsignedLongArrayListIterType);
+    if (PyType_Ready(&UnsignedLongArrayListIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&UnsignedLongArrayListIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&UnsignedLongArrayListIterType);
+    if (PyModule_AddObject(object, "UnsignedLongArrayListIter", (PyObject *) &UnsignedLongArrayListIterType) < 0) {
+        Py_DECREF(&UnsignedLongArrayListIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
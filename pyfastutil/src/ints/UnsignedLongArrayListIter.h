@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#ifndef PYFASTUTIL_UNSIGNEDLONGARRAYLISTITER_H
+#define PYFASTUTIL_UNSIGNEDLONGARRAYLISTITER_H
+
+#include "utils/PythonPCH.h"
+#include "UnsignedLongArrayList.h"
+
+extern "C" {
+typedef struct UnsignedLongArrayListIter {
+    PyObject_HEAD;
+    UnsignedLongArrayList *container;
+    size_t index;
+    bool reversed;
+} UnsignedLongArrayListIter;
+
+UnsignedLongArrayListIter *UnsignedLongArrayListIter_create(UnsignedLongArrayList *list, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_UnsignedLongArrayListIter();
+
+#endif //PYFASTUTIL_UNSIGNEDLONGARRAYLISTITER_H
@@ -0,0 +1,703 @@
+//
+// Created by xia__mc on 2024/12/4.
+//
+
+#include "Object2IntHashMap.h"
+#include <climits>
+#include "utils/PythonUtils.h"
+#include "ints/IntArrayList.h"
+#include "objects/Object2IntHashMapIter.h"
+
+extern "C" {
+
+PyTypeObject Object2IntHashMapType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+/**
+ * Convert a python object to C int, raise TypeError or OverflowError if not possible.
+ * @return if successful
+ */
+static __forceinline bool convert(PyObject *obj, int &result) {
+    const long value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return false;
+    }
+#if LONG_MAX > INT_MAX
+    if (UNLIKELY(value > INT_MAX || value < INT_MIN)) {
+        PyErr_SetString(PyExc_OverflowError, "Python int too large to convert to C int");
+        return false;
+    }
+#endif
+    result = static_cast<int>(value);
+    return true;
+}
+
+/**
+ * Hash a key once, the hash is stored in the map with the key.
+ * If not successful (unhashable key), function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool hashKey(PyObject *obj, HashedObject &key) {
+    key.object = obj;
+    key.hash = PyObject_Hash(obj);
+    return key.hash != -1;
+}
+
+static __forceinline void setKeyError(PyObject *key) {
+    PyObject *tuple = PyTuple_Pack(1, key);
+    if (tuple == nullptr) return;
+    PyErr_SetObject(PyExc_KeyError, tuple);
+    Py_DECREF(tuple);
+}
+
+/**
+ * Put key -> value, taking a new reference to key if it's a new entry.
+ * @return if successful, false if __eq__ of a key raised
+ */
+static __forceinline bool put(Object2IntHashMap *self, const HashedObject &key, const int value) {
+    const auto result = self->map.insert_or_assign(key, value);
+    if (result.second) {
+        Py_INCREF(key.object);
+    }
+    return !PyErr_Occurred();
+}
+
+/**
+ * Remove every entry, keys are released after the map is already empty.
+ */
+static __forceinline void clearMap(Object2IntHashMap *self) {
+    ankerl::unordered_dense::map<HashedObject, int, HashedObjectHash, HashedObjectEqual> map;
+    map.swap(self->map);
+    for (const auto &entry: map.values()) {
+        Py_DECREF(entry.first.object);
+    }
+}
+
+static __forceinline bool updateFromEntry(Object2IntHashMap *self, PyObject *entry) {
+    PyObject *fastEntry = PySequence_Fast(entry, "expected an iterable of (key, value) pairs.");
+    if (fastEntry == nullptr) {
+        return false;
+    }
+
+    if (PySequence_Fast_GET_SIZE(fastEntry) != 2) {
+        SAFE_DECREF(fastEntry);
+        PyErr_SetString(PyExc_ValueError, "expected entry size == 2.");
+        return false;
+    }
+
+    HashedObject key{};
+    int value;
+    auto items = PySequence_Fast_ITEMS(fastEntry);
+    const bool success = hashKey(items[0], key) && convert(items[1], value) && put(self, key, value);
+    SAFE_DECREF(fastEntry);
+    return success;
+}
+
+/**
+ * Put all entries of an Object2IntHashMap, a dict, a mapping or an iterable of pairs into self.
+ * @return 0 if successful, -1 if error
+ */
+static int Object2IntHashMap_updateFrom(Object2IntHashMap *self, PyObject *other) {
+    try {
+        if (Py_TYPE(other) == &Object2IntHashMapType) {
+            auto *map = reinterpret_cast<Object2IntHashMap *>(other);
+            if (map == self) return 0;
+
+            if (self->map.empty()) {
+                // hashes are cached, so copying never calls back into python
+                self->map = map->map;
+                for (const auto &entry: self->map.values()) {
+                    Py_INCREF(entry.first.object);
+                }
+                return 0;
+            }
+
+            self->map.reserve(self->map.size() + map->map.size());
+            for (size_t i = 0; i < map->map.size(); ++i) {
+                const auto entry = map->map.values()[i];
+                if (!put(self, entry.first, entry.second)) {
+                    return -1;
+                }
+            }
+            return 0;
+        }
+
+        if (PyDict_Check(other)) {
+            PyObject *pyKey, *pyValue;
+            Py_ssize_t pos = 0;
+
+            self->map.reserve(self->map.size() + static_cast<size_t>(PyDict_GET_SIZE(other)));
+            while (PyDict_Next(other, &pos, &pyKey, &pyValue)) {
+                HashedObject key{};
+                int value;
+                if (!hashKey(pyKey, key) || !convert(pyValue, value) || !put(self, key, value)) {
+                    return -1;
+                }
+            }
+            return 0;
+        }
+
+        static PyObject *keysAttr = PyUnicode_InternFromString("keys");
+
+        if (PyMapping_Check(other) && PyObject_HasAttr(other, keysAttr)) {
+            PyObject *keys = PyMapping_Keys(other);
+            if (keys == nullptr) {
+                return -1;
+            }
+
+            PyObject *iter = PyObject_GetIter(keys);
+            SAFE_DECREF(keys);
+            if (iter == nullptr) {
+                return -1;
+            }
+
+            PyObject *pyKey;
+            while ((pyKey = PyIter_Next(iter)) != nullptr) {
+                PyObject *pyValue = PyObject_GetItem(other, pyKey);
+                HashedObject key{};
+                int value;
+                const bool success = pyValue != nullptr && hashKey(pyKey, key) && convert(pyValue, value)
+                                     && put(self, key, value);
+                SAFE_DECREF(pyKey);
+                Py_XDECREF(pyValue);
+                if (!success) {
+                    SAFE_DECREF(iter);
+                    return -1;
+                }
+            }
+            SAFE_DECREF(iter);
+            return PyErr_Occurred() ? -1 : 0;
+        }
+
+        PyObject *iter = PyObject_GetIter(other);
+        if (iter == nullptr) {
+            PyErr_SetString(PyExc_TypeError, "expected a iterable or a mapping");
+            return -1;
+        }
+
+        PyObject *entry;
+        while ((entry = PyIter_Next(iter)) != nullptr) {
+            const bool success = updateFromEntry(self, entry);
+            SAFE_DECREF(entry);
+            if (!success) {
+                SAFE_DECREF(iter);
+                return -1;
+            }
+        }
+        SAFE_DECREF(iter);
+        return PyErr_Occurred() ? -1 : 0;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+}
+
+static PyObject *Object2IntHashMap_new(PyTypeObject *type, PyObject *args, PyObject *kwargs) {
+    // the map must be valid before the first gc traversal, which may happen before __init__
+    auto *self = reinterpret_cast<Object2IntHashMap *>(PyType_GenericNew(type, args, kwargs));
+    if (self == nullptr) return nullptr;
+
+    new(&self->map) ankerl::unordered_dense::map<HashedObject, int, HashedObjectHash, HashedObjectEqual>();
+    return reinterpret_cast<PyObject *>(self);
+}
+
+static int Object2IntHashMap_init(Object2IntHashMap *self, PyObject *args, PyObject *kwargs) {
+    static constexpr const char *kwlist[] = {"__map", nullptr};
+
+    PyObject *arg = nullptr;
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &arg)) {
+        return -1;
+    }
+
+    if (arg == nullptr) {
+        return 0;
+    }
+    return Object2IntHashMap_updateFrom(self, arg);
+}
+
+static int Object2IntHashMap_traverse(Object2IntHashMap *self, visitproc visit, void *arg) {
+    for (const auto &entry: self->map.values()) {
+        Py_VISIT(entry.first.object);
+    }
+    return 0;
+}
+
+static int Object2IntHashMap_clear_refs(Object2IntHashMap *self) {
+    clearMap(self);
+    return 0;
+}
+
+static void Object2IntHashMap_dealloc(Object2IntHashMap *self) {
+    PyObject_GC_UnTrack(self);
+    clearMap(self);
+    self->map.~table();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *Object2IntHashMap_copy(PyObject *pySelf) {
+    auto *copy = Py_CreateObj<Object2IntHashMap>(Object2IntHashMapType);
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    if (Object2IntHashMap_updateFrom(copy, pySelf) == -1) {
+        SAFE_DECREF(copy);
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *Object2IntHashMap_get(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "get() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    HashedObject key{};
+    if (!hashKey(args[0], key)) return nullptr;
+
+    const auto it = self->map.find(key);
+    if (UNLIKELY(PyErr_Occurred())) return nullptr;
+    if (it != self->map.end()) {
+        return PyFast_FromInt(it->second);
+    }
+
+    PyObject *defaultValue = nargs == 2 ? args[1] : Py_None;
+    Py_INCREF(defaultValue);
+    return defaultValue;
+}
+
+static PyObject *Object2IntHashMap_pop(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "pop() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    HashedObject key{};
+    if (!hashKey(args[0], key)) return nullptr;
+
+    const auto it = self->map.find(key);
+    if (UNLIKELY(PyErr_Occurred())) return nullptr;
+    if (it != self->map.end()) {
+        PyObject *oldKey = it->first.object;
+        const int value = it->second;
+        self->map.erase(it);
+        SAFE_DECREF(oldKey);
+        return PyFast_FromInt(value);
+    }
+
+    if (nargs == 2) {
+        Py_INCREF(args[1]);
+        return args[1];
+    }
+
+    setKeyError(args[0]);
+    return nullptr;
+}
+
+static PyObject *Object2IntHashMap_setdefault(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    if (nargs < 1 || nargs > 2) {
+        PyErr_SetString(PyExc_TypeError, "setdefault() takes 1 or 2 arguments");
+        return nullptr;
+    }
+
+    HashedObject key{};
+    int value = 0;
+    if (!hashKey(args[0], key)) return nullptr;
+    if (nargs == 2 && !convert(args[1], value)) return nullptr;
+
+    try {
+        const auto result = self->map.try_emplace(key, value);
+        if (result.second) {
+            Py_INCREF(key.object);
+        }
+        if (UNLIKELY(PyErr_Occurred())) return nullptr;
+        return PyFast_FromInt(result.first->second);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+/**
+ * Like fastutil's addTo, add delta to the value of key (a missing key counts as 0).
+ * @return the previous value
+ */
+static PyObject *Object2IntHashMap_add_to(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "add_to() takes exactly 2 arguments");
+        return nullptr;
+    }
+
+    HashedObject key{};
+    int delta;
+    if (!hashKey(args[0], key) || !convert(args[1], delta)) return nullptr;
+
+    try {
+        const auto result = self->map.try_emplace(key, 0);
+        if (result.second) {
+            Py_INCREF(key.object);
+        }
+        if (UNLIKELY(PyErr_Occurred())) return nullptr;
+
+        auto &value = result.first->second;
+        const int previous = value;
+        // wrap around on overflow like java does, signed overflow is UB in C++
+        value = static_cast<int>(static_cast<unsigned int>(previous) + static_cast<unsigned int>(delta));
+        return PyFast_FromInt(previous);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+}
+
+static PyObject *Object2IntHashMap_items(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    const auto &values = self->map.values();
+    const auto size = static_cast<Py_ssize_t>(values.size());
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *value = PyFast_FromInt(values[i].second);
+        PyObject *item = value != nullptr ? PyTuple_Pack(2, values[i].first.object, value) : nullptr;
+        Py_XDECREF(value);
+        if (item == nullptr) {
+            SAFE_DECREF(result);
+            return nullptr;
+        }
+
+        PyList_SET_ITEM(result, i, item);  // PyList_SET_ITEM handle this ref
+    }
+
+    return result;
+}
+
+static PyObject *Object2IntHashMap_keys(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    const auto &values = self->map.values();
+    const auto size = static_cast<Py_ssize_t>(values.size());
+    PyObject *result = PyList_New(size);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        Py_INCREF(values[i].first.object);
+        PyList_SET_ITEM(result, i, values[i].first.object);
+    }
+
+    return result;
+}
+
+static PyObject *Object2IntHashMap_values(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    auto *result = Py_CreateObj<IntArrayList>(IntArrayListType);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        const auto &values = self->map.values();
+        result->vector.resize(values.size());
+        auto data = result->vector.data();
+        for (const auto &entry: values) {
+            *data++ = entry.second;
+        }
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *Object2IntHashMap_update(PyObject *pySelf, PyObject *other) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    if (Object2IntHashMap_updateFrom(self, other) == -1) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *Object2IntHashMap_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    clearMap(self);
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t Object2IntHashMap_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->map.size());
+}
+
+static PyObject *Object2IntHashMap_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    auto iter = Object2IntHashMapIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *Object2IntHashMap_getitem(PyObject *pySelf, PyObject *pyKey) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    HashedObject key{};
+    if (!hashKey(pyKey, key)) return nullptr;
+
+    const auto it = self->map.find(key);
+    if (UNLIKELY(PyErr_Occurred())) return nullptr;
+    if (it != self->map.end()) {
+        return PyFast_FromInt(it->second);
+    }
+
+    setKeyError(pyKey);
+    return nullptr;
+}
+
+static int Object2IntHashMap_setitem(PyObject *pySelf, PyObject *pyKey, PyObject *pyValue) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    HashedObject key{};
+    if (!hashKey(pyKey, key)) return -1;
+
+    if (pyValue == nullptr) {  // del map[key]
+        const auto it = self->map.find(key);
+        if (UNLIKELY(PyErr_Occurred())) return -1;
+        if (it == self->map.end()) {
+            setKeyError(pyKey);
+            return -1;
+        }
+
+        PyObject *oldKey = it->first.object;
+        self->map.erase(it);
+        SAFE_DECREF(oldKey);
+        return 0;
+    }
+
+    int value;
+    if (!convert(pyValue, value)) return -1;
+
+    try {
+        return put(self, key, value) ? 0 : -1;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return -1;
+    }
+}
+
+static int Object2IntHashMap_contains(PyObject *pySelf, PyObject *pyKey) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    HashedObject key{};
+    if (!hashKey(pyKey, key)) return -1;
+
+    const bool contains = self->map.contains(key);
+    if (UNLIKELY(PyErr_Occurred())) return -1;
+    return contains ? 1 : 0;
+}
+
+static __forceinline PyObject *Object2IntHashMap_eq(PyObject *pySelf, PyObject *pyValue) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    if (Py_TYPE(pyValue) == &Object2IntHashMapType) {
+        auto *value = reinterpret_cast<Object2IntHashMap *>(pyValue);
+        if (value->map.size() != self->map.size())
+            Py_RETURN_FALSE;
+
+        // index based, keys compared with __eq__ may mutate either map
+        for (size_t i = 0; i < value->map.size(); ++i) {
+            const auto entry = value->map.values()[i];
+            const auto it = self->map.find(entry.first);
+            if (UNLIKELY(PyErr_Occurred())) return nullptr;
+            if (it == self->map.end() || it->second != entry.second)
+                Py_RETURN_FALSE;
+        }
+        Py_RETURN_TRUE;
+    }
+
+    if (!PyDict_Check(pyValue))
+        Py_RETURN_NOTIMPLEMENTED;
+
+    // for dict
+    if (PyDict_GET_SIZE(pyValue) != static_cast<Py_ssize_t>(self->map.size()))
+        Py_RETURN_FALSE;
+
+    PyObject *pyKey, *pyItem;
+    Py_ssize_t pos = 0;
+    while (PyDict_Next(pyValue, &pos, &pyKey, &pyItem)) {
+        HashedObject key{};
+        if (!hashKey(pyKey, key)) return nullptr;
+
+        int value;
+        if (!PyLong_Check(pyItem) || !convert(pyItem, value)) {
+            PyErr_Clear();
+            Py_RETURN_FALSE;
+        }
+
+        const auto it = self->map.find(key);
+        if (UNLIKELY(PyErr_Occurred())) return nullptr;
+        if (it == self->map.end() || it->second != value)
+            Py_RETURN_FALSE;
+    }
+
+    Py_RETURN_TRUE;
+}
+
+static PyObject *Object2IntHashMap_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    PyObject *isEq;
+    switch (op) {
+        case Py_EQ:  // ==
+            return Object2IntHashMap_eq(pySelf, pyValue);
+        case Py_NE:  // !=
+            isEq = Object2IntHashMap_eq(pySelf, pyValue);
+            if (isEq == nullptr || isEq == Py_NotImplemented)
+                return isEq;
+            if (isEq == Py_True) {
+                SAFE_DECREF(isEq);
+                Py_RETURN_FALSE;
+            } else {
+                SAFE_DECREF(isEq);
+                Py_RETURN_TRUE;
+            }
+        default:
+            Py_RETURN_NOTIMPLEMENTED;
+    }
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *Object2IntHashMap_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static PyObject *Object2IntHashMap_repr(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Object2IntHashMap *>(pySelf);
+
+    if (self->map.empty()) {
+        return PyUnicode_FromString("{}");
+    }
+
+    // a key's repr may refer back to the map
+    const int status = Py_ReprEnter(pySelf);
+    if (status != 0) {
+        return status > 0 ? PyUnicode_FromString("{...}") : nullptr;
+    }
+
+    PyObject *reprList = PyUnicode_FromString("{");
+    for (size_t i = 0; reprList != nullptr && i < self->map.size(); ++i) {
+        const auto &entry = self->map.values()[i];
+        PyObject *key = entry.first.object;
+        Py_INCREF(key);
+        PyObject *itemRepr = PyUnicode_FromFormat(i == 0 ? "%R: %d" : ", %R: %d", key, entry.second);
+        SAFE_DECREF(key);
+        PyUnicode_AppendAndDel(&reprList, itemRepr);
+    }
+    PyUnicode_AppendAndDel(&reprList, PyUnicode_FromString("}"));
+
+    Py_ReprLeave(pySelf);
+    return reprList;
+}
+
+static PyMethodDef Object2IntHashMap_methods[] = {
+        {"copy", (PyCFunction) Object2IntHashMap_copy, METH_NOARGS},
+        {"get", (PyCFunction) Object2IntHashMap_get, METH_FASTCALL},
+        {"pop", (PyCFunction) Object2IntHashMap_pop, METH_FASTCALL},
+        {"setdefault", (PyCFunction) Object2IntHashMap_setdefault, METH_FASTCALL},
+        {"add_to", (PyCFunction) Object2IntHashMap_add_to, METH_FASTCALL},
+        {"items", (PyCFunction) Object2IntHashMap_items, METH_NOARGS},
+        {"keys", (PyCFunction) Object2IntHashMap_keys, METH_NOARGS},
+        {"values", (PyCFunction) Object2IntHashMap_values, METH_NOARGS},
+        {"update", (PyCFunction) Object2IntHashMap_update, METH_O},
+        {"clear", (PyCFunction) Object2IntHashMap_clear, METH_NOARGS},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) Object2IntHashMap_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef Object2IntHashMap_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.Object2IntHashMap",
+        "An Object2IntHashMap_module that creates an Object2IntHashMap",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods Object2IntHashMap_asSequence = {
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        Object2IntHashMap_contains,
+        nullptr,
+        nullptr
+};
+
+static PyMappingMethods Object2IntHashMap_asMapping = {
+        Object2IntHashMap_len,
+        Object2IntHashMap_getitem,
+        Object2IntHashMap_setitem
+};
+
+void initializeObject2IntHashMapType(PyTypeObject &type) {
+    type.tp_name = "Object2IntHashMap";
+    type.tp_basicsize = sizeof(Object2IntHashMap);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC;
+    type.tp_as_sequence = &Object2IntHashMap_asSequence;
+    type.tp_as_mapping = &Object2IntHashMap_asMapping;
+    type.tp_iter = Object2IntHashMap_iter;
+    type.tp_methods = Object2IntHashMap_methods;
+    type.tp_init = (initproc) Object2IntHashMap_init;
+    type.tp_new = Object2IntHashMap_new;
+    type.tp_dealloc = (destructor) Object2IntHashMap_dealloc;
+    type.tp_traverse = (traverseproc) Object2IntHashMap_traverse;
+    type.tp_clear = (inquiry) Object2IntHashMap_clear_refs;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_GC_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = Object2IntHashMap_compare;
+    type.tp_repr = Object2IntHashMap_repr;
+    type.tp_str = Object2IntHashMap_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_Object2IntHashMap() {
+    initializeObject2IntHashMapType(Object2IntHashMapType);
+    if (PyType_Ready(&Object2IntHashMapType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&Object2IntHashMap_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&Object2IntHashMapType);
+    if (PyModule_AddObject(object, "Object2IntHashMap", (PyObject *) &Object2IntHashMapType) < 0) {
+        Py_DECREF(&Object2IntHashMapType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,54 @@
+//
+// Created by xia__mc on 2024/12/4.
+//
+
+#ifndef PYFASTUTIL_OBJECT2INTHASHMAP_H
+#define PYFASTUTIL_OBJECT2INTHASHMAP_H
+
+#include "utils/PythonPCH.h"
+#include "utils/include/UnorderedDense.h"
+
+/**
+ * A python object with its hash cached, so rehashing and probing never call back into python.
+ */
+struct HashedObject {
+    PyObject *object;
+    Py_hash_t hash;
+};
+
+struct HashedObjectHash {
+    // not avalanching, ankerl mixes the python hash before using it
+    __forceinline uint64_t operator()(const HashedObject &key) const noexcept {
+        return static_cast<uint64_t>(key.hash);
+    }
+};
+
+struct HashedObjectEqual {
+    /**
+     * Same semantics as dict: identity first, then hash, then __eq__.
+     * If __eq__ raises, the keys are treated as different and the python error is left set for the caller.
+     * Unlike dict, a key whose __eq__ mutates the map it's being looked up in is not supported.
+     */
+    __forceinline bool operator()(const HashedObject &a, const HashedObject &b) const noexcept {
+        if (a.object == b.object) return true;
+        if (a.hash != b.hash) return false;
+        if (PyUnicode_CheckExact(a.object) && PyUnicode_CheckExact(b.object)) {
+            return PyUnicode_Compare(a.object, b.object) == 0;
+        }
+        return PyObject_RichCompareBool(a.object, b.object, Py_EQ) == 1;
+    }
+};
+
+extern "C" {
+typedef struct Object2IntHashMap {
+    PyObject_HEAD;
+    // owns a strong reference to every key
+    ankerl::unordered_dense::map<HashedObject, int, HashedObjectHash, HashedObjectEqual> map;
+} Object2IntHashMap;
+
+extern PyTypeObject Object2IntHashMapType;
+}
+
+PyMODINIT_FUNC PyInit_Object2IntHashMap();
+
+#endif //PYFASTUTIL_OBJECT2INTHASHMAP_H
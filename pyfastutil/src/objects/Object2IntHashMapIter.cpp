@@ -0,0 +1,103 @@
+//
+// Created by xia__mc on 2024/12/4.
+//
+
+#include "Object2IntHashMapIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject Object2IntHashMapIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+Object2IntHashMapIter *Object2IntHashMapIter_create(Object2IntHashMap *map) {
+    auto *instance = Py_CreateObjNoInit<Object2IntHashMapIter>(Object2IntHashMapIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(map);
+    instance->container = map;
+    instance->index = 0;
+    instance->size = map->map.size();
+
+    return instance;
+}
+
+static void Object2IntHashMapIter_dealloc(Object2IntHashMapIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *Object2IntHashMapIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<Object2IntHashMapIter *>(pySelf);
+
+    // entries are stored densely, so iterating keys is just walking the values vector
+    const auto &values = self->container->map.values();
+    if (UNLIKELY(values.size() != self->size)) {
+        PyErr_SetString(PyExc_RuntimeError, "Object2IntHashMap changed size during iteration");
+        return nullptr;
+    }
+
+    if (self->index >= values.size()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+
+    PyObject *key = values[self->index++].first.object;
+    Py_INCREF(key);
+    return key;
+}
+
+static PyObject *Object2IntHashMapIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef Object2IntHashMapIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef Object2IntHashMapIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.Object2IntHashMapIter",
+        "An Object2IntHashMapIter_module that creates an Object2IntHashMapIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeObject2IntHashMapIterType(PyTypeObject &type) {
+    type.tp_name = "Object2IntHashMapIter";
+    type.tp_basicsize = sizeof(Object2IntHashMapIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = Object2IntHashMapIter_iter;
+    type.tp_iternext = Object2IntHashMapIter_next;
+    type.tp_methods = Object2IntHashMapIter_methods;
+    type.tp_dealloc = (destructor) Object2IntHashMapIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_Object2IntHashMapIter() {
+    initializeObject2IntHashMapIterType(Object2IntHashMapIterType);
+    if (PyType_Ready(&Object2IntHashMapIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&Object2IntHashMapIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&Object2IntHashMapIterType);
+    if (PyModule_AddObject(object, "Object2IntHashMapIter", (PyObject *) &Object2IntHashMapIterType) < 0) {
+        Py_DECREF(&Object2IntHashMapIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
@@ -0,0 +1,25 @@
+//
+// Created by xia__mc on 2024/12/4.
+//
+
+#ifndef PYFASTUTIL_OBJECT2INTHASHMAPITER_H
+#define PYFASTUTIL_OBJECT2INTHASHMAPITER_H
+
+#include "utils/PythonPCH.h"
+#include "Object2IntHashMap.h"
+
+extern "C" {
+typedef struct Object2IntHashMapIter {
+    PyObject_HEAD;
+    Object2IntHashMap *container;
+    size_t index;
+    size_t size;  // size when the iterator was created, used to detect modification
+} Object2IntHashMapIter;
+
+Object2IntHashMapIter *Object2IntHashMapIter_create(Object2IntHashMap *map);
+
+}
+
+PyMODINIT_FUNC PyInit_Object2IntHashMapIter();
+
+#endif //PYFASTUTIL_OBJECT2INTHASHMAPITER_H
@@ -0,0 +1,781 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#include "ObjectArrayDeque.h"
+#include <string>
+#include <vector>
+#include <exception>
+#include <stdexcept>
+#include "utils/PythonUtils.h"
+#include "objects/ObjectArrayList.h"
+#include "objects/ObjectArrayDequeIter.h"
+
+extern "C" {
+
+PyTypeObject ObjectArrayDequeType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+static __forceinline ObjectArrayDeque *ObjectArrayDeque_new() {
+    return Py_CreateObj<ObjectArrayDeque>(ObjectArrayDequeType);
+}
+
+/**
+ * Index of the first element equal to value in [start, stop), or stop if there's none.
+ * Comparing may run python code, so a deque changed by it raises RuntimeError.
+ * @return the index, or -1 if error
+ */
+static Py_ssize_t ObjectArrayDeque_find(ObjectArrayDeque *self, size_t start, size_t stop, PyObject *value) {
+    const uint64_t modCount = self->modCount;
+
+    for (size_t i = start; i < stop; ++i) {
+        PyObject *item = self->deque[i];
+        Py_INCREF(item);
+        const int cmpResult = PyObject_RichCompareBool(item, value, Py_EQ);
+        SAFE_DECREF(item);
+        if (cmpResult < 0) {
+            return -1;
+        }
+        if (UNLIKELY(self->modCount != modCount)) {
+            PyErr_SetString(PyExc_RuntimeError, "ObjectArrayDeque mutated during iteration");
+            return -1;
+        }
+        if (cmpResult > 0) {
+            return static_cast<Py_ssize_t>(i);
+        }
+    }
+    return static_cast<Py_ssize_t>(stop);
+}
+
+/**
+ * Drop every element. The references are released after the deque is emptied, as releasing may run python code.
+ */
+static void ObjectArrayDeque_release(ObjectArrayDeque *self) {
+    std::vector<PyObject *> items(self->deque.size());
+    self->deque.popFront(items.data(), items.size());
+    self->modCount++;
+
+    for (PyObject *item: items) {
+        SAFE_DECREF(item);
+    }
+}
+
+/**
+ * Push every element of iterable at the back, or one by one at the front if left, which reverses them.
+ * If not successful, function will raise python exception. The elements pushed before the error stay.
+ */
+static bool ObjectArrayDeque_extendFrom(ObjectArrayDeque *self, PyObject *iterable, const bool left) {
+    self->modCount++;
+
+    try {
+        std::vector<PyObject *> items;
+        if (Py_TYPE(iterable) == &ObjectArrayDequeType) {
+            // copy first, iterable may be self
+            const auto &other = reinterpret_cast<ObjectArrayDeque *>(iterable)->deque;
+            items.reserve(other.size());
+            other.forEachChunk([&items](PyObject *const *chunk, size_t n) {
+                items.insert(items.end(), chunk, chunk + n);
+            });
+        } else if (Py_TYPE(iterable) == &ObjectArrayListType) {
+            items = reinterpret_cast<ObjectArrayList *>(iterable)->vector;
+        } else if (PyList_CheckExact(iterable) || PyTuple_CheckExact(iterable)) {  // fast operation
+            PyObject **begin = PySequence_Fast_ITEMS(iterable);
+            items.assign(begin, begin + PySequence_Fast_GET_SIZE(iterable));
+        } else {
+            PyObject *iter = PyObject_GetIter(iterable);
+            if (iter == nullptr) {
+                return false;
+            }
+
+            PyObject *item;
+            while ((item = PyIter_Next(iter)) != nullptr) {
+                // the new reference is the one the deque keeps
+                if (left) {
+                    self->deque.push_front(item);
+                } else {
+                    self->deque.push_back(item);
+                }
+            }
+            SAFE_DECREF(iter);
+            return !PyErr_Occurred();
+        }
+
+        self->deque.reserve(self->deque.size() + items.size());
+        for (PyObject *item: items) {
+            Py_INCREF(item);
+        }
+        if (left) {
+            for (PyObject *item: items) {
+                self->deque.push_front(item);
+            }
+        } else {
+            self->deque.append(items.data(), items.size());
+        }
+        return true;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return false;
+    }
+}
+
+static PyObject *ObjectArrayDeque_pyNew(PyTypeObject *type, PyObject *args, PyObject *kwargs) {
+    // the deque must be valid before the first gc traversal, which may happen before __init__
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(PyType_GenericNew(type, args, kwargs));
+    if (self == nullptr) return nullptr;
+
+    new(&self->deque) RingBuffer<PyObject *>();
+    self->modCount = 0;
+    return reinterpret_cast<PyObject *>(self);
+}
+
+static int ObjectArrayDeque_init(ObjectArrayDeque *self, PyObject *args, PyObject *kwargs) {
+    if (!self->deque.empty()) {  // __init__ called again
+        ObjectArrayDeque_release(self);
+    }
+
+    PyObject *pyIterable = nullptr;
+
+    static constexpr const char *kwlist[] = {"iterable", nullptr};
+
+    // parse args
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", const_cast<char **>(kwlist), &pyIterable)) {
+        return -1;
+    }
+
+    if (pyIterable == nullptr) {
+        return 0;
+    }
+    return ObjectArrayDeque_extendFrom(self, pyIterable, false) ? 0 : -1;
+}
+
+static int ObjectArrayDeque_traverse(ObjectArrayDeque *self, visitproc visit, void *arg) {
+    int result = 0;
+    self->deque.forEachChunk(0, self->deque.size(), [&](PyObject *const *items, size_t n, size_t) {
+        for (size_t i = 0; i < n; i++) {
+            result = visit(items[i], arg);
+            if (result != 0) return true;
+        }
+        return false;
+    });
+    return result;
+}
+
+static int ObjectArrayDeque_clear_refs(ObjectArrayDeque *self) {
+    ObjectArrayDeque_release(self);
+    return 0;
+}
+
+static void ObjectArrayDeque_dealloc(ObjectArrayDeque *self) {
+    PyObject_GC_UnTrack(self);
+    self->deque.forEachChunk([](PyObject *const *items, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            Py_DECREF(items[i]);
+        }
+    });
+    self->deque.~RingBuffer();
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *ObjectArrayDeque_to_list(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    const auto &deque = self->deque;
+    PyObject *result = PyList_New(static_cast<Py_ssize_t>(deque.size()));
+    if (result == nullptr) return nullptr;
+
+    for (size_t i = 0; i < deque.size(); ++i) {
+        PyObject *item = deque[i];
+        Py_INCREF(item);
+        PyList_SET_ITEM(result, static_cast<Py_ssize_t>(i), item);
+    }
+
+    return result;
+}
+
+static PyObject *ObjectArrayDeque_copy(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    auto *copy = ObjectArrayDeque_new();
+    if (copy == nullptr) return PyErr_NoMemory();
+
+    try {
+        copy->deque = self->deque;
+    } catch (const std::exception &e) {
+        SAFE_DECREF(copy);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    copy->deque.forEachChunk([](PyObject *const *items, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            Py_INCREF(items[i]);
+        }
+    });
+    return reinterpret_cast<PyObject *>(copy);
+}
+
+static PyObject *ObjectArrayDeque_append(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    try {
+        self->deque.push_back(object);
+        Py_INCREF(object);
+        self->modCount++;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *ObjectArrayDeque_appendleft(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    try {
+        self->deque.push_front(object);
+        Py_INCREF(object);
+        self->modCount++;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *ObjectArrayDeque_pop(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    if (self->deque.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from an empty deque");
+        return nullptr;
+    }
+
+    self->modCount++;
+    return self->deque.pop_back();
+}
+
+static PyObject *ObjectArrayDeque_popleft(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    if (self->deque.empty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from an empty deque");
+        return nullptr;
+    }
+
+    self->modCount++;
+    return self->deque.pop_front();
+}
+
+static PyObject *ObjectArrayDeque_extend(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    if (!ObjectArrayDeque_extendFrom(self, iterable, false)) return nullptr;
+    Py_RETURN_NONE;
+}
+
+static PyObject *ObjectArrayDeque_extendleft(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    if (!ObjectArrayDeque_extendFrom(self, iterable, true)) return nullptr;
+    Py_RETURN_NONE;
+}
+
+static PyObject *ObjectArrayDeque_drain(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "drain() takes at most 1 argument");
+        return nullptr;
+    }
+
+    size_t count = self->deque.size();
+    if (nargs == 1) {
+        const Py_ssize_t n = PyLong_AsSsize_t(args[0]);
+        if (n == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+        if (n >= 0) {
+            count = std::min(count, static_cast<size_t>(n));
+        }
+    }
+
+    auto *result = Py_CreateObj<ObjectArrayList>(ObjectArrayListType);
+    if (result == nullptr) return PyErr_NoMemory();
+
+    try {
+        result->vector.resize(count);
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    // the references move to the list
+    self->deque.popFront(result->vector.data(), count);
+    self->modCount++;
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *ObjectArrayDeque_rotate(PyObject *pySelf, PyObject *const *args, const Py_ssize_t nargs) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    if (nargs > 1) {
+        PyErr_SetString(PyExc_TypeError, "rotate() takes at most 1 argument");
+        return nullptr;
+    }
+
+    Py_ssize_t n = 1;
+    if (nargs == 1) {
+        n = PyLong_AsSsize_t(args[0]);
+        if (n == -1 && PyErr_Occurred()) {
+            return nullptr;
+        }
+    }
+
+    self->deque.rotate(n);
+    self->modCount++;
+    Py_RETURN_NONE;
+}
+
+static PyObject *ObjectArrayDeque_reverse(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    self->deque.reverse();
+    self->modCount++;
+    Py_RETURN_NONE;
+}
+
+static PyObject *ObjectArrayDeque_clear(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    try {
+        ObjectArrayDeque_release(self);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *ObjectArrayDeque_index(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    PyObject *object;
+    Py_ssize_t start = 0;
+    const auto size = static_cast<Py_ssize_t>(self->deque.size());
+    Py_ssize_t stop = size;
+
+    if (!PyArg_ParseTuple(args, "O|nn", &object, &start, &stop)) {
+        return nullptr;
+    }
+
+    if (start < 0) {
+        start = std::max(static_cast<Py_ssize_t>(0), start + size);
+    }
+    if (stop < 0) {
+        stop += size;
+    }
+    stop = std::min(stop, size);
+
+    if (start < stop) {
+        const Py_ssize_t index = ObjectArrayDeque_find(self, static_cast<size_t>(start), static_cast<size_t>(stop),
+                                                       object);
+        if (index == -1) return nullptr;
+        if (index != stop) {
+            return PyLong_FromSsize_t(index);
+        }
+    }
+
+    PyErr_SetString(PyExc_ValueError, "Value is not in deque.");
+    return nullptr;
+}
+
+static PyObject *ObjectArrayDeque_count(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    size_t result = 0;
+    size_t start = 0;
+    while (start < self->deque.size()) {
+        const Py_ssize_t index = ObjectArrayDeque_find(self, start, self->deque.size(), object);
+        if (index == -1) return nullptr;
+        if (static_cast<size_t>(index) == self->deque.size()) {
+            break;
+        }
+        result++;
+        start = static_cast<size_t>(index) + 1;
+    }
+    return PyLong_FromSize_t(result);
+}
+
+static PyObject *ObjectArrayDeque_remove(PyObject *pySelf, PyObject *object) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    const Py_ssize_t index = ObjectArrayDeque_find(self, 0, self->deque.size(), object);
+    if (index == -1) return nullptr;
+
+    if (static_cast<size_t>(index) == self->deque.size()) {
+        PyErr_SetString(PyExc_ValueError, "Value is not in deque.");
+        return nullptr;
+    }
+
+    PyObject *item = self->deque[static_cast<size_t>(index)];
+    self->deque.erase(static_cast<size_t>(index));
+    self->modCount++;
+    SAFE_DECREF(item);
+    Py_RETURN_NONE;
+}
+
+static PyObject *ObjectArrayDeque_insert(PyObject *pySelf, PyObject *args) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    Py_ssize_t index;
+    PyObject *object;
+
+    if (!PyArg_ParseTuple(args, "nO", &index, &object)) {
+        return nullptr;
+    }
+
+    // fix index
+    const auto size = static_cast<Py_ssize_t>(self->deque.size());
+    if (index < 0) {
+        index = std::max(static_cast<Py_ssize_t>(0), size + index);
+    } else if (index > size) {
+        index = size;
+    }
+
+    try {
+        self->deque.insert(static_cast<size_t>(index), object);
+        Py_INCREF(object);
+        self->modCount++;
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t ObjectArrayDeque_len(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    return static_cast<Py_ssize_t>(self->deque.size());
+}
+
+static PyObject *ObjectArrayDeque_iter(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    auto iter = ObjectArrayDequeIter_create(self);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *ObjectArrayDeque_reversed(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    auto iter = ObjectArrayDequeIter_create(self, true);
+    if (iter == nullptr) return PyErr_NoMemory();
+    return reinterpret_cast<PyObject *>(iter);
+}
+
+static PyObject *ObjectArrayDeque_getitem(PyObject *pySelf, Py_ssize_t index) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    const auto size = static_cast<Py_ssize_t>(self->deque.size());
+    if (index < 0) {
+        index += size;
+    }
+    if (index < 0 || index >= size) {
+        PyErr_SetString(PyExc_IndexError, "deque index out of range");
+        return nullptr;
+    }
+
+    PyObject *item = self->deque[static_cast<size_t>(index)];
+    Py_INCREF(item);
+    return item;
+}
+
+static int ObjectArrayDeque_setitem(PyObject *pySelf, Py_ssize_t index, PyObject *pyValue) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    const auto size = static_cast<Py_ssize_t>(self->deque.size());
+    if (index < 0) {
+        index += size;
+    }
+    if (index < 0 || index >= size) {
+        PyErr_SetString(PyExc_IndexError, "deque index out of range");
+        return -1;
+    }
+
+    PyObject *old = self->deque[static_cast<size_t>(index)];
+    if (pyValue == nullptr) {
+        self->deque.erase(static_cast<size_t>(index));
+        self->modCount++;
+    } else {
+        Py_INCREF(pyValue);
+        self->deque[static_cast<size_t>(index)] = pyValue;
+    }
+    SAFE_DECREF(old);
+    return 0;
+}
+
+static int ObjectArrayDeque_contains(PyObject *pySelf, PyObject *key) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    const Py_ssize_t index = ObjectArrayDeque_find(self, 0, self->deque.size(), key);
+    if (index == -1) return -1;
+    return static_cast<size_t>(index) != self->deque.size();
+}
+
+static PyObject *ObjectArrayDeque_add(PyObject *pySelf, PyObject *pyValue) {
+    if (Py_TYPE(pyValue) != &ObjectArrayDequeType) {
+        PyErr_Format(PyExc_TypeError, "can only concatenate ObjectArrayDeque (not \"%.200s\") to ObjectArrayDeque",
+                     Py_TYPE(pyValue)->tp_name);
+        return nullptr;
+    }
+
+    auto *result = reinterpret_cast<ObjectArrayDeque *>(ObjectArrayDeque_copy(pySelf));
+    if (result == nullptr) return nullptr;
+
+    if (!ObjectArrayDeque_extendFrom(result, pyValue, false)) {
+        SAFE_DECREF(result);
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *ObjectArrayDeque_iadd(PyObject *pySelf, PyObject *iterable) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    if (!ObjectArrayDeque_extendFrom(self, iterable, false)) return nullptr;
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+/**
+ * Append the elements of the deque to it until it holds them n times.
+ */
+static void repeat(ObjectArrayDeque *self, Py_ssize_t n) {
+    if (n <= 0) {
+        ObjectArrayDeque_release(self);
+        return;
+    }
+
+    auto &deque = self->deque;
+    std::vector<PyObject *> items(deque.size());
+    deque.popFront(items.data(), items.size());
+    deque.reserve(items.size() * static_cast<size_t>(n));
+    deque.append(items.data(), items.size());
+    for (Py_ssize_t i = 1; i < n; ++i) {
+        for (PyObject *item: items) {
+            Py_INCREF(item);
+        }
+        deque.append(items.data(), items.size());
+    }
+    self->modCount++;
+}
+
+static PyObject *ObjectArrayDeque_mul(PyObject *pySelf, Py_ssize_t n) {
+    auto *result = reinterpret_cast<ObjectArrayDeque *>(ObjectArrayDeque_copy(pySelf));
+    if (result == nullptr) return nullptr;
+
+    try {
+        repeat(result, n);
+    } catch (const std::exception &e) {
+        SAFE_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+    return reinterpret_cast<PyObject *>(result);
+}
+
+static PyObject *ObjectArrayDeque_imul(PyObject *pySelf, Py_ssize_t n) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    try {
+        repeat(self, n);
+    } catch (const std::exception &e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        return nullptr;
+    }
+
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static __forceinline PyObject *ObjectArrayDeque_eq(PyObject *pySelf, PyObject *pyValue) {
+    auto *self = reinterpret_cast<ObjectArrayDeque *>(pySelf);
+
+    if (!PySequence_Check(pyValue))
+        Py_RETURN_NOTIMPLEMENTED;
+
+    const Py_ssize_t size = PySequence_Size(pyValue);
+    if (size < 0) return nullptr;
+    if (static_cast<size_t>(size) != self->deque.size())
+        Py_RETURN_FALSE;
+
+    const uint64_t modCount = self->modCount;
+    for (Py_ssize_t i = 0; i < size; i++) {
+        PyObject *item = PySequence_GetItem(pyValue, i);
+        if (item == nullptr) return nullptr;
+        if (UNLIKELY(self->modCount != modCount)) {
+            SAFE_DECREF(item);
+            PyErr_SetString(PyExc_RuntimeError, "ObjectArrayDeque mutated during iteration");
+            return nullptr;
+        }
+
+        PyObject *selfItem = self->deque[static_cast<size_t>(i)];
+        Py_INCREF(selfItem);
+
+        // compare
+        const int cmpResult = PyObject_RichCompareBool(selfItem, item, Py_EQ);
+        SAFE_DECREF(selfItem);
+        SAFE_DECREF(item);
+        if (cmpResult < 0) {
+            return nullptr;
+        }
+
+        if (cmpResult == 0) {
+            Py_RETURN_FALSE;
+        }
+        if (UNLIKELY(self->modCount != modCount)) {
+            PyErr_SetString(PyExc_RuntimeError, "ObjectArrayDeque mutated during iteration");
+            return nullptr;
+        }
+    }
+
+    Py_RETURN_TRUE;
+}
+
+static PyObject *ObjectArrayDeque_compare(PyObject *pySelf, PyObject *pyValue, int op) {
+    PyObject *isEq;
+    switch (op) {
+        case Py_EQ:  // ==
+            return ObjectArrayDeque_eq(pySelf, pyValue);
+        case Py_NE:  // !=
+            isEq = ObjectArrayDeque_eq(pySelf, pyValue);
+            if (isEq == nullptr || isEq == Py_NotImplemented)
+                return isEq;
+            if (isEq == Py_True) {
+                SAFE_DECREF(isEq);
+                Py_RETURN_FALSE;
+            } else {
+                SAFE_DECREF(isEq);
+                Py_RETURN_TRUE;
+            }
+        default:
+            Py_RETURN_NOTIMPLEMENTED;
+    }
+}
+
+#ifdef IS_PYTHON_39_OR_LATER
+static PyObject *ObjectArrayDeque_class_getitem(PyObject *cls, PyObject *item) {
+    return Py_GenericAlias(cls, item);
+}
+#endif
+
+static PyObject *ObjectArrayDeque_repr(PyObject *pySelf) {
+    // a deque may hold itself
+    const int status = Py_ReprEnter(pySelf);
+    if (status != 0) {
+        return status > 0 ? PyUnicode_FromString("[...]") : nullptr;
+    }
+
+    PyObject *list = ObjectArrayDeque_to_list(pySelf);
+    PyObject *result = list != nullptr ? PyObject_Repr(list) : nullptr;
+    Py_XDECREF(list);
+    Py_ReprLeave(pySelf);
+    return result;
+}
+
+static PyMethodDef ObjectArrayDeque_methods[] = {
+        {"to_list", (PyCFunction) ObjectArrayDeque_to_list, METH_NOARGS},
+        {"copy", (PyCFunction) ObjectArrayDeque_copy, METH_NOARGS},
+        {"append", (PyCFunction) ObjectArrayDeque_append, METH_O},
+        {"appendleft", (PyCFunction) ObjectArrayDeque_appendleft, METH_O},
+        {"pop", (PyCFunction) ObjectArrayDeque_pop, METH_NOARGS},
+        {"popleft", (PyCFunction) ObjectArrayDeque_popleft, METH_NOARGS},
+        {"extend", (PyCFunction) ObjectArrayDeque_extend, METH_O},
+        {"extendleft", (PyCFunction) ObjectArrayDeque_extendleft, METH_O},
+        {"drain", (PyCFunction) ObjectArrayDeque_drain, METH_FASTCALL},
+        {"rotate", (PyCFunction) ObjectArrayDeque_rotate, METH_FASTCALL},
+        {"reverse", (PyCFunction) ObjectArrayDeque_reverse, METH_NOARGS},
+        {"clear", (PyCFunction) ObjectArrayDeque_clear, METH_NOARGS},
+        {"index", (PyCFunction) ObjectArrayDeque_index, METH_VARARGS},
+        {"count", (PyCFunction) ObjectArrayDeque_count, METH_O},
+        {"remove", (PyCFunction) ObjectArrayDeque_remove, METH_O},
+        {"insert", (PyCFunction) ObjectArrayDeque_insert, METH_VARARGS},
+        {"__reversed__", (PyCFunction) ObjectArrayDeque_reversed, METH_NOARGS},
+#ifdef IS_PYTHON_39_OR_LATER
+        {"__class_getitem__", (PyCFunction) ObjectArrayDeque_class_getitem, METH_O | METH_CLASS},
+#endif
+        {nullptr}
+};
+
+static struct PyModuleDef ObjectArrayDeque_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.ObjectArrayDeque",
+        "An ObjectArrayDeque_module that creates an ObjectArrayDeque",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+static PySequenceMethods ObjectArrayDeque_asSequence = {
+        ObjectArrayDeque_len,
+        ObjectArrayDeque_add,
+        ObjectArrayDeque_mul,
+        ObjectArrayDeque_getitem,
+        nullptr,
+        ObjectArrayDeque_setitem,
+        nullptr,
+        ObjectArrayDeque_contains,
+        ObjectArrayDeque_iadd,
+        ObjectArrayDeque_imul
+};
+
+void initializeObjectArrayDequeType(PyTypeObject &type) {
+    type.tp_name = "ObjectArrayDeque";
+    type.tp_basicsize = sizeof(ObjectArrayDeque);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC;
+    type.tp_as_sequence = &ObjectArrayDeque_asSequence;
+    type.tp_iter = ObjectArrayDeque_iter;
+    type.tp_methods = ObjectArrayDeque_methods;
+    type.tp_init = (initproc) ObjectArrayDeque_init;
+    type.tp_new = ObjectArrayDeque_pyNew;
+    type.tp_dealloc = (destructor) ObjectArrayDeque_dealloc;
+    type.tp_traverse = (traverseproc) ObjectArrayDeque_traverse;
+    type.tp_clear = (inquiry) ObjectArrayDeque_clear_refs;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_GC_Del;
+    type.tp_hash = PyObject_HashNotImplemented;
+    type.tp_richcompare = ObjectArrayDeque_compare;
+    type.tp_repr = ObjectArrayDeque_repr;
+    type.tp_str = ObjectArrayDeque_repr;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_ObjectArrayDeque() {
+    initializeObjectArrayDequeType(ObjectArrayDequeType);
+    if (PyType_Ready(&ObjectArrayDequeType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&ObjectArrayDeque_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&ObjectArrayDequeType);
+    if (PyModule_AddObject(object, "ObjectArrayDeque", (PyObject *) &ObjectArrayDequeType) < 0) {
+        Py_DECREF(&ObjectArrayDequeType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
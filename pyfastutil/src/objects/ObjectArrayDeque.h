@@ -0,0 +1,24 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#ifndef PYFASTUTIL_OBJECTARRAYDEQUE_H
+#define PYFASTUTIL_OBJECTARRAYDEQUE_H
+
+#include "utils/PythonPCH.h"
+#include "utils/RingBuffer.h"
+
+extern "C" {
+typedef struct ObjectArrayDeque {
+    PyObject_HEAD;
+    RingBuffer<PyObject *> deque;
+    // bumped by every change of the elements' positions, iterators use it to detect mutation
+    uint64_t modCount;
+} ObjectArrayDeque;
+
+extern PyTypeObject ObjectArrayDequeType;
+}
+
+PyMODINIT_FUNC PyInit_ObjectArrayDeque();
+
+#endif //PYFASTUTIL_OBJECTARRAYDEQUE_H
@@ -0,0 +1,113 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#include "ObjectArrayDequeIter.h"
+#include "utils/PythonUtils.h"
+
+extern "C" {
+
+static PyTypeObject ObjectArrayDequeIterType = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+};
+
+ObjectArrayDequeIter *ObjectArrayDequeIter_create(ObjectArrayDeque *deque, bool reversed) {
+    auto *instance = Py_CreateObjNoInit<ObjectArrayDequeIter>(ObjectArrayDequeIterType);
+    if (instance == nullptr) return nullptr;
+
+    Py_INCREF(deque);
+    instance->container = deque;
+    instance->index = reversed ? deque->deque.size() : 0;
+    instance->modCount = deque->modCount;
+    instance->reversed = reversed;
+
+    return instance;
+}
+
+static void ObjectArrayDequeIter_dealloc(ObjectArrayDequeIter *self) {
+    SAFE_DECREF(self->container);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static PyObject *ObjectArrayDequeIter_next(PyObject *pySelf) {
+    auto *self = reinterpret_cast<ObjectArrayDequeIter *>(pySelf);
+
+    // positions shift with every push and pop at the front, so there is nothing sensible to resume from
+    if (UNLIKELY(self->modCount != self->container->modCount)) {
+        PyErr_SetString(PyExc_RuntimeError, "ObjectArrayDeque mutated during iteration");
+        return nullptr;
+    }
+
+    const auto &deque = self->container->deque;
+    if (self->reversed) {
+        if (self->index == 0) {
+            PyErr_SetNone(PyExc_StopIteration);
+            return nullptr;
+        }
+        PyObject *item = deque[--self->index];
+        Py_INCREF(item);
+        return item;
+    }
+
+    if (self->index >= deque.size()) {
+        PyErr_SetNone(PyExc_StopIteration);
+        return nullptr;
+    }
+    PyObject *item = deque[self->index++];
+    Py_INCREF(item);
+    return item;
+}
+
+static PyObject *ObjectArrayDequeIter_iter(PyObject *pySelf) {
+    Py_INCREF(pySelf);
+    return pySelf;
+}
+
+static PyMethodDef ObjectArrayDequeIter_methods[] = {
+        {nullptr}
+};
+
+static struct PyModuleDef ObjectArrayDequeIter_module = {
+        PyModuleDef_HEAD_INIT,
+        "__pyfastutil.ObjectArrayDequeIter",
+        "An ObjectArrayDequeIter_module that creates an ObjectArrayDequeIter",
+        -1,
+        nullptr, nullptr, nullptr, nullptr, nullptr
+};
+
+void initializeObjectArrayDequeIterType(PyTypeObject &type) {
+    type.tp_name = "ObjectArrayDequeIter";
+    type.tp_basicsize = sizeof(ObjectArrayDequeIter);
+    type.tp_itemsize = 0;
+    type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
+    type.tp_iter = ObjectArrayDequeIter_iter;
+    type.tp_iternext = ObjectArrayDequeIter_next;
+    type.tp_methods = ObjectArrayDequeIter_methods;
+    type.tp_dealloc = (destructor) ObjectArrayDequeIter_dealloc;
+    type.tp_alloc = PyType_GenericAlloc;
+    type.tp_free = PyObject_Del;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
+PyMODINIT_FUNC PyInit_ObjectArrayDequeIter() {
+    initializeObjectArrayDequeIterType(ObjectArrayDequeIterType);
+    if (PyType_Ready(&ObjectArrayDequeIterType) < 0)
+        return nullptr;
+
+    PyObject *object = PyModule_Create(&ObjectArrayDequeIter_module);
+    if (object == nullptr)
+        return nullptr;
+
+    Py_INCREF(&ObjectArrayDequeIterType);
+    if (PyModule_AddObject(object, "ObjectArrayDequeIter", (PyObject *) &ObjectArrayDequeIterType) < 0) {
+        Py_DECREF(&ObjectArrayDequeIterType);
+        Py_DECREF(object);
+        return nullptr;
+    }
+
+    return object;
+}
+#pragma clang diagnostic pop
+
+}
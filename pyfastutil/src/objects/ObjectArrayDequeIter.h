@@ -0,0 +1,26 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#ifndef PYFASTUTIL_OBJECTARRAYDEQUEITER_H
+#define PYFASTUTIL_OBJECTARRAYDEQUEITER_H
+
+#include "utils/PythonPCH.h"
+#include "ObjectArrayDeque.h"
+
+extern "C" {
+typedef struct ObjectArrayDequeIter {
+    PyObject_HEAD;
+    ObjectArrayDeque *container;
+    size_t index;  // reversed, the count of elements left to return
+    uint64_t modCount;
+    bool reversed;
+} ObjectArrayDequeIter;
+
+ObjectArrayDequeIter *ObjectArrayDequeIter_create(ObjectArrayDeque *deque, bool reversed = false);
+
+}
+
+PyMODINIT_FUNC PyInit_ObjectArrayDequeIter();
+
+#endif //PYFASTUTIL_OBJECTARRAYDEQUEITER_H
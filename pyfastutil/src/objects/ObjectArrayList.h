@@ -13,6 +13,8 @@ typedef struct ObjectArrayList {
     PyObject_HEAD;
     std::vector<PyObject *> vector;
 } ObjectArrayList;
+
+extern PyTypeObject ObjectArrayListType;
 }
 
 PyMODINIT_FUNC PyInit_ObjectArrayList();
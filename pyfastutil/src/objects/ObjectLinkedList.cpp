@@ -3,7 +3,7 @@
 //
 
 #include "ObjectLinkedList.h"
-#include <list>
+#include <vector>
 #include <algorithm>
 #include <stdexcept>
 #include "utils/PythonUtils.h"
@@ -13,7 +13,6 @@
 #include "utils/memory/AlignedAllocator.h"
 #include "objects/ObjectLinkedListIter.h"
 #include "utils/include/CPythonSort.h"
-#include "utils/Utils.h"
 
 extern "C" {
 static PyTypeObject ObjectLinkedListType = {
@@ -21,7 +20,7 @@ static PyTypeObject ObjectLinkedListType = {
 };
 
 static int ObjectLinkedList_init(ObjectLinkedList *self, PyObject *args, PyObject *kwargs) {
-    new(&self->list) std::list<PyObject *>();
+    new(&self->list) UnrolledList<PyObject *>();
     self->modCount = 0;
 
     PyObject *pyIterable = nullptr;
@@ -84,7 +83,7 @@ static void ObjectLinkedList_dealloc(ObjectLinkedList *self) {
     for (PyObject *item: self->list) {
         SAFE_DECREF(item);
     }
-    self->list.~list();
+    self->list.~UnrolledList();
     Py_TYPE(self)->tp_free((PyObject *) self);
 }
 
@@ -235,10 +234,11 @@ static PyObject *ObjectLinkedList_pop(PyObject *pySelf, PyObject *const *args, c
         return popped;
     }
 
-    auto popped = at(self->list, index);
+    auto popped = self->list.at(static_cast<size_t>(index));
+    PyObject *value = *popped;
     self->list.erase(popped);
     self->modCount++;
-    return *popped;
+    return value;
 }
 
 static PyObject *ObjectLinkedList_index(PyObject *pySelf, PyObject *args) {
@@ -271,15 +271,15 @@ static PyObject *ObjectLinkedList_index(PyObject *pySelf, PyObject *args) {
         return nullptr;
     }
 
-    auto stopIter = at(self->list, stop);
-    auto it = std::find(at(self->list, start), stopIter, value);
+    auto stopIter = self->list.at(static_cast<size_t>(stop));
+    auto it = std::find(self->list.at(static_cast<size_t>(start)), stopIter, value);
 
     if (it == stopIter) {
         PyErr_SetString(PyExc_ValueError, "Value is not in list.");
         return nullptr;
     }
 
-    Py_ssize_t index = std::distance(self->list.begin(), it);
+    Py_ssize_t index = static_cast<Py_ssize_t>(UnrolledList<PyObject *>::distance(self->list.begin(), it));
     return PyLong_FromSsize_t(index);
 }
 
@@ -316,7 +316,7 @@ static PyObject *ObjectLinkedList_insert(PyObject *pySelf, PyObject *args) {
 
     // do insert
     try {
-        self->list.insert(at(self->list, index), value);
+        self->list.insert(self->list.at(static_cast<size_t>(index)), value);
         Py_INCREF(value);
         self->modCount++;
     } catch (const std::exception &e) {
@@ -423,7 +423,7 @@ static PyObject *ObjectLinkedList_getitem(PyObject *pySelf, Py_ssize_t pyIndex)
     }
 
     try {
-        PyObject *item = *at(self->list, static_cast<size_t>(pyIndex));
+        PyObject *item = *self->list.at(static_cast<size_t>(pyIndex));
         Py_INCREF(item);
         return item;
     } catch (const std::exception &e) {
@@ -457,7 +457,7 @@ static PyObject *ObjectLinkedList_getitem_slice(PyObject *pySelf, PyObject *slic
 
     for (Py_ssize_t i = 0; i < sliceLength; i++) {
         Py_ssize_t index = start + i * step;
-        PyObject *item = *at(self->list, static_cast<size_t>(index));
+        PyObject *item = *self->list.at(static_cast<size_t>(index));
         Py_INCREF(item);
         if (item == nullptr) {
             SAFE_DECREF(result);
@@ -483,16 +483,17 @@ static int ObjectLinkedList_setitem(PyObject *pySelf, Py_ssize_t pyIndex, PyObje
 
     try {
         if (pyValue == nullptr) {
-            auto iter = at(self->list, static_cast<size_t>(pyIndex));
+            auto iter = self->list.at(static_cast<size_t>(pyIndex));
             SAFE_DECREF(*iter);
             self->list.erase(iter);
+            self->modCount++;
         } else {
             PyObject *value = pyValue;
             if (PyErr_Occurred()) {
                 return -1;
             }
 
-            *at(self->list, static_cast<size_t>(pyIndex)) = value;
+            *self->list.at(static_cast<size_t>(pyIndex)) = value;
             Py_INCREF(value);
         }
     } catch (const std::exception &e) {
@@ -521,6 +522,36 @@ static int ObjectLinkedList_setitem_slice(PyObject *pySelf, PyObject *slice, PyO
 
     sliceLength = PySlice_AdjustIndices(static_cast<Py_ssize_t>(self->list.size()), &start, &stop, step);
 
+    if (value == nullptr) {  // del list[start:stop:step]
+        if (sliceLength == 0) {
+            return 0;
+        }
+
+        try {
+            if (step == 1) {
+                const auto first = self->list.at(static_cast<size_t>(start));
+                const auto last = self->list.at(static_cast<size_t>(stop));
+                for (auto iter = first; iter != last; ++iter) {
+                    SAFE_DECREF(*iter);
+                }
+                self->list.erase(first, last);
+            } else {
+                // erase the highest index first, so the indices left to erase stay put
+                for (Py_ssize_t i = 0; i < sliceLength; i++) {
+                    const Py_ssize_t index = step > 0 ? start + (sliceLength - 1 - i) * step : start + i * step;
+                    const auto iter = self->list.at(static_cast<size_t>(index));
+                    SAFE_DECREF(*iter);
+                    self->list.erase(iter);
+                }
+            }
+            self->modCount++;
+        } catch (const std::exception &e) {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return -1;
+        }
+        return 0;
+    }
+
     if (!PySequence_Check(value)) {
         PyErr_SetString(PyExc_TypeError, "can only assign an iterable");
         return -1;
@@ -531,29 +562,39 @@ static int ObjectLinkedList_setitem_slice(PyObject *pySelf, PyObject *slice, PyO
         return -1;
     }
 
+    if (step != 1 && newLength != sliceLength) {
+        PyErr_Format(PyExc_ValueError, "attempt to assign sequence of size %zd to extended slice of size %zd",
+                     newLength, sliceLength);
+        return -1;
+    }
+
     PyObject *item = nullptr;
     try {
         if (newLength < sliceLength) {
-            auto iter = at(self->list, static_cast<size_t>(start + newLength * step));
+            auto iter = self->list.at(static_cast<size_t>(start + newLength * step));
             for (Py_ssize_t i = newLength; i < sliceLength; i++) {
                 SAFE_DECREF(*iter);
                 iter = self->list.erase(iter);
             }
+            self->modCount++;
         } else if (newLength > sliceLength) {
-            auto iter = at(self->list, static_cast<size_t>(stop));
+            // stop may be before start for an empty slice, python inserts at start then
+            auto iter = self->list.at(static_cast<size_t>(start + sliceLength));
             for (Py_ssize_t i = sliceLength; i < newLength; i++) {
                 item = PySequence_GetItem(value, i);
                 if (item == nullptr) {
                     return -1;
                 }
+                // every insertion invalidates the iterators, go on from the returned one
                 iter = self->list.insert(iter, item);
                 ++iter;
             }
+            self->modCount++;
         }
 
         for (Py_ssize_t i = 0; i < newLength; i++) {
             Py_ssize_t index = start + i * step;
-            auto iter = at(self->list, static_cast<size_t>(index));
+            auto iter = self->list.at(static_cast<size_t>(index));
 
             item = PySequence_GetItem(value, i);
             if (item == nullptr) {
@@ -621,7 +662,9 @@ static PyObject *ObjectLinkedList_iadd(PyObject *pySelf, PyObject *iterable) {
             Py_INCREF(item);
         }
         self->list.insert(self->list.end(), iter->list.begin(), iter->list.end());
-        Py_RETURN_NONE;
+        self->modCount++;
+        Py_INCREF(pySelf);
+        return pySelf;
     }
 
     // python iterable extend
@@ -642,6 +685,7 @@ static PyObject *ObjectLinkedList_iadd(PyObject *pySelf, PyObject *iterable) {
 
         self->list.push_back(value);
     }
+    self->modCount++;
 
     if (PyErr_Occurred()) {
         SAFE_DECREF(iter);
@@ -671,9 +715,10 @@ static PyObject *ObjectLinkedList_mul(PyObject *pySelf, Py_ssize_t n) {
     }
 
     try {
+        const std::vector<PyObject *> values(self->list.begin(), self->list.end());
         for (Py_ssize_t i = 0; i < n; ++i) {
-            for (const auto obj: self->list) {
-                result->list.push_back(obj);
+            result->list.append(values.data(), values.size());
+            for (PyObject *obj: values) {
                 Py_INCREF(obj);
             }
         }
@@ -709,17 +754,20 @@ static PyObject *ObjectLinkedList_imul(PyObject *pySelf, Py_ssize_t n) {
 
     try {
         if (n == 0) {
+            for (PyObject *item: self->list) {
+                SAFE_DECREF(item);
+            }
             self->list.clear();
         } else {
-            const auto size = self->list.size();
+            const std::vector<PyObject *> values(self->list.begin(), self->list.end());
             for (Py_ssize_t i = 1; i < n; ++i) {
-                auto iter = self->list.begin();
-                for (size_t j = 0; j < size; ++j, ++iter) {
-                    self->list.push_back(*iter);
-                    Py_INCREF(*iter);
+                self->list.append(values.data(), values.size());
+                for (PyObject *obj: values) {
+                    Py_INCREF(obj);
                 }
             }
         }
+        self->modCount++;
 
         Py_INCREF(pySelf);
         return pySelf;
@@ -762,7 +810,7 @@ static PyObject *ObjectLinkedList_reverse(PyObject *pySelf) {
     auto *self = reinterpret_cast<ObjectLinkedList *>(pySelf);
 
     Py_BEGIN_ALLOW_THREADS
-        std::reverse(self->list.begin(), self->list.end());
+        self->list.reverse();
     Py_END_ALLOW_THREADS
     Py_RETURN_NONE;
 }
@@ -774,6 +822,7 @@ static PyObject *ObjectLinkedList_clear(PyObject *pySelf) {
         SAFE_DECREF(item);
     }
     self->list.clear();
+    self->modCount++;
     Py_RETURN_NONE;
 }
 
@@ -1119,6 +1168,8 @@ void initializeObjectLinkedListType(PyTypeObject &type) {
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_ObjectLinkedList() {
     initializeObjectLinkedListType(ObjectLinkedListType);
+    if (PyType_Ready(&ObjectLinkedListType) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&ObjectLinkedList_module);
     if (object == nullptr)
@@ -6,12 +6,12 @@
 #define PYFASTUTIL_OBJECTLINKEDLIST_H
 
 #include "utils/PythonPCH.h"
-#include <list>
+#include "utils/UnrolledList.h"
 
 extern "C" {
 typedef struct ObjectLinkedList {
     PyObject_HEAD;
-    std::list<PyObject *> list;
+    UnrolledList<PyObject *> list;
     uint64_t modCount;
 } ObjectLinkedList;
 }
@@ -13,7 +13,7 @@ typedef struct ObjectLinkedListIter { // NOLINT(*-pro-type-member-init)
     PyObject_HEAD;
     ObjectLinkedList *container;
     size_t index;
-    std::list<PyObject *>::iterator cacheIter;
+    UnrolledList<PyObject *>::iterator cacheIter;
     uint64_t cacheModCount;
     bool reversed;
 } ObjectLinkedListIter;
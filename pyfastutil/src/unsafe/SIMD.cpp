@@ -135,8 +135,8 @@ static PyObject *SIMD_isArmNeonSupported([[maybe_unused]] PyObject *pySelf) noex
     Py_RETURN_BOOL(simd::IS_ARM_NEON_SUPPORTED)
 }
 
-static PyObject *SIMD_setAVX512Vector32([[maybe_unused]] PyObject *pySelf,
-                                        PyObject *const *args, Py_ssize_t nargs) noexcept {
+static SIMD_TARGET_AVX512 PyObject *SIMD_setAVX512Vector32([[maybe_unused]] PyObject *pySelf,
+                                                           PyObject *const *args, Py_ssize_t nargs) noexcept {
 #if !defined(__arm__) && !defined(__arm64__)
     if (nargs != 17) {
         PyErr_SetString(PyExc_TypeError, "Function takes exactly 17 arguments (__ptr, ...)");
@@ -157,8 +157,8 @@ static PyObject *SIMD_setAVX512Vector32([[maybe_unused]] PyObject *pySelf,
 #endif
 }
 
-static PyObject *SIMD_setAVX512Vector16([[maybe_unused]] PyObject *pySelf,
-                                        PyObject *const *args, Py_ssize_t nargs) noexcept {
+static SIMD_TARGET_AVX512 PyObject *SIMD_setAVX512Vector16([[maybe_unused]] PyObject *pySelf,
+                                                           PyObject *const *args, Py_ssize_t nargs) noexcept {
 #if !defined(__arm__) && !defined(__arm64__)
     if (nargs != 33) {
         PyErr_SetString(PyExc_TypeError, "Function takes exactly 33 arguments (__ptr, ...)");
@@ -183,8 +183,8 @@ static PyObject *SIMD_setAVX512Vector16([[maybe_unused]] PyObject *pySelf,
 #endif
 }
 
-static PyObject *SIMD_setAVX512Vector8([[maybe_unused]] PyObject *pySelf,
-                                       PyObject *const *args, Py_ssize_t nargs) noexcept {
+static SIMD_TARGET_AVX512 PyObject *SIMD_setAVX512Vector8([[maybe_unused]] PyObject *pySelf,
+                                                          PyObject *const *args, Py_ssize_t nargs) noexcept {
 #if !defined(__arm__) && !defined(__arm64__)
     if (nargs != 65) {
         PyErr_SetString(PyExc_TypeError, "Function takes exactly 65 arguments (__ptr, ...)");
@@ -217,8 +217,8 @@ static PyObject *SIMD_setAVX512Vector8([[maybe_unused]] PyObject *pySelf,
 #endif
 }
 
-static PyObject *SIMD_setAVX2Vector32([[maybe_unused]] PyObject *pySelf,
-                                      PyObject *const *args, Py_ssize_t nargs) noexcept {
+static SIMD_TARGET_AVX2 PyObject *SIMD_setAVX2Vector32([[maybe_unused]] PyObject *pySelf,
+                                                       PyObject *const *args, Py_ssize_t nargs) noexcept {
 #if !defined(__arm__) && !defined(__arm64__)
     if (nargs != 9) {
         PyErr_SetString(PyExc_TypeError, "Function takes exactly 9 arguments (__ptr, ...)");
@@ -237,8 +237,8 @@ static PyObject *SIMD_setAVX2Vector32([[maybe_unused]] PyObject *pySelf,
 #endif
 }
 
-static PyObject *SIMD_setAVX2Vector16([[maybe_unused]] PyObject *pySelf,
-                                      PyObject *const *args, Py_ssize_t nargs) noexcept {
+static SIMD_TARGET_AVX2 PyObject *SIMD_setAVX2Vector16([[maybe_unused]] PyObject *pySelf,
+                                                       PyObject *const *args, Py_ssize_t nargs) noexcept {
 #if !defined(__arm__) && !defined(__arm64__)
     if (nargs != 17) {
         PyErr_SetString(PyExc_TypeError, "Function takes exactly 17 arguments (__ptr, ...)");
@@ -259,8 +259,8 @@ static PyObject *SIMD_setAVX2Vector16([[maybe_unused]] PyObject *pySelf,
 #endif
 }
 
-static PyObject *SIMD_setAVX2Vector8([[maybe_unused]] PyObject *pySelf,
-                                     PyObject *const *args, Py_ssize_t nargs) noexcept {
+static SIMD_TARGET_AVX2 PyObject *SIMD_setAVX2Vector8([[maybe_unused]] PyObject *pySelf,
+                                                      PyObject *const *args, Py_ssize_t nargs) noexcept {
 #if !defined(__arm__) && !defined(__arm64__)
     if (nargs != 33) {
         PyErr_SetString(PyExc_TypeError, "Function takes exactly 33 arguments (__ptr, ...)");
@@ -402,6 +402,8 @@ static struct PyModuleDef SIMD_module = {
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_SIMD() {
     initializeSIMDType(SIMDType);
+    if (PyType_Ready(&SIMDType) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&SIMD_module);
     if (object == nullptr)
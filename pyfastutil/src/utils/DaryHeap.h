@@ -0,0 +1,342 @@
+//
+// Created by xia__mc on 2024/12/25.
+//
+
+#ifndef PYFASTUTIL_DARYHEAP_H
+#define PYFASTUTIL_DARYHEAP_H
+
+#include <cstddef>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "Compat.h"
+#include "utils/memory/AlignedAllocator.h"
+#include "utils/memory/PreFetch.h"
+
+/**
+ * The keys of an Arity-ary min heap, and the sifts the heaps below share.
+ * Node i has children Arity * i + 1 ... Arity * i + Arity, so a heap of n keys is log_Arity(n) levels deep,
+ * half as deep as a binary heap for Arity = 4, and a sift down compares a whole sibling group per level.
+ *
+ * The root is stored at Arity - 1, which puts every sibling group at a multiple of Arity in the 64 byte aligned
+ * storage: a group is one cache line (or less) and never straddles two.
+ */
+template<typename K, size_t Arity>
+class DaryHeapKeys {
+    static_assert(Arity >= 2 && (Arity & (Arity - 1)) == 0, "Arity must be a power of two");
+
+protected:
+    static constexpr size_t PADDING = Arity - 1;
+
+    std::vector<K, AlignedAllocator<K, 64>> keys = std::vector<K, AlignedAllocator<K, 64>>(PADDING);
+
+    __forceinline K *heap() {
+        return keys.data() + PADDING;
+    }
+
+    __forceinline const K *heap() const {
+        return keys.data() + PADDING;
+    }
+
+    /**
+     * Move the hole at index up until key fits in it, calling move(to, from) for every key moved down.
+     * @return the index key was placed at
+     */
+    template<typename Move>
+    size_t siftUp(size_t hole, const K key, Move move) {
+        K *data = heap();
+        while (hole > 0) {
+            const size_t parent = (hole - 1) / Arity;
+            if (!(key < data[parent])) {
+                break;
+            }
+            data[hole] = data[parent];
+            move(hole, parent);
+            hole = parent;
+        }
+        data[hole] = key;
+        return hole;
+    }
+
+    /**
+     * Move the hole at index down until key fits in it, calling move(to, from) for every key moved up.
+     * @return the index key was placed at
+     */
+    template<typename Move>
+    size_t siftDown(size_t hole, const K key, Move move) {
+        K *data = heap();
+        const size_t size = this->size();
+        while (true) {
+            const size_t first = hole * Arity + 1;
+            if (first >= size) {
+                break;
+            }
+
+            // the grandchildren are the next level whichever child wins
+            prefetchL1(data + std::min(first * Arity + 1, size - 1));
+
+            const size_t last = std::min(first + Arity, size);
+            size_t best = first;
+            for (size_t child = first + 1; child < last; child++) {
+                if (data[child] < data[best]) {
+                    best = child;
+                }
+            }
+
+            if (!(data[best] < key)) {
+                break;
+            }
+            data[hole] = data[best];
+            move(hole, best);
+            hole = best;
+        }
+        data[hole] = key;
+        return hole;
+    }
+
+public:
+    [[nodiscard]] size_t size() const {
+        return keys.size() - PADDING;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return keys.size() == PADDING;
+    }
+
+    [[nodiscard]] const K &topKey() const {
+        return heap()[0];
+    }
+};
+
+/**
+ * A min heap of keys, each optionally paired with a value that travels with it.
+ * Keys and values are separate arrays, so the comparisons only ever touch keys.
+ * Unpaired heaps keep values empty.
+ */
+template<typename K, typename V, size_t Arity = 4>
+class DaryHeap : public DaryHeapKeys<K, Arity> {
+    using Base = DaryHeapKeys<K, Arity>;
+
+    /**
+     * Below this many pushed keys per key already in the heap, sifting each up beats rebuilding the heap.
+     */
+    static constexpr size_t HEAPIFY_RATIO = 4;
+
+public:
+    explicit DaryHeap(bool paired = false) : paired(paired) {
+    }
+
+    [[nodiscard]] bool isPaired() const {
+        return paired;
+    }
+
+    [[nodiscard]] const V &topValue() const {
+        return values[0];
+    }
+
+    void push(const K key, const V value = V()) {
+        this->keys.push_back(key);
+        if (paired) {
+            values.push_back(value);
+        }
+
+        const size_t index = siftUp(this->size() - 1, key);
+        if (paired) {
+            values[index] = value;
+        }
+    }
+
+    /**
+     * Push n keys, and n values if paired. Many keys at once are appended and heapified in O(size).
+     */
+    void pushAll(const K *newKeys, const V *newValues, size_t n) {
+        const size_t oldSize = this->size();
+        this->keys.insert(this->keys.end(), newKeys, newKeys + n);
+        if (paired) {
+            values.insert(values.end(), newValues, newValues + n);
+        }
+
+        if (n * HEAPIFY_RATIO >= oldSize) {
+            heapify();
+            return;
+        }
+        for (size_t i = oldSize; i < oldSize + n; i++) {
+            const V value = paired ? values[i] : V();
+            const size_t index = siftUp(i, this->heap()[i]);
+            if (paired) {
+                values[index] = value;
+            }
+        }
+    }
+
+    /**
+     * Remove the top key (and value). The heap must not be empty.
+     */
+    void pop() {
+        const K key = this->keys.back();
+        this->keys.pop_back();
+        if (this->empty()) {
+            values.clear();
+            return;
+        }
+
+        if (paired) {
+            const V value = values.back();
+            values.pop_back();
+            values[siftDown(0, key)] = value;
+        } else {
+            siftDown(0, key);
+        }
+    }
+
+    void clear() {
+        this->keys.resize(Base::PADDING);
+        values.clear();
+    }
+
+    void reserve(size_t n) {
+        this->keys.reserve(n + Base::PADDING);
+        if (paired) {
+            values.reserve(n);
+        }
+    }
+
+private:
+    std::vector<V> values;
+    bool paired;
+
+    size_t siftUp(size_t hole, const K key) {
+        if (paired) {
+            return Base::siftUp(hole, key, [this](size_t to, size_t from) { values[to] = values[from]; });
+        }
+        return Base::siftUp(hole, key, [](size_t, size_t) {});
+    }
+
+    size_t siftDown(size_t hole, const K key) {
+        if (paired) {
+            return Base::siftDown(hole, key, [this](size_t to, size_t from) { values[to] = values[from]; });
+        }
+        return Base::siftDown(hole, key, [](size_t, size_t) {});
+    }
+
+    /**
+     * Floyd's bottom up construction, sifting down every parent from the last.
+     */
+    void heapify() {
+        const size_t size = this->size();
+        if (size <= 1) {
+            return;
+        }
+
+        for (size_t i = (size - 2) / Arity + 1; i-- > 0;) {
+            const V value = paired ? values[i] : V();
+            const size_t index = siftDown(i, this->heap()[i]);
+            if (paired) {
+                values[index] = value;
+            }
+        }
+    }
+};
+
+/**
+ * A min heap of ids 0 ... n - 1 by key, which finds the heap position of any id in O(1),
+ * so an id's key can be decreased (or changed, or the id removed) in O(log n).
+ * The position table grows to the largest id pushed, ids are meant to be dense, like the nodes of a graph.
+ */
+template<typename K, size_t Arity = 4>
+class IndexedDaryHeap : public DaryHeapKeys<K, Arity> {
+    using Base = DaryHeapKeys<K, Arity>;
+
+public:
+    static constexpr size_t ABSENT = static_cast<size_t>(-1);
+
+    [[nodiscard]] size_t topId() const {
+        return ids[0];
+    }
+
+    [[nodiscard]] bool contains(size_t id) const {
+        return id < positions.size() && positions[id] != ABSENT;
+    }
+
+    /**
+     * The key of id, which must be in the heap.
+     */
+    [[nodiscard]] const K &keyOf(size_t id) const {
+        return this->heap()[positions[id]];
+    }
+
+    /**
+     * Push id, which must not be in the heap.
+     */
+    void push(size_t id, const K key) {
+        if (id >= positions.size()) {
+            positions.resize(id + 1, ABSENT);
+        }
+        this->keys.push_back(key);
+        ids.push_back(id);
+        place(siftUp(this->size() - 1, key), id);
+    }
+
+    /**
+     * Set the key of id, which must be in the heap, moving it up or down as needed.
+     */
+    void update(size_t id, const K key) {
+        const size_t index = positions[id];
+        if (key < this->heap()[index]) {
+            place(siftUp(index, key), id);
+        } else {
+            place(siftDown(index, key), id);
+        }
+    }
+
+    /**
+     * Remove id, which must be in the heap. The last key fills its place.
+     */
+    void remove(size_t id) {
+        const size_t index = positions[id];
+        positions[id] = ABSENT;
+
+        const K lastKey = this->keys.back();
+        const size_t lastId = ids.back();
+        this->keys.pop_back();
+        ids.pop_back();
+        if (index == this->size()) {
+            return;
+        }
+
+        positions[lastId] = index;
+        update(lastId, lastKey);
+    }
+
+    void clear() {
+        for (const size_t id: ids) {
+            positions[id] = ABSENT;
+        }
+        this->keys.resize(Base::PADDING);
+        ids.clear();
+    }
+
+private:
+    std::vector<size_t> ids;  // heap index -> id
+    std::vector<size_t> positions;  // id -> heap index, or ABSENT
+
+    __forceinline void place(size_t index, size_t id) {
+        ids[index] = id;
+        positions[id] = index;
+    }
+
+    __forceinline void moveId(size_t to, size_t from) {
+        ids[to] = ids[from];
+        positions[ids[to]] = to;
+    }
+
+    size_t siftUp(size_t hole, const K key) {
+        return Base::siftUp(hole, key, [this](size_t to, size_t from) { moveId(to, from); });
+    }
+
+    size_t siftDown(size_t hole, const K key) {
+        return Base::siftDown(hole, key, [this](size_t to, size_t from) { moveId(to, from); });
+    }
+};
+
+#endif //PYFASTUTIL_DARYHEAP_H
@@ -0,0 +1,89 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#ifndef PYFASTUTIL_FLOATBUFFER_H
+#define PYFASTUTIL_FLOATBUFFER_H
+
+#include <cstring>
+#include "utils/PythonPCH.h"
+#include "floats/FloatArrayList.h"
+#include "floats/DoubleArrayList.h"
+
+/**
+ * A read-only view over the elements of a FloatArrayList, a DoubleArrayList or any C-contiguous
+ * buffer of float32/float64, so bulk operations can run over them without boxing every element.
+ * Exactly one of floats and doubles is set after a successful FloatBuffer_open.
+ */
+struct FloatBuffer {
+    const float *floats = nullptr;
+    const double *doubles = nullptr;
+    size_t size = 0;
+    Py_buffer view{};
+    bool hasView = false;
+};
+
+/**
+ * Open a view over obj.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool FloatBuffer_open(PyObject *obj, FloatBuffer &buffer) noexcept {
+    if (Py_TYPE(obj) == &FloatArrayListType) {
+        const auto &vector = reinterpret_cast<FloatArrayList *>(obj)->vector;
+        buffer.floats = vector.data();
+        buffer.size = vector.size();
+        return true;
+    }
+
+    if (Py_TYPE(obj) == &DoubleArrayListType) {
+        const auto &vector = reinterpret_cast<DoubleArrayList *>(obj)->vector;
+        buffer.doubles = vector.data();
+        buffer.size = vector.size();
+        return true;
+    }
+
+    if (!PyObject_CheckBuffer(obj)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a FloatArrayList, a DoubleArrayList or a buffer of floats, got '%.200s'",
+                     Py_TYPE(obj)->tp_name);
+        return false;
+    }
+
+    if (PyObject_GetBuffer(obj, &buffer.view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+        return false;
+    }
+    buffer.hasView = true;
+
+    // native or little endian floats only, same as what numpy gives us on x86 and arm
+    const char *format = buffer.view.format == nullptr ? "B" : buffer.view.format;
+    if (*format == '@' || *format == '=' || *format == '<') {
+        format++;
+    }
+
+    if (strcmp(format, "f") == 0 && buffer.view.itemsize == sizeof(float)) {
+        buffer.floats = static_cast<const float *>(buffer.view.buf);
+    } else if (strcmp(format, "d") == 0 && buffer.view.itemsize == sizeof(double)) {
+        buffer.doubles = static_cast<const double *>(buffer.view.buf);
+    } else {
+        PyErr_Format(PyExc_TypeError, "expected a buffer of float32 or float64, got format '%s'", buffer.view.format);
+        PyBuffer_Release(&buffer.view);
+        buffer.hasView = false;
+        return false;
+    }
+
+    buffer.size = static_cast<size_t>(buffer.view.len / buffer.view.itemsize);
+    return true;
+}
+
+static __forceinline void FloatBuffer_release(FloatBuffer &buffer) noexcept {
+    if (buffer.hasView) {
+        PyBuffer_Release(&buffer.view);
+        buffer.hasView = false;
+    }
+    buffer.floats = nullptr;
+    buffer.doubles = nullptr;
+    buffer.size = 0;
+}
+
+#endif //PYFASTUTIL_FLOATBUFFER_H
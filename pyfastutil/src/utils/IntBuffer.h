@@ -0,0 +1,163 @@
+//
+// Created by xia__mc on 2024/12/2.
+//
+
+#ifndef PYFASTUTIL_INTBUFFER_H
+#define PYFASTUTIL_INTBUFFER_H
+
+#include <cstring>
+#include <vector>
+#include "utils/PythonPCH.h"
+#include "ints/IntArrayList.h"
+#include "ints/BigIntArrayList.h"
+
+/**
+ * A read-only view over the elements of an IntArrayList, a BigIntArrayList or any C-contiguous
+ * buffer of int32/int64, so bulk operations can run over them without boxing every element.
+ * Exactly one of ints and longs is set after a successful IntBuffer_open.
+ * An IntArrayList or BigIntArrayList stays pinned (it can't be resized) until IntBuffer_release.
+ */
+struct IntBuffer {
+    const int *ints = nullptr;
+    const long long *longs = nullptr;
+    size_t size = 0;
+    Py_buffer view{};
+    bool hasView = false;
+    // the pinned list and its export counter, if the view was taken from a list directly
+    PyObject *owner = nullptr;
+    Py_ssize_t *exports = nullptr;
+};
+
+/**
+ * Open a view over obj.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool IntBuffer_open(PyObject *obj, IntBuffer &buffer) noexcept {
+    if (Py_TYPE(obj) == &IntArrayListType) {
+        auto *list = reinterpret_cast<IntArrayList *>(obj);
+        buffer.ints = list->vector.data();
+        buffer.size = list->vector.size();
+        buffer.exports = &list->exports;
+        ++*buffer.exports;
+        Py_INCREF(obj);
+        buffer.owner = obj;
+        return true;
+    }
+
+    if (Py_TYPE(obj) == &BigIntArrayListType) {
+        auto *list = reinterpret_cast<BigIntArrayList *>(obj);
+        buffer.longs = list->vector.data();
+        buffer.size = list->vector.size();
+        buffer.exports = &list->exports;
+        ++*buffer.exports;
+        Py_INCREF(obj);
+        buffer.owner = obj;
+        return true;
+    }
+
+    if (!PyObject_CheckBuffer(obj)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected an IntArrayList, a BigIntArrayList or a buffer of ints, got '%.200s'",
+                     Py_TYPE(obj)->tp_name);
+        return false;
+    }
+
+    if (PyObject_GetBuffer(obj, &buffer.view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+        return false;
+    }
+    buffer.hasView = true;
+
+    // native or little endian ints only, same as what numpy gives us on x86 and arm
+    const char *format = buffer.view.format == nullptr ? "B" : buffer.view.format;
+    if (*format == '@' || *format == '=' || *format == '<') {
+        format++;
+    }
+
+    const bool isInteger = strlen(format) == 1 && strchr("ilq", *format) != nullptr;
+    if (isInteger && buffer.view.itemsize == sizeof(int)) {
+        buffer.ints = static_cast<const int *>(buffer.view.buf);
+    } else if (isInteger && buffer.view.itemsize == sizeof(long long)) {
+        buffer.longs = static_cast<const long long *>(buffer.view.buf);
+    } else {
+        PyErr_Format(PyExc_TypeError, "expected a buffer of int32 or int64, got format '%s'", buffer.view.format);
+        PyBuffer_Release(&buffer.view);
+        buffer.hasView = false;
+        return false;
+    }
+
+    buffer.size = static_cast<size_t>(buffer.view.len / buffer.view.itemsize);
+    return true;
+}
+
+/**
+ * Call func with every element of buffer, widened to long long for 64-bit buffers.
+ * No python API is used, so it's safe to call with the GIL released.
+ */
+template<typename Func>
+static __forceinline void IntBuffer_forEach(const IntBuffer &buffer, Func func) {
+    if (buffer.ints != nullptr) {
+        for (size_t i = 0; i < buffer.size; ++i) {
+            func(buffer.ints[i]);
+        }
+    } else {
+        for (size_t i = 0; i < buffer.size; ++i) {
+            func(buffer.longs[i]);
+        }
+    }
+}
+
+static __forceinline void IntBuffer_release(IntBuffer &buffer) noexcept {
+    if (buffer.hasView) {
+        PyBuffer_Release(&buffer.view);
+        buffer.hasView = false;
+    }
+    if (buffer.exports != nullptr) {
+        --*buffer.exports;
+        buffer.exports = nullptr;
+        Py_CLEAR(buffer.owner);
+    }
+    buffer.ints = nullptr;
+    buffer.longs = nullptr;
+    buffer.size = 0;
+}
+
+/**
+ * Copy the elements of an IntArrayList, a BigIntArrayList, an int buffer or any iterable of ints into result.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+[[maybe_unused]] static bool IntBuffer_collect(PyObject *obj, std::vector<long long> &result) {
+    if (Py_TYPE(obj) == &IntArrayListType || Py_TYPE(obj) == &BigIntArrayListType || PyObject_CheckBuffer(obj)) {
+        IntBuffer buffer;
+        if (!IntBuffer_open(obj, buffer)) {
+            return false;
+        }
+
+        result.reserve(buffer.size);
+        IntBuffer_forEach(buffer, [&result](long long value) { result.push_back(value); });
+        IntBuffer_release(buffer);
+        return true;
+    }
+
+    PyObject *iter = PyObject_GetIter(obj);
+    if (iter == nullptr) {
+        return false;
+    }
+
+    PyObject *item;
+    while ((item = PyIter_Next(iter)) != nullptr) {
+        const long long value = PyLong_AsLongLong(item);
+        Py_DECREF(item);
+        if (value == -1 && PyErr_Occurred()) {
+            Py_DECREF(iter);
+            return false;
+        }
+        result.push_back(value);
+    }
+    Py_DECREF(iter);
+
+    return !PyErr_Occurred();
+}
+
+#endif //PYFASTUTIL_INTBUFFER_H
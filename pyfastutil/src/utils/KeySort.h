@@ -0,0 +1,155 @@
+//
+// Created by xia__mc on 2024/12/16.
+//
+
+#ifndef PYFASTUTIL_KEYSORT_H
+#define PYFASTUTIL_KEYSORT_H
+
+#include <bit>
+#include <cmath>
+#include <climits>
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include "utils/PythonPCH.h"
+#include "utils/Permutation.h"
+#include "utils/simd/RadixSort.h"
+#include "utils/include/CPythonSort.h"
+
+/**
+ * Map a double to a long long with the same order, so float keys can go through the integer argsort.
+ * -0.0 becomes 0.0 first, Python considers them equal. NaN must not be passed.
+ */
+static __forceinline long long KeySort_orderedBits(double value) {
+    const auto bits = std::bit_cast<long long>(value == 0.0 ? 0.0 : value);
+    return bits < 0 ? bits ^ LLONG_MAX : bits;
+}
+
+/**
+ * Read keys as native long longs, if they are all ints that fit or all floats other than NaN.
+ * @return if all keys could be read
+ */
+static __forceinline bool KeySort_toNative(PyObject *const *keys, size_t size, std::vector<long long> &nativeKeys) {
+    if (size == 0) {
+        return true;
+    }
+
+    if (PyFloat_CheckExact(keys[0])) {
+        for (size_t i = 0; i < size; ++i) {
+            if (!PyFloat_CheckExact(keys[i])) {
+                return false;
+            }
+            const double value = PyFloat_AS_DOUBLE(keys[i]);
+            if (std::isnan(value)) {
+                return false;
+            }
+            nativeKeys[i] = KeySort_orderedBits(value);
+        }
+        return true;
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        // bool can't be subclassed, so it can't change how it compares either
+        if (!PyLong_CheckExact(keys[i]) && !PyBool_Check(keys[i])) {
+            return false;
+        }
+        int overflow;
+        nativeKeys[i] = PyLong_AsLongLongAndOverflow(keys[i], &overflow);
+        if (overflow != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Release the first count references of objects and free the array.
+ */
+static __forceinline void KeySort_freeObjects(PyObject **objects, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        Py_DECREF(objects[i]);
+    }
+    PyMem_Free(objects);
+}
+
+/**
+ * Sort vector in place like list.sort(key=keyFunc, reverse=reverse), calling keyFunc once per element.
+ * Keys that are all ints fitting a long long, or all floats, are sorted natively as (key, index) pairs,
+ * anything else goes through CPython_sort. The list is only changed if everything succeeds.
+ * If not successful, function will raise python exception.
+ * Throws std::bad_alloc if a buffer can't be allocated.
+ * @param box creates the python object passed to keyFunc for an element
+ * @param unbox reads an element back from an object made by box
+ * @return if successful
+ */
+template<typename Vector, typename Box, typename Unbox>
+static bool KeySort_sort(Vector &vector, PyObject *keyFunc, bool reverse, Box box, Unbox unbox) {
+    const size_t size = vector.size();
+
+    // keyFunc may change the list, so sort a snapshot
+    Vector values(vector);
+
+    auto **items = static_cast<PyObject **>(PyMem_Malloc(sizeof(PyObject *) * std::max(size, size_t(1))));
+    auto **keys = static_cast<PyObject **>(PyMem_Malloc(sizeof(PyObject *) * std::max(size, size_t(1))));
+    if (items == nullptr || keys == nullptr) {
+        PyMem_Free(items);
+        PyMem_Free(keys);
+        PyErr_NoMemory();
+        return false;
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        items[i] = box(values[i]);
+        keys[i] = items[i] == nullptr ? nullptr : PyObject_CallOneArg(keyFunc, items[i]);
+        if (keys[i] == nullptr) {
+            Py_XDECREF(items[i]);
+            KeySort_freeObjects(items, i);
+            KeySort_freeObjects(keys, i);
+            return false;
+        }
+    }
+
+    std::vector<long long> nativeKeys(size);
+    if (size <= INT_MAX && KeySort_toNative(keys, size, nativeKeys)) {
+        KeySort_freeObjects(items, size);
+        KeySort_freeObjects(keys, size);
+
+        std::vector<int> indices(size);
+        std::exception_ptr error;
+        Py_BEGIN_ALLOW_THREADS
+            try {
+                simd::argsort(nativeKeys.data(), size, reverse, true, indices.data());
+                Permutation_gather(values, indices.data());
+            } catch (...) {
+                error = std::current_exception();
+            }
+        Py_END_ALLOW_THREADS
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } else {
+        PyObject *result = CPython_sortWithKeys(items, keys, static_cast<Py_ssize_t>(size), reverse);
+        if (result != nullptr) {
+            Py_DECREF(result);
+            for (size_t i = 0; i < size; ++i) {
+                values[i] = unbox(items[i]);
+            }
+        }
+        KeySort_freeObjects(items, size);
+        KeySort_freeObjects(keys, size);
+        if (result == nullptr) {
+            return false;
+        }
+    }
+
+    if (vector.size() != size) {
+        PyErr_SetString(PyExc_ValueError, "list modified during sort");
+        return false;
+    }
+
+    // copy rather than swap, exported buffers keep pointing at the data
+    std::copy(values.begin(), values.end(), vector.begin());
+    return true;
+}
+
+#endif //PYFASTUTIL_KEYSORT_H
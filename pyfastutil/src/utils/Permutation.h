@@ -0,0 +1,84 @@
+//
+// Created by xia__mc on 2024/12/15.
+//
+
+#ifndef PYFASTUTIL_PERMUTATION_H
+#define PYFASTUTIL_PERMUTATION_H
+
+#include <algorithm>
+#include <exception>
+#include "utils/PythonPCH.h"
+#include "ints/IntArrayList.h"
+#include "ints/BigIntArrayList.h"
+#include "objects/ObjectArrayList.h"
+
+/**
+ * Reorder vector so that element i becomes the old element indices[i].
+ * The result is copied back rather than swapped in, so exported buffers keep pointing at the data.
+ */
+template<typename Vector>
+static __forceinline void Permutation_gather(Vector &vector, const int *indices) {
+    Vector result(vector.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+        result[i] = vector[static_cast<size_t>(indices[i])];
+    }
+    std::copy(result.begin(), result.end(), vector.begin());
+}
+
+/**
+ * Check that other is a list Permutation_apply can reorder, with size elements.
+ * If not successful, function will raise python exception.
+ * @return if successful
+ */
+static __forceinline bool Permutation_check(PyObject *other, const size_t size) noexcept {
+    size_t otherSize;
+    if (Py_TYPE(other) == &IntArrayListType) {
+        otherSize = reinterpret_cast<IntArrayList *>(other)->vector.size();
+    } else if (Py_TYPE(other) == &BigIntArrayListType) {
+        otherSize = reinterpret_cast<BigIntArrayList *>(other)->vector.size();
+    } else if (Py_TYPE(other) == &ObjectArrayListType) {
+        otherSize = reinterpret_cast<ObjectArrayList *>(other)->vector.size();
+    } else {
+        PyErr_Format(PyExc_TypeError,
+                     "expected an IntArrayList, a BigIntArrayList or an ObjectArrayList, got '%.200s'",
+                     Py_TYPE(other)->tp_name);
+        return false;
+    }
+
+    if (otherSize != size) {
+        PyErr_Format(PyExc_ValueError, "expected a list of length %zu, got %zu", size, otherSize);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Reorder other so that element i becomes the old element indices[i].
+ * other must have passed Permutation_check. Numeric lists are reordered with the GIL released.
+ * Throws std::bad_alloc if the reordered copy can't be allocated, other is unchanged then.
+ */
+static __forceinline void Permutation_apply(PyObject *other, const int *indices) {
+    // object pointers only move, so no reference count changes
+    if (Py_TYPE(other) == &ObjectArrayListType) {
+        Permutation_gather(reinterpret_cast<ObjectArrayList *>(other)->vector, indices);
+        return;
+    }
+
+    std::exception_ptr error;
+    Py_BEGIN_ALLOW_THREADS
+        try {
+            if (Py_TYPE(other) == &IntArrayListType) {
+                Permutation_gather(reinterpret_cast<IntArrayList *>(other)->vector, indices);
+            } else {
+                Permutation_gather(reinterpret_cast<BigIntArrayList *>(other)->vector, indices);
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+    Py_END_ALLOW_THREADS
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+#endif //PYFASTUTIL_PERMUTATION_H
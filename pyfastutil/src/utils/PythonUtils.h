@@ -148,7 +148,12 @@ static __forceinline char PyFast_AsChar(const PyObject *__restrict obj) noexcept
 
 static __forceinline PyObject *PyFast_FromInt(const int value) noexcept {
 #ifdef IS_PYTHON_312_OR_LATER
-    return (PyObject *) _PyLong_FromDigits(value < 0, 1, (digit *) (&value));
+    // digits are stored as magnitude, and only values within one digit can take the fast path
+    const auto magnitude = static_cast<digit>(value < 0 ? 0u - static_cast<unsigned int>(value) : value);
+    if (LIKELY(value != 0 && magnitude <= PyLong_MASK)) {
+        return (PyObject *) _PyLong_FromDigits(value < 0, 1, const_cast<digit *>(&magnitude));
+    }
+    return PyLong_FromLong(value);
 #else
     return PyLong_FromLong(value);
 #endif
@@ -213,7 +218,7 @@ static __forceinline PyObject *PyFast_FromInt(const int value) noexcept {
 #ifdef IS_PYTHON_312_OR_LATER
         _PyDict_SetItem_KnownHash(result, *keysIter, *values, *keysHashIter);
 #else
-        PyDict_SetItem(result, *keysIter, *valuesIter);
+        PyDict_SetItem(result, *keysIter, *values);
 #endif
         keysIter++;
         values++;
@@ -0,0 +1,306 @@
+//
+// Created by xia__mc on 2024/12/24.
+//
+
+#ifndef PYFASTUTIL_RINGBUFFER_H
+#define PYFASTUTIL_RINGBUFFER_H
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include "Compat.h"
+#include "utils/memory/AlignedAllocator.h"
+
+/**
+ * A circular buffer over a power of two sized, cache line aligned array, so wrapping an index is a mask.
+ * Pushing and popping at either end is O(1) amortized, indexing is O(1), and the elements are
+ * at most two contiguous spans, which bulk copies and the SIMD kernels work on directly.
+ */
+template<typename T>
+class RingBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "RingBuffer moves elements with memcpy");
+
+    static constexpr size_t ALIGNMENT = 64;
+    static constexpr size_t MIN_CAPACITY = 16;
+
+public:
+    RingBuffer() = default;
+
+    RingBuffer(const RingBuffer &other) {
+        reserve(other.count);
+        other.forEachChunk([this](const T *values, size_t n) { append(values, n); });
+    }
+
+    RingBuffer(RingBuffer &&other) noexcept {
+        swap(other);
+    }
+
+    RingBuffer &operator=(const RingBuffer &other) {
+        if (this != &other) {
+            clear();
+            reserve(other.count);
+            other.forEachChunk([this](const T *values, size_t n) { append(values, n); });
+        }
+        return *this;
+    }
+
+    RingBuffer &operator=(RingBuffer &&other) noexcept {
+        if (this != &other) {
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~RingBuffer() {
+        if (data != nullptr) {
+            alignedFree(data);
+        }
+    }
+
+    [[nodiscard]] size_t size() const {
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return count == 0;
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return data != nullptr ? mask + 1 : 0;
+    }
+
+    T &operator[](size_t index) {
+        return data[(head + index) & mask];
+    }
+
+    const T &operator[](size_t index) const {
+        return data[(head + index) & mask];
+    }
+
+    T &front() {
+        return data[head];
+    }
+
+    T &back() {
+        return (*this)[count - 1];
+    }
+
+    void push_back(const T &value) {
+        if (count == capacity()) {
+            grow();
+        }
+        data[(head + count) & mask] = value;
+        ++count;
+    }
+
+    void push_front(const T &value) {
+        if (count == capacity()) {
+            grow();
+        }
+        head = (head - 1) & mask;
+        data[head] = value;
+        ++count;
+    }
+
+    T pop_back() {
+        --count;
+        return data[(head + count) & mask];
+    }
+
+    T pop_front() {
+        const T value = data[head];
+        head = (head + 1) & mask;
+        --count;
+        return value;
+    }
+
+    /**
+     * Push n values at the back, with at most two copies.
+     */
+    void append(const T *values, size_t n) {
+        if (n == 0) {
+            return;
+        }
+        reserve(count + n);
+        const size_t tail = (head + count) & mask;
+        const size_t first = std::min(n, capacity() - tail);
+        std::memcpy(data + tail, values, first * sizeof(T));
+        std::memcpy(data, values + first, (n - first) * sizeof(T));
+        count += n;
+    }
+
+    /**
+     * Pop the first n (<= size) values into out, in order, with at most two copies.
+     */
+    void popFront(T *out, size_t n) {
+        if (n == 0) {
+            return;
+        }
+        const size_t first = std::min(n, capacity() - head);
+        std::memcpy(out, data + head, first * sizeof(T));
+        std::memcpy(out + first, data, (n - first) * sizeof(T));
+        head = (head + n) & mask;
+        count -= n;
+    }
+
+    /**
+     * Insert value before index (<= size), moving the shorter side.
+     */
+    void insert(size_t index, const T &value) {
+        if (index < count / 2) {
+            push_front(value);
+            for (size_t i = 0; i < index; i++) {
+                (*this)[i] = (*this)[i + 1];
+            }
+        } else {
+            push_back(value);
+            for (size_t i = count - 1; i > index; i--) {
+                (*this)[i] = (*this)[i - 1];
+            }
+        }
+        (*this)[index] = value;
+    }
+
+    /**
+     * Remove the element at index (< size), moving the shorter side.
+     */
+    void erase(size_t index) {
+        if (index < count / 2) {
+            for (size_t i = index; i > 0; i--) {
+                (*this)[i] = (*this)[i - 1];
+            }
+            pop_front();
+        } else {
+            for (size_t i = index; i + 1 < count; i++) {
+                (*this)[i] = (*this)[i + 1];
+            }
+            pop_back();
+        }
+    }
+
+    /**
+     * Move the last n elements to the front (the first -n to the back if n is negative), like deque.rotate.
+     * A full buffer only moves head, otherwise the fewer elements are moved one by one.
+     */
+    void rotate(ptrdiff_t n) {
+        if (count <= 1) {
+            return;
+        }
+
+        const auto size = static_cast<ptrdiff_t>(count);
+        n %= size;
+        if (n < 0) {
+            n += size;
+        }
+        if (n == 0) {
+            return;
+        }
+
+        if (count == capacity()) {
+            head = (head - static_cast<size_t>(n)) & mask;
+        } else if (n <= size / 2) {
+            for (ptrdiff_t i = 0; i < n; i++) {
+                push_front(pop_back());
+            }
+        } else {
+            for (ptrdiff_t i = n; i < size; i++) {
+                push_back(pop_front());
+            }
+        }
+    }
+
+    void reverse() {
+        for (size_t i = 0, j = count; i + 1 < j; i++, j--) {
+            std::swap((*this)[i], (*this)[j - 1]);
+        }
+    }
+
+    /**
+     * Drop every element, the capacity is kept for reuse.
+     */
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+
+    /**
+     * Make room for at least n elements without reallocating.
+     */
+    void reserve(size_t n) {
+        if (n > capacity()) {
+            reallocate(std::bit_ceil(std::max(n, MIN_CAPACITY)));
+        }
+    }
+
+    /**
+     * Call function(values, n, index) for the (at most two) spans of elements in [first, last), in order,
+     * index being the position of values[0]. Stops early when function returns true.
+     * @return if function stopped the walk
+     */
+    template<typename Function>
+    bool forEachChunk(size_t first, size_t last, Function function) const {
+        if (first >= last) {
+            return false;
+        }
+
+        const size_t start = (head + first) & mask;
+        const size_t n = last - first;
+        const size_t span = std::min(n, capacity() - start);
+        if (function(static_cast<const T *>(data + start), span, first)) {
+            return true;
+        }
+        return span < n && function(static_cast<const T *>(data), n - span, first + span);
+    }
+
+    /**
+     * Call function(values, n) for the spans of all elements, in order.
+     */
+    template<typename Function>
+    void forEachChunk(Function function) const {
+        forEachChunk(0, count, [&function](const T *values, size_t n, size_t) {
+            function(values, n);
+            return false;
+        });
+    }
+
+    void swap(RingBuffer &other) noexcept {
+        std::swap(data, other.data);
+        std::swap(mask, other.mask);
+        std::swap(head, other.head);
+        std::swap(count, other.count);
+    }
+
+private:
+    T *data = nullptr;
+    size_t mask = 0;
+    size_t head = 0;
+    size_t count = 0;
+
+    void grow() {
+        reallocate(std::max(MIN_CAPACITY, capacity() * 2));
+    }
+
+    /**
+     * Move the elements to a new array of newCapacity (a power of two), starting at its front.
+     */
+    void reallocate(size_t newCapacity) {
+        T *newData = static_cast<T *>(alignedAlloc(newCapacity * sizeof(T), ALIGNMENT));
+        size_t copied = 0;
+        forEachChunk([&](const T *values, size_t n) {
+            std::memcpy(newData + copied, values, n * sizeof(T));
+            copied += n;
+        });
+
+        if (data != nullptr) {
+            alignedFree(data);
+        }
+        data = newData;
+        mask = newCapacity - 1;
+        head = 0;
+    }
+};
+
+#endif //PYFASTUTIL_RINGBUFFER_H
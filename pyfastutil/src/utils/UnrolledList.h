@@ -0,0 +1,566 @@
+//
+// Created by xia__mc on 2024/12/22.
+//
+
+#ifndef PYFASTUTIL_UNROLLEDLIST_H
+#define PYFASTUTIL_UNROLLEDLIST_H
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include "Compat.h"
+#include "utils/memory/PoolAllocator.h"
+
+/**
+ * A doubly linked list of cache line aligned nodes, each holding up to NODE_CAPACITY elements in order.
+ * It offers the part of the std::list interface the linked list types use, at a fraction of the memory
+ * (one 256 byte node per 59 ints instead of 24 bytes of pointers per int) and with traversal that
+ * mostly walks arrays instead of chasing pointers.
+ *
+ * Inserting at an iterator shifts the rest of its node, and splits the node in half when it's full.
+ * Erasing merges a node that fell under a quarter full into a neighbour if they fit together.
+ * Unlike std::list, any insertion or erasure invalidates all iterators.
+ *
+ * Nodes come from a pool owned by the list: freed nodes are reused by the next split or append, and the
+ * pages only go back to the system on clear() or destruction.
+ */
+template<typename T>
+class UnrolledList {
+    static_assert(std::is_trivially_copyable_v<T>, "UnrolledList moves elements with memmove");
+
+    static constexpr size_t NODE_BYTES = 256;
+    static constexpr size_t NODE_ALIGNMENT = 64;
+
+public:
+    static constexpr size_t NODE_CAPACITY = (NODE_BYTES - 2 * sizeof(void *) - sizeof(unsigned int)) / sizeof(T);
+
+private:
+    struct alignas(NODE_ALIGNMENT) Node {
+        Node *prev;
+        Node *next;
+        unsigned int count;
+        T values[NODE_CAPACITY];
+    };
+
+    static_assert(sizeof(Node) == NODE_BYTES);
+
+    /**
+     * A position is a node and an offset in it. Only the past-the-end position may have offset == count,
+     * at the last node, so every element has exactly one position. The empty list has only (nullptr, 0).
+     */
+    template<bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        Iterator() = default;
+
+        // A template never counts as the copy constructor, so this leaves the implicit one in place
+        template<bool OtherConst>
+        requires (Const && !OtherConst)
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        Iterator(const Iterator<OtherConst> &other) : node(other.node), offset(other.offset) {}
+
+        reference operator*() const {
+            return node->values[offset];
+        }
+
+        pointer operator->() const {
+            return node->values + offset;
+        }
+
+        Iterator &operator++() {
+            if (++offset == node->count && node->next != nullptr) {
+                node = node->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        Iterator &operator--() {
+            if (offset == 0) {
+                node = node->prev;
+                offset = node->count - 1;
+            } else {
+                --offset;
+            }
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator copy = *this;
+            --*this;
+            return copy;
+        }
+
+        bool operator==(const Iterator &other) const = default;
+
+    private:
+        friend class UnrolledList;
+
+        template<bool>
+        friend class Iterator;
+
+        Node *node = nullptr;
+        size_t offset = 0;
+
+        Iterator(Node *node, size_t offset) : node(node), offset(offset) {}
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    UnrolledList() = default;
+
+    UnrolledList(const UnrolledList &other) {
+        try {
+            other.forEachChunk([this](const T *values, size_t count) { append(values, count); });
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    UnrolledList(UnrolledList &&other) noexcept: head(other.head), tail(other.tail), length(other.length),
+                                                  finger(other.finger), fingerStart(other.fingerStart),
+                                                  pool(std::move(other.pool)) {
+        other.head = other.tail = other.finger = nullptr;
+        other.length = 0;
+    }
+
+    UnrolledList &operator=(const UnrolledList &other) {
+        if (this != &other) {
+            clear();
+            other.forEachChunk([this](const T *values, size_t count) { append(values, count); });
+        }
+        return *this;
+    }
+
+    UnrolledList &operator=(UnrolledList &&other) noexcept {
+        if (this != &other) {
+            clear();
+            std::swap(head, other.head);
+            std::swap(tail, other.tail);
+            std::swap(length, other.length);
+            std::swap(finger, other.finger);
+            std::swap(fingerStart, other.fingerStart);
+            pool.swap(other.pool);
+        }
+        return *this;
+    }
+
+    ~UnrolledList() {
+        clear();
+    }
+
+    [[nodiscard]] size_t size() const {
+        return length;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return length == 0;
+    }
+
+    iterator begin() {
+        return {head, 0};
+    }
+
+    iterator end() {
+        return {tail, tail != nullptr ? tail->count : 0};
+    }
+
+    const_iterator begin() const {
+        return const_cast<UnrolledList *>(this)->begin();
+    }
+
+    const_iterator end() const {
+        return const_cast<UnrolledList *>(this)->end();
+    }
+
+    T &front() {
+        return head->values[0];
+    }
+
+    T &back() {
+        return tail->values[tail->count - 1];
+    }
+
+    const T &front() const {
+        return head->values[0];
+    }
+
+    const T &back() const {
+        return tail->values[tail->count - 1];
+    }
+
+    /**
+     * The position of the index-th element, or end() if there's none. Whole nodes are skipped from the
+     * nearest of the head, the tail and the finger (the node found by the previous call), so sequential
+     * or nearby indexing costs O(1) node hops instead of a walk from an end.
+     */
+    iterator at(size_t index) {
+        if (index >= length) {
+            return end();
+        }
+
+        const size_t fromBack = length - index;
+        Node *node = head;
+        size_t start = 0;
+        if (fromBack < index) {
+            node = tail;
+            start = length - tail->count;
+        }
+        if (finger != nullptr) {
+            const size_t fromFinger = index >= fingerStart ? index - fingerStart : fingerStart - index;
+            if (fromFinger < std::min(index, fromBack)) {
+                node = finger;
+                start = fingerStart;
+            }
+        }
+
+        while (index >= start + node->count) {
+            start += node->count;
+            node = node->next;
+        }
+        while (index < start) {
+            node = node->prev;
+            start -= node->count;
+        }
+
+        finger = node;
+        fingerStart = start;
+        return {node, index - start};
+    }
+
+    void push_back(const T &value) {
+        insert(end(), value);
+    }
+
+    void push_front(const T &value) {
+        insert(begin(), value);
+    }
+
+    void pop_back() {
+        erase(std::prev(end()));
+    }
+
+    void pop_front() {
+        erase(begin());
+    }
+
+    /**
+     * Insert value before position.
+     * @return the position of the inserted element
+     */
+    iterator insert(const_iterator position, const T &value) {
+        Node *node = position.node;
+        size_t offset = position.offset;
+
+        if (node == nullptr) {
+            node = allocateNode();
+            head = tail = node;
+        } else {
+            // A full node takes an element at its front through the previous node, or a new one before it
+            const bool landsBefore = node->count == NODE_CAPACITY && offset == 0 &&
+                                     (node->prev == nullptr || node->prev->count < NODE_CAPACITY);
+            shiftFinger(node, 1, landsBefore);
+        }
+
+        if (node->count == NODE_CAPACITY) {
+            if (offset == NODE_CAPACITY) {
+                // Past a full last node, appending keeps every node full
+                node = linkAfter(node);
+                offset = 0;
+            } else if (offset == 0 && node->prev != nullptr && node->prev->count < NODE_CAPACITY) {
+                node = node->prev;
+                offset = node->count;
+            } else if (offset == 0 && node->prev == nullptr) {
+                node = linkBefore(node);
+            } else {
+                Node *right = linkAfter(node);
+                const size_t keep = NODE_CAPACITY / 2;
+                right->count = static_cast<unsigned int>(NODE_CAPACITY - keep);
+                std::memcpy(right->values, node->values + keep, right->count * sizeof(T));
+                node->count = static_cast<unsigned int>(keep);
+                if (offset > keep) {
+                    node = right;
+                    offset -= keep;
+                }
+            }
+        }
+
+        std::memmove(node->values + offset + 1, node->values + offset, (node->count - offset) * sizeof(T));
+        node->values[offset] = value;
+        ++node->count;
+        ++length;
+        return {node, offset};
+    }
+
+    /**
+     * Insert a copy of [first, last) before position. The range may be part of this list.
+     */
+    template<typename InputIt>
+    void insert(const_iterator position, InputIt first, InputIt last) {
+        const std::vector<T> values(first, last);
+        if (position == end()) {
+            append(values.data(), values.size());
+            return;
+        }
+
+        iterator iter(position.node, position.offset);
+        for (const T &value: values) {
+            iter = std::next(insert(iter, value));
+        }
+    }
+
+    /**
+     * Append count elements, filling the last node and then whole new ones.
+     */
+    void append(const T *values, size_t count) {
+        while (count > 0) {
+            if (tail == nullptr) {
+                head = tail = allocateNode();
+            } else if (tail->count == NODE_CAPACITY) {
+                linkAfter(tail);
+            }
+
+            const size_t take = std::min(count, NODE_CAPACITY - tail->count);
+            std::memcpy(tail->values + tail->count, values, take * sizeof(T));
+            tail->count += static_cast<unsigned int>(take);
+            length += take;
+            values += take;
+            count -= take;
+        }
+    }
+
+    /**
+     * @return the position of the element after the erased one
+     */
+    iterator erase(const_iterator position) {
+        Node *node = position.node;
+        const size_t offset = position.offset;
+
+        shiftFinger(node, -1, false);
+        std::memmove(node->values + offset, node->values + offset + 1, (node->count - offset - 1) * sizeof(T));
+        --node->count;
+        --length;
+        return rebalance(node, offset);
+    }
+
+    /**
+     * @return the position of the element after the erased ones
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        size_t remaining = distance(first, last);
+        Node *node = first.node;
+        size_t offset = first.offset;
+        if (remaining == 0) {
+            return {node, offset};
+        }
+        if (node != finger) {
+            // The range may span the finger, not worth tracking
+            finger = nullptr;
+        }
+
+        while (true) {
+            const size_t take = std::min(remaining, node->count - offset);
+            std::memmove(node->values + offset, node->values + offset + take,
+                         (node->count - offset - take) * sizeof(T));
+            node->count -= static_cast<unsigned int>(take);
+            length -= take;
+            remaining -= take;
+            if (remaining == 0) {
+                break;
+            }
+
+            // The rest of this node is gone, go on at the start of the next one
+            Node *next = node->next;
+            if (node->count == 0) {
+                unlink(node);
+            }
+            node = next;
+            offset = 0;
+        }
+        return rebalance(node, offset);
+    }
+
+    void clear() {
+        // Every node lives in the pool, dropping its pages frees them all
+        pool.release();
+        head = tail = finger = nullptr;
+        length = 0;
+    }
+
+    /**
+     * Stable sort, through a contiguous copy of the elements.
+     */
+    template<typename Compare = std::less<>>
+    void sort(Compare compare = {}) {
+        std::vector<T> values(begin(), end());
+        std::stable_sort(values.begin(), values.end(), compare);
+        std::copy(values.begin(), values.end(), begin());
+    }
+
+    void reverse() {
+        std::reverse(begin(), end());
+    }
+
+    /**
+     * Call function(values, count) for the elements of every node, front to back.
+     */
+    template<typename Function>
+    void forEachChunk(Function function) const {
+        for (const Node *node = head; node != nullptr; node = node->next) {
+            function(static_cast<const T *>(node->values), static_cast<size_t>(node->count));
+        }
+    }
+
+    /**
+     * How many elements are in [first, last), counted a node at a time.
+     */
+    static size_t distance(const_iterator first, const_iterator last) {
+        if (first.node == last.node) {
+            return last.offset - first.offset;
+        }
+
+        size_t result = first.node->count - first.offset;
+        for (const Node *node = first.node->next; node != last.node; node = node->next) {
+            result += node->count;
+        }
+        return result + last.offset;
+    }
+
+private:
+    Node *head = nullptr;
+    Node *tail = nullptr;
+    size_t length = 0;
+    // The node the last at() ended on and the index of its first element, nullptr when unknown
+    Node *finger = nullptr;
+    size_t fingerStart = 0;
+    PoolAllocator<Node, NODE_ALIGNMENT> pool;
+
+    Node *allocateNode() {
+        Node *node = pool.allocate();
+        node->prev = node->next = nullptr;
+        node->count = 0;
+        return node;
+    }
+
+    void freeNode(Node *node) {
+        pool.deallocate(node);
+    }
+
+    Node *linkAfter(Node *node) {
+        Node *created = allocateNode();
+        created->prev = node;
+        created->next = node->next;
+        if (node->next != nullptr) {
+            node->next->prev = created;
+        } else {
+            tail = created;
+        }
+        node->next = created;
+        return created;
+    }
+
+    Node *linkBefore(Node *node) {
+        Node *created = allocateNode();
+        created->next = node;
+        created->prev = node->prev;
+        if (node->prev != nullptr) {
+            node->prev->next = created;
+        } else {
+            head = created;
+        }
+        node->prev = created;
+        return created;
+    }
+
+    /**
+     * Keep fingerStart right when delta elements are about to be inserted into or erased from node,
+     * before any node is linked or unlinked. landsBefore: an inserted element goes in front of node.
+     * Changes at the head are in front of the finger and changes at the tail behind it, anything else
+     * somewhere else in the list drops the finger.
+     */
+    void shiftFinger(const Node *node, ptrdiff_t delta, bool landsBefore) {
+        if (finger == nullptr || (node == finger && !landsBefore)) {
+            return;
+        }
+
+        if (node == finger || node == head) {
+            fingerStart += delta;
+        } else if (node != tail) {
+            finger = nullptr;
+        }
+    }
+
+    void unlink(Node *node) {
+        if (node == finger) {
+            finger = nullptr;
+        }
+        (node->prev != nullptr ? node->prev->next : head) = node->next;
+        (node->next != nullptr ? node->next->prev : tail) = node->prev;
+        freeNode(node);
+    }
+
+    /**
+     * Move all elements of next to the end of node and drop next.
+     */
+    void absorbNext(Node *node) {
+        Node *next = node->next;
+        if (next == finger) {
+            finger = node;
+            fingerStart -= node->count;
+        }
+        std::memcpy(node->values + node->count, next->values, next->count * sizeof(T));
+        node->count += next->count;
+        unlink(next);
+    }
+
+    /**
+     * Fix up node after elements were removed from it.
+     * @return the position of what is now at offset in node
+     */
+    iterator rebalance(Node *node, size_t offset) {
+        if (node->count == 0) {
+            Node *next = node->next;
+            unlink(node);
+            return next != nullptr ? iterator(next, 0) : end();
+        }
+
+        if (node->count < NODE_CAPACITY / 4) {
+            if (node->next != nullptr && node->count + node->next->count <= NODE_CAPACITY) {
+                absorbNext(node);
+            } else if (node->prev != nullptr && node->prev->count + node->count <= NODE_CAPACITY) {
+                Node *prev = node->prev;
+                offset += prev->count;
+                absorbNext(prev);
+                node = prev;
+            }
+        }
+
+        if (offset == node->count && node->next != nullptr) {
+            return {node->next, 0};
+        }
+        return {node, offset};
+    }
+};
+
+#endif //PYFASTUTIL_UNROLLEDLIST_H
@@ -1385,7 +1385,8 @@ ascending or descending, according to their function values.
 
 The reverse flag can be set to sort in descending order.
 [clinic start generated code]*/
-PyObject *CPython_sort(PyObject **items, Py_ssize_t size, PyObject *keyfunc, int reverse)
+static PyObject *sort_impl(PyObject **items, Py_ssize_t size, PyObject *keyfunc, PyObject *const *preset_keys,
+                           int reverse)
 /*[clinic end generated code: output=57b9f9c5e23fbe42 input=667bf25d0e3a3676]*/
 {
     MergeState ms;
@@ -1413,7 +1414,7 @@ PyObject *CPython_sort(PyObject **items, Py_ssize_t size, PyObject *keyfunc, int
     size = 0;
     items = NULL;
 
-    if (keyfunc == NULL) {
+    if (keyfunc == NULL && preset_keys == NULL) {
         keys = NULL;
         lo.keys = saved_ob_item;
         lo.values = NULL;
@@ -1430,7 +1431,12 @@ PyObject *CPython_sort(PyObject **items, Py_ssize_t size, PyObject *keyfunc, int
         }
 
         for (i = 0; i < saved_ob_size; i++) {
-            keys[i] = PyObject_CallOneArg(keyfunc, saved_ob_item[i]);
+            if (preset_keys != NULL) {
+                Py_INCREF(preset_keys[i]);
+                keys[i] = preset_keys[i];
+            } else {
+                keys[i] = PyObject_CallOneArg(keyfunc, saved_ob_item[i]);
+            }
             if (keys[i] == NULL) {
                 for (i = i - 1; i >= 0; i--)
                     Py_DECREF(keys[i]);
@@ -1631,5 +1637,13 @@ PyObject *CPython_sort(PyObject **items, Py_ssize_t size, PyObject *keyfunc, int
     return Py_XNewRef(result);
 }
 
+PyObject *CPython_sort(PyObject **items, Py_ssize_t size, PyObject *keyfunc, int reverse) {
+    return sort_impl(items, size, keyfunc, NULL, reverse);
+}
+
+PyObject *CPython_sortWithKeys(PyObject **items, PyObject *const *keys, Py_ssize_t size, int reverse) {
+    return sort_impl(items, size, NULL, keys, reverse);
+}
+
 #undef IFLT
 #undef ISLT
@@ -14,6 +14,11 @@ extern "C" {
 
 PyObject *CPython_sort(PyObject **items, Py_ssize_t size, PyObject *keyfunc, int reverse);
 
+/**
+ * Like CPython_sort, with keys computed beforehand. keys[i] is the key of items[i], keys are borrowed.
+ */
+PyObject *CPython_sortWithKeys(PyObject **items, PyObject *const *keys, Py_ssize_t size, int reverse);
+
 #ifdef __cplusplus
 }
 #endif
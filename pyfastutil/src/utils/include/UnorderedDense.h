@@ -1796,6 +1796,14 @@ namespace ankerl::unordered_dense {
                     return find(key) != end();
                 }
 
+                // PyFastUtil: address of the first bucket a lookup of key probes, used to prefetch batched lookups
+                [[nodiscard]] auto bucket_address(Key const& key) const noexcept -> void const* {
+                    if (ANKERL_UNORDERED_DENSE_UNLIKELY(m_buckets == nullptr)) {
+                        return nullptr;
+                    }
+                    return &at(m_buckets, bucket_idx_from_hash(mixed_hash(key)));
+                }
+
                 auto equal_range(Key const& key) -> std::pair<iterator, iterator> {
                     auto it = do_find(key);
                     return {it, it == end() ? end() : it + 1};
@@ -173,15 +173,18 @@ inline void qReverse(void *Array, std::size_t Count) {
     }
 }
 
+// Kernels for each ISA level, specialized below for 1, 2, 4, 8 and 16 byte elements.
+// Each reverse* step handles what it can from index i on and returns where it stopped.
+template<std::size_t ElementSize>
+struct QReverseKernels;
+
 // One byte elements
 template<>
-inline void qReverse<1>(void *Array, std::size_t Count) {
-    auto *Array8 = reinterpret_cast<std::uint8_t *>(Array);
-    std::size_t i = 0;
-
+struct QReverseKernels<1> {
 #if !defined(__arm__) && !defined(__arm64__)
     // AVX-512BW/F
-    if (simd::IS_AVX512_SUPPORTED) {
+    SIMD_TARGET_AVX512 static std::size_t reverseAVX512(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array8 = reinterpret_cast<std::uint8_t *>(Array);
         for (std::size_t j = i / 64; j < ((Count / 2) / 64); ++j) {
             // Reverses the 16 bytes of the four  128-bit lanes in a 512-bit register
             const __m512i ShuffleRev8 = _mm512_set_epi32(
@@ -225,9 +228,13 @@ inline void qReverse<1>(void *Array, std::size_t Count) {
             // 64 elements at a time
             i += 64;
         }
+
+        return i;
     }
+
     // AVX-2
-    if (simd::IS_AVX2_SUPPORTED) {
+    SIMD_TARGET_AVX2 static std::size_t reverseAVX2(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array8 = reinterpret_cast<std::uint8_t *>(Array);
         for (std::size_t j = i / 32; j < ((Count / 2) / 32); ++j) {
             const __m256i ShuffleRev = _mm256_set_epi8(
                     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
@@ -261,9 +268,13 @@ inline void qReverse<1>(void *Array, std::size_t Count) {
             // 32 elements at a time
             i += 32;
         }
+
+        return i;
     }
+
     // SSSE3
-    if (simd::IS_SSSE3_SUPPORTED) {
+    SIMD_TARGET_SSSE3 static std::size_t reverseSSSE3(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array8 = reinterpret_cast<std::uint8_t *>(Array);
         for (std::size_t j = i / 16; j < ((Count / 2) / 16); ++j) {
             const __m128i ShuffleRev = _mm_set_epi8(
                     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
@@ -293,114 +304,116 @@ inline void qReverse<1>(void *Array, std::size_t Count) {
             // 16 elements at a time
             i += 16;
         }
-    }
 
+        return i;
+    }
 #endif
-    // NEON
+
+    static void reverseTail(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array8 = reinterpret_cast<std::uint8_t *>(Array);
+        // NEON
 #ifdef __ARM_NEON
-    if (simd::IS_ARM_NEON_SUPPORTED) {
-        for( std::size_t j = i / 16; j < ((Count / 2) / 16); ++j ) {
-            // Load 16 elements at once into one 16-byte register
-            uint8x16_t Lower = vld1q_u8( &Array8[i] );
-            uint8x16_t Upper = vld1q_u8( &Array8[Count - i - 16] );
+        if (simd::IS_ARM_NEON_SUPPORTED) {
+            for( std::size_t j = i / 16; j < ((Count / 2) / 16); ++j ) {
+                // Load 16 elements at once into one 16-byte register
+                uint8x16_t Lower = vld1q_u8( &Array8[i] );
+                uint8x16_t Upper = vld1q_u8( &Array8[Count - i - 16] );
+
+                // Reverse 8-bit integers in each 64-bit lane
+                // Reverse the 64-bit lanes
+                Lower = vrev64q_u8( Lower );
+                Lower = vextq_u8( Lower, Lower, 8 );
+
+                Upper = vrev64q_u8(Upper);
+                Upper = vextq_u8( Upper, Upper, 8 );
+
+                // Place them at their swapped position
+                vst1q_u8(
+                    &Array8[i],
+                    Upper
+                );
+                vst1q_u8(
+                    &Array8[Count - i - 16],
+                    Lower
+                );
 
-            // Reverse 8-bit integers in each 64-bit lane
-            // Reverse the 64-bit lanes
-            Lower = vrev64q_u8( Lower );
-            Lower = vextq_u8( Lower, Lower, 8 );
+                // 16 elements at a time
+                i += 16;
+            }
+        }
+#endif
 
-            Upper = vrev64q_u8(Upper);
-            Upper = vextq_u8( Upper, Upper, 8 );
+        // BSWAP 64
+        for (std::size_t j = i / 8; j < ((Count / 2) / 8); ++j) {
+            // Get bswapped versions of our Upper and Lower 8-byte chunks
+            std::uint64_t Lower = Swap64(
+                    *reinterpret_cast<std::uint64_t *>(&Array8[i])
+            );
+            std::uint64_t Upper = Swap64(
+                    *reinterpret_cast<std::uint64_t *>(&Array8[Count - i - 8])
+            );
 
             // Place them at their swapped position
-            vst1q_u8(
-                &Array8[i],
-                Upper
+            *reinterpret_cast<std::uint64_t *>(&Array8[i]) = Upper;
+            *reinterpret_cast<std::uint64_t *>(&Array8[Count - i - 8]) = Lower;
+
+            // Eight elements at a time
+            i += 8;
+        }
+        // BSWAP 32
+        for (std::size_t j = i / 4; j < ((Count / 2) / 4); ++j) {
+            // Get bswapped versions of our Upper and Lower 4-byte chunks
+            std::uint32_t Lower = Swap32(
+                    *reinterpret_cast<std::uint32_t *>(&Array8[i])
             );
-            vst1q_u8(
-                &Array8[Count - i - 16],
-                Lower
+            std::uint32_t Upper = Swap32(
+                    *reinterpret_cast<std::uint32_t *>(&Array8[Count - i - 4])
             );
 
-            // 16 elements at a time
-            i += 16;
+            // Place them at their swapped position
+            *reinterpret_cast<std::uint32_t *>(&Array8[i]) = Upper;
+            *reinterpret_cast<std::uint32_t *>(&Array8[Count - i - 4]) = Lower;
+
+            // Four elements at a time
+            i += 4;
         }
-    }
-#endif
+        // BSWAP 16
+        for (std::size_t j = i / 2; j < ((Count / 2) / 2); ++j) {
+            // Get bswapped versions of our Upper and Lower 4-byte chunks
+            std::uint16_t Lower = Swap16(
+                    *reinterpret_cast<std::uint16_t *>(&Array8[i])
+            );
+            std::uint16_t Upper = Swap16(
+                    *reinterpret_cast<std::uint16_t *>(&Array8[Count - i - 2])
+            );
 
-    // BSWAP 64
-    for (std::size_t j = i / 8; j < ((Count / 2) / 8); ++j) {
-        // Get bswapped versions of our Upper and Lower 8-byte chunks
-        std::uint64_t Lower = Swap64(
-                *reinterpret_cast<std::uint64_t *>(&Array8[i])
-        );
-        std::uint64_t Upper = Swap64(
-                *reinterpret_cast<std::uint64_t *>(&Array8[Count - i - 8])
-        );
-
-        // Place them at their swapped position
-        *reinterpret_cast<std::uint64_t *>(&Array8[i]) = Upper;
-        *reinterpret_cast<std::uint64_t *>(&Array8[Count - i - 8]) = Lower;
-
-        // Eight elements at a time
-        i += 8;
-    }
-    // BSWAP 32
-    for (std::size_t j = i / 4; j < ((Count / 2) / 4); ++j) {
-        // Get bswapped versions of our Upper and Lower 4-byte chunks
-        std::uint32_t Lower = Swap32(
-                *reinterpret_cast<std::uint32_t *>(&Array8[i])
-        );
-        std::uint32_t Upper = Swap32(
-                *reinterpret_cast<std::uint32_t *>(&Array8[Count - i - 4])
-        );
-
-        // Place them at their swapped position
-        *reinterpret_cast<std::uint32_t *>(&Array8[i]) = Upper;
-        *reinterpret_cast<std::uint32_t *>(&Array8[Count - i - 4]) = Lower;
-
-        // Four elements at a time
-        i += 4;
-    }
-    // BSWAP 16
-    for (std::size_t j = i / 2; j < ((Count / 2) / 2); ++j) {
-        // Get bswapped versions of our Upper and Lower 4-byte chunks
-        std::uint16_t Lower = Swap16(
-                *reinterpret_cast<std::uint16_t *>(&Array8[i])
-        );
-        std::uint16_t Upper = Swap16(
-                *reinterpret_cast<std::uint16_t *>(&Array8[Count - i - 2])
-        );
-
-        // Place them at their swapped position
-        *reinterpret_cast<std::uint16_t *>(&Array8[i]) = Upper;
-        *reinterpret_cast<std::uint16_t *>(&Array8[Count - i - 2]) = Lower;
-
-        // Two elements at a time
-        i += 2;
-    }
+            // Place them at their swapped position
+            *reinterpret_cast<std::uint16_t *>(&Array8[i]) = Upper;
+            *reinterpret_cast<std::uint16_t *>(&Array8[Count - i - 2]) = Lower;
 
-    // Everything else that we can not do a bswap on, we swap normally
-    // Naive swaps
-    for (; i < Count / 2; ++i) {
-        // Exchange the upper and lower element as we work our
-        // way down to the middle from either end
-        std::uint8_t Temp(Array8[i]);
-        Array8[i] = Array8[Count - i - 1];
-        Array8[Count - i - 1] = Temp;
-    }
-}
+            // Two elements at a time
+            i += 2;
+        }
 
+        // Everything else that we can not do a bswap on, we swap normally
+        // Naive swaps
+        for (; i < Count / 2; ++i) {
+            // Exchange the upper and lower element as we work our
+            // way down to the middle from either end
+            std::uint8_t Temp(Array8[i]);
+            Array8[i] = Array8[Count - i - 1];
+            Array8[Count - i - 1] = Temp;
+        }
+    }
+};
 
 // Two byte elements
 template<>
-inline void qReverse<2>(void *Array, std::size_t Count) {
-    auto *Array16 = reinterpret_cast<std::uint16_t *>(Array);
-    std::size_t i = 0;
-
+struct QReverseKernels<2> {
 #if !defined(__arm__) && !defined(__arm64__)
     // AVX-512BW/F
-    if (simd::IS_AVX512_SUPPORTED) {
+    SIMD_TARGET_AVX512 static std::size_t reverseAVX512(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array16 = reinterpret_cast<std::uint16_t *>(Array);
         for (std::size_t j = i / 32; j < ((Count / 2) / 32); ++j) {
             const __m512i ShuffleRev = _mm512_set_epi64(
                     0x00000100020003,
@@ -438,9 +451,13 @@ inline void qReverse<2>(void *Array, std::size_t Count) {
             // 32 elements at a time
             i += 32;
         }
+
+        return i;
     }
+
     // AVX-2
-    if (simd::IS_AVX2_SUPPORTED) {
+    SIMD_TARGET_AVX2 static std::size_t reverseAVX2(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array16 = reinterpret_cast<std::uint16_t *>(Array);
         for (std::size_t j = i / 16; j < ((Count / 2) / 16); ++j) {
             const __m256i ShuffleRev = _mm256_set_epi8(
                     1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
@@ -473,9 +490,13 @@ inline void qReverse<2>(void *Array, std::size_t Count) {
             // 32 elements at a time
             i += 16;
         }
+
+        return i;
     }
+
     // SSSE3
-    if (simd::IS_SSSE3_SUPPORTED) {
+    SIMD_TARGET_SSSE3 static std::size_t reverseSSSE3(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array16 = reinterpret_cast<std::uint16_t *>(Array);
         for (std::size_t j = i / 8; j < ((Count / 2) / 8); ++j) {
             const __m128i ShuffleRev = _mm_set_epi8(
                     1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
@@ -504,62 +525,65 @@ inline void qReverse<2>(void *Array, std::size_t Count) {
             // 8 elements at a time
             i += 8;
         }
-    }
 
+        return i;
+    }
 #endif
-    // NEON
-
-#ifdef __ARM_NEON
-    if (simd::IS_ARM_NEON_SUPPORTED) {
-        for( std::size_t j = i / 8; j < ((Count / 2) / 8); ++j )
-        {
-            // Load 8 elements at once into one 16-byte register
-            uint16x8_t Lower = vld1q_u16( &Array16[i] );
-            uint16x8_t Upper = vld1q_u16( &Array16[Count - i - 8] );
-
-            // Reverse 16-bit integers in each 64-bit lane
-            // Reverse the 64-bit lanes
-            Lower = vrev64q_u16( Lower );
-            Lower = vextq_u16( Lower, Lower, 4 );
 
-            Upper = vrev64q_u16(Upper);
-            Upper = vextq_u16( Upper, Upper, 4 );
+    static void reverseTail(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array16 = reinterpret_cast<std::uint16_t *>(Array);
+        // NEON
 
-            // Place them at their swapped position
-            vst1q_u16(
-                &Array16[i],
-                Upper
-            );
-            vst1q_u16(
-                &Array16[Count - i - 8],
-                Lower
-            );
+#ifdef __ARM_NEON
+        if (simd::IS_ARM_NEON_SUPPORTED) {
+            for( std::size_t j = i / 8; j < ((Count / 2) / 8); ++j )
+            {
+                // Load 8 elements at once into one 16-byte register
+                uint16x8_t Lower = vld1q_u16( &Array16[i] );
+                uint16x8_t Upper = vld1q_u16( &Array16[Count - i - 8] );
+
+                // Reverse 16-bit integers in each 64-bit lane
+                // Reverse the 64-bit lanes
+                Lower = vrev64q_u16( Lower );
+                Lower = vextq_u16( Lower, Lower, 4 );
+
+                Upper = vrev64q_u16(Upper);
+                Upper = vextq_u16( Upper, Upper, 4 );
+
+                // Place them at their swapped position
+                vst1q_u16(
+                    &Array16[i],
+                    Upper
+                );
+                vst1q_u16(
+                    &Array16[Count - i - 8],
+                    Lower
+                );
 
-            // 8 elements at a time
-            i += 8;
+                // 8 elements at a time
+                i += 8;
+            }
         }
-    }
 #endif
 
-    // Naive swaps
-    for (; i < Count / 2; ++i) {
-        // Exchange the upper and lower element as we work our
-        // way down to the middle from either end
-        std::uint16_t Temp(Array16[i]);
-        Array16[i] = Array16[Count - i - 1];
-        Array16[Count - i - 1] = Temp;
+        // Naive swaps
+        for (; i < Count / 2; ++i) {
+            // Exchange the upper and lower element as we work our
+            // way down to the middle from either end
+            std::uint16_t Temp(Array16[i]);
+            Array16[i] = Array16[Count - i - 1];
+            Array16[Count - i - 1] = Temp;
+        }
     }
-}
+};
 
 // Four byte elements
 template<>
-inline void qReverse<4>(void *Array, std::size_t Count) {
-    auto *Array32 = reinterpret_cast<std::uint32_t *>(Array);
-    std::size_t i = 0;
-
+struct QReverseKernels<4> {
 #if !defined(__arm__) && !defined(__arm64__)
     // AVX-512BW/F
-    if (simd::IS_AVX512_SUPPORTED) {
+    SIMD_TARGET_AVX512 static std::size_t reverseAVX512(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array32 = reinterpret_cast<std::uint32_t *>(Array);
         for (std::size_t j = i / 16; j < ((Count / 2) / 16); ++j) {
             const __m512i ShuffleRev = _mm512_set_epi32(
                     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
@@ -590,9 +614,13 @@ inline void qReverse<4>(void *Array, std::size_t Count) {
             // 16 elements at a time
             i += 16;
         }
+
+        return i;
     }
+
     // AVX-2
-    if (simd::IS_AVX2_SUPPORTED) {
+    SIMD_TARGET_AVX2 static std::size_t reverseAVX2(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array32 = reinterpret_cast<std::uint32_t *>(Array);
         for (std::size_t j = i / 8; j < ((Count / 2) / 8); ++j) {
             // Load 8 elements at once into one 32-byte register
             __m256i Lower = _mm256_loadu_si256(
@@ -621,9 +649,13 @@ inline void qReverse<4>(void *Array, std::size_t Count) {
             // 8 elements at a time
             i += 8;
         }
+
+        return i;
     }
+
     // SSSE3
-    if (simd::IS_SSSE3_SUPPORTED) {
+    SIMD_TARGET_SSSE3 static std::size_t reverseSSSE3(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array32 = reinterpret_cast<std::uint32_t *>(Array);
         for (std::size_t j = i / 4; j < ((Count / 2) / 4); ++j) {
             // Load 4 elements at once into one 16-byte register
             __m128i Lower = _mm_loadu_si128(
@@ -649,60 +681,63 @@ inline void qReverse<4>(void *Array, std::size_t Count) {
             // 4 elements at a time
             i += 4;
         }
-    }
 
+        return i;
+    }
 #endif
+
+    static void reverseTail(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array32 = reinterpret_cast<std::uint32_t *>(Array);
 #ifdef __ARM_NEON
-    // NEON
-if (simd::IS_ARM_NEON_SUPPORTED) {
-    for( std::size_t j = i / 4; j < ((Count / 2) / 4); ++j )
-    {
-        // Load 4 elements at once into one 4-byte register
-        uint32x4_t Lower = vld1q_u32( &Array32[i] );
-        uint32x4_t Upper = vld1q_u32( &Array32[Count - i - 4] );
-
-        // Reverse 32-bit integers in each 64-bit lane
-        // Reverse the 64-bit lanes
-        Lower = vrev64q_u32( Lower );
-        Lower = vextq_u32( Lower, Lower, 2 );
-
-        Upper = vrev64q_u32(Upper);
-        Upper = vextq_u32( Upper, Upper, 2 );
-
-        // Place them at their swapped position
-        vst1q_u32(
-            &Array32[i],
-            Upper
-        );
-        vst1q_u32(
-            &Array32[Count - i - 4],
-            Lower
-        );
-
-        // 4 elements at a time
-        i += 4;
+        // NEON
+    if (simd::IS_ARM_NEON_SUPPORTED) {
+        for( std::size_t j = i / 4; j < ((Count / 2) / 4); ++j )
+        {
+            // Load 4 elements at once into one 4-byte register
+            uint32x4_t Lower = vld1q_u32( &Array32[i] );
+            uint32x4_t Upper = vld1q_u32( &Array32[Count - i - 4] );
+
+            // Reverse 32-bit integers in each 64-bit lane
+            // Reverse the 64-bit lanes
+            Lower = vrev64q_u32( Lower );
+            Lower = vextq_u32( Lower, Lower, 2 );
+
+            Upper = vrev64q_u32(Upper);
+            Upper = vextq_u32( Upper, Upper, 2 );
+
+            // Place them at their swapped position
+            vst1q_u32(
+                &Array32[i],
+                Upper
+            );
+            vst1q_u32(
+                &Array32[Count - i - 4],
+                Lower
+            );
+
+            // 4 elements at a time
+            i += 4;
+        }
     }
-}
 #endif
-    // Naive swaps
-    for (; i < Count / 2; ++i) {
-        // Exchange the upper and lower element as we work our
-        // way down to the middle from either end
-        std::uint32_t Temp(Array32[i]);
-        Array32[i] = Array32[Count - i - 1];
-        Array32[Count - i - 1] = Temp;
+        // Naive swaps
+        for (; i < Count / 2; ++i) {
+            // Exchange the upper and lower element as we work our
+            // way down to the middle from either end
+            std::uint32_t Temp(Array32[i]);
+            Array32[i] = Array32[Count - i - 1];
+            Array32[Count - i - 1] = Temp;
+        }
     }
-}
+};
 
 // 8 byte elements
 template<>
-inline void qReverse<8>(void *Array, std::size_t Count) {
-    auto *Array64 = reinterpret_cast<std::uint64_t *>(Array);
-    std::size_t i = 0;
-
+struct QReverseKernels<8> {
 #if !defined(__arm__) && !defined(__arm64__)
     // AVX-512BW/F
-    if (simd::IS_AVX512_SUPPORTED) {
+    SIMD_TARGET_AVX512 static std::size_t reverseAVX512(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array64 = reinterpret_cast<std::uint64_t *>(Array);
         for (std::size_t j = i / 8; j < ((Count / 2) / 8); ++j) {
             const __m512i ShuffleRev = _mm512_set_epi64(
                     0, 1, 2, 3, 4, 5, 6, 7
@@ -733,9 +768,13 @@ inline void qReverse<8>(void *Array, std::size_t Count) {
             // 8 elements at a time
             i += 8;
         }
+
+        return i;
     }
+
     // AVX-2
-    if (simd::IS_AVX2_SUPPORTED) {
+    SIMD_TARGET_AVX2 static std::size_t reverseAVX2(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array64 = reinterpret_cast<std::uint64_t *>(Array);
         for (std::size_t j = i / 4; j < ((Count / 2) / 4); ++j) {
             // Load 4 elements at once into one 32-byte register
             __m256i Lower = _mm256_loadu_si256(
@@ -764,9 +803,13 @@ inline void qReverse<8>(void *Array, std::size_t Count) {
             // 4 elements at a time
             i += 4;
         }
+
+        return i;
     }
+
     // SSSE3
-    if (simd::IS_SSSE3_SUPPORTED) {
+    SIMD_TARGET_SSSE3 static std::size_t reverseSSSE3(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array64 = reinterpret_cast<std::uint64_t *>(Array);
         for (std::size_t j = i / 2; j < ((Count / 2) / 2); ++j) {
             // Load 2 elements at once into one 16-byte register
             __m128i Lower = _mm_loadu_si128(
@@ -792,60 +835,64 @@ inline void qReverse<8>(void *Array, std::size_t Count) {
             // 2 elements at a time
             i += 2;
         }
-    }
 
+        return i;
+    }
 #endif
-#ifdef __ARM_NEON
-    // NEON
-    if (simd::IS_ARM_NEON_SUPPORTED) {
-        for( std::size_t j = i / 2; j < ((Count / 2) / 2); ++j )
-        {
-            // Load 2 elements at once into one 2-byte register
-            uint64x2_t Lower = vld1q_u64( &Array64[i] );
-            uint64x2_t Upper = vld1q_u64( &Array64[Count - i - 2] );
 
-            // Reverse the 64-bit lanes
-            Lower = vextq_u64( Lower, Lower, 1 );
-            Upper = vextq_u64( Upper, Upper, 1 );
-
-            // Place them at their swapped position
-            vst1q_u64(
-                &Array64[i],
-                Upper
-            );
-            vst1q_u64(
-                &Array64[Count - i - 2],
-                Lower
-            );
+    static void reverseTail(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array64 = reinterpret_cast<std::uint64_t *>(Array);
+#ifdef __ARM_NEON
+        // NEON
+        if (simd::IS_ARM_NEON_SUPPORTED) {
+            for( std::size_t j = i / 2; j < ((Count / 2) / 2); ++j )
+            {
+                // Load 2 elements at once into one 2-byte register
+                uint64x2_t Lower = vld1q_u64( &Array64[i] );
+                uint64x2_t Upper = vld1q_u64( &Array64[Count - i - 2] );
+
+                // Reverse the 64-bit lanes
+                Lower = vextq_u64( Lower, Lower, 1 );
+                Upper = vextq_u64( Upper, Upper, 1 );
+
+                // Place them at their swapped position
+                vst1q_u64(
+                    &Array64[i],
+                    Upper
+                );
+                vst1q_u64(
+                    &Array64[Count - i - 2],
+                    Lower
+                );
 
-            // 2 elements at a time
-            i += 2;
+                // 2 elements at a time
+                i += 2;
+            }
         }
-    }
 #endif
 
-    // Naive swaps
-    for (; i < Count / 2; ++i) {
-        // Exchange the upper and lower element as we work our
-        // way down to the middle from either end
-        std::uint64_t Temp(Array64[i]);
-        Array64[i] = Array64[Count - i - 1];
-        Array64[Count - i - 1] = Temp;
+        // Naive swaps
+        for (; i < Count / 2; ++i) {
+            // Exchange the upper and lower element as we work our
+            // way down to the middle from either end
+            std::uint64_t Temp(Array64[i]);
+            Array64[i] = Array64[Count - i - 1];
+            Array64[Count - i - 1] = Temp;
+        }
     }
-}
+};
 
 // 16 byte elements
 template<>
-inline void qReverse<16>(void *Array, std::size_t Count) {
+struct QReverseKernels<16> {
     struct uint128_t {
         [[maybe_unused]] std::uint64_t u64[2];
     };
-    auto *Array128 = reinterpret_cast<uint128_t *>(Array);
-    std::size_t i = 0;
 
 #if !defined(__arm__) && !defined(__arm64__)
     // AVX-512BW/F
-    if (simd::IS_AVX512_SUPPORTED) {
+    SIMD_TARGET_AVX512 static std::size_t reverseAVX512(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array128 = reinterpret_cast<uint128_t *>(Array);
         for (std::size_t j = i / 4; j < ((Count / 2) / 4); ++j) {
             const __m512i ShuffleRev = _mm512_set_epi64(
                     1, 0, 3, 2, 5, 4, 7, 6
@@ -875,10 +922,13 @@ inline void qReverse<16>(void *Array, std::size_t Count) {
             // 4 elements at a time
             i += 4;
         }
+
+        return i;
     }
 
     // AVX-2
-    if (simd::IS_AVX2_SUPPORTED) {
+    SIMD_TARGET_AVX2 static std::size_t reverseAVX2(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array128 = reinterpret_cast<uint128_t *>(Array);
         for (std::size_t j = i / 2; j < ((Count / 2) / 2); ++j) {
             // Load 2 elements at once into one 32-byte register
             __m256i Lower = _mm256_loadu_si256(
@@ -888,8 +938,8 @@ inline void qReverse<16>(void *Array, std::size_t Count) {
                     reinterpret_cast<__m256i *>(&Array128[Count - i - 2])
             );
 
-            Lower = _mm256_permute4x64_epi64(Lower, _MM_SHUFFLE(0, 1, 2, 3));
-            Upper = _mm256_permute4x64_epi64(Upper, _MM_SHUFFLE(0, 1, 2, 3));
+            Lower = _mm256_permute4x64_epi64(Lower, _MM_SHUFFLE(1, 0, 3, 2));
+            Upper = _mm256_permute4x64_epi64(Upper, _MM_SHUFFLE(1, 0, 3, 2));
 
             // Place them at their swapped position
             _mm256_storeu_si256(
@@ -904,17 +954,102 @@ inline void qReverse<16>(void *Array, std::size_t Count) {
             // 2 elements at a time
             i += 2;
         }
+
+        return i;
+    }
+
+    // Nothing narrower than AVX-2 for 16 byte elements
+    static std::size_t reverseSSSE3([[maybe_unused]] void *Array, [[maybe_unused]] std::size_t Count,
+                                    std::size_t i) {
+        return i;
+    }
+#endif
+
+    static void reverseTail(void *Array, std::size_t Count, std::size_t i) {
+        auto *Array128 = reinterpret_cast<uint128_t *>(Array);
+        // Naive swaps
+        for (; i < Count / 2; ++i) {
+            // Exchange the upper and lower element as we work our
+            // way down to the middle from either end
+            uint128_t Temp(Array128[i]);
+            Array128[i] = Array128[Count - i - 1];
+            Array128[Count - i - 1] = Temp;
+        }
     }
+};
+
+template<std::size_t ElementSize>
+inline void qReverseBaseline(void *Array, std::size_t Count) {
+    QReverseKernels<ElementSize>::reverseTail(Array, Count, 0);
+}
+
+#if !defined(__arm__) && !defined(__arm64__)
+
+template<std::size_t ElementSize>
+SIMD_TARGET_AVX2 inline void qReverseAVX2(void *Array, std::size_t Count) {
+    using Kernels = QReverseKernels<ElementSize>;
+    std::size_t i = Kernels::reverseAVX2(Array, Count, 0);
+    i = Kernels::reverseSSSE3(Array, Count, i);
+    Kernels::reverseTail(Array, Count, i);
+}
+
+template<std::size_t ElementSize>
+SIMD_TARGET_AVX512 inline void qReverseAVX512(void *Array, std::size_t Count) {
+    using Kernels = QReverseKernels<ElementSize>;
+    std::size_t i = Kernels::reverseAVX512(Array, Count, 0);
+    i = Kernels::reverseAVX2(Array, Count, i);
+    i = Kernels::reverseSSSE3(Array, Count, i);
+    Kernels::reverseTail(Array, Count, i);
+}
+
 #endif
 
-    // Naive swaps
-    for (; i < Count / 2; ++i) {
-        // Exchange the upper and lower element as we work our
-        // way down to the middle from either end
-        uint128_t Temp(Array128[i]);
-        Array128[i] = Array128[Count - i - 1];
-        Array128[Count - i - 1] = Temp;
+// Chosen by initQReverse() at import. Starts at the baseline kernel so an early call is still safe.
+template<std::size_t ElementSize>
+inline void (*qReverseKernel)(void *Array, std::size_t Count) = qReverseBaseline<ElementSize>;
+
+template<std::size_t ElementSize>
+inline void initQReverseKernel() {
+#if !defined(__arm__) && !defined(__arm64__)
+    if (simd::IS_AVX512_SUPPORTED) {
+        qReverseKernel<ElementSize> = qReverseAVX512<ElementSize>;
+    } else if (simd::IS_AVX2_SUPPORTED) {
+        qReverseKernel<ElementSize> = qReverseAVX2<ElementSize>;
     }
+#endif
+}
+
+inline void initQReverse() {
+    initQReverseKernel<1>();
+    initQReverseKernel<2>();
+    initQReverseKernel<4>();
+    initQReverseKernel<8>();
+    initQReverseKernel<16>();
+}
+
+template<>
+inline void qReverse<1>(void *Array, std::size_t Count) {
+    qReverseKernel<1>(Array, Count);
+}
+
+template<>
+inline void qReverse<2>(void *Array, std::size_t Count) {
+    qReverseKernel<2>(Array, Count);
+}
+
+template<>
+inline void qReverse<4>(void *Array, std::size_t Count) {
+    qReverseKernel<4>(Array, Count);
+}
+
+template<>
+inline void qReverse<8>(void *Array, std::size_t Count) {
+    qReverseKernel<8>(Array, Count);
+}
+
+template<>
+inline void qReverse<16>(void *Array, std::size_t Count) {
+    qReverseKernel<16>(Array, Count);
 }
 
 #endif // PYFASTUTIL_QREVERSE_H
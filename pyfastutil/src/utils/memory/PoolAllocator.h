@@ -0,0 +1,112 @@
+//
+// Created by xia__mc on 2024/12/23.
+//
+
+#ifndef PYFASTUTIL_POOLALLOCATOR_H
+#define PYFASTUTIL_POOLALLOCATOR_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "Compat.h"
+#include "utils/memory/AlignedAllocator.h"
+
+/**
+ * Allocates single T sized blocks out of pages of BLOCKS_PER_PAGE contiguous blocks, and recycles freed blocks
+ * through an intrusive free list, so steady allocate/deallocate churn never reaches the global allocator.
+ * Blocks handed out one after another are neighbours in memory, which keeps a container walking them prefetch friendly.
+ *
+ * Not thread safe, each container owns its pool. Pages are only returned by release() or the destructor,
+ * every block must be deallocated (or abandoned) before that.
+ */
+template<typename T, size_t Alignment = alignof(T)>
+class PoolAllocator {
+    static_assert(sizeof(T) >= sizeof(void *), "a free block stores the free list link");
+    static_assert(sizeof(T) % Alignment == 0, "blocks must stay aligned back to back");
+
+public:
+    static constexpr size_t BLOCKS_PER_PAGE = 64;
+
+    PoolAllocator() = default;
+
+    PoolAllocator(const PoolAllocator &) = delete;
+
+    PoolAllocator &operator=(const PoolAllocator &) = delete;
+
+    PoolAllocator(PoolAllocator &&other) noexcept {
+        swap(other);
+    }
+
+    PoolAllocator &operator=(PoolAllocator &&other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~PoolAllocator() {
+        release();
+    }
+
+    /**
+     * @return an uninitialized block, throws std::bad_alloc if a new page can't be allocated
+     */
+    __forceinline T *allocate() {
+        if (freeList != nullptr) {
+            FreeBlock *block = freeList;
+            freeList = block->next;
+            return reinterpret_cast<T *>(block);
+        }
+
+        if (bump == bumpEnd) {
+            newPage();
+        }
+        return bump++;
+    }
+
+    __forceinline void deallocate(T *ptr) noexcept {
+        auto *block = reinterpret_cast<FreeBlock *>(ptr);
+        block->next = freeList;
+        freeList = block;
+    }
+
+    /**
+     * Return every page, invalidating all blocks at once.
+     */
+    void release() noexcept {
+        for (T *page: pages) {
+            alignedFree(page);
+        }
+        pages.clear();
+        freeList = nullptr;
+        bump = bumpEnd = nullptr;
+    }
+
+    void swap(PoolAllocator &other) noexcept {
+        std::swap(pages, other.pages);
+        std::swap(freeList, other.freeList);
+        std::swap(bump, other.bump);
+        std::swap(bumpEnd, other.bumpEnd);
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    std::vector<T *> pages;
+    FreeBlock *freeList = nullptr;
+    T *bump = nullptr;
+    T *bumpEnd = nullptr;
+
+    void newPage() {
+        pages.reserve(pages.size() + 1);
+        auto *page = static_cast<T *>(alignedAlloc(BLOCKS_PER_PAGE * sizeof(T), Alignment));
+        pages.push_back(page);
+        bump = page;
+        bumpEnd = page + BLOCKS_PER_PAGE;
+    }
+};
+
+#endif //PYFASTUTIL_POOLALLOCATOR_H
@@ -10,6 +10,7 @@
 // Detect architecture and compiler
 #if defined(__x86_64__) || defined(_M_X64) || defined(_M_IX86)
 // x86/x64 platform (Intel/AMD)
+#include <immintrin.h>
 #elif defined(__aarch64__) || defined(__arm__)
 // ARM platform (32-bit or 64-bit)
     // Using __builtin_prefetch for ARM platforms
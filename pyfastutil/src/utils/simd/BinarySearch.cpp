@@ -0,0 +1,186 @@
+//
+// Created by xia__mc on 2024/12/21.
+//
+
+#include "BinarySearch.h"
+
+#include <bit>
+#include <vector>
+
+#include "utils/memory/PreFetch.h"
+
+namespace simd {
+
+    /**
+     * Below this many elements data stays in the near caches, and a plain search beats building a layout.
+     */
+    static constexpr size_t EYTZINGER_MIN_SIZE = 1 << 16;
+
+    /**
+     * The Eytzinger layout costs a pass over data, it needs at least size / this many needles to pay off.
+     */
+    static constexpr size_t EYTZINGER_MIN_RATIO = 16;
+
+    template<bool Right, typename T>
+    static __forceinline bool before(T element, T value) {
+        return Right ? element <= value : element < value;
+    }
+
+    /**
+     * Binary search without a branch on the comparison, the halving is a conditional move.
+     * Both possible next probes are prefetched, so the miss of the next step overlaps this one.
+     */
+    template<bool Right, typename T>
+    static __forceinline size_t bisect(const T *data, size_t size, T value) {
+        if (size == 0) {
+            return 0;
+        }
+
+        const T *base = data;
+        size_t remaining = size;
+        while (remaining > 1) {
+            const size_t half = remaining / 2;
+            prefetchL1(base + half / 2);
+            prefetchL1(base + half + half / 2);
+            base = before<Right>(base[half], value) ? base + half : base;
+            remaining -= half;
+        }
+        return static_cast<size_t>(base - data) + before<Right>(*base, value);
+    }
+
+    /**
+     * Needles searched together in the Eytzinger layout. Their paths don't depend on each other,
+     * so their misses overlap instead of queueing behind one another.
+     */
+    static constexpr size_t EYTZINGER_LANES = 8;
+
+    /**
+     * Data in breadth first order: node k has children 2k and 2k + 1, tree[0] is unused.
+     * The first levels share a few cache lines, and the 64 / sizeof(T) descendants four (or three)
+     * levels down are adjacent, so one prefetch covers them.
+     */
+    template<typename T>
+    class Eytzinger {
+    public:
+        Eytzinger(const T *data, size_t size) : tree(size + 1), size(size), height(std::bit_width(size)) {
+            fill(data, 0, 1);
+        }
+
+        template<bool Right>
+        void search(const T *needles, size_t needleCount, int *out) const {
+            size_t i = 0;
+            for (; i + EYTZINGER_LANES <= needleCount; i += EYTZINGER_LANES) {
+                size_t k[EYTZINGER_LANES];
+                for (size_t lane = 0; lane < EYTZINGER_LANES; lane++) {
+                    k[lane] = 1;
+                }
+                // Every level above the last is full
+                for (size_t level = 1; level < height; level++) {
+                    for (size_t lane = 0; lane < EYTZINGER_LANES; lane++) {
+                        k[lane] = descend<Right>(k[lane], needles[i + lane]);
+                    }
+                }
+                for (size_t lane = 0; lane < EYTZINGER_LANES; lane++) {
+                    if (k[lane] <= size) {
+                        k[lane] = 2 * k[lane] + before<Right>(tree[k[lane]], needles[i + lane]);
+                    }
+                    out[i + lane] = position(k[lane]);
+                }
+            }
+
+            for (; i < needleCount; i++) {
+                size_t k = 1;
+                while (k <= size) {
+                    k = descend<Right>(k, needles[i]);
+                }
+                out[i] = position(k);
+            }
+        }
+
+    private:
+        std::vector<T> tree;
+        size_t size;
+        size_t height;
+
+        size_t fill(const T *data, size_t i, size_t k) {
+            if (k <= size) {
+                i = fill(data, i, 2 * k);
+                tree[k] = data[i];
+                i = fill(data, i + 1, 2 * k + 1);
+            }
+            return i;
+        }
+
+        template<bool Right>
+        __forceinline size_t descend(size_t k, T value) const {
+            static constexpr size_t NODES_PER_LINE = 64 / sizeof(T);
+
+            prefetchL1(tree.data() + k * NODES_PER_LINE);
+            return 2 * k + before<Right>(tree[k], value);
+        }
+
+        /**
+         * Index in data of the result of a finished search, k being the node it fell out of the tree at.
+         */
+        [[nodiscard]] __forceinline int position(size_t k) const {
+            // The answer is the last node the search went left at: drop the right turns after it, then it
+            k >>= std::countr_one(k) + 1;
+            if (k == 0) {
+                return static_cast<int>(size);
+            }
+
+            // In-order rank if the last level were full, less the missing leaves of that level before it
+            const size_t depth = std::bit_width(k) - 1;
+            const size_t rank = ((2 * (k - (size_t(1) << depth)) + 1) << (height - 1 - depth)) - 1;
+            const size_t leaves = size - (size_t(1) << (height - 1)) + 1;
+            const size_t leavesBefore = (rank + 1) / 2;
+            return static_cast<int>(leavesBefore > leaves ? rank - (leavesBefore - leaves) : rank);
+        }
+    };
+
+    template<bool Right, typename T>
+    static void searchSortedImpl(const T *data, size_t size, const T *needles, size_t needleCount, int *out) {
+        if (size >= EYTZINGER_MIN_SIZE && needleCount >= size / EYTZINGER_MIN_RATIO) {
+            const Eytzinger<T> layout(data, size);
+            layout.template search<Right>(needles, needleCount, out);
+            return;
+        }
+
+        for (size_t i = 0; i < needleCount; i++) {
+            out[i] = static_cast<int>(bisect<Right>(data, size, needles[i]));
+        }
+    }
+
+    size_t bisectLeft(const int *data, size_t size, int value) {
+        return bisect<false>(data, size, value);
+    }
+
+    size_t bisectLeft(const long long *data, size_t size, long long value) {
+        return bisect<false>(data, size, value);
+    }
+
+    size_t bisectRight(const int *data, size_t size, int value) {
+        return bisect<true>(data, size, value);
+    }
+
+    size_t bisectRight(const long long *data, size_t size, long long value) {
+        return bisect<true>(data, size, value);
+    }
+
+    void searchSorted(const int *data, size_t size, const int *needles, size_t needleCount, bool right, int *out) {
+        if (right) {
+            searchSortedImpl<true>(data, size, needles, needleCount, out);
+        } else {
+            searchSortedImpl<false>(data, size, needles, needleCount, out);
+        }
+    }
+
+    void searchSorted(const long long *data, size_t size, const long long *needles, size_t needleCount, bool right,
+                      int *out) {
+        if (right) {
+            searchSortedImpl<true>(data, size, needles, needleCount, out);
+        } else {
+            searchSortedImpl<false>(data, size, needles, needleCount, out);
+        }
+    }
+}
@@ -0,0 +1,38 @@
+//
+// Created by xia__mc on 2024/12/21.
+//
+
+#ifndef PYFASTUTIL_BINARYSEARCH_H
+#define PYFASTUTIL_BINARYSEARCH_H
+
+#include <cstddef>
+#include "Compat.h"
+
+namespace simd {
+
+    /*
+     * Searches in data sorted ascending, the result is unspecified if it isn't.
+     * Like Python's bisect, the left search returns the position of the first element not less than value,
+     * the right search the position of the first element greater than value.
+     */
+
+    size_t bisectLeft(const int *data, size_t size, int value);
+
+    size_t bisectLeft(const long long *data, size_t size, long long value);
+
+    size_t bisectRight(const int *data, size_t size, int value);
+
+    size_t bisectRight(const long long *data, size_t size, long long value);
+
+    /**
+     * out[i] = bisectLeft (or bisectRight if right) of needles[i], for every needle.
+     * Large batches over large data are searched in an Eytzinger (breadth first) copy of data,
+     * throws std::bad_alloc if it can't be allocated. size must fit in an int.
+     */
+    void searchSorted(const int *data, size_t size, const int *needles, size_t needleCount, bool right, int *out);
+
+    void searchSorted(const long long *data, size_t size, const long long *needles, size_t needleCount, bool right,
+                      int *out);
+}
+
+#endif //PYFASTUTIL_BINARYSEARCH_H
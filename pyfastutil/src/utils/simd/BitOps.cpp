@@ -0,0 +1,404 @@
+//
+// Created by xia__mc on 2024/12/19.
+//
+
+#include "BitOps.h"
+
+#include <bit>
+#include <array>
+
+#if !defined(__arm__) && !defined(__arm64__)
+
+#include <immintrin.h>
+
+#endif
+
+#include "SIMDHelper.h"
+
+namespace simd {
+
+    using PopcountKernel = size_t (*)(const unsigned long long *words, size_t size);
+
+    using BinaryKernel = void (*)(const unsigned long long *left, const unsigned long long *right,
+                                  unsigned long long *out, size_t size);
+
+    using NotKernel = void (*)(unsigned long long *words, size_t size);
+
+    using CompressKernel = size_t (*)(const int *data, size_t size, const unsigned long long *mask, int *out);
+
+    enum class BitOp {
+        AND, OR, XOR, AND_NOT
+    };
+
+    static constexpr unsigned long long ALL_BITS = ~0ULL;
+
+    static constexpr size_t WORD_BITS = 64;
+
+    template<BitOp Op>
+    static __forceinline unsigned long long applyOp(unsigned long long left, unsigned long long right) {
+        if constexpr (Op == BitOp::AND) {
+            return left & right;
+        } else if constexpr (Op == BitOp::OR) {
+            return left | right;
+        } else if constexpr (Op == BitOp::XOR) {
+            return left ^ right;
+        } else {
+            return left & ~right;
+        }
+    }
+
+    static __forceinline size_t popcountTail(const unsigned long long *words, size_t size, size_t i) {
+        size_t count = 0;
+        for (; i < size; ++i) {
+            count += std::popcount(words[i]);
+        }
+        return count;
+    }
+
+    static size_t popcountBaseline(const unsigned long long *words, size_t size) {
+        return popcountTail(words, size, 0);
+    }
+
+    template<BitOp Op>
+    static void binaryBaseline(const unsigned long long *left, const unsigned long long *right,
+                               unsigned long long *out, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            out[i] = applyOp<Op>(left[i], right[i]);
+        }
+    }
+
+    static void notBaseline(unsigned long long *words, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            words[i] = ~words[i];
+        }
+    }
+
+    /**
+     * Compress data[i, size) with a branchless loop, after written elements were already copied to out.
+     * written must not be greater than i.
+     */
+    static __forceinline size_t compressTail(const int *data, size_t size, const unsigned long long *mask,
+                                             int *out, size_t i, size_t written) {
+        // out[written] is at most one past the last element copied, inside the padding
+        for (; i < size; ++i) {
+            out[written] = data[i];
+            written += (mask[i / WORD_BITS] >> (i % WORD_BITS)) & 1;
+        }
+        return written;
+    }
+
+    static size_t compressBaseline(const int *data, size_t size, const unsigned long long *mask, int *out) {
+        return compressTail(data, size, mask, out, 0, 0);
+    }
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "portability-simd-intrinsics"
+#if !defined(__arm__) && !defined(__arm64__)
+
+    /**
+     * Count the bits of every byte with two nibble lookups and sum them per 64-bit lane.
+     */
+    static SIMD_TARGET_AVX2 size_t popcountAVX2(const unsigned long long *words, size_t size) {
+        constexpr size_t WORDS = AVX2_BLOCK_SIZE / sizeof(unsigned long long);
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+
+        __m256i counts = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + WORDS <= size; i += WORDS) {
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + i));
+            const __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(vec, lowNibbles));
+            const __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(vec, 4), lowNibbles));
+            counts = _mm256_add_epi64(counts, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+        }
+
+        alignas(32) unsigned long long lanes[WORDS];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), counts);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3] + popcountTail(words, size, i);
+    }
+
+    template<BitOp Op>
+    static SIMD_TARGET_AVX2 void binaryAVX2(const unsigned long long *left, const unsigned long long *right,
+                                            unsigned long long *out, size_t size) {
+        constexpr size_t WORDS = AVX2_BLOCK_SIZE / sizeof(unsigned long long);
+
+        size_t i = 0;
+        for (; i + WORDS <= size; i += WORDS) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(left + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + i));
+            __m256i result;
+            if constexpr (Op == BitOp::AND) {
+                result = _mm256_and_si256(a, b);
+            } else if constexpr (Op == BitOp::OR) {
+                result = _mm256_or_si256(a, b);
+            } else if constexpr (Op == BitOp::XOR) {
+                result = _mm256_xor_si256(a, b);
+            } else {
+                result = _mm256_andnot_si256(b, a);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), result);
+        }
+
+        for (; i < size; ++i) {
+            out[i] = applyOp<Op>(left[i], right[i]);
+        }
+    }
+
+    static SIMD_TARGET_AVX2 void notAVX2(unsigned long long *words, size_t size) {
+        constexpr size_t WORDS = AVX2_BLOCK_SIZE / sizeof(unsigned long long);
+        const __m256i ones = _mm256_set1_epi64x(-1);
+
+        size_t i = 0;
+        for (; i + WORDS <= size; i += WORDS) {
+            auto *pointer = reinterpret_cast<__m256i *>(words + i);
+            _mm256_storeu_si256(pointer, _mm256_xor_si256(_mm256_loadu_si256(pointer), ones));
+        }
+
+        for (; i < size; ++i) {
+            words[i] = ~words[i];
+        }
+    }
+
+    /**
+     * _mm256_permutevar8x32_epi32 indices that move the lanes picked by a byte of the mask to the front.
+     */
+    struct CompressTable {
+        alignas(32) std::array<std::array<int, 8>, 256> front{};
+
+        constexpr CompressTable() {
+            for (size_t mask = 0; mask < 256; ++mask) {
+                size_t picked = 0;
+                for (size_t lane = 0; lane < 8; ++lane) {
+                    if ((mask >> lane & 1) != 0) {
+                        front[mask][picked++] = static_cast<int>(lane);
+                    }
+                }
+            }
+        }
+    };
+
+    static constexpr CompressTable COMPRESS_TABLE{};
+
+    /*
+     * The compress kernels always store whole vectors. Every store starts at the next free element of out,
+     * so the unused lanes land in the padding or are overwritten later.
+     */
+
+    static SIMD_TARGET_AVX2 size_t compressAVX2(const int *data, size_t size, const unsigned long long *mask,
+                                                int *out) {
+        size_t written = 0;
+        size_t i = 0;
+        for (; i + WORD_BITS <= size; i += WORD_BITS) {
+            const unsigned long long word = mask[i / WORD_BITS];
+            if (word == 0) {
+                continue;
+            }
+
+            if (word == ALL_BITS) {
+                for (size_t j = 0; j < WORD_BITS; j += AVX2_INTS) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written + j),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i + j)));
+                }
+                written += WORD_BITS;
+                continue;
+            }
+
+            for (size_t j = 0; j < WORD_BITS; j += AVX2_INTS) {
+                const auto bits = static_cast<unsigned int>(word >> j) & 0xFF;
+                const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i + j));
+                const __m256i indices = _mm256_load_si256(
+                        reinterpret_cast<const __m256i *>(COMPRESS_TABLE.front[bits].data()));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written),
+                                    _mm256_permutevar8x32_epi32(vec, indices));
+                written += std::popcount(bits);
+            }
+        }
+
+        return compressTail(data, size, mask, out, i, written);
+    }
+
+    SIMD_AVX512_BEGIN
+
+    static size_t popcountAVX512(const unsigned long long *words, size_t size) {
+        constexpr size_t WORDS = AVX512_BLOCK_SIZE / sizeof(unsigned long long);
+        const __m512i lookup = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+        const __m512i lowNibbles = _mm512_set1_epi8(0x0F);
+
+        __m512i counts = _mm512_setzero_si512();
+        size_t i = 0;
+        for (; i + WORDS <= size; i += WORDS) {
+            const __m512i vec = _mm512_loadu_si512(words + i);
+            const __m512i low = _mm512_shuffle_epi8(lookup, _mm512_and_si512(vec, lowNibbles));
+            const __m512i high = _mm512_shuffle_epi8(lookup, _mm512_and_si512(_mm512_srli_epi16(vec, 4), lowNibbles));
+            counts = _mm512_add_epi64(counts, _mm512_sad_epu8(_mm512_add_epi8(low, high), _mm512_setzero_si512()));
+        }
+
+        return static_cast<size_t>(_mm512_reduce_add_epi64(counts)) + popcountTail(words, size, i);
+    }
+
+    template<BitOp Op>
+    static void binaryAVX512(const unsigned long long *left, const unsigned long long *right,
+                             unsigned long long *out, size_t size) {
+        constexpr size_t WORDS = AVX512_BLOCK_SIZE / sizeof(unsigned long long);
+
+        size_t i = 0;
+        for (; i + WORDS <= size; i += WORDS) {
+            const __m512i a = _mm512_loadu_si512(left + i);
+            const __m512i b = _mm512_loadu_si512(right + i);
+            __m512i result;
+            if constexpr (Op == BitOp::AND) {
+                result = _mm512_and_si512(a, b);
+            } else if constexpr (Op == BitOp::OR) {
+                result = _mm512_or_si512(a, b);
+            } else if constexpr (Op == BitOp::XOR) {
+                result = _mm512_xor_si512(a, b);
+            } else {
+                result = _mm512_andnot_si512(b, a);
+            }
+            _mm512_storeu_si512(out + i, result);
+        }
+
+        if (i < size) {
+            const auto rest = static_cast<__mmask8>((1u << (size - i)) - 1);
+            const __m512i a = _mm512_maskz_loadu_epi64(rest, left + i);
+            const __m512i b = _mm512_maskz_loadu_epi64(rest, right + i);
+            __m512i result;
+            if constexpr (Op == BitOp::AND) {
+                result = _mm512_and_si512(a, b);
+            } else if constexpr (Op == BitOp::OR) {
+                result = _mm512_or_si512(a, b);
+            } else if constexpr (Op == BitOp::XOR) {
+                result = _mm512_xor_si512(a, b);
+            } else {
+                result = _mm512_andnot_si512(b, a);
+            }
+            _mm512_mask_storeu_epi64(out + i, rest, result);
+        }
+    }
+
+    static void notAVX512(unsigned long long *words, size_t size) {
+        constexpr size_t WORDS = AVX512_BLOCK_SIZE / sizeof(unsigned long long);
+        const __m512i ones = _mm512_set1_epi64(-1);
+
+        size_t i = 0;
+        for (; i + WORDS <= size; i += WORDS) {
+            _mm512_storeu_si512(words + i, _mm512_xor_si512(_mm512_loadu_si512(words + i), ones));
+        }
+
+        if (i < size) {
+            const auto rest = static_cast<__mmask8>((1u << (size - i)) - 1);
+            _mm512_mask_storeu_epi64(words + i, rest, _mm512_xor_si512(_mm512_maskz_loadu_epi64(rest, words + i), ones));
+        }
+    }
+
+    static size_t compressAVX512(const int *data, size_t size, const unsigned long long *mask, int *out) {
+        size_t written = 0;
+        size_t i = 0;
+        for (; i + WORD_BITS <= size; i += WORD_BITS) {
+            const unsigned long long word = mask[i / WORD_BITS];
+            if (word == 0) {
+                continue;
+            }
+
+            if (word == ALL_BITS) {
+                for (size_t j = 0; j < WORD_BITS; j += AVX512_INTS) {
+                    _mm512_storeu_si512(out + written + j, _mm512_loadu_si512(data + i + j));
+                }
+                written += WORD_BITS;
+                continue;
+            }
+
+            // compress in registers and store whole vectors, compress stores to memory are slow on some CPUs
+            for (size_t j = 0; j < WORD_BITS; j += AVX512_INTS) {
+                const auto bits = static_cast<__mmask16>(word >> j);
+                _mm512_storeu_si512(out + written, _mm512_maskz_compress_epi32(bits, _mm512_loadu_si512(data + i + j)));
+                written += std::popcount(static_cast<unsigned int>(bits));
+            }
+        }
+
+        return compressTail(data, size, mask, out, i, written);
+    }
+
+    SIMD_AVX512_END
+
+    static SIMD_TARGET_AVX512_VPOPCNTDQ size_t popcountAVX512VPOPCNTDQ(const unsigned long long *words, size_t size) {
+        constexpr size_t WORDS = AVX512_BLOCK_SIZE / sizeof(unsigned long long);
+
+        __m512i counts = _mm512_setzero_si512();
+        size_t i = 0;
+        for (; i + WORDS <= size; i += WORDS) {
+            counts = _mm512_add_epi64(counts, _mm512_popcnt_epi64(_mm512_loadu_si512(words + i)));
+        }
+
+        if (i < size) {
+            const auto rest = static_cast<__mmask8>((1u << (size - i)) - 1);
+            counts = _mm512_add_epi64(counts, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(rest, words + i)));
+        }
+
+        return static_cast<size_t>(_mm512_reduce_add_epi64(counts));
+    }
+
+#endif
+#pragma clang diagnostic pop
+
+    // Chosen by initBitOps() at import. Start at the baseline so an early call is still safe.
+    static PopcountKernel popcountKernel = popcountBaseline;
+    static BinaryKernel andKernel = binaryBaseline<BitOp::AND>;
+    static BinaryKernel orKernel = binaryBaseline<BitOp::OR>;
+    static BinaryKernel xorKernel = binaryBaseline<BitOp::XOR>;
+    static BinaryKernel andNotKernel = binaryBaseline<BitOp::AND_NOT>;
+    static NotKernel notKernel = notBaseline;
+    static CompressKernel compressKernel = compressBaseline;
+
+    void initBitOps() {
+#if !defined(__arm__) && !defined(__arm64__)
+        if (IS_AVX512_SUPPORTED) {
+            popcountKernel = IS_AVX512_VPOPCNTDQ_SUPPORTED ? popcountAVX512VPOPCNTDQ : popcountAVX512;
+            andKernel = binaryAVX512<BitOp::AND>;
+            orKernel = binaryAVX512<BitOp::OR>;
+            xorKernel = binaryAVX512<BitOp::XOR>;
+            andNotKernel = binaryAVX512<BitOp::AND_NOT>;
+            notKernel = notAVX512;
+            compressKernel = compressAVX512;
+        } else if (IS_AVX2_SUPPORTED) {
+            popcountKernel = popcountAVX2;
+            andKernel = binaryAVX2<BitOp::AND>;
+            orKernel = binaryAVX2<BitOp::OR>;
+            xorKernel = binaryAVX2<BitOp::XOR>;
+            andNotKernel = binaryAVX2<BitOp::AND_NOT>;
+            notKernel = notAVX2;
+            compressKernel = compressAVX2;
+        }
+#endif
+    }
+
+    size_t simdPopcount(const unsigned long long *words, size_t size) {
+        return popcountKernel(words, size);
+    }
+
+    void simdAnd(const unsigned long long *left, const unsigned long long *right, unsigned long long *out, size_t size) {
+        andKernel(left, right, out, size);
+    }
+
+    void simdOr(const unsigned long long *left, const unsigned long long *right, unsigned long long *out, size_t size) {
+        orKernel(left, right, out, size);
+    }
+
+    void simdXor(const unsigned long long *left, const unsigned long long *right, unsigned long long *out, size_t size) {
+        xorKernel(left, right, out, size);
+    }
+
+    void simdAndNot(const unsigned long long *left, const unsigned long long *right, unsigned long long *out,
+                    size_t size) {
+        andNotKernel(left, right, out, size);
+    }
+
+    void simdNot(unsigned long long *words, size_t size) {
+        notKernel(words, size);
+    }
+
+    size_t simdCompress(const int *data, size_t size, const unsigned long long *mask, int *out) {
+        return compressKernel(data, size, mask, out);
+    }
+}
@@ -0,0 +1,56 @@
+//
+// Created by xia__mc on 2024/12/19.
+//
+
+#ifndef PYFASTUTIL_BITOPS_H
+#define PYFASTUTIL_BITOPS_H
+
+#include <cstddef>
+#include "Compat.h"
+
+namespace simd {
+
+    void initBitOps();
+
+    /**
+     * Number of set bits in the first size words.
+     */
+    size_t simdPopcount(const unsigned long long *words, size_t size);
+
+    /*
+     * Word-wise out[i] = left[i] op right[i] for the first size words.
+     * out may be left or right, but must not overlap them otherwise.
+     */
+
+    void simdAnd(const unsigned long long *left, const unsigned long long *right, unsigned long long *out, size_t size);
+
+    void simdOr(const unsigned long long *left, const unsigned long long *right, unsigned long long *out, size_t size);
+
+    void simdXor(const unsigned long long *left, const unsigned long long *right, unsigned long long *out, size_t size);
+
+    /**
+     * out[i] = left[i] & ~right[i], the words of left that aren't in right.
+     */
+    void simdAndNot(const unsigned long long *left, const unsigned long long *right, unsigned long long *out,
+                    size_t size);
+
+    /**
+     * Word-wise words[i] = ~words[i] for the first size words.
+     */
+    void simdNot(unsigned long long *words, size_t size);
+
+    /**
+     * simdCompress stores whole vectors, out needs this many elements of room past the last one copied.
+     */
+    static constexpr size_t COMPRESS_PADDING = 16;
+
+    /**
+     * Copy the elements of data whose bit is set in mask to out, in order. Bit i of the mask is
+     * bit i % 64 of mask[i / 64]. out must have room for the copied elements plus COMPRESS_PADDING,
+     * and must not overlap data.
+     * @return how many elements were copied
+     */
+    size_t simdCompress(const int *data, size_t size, const unsigned long long *mask, int *out);
+}
+
+#endif //PYFASTUTIL_BITOPS_H
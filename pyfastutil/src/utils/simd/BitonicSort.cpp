@@ -4,670 +4,439 @@
 #include "BitonicSort.h"
 
 #include <vector>
+#include <memory>
 #include <algorithm>
 
 #if !defined(__arm__) && !defined(__arm64__)
 
 #include <immintrin.h>
-#include "utils/simd/SIMDUtils.h"
 
 #endif
 
 #include <utils/PythonPCH.h>
 #include "SIMDHelper.h"
+#include "utils/simd/SIMDUtils.h"
 #include "utils/include/TimSort.h"
 #include "utils/memory/AlignedAllocator.h"
-#include "utils/memory/PreFetch.h"
+#include "utils/thread/ScheduledThreadPool.h"
 
 template<typename T>
 concept IntOrLongLong = std::same_as<T, int> || std::same_as<T, long long>;
 
 namespace simd {
-#if !defined(__arm__) && !defined(__arm64__)
-    struct alignas(32) AVX2_MARKS {
-        alignas(32) const __m256i M1 = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
-        alignas(32) const __m256i M2 = _mm256_set_epi32(6, 7, 4, 5, 2, 3, 0, 1);
-        alignas(32) const __m256i M3 = _mm256_set_epi32(5, 4, 7, 6, 1, 0, 3, 2);
-        alignas(32) const __m256i M4 = _mm256_set_epi32(3, 2, 1, 0, 7, 6, 5, 4);
-    };
-    struct alignas(64) AVX512_MARKS {
-        alignas(64) const __m512i M1 = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
-        alignas(64) const __m512i M2 = _mm512_set_epi32(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
-        alignas(64) const __m512i M3 = _mm512_set_epi32(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
-        alignas(64) const __m512i M4 = _mm512_set_epi32(11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12);
-    };
-
-    static AVX2_MARKS *avx2Marks = nullptr;
-    static AVX512_MARKS *avx512Marks = nullptr;
-#endif
-
-    void initBitonicSort() {
-#if !defined(__arm__) && !defined(__arm64__)
-        if (IS_AVX2_SUPPORTED && avx2Marks == nullptr) {
-            avx2Marks = new AVX2_MARKS();
-        }
-        if (IS_AVX512_SUPPORTED && avx512Marks == nullptr) {
-            avx512Marks = new AVX512_MARKS();
-        }
-#endif
-    }
 
-#pragma clang diagnostic push
-#pragma ide diagnostic ignored "portability-simd-intrinsics"
-#pragma ide diagnostic ignored "NullDereference"
-#if !defined(__arm__) && !defined(__arm64__)
-
-    __forceinline void sort8Epi32AVX2(__m256i &vec) {
-        __m256i swapped = _mm256_permutevar8x32_epi32(vec, avx2Marks->M1);
-        vec = _mm256_min_epi32(vec, swapped);
-
-        swapped = _mm256_permutevar8x32_epi32(vec, avx2Marks->M2);
-        vec = _mm256_min_epi32(vec, swapped);
-
-        swapped = _mm256_permutevar8x32_epi32(vec, avx2Marks->M3);
-        vec = _mm256_min_epi32(vec, swapped);
-
-        swapped = _mm256_permutevar8x32_epi32(vec, avx2Marks->M4);
-        vec = _mm256_min_epi32(vec, swapped);
-    }
+    template<IntOrLongLong T>
+    using SortKernel = void (*)(T *data, size_t size);
 
     /**
-     * sort 8 nums with avx2 reversed
+     * Sort without simd, std::sort for small inputs and timsort for the rest.
      */
-    __forceinline void sort8Epi32AVX2Reversed(__m256i &vec) {
-        __m256i swapped = _mm256_permutevar8x32_epi32(vec, avx2Marks->M1);
-        vec = _mm256_max_epi32(vec, swapped);
-
-        swapped = _mm256_permutevar8x32_epi32(vec, avx2Marks->M2);
-        vec = _mm256_max_epi32(vec, swapped);
-
-        swapped = _mm256_permutevar8x32_epi32(vec, avx2Marks->M3);
-        vec = _mm256_max_epi32(vec, swapped);
-
-        swapped = _mm256_permutevar8x32_epi32(vec, avx2Marks->M4);
-        vec = _mm256_max_epi32(vec, swapped);
+    template<IntOrLongLong T>
+    static void sortBaseline(T *data, size_t size) {
+        if (size > 5000) {
+            gfx::timsort(data, data + size);
+        } else {
+            std::sort(data, data + size);
+        }
     }
 
     /**
-     * sort 16 nums with avx512
+     * Merge 2 sorted runs into out.
+     * Branchless, as the comparison is unpredictable on random data.
      */
-    __forceinline void sort16Epi32AVX512(__m512i &vec) {
-        __m512i swapped = _mm512_permutexvar_epi32(avx512Marks->M1, vec);
-        vec = _mm512_min_epi32(vec, swapped);
-
-        swapped = _mm512_permutexvar_epi32(avx512Marks->M2, vec);
-        vec = _mm512_min_epi32(vec, swapped);
-
-        swapped = _mm512_permutexvar_epi32(avx512Marks->M3, vec);
-        vec = _mm512_min_epi32(vec, swapped);
+    template<IntOrLongLong T>
+    static __forceinline void mergeRuns(const T *a, const T *aEnd, const T *b, const T *bEnd, T *out) {
+        while (a != aEnd && b != bEnd) {
+            const bool takeB = *b < *a;
+            *out++ = takeB ? *b : *a;
+            a += !takeB;
+            b += takeB;
+        }
 
-        swapped = _mm512_permutexvar_epi32(avx512Marks->M4, vec);
-        vec = _mm512_min_epi32(vec, swapped);
+        out = std::copy(a, aEnd, out);
+        std::copy(b, bEnd, out);
     }
 
     /**
-     * sort 16 nums with avx512
+     * Merge sorted blocks of blockSize elements bottom-up, the last block may be shorter.
      */
-    __forceinline void sort16Epi32AVX512Reversed(__m512i &vec) {
-        __m512i swapped = _mm512_permutexvar_epi32(avx512Marks->M1, vec);
-        vec = _mm512_max_epi32(vec, swapped);
-
-        swapped = _mm512_permutexvar_epi32(avx512Marks->M2, vec);
-        vec = _mm512_max_epi32(vec, swapped);
-
-        swapped = _mm512_permutexvar_epi32(avx512Marks->M3, vec);
-        vec = _mm512_max_epi32(vec, swapped);
-
-        swapped = _mm512_permutexvar_epi32(avx512Marks->M4, vec);
-        vec = _mm512_max_epi32(vec, swapped);
-    }
-
-    [[maybe_unused]] __forceinline void doSingleMerge(const size_t &left, const size_t &mid, const size_t &right,
-                                                      std::vector<int, AlignedAllocator<int, 64>> &src,
-                                                      std::vector<int, AlignedAllocator<int, 64>> &dst) {
-        size_t i = left, j = mid + 1, k = left;
-
-        // merge 2 sorted blocks with AVX-512
-        if (IS_AVX512_SUPPORTED) {
-            while (i <= mid - AVX512_INTS + 1 && j <= right - AVX512_INTS + 1) {
-                __m512i vec_i = _mm512_load_si512(&(src[i]));
-                __m512i vec_j = _mm512_load_si512(&(src[j]));
-
-                __m512i min_vals = _mm512_min_epi32(vec_i, vec_j);
-
-                _mm512_store_si512(&(dst[k]), min_vals);
-                k += AVX512_INTS;
-                i += AVX512_INTS;
-            }
-        }
-
-        // merge 2 sorted blocks with AVX2
-        if (IS_AVX2_SUPPORTED) {
-            while (i <= mid - AVX2_INTS + 1 && j <= right - AVX2_INTS + 1) {
-                __m256i vec_i = _mm256_load_si256(reinterpret_cast<__m256i *>(&(src[i])));
-                __m256i vec_j = _mm256_load_si256(reinterpret_cast<__m256i *>(&(src[j])));
-
-                __m256i min_vals = _mm256_min_epi32(vec_i, vec_j);
-
-                _mm256_store_si256((__m256i *) &(dst[k]), min_vals);
-                k += AVX2_INTS;
-                i += AVX2_INTS;
-            }
-        }
-
-        // merge 2 sorted blocks with SSE4.1
-        if (IS_SSE41_SUPPORTED) {
-            while (i <= mid - SSE41_INTS + 1 && j <= right - SSE41_INTS + 1) {
-                __m128i vec_i = _mm_load_si128((__m128i *) &(src[i]));
-                __m128i vec_j = _mm_load_si128((__m128i *) &(src[j]));
-
-                __m128i min_vals = _mm_min_epi32(vec_i, vec_j);
-
-                _mm_store_si128((__m128i *) &(dst[k]), min_vals);
-                k += SSE41_INTS;
-                i += SSE41_INTS;
-            }
+    template<IntOrLongLong T>
+    static __forceinline void mergeSortedBlocks(T *data, size_t size, size_t blockSize) {
+        if (blockSize >= size) {
+            return;
         }
 
-        // elements left
-        while (i <= mid && j <= right) {
-            if (src[i] < src[j]) {
-                dst[k++] = src[i++];
-            } else {
-                dst[k++] = src[j++];
+        std::unique_ptr<T[]> buffer(new T[size]);
+        T *src = data;
+        T *dst = buffer.get();
+        for (size_t width = blockSize; width < size; width *= 2) {
+            for (size_t left = 0; left < size; left += 2 * width) {
+                const size_t mid = std::min(left + width, size);
+                const size_t right = std::min(left + 2 * width, size);
+                mergeRuns(src + left, src + mid, src + mid, src + right, dst + left);
             }
+            std::swap(src, dst);
         }
 
-        while (i <= mid) {
-            dst[k++] = src[i++];
-        }
-
-        while (j <= right) {
-            dst[k++] = src[j++];
+        // copy the final result
+        if (src != data) {
+            simdMemCpy(src, data, size);
         }
     }
 
-    __forceinline void doSingleMerge(const size_t &left, const size_t &mid, const size_t &right,
-                                     std::vector<long long, AlignedAllocator<long long, 64>> &src,
-                                     std::vector<long long, AlignedAllocator<long long, 64>> &dst) {
-        size_t i = left, j = mid + 1, k = left;
-
-        // merge 2 sorted blocks with AVX-512
-        if (IS_AVX512_SUPPORTED) {
-            while (i <= mid - AVX512_LONG_LONGS + 1 && j <= right - AVX512_LONG_LONGS + 1) {
-                __m512i vec_i = _mm512_load_si512(&(src[i]));
-                __m512i vec_j = _mm512_load_si512(&(src[j]));
-
-                __m512i min_vals = _mm512_min_epi32(vec_i, vec_j);
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "portability-simd-intrinsics"
+#if !defined(__arm__) && !defined(__arm64__)
 
-                _mm512_store_si512(&(dst[k]), min_vals);
-                k += AVX512_LONG_LONGS;
-                i += AVX512_LONG_LONGS;
+    /**
+     * Compare-exchange steps of a bitonic sorting network over Lanes elements.
+     * At each step element i is paired with element permute[i], and keeps the larger one
+     * if its bit in maxMask is set (or its blend lane is all ones), the smaller one otherwise.
+     * Scale splits every element into that many permute lanes, for 64-bit elements on 32-bit permutes.
+     */
+    template<typename Index, size_t Lanes, size_t Scale = 1>
+    struct BitonicNetwork {
+        static constexpr size_t countSteps() {
+            size_t steps = 0;
+            for (size_t k = 2; k <= Lanes; k *= 2) {
+                for (size_t j = k / 2; j > 0; j /= 2) {
+                    ++steps;
+                }
             }
-        }
-
-        // merge 2 sorted blocks with AVX2
-        if (IS_AVX2_SUPPORTED) {
-            while (i <= mid - AVX2_LONG_LONGS + 1 && j <= right - AVX2_LONG_LONGS + 1) {
-                __m256i vec_i = _mm256_load_si256(reinterpret_cast<__m256i *>(&(src[i])));
-                __m256i vec_j = _mm256_load_si256(reinterpret_cast<__m256i *>(&(src[j])));
-
-                __m256i min_vals = _mm256_min_epi32(vec_i, vec_j);
-
-                _mm256_store_si256((__m256i *) &(dst[k]), min_vals);
-                k += AVX2_LONG_LONGS;
-                i += AVX2_LONG_LONGS;
+            return steps;
+        }
+
+        static constexpr size_t STEPS = countSteps();
+
+        alignas(64) Index permute[STEPS][Lanes * Scale]{};
+        alignas(64) Index blend[STEPS][Lanes * Scale]{};
+        unsigned int maxMask[STEPS]{};
+
+        constexpr BitonicNetwork() {
+            size_t step = 0;
+            for (size_t k = 2; k <= Lanes; k *= 2) {
+                for (size_t j = k / 2; j > 0; j /= 2, ++step) {
+                    for (size_t i = 0; i < Lanes; ++i) {
+                        // sequences with (i & k) set are sorted descending, so they can be merged at the next k
+                        const bool takeMax = ((i & k) == 0) == ((i & j) != 0);
+                        for (size_t part = 0; part < Scale; ++part) {
+                            permute[step][i * Scale + part] = static_cast<Index>((i ^ j) * Scale + part);
+                            blend[step][i * Scale + part] = takeMax ? -1 : 0;
+                        }
+                        if (takeMax) {
+                            maxMask[step] |= 1u << i;
+                        }
+                    }
+                }
             }
         }
+    };
 
-        // merge 2 sorted blocks with SSE4.1
-        if (IS_SSE41_SUPPORTED) {
-            while (i <= mid - SSE41_LONG_LONGS + 1 && j <= right - SSE41_LONG_LONGS + 1) {
-                __m128i vec_i = _mm_load_si128((__m128i *) &(src[i]));
-                __m128i vec_j = _mm_load_si128((__m128i *) &(src[j]));
-
-                __m128i min_vals = _mm_min_epi32(vec_i, vec_j);
+    static constexpr BitonicNetwork<int, AVX2_INTS> AVX2_INT_NETWORK{};
+    static constexpr BitonicNetwork<int, AVX2_LONG_LONGS, 2> AVX2_LONG_LONG_NETWORK{};
+    static constexpr BitonicNetwork<int, AVX512_INTS> AVX512_INT_NETWORK{};
+    static constexpr BitonicNetwork<long long, AVX512_LONG_LONGS> AVX512_LONG_LONG_NETWORK{};
 
-                _mm_store_si128((__m128i *) &(dst[k]), min_vals);
-                k += SSE41_LONG_LONGS;
-                i += SSE41_LONG_LONGS;
+    /**
+     * Sort the elements of vec with AVX2
+     */
+    template<IntOrLongLong T>
+    static __forceinline SIMD_TARGET_AVX2 __m256i sortVectorAVX2(__m256i vec) {
+        if constexpr (std::same_as<T, int>) {
+            for (size_t step = 0; step < AVX2_INT_NETWORK.STEPS; ++step) {
+                const auto *permute = reinterpret_cast<const __m256i *>(AVX2_INT_NETWORK.permute[step]);
+                const auto *blend = reinterpret_cast<const __m256i *>(AVX2_INT_NETWORK.blend[step]);
+
+                const __m256i swapped = _mm256_permutevar8x32_epi32(vec, _mm256_load_si256(permute));
+                vec = _mm256_blendv_epi8(_mm256_min_epi32(vec, swapped), _mm256_max_epi32(vec, swapped),
+                                         _mm256_load_si256(blend));
             }
-        }
-
-        // elements left
-        while (i <= mid && j <= right) {
-            if (src[i] < src[j]) {
-                dst[k++] = src[i++];
-            } else {
-                dst[k++] = src[j++];
+        } else {
+            // no min/max for 64-bit lanes before AVX-512
+            for (size_t step = 0; step < AVX2_LONG_LONG_NETWORK.STEPS; ++step) {
+                const auto *permute = reinterpret_cast<const __m256i *>(AVX2_LONG_LONG_NETWORK.permute[step]);
+                const auto *blend = reinterpret_cast<const __m256i *>(AVX2_LONG_LONG_NETWORK.blend[step]);
+
+                const __m256i swapped = _mm256_permutevar8x32_epi32(vec, _mm256_load_si256(permute));
+                const __m256i greater = _mm256_cmpgt_epi64(vec, swapped);
+                const __m256i min = _mm256_blendv_epi8(vec, swapped, greater);
+                const __m256i max = _mm256_blendv_epi8(swapped, vec, greater);
+                vec = _mm256_blendv_epi8(min, max, _mm256_load_si256(blend));
             }
         }
-
-        while (i <= mid) {
-            dst[k++] = src[i++];
-        }
-
-        while (j <= right) {
-            dst[k++] = src[j++];
-        }
+        return vec;
     }
 
-    [[maybe_unused]] __forceinline void
-    doSingleMergeReversed(const size_t &left, const size_t &mid, const size_t &right,
-                          std::vector<int, AlignedAllocator<int, 64>> &src,
-                          std::vector<int, AlignedAllocator<int, 64>> &dst) {
-        size_t i = left, j = mid + 1, k = left;
-
-        // merge 2 sorted blocks with AVX-512
-        while (IS_AVX512_SUPPORTED && i <= mid - AVX512_INTS + 1 && j <= right - AVX512_INTS + 1) {
-            __m512i vec_i = _mm512_load_si512(&(src[i]));
-            __m512i vec_j = _mm512_load_si512(&(src[j]));
-
-            __m512i max_vals = _mm512_max_epi32(vec_i, vec_j);
-
-            _mm512_store_si512(&(dst[k]), max_vals);
-            k += AVX512_INTS;
-            j += AVX512_INTS;
+    /**
+     * Sort the elements of vec with AVX-512
+     */
+    template<IntOrLongLong T>
+    static __forceinline SIMD_TARGET_AVX512 __m512i sortVectorAVX512(__m512i vec) {
+        if constexpr (std::same_as<T, int>) {
+            for (size_t step = 0; step < AVX512_INT_NETWORK.STEPS; ++step) {
+                const __m512i swapped = _mm512_permutexvar_epi32(
+                        _mm512_load_si512(AVX512_INT_NETWORK.permute[step]), vec);
+                vec = _mm512_mask_mov_epi32(_mm512_min_epi32(vec, swapped),
+                                            static_cast<__mmask16>(AVX512_INT_NETWORK.maxMask[step]),
+                                            _mm512_max_epi32(vec, swapped));
+            }
+        } else {
+            for (size_t step = 0; step < AVX512_LONG_LONG_NETWORK.STEPS; ++step) {
+                const __m512i swapped = _mm512_permutexvar_epi64(
+                        _mm512_load_si512(AVX512_LONG_LONG_NETWORK.permute[step]), vec);
+                vec = _mm512_mask_mov_epi64(_mm512_min_epi64(vec, swapped),
+                                            static_cast<__mmask8>(AVX512_LONG_LONG_NETWORK.maxMask[step]),
+                                            _mm512_max_epi64(vec, swapped));
+            }
         }
+        return vec;
+    }
 
-        // merge 2 sorted blocks with AVX2
-        while (IS_AVX2_SUPPORTED && i <= mid - AVX2_INTS + 1 && j <= right - AVX2_INTS + 1) {
-            __m256i vec_i = _mm256_load_si256(reinterpret_cast<__m256i *>(&(src[i])));
-            __m256i vec_j = _mm256_load_si256(reinterpret_cast<__m256i *>(&(src[j])));
+    /**
+     * Sort every full register of data in place with the network, then merge the blocks.
+     */
+    template<IntOrLongLong T>
+    static SIMD_TARGET_AVX2 void sortAVX2(T *data, size_t size) {
+        constexpr size_t BLOCK = AVX2_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = BLOCK * 4;
 
-            __m256i max_vals = _mm256_max_epi32(vec_i, vec_j);
+        size_t sortedCount = 0;
+        for (; sortedCount + BLOCK <= size; sortedCount += BLOCK) {
+            if (size - sortedCount > PREFETCH) {
+                prefetchL1(data + sortedCount + PREFETCH);
+            }
 
-            _mm256_store_si256((__m256i *) &(dst[k]), max_vals);
-            k += AVX2_INTS;
-            j += AVX2_INTS;
+            auto *block = reinterpret_cast<__m256i *>(data + sortedCount);
+            _mm256_storeu_si256(block, sortVectorAVX2<T>(_mm256_loadu_si256(block)));
         }
+        std::sort(data + sortedCount, data + size);
 
-        // merge 2 sorted blocks with SSE4.1
-        while (IS_SSE41_SUPPORTED && i <= mid - SSE41_INTS + 1 && j <= right - SSE41_INTS + 1) {
-            __m128i vec_i = _mm_load_si128((__m128i *) &(src[i]));
-            __m128i vec_j = _mm_load_si128((__m128i *) &(src[j]));
-
-            __m128i max_vals = _mm_max_epi32(vec_i, vec_j);
+        mergeSortedBlocks(data, size, BLOCK);
+    }
 
-            _mm_store_si128((__m128i *) &(dst[k]), max_vals);
-            k += SSE41_INTS;
-            j += SSE41_INTS;
-        }
+    /**
+     * Sort every full register of data in place with the network, then merge the blocks.
+     */
+    template<IntOrLongLong T>
+    static SIMD_TARGET_AVX512 void sortAVX512(T *data, size_t size) {
+        constexpr size_t BLOCK = AVX512_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = BLOCK * 4;
 
-        // elements left
-        while (i <= mid && j <= right) {
-            if (src[i] > src[j]) {
-                dst[k++] = src[i++];
-            } else {
-                dst[k++] = src[j++];
+        size_t sortedCount = 0;
+        for (; sortedCount + BLOCK <= size; sortedCount += BLOCK) {
+            if (size - sortedCount > PREFETCH) {
+                prefetchL1(data + sortedCount + PREFETCH);
             }
-        }
 
-        while (i <= mid) {
-            dst[k++] = src[i++];
+            T *block = data + sortedCount;
+            _mm512_storeu_si512(block, sortVectorAVX512<T>(_mm512_loadu_si512(block)));
         }
+        std::sort(data + sortedCount, data + size);
 
-        while (j <= right) {
-            dst[k++] = src[j++];
-        }
+        mergeSortedBlocks(data, size, BLOCK);
     }
 
-    [[maybe_unused]] __forceinline void
-    doSingleMergeReversed(const size_t &left, const size_t &mid, const size_t &right,
-                          std::vector<long long, AlignedAllocator<long long, 64>> &src,
-                          std::vector<long long, AlignedAllocator<long long, 64>> &dst) {
-        size_t i = left, j = mid + 1, k = left;
-
-        // merge 2 sorted blocks with AVX-512
-        while (IS_AVX512_SUPPORTED && i <= mid - AVX512_LONG_LONGS + 1 && j <= right - AVX512_LONG_LONGS + 1) {
-            __m512i vec_i = _mm512_load_si512(&(src[i]));
-            __m512i vec_j = _mm512_load_si512(&(src[j]));
-
-            __m512i max_vals = _mm512_max_epi32(vec_i, vec_j);
-
-            _mm512_store_si512(&(dst[k]), max_vals);
-            k += AVX512_LONG_LONGS;
-            j += AVX512_LONG_LONGS;
-        }
-
-        // merge 2 sorted blocks with AVX2
-        while (IS_AVX2_SUPPORTED && i <= mid - AVX2_LONG_LONGS + 1 && j <= right - AVX2_LONG_LONGS + 1) {
-            __m256i vec_i = _mm256_load_si256(reinterpret_cast<__m256i *>(&(src[i])));
-            __m256i vec_j = _mm256_load_si256(reinterpret_cast<__m256i *>(&(src[j])));
+#endif
+#pragma clang diagnostic pop
 
-            __m256i max_vals = _mm256_max_epi32(vec_i, vec_j);
+    // Chosen by initBitonicSort() at import. Start at the baseline so an early call is still safe.
+    static SortKernel<int> sortIntKernel = sortBaseline<int>;
+    static SortKernel<long long> sortLongLongKernel = sortBaseline<long long>;
 
-            _mm256_store_si256((__m256i *) &(dst[k]), max_vals);
-            k += AVX2_LONG_LONGS;
-            j += AVX2_LONG_LONGS;
+    void initBitonicSort() {
+#if !defined(__arm__) && !defined(__arm64__)
+        if (IS_AVX512_SUPPORTED) {
+            sortIntKernel = sortAVX512<int>;
+            sortLongLongKernel = sortAVX512<long long>;
+        } else if (IS_AVX2_SUPPORTED) {
+            sortIntKernel = sortAVX2<int>;
+            sortLongLongKernel = sortAVX2<long long>;
         }
+#endif
+    }
 
-        // merge 2 sorted blocks with SSE4.1
-        while (IS_SSE41_SUPPORTED && i <= mid - SSE41_LONG_LONGS + 1 && j <= right - SSE41_LONG_LONGS + 1) {
-            __m128i vec_i = _mm_load_si128((__m128i *) &(src[i]));
-            __m128i vec_j = _mm_load_si128((__m128i *) &(src[j]));
-
-            __m128i max_vals = _mm_max_epi32(vec_i, vec_j);
-
-            _mm_store_si128((__m128i *) &(dst[k]), max_vals);
-            k += SSE41_LONG_LONGS;
-            j += SSE41_LONG_LONGS;
-        }
+    template<IntOrLongLong T>
+    static __forceinline void doSimdsort(T *data, size_t size, bool reverse, SortKernel<T> kernel) {
+        if (size <= 1) return;
 
-        // elements left
-        while (i <= mid && j <= right) {
-            if (src[i] > src[j]) {
-                dst[k++] = src[i++];
+        if (size < 8) {
+            if (reverse) {
+                std::sort(data, data + size, std::greater<>());
             } else {
-                dst[k++] = src[j++];
+                std::sort(data, data + size);
             }
+            return;
         }
 
-        while (i <= mid) {
-            dst[k++] = src[i++];
+        // equal elements can't be told apart, so sorting ascending then reversing is fine
+        kernel(data, size);
+        if (reverse) {
+            simdReverse(data, size);
         }
+    }
 
-        while (j <= right) {
-            dst[k++] = src[j++];
-        }
+    /**
+     * Try to sort with simd optimize, or fallback if unsupported
+     * MAKE SURE VECTOR IS ALIGNED with 64 bytes!
+     * @param vector vector to sort
+     */
+    void simdsort(std::vector<int, AlignedAllocator<int, 64>> &vector, bool reverse) {
+        doSimdsort(vector.data(), vector.size(), reverse, sortIntKernel);
     }
 
     /**
-     * Merge sorted blocks with SIMD optimization, or fallback
-     * make sure aligned
+     * Try to sort with simd optimize, or fallback if unsupported
+     * MAKE SURE VECTOR IS ALIGNED with 64 bytes!
+     * @param vector vector to sort
      */
-    template<IntOrLongLong T>
-    __forceinline void mergeSortedBlocks(std::vector<T, AlignedAllocator<T, 64>> &data, const size_t &blockSize) {
-        const size_t total = data.size();
-        auto temp = std::vector<T, AlignedAllocator<T, 64>>(total);
-
-        bool cycle = true;
-        size_t mid;
-        size_t right;
-        for (size_t size = blockSize; size < total; size *= 2) {
-            size_t left = 0;
-            prefetchL1(&data + left);
-            prefetchL1(&temp + left);
-            for (; left < total; left += 2 * size) {
-                mid = std::min(left + size - 1, total - 1);
-                right = std::min(left + 2 * size - 1, total - 1);
-                if (cycle) {
-                    doSingleMerge(left, mid, right, data, temp);
-                } else {
-                    doSingleMerge(left, mid, right, temp, data);
-                }
-            }
+    void simdsort(std::vector<long long, AlignedAllocator<long long, 64>> &vector, bool reverse) {
+        doSimdsort(vector.data(), vector.size(), reverse, sortLongLongKernel);
+    }
 
-            cycle = !cycle;
-        }
+    void simdsort(int *data, size_t size, bool reverse) {
+        doSimdsort(data, size, reverse, sortIntKernel);
+    }
 
-        // copy the final result
-        if (!cycle) {
-            simdMemCpyAligned(temp.data(), data.data(), temp.size());
-        }
+    void simdsort(long long *data, size_t size, bool reverse) {
+        doSimdsort(data, size, reverse, sortLongLongKernel);
     }
 
     /**
-     * Merge sorted blocks with SIMD optimization reversed, or fallback
+     * Fewest elements a worker sorts on its own, below that the threads cost more than they save.
      */
-    template<IntOrLongLong T>
-    __forceinline void
-    mergeSortedBlocksReversed(std::vector<T, AlignedAllocator<T, 64>> &data, const size_t &blockSize) {
-        const size_t total = data.size();
-        auto temp = std::vector<T, AlignedAllocator<T, 64>>(total);
-
-        bool cycle = true;
-        size_t mid;
-        size_t right;
-        for (size_t size = blockSize; size < total; size *= 2) {
-            size_t left = 0;
-            prefetchL1(&data + left);
-            prefetchL1(&temp + left);
-            for (; left < total; left += 2 * size) {
-                mid = std::min(left + size - 1, total - 1);
-                right = std::min(left + 2 * size - 1, total - 1);
-                if (cycle) {
-                    doSingleMergeReversed(left, mid, right, data, temp);
-                } else {
-                    doSingleMergeReversed(left, mid, right, temp, data);
-                }
-            }
+    static constexpr size_t PARALLEL_SORT_MIN_CHUNK = 1 << 16;
 
-            cycle = !cycle;
+    /**
+     * Wait for every task, then rethrow the first exception, so no task is still running when it's thrown.
+     */
+    static void waitAll(std::vector<std::future<void>> &futures) {
+        for (auto &future: futures) {
+            future.wait();
         }
-
-        // copy the final result
-        if (!cycle) {
-            simdMemCpyAligned(temp.data(), data.data(), temp.size());
+        for (auto &future: futures) {
+            future.get();
         }
+        futures.clear();
     }
 
-#endif
-#pragma clang diagnostic pop
-
     /**
-     * Try to sort with simd optimize, or fallback if unsupported
-     * MAKE SURE VECTOR IS ALIGNED with 64 bytes!
-     * @param vector vector to sort
+     * How many of a are in the first diag elements of the merge of a and b, found by binary search
+     * along the merge path. Ties go to a, same as mergeRuns.
      */
-    void simdsort(std::vector<int, AlignedAllocator<int, 64>> &vector, bool reverse) {
-        const auto size = vector.size();
-        if (size <= 1) return;
-
-        const auto begin = vector.begin();
-        const auto end = vector.end();
-
-        if (size < 8) {
-            if (reverse) {
-                std::sort(begin, end, std::greater<>());
+    template<IntOrLongLong T>
+    static size_t mergePathSplit(const T *a, size_t aSize, const T *b, size_t bSize, size_t diag) {
+        size_t low = diag > bSize ? diag - bSize : 0;
+        size_t high = std::min(diag, aSize);
+        while (low < high) {
+            const size_t mid = low + (high - low) / 2;
+            if (a[mid] <= b[diag - mid - 1]) {
+                low = mid + 1;
             } else {
-                std::sort(begin, end);
+                high = mid;
             }
-            return;
         }
+        return low;
+    }
 
-#if defined(__arm__) || defined(__arm64__)
-        if (size > 5000) {
-            if (reverse) {
-                gfx::timsort(begin, end, std::greater<>());
-            } else {
-                gfx::timsort(begin, end);
-            }
-        } else {
-            if (reverse) {
-                std::sort(begin, end, std::greater<>());
-            } else {
-                std::sort(begin, end);
-            }
+    template<IntOrLongLong T>
+    static __forceinline void doSimdsortParallel(T *data, size_t size, bool reverse, size_t threads,
+                                                 SortAlgorithm algorithm, SortKernel<T> kernel) {
+        ScheduledThreadPool &pool = ScheduledThreadPool::shared();
+        if (threads == 0) {
+            threads = pool.size();
         }
-#else
-        if (!IS_AVX2_SUPPORTED && !IS_AVX512_SUPPORTED) {
-            // fallback
-            if (size > 5000) {
+
+        const size_t chunks = std::min(threads, size / PARALLEL_SORT_MIN_CHUNK);
+        if (chunks <= 1) {
+            if (resolveSortAlgorithm<T>(algorithm, size) == SortAlgorithm::RADIX) {
+                radixsort(data, size);
                 if (reverse) {
-                    gfx::timsort(begin, end, std::greater<>());
-                } else {
-                    gfx::timsort(begin, end);
+                    simdReverse(data, size);
                 }
             } else {
-                if (reverse) {
-                    std::sort(begin, end, std::greater<>());
-                } else {
-                    std::sort(begin, end);
-                }
+                doSimdsort(data, size, reverse, kernel);
             }
             return;
         }
 
-        // get pointer to do simd
-        auto *data = &(*begin);
-        size_t sortedCount = 0;
-        size_t minBlockSize = AVX512_INTS;
-
-        if (IS_AVX512_SUPPORTED && sortedCount + AVX512_INTS < size) {
-            // simd sort with avx512
-            prefetchL1(avx512Marks);
-            for (; sortedCount + AVX512_INTS <= size; sortedCount += AVX512_INTS) {
-                if (size - sortedCount > AVX512_PREFETCH_INT) {
-                    prefetchL1(data + sortedCount + AVX512_PREFETCH_INT);
-                }
-
-                __m512i vec = _mm512_load_si512(data + sortedCount);  // load
-                if (reverse) {  // sort
-                    sort16Epi32AVX512Reversed(vec);
-                } else {
-                    sort16Epi32AVX512(vec);
-                }
-                _mm512_store_si512(data + sortedCount, vec);  // store
-            }
+        if (resolveSortAlgorithm<T>(algorithm, size / chunks) == SortAlgorithm::RADIX) {
+            kernel = radixsort;
         }
 
-        if (IS_AVX2_SUPPORTED && sortedCount + AVX2_INTS < size) {
-            // simd sort with avx2
-            prefetchL1(avx2Marks);
-            for (; sortedCount + AVX2_INTS <= size; sortedCount += AVX2_INTS) {
-                if (size - sortedCount > AVX2_PREFETCH_INT) {
-                    prefetchL1(data + sortedCount + AVX2_PREFETCH_INT);
-                }
-
-                __m256i vec = _mm256_load_si256((__m256i *) (data + sortedCount));  // load
-                if (reverse) {  // sort
-                    sort8Epi32AVX2Reversed(vec);
-                } else {
-                    sort8Epi32AVX2(vec);
-                }
-                _mm256_store_si256((__m256i *) (data + sortedCount), vec);  // store
-            }
-            minBlockSize = 8;
+        // sort every chunk on its own worker
+        std::vector<size_t> bounds(chunks + 1);
+        for (size_t i = 0; i <= chunks; ++i) {
+            bounds[i] = size / chunks * i + std::min(i, size % chunks);
         }
 
-        if (sortedCount < size) {
-            if (reverse) {
-                std::sort(begin + static_cast<std::vector<int>::difference_type>(sortedCount), end,
-                          std::greater<>());
-            } else {
-                std::sort(begin + static_cast<std::vector<int>::difference_type>(sortedCount), end);
-            }
+        std::vector<std::future<void>> futures;
+        futures.reserve(chunks);
+        for (size_t i = 0; i < chunks; ++i) {
+            T *chunk = data + bounds[i];
+            const size_t chunkSize = bounds[i + 1] - bounds[i];
+            futures.push_back(pool.submit([=]() { kernel(chunk, chunkSize); }));
         }
+        waitAll(futures);
 
-        // merge all sorted blocks
-        if (reverse)
-            mergeSortedBlocksReversed(vector, minBlockSize);
-        else
-            mergeSortedBlocks(vector, minBlockSize);
-#endif
-    }
+        // merge pairs of runs until one is left, splitting every merge so each round keeps all workers busy
+        std::unique_ptr<T[]> buffer(new T[size]);
+        T *src = data;
+        T *dst = buffer.get();
+        while (bounds.size() > 2) {
+            const size_t runs = bounds.size() - 1;
+            const size_t piecesPerMerge = std::max<size_t>(1, chunks / (runs / 2));
 
-    /**
-     * Try to sort with simd optimize, or fallback if unsupported
-     * MAKE SURE VECTOR IS ALIGNED with 64 bytes!
-     * @param vector vector to sort
-     */
-    void simdsort(std::vector<long long, AlignedAllocator<long long, 64>> &vector, bool reverse) {
-        const auto size = vector.size();
-        if (size <= 1) return;
-
-        const auto begin = vector.begin();
-        const auto end = vector.end();
+            std::vector<size_t> nextBounds;
+            for (size_t run = 0; run < runs; run += 2) {
+                const size_t left = bounds[run];
+                nextBounds.push_back(left);
 
-        if (size < 8) {
-            if (reverse) {
-                std::sort(begin, end, std::greater<>());
-            } else {
-                std::sort(begin, end);
-            }
-            return;
-        }
-
-#if defined(__arm__) || defined(__arm64__)
-        if (size > 5000) {
-            if (reverse) {
-                gfx::timsort(begin, end, std::greater<>());
-            } else {
-                gfx::timsort(begin, end);
-            }
-        } else {
-            if (reverse) {
-                std::sort(begin, end, std::greater<>());
-            } else {
-                std::sort(begin, end);
-            }
-        }
-#else
-        if (!IS_AVX2_SUPPORTED && !IS_AVX512_SUPPORTED) {
-            // fallback
-            if (size > 5000) {
-                if (reverse) {
-                    gfx::timsort(begin, end, std::greater<>());
-                } else {
-                    gfx::timsort(begin, end);
-                }
-            } else {
-                if (reverse) {
-                    std::sort(begin, end, std::greater<>());
-                } else {
-                    std::sort(begin, end);
-                }
-            }
-            return;
-        }
-
-        // get pointer to do simd
-        auto *data = &(*begin);
-        size_t sortedCount = 0;
-        size_t minBlockSize = AVX512_LONG_LONGS;
-
-        if (IS_AVX512_SUPPORTED && sortedCount + AVX512_LONG_LONGS < size) {
-            // simd sort with avx512
-            prefetchL1(avx512Marks);
-            for (; sortedCount + AVX512_LONG_LONGS <= size; sortedCount += AVX512_LONG_LONGS) {
-                if (size - sortedCount > AVX512_PREFETCH_LONG_LONG) {
-                    prefetchL1(data + sortedCount + AVX512_PREFETCH_LONG_LONG);
+                if (run + 1 == runs) {
+                    // odd run out, carried over to the next round as is
+                    const size_t runSize = bounds[run + 1] - left;
+                    futures.push_back(pool.submit([=]() { simdMemCpy(src + left, dst + left, runSize); }));
+                    continue;
                 }
 
-                __m512i vec = _mm512_load_si512(data + sortedCount);  // load
-                if (reverse) {  // sort
-                    sort16Epi32AVX512Reversed(vec);
-                } else {
-                    sort16Epi32AVX512(vec);
+                const T *a = src + left;
+                const T *b = src + bounds[run + 1];
+                const size_t aSize = bounds[run + 1] - left;
+                const size_t bSize = bounds[run + 2] - bounds[run + 1];
+                const size_t total = aSize + bSize;
+                for (size_t piece = 0; piece < piecesPerMerge; ++piece) {
+                    const size_t begin = total / piecesPerMerge * piece;
+                    const size_t end = piece + 1 == piecesPerMerge ? total : total / piecesPerMerge * (piece + 1);
+                    futures.push_back(pool.submit([=]() {
+                        const size_t aBegin = mergePathSplit(a, aSize, b, bSize, begin);
+                        const size_t aEnd = mergePathSplit(a, aSize, b, bSize, end);
+                        mergeRuns(a + aBegin, a + aEnd, b + (begin - aBegin), b + (end - aEnd), dst + left + begin);
+                    }));
                 }
-                _mm512_store_si512(data + sortedCount, vec);  // store
             }
-        }
+            nextBounds.push_back(size);
+            waitAll(futures);
 
-        if (IS_AVX2_SUPPORTED && sortedCount + AVX2_LONG_LONGS < size) {
-            // simd sort with avx2
-            prefetchL1(avx2Marks);
-            for (; sortedCount + AVX2_LONG_LONGS <= size; sortedCount += AVX2_LONG_LONGS) {
-                if (size - sortedCount > AVX2_PREFETCH_LONG_LONG) {
-                    prefetchL1(data + sortedCount + AVX2_PREFETCH_LONG_LONG);
-                }
+            bounds = std::move(nextBounds);
+            std::swap(src, dst);
+        }
 
-                __m256i vec = _mm256_load_si256((__m256i *) (data + sortedCount));  // load
-                if (reverse) {  // sort
-                    sort8Epi32AVX2Reversed(vec);
-                } else {
-                    sort8Epi32AVX2(vec);
-                }
-                _mm256_store_si256((__m256i *) (data + sortedCount), vec);  // store
-            }
-            minBlockSize = 8;
+        // copy the final result
+        if (src != data) {
+            simdMemCpy(src, data, size);
         }
 
-        if (sortedCount < size) {
-            if (reverse) {
-                std::sort(begin + static_cast<std::vector<long long>::difference_type>(sortedCount), end,
-                          std::greater<>());
-            } else {
-                std::sort(begin + static_cast<std::vector<long long>::difference_type>(sortedCount), end);
-            }
+        if (reverse) {
+            simdReverse(data, size);
         }
+    }
 
-        // merge all sorted blocks
-        if (reverse)
-            mergeSortedBlocksReversed(vector, minBlockSize);
-        else
-            mergeSortedBlocks(vector, minBlockSize);
-#endif
+    void simdsortParallel(std::vector<int, AlignedAllocator<int, 64>> &vector, bool reverse, size_t threads,
+                          SortAlgorithm algorithm) {
+        doSimdsortParallel(vector.data(), vector.size(), reverse, threads, algorithm, sortIntKernel);
+    }
+
+    void simdsortParallel(std::vector<long long, AlignedAllocator<long long, 64>> &vector, bool reverse,
+                          size_t threads, SortAlgorithm algorithm) {
+        doSimdsortParallel(vector.data(), vector.size(), reverse, threads, algorithm, sortLongLongKernel);
     }
 }
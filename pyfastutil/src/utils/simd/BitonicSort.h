@@ -7,6 +7,7 @@
 
 #include <vector>
 #include "utils/memory/AlignedAllocator.h"
+#include "utils/simd/RadixSort.h"
 #include "Compat.h"
 
 namespace simd {
@@ -16,6 +17,34 @@ namespace simd {
     void simdsort(std::vector<int, AlignedAllocator<int, 64>> &vector, bool reverse);
 
     void simdsort(std::vector<long long, AlignedAllocator<long long, 64>> &vector, bool reverse);
+
+    /**
+     * Sort size elements of data in place, for callers that don't own a vector.
+     */
+    void simdsort(int *data, size_t size, bool reverse);
+
+    /**
+     * Sort size elements of data in place, for callers that don't own a vector.
+     */
+    void simdsort(long long *data, size_t size, bool reverse);
+
+    /**
+     * Sort chunks on the shared thread pool, then merge them in parallel.
+     * Inputs too small to be worth it are sorted with simdsort.
+     * @param threads number of chunks sorted at once, 0 for one per worker of the pool
+     * @param algorithm how every chunk is sorted
+     */
+    void simdsortParallel(std::vector<int, AlignedAllocator<int, 64>> &vector, bool reverse, size_t threads,
+                          SortAlgorithm algorithm = SortAlgorithm::BITONIC);
+
+    /**
+     * Sort chunks on the shared thread pool, then merge them in parallel.
+     * Inputs too small to be worth it are sorted with simdsort.
+     * @param threads number of chunks sorted at once, 0 for one per worker of the pool
+     * @param algorithm how every chunk is sorted
+     */
+    void simdsortParallel(std::vector<long long, AlignedAllocator<long long, 64>> &vector, bool reverse,
+                          size_t threads, SortAlgorithm algorithm = SortAlgorithm::BITONIC);
 }
 
 
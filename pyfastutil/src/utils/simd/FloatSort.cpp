@@ -0,0 +1,99 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#include "FloatSort.h"
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include "SIMDUtils.h"
+#include "utils/simd/BitonicSort.h"
+
+template<typename T>
+concept FloatOrDouble = std::same_as<T, float> || std::same_as<T, double>;
+
+namespace simd {
+
+    template<FloatOrDouble T>
+    using OrderedBits = std::conditional_t<std::same_as<T, float>, int, long long>;
+
+    /**
+     * Map the bits of a float to an int with the same order. Doing it again maps them back.
+     */
+    template<FloatOrDouble T>
+    static __forceinline OrderedBits<T> toOrderedBits(OrderedBits<T> bits) {
+        return bits < 0 ? bits ^ std::numeric_limits<OrderedBits<T>>::max() : bits;
+    }
+
+    template<FloatOrDouble T>
+    static __forceinline void doSimdsort(T *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        using Bits = OrderedBits<T>;
+
+        // NaN goes last, whatever the direction, the same place numpy puts it
+        const size_t count = std::partition(data, data + size, [](T value) { return !std::isnan(value); }) - data;
+        if (count <= 1) return;
+
+        // memcpy, so reading the floats back as ints doesn't break aliasing rules
+        auto *bits = reinterpret_cast<Bits *>(data);
+        for (size_t i = 0; i < count; ++i) {
+            Bits value;
+            std::memcpy(&value, data + i, sizeof(T));
+            value = toOrderedBits<T>(value);
+            std::memcpy(data + i, &value, sizeof(T));
+        }
+
+        if (resolveSortAlgorithm<Bits>(algorithm, count) == SortAlgorithm::RADIX) {
+            radixsort(bits, count);
+            if (reverse) {
+                simdReverse(bits, count);
+            }
+        } else {
+            simdsort(bits, count, reverse);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            Bits value;
+            std::memcpy(&value, data + i, sizeof(T));
+            value = toOrderedBits<T>(value);
+            std::memcpy(data + i, &value, sizeof(T));
+        }
+    }
+
+    template<FloatOrDouble T>
+    static __forceinline void doArgsort(const T *data, size_t size, bool reverse, bool stable, int *indices) {
+        using Bits = OrderedBits<T>;
+
+        // NaN takes the key that sorts last in the requested direction
+        const Bits nanKey = reverse ? std::numeric_limits<Bits>::min() : std::numeric_limits<Bits>::max();
+
+        std::vector<Bits> keys(size);
+        for (size_t i = 0; i < size; ++i) {
+            const T value = data[i];
+            // -0.0 becomes 0.0 first, they compare equal
+            keys[i] = std::isnan(value) ? nanKey : toOrderedBits<T>(std::bit_cast<Bits>(value == 0 ? T(0) : value));
+        }
+
+        argsort(keys.data(), size, reverse, stable, indices);
+    }
+
+    void simdsort(float *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        doSimdsort(data, size, reverse, algorithm);
+    }
+
+    void simdsort(double *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        doSimdsort(data, size, reverse, algorithm);
+    }
+
+    void argsort(const float *data, size_t size, bool reverse, bool stable, int *indices) {
+        doArgsort(data, size, reverse, stable, indices);
+    }
+
+    void argsort(const double *data, size_t size, bool reverse, bool stable, int *indices) {
+        doArgsort(data, size, reverse, stable, indices);
+    }
+}
@@ -0,0 +1,43 @@
+//
+// Created by xia__mc on 2024/12/17.
+//
+
+#ifndef PYFASTUTIL_FLOATSORT_H
+#define PYFASTUTIL_FLOATSORT_H
+
+#include <cstddef>
+#include "utils/simd/RadixSort.h"
+#include "Compat.h"
+
+/*
+ * Floats are sorted as ints: flipping every bit but the sign of a negative float gives an int with the
+ * same order, so the int sorts can do the work. NaN has no place in that order and is moved to the end first.
+ */
+namespace simd {
+
+    /**
+     * Sort in place, NaN last in either direction.
+     */
+    void simdsort(float *data, size_t size, bool reverse, SortAlgorithm algorithm = SortAlgorithm::AUTO);
+
+    /**
+     * Sort in place, NaN last in either direction.
+     */
+    void simdsort(double *data, size_t size, bool reverse, SortAlgorithm algorithm = SortAlgorithm::AUTO);
+
+    /**
+     * Sort the indices of data by their values, data isn't changed.
+     * NaN is last in either direction and -0.0 equals 0.0, so a stable sort keeps their order.
+     * @param indices receives the permutation that sorts data, size must fit in an int
+     */
+    void argsort(const float *data, size_t size, bool reverse, bool stable, int *indices);
+
+    /**
+     * Sort the indices of data by their values, data isn't changed.
+     * NaN is last in either direction and -0.0 equals 0.0, so a stable sort keeps their order.
+     * @param indices receives the permutation that sorts data, size must fit in an int
+     */
+    void argsort(const double *data, size_t size, bool reverse, bool stable, int *indices);
+}
+
+#endif //PYFASTUTIL_FLOATSORT_H
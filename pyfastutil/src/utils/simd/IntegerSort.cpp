@@ -0,0 +1,194 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#include "IntegerSort.h"
+
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include "SIMDUtils.h"
+#include "utils/simd/BitonicSort.h"
+#include "utils/memory/AlignedAllocator.h"
+
+template<typename T>
+concept NarrowInt = std::same_as<T, signed char> || std::same_as<T, short>;
+
+template<typename T>
+concept UnsignedInt = std::same_as<T, unsigned int> || std::same_as<T, unsigned long long>;
+
+namespace simd {
+
+    /**
+     * Smallest input counted rather than compared, below that clearing the counts costs more than sorting.
+     */
+    template<NarrowInt T>
+    static constexpr size_t COUNTING_SORT_THRESHOLD = sizeof(T) == 1 ? 64 : 16384;
+
+    template<NarrowInt T>
+    static constexpr size_t VALUE_COUNT = static_cast<size_t>(1) << (8 * sizeof(T));
+
+    /**
+     * Index of the count of value, the smallest value has the first one.
+     */
+    template<NarrowInt T>
+    static __forceinline size_t toBucket(T value) {
+        return static_cast<std::make_unsigned_t<T>>(value) ^ (VALUE_COUNT<T> / 2);
+    }
+
+    template<NarrowInt T>
+    static __forceinline T fromBucket(size_t bucket) {
+        return static_cast<T>(bucket ^ (VALUE_COUNT<T> / 2));
+    }
+
+    template<NarrowInt T>
+    static void countingSort(T *data, size_t size, bool reverse) {
+        std::vector<size_t> counts(VALUE_COUNT<T>);
+        for (size_t i = 0; i < size; ++i) {
+            ++counts[toBucket(data[i])];
+        }
+
+        T *out = data;
+        for (size_t i = 0; i < VALUE_COUNT<T>; ++i) {
+            const size_t bucket = reverse ? VALUE_COUNT<T> - 1 - i : i;
+            out = std::fill_n(out, counts[bucket], fromBucket<T>(bucket));
+        }
+    }
+
+    /**
+     * Scatter every index to its place, which keeps equal values in their original order in either direction.
+     */
+    template<NarrowInt T>
+    static void countingArgsort(const T *data, size_t size, bool reverse, int *indices) {
+        std::vector<size_t> offsets(VALUE_COUNT<T>);
+        for (size_t i = 0; i < size; ++i) {
+            ++offsets[toBucket(data[i])];
+        }
+
+        size_t offset = 0;
+        for (size_t i = 0; i < VALUE_COUNT<T>; ++i) {
+            const size_t bucket = reverse ? VALUE_COUNT<T> - 1 - i : i;
+            const size_t count = offsets[bucket];
+            offsets[bucket] = offset;
+            offset += count;
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            indices[offsets[toBucket(data[i])]++] = static_cast<int>(i);
+        }
+    }
+
+    template<NarrowInt T>
+    static __forceinline void doSimdsort(T *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        if (size <= 1) return;
+
+        if (algorithm == SortAlgorithm::AUTO) {
+            if (size >= COUNTING_SORT_THRESHOLD<T>) {
+                countingSort(data, size, reverse);
+                return;
+            }
+            algorithm = resolveSortAlgorithm<int>(algorithm, size);
+        }
+
+        std::vector<int, AlignedAllocator<int, 64>> wide(data, data + size);
+        if (algorithm == SortAlgorithm::RADIX) {
+            radixsort(wide, reverse);
+        } else {
+            simdsort(wide, reverse);
+        }
+        std::copy(wide.begin(), wide.end(), data);
+    }
+
+    template<NarrowInt T>
+    static __forceinline void doArgsort(const T *data, size_t size, bool reverse, bool stable, int *indices) {
+        if (size >= COUNTING_SORT_THRESHOLD<T>) {
+            countingArgsort(data, size, reverse, indices);
+            return;
+        }
+
+        const std::vector<int> keys(data, data + size);
+        argsort(keys.data(), size, reverse, stable, indices);
+    }
+
+    template<UnsignedInt T>
+    using SignedBits = std::make_signed_t<T>;
+
+    /**
+     * Flip the sign bit, so signed comparisons of the result order like unsigned ones of value.
+     * Doing it again maps it back.
+     */
+    template<UnsignedInt T>
+    static __forceinline T flipSign(T value) {
+        return value ^ (static_cast<T>(1) << (8 * sizeof(T) - 1));
+    }
+
+    template<UnsignedInt T>
+    static __forceinline void doSimdsort(T *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        using Bits = SignedBits<T>;
+        if (size <= 1) return;
+
+        // signed and unsigned versions of a type may alias each other
+        auto *bits = reinterpret_cast<Bits *>(data);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = flipSign(data[i]);
+        }
+
+        if (resolveSortAlgorithm<Bits>(algorithm, size) == SortAlgorithm::RADIX) {
+            radixsort(bits, size);
+            if (reverse) {
+                simdReverse(bits, size);
+            }
+        } else {
+            simdsort(bits, size, reverse);
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = flipSign(data[i]);
+        }
+    }
+
+    template<UnsignedInt T>
+    static __forceinline void doArgsort(const T *data, size_t size, bool reverse, bool stable, int *indices) {
+        using Bits = SignedBits<T>;
+
+        std::vector<Bits> keys(size);
+        for (size_t i = 0; i < size; ++i) {
+            keys[i] = static_cast<Bits>(flipSign(data[i]));
+        }
+
+        argsort(keys.data(), size, reverse, stable, indices);
+    }
+
+    void simdsort(signed char *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        doSimdsort(data, size, reverse, algorithm);
+    }
+
+    void simdsort(short *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        doSimdsort(data, size, reverse, algorithm);
+    }
+
+    void simdsort(unsigned int *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        doSimdsort(data, size, reverse, algorithm);
+    }
+
+    void simdsort(unsigned long long *data, size_t size, bool reverse, SortAlgorithm algorithm) {
+        doSimdsort(data, size, reverse, algorithm);
+    }
+
+    void argsort(const signed char *data, size_t size, bool reverse, bool stable, int *indices) {
+        doArgsort(data, size, reverse, stable, indices);
+    }
+
+    void argsort(const short *data, size_t size, bool reverse, bool stable, int *indices) {
+        doArgsort(data, size, reverse, stable, indices);
+    }
+
+    void argsort(const unsigned int *data, size_t size, bool reverse, bool stable, int *indices) {
+        doArgsort(data, size, reverse, stable, indices);
+    }
+
+    void argsort(const unsigned long long *data, size_t size, bool reverse, bool stable, int *indices) {
+        doArgsort(data, size, reverse, stable, indices);
+    }
+}
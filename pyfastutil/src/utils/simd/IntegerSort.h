@@ -0,0 +1,65 @@
+//
+// Created by xia__mc on 2024/12/18.
+//
+
+#ifndef PYFASTUTIL_INTEGERSORT_H
+#define PYFASTUTIL_INTEGERSORT_H
+
+#include <cstddef>
+#include "utils/simd/RadixSort.h"
+#include "Compat.h"
+
+/*
+ * Sorts for the narrow and unsigned lists, on top of the int and long long sorts.
+ * 8 and 16-bit values have so few possible values that AUTO just counts them. Unsigned values are sorted
+ * as signed ones with the sign bit flipped, which keeps their order.
+ */
+namespace simd {
+
+    /**
+     * Sort in place. BITONIC and RADIX sort a widened copy.
+     */
+    void simdsort(signed char *data, size_t size, bool reverse, SortAlgorithm algorithm = SortAlgorithm::AUTO);
+
+    /**
+     * Sort in place. BITONIC and RADIX sort a widened copy.
+     */
+    void simdsort(short *data, size_t size, bool reverse, SortAlgorithm algorithm = SortAlgorithm::AUTO);
+
+    /**
+     * Sort in place.
+     */
+    void simdsort(unsigned int *data, size_t size, bool reverse, SortAlgorithm algorithm = SortAlgorithm::AUTO);
+
+    /**
+     * Sort in place.
+     */
+    void simdsort(unsigned long long *data, size_t size, bool reverse,
+                  SortAlgorithm algorithm = SortAlgorithm::AUTO);
+
+    /**
+     * Sort the indices of data by their values, data isn't changed.
+     * @param indices receives the permutation that sorts data, size must fit in an int
+     */
+    void argsort(const signed char *data, size_t size, bool reverse, bool stable, int *indices);
+
+    /**
+     * Sort the indices of data by their values, data isn't changed.
+     * @param indices receives the permutation that sorts data, size must fit in an int
+     */
+    void argsort(const short *data, size_t size, bool reverse, bool stable, int *indices);
+
+    /**
+     * Sort the indices of data by their values, data isn't changed.
+     * @param indices receives the permutation that sorts data, size must fit in an int
+     */
+    void argsort(const unsigned int *data, size_t size, bool reverse, bool stable, int *indices);
+
+    /**
+     * Sort the indices of data by their values, data isn't changed.
+     * @param indices receives the permutation that sorts data, size must fit in an int
+     */
+    void argsort(const unsigned long long *data, size_t size, bool reverse, bool stable, int *indices);
+}
+
+#endif //PYFASTUTIL_INTEGERSORT_H
@@ -0,0 +1,196 @@
+//
+// Created by xia__mc on 2024/12/15.
+//
+
+#include "RadixSort.h"
+
+#include <memory>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include "utils/simd/SIMDUtils.h"
+#include "utils/memory/PreFetch.h"
+
+template<typename T>
+concept IntOrLongLong = std::same_as<T, int> || std::same_as<T, long long>;
+
+namespace simd {
+
+    /**
+     * Bits sorted by every pass, so that both types take an even number of passes and the result
+     * lands back in data unless a pass is skipped: 4 passes of 8 bits for int, 6 passes of 11 bits for long long.
+     */
+    template<IntOrLongLong T>
+    static constexpr unsigned int RADIX_BITS = std::same_as<T, int> ? 8 : 11;
+
+    /**
+     * Sort keys with LSD radix sort, ping-ponging between keys and keyScratch.
+     * Keys have their sign bit flipped, so negative values sort before positive ones, and all their bits
+     * flipped too when Descending. If HasPayload, payload is moved along with the keys, ping-ponging the same way.
+     * Every pass is stable, so equal keys keep their order.
+     * @return if the result is in the scratch buffers rather than in keys and payload
+     */
+    template<IntOrLongLong T, bool Descending = false, bool HasPayload = false>
+    static bool radixSortPasses(T *keys, T *keyScratch, size_t size,
+                                int *payload = nullptr, int *payloadScratch = nullptr) {
+        using U = std::make_unsigned_t<T>;
+        constexpr unsigned int BITS = RADIX_BITS<T>;
+        constexpr unsigned int PASSES = (sizeof(T) * 8 + BITS - 1) / BITS;
+        constexpr size_t BUCKETS = static_cast<size_t>(1) << BITS;
+        constexpr U MASK = BUCKETS - 1;
+        constexpr U FLIP = Descending ? static_cast<U>(~(static_cast<U>(1) << (sizeof(T) * 8 - 1)))
+                                      : static_cast<U>(1) << (sizeof(T) * 8 - 1);
+
+        // histograms of every digit in a single read of keys
+        std::unique_ptr<size_t[]> histograms(new size_t[PASSES * BUCKETS]());
+        for (size_t i = 0; i < size; ++i) {
+            if (size - i > 64) {
+                prefetchL1(keys + i + 64);
+            }
+
+            const U key = static_cast<U>(keys[i]) ^ FLIP;
+            for (unsigned int pass = 0; pass < PASSES; ++pass) {
+                ++histograms[pass * BUCKETS + ((key >> (pass * BITS)) & MASK)];
+            }
+        }
+
+        T *src = keys;
+        T *dst = keyScratch;
+        int *payloadSrc = payload;
+        int *payloadDst = payloadScratch;
+        bool inScratch = false;
+        for (unsigned int pass = 0; pass < PASSES; ++pass) {
+            size_t *histogram = histograms.get() + pass * BUCKETS;
+            const unsigned int shift = pass * BITS;
+
+            // every element has the same digit, nothing would move
+            if (histogram[((static_cast<U>(src[0]) ^ FLIP) >> shift) & MASK] == size) {
+                continue;
+            }
+
+            size_t offset = 0;
+            for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+                const size_t count = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += count;
+            }
+
+            for (size_t i = 0; i < size; ++i) {
+                const T value = src[i];
+                const size_t to = histogram[((static_cast<U>(value) ^ FLIP) >> shift) & MASK]++;
+                dst[to] = value;
+                if constexpr (HasPayload) {
+                    payloadDst[to] = payloadSrc[i];
+                }
+            }
+            std::swap(src, dst);
+            if constexpr (HasPayload) {
+                std::swap(payloadSrc, payloadDst);
+            }
+            inScratch = !inScratch;
+        }
+
+        return inScratch;
+    }
+
+    template<IntOrLongLong T>
+    static __forceinline void doRadixsort(T *data, size_t size) {
+        if (size <= 1) return;
+
+        AlignedAllocator<T, 64> allocator;
+        const std::unique_ptr<T, void (*)(void *)> scratch(allocator.allocate(size), alignedFree);
+
+        if (radixSortPasses(data, scratch.get(), size)) {
+            simdMemCpy(scratch.get(), data, size);
+        }
+    }
+
+    void radixsort(int *data, size_t size) {
+        doRadixsort(data, size);
+    }
+
+    void radixsort(long long *data, size_t size) {
+        doRadixsort(data, size);
+    }
+
+    void radixsort(std::vector<int, AlignedAllocator<int, 64>> &vector, bool reverse) {
+        doRadixsort(vector.data(), vector.size());
+        if (reverse) {
+            simdReverse(vector.data(), vector.size());
+        }
+    }
+
+    void radixsort(std::vector<long long, AlignedAllocator<long long, 64>> &vector, bool reverse) {
+        doRadixsort(vector.data(), vector.size());
+        if (reverse) {
+            simdReverse(vector.data(), vector.size());
+        }
+    }
+
+    template<IntOrLongLong T>
+    static __forceinline void doRadixArgsort(const T *data, size_t size, bool reverse, int *indices, T *sorted) {
+        if (size == 0) return;
+
+        AlignedAllocator<T, 64> keyAllocator;
+        AlignedAllocator<int, 64> indexAllocator;
+        const std::unique_ptr<T, void (*)(void *)> keys(keyAllocator.allocate(size), alignedFree);
+        const std::unique_ptr<T, void (*)(void *)> keyScratch(keyAllocator.allocate(size), alignedFree);
+        const std::unique_ptr<int, void (*)(void *)> indexScratch(indexAllocator.allocate(size), alignedFree);
+
+        std::copy(data, data + size, keys.get());
+        std::iota(indices, indices + size, 0);
+
+        const bool inScratch = reverse
+                               ? radixSortPasses<T, true, true>(keys.get(), keyScratch.get(), size,
+                                                                indices, indexScratch.get())
+                               : radixSortPasses<T, false, true>(keys.get(), keyScratch.get(), size,
+                                                                 indices, indexScratch.get());
+        if (inScratch) {
+            simdMemCpy(indexScratch.get(), indices, size);
+        }
+        if (sorted != nullptr) {
+            simdMemCpy(inScratch ? keyScratch.get() : keys.get(), sorted, size);
+        }
+    }
+
+    template<IntOrLongLong T>
+    static __forceinline void doArgsort(const T *data, size_t size, bool reverse, bool stable,
+                                        int *indices, T *sorted) {
+        // radix sort is always stable, so it's only worth skipping for small inputs
+        if (size >= RADIX_SORT_THRESHOLD<T>) {
+            doRadixArgsort(data, size, reverse, indices, sorted);
+            return;
+        }
+
+        std::iota(indices, indices + size, 0);
+        const auto less = [data](int a, int b) { return data[a] < data[b]; };
+        const auto greater = [data](int a, int b) { return data[a] > data[b]; };
+        if (stable) {
+            if (reverse) {
+                std::stable_sort(indices, indices + size, greater);
+            } else {
+                std::stable_sort(indices, indices + size, less);
+            }
+        } else {
+            if (reverse) {
+                std::sort(indices, indices + size, greater);
+            } else {
+                std::sort(indices, indices + size, less);
+            }
+        }
+
+        if (sorted != nullptr) {
+            for (size_t i = 0; i < size; ++i) {
+                sorted[i] = data[indices[i]];
+            }
+        }
+    }
+
+    void argsort(const int *data, size_t size, bool reverse, bool stable, int *indices, int *sorted) {
+        doArgsort(data, size, reverse, stable, indices, sorted);
+    }
+
+    void argsort(const long long *data, size_t size, bool reverse, bool stable, int *indices, long long *sorted) {
+        doArgsort(data, size, reverse, stable, indices, sorted);
+    }
+}
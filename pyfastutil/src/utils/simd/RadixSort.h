@@ -0,0 +1,72 @@
+//
+// Created by xia__mc on 2024/12/15.
+//
+
+#ifndef PYFASTUTIL_RADIXSORT_H
+#define PYFASTUTIL_RADIXSORT_H
+
+#include <vector>
+#include "utils/memory/AlignedAllocator.h"
+#include "Compat.h"
+
+namespace simd {
+
+    enum class SortAlgorithm {
+        AUTO,
+        BITONIC,
+        RADIX
+    };
+
+    /**
+     * Smallest input the AUTO policy sorts with radix sort, below that the histograms cost more than they save.
+     * Long longs take more passes, so they need more elements to pay off.
+     */
+    template<typename T>
+    static constexpr size_t RADIX_SORT_THRESHOLD = sizeof(T) <= sizeof(int) ? 256 : 1024;
+
+    /**
+     * Resolve AUTO to the algorithm to use for size elements of T.
+     */
+    template<typename T>
+    __forceinline SortAlgorithm resolveSortAlgorithm(SortAlgorithm algorithm, size_t size) {
+        if (algorithm != SortAlgorithm::AUTO) {
+            return algorithm;
+        }
+        return size >= RADIX_SORT_THRESHOLD<T> ? SortAlgorithm::RADIX : SortAlgorithm::BITONIC;
+    }
+
+    /**
+     * LSD radix sort in place, with a scratch buffer of the same size.
+     */
+    void radixsort(int *data, size_t size);
+
+    /**
+     * LSD radix sort in place, with a scratch buffer of the same size.
+     */
+    void radixsort(long long *data, size_t size);
+
+    /**
+     * Sort the indices of data by their values, data isn't changed.
+     * Large inputs go through radix sort, which is stable either way.
+     * A stable descending sort keeps equal values in their original order too, like sorted(reverse=True).
+     * @param indices receives the permutation that sorts data, size must fit in an int
+     * @param sorted receives the sorted values if not nullptr
+     */
+    void argsort(const int *data, size_t size, bool reverse, bool stable, int *indices, int *sorted = nullptr);
+
+    /**
+     * Sort the indices of data by their values, data isn't changed.
+     * Large inputs go through radix sort, which is stable either way.
+     * A stable descending sort keeps equal values in their original order too, like sorted(reverse=True).
+     * @param indices receives the permutation that sorts data, size must fit in an int
+     * @param sorted receives the sorted values if not nullptr
+     */
+    void argsort(const long long *data, size_t size, bool reverse, bool stable, int *indices,
+                 long long *sorted = nullptr);
+
+    void radixsort(std::vector<int, AlignedAllocator<int, 64>> &vector, bool reverse);
+
+    void radixsort(std::vector<long long, AlignedAllocator<long long, 64>> &vector, bool reverse);
+}
+
+#endif //PYFASTUTIL_RADIXSORT_H
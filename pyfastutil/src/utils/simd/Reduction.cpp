@@ -0,0 +1,995 @@
+//
+// Created by xia__mc on 2024/12/14.
+//
+
+#include "Reduction.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#if !defined(__arm__) && !defined(__arm64__)
+
+#include <immintrin.h>
+
+#endif
+
+#include "SIMDHelper.h"
+#include "utils/memory/PreFetch.h"
+
+template<typename T>
+concept NarrowOrUnsigned = std::same_as<T, signed char> || std::same_as<T, short> ||
+                           std::same_as<T, unsigned int> || std::same_as<T, unsigned long long>;
+
+namespace simd {
+
+    using IntSumKernel = long long (*)(const int *data, size_t size);
+    using LongLongSumKernel = LongLongSum (*)(const long long *data, size_t size);
+    using IntMinMaxKernel = MinMax<int> (*)(const int *data, size_t size);
+    using LongLongMinMaxKernel = MinMax<long long> (*)(const long long *data, size_t size);
+    using FloatSumKernel = double (*)(const float *data, size_t size);
+    using DoubleSumKernel = double (*)(const double *data, size_t size);
+    using FloatMinMaxKernel = MinMax<float> (*)(const float *data, size_t size);
+    using DoubleMinMaxKernel = MinMax<double> (*)(const double *data, size_t size);
+    using FloatDotKernel = double (*)(const float *a, const float *b, size_t size);
+    using DoubleDotKernel = double (*)(const double *a, const double *b, size_t size);
+
+    static long long sumBaseline(const int *data, size_t size) {
+        long long sum = 0;
+        for (size_t i = 0; i < size; ++i) {
+            sum += data[i];
+        }
+        return sum;
+    }
+
+    static LongLongSum sumBaseline(const long long *data, size_t size) {
+        // the high halves are signed, the low halves are not
+        LongLongSum sum{0, 0};
+        for (size_t i = 0; i < size; ++i) {
+            sum.low += static_cast<unsigned long long>(data[i]) & 0xFFFFFFFFULL;
+            sum.high += data[i] >> 32;
+        }
+        return sum;
+    }
+
+    template<typename T>
+    static __forceinline void minMaxTail(const T *data, size_t size, size_t i, MinMax<T> &result) {
+        for (; i < size; ++i) {
+            result.min = std::min(result.min, data[i]);
+            result.max = std::max(result.max, data[i]);
+        }
+    }
+
+    template<typename T>
+    static MinMax<T> minMaxBaseline(const T *data, size_t size) {
+        MinMax<T> result{data[0], data[0]};
+        minMaxTail(data, size, 1, result);
+        return result;
+    }
+
+    template<typename T>
+    static double sumFloatBaseline(const T *data, size_t size) {
+        double sum = 0;
+        for (size_t i = 0; i < size; ++i) {
+            sum += data[i];
+        }
+        return sum;
+    }
+
+    template<typename T>
+    static __forceinline MinMax<T> nanMinMax() {
+        return {std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN()};
+    }
+
+    /**
+     * Like minMaxTail, but NaN poisons the result instead of being skipped or not depending on its position.
+     */
+    template<typename T>
+    static __forceinline void minMaxFloatTail(const T *data, size_t size, size_t i, MinMax<T> &result) {
+        for (; i < size; ++i) {
+            if (std::isnan(data[i])) {
+                result = nanMinMax<T>();
+                return;
+            }
+            result.min = std::min(result.min, data[i]);
+            result.max = std::max(result.max, data[i]);
+        }
+    }
+
+    template<typename T>
+    static MinMax<T> minMaxFloatBaseline(const T *data, size_t size) {
+        if (std::isnan(data[0])) {
+            return nanMinMax<T>();
+        }
+        MinMax<T> result{data[0], data[0]};
+        minMaxFloatTail(data, size, 1, result);
+        return result;
+    }
+
+    template<typename T>
+    static double dotBaseline(const T *a, const T *b, size_t size) {
+        double sum = 0;
+        for (size_t i = 0; i < size; ++i) {
+            sum += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+        }
+        return sum;
+    }
+
+    /*
+     * Narrow and unsigned elements share one template per kernel, the lane width follows from the type.
+     */
+
+    template<NarrowOrUnsigned T>
+    using NarrowSum = std::conditional_t<std::same_as<T, unsigned long long>, LongLongSum,
+            std::conditional_t<std::same_as<T, unsigned int>, unsigned long long, long long>>;
+
+    template<NarrowOrUnsigned T>
+    using NarrowSumKernel = NarrowSum<T> (*)(const T *data, size_t size);
+
+    template<NarrowOrUnsigned T>
+    using NarrowMinMaxKernel = MinMax<T> (*)(const T *data, size_t size);
+
+    template<NarrowOrUnsigned T>
+    static __forceinline NarrowSum<T> sumNarrow(const T *data, size_t size) {
+        if constexpr (std::same_as<T, unsigned long long>) {
+            // split like the signed long long sum, both halves are unsigned here
+            LongLongSum sum{0, 0};
+            for (size_t i = 0; i < size; ++i) {
+                sum.low += data[i] & 0xFFFFFFFFULL;
+                sum.high += static_cast<long long>(data[i] >> 32);
+            }
+            return sum;
+        } else {
+            NarrowSum<T> sum = 0;
+            for (size_t i = 0; i < size; ++i) {
+                sum += data[i];
+            }
+            return sum;
+        }
+    }
+
+    template<NarrowOrUnsigned T>
+    static __forceinline MinMax<T> minMaxNarrow(const T *data, size_t size) {
+        MinMax<T> result{data[0], data[0]};
+        minMaxTail(data, size, 1, result);
+        return result;
+    }
+
+    template<NarrowOrUnsigned T>
+    static NarrowSum<T> sumNarrowBaseline(const T *data, size_t size) {
+        return sumNarrow(data, size);
+    }
+
+    template<NarrowOrUnsigned T>
+    static MinMax<T> minMaxNarrowBaseline(const T *data, size_t size) {
+        return minMaxNarrow(data, size);
+    }
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "portability-simd-intrinsics"
+#if !defined(__arm__) && !defined(__arm64__)
+
+    static __forceinline SIMD_TARGET_AVX2 long long reduceAddEpi64(__m256i vec) {
+        alignas(32) long long lanes[AVX2_LONG_LONGS];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), vec);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    static SIMD_TARGET_AVX2 long long sumAVX2(const int *data, size_t size) {
+        __m256i sum0 = _mm256_setzero_si256();
+        __m256i sum1 = _mm256_setzero_si256();
+
+        size_t i = 0;
+        for (; i + AVX2_INTS <= size; i += AVX2_INTS) {
+            if (size - i > AVX2_PREFETCH_INT) {
+                prefetchL1(data + i + AVX2_PREFETCH_INT);
+            }
+
+            // widen to 64-bit before adding, so it can't overflow
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            sum0 = _mm256_add_epi64(sum0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(vec)));
+            sum1 = _mm256_add_epi64(sum1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(vec, 1)));
+        }
+
+        return reduceAddEpi64(_mm256_add_epi64(sum0, sum1)) + sumBaseline(data + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX512 long long sumAVX512(const int *data, size_t size) {
+        __m512i sum0 = _mm512_setzero_si512();
+        __m512i sum1 = _mm512_setzero_si512();
+
+        size_t i = 0;
+        for (; i + AVX512_INTS <= size; i += AVX512_INTS) {
+            if (size - i > AVX512_PREFETCH_INT) {
+                prefetchL1(data + i + AVX512_PREFETCH_INT);
+            }
+
+            // widen to 64-bit before adding, so it can't overflow
+            const __m512i vec = _mm512_loadu_si512(data + i);
+            sum0 = _mm512_add_epi64(sum0, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(vec)));
+            sum1 = _mm512_add_epi64(sum1, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vec, 1)));
+        }
+
+        return _mm512_reduce_add_epi64(_mm512_add_epi64(sum0, sum1)) + sumBaseline(data + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX2 LongLongSum sumAVX2(const long long *data, size_t size) {
+        const __m256i lowMask = _mm256_set1_epi64x(0xFFFFFFFFLL);
+        __m256i low = _mm256_setzero_si256();
+        __m256i high = _mm256_setzero_si256();
+        __m256i negatives = _mm256_setzero_si256();
+
+        size_t i = 0;
+        for (; i + AVX2_LONG_LONGS <= size; i += AVX2_LONG_LONGS) {
+            if (size - i > AVX2_PREFETCH_LONG_LONG) {
+                prefetchL1(data + i + AVX2_PREFETCH_LONG_LONG);
+            }
+
+            // no 64-bit arithmetic shift before AVX-512, so shift logically and count the negatives instead
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            low = _mm256_add_epi64(low, _mm256_and_si256(vec, lowMask));
+            high = _mm256_add_epi64(high, _mm256_srli_epi64(vec, 32));
+            negatives = _mm256_sub_epi64(negatives, _mm256_cmpgt_epi64(_mm256_setzero_si256(), vec));
+        }
+
+        // wraps around, but the real high sum fits, so the result is still exact
+        const auto highSum = static_cast<unsigned long long>(reduceAddEpi64(high))
+                             - (static_cast<unsigned long long>(reduceAddEpi64(negatives)) << 32);
+
+        const LongLongSum tail = sumBaseline(data + i, size - i);
+        return {
+                static_cast<unsigned long long>(reduceAddEpi64(low)) + tail.low,
+                static_cast<long long>(highSum) + tail.high
+        };
+    }
+
+    static SIMD_TARGET_AVX512 LongLongSum sumAVX512(const long long *data, size_t size) {
+        const __m512i lowMask = _mm512_set1_epi64(0xFFFFFFFFLL);
+        __m512i low = _mm512_setzero_si512();
+        __m512i high = _mm512_setzero_si512();
+
+        size_t i = 0;
+        for (; i + AVX512_LONG_LONGS <= size; i += AVX512_LONG_LONGS) {
+            if (size - i > AVX512_PREFETCH_LONG_LONG) {
+                prefetchL1(data + i + AVX512_PREFETCH_LONG_LONG);
+            }
+
+            const __m512i vec = _mm512_loadu_si512(data + i);
+            low = _mm512_add_epi64(low, _mm512_and_si512(vec, lowMask));
+            high = _mm512_add_epi64(high, _mm512_srai_epi64(vec, 32));
+        }
+
+        const LongLongSum tail = sumBaseline(data + i, size - i);
+        return {
+                static_cast<unsigned long long>(_mm512_reduce_add_epi64(low)) + tail.low,
+                _mm512_reduce_add_epi64(high) + tail.high
+        };
+    }
+
+    static SIMD_TARGET_AVX2 MinMax<int> minMaxAVX2(const int *data, size_t size) {
+        if (size < AVX2_INTS) {
+            return minMaxBaseline(data, size);
+        }
+
+        __m256i min = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+        __m256i max = min;
+
+        size_t i = AVX2_INTS;
+        for (; i + AVX2_INTS <= size; i += AVX2_INTS) {
+            if (size - i > AVX2_PREFETCH_INT) {
+                prefetchL1(data + i + AVX2_PREFETCH_INT);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            min = _mm256_min_epi32(min, vec);
+            max = _mm256_max_epi32(max, vec);
+        }
+
+        alignas(32) int mins[AVX2_INTS];
+        alignas(32) int maxs[AVX2_INTS];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(mins), min);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(maxs), max);
+
+        MinMax<int> result{*std::min_element(mins, mins + AVX2_INTS), *std::max_element(maxs, maxs + AVX2_INTS)};
+        minMaxTail(data, size, i, result);
+        return result;
+    }
+
+    static SIMD_TARGET_AVX512 MinMax<int> minMaxAVX512(const int *data, size_t size) {
+        if (size < AVX512_INTS) {
+            return minMaxBaseline(data, size);
+        }
+
+        __m512i min = _mm512_loadu_si512(data);
+        __m512i max = min;
+
+        size_t i = AVX512_INTS;
+        for (; i + AVX512_INTS <= size; i += AVX512_INTS) {
+            if (size - i > AVX512_PREFETCH_INT) {
+                prefetchL1(data + i + AVX512_PREFETCH_INT);
+            }
+
+            const __m512i vec = _mm512_loadu_si512(data + i);
+            min = _mm512_min_epi32(min, vec);
+            max = _mm512_max_epi32(max, vec);
+        }
+
+        MinMax<int> result{_mm512_reduce_min_epi32(min), _mm512_reduce_max_epi32(max)};
+        minMaxTail(data, size, i, result);
+        return result;
+    }
+
+    static SIMD_TARGET_AVX2 MinMax<long long> minMaxAVX2(const long long *data, size_t size) {
+        if (size < AVX2_LONG_LONGS) {
+            return minMaxBaseline(data, size);
+        }
+
+        __m256i min = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+        __m256i max = min;
+
+        size_t i = AVX2_LONG_LONGS;
+        for (; i + AVX2_LONG_LONGS <= size; i += AVX2_LONG_LONGS) {
+            if (size - i > AVX2_PREFETCH_LONG_LONG) {
+                prefetchL1(data + i + AVX2_PREFETCH_LONG_LONG);
+            }
+
+            // no min/max for 64-bit lanes before AVX-512
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            min = _mm256_blendv_epi8(min, vec, _mm256_cmpgt_epi64(min, vec));
+            max = _mm256_blendv_epi8(max, vec, _mm256_cmpgt_epi64(vec, max));
+        }
+
+        alignas(32) long long mins[AVX2_LONG_LONGS];
+        alignas(32) long long maxs[AVX2_LONG_LONGS];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(mins), min);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(maxs), max);
+
+        MinMax<long long> result{*std::min_element(mins, mins + AVX2_LONG_LONGS),
+                                 *std::max_element(maxs, maxs + AVX2_LONG_LONGS)};
+        minMaxTail(data, size, i, result);
+        return result;
+    }
+
+    static SIMD_TARGET_AVX512 MinMax<long long> minMaxAVX512(const long long *data, size_t size) {
+        if (size < AVX512_LONG_LONGS) {
+            return minMaxBaseline(data, size);
+        }
+
+        __m512i min = _mm512_loadu_si512(data);
+        __m512i max = min;
+
+        size_t i = AVX512_LONG_LONGS;
+        for (; i + AVX512_LONG_LONGS <= size; i += AVX512_LONG_LONGS) {
+            if (size - i > AVX512_PREFETCH_LONG_LONG) {
+                prefetchL1(data + i + AVX512_PREFETCH_LONG_LONG);
+            }
+
+            const __m512i vec = _mm512_loadu_si512(data + i);
+            min = _mm512_min_epi64(min, vec);
+            max = _mm512_max_epi64(max, vec);
+        }
+
+        MinMax<long long> result{_mm512_reduce_min_epi64(min), _mm512_reduce_max_epi64(max)};
+        minMaxTail(data, size, i, result);
+        return result;
+    }
+
+    static __forceinline SIMD_TARGET_AVX2 double reduceAddPd(__m256d vec) {
+        alignas(32) double lanes[AVX2_DOUBLES];
+        _mm256_store_pd(lanes, vec);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    static SIMD_TARGET_AVX2 double sumAVX2(const float *data, size_t size) {
+        __m256d sum0 = _mm256_setzero_pd();
+        __m256d sum1 = _mm256_setzero_pd();
+
+        size_t i = 0;
+        for (; i + AVX2_FLOATS <= size; i += AVX2_FLOATS) {
+            if (size - i > AVX2_PREFETCH_FLOAT) {
+                prefetchL1(data + i + AVX2_PREFETCH_FLOAT);
+            }
+
+            // widen to double before adding, a float sum loses too much precision
+            const __m256 vec = _mm256_loadu_ps(data + i);
+            sum0 = _mm256_add_pd(sum0, _mm256_cvtps_pd(_mm256_castps256_ps128(vec)));
+            sum1 = _mm256_add_pd(sum1, _mm256_cvtps_pd(_mm256_extractf128_ps(vec, 1)));
+        }
+
+        return reduceAddPd(_mm256_add_pd(sum0, sum1)) + sumFloatBaseline(data + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX512 double sumAVX512(const float *data, size_t size) {
+        __m512d sum0 = _mm512_setzero_pd();
+        __m512d sum1 = _mm512_setzero_pd();
+
+        size_t i = 0;
+        for (; i + AVX512_FLOATS <= size; i += AVX512_FLOATS) {
+            if (size - i > AVX512_PREFETCH_FLOAT) {
+                prefetchL1(data + i + AVX512_PREFETCH_FLOAT);
+            }
+
+            // widen to double before adding, a float sum loses too much precision
+            const __m512 vec = _mm512_loadu_ps(data + i);
+            sum0 = _mm512_add_pd(sum0, _mm512_cvtps_pd(_mm512_castps512_ps256(vec)));
+            sum1 = _mm512_add_pd(sum1, _mm512_cvtps_pd(_mm512_extractf32x8_ps(vec, 1)));
+        }
+
+        return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1)) + sumFloatBaseline(data + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX2 double sumAVX2(const double *data, size_t size) {
+        __m256d sum0 = _mm256_setzero_pd();
+        __m256d sum1 = _mm256_setzero_pd();
+
+        size_t i = 0;
+        for (; i + 2 * AVX2_DOUBLES <= size; i += 2 * AVX2_DOUBLES) {
+            if (size - i > AVX2_PREFETCH_DOUBLE) {
+                prefetchL1(data + i + AVX2_PREFETCH_DOUBLE);
+            }
+
+            // two accumulators, so one addition doesn't have to wait for the last
+            sum0 = _mm256_add_pd(sum0, _mm256_loadu_pd(data + i));
+            sum1 = _mm256_add_pd(sum1, _mm256_loadu_pd(data + i + AVX2_DOUBLES));
+        }
+
+        return reduceAddPd(_mm256_add_pd(sum0, sum1)) + sumFloatBaseline(data + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX512 double sumAVX512(const double *data, size_t size) {
+        __m512d sum0 = _mm512_setzero_pd();
+        __m512d sum1 = _mm512_setzero_pd();
+
+        size_t i = 0;
+        for (; i + 2 * AVX512_DOUBLES <= size; i += 2 * AVX512_DOUBLES) {
+            if (size - i > AVX512_PREFETCH_DOUBLE) {
+                prefetchL1(data + i + AVX512_PREFETCH_DOUBLE);
+            }
+
+            // two accumulators, so one addition doesn't have to wait for the last
+            sum0 = _mm512_add_pd(sum0, _mm512_loadu_pd(data + i));
+            sum1 = _mm512_add_pd(sum1, _mm512_loadu_pd(data + i + AVX512_DOUBLES));
+        }
+
+        return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1)) + sumFloatBaseline(data + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX2 MinMax<float> minMaxAVX2(const float *data, size_t size) {
+        if (size < AVX2_FLOATS) {
+            return minMaxFloatBaseline(data, size);
+        }
+
+        __m256 min = _mm256_loadu_ps(data);
+        __m256 max = min;
+        __m256 nan = _mm256_cmp_ps(min, min, _CMP_UNORD_Q);
+
+        size_t i = AVX2_FLOATS;
+        for (; i + AVX2_FLOATS <= size; i += AVX2_FLOATS) {
+            if (size - i > AVX2_PREFETCH_FLOAT) {
+                prefetchL1(data + i + AVX2_PREFETCH_FLOAT);
+            }
+
+            // min/max skip NaN in their first operand, so collect NaN separately
+            const __m256 vec = _mm256_loadu_ps(data + i);
+            min = _mm256_min_ps(vec, min);
+            max = _mm256_max_ps(vec, max);
+            nan = _mm256_or_ps(nan, _mm256_cmp_ps(vec, vec, _CMP_UNORD_Q));
+        }
+
+        if (_mm256_movemask_ps(nan) != 0) {
+            return nanMinMax<float>();
+        }
+
+        alignas(32) float mins[AVX2_FLOATS];
+        alignas(32) float maxs[AVX2_FLOATS];
+        _mm256_store_ps(mins, min);
+        _mm256_store_ps(maxs, max);
+
+        MinMax<float> result{*std::min_element(mins, mins + AVX2_FLOATS), *std::max_element(maxs, maxs + AVX2_FLOATS)};
+        minMaxFloatTail(data, size, i, result);
+        return result;
+    }
+
+    static SIMD_TARGET_AVX512 MinMax<float> minMaxAVX512(const float *data, size_t size) {
+        if (size < AVX512_FLOATS) {
+            return minMaxFloatBaseline(data, size);
+        }
+
+        __m512 min = _mm512_loadu_ps(data);
+        __m512 max = min;
+        __mmask16 nan = _mm512_cmp_ps_mask(min, min, _CMP_UNORD_Q);
+
+        size_t i = AVX512_FLOATS;
+        for (; i + AVX512_FLOATS <= size; i += AVX512_FLOATS) {
+            if (size - i > AVX512_PREFETCH_FLOAT) {
+                prefetchL1(data + i + AVX512_PREFETCH_FLOAT);
+            }
+
+            // min/max skip NaN in their first operand, so collect NaN separately
+            const __m512 vec = _mm512_loadu_ps(data + i);
+            min = _mm512_min_ps(vec, min);
+            max = _mm512_max_ps(vec, max);
+            nan |= _mm512_cmp_ps_mask(vec, vec, _CMP_UNORD_Q);
+        }
+
+        if (nan != 0) {
+            return nanMinMax<float>();
+        }
+
+        MinMax<float> result{_mm512_reduce_min_ps(min), _mm512_reduce_max_ps(max)};
+        minMaxFloatTail(data, size, i, result);
+        return result;
+    }
+
+    static SIMD_TARGET_AVX2 MinMax<double> minMaxAVX2(const double *data, size_t size) {
+        if (size < AVX2_DOUBLES) {
+            return minMaxFloatBaseline(data, size);
+        }
+
+        __m256d min = _mm256_loadu_pd(data);
+        __m256d max = min;
+        __m256d nan = _mm256_cmp_pd(min, min, _CMP_UNORD_Q);
+
+        size_t i = AVX2_DOUBLES;
+        for (; i + AVX2_DOUBLES <= size; i += AVX2_DOUBLES) {
+            if (size - i > AVX2_PREFETCH_DOUBLE) {
+                prefetchL1(data + i + AVX2_PREFETCH_DOUBLE);
+            }
+
+            // min/max skip NaN in their first operand, so collect NaN separately
+            const __m256d vec = _mm256_loadu_pd(data + i);
+            min = _mm256_min_pd(vec, min);
+            max = _mm256_max_pd(vec, max);
+            nan = _mm256_or_pd(nan, _mm256_cmp_pd(vec, vec, _CMP_UNORD_Q));
+        }
+
+        if (_mm256_movemask_pd(nan) != 0) {
+            return nanMinMax<double>();
+        }
+
+        alignas(32) double mins[AVX2_DOUBLES];
+        alignas(32) double maxs[AVX2_DOUBLES];
+        _mm256_store_pd(mins, min);
+        _mm256_store_pd(maxs, max);
+
+        MinMax<double> result{*std::min_element(mins, mins + AVX2_DOUBLES),
+                              *std::max_element(maxs, maxs + AVX2_DOUBLES)};
+        minMaxFloatTail(data, size, i, result);
+        return result;
+    }
+
+    static SIMD_TARGET_AVX512 MinMax<double> minMaxAVX512(const double *data, size_t size) {
+        if (size < AVX512_DOUBLES) {
+            return minMaxFloatBaseline(data, size);
+        }
+
+        __m512d min = _mm512_loadu_pd(data);
+        __m512d max = min;
+        __mmask8 nan = _mm512_cmp_pd_mask(min, min, _CMP_UNORD_Q);
+
+        size_t i = AVX512_DOUBLES;
+        for (; i + AVX512_DOUBLES <= size; i += AVX512_DOUBLES) {
+            if (size - i > AVX512_PREFETCH_DOUBLE) {
+                prefetchL1(data + i + AVX512_PREFETCH_DOUBLE);
+            }
+
+            // min/max skip NaN in their first operand, so collect NaN separately
+            const __m512d vec = _mm512_loadu_pd(data + i);
+            min = _mm512_min_pd(vec, min);
+            max = _mm512_max_pd(vec, max);
+            nan |= _mm512_cmp_pd_mask(vec, vec, _CMP_UNORD_Q);
+        }
+
+        if (nan != 0) {
+            return nanMinMax<double>();
+        }
+
+        MinMax<double> result{_mm512_reduce_min_pd(min), _mm512_reduce_max_pd(max)};
+        minMaxFloatTail(data, size, i, result);
+        return result;
+    }
+
+    static SIMD_TARGET_AVX2 double dotAVX2(const float *a, const float *b, size_t size) {
+        __m256d sum0 = _mm256_setzero_pd();
+        __m256d sum1 = _mm256_setzero_pd();
+
+        size_t i = 0;
+        for (; i + AVX2_FLOATS <= size; i += AVX2_FLOATS) {
+            if (size - i > AVX2_PREFETCH_FLOAT) {
+                prefetchL1(a + i + AVX2_PREFETCH_FLOAT);
+                prefetchL1(b + i + AVX2_PREFETCH_FLOAT);
+            }
+
+            // widen to double before multiplying, like the baseline
+            const __m256 vecA = _mm256_loadu_ps(a + i);
+            const __m256 vecB = _mm256_loadu_ps(b + i);
+            sum0 = _mm256_add_pd(sum0, _mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(vecA)),
+                                                     _mm256_cvtps_pd(_mm256_castps256_ps128(vecB))));
+            sum1 = _mm256_add_pd(sum1, _mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(vecA, 1)),
+                                                     _mm256_cvtps_pd(_mm256_extractf128_ps(vecB, 1))));
+        }
+
+        return reduceAddPd(_mm256_add_pd(sum0, sum1)) + dotBaseline(a + i, b + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX512 double dotAVX512(const float *a, const float *b, size_t size) {
+        __m512d sum0 = _mm512_setzero_pd();
+        __m512d sum1 = _mm512_setzero_pd();
+
+        size_t i = 0;
+        for (; i + AVX512_FLOATS <= size; i += AVX512_FLOATS) {
+            if (size - i > AVX512_PREFETCH_FLOAT) {
+                prefetchL1(a + i + AVX512_PREFETCH_FLOAT);
+                prefetchL1(b + i + AVX512_PREFETCH_FLOAT);
+            }
+
+            // widen to double before multiplying, like the baseline
+            const __m512 vecA = _mm512_loadu_ps(a + i);
+            const __m512 vecB = _mm512_loadu_ps(b + i);
+            sum0 = _mm512_fmadd_pd(_mm512_cvtps_pd(_mm512_castps512_ps256(vecA)),
+                                   _mm512_cvtps_pd(_mm512_castps512_ps256(vecB)), sum0);
+            sum1 = _mm512_fmadd_pd(_mm512_cvtps_pd(_mm512_extractf32x8_ps(vecA, 1)),
+                                   _mm512_cvtps_pd(_mm512_extractf32x8_ps(vecB, 1)), sum1);
+        }
+
+        return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1)) + dotBaseline(a + i, b + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX2 double dotAVX2(const double *a, const double *b, size_t size) {
+        __m256d sum0 = _mm256_setzero_pd();
+        __m256d sum1 = _mm256_setzero_pd();
+
+        size_t i = 0;
+        for (; i + 2 * AVX2_DOUBLES <= size; i += 2 * AVX2_DOUBLES) {
+            if (size - i > AVX2_PREFETCH_DOUBLE) {
+                prefetchL1(a + i + AVX2_PREFETCH_DOUBLE);
+                prefetchL1(b + i + AVX2_PREFETCH_DOUBLE);
+            }
+
+            // no fma in the AVX2 target, not every AVX2 CPU has it
+            sum0 = _mm256_add_pd(sum0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            sum1 = _mm256_add_pd(sum1, _mm256_mul_pd(_mm256_loadu_pd(a + i + AVX2_DOUBLES),
+                                                     _mm256_loadu_pd(b + i + AVX2_DOUBLES)));
+        }
+
+        return reduceAddPd(_mm256_add_pd(sum0, sum1)) + dotBaseline(a + i, b + i, size - i);
+    }
+
+    static SIMD_TARGET_AVX512 double dotAVX512(const double *a, const double *b, size_t size) {
+        __m512d sum0 = _mm512_setzero_pd();
+        __m512d sum1 = _mm512_setzero_pd();
+
+        size_t i = 0;
+        for (; i + 2 * AVX512_DOUBLES <= size; i += 2 * AVX512_DOUBLES) {
+            if (size - i > AVX512_PREFETCH_DOUBLE) {
+                prefetchL1(a + i + AVX512_PREFETCH_DOUBLE);
+                prefetchL1(b + i + AVX512_PREFETCH_DOUBLE);
+            }
+
+            sum0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sum0);
+            sum1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + AVX512_DOUBLES),
+                                   _mm512_loadu_pd(b + i + AVX512_DOUBLES), sum1);
+        }
+
+        return _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1)) + dotBaseline(a + i, b + i, size - i);
+    }
+
+    template<NarrowOrUnsigned T>
+    static SIMD_TARGET_AVX2 NarrowSum<T> sumNarrowAVX2(const T *data, size_t size) {
+        constexpr size_t LANES = AVX2_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+        __m256i sum0 = _mm256_setzero_si256();
+        __m256i sum1 = _mm256_setzero_si256();
+
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            if constexpr (std::same_as<T, signed char>) {
+                // bias to unsigned, then sum every 8 bytes into a 64-bit lane; the bias is taken off at the end
+                sum0 = _mm256_add_epi64(sum0, _mm256_sad_epu8(_mm256_xor_si256(vec, _mm256_set1_epi8(-128)),
+                                                              _mm256_setzero_si256()));
+            } else if constexpr (std::same_as<T, short>) {
+                // pairs fit a 32-bit lane, widen those to 64-bit before adding
+                const __m256i pairs = _mm256_madd_epi16(vec, _mm256_set1_epi16(1));
+                sum0 = _mm256_add_epi64(sum0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(pairs)));
+                sum1 = _mm256_add_epi64(sum1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(pairs, 1)));
+            } else if constexpr (std::same_as<T, unsigned int>) {
+                sum0 = _mm256_add_epi64(sum0, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(vec)));
+                sum1 = _mm256_add_epi64(sum1, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(vec, 1)));
+            } else {
+                sum0 = _mm256_add_epi64(sum0, _mm256_and_si256(vec, _mm256_set1_epi64x(0xFFFFFFFFLL)));
+                sum1 = _mm256_add_epi64(sum1, _mm256_srli_epi64(vec, 32));
+            }
+        }
+
+        const NarrowSum<T> tail = sumNarrow(data + i, size - i);
+        if constexpr (std::same_as<T, signed char>) {
+            return reduceAddEpi64(sum0) - 128 * static_cast<long long>(i) + tail;
+        } else if constexpr (std::same_as<T, unsigned long long>) {
+            return {static_cast<unsigned long long>(reduceAddEpi64(sum0)) + tail.low, reduceAddEpi64(sum1) + tail.high};
+        } else {
+            return static_cast<NarrowSum<T>>(reduceAddEpi64(_mm256_add_epi64(sum0, sum1))) + tail;
+        }
+    }
+
+    template<NarrowOrUnsigned T>
+    static SIMD_TARGET_AVX512 NarrowSum<T> sumNarrowAVX512(const T *data, size_t size) {
+        constexpr size_t LANES = AVX512_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+        __m512i sum0 = _mm512_setzero_si512();
+        __m512i sum1 = _mm512_setzero_si512();
+
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const __m512i vec = _mm512_loadu_si512(data + i);
+            if constexpr (std::same_as<T, signed char>) {
+                sum0 = _mm512_add_epi64(sum0, _mm512_sad_epu8(_mm512_xor_si512(vec, _mm512_set1_epi8(-128)),
+                                                              _mm512_setzero_si512()));
+            } else if constexpr (std::same_as<T, short>) {
+                const __m512i pairs = _mm512_madd_epi16(vec, _mm512_set1_epi16(1));
+                sum0 = _mm512_add_epi64(sum0, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(pairs)));
+                sum1 = _mm512_add_epi64(sum1, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(pairs, 1)));
+            } else if constexpr (std::same_as<T, unsigned int>) {
+                sum0 = _mm512_add_epi64(sum0, _mm512_cvtepu32_epi64(_mm512_castsi512_si256(vec)));
+                sum1 = _mm512_add_epi64(sum1, _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(vec, 1)));
+            } else {
+                sum0 = _mm512_add_epi64(sum0, _mm512_and_si512(vec, _mm512_set1_epi64(0xFFFFFFFFLL)));
+                sum1 = _mm512_add_epi64(sum1, _mm512_srli_epi64(vec, 32));
+            }
+        }
+
+        const NarrowSum<T> tail = sumNarrow(data + i, size - i);
+        if constexpr (std::same_as<T, signed char>) {
+            return _mm512_reduce_add_epi64(sum0) - 128 * static_cast<long long>(i) + tail;
+        } else if constexpr (std::same_as<T, unsigned long long>) {
+            return {static_cast<unsigned long long>(_mm512_reduce_add_epi64(sum0)) + tail.low,
+                    _mm512_reduce_add_epi64(sum1) + tail.high};
+        } else {
+            return static_cast<NarrowSum<T>>(_mm512_reduce_add_epi64(_mm512_add_epi64(sum0, sum1))) + tail;
+        }
+    }
+
+    /**
+     * Lane-wise min or max of a and b.
+     */
+    template<NarrowOrUnsigned T, bool Max>
+    static __forceinline SIMD_TARGET_AVX2 __m256i minOrMaxAVX2(__m256i a, __m256i b) {
+        if constexpr (std::same_as<T, signed char>) {
+            return Max ? _mm256_max_epi8(a, b) : _mm256_min_epi8(a, b);
+        } else if constexpr (std::same_as<T, short>) {
+            return Max ? _mm256_max_epi16(a, b) : _mm256_min_epi16(a, b);
+        } else if constexpr (std::same_as<T, unsigned int>) {
+            return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+        } else {
+            // no unsigned 64-bit compare before AVX-512, flipping the sign bits makes a signed one work
+            const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<long long>::min());
+            const __m256i aGreater = _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+            return Max ? _mm256_blendv_epi8(b, a, aGreater) : _mm256_blendv_epi8(a, b, aGreater);
+        }
+    }
+
+    template<NarrowOrUnsigned T, bool Max>
+    static __forceinline SIMD_TARGET_AVX512 __m512i minOrMaxAVX512(__m512i a, __m512i b) {
+        if constexpr (std::same_as<T, signed char>) {
+            return Max ? _mm512_max_epi8(a, b) : _mm512_min_epi8(a, b);
+        } else if constexpr (std::same_as<T, short>) {
+            return Max ? _mm512_max_epi16(a, b) : _mm512_min_epi16(a, b);
+        } else if constexpr (std::same_as<T, unsigned int>) {
+            return Max ? _mm512_max_epu32(a, b) : _mm512_min_epu32(a, b);
+        } else {
+            return Max ? _mm512_max_epu64(a, b) : _mm512_min_epu64(a, b);
+        }
+    }
+
+    template<NarrowOrUnsigned T>
+    static SIMD_TARGET_AVX2 MinMax<T> minMaxNarrowAVX2(const T *data, size_t size) {
+        constexpr size_t LANES = AVX2_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+        if (size < LANES) {
+            return minMaxNarrow(data, size);
+        }
+
+        __m256i min = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+        __m256i max = min;
+
+        size_t i = LANES;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            min = minOrMaxAVX2<T, false>(min, vec);
+            max = minOrMaxAVX2<T, true>(max, vec);
+        }
+
+        alignas(32) T mins[LANES];
+        alignas(32) T maxs[LANES];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(mins), min);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(maxs), max);
+
+        MinMax<T> result{*std::min_element(mins, mins + LANES), *std::max_element(maxs, maxs + LANES)};
+        minMaxTail(data, size, i, result);
+        return result;
+    }
+
+    template<NarrowOrUnsigned T>
+    static SIMD_TARGET_AVX512 MinMax<T> minMaxNarrowAVX512(const T *data, size_t size) {
+        constexpr size_t LANES = AVX512_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+        if (size < LANES) {
+            return minMaxNarrow(data, size);
+        }
+
+        __m512i min = _mm512_loadu_si512(data);
+        __m512i max = min;
+
+        size_t i = LANES;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const __m512i vec = _mm512_loadu_si512(data + i);
+            min = minOrMaxAVX512<T, false>(min, vec);
+            max = minOrMaxAVX512<T, true>(max, vec);
+        }
+
+        alignas(64) T mins[LANES];
+        alignas(64) T maxs[LANES];
+        _mm512_store_si512(mins, min);
+        _mm512_store_si512(maxs, max);
+
+        MinMax<T> result{*std::min_element(mins, mins + LANES), *std::max_element(maxs, maxs + LANES)};
+        minMaxTail(data, size, i, result);
+        return result;
+    }
+
+#endif
+#pragma clang diagnostic pop
+
+    // Chosen by initReduction() at import. Start at the baseline so an early call is still safe.
+    static IntSumKernel intSumKernel = sumBaseline;
+    static LongLongSumKernel longLongSumKernel = sumBaseline;
+    static IntMinMaxKernel intMinMaxKernel = minMaxBaseline<int>;
+    static LongLongMinMaxKernel longLongMinMaxKernel = minMaxBaseline<long long>;
+    static FloatSumKernel floatSumKernel = sumFloatBaseline<float>;
+    static DoubleSumKernel doubleSumKernel = sumFloatBaseline<double>;
+    static FloatMinMaxKernel floatMinMaxKernel = minMaxFloatBaseline<float>;
+    static DoubleMinMaxKernel doubleMinMaxKernel = minMaxFloatBaseline<double>;
+    static FloatDotKernel floatDotKernel = dotBaseline<float>;
+    static DoubleDotKernel doubleDotKernel = dotBaseline<double>;
+    static NarrowSumKernel<signed char> byteSumKernel = sumNarrowBaseline<signed char>;
+    static NarrowSumKernel<short> shortSumKernel = sumNarrowBaseline<short>;
+    static NarrowSumKernel<unsigned int> unsignedIntSumKernel = sumNarrowBaseline<unsigned int>;
+    static NarrowSumKernel<unsigned long long> unsignedLongLongSumKernel = sumNarrowBaseline<unsigned long long>;
+    static NarrowMinMaxKernel<signed char> byteMinMaxKernel = minMaxNarrowBaseline<signed char>;
+    static NarrowMinMaxKernel<short> shortMinMaxKernel = minMaxNarrowBaseline<short>;
+    static NarrowMinMaxKernel<unsigned int> unsignedIntMinMaxKernel = minMaxNarrowBaseline<unsigned int>;
+    static NarrowMinMaxKernel<unsigned long long> unsignedLongLongMinMaxKernel = minMaxNarrowBaseline<unsigned long long>;
+
+    void initReduction() {
+#if !defined(__arm__) && !defined(__arm64__)
+        if (IS_AVX512_SUPPORTED) {
+            intSumKernel = sumAVX512;
+            longLongSumKernel = sumAVX512;
+            intMinMaxKernel = minMaxAVX512;
+            longLongMinMaxKernel = minMaxAVX512;
+            floatSumKernel = sumAVX512;
+            doubleSumKernel = sumAVX512;
+            floatMinMaxKernel = minMaxAVX512;
+            doubleMinMaxKernel = minMaxAVX512;
+            floatDotKernel = dotAVX512;
+            doubleDotKernel = dotAVX512;
+            byteSumKernel = sumNarrowAVX512<signed char>;
+            shortSumKernel = sumNarrowAVX512<short>;
+            unsignedIntSumKernel = sumNarrowAVX512<unsigned int>;
+            unsignedLongLongSumKernel = sumNarrowAVX512<unsigned long long>;
+            byteMinMaxKernel = minMaxNarrowAVX512<signed char>;
+            shortMinMaxKernel = minMaxNarrowAVX512<short>;
+            unsignedIntMinMaxKernel = minMaxNarrowAVX512<unsigned int>;
+            unsignedLongLongMinMaxKernel = minMaxNarrowAVX512<unsigned long long>;
+        } else if (IS_AVX2_SUPPORTED) {
+            intSumKernel = sumAVX2;
+            longLongSumKernel = sumAVX2;
+            intMinMaxKernel = minMaxAVX2;
+            longLongMinMaxKernel = minMaxAVX2;
+            floatSumKernel = sumAVX2;
+            doubleSumKernel = sumAVX2;
+            floatMinMaxKernel = minMaxAVX2;
+            doubleMinMaxKernel = minMaxAVX2;
+            floatDotKernel = dotAVX2;
+            doubleDotKernel = dotAVX2;
+            byteSumKernel = sumNarrowAVX2<signed char>;
+            shortSumKernel = sumNarrowAVX2<short>;
+            unsignedIntSumKernel = sumNarrowAVX2<unsigned int>;
+            unsignedLongLongSumKernel = sumNarrowAVX2<unsigned long long>;
+            byteMinMaxKernel = minMaxNarrowAVX2<signed char>;
+            shortMinMaxKernel = minMaxNarrowAVX2<short>;
+            unsignedIntMinMaxKernel = minMaxNarrowAVX2<unsigned int>;
+            unsignedLongLongMinMaxKernel = minMaxNarrowAVX2<unsigned long long>;
+        }
+#endif
+    }
+
+    long long simdSum(const int *data, size_t size) {
+        return intSumKernel(data, size);
+    }
+
+    LongLongSum simdSum(const long long *data, size_t size) {
+        return longLongSumKernel(data, size);
+    }
+
+    MinMax<int> simdMinMax(const int *data, size_t size) {
+        return intMinMaxKernel(data, size);
+    }
+
+    MinMax<long long> simdMinMax(const long long *data, size_t size) {
+        return longLongMinMaxKernel(data, size);
+    }
+
+    double simdSum(const float *data, size_t size) {
+        return floatSumKernel(data, size);
+    }
+
+    double simdSum(const double *data, size_t size) {
+        return doubleSumKernel(data, size);
+    }
+
+    MinMax<float> simdMinMax(const float *data, size_t size) {
+        return floatMinMaxKernel(data, size);
+    }
+
+    MinMax<double> simdMinMax(const double *data, size_t size) {
+        return doubleMinMaxKernel(data, size);
+    }
+
+    double simdDot(const float *a, const float *b, size_t size) {
+        return floatDotKernel(a, b, size);
+    }
+
+    double simdDot(const double *a, const double *b, size_t size) {
+        return doubleDotKernel(a, b, size);
+    }
+
+    long long simdSum(const signed char *data, size_t size) {
+        return byteSumKernel(data, size);
+    }
+
+    long long simdSum(const short *data, size_t size) {
+        return shortSumKernel(data, size);
+    }
+
+    unsigned long long simdSum(const unsigned int *data, size_t size) {
+        return unsignedIntSumKernel(data, size);
+    }
+
+    LongLongSum simdSum(const unsigned long long *data, size_t size) {
+        return unsignedLongLongSumKernel(data, size);
+    }
+
+    MinMax<signed char> simdMinMax(const signed char *data, size_t size) {
+        return byteMinMaxKernel(data, size);
+    }
+
+    MinMax<short> simdMinMax(const short *data, size_t size) {
+        return shortMinMaxKernel(data, size);
+    }
+
+    MinMax<unsigned int> simdMinMax(const unsigned int *data, size_t size) {
+        return unsignedIntMinMaxKernel(data, size);
+    }
+
+    MinMax<unsigned long long> simdMinMax(const unsigned long long *data, size_t size) {
+        return unsignedLongLongMinMaxKernel(data, size);
+    }
+}
@@ -0,0 +1,125 @@
+//
+// Created by xia__mc on 2024/12/14.
+//
+
+#ifndef PYFASTUTIL_REDUCTION_H
+#define PYFASTUTIL_REDUCTION_H
+
+#include <cstddef>
+#include "Compat.h"
+
+namespace simd {
+
+    template<typename T>
+    struct MinMax {
+        T min;
+        T max;
+    };
+
+    /**
+     * Exact sum of long longs, split so it can't overflow: low + high * 2^32.
+     */
+    struct LongLongSum {
+        unsigned long long low;
+        long long high;
+    };
+
+    /**
+     * Most long longs simdSum can take at once, callers need to add up larger inputs in chunks.
+     */
+    static constexpr size_t SUM_CHUNK_SIZE = static_cast<size_t>(1) << 31;
+
+    void initReduction();
+
+    /**
+     * Sum of data, accumulated in 64-bit so it can't overflow.
+     */
+    long long simdSum(const int *data, size_t size);
+
+    /**
+     * Sum of data, at most SUM_CHUNK_SIZE elements.
+     */
+    LongLongSum simdSum(const long long *data, size_t size);
+
+    /**
+     * Min and max of data, size must not be 0.
+     */
+    MinMax<int> simdMinMax(const int *data, size_t size);
+
+    /**
+     * Min and max of data, size must not be 0.
+     */
+    MinMax<long long> simdMinMax(const long long *data, size_t size);
+
+    /**
+     * Sum of data, accumulated in 64-bit so it can't overflow.
+     */
+    long long simdSum(const signed char *data, size_t size);
+
+    /**
+     * Sum of data, accumulated in 64-bit so it can't overflow.
+     */
+    long long simdSum(const short *data, size_t size);
+
+    /**
+     * Sum of data, at most SUM_CHUNK_SIZE elements so it can't overflow.
+     */
+    unsigned long long simdSum(const unsigned int *data, size_t size);
+
+    /**
+     * Sum of data, at most SUM_CHUNK_SIZE elements. Neither half is ever negative.
+     */
+    LongLongSum simdSum(const unsigned long long *data, size_t size);
+
+    /**
+     * Min and max of data, size must not be 0.
+     */
+    MinMax<signed char> simdMinMax(const signed char *data, size_t size);
+
+    /**
+     * Min and max of data, size must not be 0.
+     */
+    MinMax<short> simdMinMax(const short *data, size_t size);
+
+    /**
+     * Min and max of data, size must not be 0.
+     */
+    MinMax<unsigned int> simdMinMax(const unsigned int *data, size_t size);
+
+    /**
+     * Min and max of data, size must not be 0.
+     */
+    MinMax<unsigned long long> simdMinMax(const unsigned long long *data, size_t size);
+
+    /**
+     * Sum of data, accumulated in double. The order of additions differs from sum(), so the last bits may too.
+     */
+    double simdSum(const float *data, size_t size);
+
+    /**
+     * Sum of data. The order of additions differs from sum(), so the last bits may too.
+     */
+    double simdSum(const double *data, size_t size);
+
+    /**
+     * Min and max of data, both NaN if any element is NaN. size must not be 0.
+     */
+    MinMax<float> simdMinMax(const float *data, size_t size);
+
+    /**
+     * Min and max of data, both NaN if any element is NaN. size must not be 0.
+     */
+    MinMax<double> simdMinMax(const double *data, size_t size);
+
+    /**
+     * Dot product of a and b, accumulated in double.
+     */
+    double simdDot(const float *a, const float *b, size_t size);
+
+    /**
+     * Dot product of a and b.
+     */
+    double simdDot(const double *a, const double *b, size_t size);
+}
+
+#endif //PYFASTUTIL_REDUCTION_H
@@ -7,12 +7,18 @@
 // Helper function to check OS support for AVX (via XGETBV)
 bool osSupportsAVX();
 
+// Helper function to check OS support for AVX-512 opmask and ZMM state (via XGETBV)
+bool osSupportsAVX512();
+
 // Function to check if AVX2 is supported
 bool isAVX2Supported();
 
 // Function to check if AVX-512 is supported
 bool isAVX512Supported();
 
+// Function to check if AVX-512 VPOPCNTDQ is supported on top of isAVX512Supported()
+bool isAVX512VPOPCNTDQSupported();
+
 // Function to check if SSE4.1 is supported
 bool isSSE41Supported();
 
@@ -44,6 +50,15 @@ bool osSupportsAVX() {
     return (xcrFeatureMask & 0x6) == 0x6;
 }
 
+bool osSupportsAVX512() {
+    if (!osSupportsAVX()) {
+        return false;
+    }
+
+    // Check if opmask (bit 5), upper ZMM (bit 6) and ZMM16-31 (bit 7) state are enabled by OS
+    return (_xgetbv(0) & 0xE0) == 0xE0;
+}
+
 bool isAVX2Supported() {
     int cpuInfo[4];
 
@@ -76,14 +91,26 @@ bool isAVX512Supported() {
         return false; // AVX or XSAVE not supported
     }
 
-    // Check OS support for AVX using XGETBV
-    if (!osSupportsAVX()) {
-        return false; // OS does not support AVX
+    // Check OS support for AVX-512 using XGETBV
+    if (!osSupportsAVX512()) {
+        return false; // OS does not support AVX-512
     }
 
-    // Now check for AVX-512 support (CPUID leaf 7, sub-leaf 0, EBX bit 16)
+    // Now check for AVX-512 F/DQ/BW/VL support (CPUID leaf 7, sub-leaf 0, EBX bit 16/17/30/31)
     __cpuidex(cpuInfo, 7, 0); // CPUID leaf 7, sub-leaf 0
-    return (cpuInfo[1] & (1 << 16)) != 0; // Check if AVX-512 is supported (bit 16 in EBX)
+    const unsigned int required = (1u << 16) | (1u << 17) | (1u << 30) | (1u << 31);
+    return (static_cast<unsigned int>(cpuInfo[1]) & required) == required;
+}
+
+bool isAVX512VPOPCNTDQSupported() {
+    if (!isAVX512Supported()) {
+        return false;
+    }
+
+    // CPUID leaf 7, sub-leaf 0, ECX bit 14
+    int cpuInfo[4];
+    __cpuidex(cpuInfo, 7, 0);
+    return (cpuInfo[2] & (1 << 14)) != 0;
 }
 
 bool isSSE41Supported() {
@@ -118,34 +145,40 @@ bool isArmNeonSupported() {
 
 #include <cpuid.h>  // For __get_cpuid() and __get_cpuid_count()
 
-bool osSupportsAVX() {
+// Read XCR0, or 0 if XGETBV is unavailable
+static unsigned long long readXCR0() {
     // Ensure CPU supports XGETBV (XSAVE/XRSTOR)
     unsigned int cpuid_eax, cpuid_ebx, cpuid_ecx, cpuid_edx;
     __get_cpuid(1, &cpuid_eax, &cpuid_ebx, &cpuid_ecx, &cpuid_edx);
 
     // Check if XSAVE/XRSTOR is supported (bit 27 of ECX)
     if (!(cpuid_ecx & (1 << 27))) {
-        return false; // XSAVE not supported, so XGETBV cannot be used
+        return 0; // XSAVE not supported, so XGETBV cannot be used
     }
 #if defined(__APPLE__)  // IDK why
-    return false;
-#elif defined(__GNUC__) && (__GNUC__ >= 8)
-    // GCC 8+ has __builtin_ia32_xgetbv()
-    unsigned long long xcrFeatureMask = __builtin_ia32_xgetbv(0);
-    // Check if XMM (bit 1) and YMM (bit 2) state are enabled by OS
-    return (xcrFeatureMask & 0x6) == 0x6; // Both XMM and YMM must be enabled
+    return 0;
 #else
+    // inline asm instead of __builtin_ia32_xgetbv(), which needs -mxsave on the whole unit
+    unsigned int eax, edx;
     __asm__ __volatile__(
             "xgetbv"
             : "=a"(eax), "=d"(edx)
             : "c"(0)
-        );
-    unsigned long long xcrFeatureMask = ((unsigned long long)edx << 32) | eax;
-    // Check if XMM (bit 1) and YMM (bit 2) state are enabled by OS
-    return (xcrFeatureMask & 0x6) == 0x6; // Both XMM and YMM must be enabled
+            );
+    return ((unsigned long long) edx << 32) | eax;
 #endif
 }
 
+bool osSupportsAVX() {
+    // Check if XMM (bit 1) and YMM (bit 2) state are enabled by OS
+    return (readXCR0() & 0x6) == 0x6; // Both XMM and YMM must be enabled
+}
+
+bool osSupportsAVX512() {
+    // Check if XMM/YMM plus opmask (bit 5), upper ZMM (bit 6) and ZMM16-31 (bit 7) state are enabled by OS
+    return (readXCR0() & 0xE6) == 0xE6;
+}
+
 bool isAVX2Supported() {
     unsigned int eax, ebx, ecx, edx;
 
@@ -187,17 +220,31 @@ bool isAVX512Supported() {
         return false; // AVX or XSAVE not supported
     }
 
-    // Check OS support for AVX using XGETBV
-    if (!osSupportsAVX()) {
-        return false; // OS does not support AVX
+    // Check OS support for AVX-512 using XGETBV
+    if (!osSupportsAVX512()) {
+        return false; // OS does not support AVX-512
     }
 
-    // Now check for AVX-512 support (CPUID leaf 7, sub-leaf 0, EBX bit 16)
+    // Now check for AVX-512 F/DQ/BW/VL support (CPUID leaf 7, sub-leaf 0, EBX bit 16/17/30/31)
     if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
         return false;
     }
 
-    return (ebx & (1 << 16)) != 0; // Check if AVX-512 is supported
+    const unsigned int required = (1u << 16) | (1u << 17) | (1u << 30) | (1u << 31);
+    return (ebx & required) == required; // the kernels use all of them
+}
+
+bool isAVX512VPOPCNTDQSupported() {
+    if (!isAVX512Supported()) {
+        return false;
+    }
+
+    // CPUID leaf 7, sub-leaf 0, ECX bit 14
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return (ecx & (1 << 14)) != 0;
 }
 
 bool isSSE41Supported() {
@@ -232,6 +279,10 @@ bool osSupportsAVX() {
     return false;
 }
 
+bool osSupportsAVX512() {
+    return false;
+}
+
 bool isAVX2Supported() {
     return false;
 }
@@ -240,6 +291,10 @@ bool isAVX512Supported() {
     return false;
 }
 
+bool isAVX512VPOPCNTDQSupported() {
+    return false;
+}
+
 bool isSSE41Supported() {
     return false;
 }
@@ -264,6 +319,10 @@ bool osSupportsAVX() {
     return false;
 }
 
+bool osSupportsAVX512() {
+    return false;
+}
+
 bool isAVX2Supported() {
     return false;
 }
@@ -272,6 +331,10 @@ bool isAVX512Supported() {
     return false;
 }
 
+bool isAVX512VPOPCNTDQSupported() {
+    return false;
+}
+
 bool isSSE41Supported() {
     return false;
 }
@@ -303,6 +366,7 @@ bool isArmNeonSupported() {
 namespace simd {
     const bool IS_AVX2_SUPPORTED = isAVX2Supported();
     const bool IS_AVX512_SUPPORTED = isAVX512Supported();
+    const bool IS_AVX512_VPOPCNTDQ_SUPPORTED = isAVX512VPOPCNTDQSupported();
     const bool IS_SSE41_SUPPORTED = isSSE41Supported();
     const bool IS_SSSE3_SUPPORTED = isSSSE3Supported();
     const bool IS_ARM_NEON_SUPPORTED = isArmNeonSupported();
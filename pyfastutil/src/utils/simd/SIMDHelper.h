@@ -8,9 +8,41 @@
 #include <cstdlib>
 #include "utils/PythonPCH.h"
 
+/*
+ * The extension itself is compiled for the baseline ISA only. Kernels that use wider instructions
+ * are tagged with one of the SIMD_TARGET_* attributes and must only be reached through the function
+ * pointers picked at import (see simd::initSIMDUtils and simd::initBitonicSort), so importing on a
+ * CPU without AVX2/AVX-512 never executes an unsupported instruction.
+ * MSVC doesn't need this, it accepts every intrinsic without /arch.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+#define SIMD_TARGET_AVX512_VPOPCNTDQ __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx512vpopcntdq")))
+
+// apply SIMD_TARGET_AVX512 to every function between SIMD_AVX512_BEGIN and SIMD_AVX512_END
+#if defined(__clang__)
+#define SIMD_AVX512_BEGIN _Pragma("clang attribute push (__attribute__((target(\"avx512f,avx512bw,avx512dq,avx512vl\"))), apply_to = function)")
+#define SIMD_AVX512_END _Pragma("clang attribute pop")
+#else
+#define SIMD_AVX512_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx512bw,avx512dq,avx512vl\")")
+#define SIMD_AVX512_END _Pragma("GCC pop_options")
+#endif
+#else
+#define SIMD_TARGET_SSSE3
+#define SIMD_TARGET_AVX2
+#define SIMD_TARGET_AVX512
+#define SIMD_TARGET_AVX512_VPOPCNTDQ
+#define SIMD_AVX512_BEGIN
+#define SIMD_AVX512_END
+#endif
+
 namespace simd {
     extern const bool IS_AVX2_SUPPORTED;
     extern const bool IS_AVX512_SUPPORTED;
+    // AVX-512 plus VPOPCNTDQ, which only some AVX-512 CPUs have
+    extern const bool IS_AVX512_VPOPCNTDQ_SUPPORTED;
     extern const bool IS_SSE41_SUPPORTED;
     extern const bool IS_SSSE3_SUPPORTED;
     extern const bool IS_ARM_NEON_SUPPORTED;
@@ -28,6 +60,14 @@ namespace simd {
     static constexpr size_t AVX2_LONG_LONGS = AVX2_BLOCK_SIZE / (sizeof(long long));
     static constexpr size_t AVX512_LONG_LONGS = AVX512_BLOCK_SIZE / (sizeof(long long));
 
+    static constexpr size_t SSE41_FLOATS = SSE41_BLOCK_SIZE / (sizeof(float));
+    static constexpr size_t AVX2_FLOATS = AVX2_BLOCK_SIZE / (sizeof(float));
+    static constexpr size_t AVX512_FLOATS = AVX512_BLOCK_SIZE / (sizeof(float));
+
+    static constexpr size_t SSE41_DOUBLES = SSE41_BLOCK_SIZE / (sizeof(double));
+    static constexpr size_t AVX2_DOUBLES = AVX2_BLOCK_SIZE / (sizeof(double));
+    static constexpr size_t AVX512_DOUBLES = AVX512_BLOCK_SIZE / (sizeof(double));
+
     static constexpr size_t SSE41_PY_OBJECTS = SSE41_BLOCK_SIZE / (sizeof(PyObject *));
     static constexpr size_t AVX2_PY_OBJECTS = AVX2_BLOCK_SIZE / (sizeof(PyObject *));
     static constexpr size_t AVX512_PY_OBJECTS = AVX512_BLOCK_SIZE / (sizeof(PyObject *));
@@ -41,6 +81,14 @@ namespace simd {
     static constexpr size_t AVX2_PREFETCH_LONG_LONG = AVX2_LONG_LONGS * 4;
     static constexpr size_t SSE41_PREFETCH_LONG_LONG = SSE41_LONG_LONGS * 4;
 
+    static constexpr size_t AVX512_PREFETCH_FLOAT = AVX512_FLOATS * 4;
+    static constexpr size_t AVX2_PREFETCH_FLOAT = AVX2_FLOATS * 4;
+    static constexpr size_t SSE41_PREFETCH_FLOAT = SSE41_FLOATS * 4;
+
+    static constexpr size_t AVX512_PREFETCH_DOUBLE = AVX512_DOUBLES * 4;
+    static constexpr size_t AVX2_PREFETCH_DOUBLE = AVX2_DOUBLES * 4;
+    static constexpr size_t SSE41_PREFETCH_DOUBLE = SSE41_DOUBLES * 4;
+
     static constexpr size_t AVX512_PREFETCH_PY_OBJECT = AVX512_PY_OBJECTS * 4;
     static constexpr size_t AVX2_PREFETCH_PY_OBJECT = AVX2_PY_OBJECTS * 4;
     static constexpr size_t SSE41_PREFETCH_PY_OBJECT = SSE41_PY_OBJECTS * 4;
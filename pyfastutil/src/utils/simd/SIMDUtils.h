@@ -5,12 +5,8 @@
 #ifndef PYFASTUTIL_SIMD_UTILS_H
 #define PYFASTUTIL_SIMD_UTILS_H
 
-#if !defined(_MSC_VER)
-
 #include "cstring"
 
-#endif
-
 #if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
 
 #include <immintrin.h>
@@ -24,143 +20,126 @@
 
 namespace simd {
 
+    using MemCpyKernel = void (*)(const void *__restrict from, void *__restrict to, size_t bytes);
+
+    inline void memCpyBaseline(const void *__restrict from, void *__restrict to, size_t bytes) {
+        // libc already picks the best copy for this cpu
+        memcpy(to, from, bytes);
+    }
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
     /**
-     * Optimized memory copy with SIMD and prefetching.
-     * @param from Pointer to the source memory.
-     * @param to Pointer to the destination memory.
-     * @param count Number of elements to copy (not bytes).
+     * Copy 32-byte blocks with AVX2 and prefetching, the remainder goes to memcpy.
+     * @tparam Aligned whether both pointers are aligned with 32 bytes
      */
-    template<typename T>
-    static __forceinline void simdMemCpy(T *__restrict from, T *__restrict to, size_t count) {
-#if !defined(__x86_64__) && !defined(_M_X64) && !defined(__i386__) && !defined(_M_IX86)
-        memcpy(to, from, count * sizeof(T));
-#else
-        if ((!IS_AVX512_SUPPORTED && !IS_AVX2_SUPPORTED && !IS_SSE41_SUPPORTED) || count < 8) {
-            memcpy(to, from, count * sizeof(T));
-        }
-
-        constexpr size_t AVX512_ELEMENTS = AVX512_BLOCK_SIZE / sizeof(T);
-        constexpr size_t AVX512_PREFETCH = AVX512_ELEMENTS * 4;
-        constexpr size_t AVX2_ELEMENTS = AVX2_BLOCK_SIZE / sizeof(T);
-        constexpr size_t AVX2_PREFETCH = AVX2_ELEMENTS * 4;
-        constexpr size_t SSE41_ELEMENTS = SSE41_BLOCK_SIZE / sizeof(T);
-        constexpr size_t SSE41_PREFETCH = SSE41_ELEMENTS * 4;
+    template<bool Aligned>
+    SIMD_TARGET_AVX2 inline void memCpyAVX2(const void *__restrict from, void *__restrict to, size_t bytes) {
+        const auto *src = static_cast<const char *>(from);
+        auto *dst = static_cast<char *>(to);
+        constexpr size_t AVX2_PREFETCH = AVX2_BLOCK_SIZE * 4;
 
         size_t copied = 0;
+        for (; bytes - copied >= AVX2_BLOCK_SIZE; copied += AVX2_BLOCK_SIZE) {
+            if (bytes - copied > AVX2_PREFETCH) {
+                prefetchL1(src + copied + AVX2_PREFETCH);
+            }
 
-        // AVX-512 block
-        if (IS_AVX512_SUPPORTED && count - copied >= AVX512_ELEMENTS) {
-            for (; count - copied >= AVX512_ELEMENTS; copied += AVX512_ELEMENTS) {
-                if (count - copied > AVX512_PREFETCH) {
-                    prefetchL1(from + copied + AVX512_PREFETCH);
-                }
-
-                __m512i vec = _mm512_loadu_si512(from + copied);
-                _mm512_storeu_si512(to + copied, vec);
+            if constexpr (Aligned) {
+                __m256i vec = _mm256_load_si256(reinterpret_cast<const __m256i *>(src + copied));
+                _mm256_store_si256(reinterpret_cast<__m256i *>(dst + copied), vec);
+            } else {
+                __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + copied));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + copied), vec);
             }
         }
 
-        // AVX2 block
-        if (IS_AVX2_SUPPORTED && count - copied >= AVX2_ELEMENTS) {
-            for (; count - copied >= AVX2_ELEMENTS; copied += AVX2_ELEMENTS) {
-                if (count - copied > AVX2_PREFETCH) {
-                    prefetchL1(from + copied + AVX2_PREFETCH);
-                }
+        memcpy(dst + copied, src + copied, bytes - copied);
+    }
 
-                __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + copied));
-                _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + copied), vec);
-            }
-        }
+    /**
+     * Copy 64-byte blocks with AVX-512 and prefetching, the remainder goes to the AVX2 kernel.
+     * @tparam Aligned whether both pointers are aligned with 64 bytes
+     */
+    template<bool Aligned>
+    SIMD_TARGET_AVX512 inline void memCpyAVX512(const void *__restrict from, void *__restrict to, size_t bytes) {
+        const auto *src = static_cast<const char *>(from);
+        auto *dst = static_cast<char *>(to);
+        constexpr size_t AVX512_PREFETCH = AVX512_BLOCK_SIZE * 4;
 
-        // SSE4.1 block
-        if (IS_SSE41_SUPPORTED && count - copied >= SSE41_ELEMENTS) {
-            for (; count - copied >= SSE41_ELEMENTS; copied += SSE41_ELEMENTS) {
-                if (count - copied > SSE41_PREFETCH) {
-                    prefetchL1(from + copied + SSE41_PREFETCH);
-                }
+        size_t copied = 0;
+        for (; bytes - copied >= AVX512_BLOCK_SIZE; copied += AVX512_BLOCK_SIZE) {
+            if (bytes - copied > AVX512_PREFETCH) {
+                prefetchL1(src + copied + AVX512_PREFETCH);
+            }
 
-                __m128i vec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + copied));
-                _mm_storeu_si128(reinterpret_cast<__m128i *>(to + copied), vec);
+            if constexpr (Aligned) {
+                __m512i vec = _mm512_load_si512(src + copied);
+                _mm512_store_si512(dst + copied, vec);
+            } else {
+                __m512i vec = _mm512_loadu_si512(src + copied);
+                _mm512_storeu_si512(dst + copied, vec);
             }
         }
 
-        // Handle remaining elements manually (less than the smallest SIMD width)
-        while (copied < count) {
-            to[copied] = from[copied];
-            ++copied;
+        memCpyAVX2<Aligned>(src + copied, dst + copied, bytes - copied);
+    }
+
+#endif
+
+    // Chosen by initSIMDUtils() at import. Start at the baseline so an early call is still safe.
+    inline MemCpyKernel memCpyKernel = memCpyBaseline;
+    inline MemCpyKernel memCpyAlignedKernel = memCpyBaseline;
+
+    /**
+     * Pick the widest kernels this cpu supports, called once at import.
+     */
+    inline void initSIMDUtils() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+        if (IS_AVX512_SUPPORTED) {
+            memCpyKernel = memCpyAVX512<false>;
+            memCpyAlignedKernel = memCpyAVX512<true>;
+        } else if (IS_AVX2_SUPPORTED) {
+            memCpyKernel = memCpyAVX2<false>;
+            memCpyAlignedKernel = memCpyAVX2<true>;
         }
 #endif
+        initQReverse();
     }
 
-    static __forceinline void simdMemCpy(void *__restrict from, void *__restrict to, size_t count) = delete;
-
     /**
      * Optimized memory copy with SIMD and prefetching.
-     * MAKE SURE MEMORY IS ALIGNED with 64 bytes.
      * @param from Pointer to the source memory.
      * @param to Pointer to the destination memory.
      * @param count Number of elements to copy (not bytes).
      */
     template<typename T>
-    static __forceinline void simdMemCpyAligned(T *__restrict from, T *__restrict to, size_t count) {
-#if !defined(__x86_64__) && !defined(_M_X64) && !defined(__i386__) && !defined(_M_IX86)
-        memcpy(to, from, count * sizeof(T));
-#else
-        if ((!IS_AVX512_SUPPORTED && !IS_AVX2_SUPPORTED && !IS_SSE41_SUPPORTED) || count < 8) {
+    static __forceinline void simdMemCpy(T *__restrict from, T *__restrict to, size_t count) {
+        if (count < 8) {
             memcpy(to, from, count * sizeof(T));
+            return;
         }
 
-        constexpr size_t AVX512_ELEMENTS = AVX512_BLOCK_SIZE / sizeof(T);
-        constexpr size_t AVX512_PREFETCH = AVX512_ELEMENTS * 4;
-        constexpr size_t AVX2_ELEMENTS = AVX2_BLOCK_SIZE / sizeof(T);
-        constexpr size_t AVX2_PREFETCH = AVX2_ELEMENTS * 4;
-        constexpr size_t SSE41_ELEMENTS = SSE41_BLOCK_SIZE / sizeof(T);
-        constexpr size_t SSE41_PREFETCH = SSE41_ELEMENTS * 4;
-
-        size_t copied = 0;
-
-        // AVX-512 block
-        if (IS_AVX512_SUPPORTED && count - copied >= AVX512_ELEMENTS) {
-            for (; count - copied >= AVX512_ELEMENTS; copied += AVX512_ELEMENTS) {
-                if (count - copied > AVX512_PREFETCH) {
-                    prefetchL1(from + copied + AVX512_PREFETCH);
-                }
-
-                __m512i vec = _mm512_load_si512(from + copied);
-                _mm512_store_si512(to + copied, vec);
-            }
-        }
-
-        // AVX2 block
-        if (IS_AVX2_SUPPORTED && count - copied >= AVX2_ELEMENTS) {
-            for (; count - copied >= AVX2_ELEMENTS; copied += AVX2_ELEMENTS) {
-                if (count - copied > AVX2_PREFETCH) {
-                    prefetchL1(from + copied + AVX2_PREFETCH);
-                }
-
-                __m256i vec = _mm256_load_si256(reinterpret_cast<const __m256i *>(from + copied));
-                _mm256_store_si256(reinterpret_cast<__m256i *>(to + copied), vec);
-            }
-        }
+        memCpyKernel(from, to, count * sizeof(T));
+    }
 
-        // SSE4.1 block
-        if (IS_SSE41_SUPPORTED && count - copied >= SSE41_ELEMENTS) {
-            for (; count - copied >= SSE41_ELEMENTS; copied += SSE41_ELEMENTS) {
-                if (count - copied > SSE41_PREFETCH) {
-                    prefetchL1(from + copied + SSE41_PREFETCH);
-                }
+    static __forceinline void simdMemCpy(void *__restrict from, void *__restrict to, size_t count) = delete;
 
-                __m128i vec = _mm_load_si128(reinterpret_cast<const __m128i *>(from + copied));
-                _mm_store_si128(reinterpret_cast<__m128i *>(to + copied), vec);
-            }
+    /**
+     * Optimized memory copy with SIMD and prefetching.
+     * MAKE SURE MEMORY IS ALIGNED with 64 bytes.
+     * @param from Pointer to the source memory.
+     * @param to Pointer to the destination memory.
+     * @param count Number of elements to copy (not bytes).
+     */
+    template<typename T>
+    static __forceinline void simdMemCpyAligned(T *__restrict from, T *__restrict to, size_t count) {
+        if (count < 8) {
+            memcpy(to, from, count * sizeof(T));
+            return;
         }
 
-        // Handle remaining elements manually (less than the smallest SIMD width)
-        while (copied < count) {
-            to[copied] = from[copied];
-            ++copied;
-        }
-#endif
+        memCpyAlignedKernel(from, to, count * sizeof(T));
     }
 
     static __forceinline void simdMemCpyAligned(void *__restrict from, void *__restrict to, size_t count) = delete;
@@ -0,0 +1,554 @@
+//
+// Created by xia__mc on 2024/12/14.
+//
+
+#include "Search.h"
+
+#include <bit>
+#include <algorithm>
+
+#if !defined(__arm__) && !defined(__arm64__)
+
+#include <immintrin.h>
+
+#endif
+
+#include "SIMDHelper.h"
+#include "utils/memory/PreFetch.h"
+#include "utils/include/UnorderedDense.h"
+
+template<typename T>
+concept NarrowInt = std::same_as<T, signed char> || std::same_as<T, short>;
+
+namespace simd {
+
+    template<typename T>
+    using FindKernel = size_t (*)(const T *data, size_t size, T value);
+
+    template<typename T>
+    using CountKernel = size_t (*)(const T *data, size_t size, T value);
+
+    template<typename T>
+    using CountAllKernel = void (*)(const T *data, size_t size, const T *needles, size_t needleCount, size_t *counts);
+
+    /**
+     * Most needles simdCountAll compares against every register, more than that go through a hash table.
+     */
+    static constexpr size_t COUNT_ALL_SIMD_NEEDLES = 8;
+
+    template<typename T>
+    static __forceinline size_t findTail(const T *data, size_t size, size_t i, T value) {
+        for (; i < size; ++i) {
+            if (data[i] == value) {
+                return i;
+            }
+        }
+        return size;
+    }
+
+    template<typename T>
+    static size_t findBaseline(const T *data, size_t size, T value) {
+        return findTail(data, size, 0, value);
+    }
+
+    template<typename T>
+    static __forceinline size_t countTail(const T *data, size_t size, size_t i, T value) {
+        size_t count = 0;
+        for (; i < size; ++i) {
+            count += data[i] == value;
+        }
+        return count;
+    }
+
+    template<typename T>
+    static size_t countBaseline(const T *data, size_t size, T value) {
+        return countTail(data, size, 0, value);
+    }
+
+    template<typename T>
+    static __forceinline void countAllTail(const T *data, size_t size, size_t i,
+                                           const T *needles, size_t needleCount, size_t *counts) {
+        for (; i < size; ++i) {
+            for (size_t j = 0; j < needleCount; ++j) {
+                counts[j] += data[i] == needles[j];
+            }
+        }
+    }
+
+    template<typename T>
+    static void countAllBaseline(const T *data, size_t size, const T *needles, size_t needleCount, size_t *counts) {
+        countAllTail(data, size, 0, needles, needleCount, counts);
+    }
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "portability-simd-intrinsics"
+#if !defined(__arm__) && !defined(__arm64__)
+
+    static SIMD_TARGET_AVX2 size_t findAVX2(const int *data, size_t size, int value) {
+        const __m256i target = _mm256_set1_epi32(value);
+
+        size_t i = 0;
+        for (; i + AVX2_INTS <= size; i += AVX2_INTS) {
+            if (size - i > AVX2_PREFETCH_INT) {
+                prefetchL1(data + i + AVX2_PREFETCH_INT);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            const auto mask = static_cast<unsigned int>(_mm256_movemask_ps(
+                    _mm256_castsi256_ps(_mm256_cmpeq_epi32(vec, target))));
+            if (mask != 0) {
+                return i + std::countr_zero(mask);
+            }
+        }
+
+        return findTail(data, size, i, value);
+    }
+
+    static SIMD_TARGET_AVX2 size_t findAVX2(const long long *data, size_t size, long long value) {
+        const __m256i target = _mm256_set1_epi64x(value);
+
+        size_t i = 0;
+        for (; i + AVX2_LONG_LONGS <= size; i += AVX2_LONG_LONGS) {
+            if (size - i > AVX2_PREFETCH_LONG_LONG) {
+                prefetchL1(data + i + AVX2_PREFETCH_LONG_LONG);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            const auto mask = static_cast<unsigned int>(_mm256_movemask_pd(
+                    _mm256_castsi256_pd(_mm256_cmpeq_epi64(vec, target))));
+            if (mask != 0) {
+                return i + std::countr_zero(mask);
+            }
+        }
+
+        return findTail(data, size, i, value);
+    }
+
+    static SIMD_TARGET_AVX512 size_t findAVX512(const int *data, size_t size, int value) {
+        const __m512i target = _mm512_set1_epi32(value);
+
+        size_t i = 0;
+        for (; i + AVX512_INTS <= size; i += AVX512_INTS) {
+            if (size - i > AVX512_PREFETCH_INT) {
+                prefetchL1(data + i + AVX512_PREFETCH_INT);
+            }
+
+            const __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), target);
+            if (mask != 0) {
+                return i + std::countr_zero(static_cast<unsigned int>(mask));
+            }
+        }
+
+        return findTail(data, size, i, value);
+    }
+
+    static SIMD_TARGET_AVX512 size_t findAVX512(const long long *data, size_t size, long long value) {
+        const __m512i target = _mm512_set1_epi64(value);
+
+        size_t i = 0;
+        for (; i + AVX512_LONG_LONGS <= size; i += AVX512_LONG_LONGS) {
+            if (size - i > AVX512_PREFETCH_LONG_LONG) {
+                prefetchL1(data + i + AVX512_PREFETCH_LONG_LONG);
+            }
+
+            const __mmask8 mask = _mm512_cmpeq_epi64_mask(_mm512_loadu_si512(data + i), target);
+            if (mask != 0) {
+                return i + std::countr_zero(static_cast<unsigned int>(mask));
+            }
+        }
+
+        return findTail(data, size, i, value);
+    }
+
+    static SIMD_TARGET_AVX2 size_t countAVX2(const int *data, size_t size, int value) {
+        const __m256i target = _mm256_set1_epi32(value);
+
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + AVX2_INTS <= size; i += AVX2_INTS) {
+            if (size - i > AVX2_PREFETCH_INT) {
+                prefetchL1(data + i + AVX2_PREFETCH_INT);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            count += std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(
+                    _mm256_castsi256_ps(_mm256_cmpeq_epi32(vec, target)))));
+        }
+
+        return count + countTail(data, size, i, value);
+    }
+
+    static SIMD_TARGET_AVX2 size_t countAVX2(const long long *data, size_t size, long long value) {
+        const __m256i target = _mm256_set1_epi64x(value);
+
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + AVX2_LONG_LONGS <= size; i += AVX2_LONG_LONGS) {
+            if (size - i > AVX2_PREFETCH_LONG_LONG) {
+                prefetchL1(data + i + AVX2_PREFETCH_LONG_LONG);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            count += std::popcount(static_cast<unsigned int>(_mm256_movemask_pd(
+                    _mm256_castsi256_pd(_mm256_cmpeq_epi64(vec, target)))));
+        }
+
+        return count + countTail(data, size, i, value);
+    }
+
+    static SIMD_TARGET_AVX512 size_t countAVX512(const int *data, size_t size, int value) {
+        const __m512i target = _mm512_set1_epi32(value);
+
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + AVX512_INTS <= size; i += AVX512_INTS) {
+            if (size - i > AVX512_PREFETCH_INT) {
+                prefetchL1(data + i + AVX512_PREFETCH_INT);
+            }
+
+            const __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), target);
+            count += std::popcount(static_cast<unsigned int>(mask));
+        }
+
+        return count + countTail(data, size, i, value);
+    }
+
+    static SIMD_TARGET_AVX512 size_t countAVX512(const long long *data, size_t size, long long value) {
+        const __m512i target = _mm512_set1_epi64(value);
+
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + AVX512_LONG_LONGS <= size; i += AVX512_LONG_LONGS) {
+            if (size - i > AVX512_PREFETCH_LONG_LONG) {
+                prefetchL1(data + i + AVX512_PREFETCH_LONG_LONG);
+            }
+
+            const __mmask8 mask = _mm512_cmpeq_epi64_mask(_mm512_loadu_si512(data + i), target);
+            count += std::popcount(static_cast<unsigned int>(mask));
+        }
+
+        return count + countTail(data, size, i, value);
+    }
+
+    /**
+     * Equal bytes of a and b as a bitmask, 8-bit lanes set one bit and 16-bit lanes set two.
+     */
+    template<NarrowInt T>
+    static __forceinline SIMD_TARGET_AVX2 unsigned int equalBytesAVX2(__m256i a, __m256i b) {
+        if constexpr (sizeof(T) == 1) {
+            return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+        } else {
+            return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(a, b)));
+        }
+    }
+
+    template<NarrowInt T>
+    static SIMD_TARGET_AVX2 size_t findNarrowAVX2(const T *data, size_t size, T value) {
+        constexpr size_t LANES = AVX2_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+        const __m256i target = sizeof(T) == 1 ? _mm256_set1_epi8(static_cast<char>(value))
+                                              : _mm256_set1_epi16(static_cast<short>(value));
+
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            const unsigned int mask = equalBytesAVX2<T>(vec, target);
+            if (mask != 0) {
+                return i + std::countr_zero(mask) / sizeof(T);
+            }
+        }
+
+        return findTail(data, size, i, value);
+    }
+
+    template<NarrowInt T>
+    static SIMD_TARGET_AVX2 size_t countNarrowAVX2(const T *data, size_t size, T value) {
+        constexpr size_t LANES = AVX2_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+        const __m256i target = sizeof(T) == 1 ? _mm256_set1_epi8(static_cast<char>(value))
+                                              : _mm256_set1_epi16(static_cast<short>(value));
+
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            count += std::popcount(equalBytesAVX2<T>(vec, target)) / sizeof(T);
+        }
+
+        return count + countTail(data, size, i, value);
+    }
+
+    /**
+     * Equal lanes of a and b as a bitmask, one bit per lane.
+     */
+    template<NarrowInt T>
+    static __forceinline SIMD_TARGET_AVX512 unsigned long long equalLanesAVX512(__m512i a, __m512i b) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm512_cmpeq_epi8_mask(a, b);
+        } else {
+            return _mm512_cmpeq_epi16_mask(a, b);
+        }
+    }
+
+    template<NarrowInt T>
+    static SIMD_TARGET_AVX512 size_t findNarrowAVX512(const T *data, size_t size, T value) {
+        constexpr size_t LANES = AVX512_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+        const __m512i target = sizeof(T) == 1 ? _mm512_set1_epi8(static_cast<char>(value))
+                                              : _mm512_set1_epi16(static_cast<short>(value));
+
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const unsigned long long mask = equalLanesAVX512<T>(_mm512_loadu_si512(data + i), target);
+            if (mask != 0) {
+                return i + std::countr_zero(mask);
+            }
+        }
+
+        return findTail(data, size, i, value);
+    }
+
+    template<NarrowInt T>
+    static SIMD_TARGET_AVX512 size_t countNarrowAVX512(const T *data, size_t size, T value) {
+        constexpr size_t LANES = AVX512_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+        const __m512i target = sizeof(T) == 1 ? _mm512_set1_epi8(static_cast<char>(value))
+                                              : _mm512_set1_epi16(static_cast<short>(value));
+
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            count += std::popcount(equalLanesAVX512<T>(_mm512_loadu_si512(data + i), target));
+        }
+
+        return count + countTail(data, size, i, value);
+    }
+
+    /**
+     * Compare every register of data against each of the (at most COUNT_ALL_SIMD_NEEDLES) needles.
+     */
+    template<typename T>
+    static SIMD_TARGET_AVX2 void countAllAVX2(const T *data, size_t size, const T *needles, size_t needleCount,
+                                              size_t *counts) {
+        constexpr size_t LANES = AVX2_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+
+        __m256i targets[COUNT_ALL_SIMD_NEEDLES];
+        for (size_t j = 0; j < needleCount; ++j) {
+            if constexpr (sizeof(T) == sizeof(int)) {
+                targets[j] = _mm256_set1_epi32(needles[j]);
+            } else {
+                targets[j] = _mm256_set1_epi64x(needles[j]);
+            }
+        }
+
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            for (size_t j = 0; j < needleCount; ++j) {
+                if constexpr (sizeof(T) == sizeof(int)) {
+                    counts[j] += std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(
+                            _mm256_castsi256_ps(_mm256_cmpeq_epi32(vec, targets[j])))));
+                } else {
+                    counts[j] += std::popcount(static_cast<unsigned int>(_mm256_movemask_pd(
+                            _mm256_castsi256_pd(_mm256_cmpeq_epi64(vec, targets[j])))));
+                }
+            }
+        }
+
+        countAllTail(data, size, i, needles, needleCount, counts);
+    }
+
+    /**
+     * Compare every register of data against each of the (at most COUNT_ALL_SIMD_NEEDLES) needles.
+     */
+    template<typename T>
+    static SIMD_TARGET_AVX512 void countAllAVX512(const T *data, size_t size, const T *needles, size_t needleCount,
+                                                  size_t *counts) {
+        constexpr size_t LANES = AVX512_BLOCK_SIZE / sizeof(T);
+        constexpr size_t PREFETCH = LANES * 4;
+
+        __m512i targets[COUNT_ALL_SIMD_NEEDLES];
+        for (size_t j = 0; j < needleCount; ++j) {
+            if constexpr (sizeof(T) == sizeof(int)) {
+                targets[j] = _mm512_set1_epi32(needles[j]);
+            } else {
+                targets[j] = _mm512_set1_epi64(needles[j]);
+            }
+        }
+
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            if (size - i > PREFETCH) {
+                prefetchL1(data + i + PREFETCH);
+            }
+
+            const __m512i vec = _mm512_loadu_si512(data + i);
+            for (size_t j = 0; j < needleCount; ++j) {
+                if constexpr (sizeof(T) == sizeof(int)) {
+                    counts[j] += std::popcount(static_cast<unsigned int>(_mm512_cmpeq_epi32_mask(vec, targets[j])));
+                } else {
+                    counts[j] += std::popcount(static_cast<unsigned int>(_mm512_cmpeq_epi64_mask(vec, targets[j])));
+                }
+            }
+        }
+
+        countAllTail(data, size, i, needles, needleCount, counts);
+    }
+
+#endif
+#pragma clang diagnostic pop
+
+    // Chosen by initSearch() at import. Start at the baseline so an early call is still safe.
+    static FindKernel<int> intFindKernel = findBaseline<int>;
+    static FindKernel<long long> longLongFindKernel = findBaseline<long long>;
+    static CountKernel<int> intCountKernel = countBaseline<int>;
+    static CountKernel<long long> longLongCountKernel = countBaseline<long long>;
+    static CountAllKernel<int> intCountAllKernel = countAllBaseline<int>;
+    static CountAllKernel<long long> longLongCountAllKernel = countAllBaseline<long long>;
+    static FindKernel<signed char> byteFindKernel = findBaseline<signed char>;
+    static FindKernel<short> shortFindKernel = findBaseline<short>;
+    static CountKernel<signed char> byteCountKernel = countBaseline<signed char>;
+    static CountKernel<short> shortCountKernel = countBaseline<short>;
+
+    void initSearch() {
+#if !defined(__arm__) && !defined(__arm64__)
+        if (IS_AVX512_SUPPORTED) {
+            intFindKernel = findAVX512;
+            longLongFindKernel = findAVX512;
+            intCountKernel = countAVX512;
+            longLongCountKernel = countAVX512;
+            intCountAllKernel = countAllAVX512<int>;
+            longLongCountAllKernel = countAllAVX512<long long>;
+            byteFindKernel = findNarrowAVX512<signed char>;
+            shortFindKernel = findNarrowAVX512<short>;
+            byteCountKernel = countNarrowAVX512<signed char>;
+            shortCountKernel = countNarrowAVX512<short>;
+        } else if (IS_AVX2_SUPPORTED) {
+            intFindKernel = findAVX2;
+            longLongFindKernel = findAVX2;
+            intCountKernel = countAVX2;
+            longLongCountKernel = countAVX2;
+            intCountAllKernel = countAllAVX2<int>;
+            longLongCountAllKernel = countAllAVX2<long long>;
+            byteFindKernel = findNarrowAVX2<signed char>;
+            shortFindKernel = findNarrowAVX2<short>;
+            byteCountKernel = countNarrowAVX2<signed char>;
+            shortCountKernel = countNarrowAVX2<short>;
+        }
+#endif
+    }
+
+    size_t simdFind(const int *data, size_t size, int value) {
+        return intFindKernel(data, size, value);
+    }
+
+    size_t simdFind(const long long *data, size_t size, long long value) {
+        return longLongFindKernel(data, size, value);
+    }
+
+    size_t simdCount(const int *data, size_t size, int value) {
+        return intCountKernel(data, size, value);
+    }
+
+    size_t simdCount(const long long *data, size_t size, long long value) {
+        return longLongCountKernel(data, size, value);
+    }
+
+    size_t simdFind(const signed char *data, size_t size, signed char value) {
+        return byteFindKernel(data, size, value);
+    }
+
+    size_t simdFind(const short *data, size_t size, short value) {
+        return shortFindKernel(data, size, value);
+    }
+
+    size_t simdFind(const unsigned int *data, size_t size, unsigned int value) {
+        return intFindKernel(reinterpret_cast<const int *>(data), size, static_cast<int>(value));
+    }
+
+    size_t simdFind(const unsigned long long *data, size_t size, unsigned long long value) {
+        return longLongFindKernel(reinterpret_cast<const long long *>(data), size, static_cast<long long>(value));
+    }
+
+    size_t simdCount(const signed char *data, size_t size, signed char value) {
+        return byteCountKernel(data, size, value);
+    }
+
+    size_t simdCount(const short *data, size_t size, short value) {
+        return shortCountKernel(data, size, value);
+    }
+
+    size_t simdCount(const unsigned int *data, size_t size, unsigned int value) {
+        return intCountKernel(reinterpret_cast<const int *>(data), size, static_cast<int>(value));
+    }
+
+    size_t simdCount(const unsigned long long *data, size_t size, unsigned long long value) {
+        return longLongCountKernel(reinterpret_cast<const long long *>(data), size, static_cast<long long>(value));
+    }
+
+    /**
+     * One hash lookup per element, for when there are too many needles to compare against all of them.
+     * Repeated needles share the slot of their first occurrence.
+     */
+    template<typename T>
+    static void countAllHashed(const T *data, size_t size, const T *needles, size_t needleCount, size_t *counts) {
+        ankerl::unordered_dense::map<T, size_t> slots;
+        slots.reserve(needleCount);
+        for (size_t j = 0; j < needleCount; ++j) {
+            slots.try_emplace(needles[j], j);
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            const auto it = slots.find(data[i]);
+            if (it != slots.end()) {
+                ++counts[it->second];
+            }
+        }
+
+        for (size_t j = 0; j < needleCount; ++j) {
+            counts[j] = counts[slots[needles[j]]];
+        }
+    }
+
+    template<typename T>
+    static __forceinline void doCountAll(const T *data, size_t size, const T *needles, size_t needleCount,
+                                         size_t *counts, CountAllKernel<T> kernel) {
+        std::fill(counts, counts + needleCount, 0);
+
+        if (needleCount <= COUNT_ALL_SIMD_NEEDLES) {
+            kernel(data, size, needles, needleCount, counts);
+        } else {
+            countAllHashed(data, size, needles, needleCount, counts);
+        }
+    }
+
+    void simdCountAll(const int *data, size_t size, const int *needles, size_t needleCount, size_t *counts) {
+        doCountAll(data, size, needles, needleCount, counts, intCountAllKernel);
+    }
+
+    void simdCountAll(const long long *data, size_t size, const long long *needles, size_t needleCount,
+                      size_t *counts) {
+        doCountAll(data, size, needles, needleCount, counts, longLongCountAllKernel);
+    }
+}
@@ -0,0 +1,70 @@
+//
+// Created by xia__mc on 2024/12/14.
+//
+
+#ifndef PYFASTUTIL_SEARCH_H
+#define PYFASTUTIL_SEARCH_H
+
+#include <cstddef>
+#include "Compat.h"
+
+namespace simd {
+
+    void initSearch();
+
+    /**
+     * Index of the first element equal to value, or size if there's none.
+     */
+    size_t simdFind(const int *data, size_t size, int value);
+
+    /**
+     * Index of the first element equal to value, or size if there's none.
+     */
+    size_t simdFind(const long long *data, size_t size, long long value);
+
+    /**
+     * Number of elements equal to value.
+     */
+    size_t simdCount(const int *data, size_t size, int value);
+
+    /**
+     * Number of elements equal to value.
+     */
+    size_t simdCount(const long long *data, size_t size, long long value);
+
+    /*
+     * Narrow and unsigned elements. Unsigned ones compare equal exactly when their bits do,
+     * so they share the signed kernels.
+     */
+
+    size_t simdFind(const signed char *data, size_t size, signed char value);
+
+    size_t simdFind(const short *data, size_t size, short value);
+
+    size_t simdFind(const unsigned int *data, size_t size, unsigned int value);
+
+    size_t simdFind(const unsigned long long *data, size_t size, unsigned long long value);
+
+    size_t simdCount(const signed char *data, size_t size, signed char value);
+
+    size_t simdCount(const short *data, size_t size, short value);
+
+    size_t simdCount(const unsigned int *data, size_t size, unsigned int value);
+
+    size_t simdCount(const unsigned long long *data, size_t size, unsigned long long value);
+
+    /**
+     * Count every needle in a single pass over data, counts[i] is set to the count of needles[i].
+     * Throws std::bad_alloc if many needles need a lookup table and it can't be allocated.
+     */
+    void simdCountAll(const int *data, size_t size, const int *needles, size_t needleCount, size_t *counts);
+
+    /**
+     * Count every needle in a single pass over data, counts[i] is set to the count of needles[i].
+     * Throws std::bad_alloc if many needles need a lookup table and it can't be allocated.
+     */
+    void simdCountAll(const long long *data, size_t size, const long long *needles, size_t needleCount,
+                      size_t *counts);
+}
+
+#endif //PYFASTUTIL_SEARCH_H
@@ -0,0 +1,381 @@
+//
+// Created by xia__mc on 2024/12/16.
+//
+
+#include "Select.h"
+
+#include <bit>
+#include <array>
+#include <memory>
+#include <algorithm>
+
+#if !defined(__arm__) && !defined(__arm64__)
+
+#include <immintrin.h>
+
+#endif
+
+#include "SIMDHelper.h"
+#include "RadixSort.h"
+#include "utils/memory/AlignedAllocator.h"
+
+namespace simd {
+
+    /**
+     * Partition data in place, elements less than pivot (or equal too for the OrEqual kernels) to the front
+     * and the rest to the back.
+     * @return how many elements went to the front
+     */
+    template<typename T>
+    using PartitionKernel = size_t (*)(T *data, size_t size, T pivot);
+
+    /**
+     * Ranges this small are finished with std::nth_element, the vector loop has too little to work on.
+     */
+    static constexpr size_t SELECT_SMALL_SIZE = 256;
+
+    template<bool OrEqual, typename T>
+    static __forceinline bool toFront(T value, T pivot) {
+        return OrEqual ? value <= pivot : value < pivot;
+    }
+
+    template<bool OrEqual, typename T>
+    static size_t partitionBaseline(T *data, size_t size, T pivot) {
+        // branchless Lomuto, a back element is swapped with itself or with another back element
+        size_t left = 0;
+        for (size_t i = 0; i < size; ++i) {
+            const T value = data[i];
+            data[i] = data[left];
+            data[left] = value;
+            left += toFront<OrEqual>(value, pivot);
+        }
+        return left;
+    }
+
+    /**
+     * Partition what the vector loop left over into the gap between its two ends, which is exactly as large.
+     */
+    template<bool OrEqual, typename T>
+    static __forceinline size_t partitionRest(T *data, const T *rest, size_t restSize,
+                                              size_t writeLeft, size_t writeRight, T pivot) {
+        for (size_t i = 0; i < restSize; ++i) {
+            if (toFront<OrEqual>(rest[i], pivot)) {
+                data[writeLeft++] = rest[i];
+            } else {
+                data[--writeRight] = rest[i];
+            }
+        }
+        return writeLeft;
+    }
+
+    /*
+     * The vector kernels set the first and the last vector aside, so both ends start with a whole vector of room.
+     * Each step reads the next vector from the end with less room and writes its two parts as whole vectors,
+     * the unused lanes land in room that is still free. The room on both ends always adds up to two vectors,
+     * so the end that wasn't read from still has one, and the end that was read from just gained one.
+     */
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "portability-simd-intrinsics"
+#if !defined(__arm__) && !defined(__arm64__)
+
+    /**
+     * _mm256_permutevar8x32_epi32 indices that move the lanes picked by a mask to the front or the back of a vector.
+     * Long long lanes are moved as pairs of ints.
+     */
+    template<size_t Lanes>
+    struct CompressTable {
+        alignas(32) std::array<std::array<int, 8>, 1 << Lanes> front{};
+        alignas(32) std::array<std::array<int, 8>, 1 << Lanes> back{};
+
+        constexpr CompressTable() {
+            constexpr size_t intsPerLane = 8 / Lanes;
+            for (size_t mask = 0; mask < (1 << Lanes); ++mask) {
+                const size_t picked = std::popcount(mask);
+                size_t toFront = 0;
+                size_t toBack = Lanes - picked;
+                for (size_t lane = 0; lane < Lanes; ++lane) {
+                    if ((mask >> lane & 1) == 0) {
+                        continue;
+                    }
+                    for (size_t j = 0; j < intsPerLane; ++j) {
+                        front[mask][toFront * intsPerLane + j] = static_cast<int>(lane * intsPerLane + j);
+                        back[mask][toBack * intsPerLane + j] = static_cast<int>(lane * intsPerLane + j);
+                    }
+                    ++toFront;
+                    ++toBack;
+                }
+            }
+        }
+    };
+
+    template<typename T>
+    static constexpr CompressTable<AVX2_BLOCK_SIZE / sizeof(T)> COMPRESS_TABLE{};
+
+    template<bool OrEqual, typename T>
+    static SIMD_TARGET_AVX2 size_t partitionAVX2(T *data, size_t size, T pivot) {
+        constexpr size_t LANES = AVX2_BLOCK_SIZE / sizeof(T);
+        constexpr unsigned int ALL_LANES = (1u << LANES) - 1;
+        const auto &table = COMPRESS_TABLE<T>;
+
+        if (size < 2 * LANES) {
+            return partitionBaseline<OrEqual>(data, size, pivot);
+        }
+
+        const __m256i target = sizeof(T) == sizeof(int) ? _mm256_set1_epi32(static_cast<int>(pivot))
+                                                        : _mm256_set1_epi64x(static_cast<long long>(pivot));
+
+        T rest[3 * LANES];
+        std::copy(data, data + LANES, rest);
+        std::copy(data + size - LANES, data + size, rest + LANES);
+
+        size_t readLeft = LANES;
+        size_t readRight = size - LANES;
+        size_t writeLeft = 0;
+        size_t writeRight = size;
+        while (readRight - readLeft >= LANES) {
+            const T *src;
+            if (readLeft - writeLeft <= writeRight - readRight) {
+                src = data + readLeft;
+                readLeft += LANES;
+            } else {
+                readRight -= LANES;
+                src = data + readRight;
+            }
+
+            const __m256i vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+            __m256i greater;
+            if constexpr (sizeof(T) == sizeof(int)) {
+                greater = OrEqual ? _mm256_cmpgt_epi32(vec, target)
+                                  : _mm256_cmpeq_epi32(_mm256_cmpgt_epi32(target, vec), _mm256_setzero_si256());
+            } else {
+                greater = OrEqual ? _mm256_cmpgt_epi64(vec, target)
+                                  : _mm256_cmpeq_epi64(_mm256_cmpgt_epi64(target, vec), _mm256_setzero_si256());
+            }
+            const auto backMask = static_cast<unsigned int>(sizeof(T) == sizeof(int)
+                                                            ? _mm256_movemask_ps(_mm256_castsi256_ps(greater))
+                                                            : _mm256_movemask_pd(_mm256_castsi256_pd(greater)));
+            const auto backCount = static_cast<size_t>(std::popcount(backMask));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + writeLeft), _mm256_permutevar8x32_epi32(
+                    vec, _mm256_load_si256(reinterpret_cast<const __m256i *>(table.front[~backMask & ALL_LANES].data()))));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + writeRight - LANES), _mm256_permutevar8x32_epi32(
+                    vec, _mm256_load_si256(reinterpret_cast<const __m256i *>(table.back[backMask].data()))));
+            writeLeft += LANES - backCount;
+            writeRight -= backCount;
+        }
+
+        const size_t middle = readRight - readLeft;
+        std::copy(data + readLeft, data + readRight, rest + 2 * LANES);
+        return partitionRest<OrEqual>(data, rest, 2 * LANES + middle, writeLeft, writeRight, pivot);
+    }
+
+    template<bool OrEqual, typename T>
+    static SIMD_TARGET_AVX512 size_t partitionAVX512(T *data, size_t size, T pivot) {
+        constexpr size_t LANES = AVX512_BLOCK_SIZE / sizeof(T);
+        constexpr unsigned int ALL_LANES = (1u << LANES) - 1;
+
+        if (size < 2 * LANES) {
+            return partitionBaseline<OrEqual>(data, size, pivot);
+        }
+
+        const __m512i target = sizeof(T) == sizeof(int) ? _mm512_set1_epi32(static_cast<int>(pivot))
+                                                        : _mm512_set1_epi64(static_cast<long long>(pivot));
+
+        T rest[3 * LANES];
+        std::copy(data, data + LANES, rest);
+        std::copy(data + size - LANES, data + size, rest + LANES);
+
+        size_t readLeft = LANES;
+        size_t readRight = size - LANES;
+        size_t writeLeft = 0;
+        size_t writeRight = size;
+        while (readRight - readLeft >= LANES) {
+            const T *src;
+            if (readLeft - writeLeft <= writeRight - readRight) {
+                src = data + readLeft;
+                readLeft += LANES;
+            } else {
+                readRight -= LANES;
+                src = data + readRight;
+            }
+
+            // compress in registers and store whole vectors, compress stores to memory are slow on some CPUs
+            const __m512i vec = _mm512_loadu_si512(src);
+            if constexpr (sizeof(T) == sizeof(int)) {
+                const __mmask16 front = OrEqual ? _mm512_cmple_epi32_mask(vec, target)
+                                                : _mm512_cmplt_epi32_mask(vec, target);
+                const auto backCount = LANES - std::popcount(static_cast<unsigned int>(front));
+                const auto backLanes = static_cast<__mmask16>(ALL_LANES << (LANES - backCount));
+
+                _mm512_storeu_si512(data + writeLeft, _mm512_maskz_compress_epi32(front, vec));
+                _mm512_storeu_si512(data + writeRight - LANES, _mm512_maskz_expand_epi32(
+                        backLanes, _mm512_maskz_compress_epi32(static_cast<__mmask16>(~front), vec)));
+                writeLeft += LANES - backCount;
+                writeRight -= backCount;
+            } else {
+                const __mmask8 front = OrEqual ? _mm512_cmple_epi64_mask(vec, target)
+                                               : _mm512_cmplt_epi64_mask(vec, target);
+                const auto backCount = LANES - std::popcount(static_cast<unsigned int>(front));
+                const auto backLanes = static_cast<__mmask8>(ALL_LANES << (LANES - backCount));
+
+                _mm512_storeu_si512(data + writeLeft, _mm512_maskz_compress_epi64(front, vec));
+                _mm512_storeu_si512(data + writeRight - LANES, _mm512_maskz_expand_epi64(
+                        backLanes, _mm512_maskz_compress_epi64(static_cast<__mmask8>(~front), vec)));
+                writeLeft += LANES - backCount;
+                writeRight -= backCount;
+            }
+        }
+
+        const size_t middle = readRight - readLeft;
+        std::copy(data + readLeft, data + readRight, rest + 2 * LANES);
+        return partitionRest<OrEqual>(data, rest, 2 * LANES + middle, writeLeft, writeRight, pivot);
+    }
+
+#endif
+#pragma clang diagnostic pop
+
+    // Chosen by initSelect() at import. Start at the baseline so an early call is still safe.
+    static PartitionKernel<int> intLessKernel = partitionBaseline<false, int>;
+    static PartitionKernel<int> intLessEqualKernel = partitionBaseline<true, int>;
+    static PartitionKernel<long long> longLongLessKernel = partitionBaseline<false, long long>;
+    static PartitionKernel<long long> longLongLessEqualKernel = partitionBaseline<true, long long>;
+
+    void initSelect() {
+#if !defined(__arm__) && !defined(__arm64__)
+        if (IS_AVX512_SUPPORTED) {
+            intLessKernel = partitionAVX512<false, int>;
+            intLessEqualKernel = partitionAVX512<true, int>;
+            longLongLessKernel = partitionAVX512<false, long long>;
+            longLongLessEqualKernel = partitionAVX512<true, long long>;
+        } else if (IS_AVX2_SUPPORTED) {
+            intLessKernel = partitionAVX2<false, int>;
+            intLessEqualKernel = partitionAVX2<true, int>;
+            longLongLessKernel = partitionAVX2<false, long long>;
+            longLongLessEqualKernel = partitionAVX2<true, long long>;
+        }
+#endif
+    }
+
+    template<typename T>
+    static __forceinline T medianOfThree(T a, T b, T c) {
+        return std::max(std::min(a, b), std::min(std::max(a, b), c));
+    }
+
+    /**
+     * Quickselect, small ranges and ranges where bad pivots stop it from converging
+     * are finished with std::nth_element.
+     */
+    template<typename T>
+    static void select(T *data, size_t size, size_t k,
+                       PartitionKernel<T> lessKernel, PartitionKernel<T> lessEqualKernel) {
+        size_t lo = 0;
+        size_t hi = size;
+        size_t rounds = 2 * std::bit_width(size);
+
+        while (hi - lo > SELECT_SMALL_SIZE && rounds-- > 0) {
+            const size_t rangeSize = hi - lo;
+            const T pivot = medianOfThree(data[lo], data[lo + rangeSize / 2], data[hi - 1]);
+
+            size_t mid = lo + lessKernel(data + lo, rangeSize, pivot);
+            if (k < mid) {
+                hi = mid;
+                continue;
+            }
+
+            if (mid == lo) {
+                // pivot is the smallest element, split off every copy of it so the range still shrinks
+                mid = lo + lessEqualKernel(data + lo, rangeSize, pivot);
+                if (k < mid) {
+                    return;
+                }
+            }
+            lo = mid;
+        }
+
+        std::nth_element(data + lo, data + k, data + hi);
+    }
+
+    template<typename T>
+    static __forceinline void sortRange(T *begin, size_t size) {
+        if (size >= RADIX_SORT_THRESHOLD<T>) {
+            radixsort(begin, size);
+        } else {
+            std::sort(begin, begin + size);
+        }
+    }
+
+    template<typename T>
+    static void partialSort(T *data, size_t size, size_t k, bool reverse,
+                            PartitionKernel<T> lessKernel, PartitionKernel<T> lessEqualKernel) {
+        if (k == 0) {
+            return;
+        }
+
+        if (reverse && k < size) {
+            // the largest k end up behind size - k, bring them to the front
+            select(data, size, size - k, lessKernel, lessEqualKernel);
+            if (k <= size - k) {
+                std::swap_ranges(data, data + k, data + size - k);
+            } else {
+                std::rotate(data, data + size - k, data + size);
+            }
+        } else if (k < size) {
+            select(data, size, k, lessKernel, lessEqualKernel);
+        }
+
+        sortRange(data, k);
+        if (reverse) {
+            std::reverse(data, data + k);
+        }
+    }
+
+    template<typename T>
+    static void topK(const T *data, size_t size, size_t k, bool reverse, T *out,
+                     PartitionKernel<T> lessKernel, PartitionKernel<T> lessEqualKernel) {
+        if (k == 0) {
+            return;
+        }
+
+        AlignedAllocator<T, 64> allocator;
+        const std::unique_ptr<T, void (*)(void *)> copy(allocator.allocate(size), alignedFree);
+        std::copy(data, data + size, copy.get());
+
+        // select on the copy, the k wanted elements end up at begin
+        const size_t begin = reverse ? size - k : 0;
+        if (k < size) {
+            select(copy.get(), size, reverse ? begin : k, lessKernel, lessEqualKernel);
+        }
+
+        sortRange(copy.get() + begin, k);
+        if (reverse) {
+            std::reverse_copy(copy.get() + begin, copy.get() + size, out);
+        } else {
+            std::copy(copy.get(), copy.get() + k, out);
+        }
+    }
+
+    void simdNthElement(int *data, size_t size, size_t k) {
+        select(data, size, k, intLessKernel, intLessEqualKernel);
+    }
+
+    void simdNthElement(long long *data, size_t size, size_t k) {
+        select(data, size, k, longLongLessKernel, longLongLessEqualKernel);
+    }
+
+    void simdPartialSort(int *data, size_t size, size_t k, bool reverse) {
+        partialSort(data, size, k, reverse, intLessKernel, intLessEqualKernel);
+    }
+
+    void simdPartialSort(long long *data, size_t size, size_t k, bool reverse) {
+        partialSort(data, size, k, reverse, longLongLessKernel, longLongLessEqualKernel);
+    }
+
+    void simdTopK(const int *data, size_t size, size_t k, bool reverse, int *out) {
+        topK(data, size, k, reverse, out, intLessKernel, intLessEqualKernel);
+    }
+
+    void simdTopK(const long long *data, size_t size, size_t k, bool reverse, long long *out) {
+        topK(data, size, k, reverse, out, longLongLessKernel, longLongLessEqualKernel);
+    }
+}
@@ -0,0 +1,41 @@
+//
+// Created by xia__mc on 2024/12/16.
+//
+
+#ifndef PYFASTUTIL_SELECT_H
+#define PYFASTUTIL_SELECT_H
+
+#include <cstddef>
+#include "Compat.h"
+
+namespace simd {
+
+    void initSelect();
+
+    /**
+     * Rearrange data like std::nth_element: data[k] becomes the element a full sort would put there,
+     * with nothing greater before it and nothing smaller after it. Quickselect with SIMD partitioning, in place.
+     */
+    void simdNthElement(int *data, size_t size, size_t k);
+
+    void simdNthElement(long long *data, size_t size, size_t k);
+
+    /**
+     * Move the k smallest (or largest if reverse) elements of data to its front, sorted ascending
+     * (or descending if reverse). The order of the rest is unspecified. k must not be greater than size.
+     */
+    void simdPartialSort(int *data, size_t size, size_t k, bool reverse);
+
+    void simdPartialSort(long long *data, size_t size, size_t k, bool reverse);
+
+    /**
+     * Write the k smallest (or largest if reverse) elements of data to out, sorted ascending
+     * (or descending if reverse), without changing data. k must not be greater than size.
+     * Selects on a copy of data, throws std::bad_alloc if it can't be allocated.
+     */
+    void simdTopK(const int *data, size_t size, size_t k, bool reverse, int *out);
+
+    void simdTopK(const long long *data, size_t size, size_t k, bool reverse, long long *out);
+}
+
+#endif //PYFASTUTIL_SELECT_H
@@ -0,0 +1,706 @@
+//
+// Created by xia__mc on 2024/12/20.
+//
+
+#include "SetOps.h"
+
+#include <bit>
+#include <array>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+#if !defined(__arm__) && !defined(__arm64__)
+
+#include <immintrin.h>
+
+#endif
+
+#include "SIMDHelper.h"
+
+namespace simd {
+
+    template<typename T>
+    using IntersectKernel = size_t (*)(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out);
+
+    /*
+     * The scalar merges below pick with compares turned into index increments instead of branches,
+     * random sorted data would mispredict about every other branch.
+     */
+
+    /**
+     * Merge what's left after left[i] and right[j]. out[count] is written even without a match,
+     * which the padding asked for the intersect kernels covers.
+     */
+    template<typename T>
+    static __forceinline size_t intersectTail(const T *left, size_t leftSize, size_t i,
+                                              const T *right, size_t rightSize, size_t j, T *out, size_t count) {
+        while (i < leftSize && j < rightSize) {
+            const T a = left[i];
+            const T b = right[j];
+            out[count] = a;
+            count += a == b;
+            i += a <= b;
+            j += b <= a;
+        }
+        return count;
+    }
+
+    template<typename T>
+    static size_t unionBranchless(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out) {
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+        while (i < leftSize && j < rightSize) {
+            const T a = left[i];
+            const T b = right[j];
+            out[count++] = a <= b ? a : b;
+            i += a <= b;
+            j += b <= a;
+        }
+        std::memcpy(out + count, left + i, (leftSize - i) * sizeof(T));
+        count += leftSize - i;
+        std::memcpy(out + count, right + j, (rightSize - j) * sizeof(T));
+        return count + rightSize - j;
+    }
+
+    template<typename T>
+    static size_t differenceBranchless(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out) {
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+        while (i < leftSize && j < rightSize) {
+            // count never passes i, so this write stays in out
+            const T a = left[i];
+            const T b = right[j];
+            out[count] = a;
+            count += a < b;
+            i += a <= b;
+            j += b <= a;
+        }
+        std::memcpy(out + count, left + i, (leftSize - i) * sizeof(T));
+        return count + leftSize - i;
+    }
+
+    template<typename T>
+    static void mergeBranchless(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out) {
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+        while (i < leftSize && j < rightSize) {
+            const T a = left[i];
+            const T b = right[j];
+            const bool takeLeft = a <= b;
+            out[count++] = takeLeft ? a : b;
+            i += takeLeft;
+            j += !takeLeft;
+        }
+        std::memcpy(out + count, left + i, (leftSize - i) * sizeof(T));
+        count += leftSize - i;
+        std::memcpy(out + count, right + j, (rightSize - j) * sizeof(T));
+    }
+
+    template<typename T>
+    static size_t intersectBaseline(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out) {
+        return intersectTail(left, leftSize, 0, right, rightSize, 0, out, 0);
+    }
+
+    template<typename T>
+    using StrictKernel = bool (*)(const T *data, size_t size);
+
+    template<typename T>
+    using DedupeKernel = size_t (*)(T *data, size_t size);
+
+    // one side this many times larger is galloped over, merging would walk all of it for a few matches
+    static constexpr size_t GALLOP_RATIO = 32;
+
+    template<typename T>
+    static bool isStrictlyIncreasingBaseline(const T *data, size_t size) {
+        for (size_t i = 1; i < size; ++i) {
+            if (data[i] <= data[i - 1]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Continue deduping data from i, with count elements kept so far. Every element is written,
+     * and kept by moving past it only if it differs from the last kept one.
+     */
+    template<typename T>
+    static __forceinline size_t dedupeTail(T *data, size_t size, size_t i, size_t count) {
+        for (; i < size; i++) {
+            const T value = data[i];
+            const bool differs = value != data[count - 1];
+            data[count] = value;
+            count += differs;
+        }
+        return count;
+    }
+
+    template<typename T>
+    static size_t dedupeBaseline(T *data, size_t size) {
+        return size == 0 ? 0 : dedupeTail(data, size, 1, 1);
+    }
+
+    /**
+     * The first index from from on whose value isn't less than value.
+     * The distance doubles each step, so values close to from are found in a few compares.
+     */
+    template<typename T>
+    static __forceinline size_t gallop(const T *data, size_t size, size_t from, T value) {
+        if (from >= size || data[from] >= value) {
+            return from;
+        }
+
+        // data[low] < value all along
+        size_t low = from;
+        size_t step = 1;
+        while (low + step < size && data[low + step] < value) {
+            low += step;
+            step *= 2;
+        }
+        const size_t high = std::min(low + step, size);
+        return static_cast<size_t>(std::lower_bound(data + low + 1, data + high, value) - data);
+    }
+
+    template<typename T>
+    static size_t intersectGallop(const T *small, size_t smallSize, const T *large, size_t largeSize, T *out) {
+        size_t j = 0;
+        size_t count = 0;
+        for (size_t i = 0; i < smallSize; ++i) {
+            j = gallop(large, largeSize, j, small[i]);
+            if (j == largeSize) {
+                break;
+            }
+            if (large[j] == small[i]) {
+                out[count++] = small[i];
+                ++j;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * Copy the values of large between the values of small, taking one equal value of large for each one of small
+     * when Union, or every value of both if not.
+     */
+    template<bool Union, typename T>
+    static size_t mergeGallop(const T *small, size_t smallSize, const T *large, size_t largeSize, T *out) {
+        size_t j = 0;
+        size_t count = 0;
+        for (size_t i = 0; i < smallSize; ++i) {
+            const size_t position = gallop(large, largeSize, j, small[i]);
+            std::memcpy(out + count, large + j, (position - j) * sizeof(T));
+            count += position - j;
+            j = position;
+            if (Union && j < largeSize && large[j] == small[i]) {
+                ++j;
+            }
+            out[count++] = small[i];
+        }
+        std::memcpy(out + count, large + j, (largeSize - j) * sizeof(T));
+        return count + largeSize - j;
+    }
+
+    /**
+     * left minus right, when right is much larger.
+     */
+    template<typename T>
+    static size_t differenceGallopRight(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out) {
+        size_t j = 0;
+        size_t count = 0;
+        for (size_t i = 0; i < leftSize; ++i) {
+            j = gallop(right, rightSize, j, left[i]);
+            if (j < rightSize && right[j] == left[i]) {
+                ++j;
+            } else {
+                out[count++] = left[i];
+            }
+        }
+        return count;
+    }
+
+    /**
+     * left minus right, when left is much larger. The values of left between two of right are copied at once.
+     */
+    template<typename T>
+    static size_t differenceGallopLeft(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out) {
+        size_t i = 0;
+        size_t count = 0;
+        for (size_t j = 0; j < rightSize; ++j) {
+            size_t position = gallop(left, leftSize, i, right[j]);
+            std::memcpy(out + count, left + i, (position - i) * sizeof(T));
+            count += position - i;
+            if (position < leftSize && left[position] == right[j]) {
+                ++position;
+            }
+            i = position;
+        }
+        std::memcpy(out + count, left + i, (leftSize - i) * sizeof(T));
+        return count + leftSize - i;
+    }
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "portability-simd-intrinsics"
+#if !defined(__arm__) && !defined(__arm64__)
+
+    /**
+     * _mm_shuffle_epi8 indices that move the 16-bit lanes picked by a byte mask to the front.
+     */
+    struct ShortCompressTable {
+        alignas(16) std::array<std::array<char, 16>, 256> front{};
+
+        constexpr ShortCompressTable() {
+            for (size_t mask = 0; mask < 256; ++mask) {
+                size_t picked = 0;
+                for (size_t lane = 0; lane < 8; ++lane) {
+                    if ((mask >> lane & 1) != 0) {
+                        front[mask][2 * picked] = static_cast<char>(2 * lane);
+                        front[mask][2 * picked + 1] = static_cast<char>(2 * lane + 1);
+                        ++picked;
+                    }
+                }
+                for (size_t byte = 2 * picked; byte < 16; ++byte) {
+                    front[mask][byte] = static_cast<char>(0x80);
+                }
+            }
+        }
+    };
+
+    static constexpr ShortCompressTable SHORT_COMPRESS_TABLE{};
+
+    /*
+     * Compare a block of 8 values from each side all against all, by rotating the right block through
+     * every lane. Then the block with the smaller maximum moves on: nothing after the other block can match it.
+     * A value can't match twice, since the next right block only has greater values.
+     */
+    static SIMD_TARGET_AVX2 size_t intersectAVX2(const unsigned short *left, size_t leftSize,
+                                                 const unsigned short *right, size_t rightSize,
+                                                 unsigned short *out) {
+        constexpr size_t LANES = SSE41_BLOCK_SIZE / sizeof(unsigned short);
+
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+        while (i + LANES <= leftSize && j + LANES <= rightSize) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right + j));
+
+            __m128i equal = _mm_cmpeq_epi16(a, b);
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi16(a, _mm_alignr_epi8(b, b, 2)));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi16(a, _mm_alignr_epi8(b, b, 4)));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi16(a, _mm_alignr_epi8(b, b, 6)));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi16(a, _mm_alignr_epi8(b, b, 8)));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi16(a, _mm_alignr_epi8(b, b, 10)));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi16(a, _mm_alignr_epi8(b, b, 12)));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi16(a, _mm_alignr_epi8(b, b, 14)));
+
+            const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_packs_epi16(equal, _mm_setzero_si128())));
+            const __m128i indices = _mm_load_si128(
+                    reinterpret_cast<const __m128i *>(SHORT_COMPRESS_TABLE.front[mask].data()));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + count), _mm_shuffle_epi8(a, indices));
+            count += std::popcount(mask);
+
+            const unsigned short leftMax = left[i + LANES - 1];
+            const unsigned short rightMax = right[j + LANES - 1];
+            if (leftMax <= rightMax) {
+                i += LANES;
+            }
+            if (rightMax <= leftMax) {
+                j += LANES;
+            }
+        }
+
+        return intersectTail(left, leftSize, i, right, rightSize, j, out, count);
+    }
+
+    /**
+     * _mm256_permutevar8x32_epi32 indices that move the lanes picked by a mask to the front.
+     * Long long lanes are moved as pairs of ints.
+     */
+    template<size_t Lanes>
+    struct LaneCompressTable {
+        alignas(32) std::array<std::array<int, 8>, 1 << Lanes> front{};
+
+        constexpr LaneCompressTable() {
+            constexpr size_t intsPerLane = 8 / Lanes;
+            for (size_t mask = 0; mask < (1 << Lanes); ++mask) {
+                size_t picked = 0;
+                for (size_t lane = 0; lane < Lanes; ++lane) {
+                    if ((mask >> lane & 1) == 0) {
+                        continue;
+                    }
+                    for (size_t j = 0; j < intsPerLane; ++j) {
+                        front[mask][picked * intsPerLane + j] = static_cast<int>(lane * intsPerLane + j);
+                    }
+                    ++picked;
+                }
+            }
+        }
+    };
+
+    template<typename T>
+    static constexpr LaneCompressTable<AVX2_BLOCK_SIZE / sizeof(T)> LANE_COMPRESS_TABLE{};
+
+    template<typename T>
+    static SIMD_TARGET_AVX2 bool isStrictlyIncreasingAVX2(const T *data, size_t size) {
+        constexpr size_t LANES = AVX2_BLOCK_SIZE / sizeof(T);
+
+        size_t i = 0;
+        for (; i + LANES < size; i += LANES) {
+            const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            const __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i + 1));
+            const __m256i greater = sizeof(T) == sizeof(int) ? _mm256_cmpgt_epi32(next, current)
+                                                             : _mm256_cmpgt_epi64(next, current);
+            if (_mm256_movemask_epi8(greater) != -1) {
+                return false;
+            }
+        }
+        return isStrictlyIncreasingBaseline(data + i, size - i);
+    }
+
+    /*
+     * Each vector is compared with itself shifted up a lane, the last element of the vector before
+     * filling the gap, and the lanes that differ are compressed to the front. The store reaches at most
+     * to the end of the vector just loaded, so the elements not read yet are intact.
+     */
+    static SIMD_TARGET_AVX2 size_t dedupeAVX2(int *data, size_t size) {
+        if (size == 0) {
+            return 0;
+        }
+
+        const auto &table = LANE_COMPRESS_TABLE<int>;
+        const __m256i shiftUp = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+
+        size_t count = 1;
+        int last = data[0];
+        size_t i = 1;
+        for (; i + 8 <= size; i += 8) {
+            const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            const __m256i previous = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(current, shiftUp),
+                                                        _mm256_set1_epi32(last), 0x01);
+            const auto differs = static_cast<unsigned int>(
+                    ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(current, previous))) & 0xFF);
+            last = data[i + 7];
+
+            const __m256i front = _mm256_load_si256(reinterpret_cast<const __m256i *>(table.front[differs].data()));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + count),
+                                _mm256_permutevar8x32_epi32(current, front));
+            count += std::popcount(differs);
+        }
+        return dedupeTail(data, size, i, count);
+    }
+
+    /*
+     * Same block scheme as the unsigned short kernel above, with the right block rotated a lane at a time
+     * across the whole 256 bits.
+     */
+    template<typename T>
+    static SIMD_TARGET_AVX2 size_t intersectBlocksAVX2(const T *left, size_t leftSize, const T *right, size_t rightSize,
+                                                       T *out) {
+        constexpr size_t LANES = AVX2_BLOCK_SIZE / sizeof(T);
+        const auto &table = LANE_COMPRESS_TABLE<T>;
+        const __m256i rotate = sizeof(T) == sizeof(int) ? _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0)
+                                                        : _mm256_setr_epi32(2, 3, 4, 5, 6, 7, 0, 1);
+
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+        while (i + LANES <= leftSize && j + LANES <= rightSize) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(left + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + j));
+
+            __m256i equal;
+            unsigned int mask;
+            if constexpr (sizeof(T) == sizeof(int)) {
+                equal = _mm256_cmpeq_epi32(a, b);
+                for (size_t r = 1; r < LANES; ++r) {
+                    b = _mm256_permutevar8x32_epi32(b, rotate);
+                    equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(a, b));
+                }
+                mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+            } else {
+                equal = _mm256_cmpeq_epi64(a, b);
+                for (size_t r = 1; r < LANES; ++r) {
+                    b = _mm256_permutevar8x32_epi32(b, rotate);
+                    equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(a, b));
+                }
+                mask = static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(equal)));
+            }
+
+            const __m256i indices = _mm256_load_si256(reinterpret_cast<const __m256i *>(table.front[mask].data()));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + count), _mm256_permutevar8x32_epi32(a, indices));
+            count += std::popcount(mask);
+
+            const T leftMax = left[i + LANES - 1];
+            const T rightMax = right[j + LANES - 1];
+            if (leftMax <= rightMax) {
+                i += LANES;
+            }
+            if (rightMax <= leftMax) {
+                j += LANES;
+            }
+        }
+
+        return intersectTail(left, leftSize, i, right, rightSize, j, out, count);
+    }
+
+    SIMD_AVX512_BEGIN
+
+    template<typename T>
+    static size_t intersectBlocksAVX512(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out) {
+        constexpr size_t LANES = AVX512_BLOCK_SIZE / sizeof(T);
+
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+        while (i + LANES <= leftSize && j + LANES <= rightSize) {
+            const __m512i a = _mm512_loadu_si512(left + i);
+            __m512i b = _mm512_loadu_si512(right + j);
+
+            unsigned int mask;
+            if constexpr (sizeof(T) == sizeof(int)) {
+                __mmask16 equal = _mm512_cmpeq_epi32_mask(a, b);
+                for (size_t r = 1; r < LANES; ++r) {
+                    b = _mm512_alignr_epi32(b, b, 1);
+                    equal |= _mm512_cmpeq_epi32_mask(a, b);
+                }
+                _mm512_storeu_si512(out + count, _mm512_maskz_compress_epi32(equal, a));
+                mask = equal;
+            } else {
+                __mmask8 equal = _mm512_cmpeq_epi64_mask(a, b);
+                for (size_t r = 1; r < LANES; ++r) {
+                    b = _mm512_alignr_epi64(b, b, 1);
+                    equal |= _mm512_cmpeq_epi64_mask(a, b);
+                }
+                _mm512_storeu_si512(out + count, _mm512_maskz_compress_epi64(equal, a));
+                mask = equal;
+            }
+            count += std::popcount(mask);
+
+            const T leftMax = left[i + LANES - 1];
+            const T rightMax = right[j + LANES - 1];
+            if (leftMax <= rightMax) {
+                i += LANES;
+            }
+            if (rightMax <= leftMax) {
+                j += LANES;
+            }
+        }
+
+        return intersectTail(left, leftSize, i, right, rightSize, j, out, count);
+    }
+
+    /**
+     * dedupeAVX2 a whole 512 bits at a time, the shifted vector comes from alignr with the previous one.
+     */
+    static size_t dedupeAVX512(int *data, size_t size) {
+        if (size == 0) {
+            return 0;
+        }
+
+        size_t count = 1;
+        __m512i before = _mm512_set1_epi32(data[0]);
+        size_t i = 1;
+        for (; i + 16 <= size; i += 16) {
+            const __m512i current = _mm512_loadu_si512(data + i);
+            const __m512i previous = _mm512_alignr_epi32(current, before, 15);
+            const __mmask16 differs = _mm512_cmpneq_epi32_mask(current, previous);
+            _mm512_storeu_si512(data + count, _mm512_maskz_compress_epi32(differs, current));
+            count += std::popcount(static_cast<unsigned int>(differs));
+            before = current;
+        }
+        return dedupeTail(data, size, i, count);
+    }
+
+    SIMD_AVX512_END
+
+#endif
+#pragma clang diagnostic pop
+
+    // Chosen by initSetOps() at import. Start at the baseline so an early call is still safe.
+    static IntersectKernel<unsigned short> shortIntersectKernel = intersectBaseline<unsigned short>;
+    static IntersectKernel<int> intIntersectKernel = intersectBaseline<int>;
+    static IntersectKernel<long long> longIntersectKernel = intersectBaseline<long long>;
+    static StrictKernel<int> intStrictKernel = isStrictlyIncreasingBaseline<int>;
+    static StrictKernel<long long> longStrictKernel = isStrictlyIncreasingBaseline<long long>;
+    static DedupeKernel<int> intDedupeKernel = dedupeBaseline<int>;
+
+    void initSetOps() {
+#if !defined(__arm__) && !defined(__arm64__)
+        if (IS_AVX512_SUPPORTED) {
+            intIntersectKernel = intersectBlocksAVX512<int>;
+            longIntersectKernel = intersectBlocksAVX512<long long>;
+            intDedupeKernel = dedupeAVX512;
+        } else if (IS_AVX2_SUPPORTED) {
+            intIntersectKernel = intersectBlocksAVX2<int>;
+            longIntersectKernel = intersectBlocksAVX2<long long>;
+            intDedupeKernel = dedupeAVX2;
+        }
+        // 8 lanes are all the unsigned short compare can use, and the order check is bound by memory
+        if (IS_AVX2_SUPPORTED) {
+            shortIntersectKernel = intersectAVX2;
+            intStrictKernel = isStrictlyIncreasingAVX2<int>;
+            longStrictKernel = isStrictlyIncreasingAVX2<long long>;
+        }
+#endif
+    }
+
+    size_t simdIntersect(const unsigned short *left, size_t leftSize,
+                         const unsigned short *right, size_t rightSize, unsigned short *out) {
+        return shortIntersectKernel(left, leftSize, right, rightSize, out);
+    }
+
+    template<typename T>
+    static __forceinline size_t sortedIntersectImpl(const T *left, size_t leftSize, const T *right, size_t rightSize,
+                                                    T *out, IntersectKernel<T> kernel, StrictKernel<T> strict) {
+        // the same values either way round
+        if (leftSize > rightSize) {
+            std::swap(left, right);
+            std::swap(leftSize, rightSize);
+        }
+        if (leftSize == 0) {
+            return 0;
+        }
+
+        if (rightSize / leftSize >= GALLOP_RATIO) {
+            return intersectGallop(left, leftSize, right, rightSize, out);
+        }
+        // a duplicate could match in two blocks, those go through the scalar merge
+        if (strict(left, leftSize) && strict(right, rightSize)) {
+            return kernel(left, leftSize, right, rightSize, out);
+        }
+        return intersectBaseline(left, leftSize, right, rightSize, out);
+    }
+
+    template<typename T>
+    static __forceinline size_t sortedUnionImpl(const T *left, size_t leftSize, const T *right, size_t rightSize,
+                                                T *out) {
+        if (leftSize > rightSize) {
+            std::swap(left, right);
+            std::swap(leftSize, rightSize);
+        }
+
+        if (leftSize == 0 || rightSize / leftSize >= GALLOP_RATIO) {
+            return mergeGallop<true>(left, leftSize, right, rightSize, out);
+        }
+        return unionBranchless(left, leftSize, right, rightSize, out);
+    }
+
+    template<typename T>
+    static __forceinline size_t sortedDifferenceImpl(const T *left, size_t leftSize, const T *right, size_t rightSize,
+                                                     T *out) {
+        if (leftSize == 0) {
+            return 0;
+        }
+        if (rightSize / leftSize >= GALLOP_RATIO) {
+            return differenceGallopRight(left, leftSize, right, rightSize, out);
+        }
+        if (rightSize == 0 || leftSize / rightSize >= GALLOP_RATIO) {
+            return differenceGallopLeft(left, leftSize, right, rightSize, out);
+        }
+        return differenceBranchless(left, leftSize, right, rightSize, out);
+    }
+
+    template<typename T>
+    static __forceinline void sortedMergeImpl(const T *left, size_t leftSize, const T *right, size_t rightSize, T *out) {
+        if (leftSize > rightSize) {
+            std::swap(left, right);
+            std::swap(leftSize, rightSize);
+        }
+
+        if (leftSize == 0 || rightSize / leftSize >= GALLOP_RATIO) {
+            mergeGallop<false>(left, leftSize, right, rightSize, out);
+        } else {
+            mergeBranchless(left, leftSize, right, rightSize, out);
+        }
+    }
+
+    template<typename T>
+    static void sortedMergeRunsImpl(T *data, const std::vector<size_t> &runBounds) {
+        if (runBounds.size() <= 2) {
+            return;
+        }
+
+        const size_t size = runBounds.back();
+        std::vector<T> scratch(size);
+        std::vector<size_t> bounds = runBounds;
+        std::vector<size_t> nextBounds;
+
+        T *from = data;
+        T *to = scratch.data();
+        while (bounds.size() > 2) {
+            nextBounds.clear();
+            nextBounds.push_back(0);
+
+            size_t r = 0;
+            for (; r + 2 < bounds.size(); r += 2) {
+                sortedMergeImpl(from + bounds[r], bounds[r + 1] - bounds[r],
+                                from + bounds[r + 1], bounds[r + 2] - bounds[r + 1], to + bounds[r]);
+                nextBounds.push_back(bounds[r + 2]);
+            }
+            // an odd run out waits for the next pass
+            if (r + 1 < bounds.size()) {
+                std::memcpy(to + bounds[r], from + bounds[r], (bounds[r + 1] - bounds[r]) * sizeof(T));
+                nextBounds.push_back(bounds[r + 1]);
+            }
+
+            std::swap(from, to);
+            bounds.swap(nextBounds);
+        }
+
+        if (from != data) {
+            std::memcpy(data, from, size * sizeof(T));
+        }
+    }
+
+    size_t sortedIntersect(const int *left, size_t leftSize, const int *right, size_t rightSize, int *out) {
+        return sortedIntersectImpl(left, leftSize, right, rightSize, out, intIntersectKernel, intStrictKernel);
+    }
+
+    size_t sortedIntersect(const long long *left, size_t leftSize,
+                           const long long *right, size_t rightSize, long long *out) {
+        return sortedIntersectImpl(left, leftSize, right, rightSize, out, longIntersectKernel, longStrictKernel);
+    }
+
+    size_t sortedUnion(const int *left, size_t leftSize, const int *right, size_t rightSize, int *out) {
+        return sortedUnionImpl(left, leftSize, right, rightSize, out);
+    }
+
+    size_t sortedUnion(const long long *left, size_t leftSize,
+                       const long long *right, size_t rightSize, long long *out) {
+        return sortedUnionImpl(left, leftSize, right, rightSize, out);
+    }
+
+    size_t sortedDifference(const int *left, size_t leftSize, const int *right, size_t rightSize, int *out) {
+        return sortedDifferenceImpl(left, leftSize, right, rightSize, out);
+    }
+
+    size_t sortedDifference(const long long *left, size_t leftSize,
+                            const long long *right, size_t rightSize, long long *out) {
+        return sortedDifferenceImpl(left, leftSize, right, rightSize, out);
+    }
+
+    void sortedMerge(const int *left, size_t leftSize, const int *right, size_t rightSize, int *out) {
+        sortedMergeImpl(left, leftSize, right, rightSize, out);
+    }
+
+    void sortedMerge(const long long *left, size_t leftSize,
+                     const long long *right, size_t rightSize, long long *out) {
+        sortedMergeImpl(left, leftSize, right, rightSize, out);
+    }
+
+    void sortedMergeRuns(int *data, const std::vector<size_t> &bounds) {
+        sortedMergeRunsImpl(data, bounds);
+    }
+
+    void sortedMergeRuns(long long *data, const std::vector<size_t> &bounds) {
+        sortedMergeRunsImpl(data, bounds);
+    }
+
+    size_t sortedDedupe(int *data, size_t size) {
+        return intDedupeKernel(data, size);
+    }
+}
@@ -0,0 +1,88 @@
+//
+// Created by xia__mc on 2024/12/20.
+//
+
+#ifndef PYFASTUTIL_SETOPS_H
+#define PYFASTUTIL_SETOPS_H
+
+#include <cstddef>
+#include <vector>
+#include "Compat.h"
+
+namespace simd {
+
+    void initSetOps();
+
+    /**
+     * The intersect kernels store whole vectors, out needs this many elements of room past the last one written.
+     */
+    static constexpr size_t INTERSECT_PADDING = 16;
+
+    /**
+     * Write the values found in both left and right to out, in order. Both must be sorted ascending
+     * without duplicates. out must have room for min(leftSize, rightSize) + INTERSECT_PADDING elements.
+     * @return how many values were written
+     */
+    size_t simdIntersect(const unsigned short *left, size_t leftSize,
+                         const unsigned short *right, size_t rightSize, unsigned short *out);
+
+    /*
+     * Set algebra over sorted ascending ranges, with the multiset meaning of std::set_intersection and friends:
+     * a value m times in left and n times in right is min(m, n) times in the intersection, max(m, n) times in the
+     * union and m - n times in the difference. When one side is much larger, it's galloped over instead of merged.
+     * Ranges that aren't sorted give an unspecified result, but never write past the room asked for.
+     */
+
+    /**
+     * out must have room for min(leftSize, rightSize) + INTERSECT_PADDING elements.
+     * @return how many values were written
+     */
+    size_t sortedIntersect(const int *left, size_t leftSize, const int *right, size_t rightSize, int *out);
+
+    size_t sortedIntersect(const long long *left, size_t leftSize,
+                           const long long *right, size_t rightSize, long long *out);
+
+    /**
+     * out must have room for leftSize + rightSize elements.
+     * @return how many values were written
+     */
+    size_t sortedUnion(const int *left, size_t leftSize, const int *right, size_t rightSize, int *out);
+
+    size_t sortedUnion(const long long *left, size_t leftSize,
+                       const long long *right, size_t rightSize, long long *out);
+
+    /**
+     * The values of left not in right, out must have room for leftSize elements.
+     * @return how many values were written
+     */
+    size_t sortedDifference(const int *left, size_t leftSize, const int *right, size_t rightSize, int *out);
+
+    size_t sortedDifference(const long long *left, size_t leftSize,
+                            const long long *right, size_t rightSize, long long *out);
+
+    /**
+     * Every value of both, out must have room for leftSize + rightSize elements.
+     */
+    void sortedMerge(const int *left, size_t leftSize, const int *right, size_t rightSize, int *out);
+
+    void sortedMerge(const long long *left, size_t leftSize,
+                     const long long *right, size_t rightSize, long long *out);
+
+    /**
+     * Merge the sorted runs of data in place, run i is from bounds[i] to bounds[i + 1] and the last bound
+     * is the size of data. Runs are merged in pairs, so every element is moved log2(runs) times.
+     * Throws std::bad_alloc if the scratch space can't be allocated.
+     */
+    void sortedMergeRuns(int *data, const std::vector<size_t> &bounds);
+
+    void sortedMergeRuns(long long *data, const std::vector<size_t> &bounds);
+
+    /**
+     * Drop adjacent duplicates from data in place, keeping the first of every run of equal elements.
+     * Sorted data ends up with every value once.
+     * @return the new size
+     */
+    size_t sortedDedupe(int *data, size_t size);
+}
+
+#endif //PYFASTUTIL_SETOPS_H
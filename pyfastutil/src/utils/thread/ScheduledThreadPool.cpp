@@ -4,26 +4,40 @@
 
 #include "ScheduledThreadPool.h"
 
-static const unsigned int HARDWARE_THREADS = std::thread::hardware_concurrency();
+#include <algorithm>
 
-__forceinline void ScheduledThreadPool::initThreads(const unsigned int count) {
+#ifndef _WIN32
+
+#include <unistd.h>
+
+#endif
+
+static const unsigned int HARDWARE_THREADS = std::max(std::thread::hardware_concurrency(), 1u);
+
+void ScheduledThreadPool::initThreads(const unsigned int count) {
+    threads.reserve(count);
     for (unsigned int i = 0; i < count; ++i) {
         threads.emplace_back([this]() { worker(); });
     }
 }
 
-__forceinline void ScheduledThreadPool::worker() {
+void ScheduledThreadPool::worker() {
     while (true) {
-        std::unique_lock<std::mutex> curLock(mutex);
-        tasksReady.wait(curLock, [this]() { return shutdown || !tasks.empty(); });
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> curLock(mutex);
+            tasksReady.wait(curLock, [this]() { return shutdown || !tasks.empty(); });
 
-        if (shutdown) {
-            return;
-        }
+            // finish what's queued before leaving, so no future is left without a result
+            if (tasks.empty()) {
+                return;
+            }
 
-        std::function<void()> task = tasks.front();
-        tasks.pop();
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
 
+        // run without the lock, so other workers can take tasks meanwhile
         task();
     }
 }
@@ -33,7 +47,7 @@ ScheduledThreadPool::ScheduledThreadPool() {
 }
 
 ScheduledThreadPool::ScheduledThreadPool(const unsigned int threadCount) {
-    initThreads(threadCount);
+    initThreads(std::max(threadCount, 1u));
 }
 
 ScheduledThreadPool::~ScheduledThreadPool() {
@@ -49,3 +63,25 @@ ScheduledThreadPool::~ScheduledThreadPool() {
         }
     }
 }
+
+ScheduledThreadPool &ScheduledThreadPool::shared() {
+    static std::mutex sharedMutex;
+    static ScheduledThreadPool *pool = nullptr;
+
+    std::lock_guard<std::mutex> lock(sharedMutex);
+#ifndef _WIN32
+    // a forked child doesn't have the workers of its parent, so it needs a pool of its own.
+    // the old one is leaked on purpose, joining threads that don't exist would hang forever.
+    static pid_t owner = 0;
+    if (pool != nullptr && owner != getpid()) {
+        pool = nullptr;
+    }
+    owner = getpid();
+#endif
+
+    // never destroyed, workers may still be parked when the interpreter exits
+    if (pool == nullptr) {
+        pool = new ScheduledThreadPool();
+    }
+    return *pool;
+}
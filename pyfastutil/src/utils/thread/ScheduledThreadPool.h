@@ -8,8 +8,12 @@
 #include <condition_variable>
 #include <functional>
 #include <future>
-#include <atomic>
+#include <memory>
+#include <mutex>
 #include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #include "Compat.h"
 
 class ScheduledThreadPool {
@@ -20,31 +24,40 @@ public:
 
     ~ScheduledThreadPool();
 
-    template<typename T>
-    inline std::future<T> submit(const std::function<T()> &func) {
-        auto task = std::packaged_task<T()>(func);
-        std::future<T> future = task.get_future();
-
-        std::lock_guard<std::mutex> lock(mutex);
-        std::function<void()> finalTask = [&task]() { task(); };
-        tasks.emplace(finalTask);
-
+    ScheduledThreadPool(const ScheduledThreadPool &) = delete;
+
+    ScheduledThreadPool &operator=(const ScheduledThreadPool &) = delete;
+
+    /**
+     * The pool shared by the whole module, with one thread per hardware thread.
+     * Created on first use, so importing the module doesn't start any thread.
+     */
+    static ScheduledThreadPool &shared();
+
+    /**
+     * Run func on a worker thread.
+     * Exceptions thrown by func are rethrown by get() of the returned future.
+     * Never wait for the future from inside a task, the worker may be needed to run what it waits for.
+     */
+    template<typename Func>
+    inline std::future<std::invoke_result_t<Func>> submit(Func &&func) {
+        using T = std::invoke_result_t<Func>;
+
+        // std::function must be copyable, but packaged_task isn't, so share it
+        auto task = std::make_shared<std::packaged_task<T()>>(std::forward<Func>(func));
+        std::future<T> future = task->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace([task]() { (*task)(); });
+        }
         tasksReady.notify_one();
 
         return future;
     }
 
-    inline std::future<void> submit(const std::function<void()> &func) {
-        auto task = std::packaged_task<void()>(func);
-        std::future<void> future = task.get_future();
-
-        std::lock_guard<std::mutex> lock(mutex);
-        std::function<void()> finalTask = [&task]() { task(); };
-        tasks.emplace(finalTask);
-
-        tasksReady.notify_one();
-
-        return future;
+    [[nodiscard]] inline size_t size() const noexcept {
+        return threads.size();
     }
 
 private:
@@ -52,11 +65,11 @@ private:
     std::queue<std::function<void()>> tasks;
     std::mutex mutex;
     std::condition_variable tasksReady;
-    std::atomic<bool> shutdown = std::atomic_bool(false);
+    bool shutdown = false;
 
-    __forceinline void initThreads(unsigned int count);
+    void initThreads(unsigned int count);
 
-    __forceinline void worker();
+    void worker();
 };
 
 #endif //PYFASTUTIL_SCHEDULEDTHREADPOOL_H
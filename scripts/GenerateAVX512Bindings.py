@@ -181,7 +181,10 @@ FILE_TEMPLATE = """//
 #include "utils/simd/SIMDUtils.h"
 #include "utils/PythonUtils.h"
 
+// only the intrinsic wrappers are built for AVX-512, so importing this module never needs it
+SIMD_AVX512_BEGIN
 {function_def}
+SIMD_AVX512_END
 
 extern "C" {
 
@@ -208,7 +211,9 @@ static PyObject *SIMDLowAVX512_exit([[maybe_unused]] PyObject *self,
     Py_RETURN_NONE;
 }
 
+SIMD_AVX512_BEGIN
 {c_function_def}
+SIMD_AVX512_END
 
 static PyMethodDef SIMDLowAVX512_methods[] = {
         {"__enter__", (PyCFunction) SIMDLowAVX512_enter, METH_NOARGS, nullptr},
@@ -242,6 +247,8 @@ static struct PyModuleDef SIMDLowAVX512_module = {
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_SIMDLowAVX512() {
     initializeSIMDLowAVX512Type(SIMDLowAVX512Type);
+    if (PyType_Ready(&SIMDLowAVX512Type) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&SIMDLowAVX512_module);
     if (object == nullptr)
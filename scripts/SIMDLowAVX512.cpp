@@ -7,6 +7,8 @@
 #include "utils/simd/SIMDUtils.h"
 #include "utils/PythonUtils.h"
 
+// only the intrinsic wrappers are built for AVX-512, so importing this module never needs it
+SIMD_AVX512_BEGIN
 
 static __forceinline PyObject *SIMDLowAVX512__mm512_int2mask_impl([[maybe_unused]] PyObject *const *args, [[maybe_unused]] Py_ssize_t nargs) noexcept {
 #if !defined(__arm__) && !defined(__arm64__)
@@ -28689,6 +28691,7 @@ static __forceinline PyObject *SIMDLowAVX512__mm512_mask_reduce_min_pd_impl([[ma
 #endif
 }
 
+SIMD_AVX512_END
 
 extern "C" {
 
@@ -28715,6 +28718,7 @@ static PyObject *SIMDLowAVX512_exit([[maybe_unused]] PyObject *self,
     Py_RETURN_NONE;
 }
 
+SIMD_AVX512_BEGIN
 
 static PyObject *SIMDLowAVX512__mm512_int2mask([[maybe_unused]] PyObject *pySelf, PyObject *const *args, Py_ssize_t nargs) noexcept {
     return SIMDLowAVX512__mm512_int2mask_impl(args, nargs);
@@ -34248,6 +34252,7 @@ static PyObject *SIMDLowAVX512__mm512_mask_reduce_min_pd([[maybe_unused]] PyObje
     return SIMDLowAVX512__mm512_mask_reduce_min_pd_impl(args, nargs);
 }
 
+SIMD_AVX512_END
 
 static PyMethodDef SIMDLowAVX512_methods[] = {
         {"__enter__", (PyCFunction) SIMDLowAVX512_enter, METH_NOARGS, nullptr},
@@ -35663,6 +35668,8 @@ static struct PyModuleDef SIMDLowAVX512_module = {
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 PyMODINIT_FUNC PyInit_SIMDLowAVX512() {
     initializeSIMDLowAVX512Type(SIMDLowAVX512Type);
+    if (PyType_Ready(&SIMDLowAVX512Type) < 0)
+        return nullptr;
 
     PyObject *object = PyModule_Create(&SIMDLowAVX512_module);
     if (object == nullptr)
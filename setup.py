@@ -20,7 +20,6 @@ elif IS_MACOS:
         "-O3", "-flto", "-fPIC",
         "-Wall", "-fvisibility=hidden",
         "-Wno-error=unknown-pragmas",
-        "-mavx", "-mavx2", "-mavx512f", "-mavx512bw", "-mavx512dq", "-mavx512vl",
         "-fno-tree-vectorize", "-faligned-allocation"
     ]
     EXTRA_LINK_ARG = ["-flto"]
@@ -32,7 +31,6 @@ else:
         "-O3", "-flto", "-fPIC",
         "-std=c++20", "-Wall", "-fvisibility=hidden",
         "-Wno-error=unknown-pragmas",
-        "-mavx", "-mavx2", "-mavx512f", "-mavx512bw", "-mavx512dq", "-mavx512vl",
         "-fno-tree-vectorize"
     ]
     EXTRA_LINK_ARG = ["-flto", "-fpermissive"]
@@ -1,9 +1,13 @@
+import bisect
 import ctypes
+import random
 import unittest
+from collections import Counter
 
 import numpy
 
-from pyfastutil.ints import BigIntArrayList
+from pyfastutil.ints import IntArrayList, BigIntArrayList
+from pyfastutil.objects import ObjectArrayList
 from tests.benchmark import benchmark_list
 
 
@@ -101,6 +105,307 @@ class TestBigIntArrayList(unittest.TestCase):
         lst.sort(reverse=True)
         self.assertEqual(lst, [7, 6, 5, 4, 3, 2, 1])
 
+    def test_sort_key(self):
+        data = [random.randint(-1000, 1000) for _ in range(3000)] + [-2 ** 63, 2 ** 63 - 1]
+        keys = (
+            lambda x: x % 7,
+            lambda x: -x,
+            lambda x: x * 2 ** 70,
+            lambda x: x / 3,
+            lambda x: -0.0 if x % 2 else 0.0,
+            lambda x: x > 0,
+            lambda x: str(x),
+            lambda x: (x % 3, -x),
+            lambda x: x if x % 2 else float(x),
+        )
+        for key in keys:
+            for reverse in (False, True):
+                lst = BigIntArrayList(data)
+                lst.sort(key=key, reverse=reverse)
+                self.assertEqual(lst, sorted(data, key=key, reverse=reverse))
+
+        # NaN keys have no defined order, only check that nothing is lost
+        lst = BigIntArrayList(data)
+        lst.sort(key=lambda x: float("nan") if x % 5 == 0 else float(x))
+        self.assertEqual(sorted(lst), sorted(data))
+
+        calls = []
+        lst = BigIntArrayList([3, 1, 2])
+        lst.sort(key=lambda x: calls.append(x) or x)
+        self.assertEqual(calls, [3, 1, 2])
+
+        lst = BigIntArrayList([3, 1, 2])
+        with self.assertRaises(ZeroDivisionError):
+            lst.sort(key=lambda x: 1 // (x - 2))
+        self.assertEqual(lst, [3, 1, 2])
+        with self.assertRaises(ValueError):
+            lst.sort(key=lambda x: lst.append(x) or x)
+
+    def test_sort_large(self):
+        rng = numpy.random.default_rng(0)
+        for size in (8, 17, 100, 1000, 4999, 5001, 100000):
+            data = rng.integers(-2 ** 63, 2 ** 63, size).tolist()
+            lst = BigIntArrayList(data)
+            lst.sort()
+            self.assertEqual(lst, sorted(data))
+            lst.sort(reverse=True)
+            self.assertEqual(lst, sorted(data, reverse=True))
+
+    def test_sort_parallel(self):
+        for size in (10, 300_000, 1_000_003):
+            data = [random.randint(-2 ** 63, 2 ** 63 - 1) for _ in range(size)]
+            for threads in (0, 1, 3, 8):
+                lst = BigIntArrayList(data)
+                lst.sort(parallel=True, threads=threads)
+                self.assertEqual(lst, sorted(data))
+            lst = BigIntArrayList(data)
+            lst.sort(reverse=True, parallel=True)
+            self.assertEqual(lst, sorted(data, reverse=True))
+
+        with self.assertRaises(ValueError):
+            BigIntArrayList([1]).sort(parallel=True, threads=-1)
+
+    def test_sort_algorithms(self):
+        for size in (0, 1, 7, 100, 300, 5000, 100_003):
+            for lo, hi in ((-2 ** 63, 2 ** 63 - 1), (-3, 3), (1000, 1100), (-2 ** 20, 0)):
+                data = [random.randint(lo, hi) for _ in range(size)]
+                for algorithm in ("auto", "bitonic", "radix"):
+                    lst = BigIntArrayList(data)
+                    lst.sort(algorithm=algorithm)
+                    self.assertEqual(lst, sorted(data))
+                    lst.sort(reverse=True, algorithm=algorithm)
+                    self.assertEqual(lst, sorted(data, reverse=True))
+
+        data = [random.randint(-2 ** 63, 2 ** 63 - 1) for _ in range(300_000)]
+        lst = BigIntArrayList(data)
+        lst.sort(parallel=True, threads=3, algorithm="radix")
+        self.assertEqual(lst, sorted(data))
+
+        with self.assertRaises(ValueError):
+            BigIntArrayList([1]).sort(algorithm="bogo")
+
+    def test_argsort(self):
+        for size in (0, 1, 7, 100, 5000):
+            data = [random.randint(-20, 20) for _ in range(size)]
+            lst = BigIntArrayList(data)
+            for reverse in (False, True):
+                expected = sorted(range(size), key=lambda i: data[i], reverse=reverse)
+                self.assertEqual(lst.argsort(reverse), expected)
+                self.assertEqual(lst.argsort(reverse=reverse, stable=True), expected)
+                self.assertEqual([data[i] for i in lst.argsort(reverse, stable=False)],
+                                 sorted(data, reverse=reverse))
+            self.assertEqual(lst, data)
+
+    def test_sort_with(self):
+        for size in (0, 7, 5000):
+            data = [random.randint(-2 ** 63, 2 ** 63 - 1) for _ in range(size)]
+            for reverse in (False, True):
+                order = sorted(range(size), key=lambda i: data[i], reverse=reverse)
+
+                lst = BigIntArrayList(data)
+                ints = IntArrayList(range(size))
+                lst.sort_with(ints, reverse=reverse)
+                self.assertEqual(lst, sorted(data, reverse=reverse))
+                self.assertEqual(ints, order)
+
+                lst = BigIntArrayList(data)
+                longs = BigIntArrayList([i * 2 ** 40 for i in range(size)])
+                lst.sort_with(longs, reverse)
+                self.assertEqual(longs, [i * 2 ** 40 for i in order])
+
+                lst = BigIntArrayList(data)
+                objects = ObjectArrayList([str(i) for i in range(size)])
+                lst.sort_with(objects, reverse=reverse)
+                self.assertEqual(objects, [str(i) for i in order])
+
+        lst = BigIntArrayList([3, 1, 2])
+        lst.sort_with(lst)
+        self.assertEqual(lst, [1, 2, 3])
+        with self.assertRaises(ValueError):
+            lst.sort_with(IntArrayList([1]))
+        with self.assertRaises(TypeError):
+            lst.sort_with([1, 2, 3])
+        self.assertEqual(lst, [1, 2, 3])
+
+    def test_select(self):
+        for size in (1, 7, 300, 5000):
+            for low, high in ((-20, 20), (-2 ** 63, 2 ** 63 - 1)):
+                data = [random.randint(low, high) for _ in range(size)]
+                expected = sorted(data)
+
+                for k in (0, size // 2, size - 1, -1):
+                    lst = BigIntArrayList(data)
+                    self.assertEqual(lst.nth_element(k), expected[k])
+                    self.assertEqual(sorted(lst), expected)
+                    self.assertTrue(all(x <= lst[k] for x in lst[:k]))
+                    self.assertTrue(all(x >= lst[k] for x in lst[k:]))
+
+                for k in (0, 1, size // 3, size, size + 5):
+                    lst = BigIntArrayList(data)
+                    lst.partial_sort(k)
+                    self.assertEqual(lst[:k], expected[:k])
+                    self.assertEqual(sorted(lst), expected)
+                    lst.partial_sort(k, reverse=True)
+                    self.assertEqual(lst[:k], expected[::-1][:k])
+
+                    lst = BigIntArrayList(data)
+                    self.assertEqual(lst.top_k(k), expected[::-1][:k])
+                    self.assertEqual(lst.top_k(k, reverse=False), expected[:k])
+                    self.assertEqual(lst, data)
+
+        self.assertEqual(BigIntArrayList([3] * 1000).nth_element(500), 3)
+        self.assertEqual(BigIntArrayList(range(1000)).top_k(3), [999, 998, 997])
+        with self.assertRaises(IndexError):
+            BigIntArrayList().nth_element(0)
+        with self.assertRaises(IndexError):
+            BigIntArrayList([1, 2]).nth_element(2)
+        with self.assertRaises(ValueError):
+            BigIntArrayList([1, 2]).partial_sort(-1)
+        with self.assertRaises(ValueError):
+            BigIntArrayList([1, 2]).top_k(-1)
+
+    def test_mul_imul(self):
+        lst = BigIntArrayList(range(5))
+        self.assertEqual(lst * 3, list(range(5)) * 3)
+        lst *= 3
+        self.assertEqual(lst, list(range(5)) * 3)
+
+    def test_sum(self):
+        self.assertEqual(BigIntArrayList().sum(), 0)
+        for size in (1, 7, 17, 100, 1003):
+            data = [random.randint(-2 ** 63, 2 ** 63 - 1) for _ in range(size)]
+            self.assertEqual(BigIntArrayList(data).sum(), sum(data))
+        # doesn't overflow
+        self.assertEqual(BigIntArrayList([2 ** 63 - 1] * 1000).sum(), (2 ** 63 - 1) * 1000)
+        self.assertEqual(BigIntArrayList([-2 ** 63] * 1000).sum(), -2 ** 63 * 1000)
+
+    def test_min_max(self):
+        for size in (1, 7, 17, 100, 1003):
+            data = [random.randint(-2 ** 63, 2 ** 63 - 1) for _ in range(size)]
+            lst = BigIntArrayList(data)
+            self.assertEqual(lst.min(), min(data))
+            self.assertEqual(lst.max(), max(data))
+            self.assertEqual(lst.minmax(), (min(data), max(data)))
+            self.assertEqual(lst.argmin(), data.index(min(data)))
+            self.assertEqual(lst.argmax(), data.index(max(data)))
+
+        # first index wins
+        self.assertEqual(BigIntArrayList([5, 1, 9, 1, 9]).argmin(), 1)
+        self.assertEqual(BigIntArrayList([5, 1, 9, 1, 9]).argmax(), 2)
+
+        for method in (BigIntArrayList.min, BigIntArrayList.max, BigIntArrayList.minmax, BigIntArrayList.argmin, BigIntArrayList.argmax):
+            with self.assertRaises(ValueError):
+                method(BigIntArrayList())
+
+    def test_search(self):
+        for size in (0, 1, 7, 17, 100, 1003):
+            data = [random.randint(-5, 5) for _ in range(size)]
+            lst = BigIntArrayList(data)
+            for value in range(-6, 7):
+                self.assertEqual(lst.count(value), data.count(value))
+                self.assertEqual(value in lst, value in data)
+                if value in data:
+                    self.assertEqual(lst.index(value), data.index(value))
+                else:
+                    with self.assertRaises(ValueError):
+                        lst.index(value)
+
+        lst = BigIntArrayList(range(100))
+        self.assertEqual(lst.index(50, 20, 60), 50)
+        with self.assertRaises(ValueError):
+            lst.index(50, 60)
+        lst.remove(70)
+        self.assertEqual(lst, [i for i in range(100) if i != 70])
+        with self.assertRaises(ValueError):
+            lst.remove(70)
+        self.assertNotIn(2 ** 63 - 2, lst)
+
+    def test_count_all(self):
+        data = [random.randint(-20, 20) for _ in range(1003)]
+        lst = BigIntArrayList(data)
+        for needles in ([], [3], [5, -5, 5, 100], list(range(-25, 25)), list(range(10)) * 3):
+            expected = [data.count(value) for value in needles]
+            self.assertEqual(lst.count_all(needles), expected)
+            self.assertEqual(lst.count_all(BigIntArrayList(needles)), expected)
+            self.assertEqual(lst.count_all(numpy.array(needles, dtype=numpy.int64)), expected)
+        self.assertEqual(lst.count_all([2 ** 63 - 2]), [0])
+        with self.assertRaises(TypeError):
+            lst.count_all(["1"])
+
+    def test_sorted_set_ops(self):
+        def sample(size, high):
+            return sorted(random.randint(-high, high) for _ in range(size))
+
+        for leftSize, rightSize, high in ((0, 0, 10), (0, 50, 10), (200, 200, 50), (300, 300, 10 ** 6),
+                                          (3, 5000, 10 ** 4), (5000, 3, 10 ** 4), (1000, 1000, 2 ** 63 - 1)):
+            left = sample(leftSize, high)
+            right = sample(rightSize, high)
+            a, b = BigIntArrayList(left), BigIntArrayList(right)
+            counts, otherCounts = Counter(left), Counter(right)
+            self.assertEqual(a.sorted_intersect(b), sorted((counts & otherCounts).elements()))
+            self.assertEqual(a.sorted_union(b), sorted((counts | otherCounts).elements()))
+            self.assertEqual(a.sorted_difference(b), sorted((counts - otherCounts).elements()))
+            self.assertEqual(a.merge(b), sorted(left + right))
+            self.assertEqual(a, left)
+            self.assertIsInstance(a.merge(b), BigIntArrayList)
+
+        strict = BigIntArrayList(range(0, 1000, 2))
+        self.assertEqual(strict.sorted_intersect(BigIntArrayList(range(0, 1000, 3))), list(range(0, 1000, 6)))
+        self.assertEqual(strict.sorted_intersect(strict), strict)
+        self.assertEqual(strict.sorted_difference(strict), [])
+        with self.assertRaises(TypeError):
+            strict.sorted_union([1, 2])
+        with self.assertRaises(TypeError):
+            strict.merge(IntArrayList([1, 2]))
+
+    def test_merge_many(self):
+        runs = [sorted(random.randint(-100, 100) for _ in range(random.randrange(50))) for _ in range(9)]
+        self.assertEqual(BigIntArrayList.merge_many([BigIntArrayList(run) for run in runs]), sorted(sum(runs, [])))
+        self.assertEqual(BigIntArrayList.merge_many((BigIntArrayList([3]),)), [3])
+        self.assertEqual(BigIntArrayList.merge_many([]), [])
+        self.assertIsInstance(BigIntArrayList.merge_many([]), BigIntArrayList)
+        with self.assertRaises(TypeError):
+            BigIntArrayList.merge_many([BigIntArrayList([1]), [2]])
+
+    def test_bisect(self):
+        data = sorted(random.randint(-50, 50) for _ in range(300))
+        lst = BigIntArrayList(data)
+        for value in list(range(-52, 53)) + [2 ** 63 - 1, -2 ** 63, 2 ** 100, -2 ** 100]:
+            self.assertEqual(lst.bisect_left(value), bisect.bisect_left(data, value))
+            self.assertEqual(lst.bisect_right(value), bisect.bisect_right(data, value))
+            self.assertEqual(lst.contains_sorted(value), value in data)
+            self.assertEqual(lst.bisect_left(value, 10, 200), bisect.bisect_left(data, value, 10, 200))
+            self.assertEqual(lst.bisect_right(value, lo=10, hi=200), bisect.bisect_right(data, value, 10, 200))
+
+        self.assertEqual(lst.bisect_left(0, 500), 500)
+        self.assertEqual(lst.bisect_left(2 ** 63 - 1, hi=1000), len(data))
+        self.assertEqual(BigIntArrayList().bisect_right(1), 0)
+        self.assertFalse(BigIntArrayList().contains_sorted(1))
+        self.assertFalse(lst.contains_sorted("1"))
+        with self.assertRaises(ValueError):
+            lst.bisect_left(1, -1)
+        with self.assertRaises(TypeError):
+            lst.bisect_left("1")
+
+    def test_searchsorted(self):
+        # Large enough for the breadth first layout, and small
+        for size, needleCount in ((100000, 10000), (1000, 100), (0, 10)):
+            data = sorted(random.randint(-2 ** 63, 2 ** 63 - 1) for _ in range(size))
+            needles = [random.randint(-2 ** 63, 2 ** 63 - 1) for _ in range(needleCount)]
+            needles += data[:5] + [2 ** 63 - 1, -2 ** 63]
+            lst = BigIntArrayList(data)
+            left = lst.searchsorted(BigIntArrayList(needles))
+            self.assertIsInstance(left, IntArrayList)
+            self.assertEqual(left, [bisect.bisect_left(data, value) for value in needles])
+            self.assertEqual(lst.searchsorted(BigIntArrayList(needles), side="right"),
+                             [bisect.bisect_right(data, value) for value in needles])
+
+        self.assertEqual(BigIntArrayList([1, 2]).searchsorted(BigIntArrayList()), [])
+        with self.assertRaises(ValueError):
+            BigIntArrayList([1, 2]).searchsorted(BigIntArrayList([1]), side="middle")
+        with self.assertRaises(TypeError):
+            BigIntArrayList([1, 2]).searchsorted([1])
+
     def test_copy(self):
         lst = BigIntArrayList([1, 2, 3])
         lst_copy = lst.copy()
@@ -199,6 +504,46 @@ class TestBigIntArrayList(unittest.TestCase):
         self.assertEqual(lst, numpyLst)
         self.assertEqual(lst, numpyLstFast)
 
+    def test_buffer(self):
+        data = numpy.array([-2 ** 63, -1, 0, 1, 2 ** 63 - 1], dtype=numpy.int64)
+        for source in (data, memoryview(data), BigIntArrayList(data.tolist())):
+            self.assertEqual(BigIntArrayList.frombuffer(source), data.tolist())
+            self.assertEqual(BigIntArrayList(source), data.tolist())
+        self.assertEqual(BigIntArrayList.frombuffer(numpy.array([], dtype=numpy.int64)), [])
+        self.assertEqual(BigIntArrayList(b"\x01\x02"), [1, 2])
+        with self.assertRaises(TypeError):
+            BigIntArrayList.frombuffer(numpy.array([1.5]))
+        with self.assertRaises((BufferError, ValueError)):
+            BigIntArrayList.frombuffer(data[::2])
+        lst = BigIntArrayList([1, 2, 3])
+        array = numpy.asarray(lst)
+        array[0] = 10
+        self.assertEqual(lst, [10, 2, 3])
+        for resize in (lambda: lst.append(4), lambda: lst.pop(), lambda: lst.clear(), lambda: lst.extend([1]),
+                       lambda: lst.insert(0, 1), lambda: lst.remove(2), lambda: lst.resize(5)):
+            with self.assertRaises(BufferError):
+                resize()
+        with self.assertRaises(BufferError):
+            del lst[0]
+        lst[1:3] = [5, 6]
+        lst.sort(key=lambda x: -x)
+        self.assertEqual(array.tolist(), [10, 6, 5])
+        del array
+        lst.append(4)
+        self.assertEqual(lst, [10, 6, 5, 4])
+
+        view = lst.view(readonly=True)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.format, "q")
+        self.assertEqual(view.tolist(), [10, 6, 5, 4])
+        with self.assertRaises(TypeError):
+            view[0] = 1
+        self.assertFalse(numpy.asarray(view).flags.writeable)
+        with self.assertRaises(BufferError):
+            lst.append(5)
+        view.release()
+        lst.append(5)
+        self.assertFalse(lst.view().readonly)
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,140 @@
+import random
+import unittest
+
+from pyfastutil.ints import BitSet
+
+
+def random_bits(size, density=0.5):
+    return [random.random() < density for _ in range(size)]
+
+
+class TestBitSet(unittest.TestCase):
+    SIZES = (0, 1, 63, 64, 65, 255, 256, 257, 1000, 4099)
+
+    # Test creation and basic properties
+    def test_creation(self):
+        self.assertEqual(len(BitSet()), 0)
+        self.assertEqual(BitSet(3).to_list(), [False] * 3)
+        self.assertEqual(BitSet([1, 0, "x", None]).to_list(), [True, False, True, False])
+        self.assertEqual(BitSet(x > 1 for x in range(4)).to_list(), [False, False, True, True])
+        bits = BitSet([True, False])
+        self.assertEqual(BitSet(bits), bits)
+        self.assertEqual(repr(bits), "[True, False]")
+        with self.assertRaises(ValueError):
+            BitSet(-1)
+        with self.assertRaises(TypeError):
+            BitSet(1.5)
+
+    def test_get_set(self):
+        bits = BitSet(100)
+        bits[3] = True
+        bits.set(-1)
+        bits[70] = 1
+        self.assertTrue(bits[3])
+        self.assertTrue(bits.get(99))
+        self.assertEqual(list(bits).count(True), 3)
+        bits[3] = False
+        bits.clear(70)
+        bits.flip(0)
+        self.assertEqual([i for i, bit in enumerate(bits) if bit], [0, 99])
+        for index in (100, -101):
+            with self.assertRaises(IndexError):
+                bits.get(index)
+            with self.assertRaises(IndexError):
+                bits[index] = True
+        with self.assertRaises(TypeError):
+            del bits[0]
+
+    def test_ranges(self):
+        for size in self.SIZES:
+            data = random_bits(size)
+            for _ in range(10):
+                start = random.randint(0, size)
+                stop = random.randint(start, size)
+                for op in ("set", "clear", "flip"):
+                    bits = BitSet(data)
+                    getattr(bits, op)(start, stop)
+                    expected = list(data)
+                    for i in range(start, stop):
+                        expected[i] = op == "set" or (op == "flip" and not expected[i])
+                    self.assertEqual(bits.to_list(), expected)
+                    self.assertEqual(bits.cardinality(), sum(expected))
+
+        bits = BitSet([True] * 10)
+        bits.clear()
+        self.assertEqual(bits, BitSet(10))
+        for start, stop in ((-1, 2), (3, 2), (0, 11)):
+            with self.assertRaises(IndexError):
+                bits.set(start, stop)
+
+    def test_cardinality(self):
+        for size in self.SIZES:
+            for density in (0.0, 0.1, 0.5, 1.0):
+                data = random_bits(size, density)
+                self.assertEqual(BitSet(data).cardinality(), sum(data))
+
+    def test_next_bit(self):
+        for size in self.SIZES:
+            data = random_bits(size, 0.05)
+            bits = BitSet(data)
+            self.assertEqual(bits.next_set_bit(), data.index(True) if True in data else -1)
+            for start in range(0, size + 2, max(1, size // 20)):
+                expected = next((i for i in range(start, size) if data[i]), -1)
+                self.assertEqual(bits.next_set_bit(start), expected)
+                expected = next((i for i in range(start, size) if not data[i]), -1)
+                self.assertEqual(bits.next_clear_bit(start), expected)
+
+        self.assertEqual(BitSet([True] * 64).next_clear_bit(), -1)
+        with self.assertRaises(ValueError):
+            BitSet(1).next_set_bit(-1)
+
+    def test_operators(self):
+        for size in self.SIZES:
+            a = random_bits(size)
+            b = random_bits(size)
+            left = BitSet(a)
+            right = BitSet(b)
+            self.assertEqual((left & right).to_list(), [x and y for x, y in zip(a, b)])
+            self.assertEqual((left | right).to_list(), [x or y for x, y in zip(a, b)])
+            self.assertEqual((left ^ right).to_list(), [x != y for x, y in zip(a, b)])
+            self.assertEqual((~left).to_list(), [not x for x in a])
+            self.assertEqual((~left).cardinality(), size - sum(a))
+            self.assertEqual(left.to_list(), a)
+
+            for op in ("__iand__", "__ior__", "__ixor__"):
+                result = left.copy()
+                result = getattr(result, op)(right)
+                self.assertEqual(result, getattr(left, op.replace("__i", "__"))(right))
+
+        with self.assertRaises(ValueError):
+            BitSet(3) & BitSet(4)
+        with self.assertRaises(TypeError):
+            BitSet(3) | [True] * 3
+
+    def test_equality(self):
+        self.assertEqual(BitSet([True, False]), BitSet([True, False]))
+        self.assertNotEqual(BitSet([True, False]), BitSet([True, True]))
+        self.assertNotEqual(BitSet(2), BitSet(3))
+        self.assertNotEqual(BitSet([True]), [True])
+
+    def test_resize_append(self):
+        bits = BitSet([True] * 100)
+        bits.resize(10)
+        bits.resize(100)
+        self.assertEqual(bits.cardinality(), 10)
+        self.assertEqual(bits.next_set_bit(10), -1)
+        bits.append(True)
+        bits.append(0)
+        self.assertEqual(len(bits), 102)
+        self.assertEqual([bits[-2], bits[-1]], [True, False])
+        with self.assertRaises(ValueError):
+            bits.resize(-1)
+
+    def test_iter(self):
+        data = random_bits(300)
+        self.assertEqual(list(BitSet(data)), data)
+        self.assertEqual(list(BitSet()), [])
+
+
+if __name__ == '__main__':
+    unittest.main()
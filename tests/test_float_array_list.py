@@ -0,0 +1,296 @@
+import math
+import random
+import unittest
+
+import numpy
+
+from pyfastutil.floats import FloatArrayList, DoubleArrayList
+from pyfastutil.ints import IntArrayList
+
+
+def float32(value):
+    return float(numpy.float32(value))
+
+
+class TestFloatArrayList(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation_empty(self):
+        lst = FloatArrayList()
+        self.assertEqual(len(lst), 0)
+        self.assertEqual(lst, [])
+
+    def test_creation_with_values(self):
+        lst = FloatArrayList([1.5, 2, -3.25])
+        self.assertEqual(len(lst), 3)
+        self.assertEqual(lst, [1.5, 2.0, -3.25])
+        self.assertEqual(FloatArrayList((x / 2 for x in range(5))), [0.0, 0.5, 1.0, 1.5, 2.0])
+        self.assertEqual(FloatArrayList(FloatArrayList([1.5])), [1.5])
+        with self.assertRaises(TypeError):
+            FloatArrayList(["1.5"])
+
+    # Test basic list operations
+    def test_append_insert_extend(self):
+        lst = FloatArrayList([1.5])
+        lst.append(2)
+        lst.insert(0, 0.5)
+        lst.insert(-1, 1.75)
+        lst.extend([3.5, 4])
+        lst += FloatArrayList([5.5])
+        self.assertEqual(lst, [0.5, 1.5, 1.75, 2.0, 3.5, 4.0, 5.5])
+        with self.assertRaises(TypeError):
+            lst.append(None)
+
+    def test_pop_remove_clear(self):
+        lst = FloatArrayList([1.5, 2.5, 3.5, 2.5])
+        self.assertEqual(lst.pop(), 2.5)
+        self.assertEqual(lst.pop(0), 1.5)
+        lst.remove(3.5)
+        self.assertEqual(lst, [2.5])
+        with self.assertRaises(ValueError):
+            lst.remove(3.5)
+        lst.clear()
+        with self.assertRaises(IndexError):
+            lst.pop()
+
+    # Test index and item access
+    def test_getitem_setitem(self):
+        lst = FloatArrayList([1.5, 2.5, 3.5])
+        self.assertEqual(lst[0], 1.5)
+        self.assertEqual(lst[-1], 3.5)
+        lst[1] = 9
+        self.assertEqual(lst, [1.5, 9.0, 3.5])
+        with self.assertRaises(IndexError):
+            _ = lst[10]
+        with self.assertRaises(IndexError):
+            lst[10] = 1.0
+        del lst[0]
+        self.assertEqual(lst, [9.0, 3.5])
+
+    def test_slice(self):
+        lst = FloatArrayList([1.5, 2.5, 3.5, 4.5, 5.5])
+        self.assertEqual(lst[:2], [1.5, 2.5])
+        self.assertEqual(lst[::2], [1.5, 3.5, 5.5])
+        lst[1:3] = [0.5, 0.25, 0.125]
+        self.assertEqual(lst, [1.5, 0.5, 0.25, 0.125, 4.5, 5.5])
+        lst[0:4] = (7,)
+        self.assertEqual(lst, [7.0, 4.5, 5.5])
+        del lst[1:]
+        self.assertEqual(lst, [7.0])
+        with self.assertRaises(TypeError):
+            lst[0:1] = ["x"]
+        self.assertEqual(lst, [7.0])
+
+    def test_reverse_iter(self):
+        lst = FloatArrayList([1.5, 2.5, 3.5])
+        self.assertEqual(list(lst), [1.5, 2.5, 3.5])
+        self.assertEqual(list(reversed(lst)), [3.5, 2.5, 1.5])
+        self.assertEqual(list(FloatArrayList()), [])
+        lst.reverse()
+        self.assertEqual(lst, [3.5, 2.5, 1.5])
+
+    def test_repr(self):
+        self.assertEqual(repr(FloatArrayList()), "[]")
+        self.assertEqual(repr(FloatArrayList([1, 2.5, float("inf"), float("nan")])), "[1.0, 2.5, inf, nan]")
+        self.assertEqual(str(FloatArrayList([0.1])), str([float32(0.1)]))
+
+    def test_sort(self):
+        nan = float("nan")
+        for size in (0, 1, 7, 100, 300, 5000, 100_003):
+            data = [float32(random.uniform(-1e6, 1e6)) for _ in range(size)]
+            data += [float("inf"), float("-inf"), -0.0, 0.0, nan, -nan][:size]
+            random.shuffle(data)
+            numbers = [x for x in data if not math.isnan(x)]
+            nans = len(data) - len(numbers)
+            for algorithm in ("auto", "bitonic", "radix"):
+                for reverse in (False, True):
+                    lst = FloatArrayList(data)
+                    lst.sort(reverse=reverse, algorithm=algorithm)
+                    result = lst.to_list()
+                    # NaN goes last in both directions
+                    self.assertEqual(result[:len(numbers)], sorted(numbers, reverse=reverse))
+                    self.assertTrue(all(math.isnan(x) for x in result[len(numbers):]))
+                    self.assertEqual(len(result), len(numbers) + nans)
+
+        with self.assertRaises(ValueError):
+            FloatArrayList([1.0]).sort(algorithm="bogo")
+
+    def test_sort_key(self):
+        data = [float32(random.uniform(-100, 100)) for _ in range(3000)]
+        for key in (lambda x: -x, lambda x: int(x) % 7, str, abs):
+            for reverse in (False, True):
+                lst = FloatArrayList(data)
+                lst.sort(key=key, reverse=reverse)
+                self.assertEqual(lst, sorted(data, key=key, reverse=reverse))
+
+    def test_argsort(self):
+        for size in (0, 1, 7, 100, 5000):
+            data = [random.randint(-20, 20) / 4 for _ in range(size)]
+            lst = FloatArrayList(data)
+            for reverse in (False, True):
+                expected = sorted(range(size), key=lambda i: data[i], reverse=reverse)
+                self.assertEqual(lst.argsort(reverse), expected)
+                self.assertIsInstance(lst.argsort(reverse), IntArrayList)
+                self.assertEqual([data[i] for i in lst.argsort(reverse, stable=False)],
+                                 sorted(data, reverse=reverse))
+            self.assertEqual(lst, data)
+
+        # NaN last in either direction, -0.0 equals 0.0
+        lst = FloatArrayList([float("nan"), 0.0, -1.0, -0.0, 2.0])
+        self.assertEqual(lst.argsort(), [2, 1, 3, 4, 0])
+        self.assertEqual(lst.argsort(reverse=True), [4, 1, 3, 2, 0])
+
+    def test_mul_imul(self):
+        lst = FloatArrayList([0.5, 1.5])
+        self.assertEqual(lst * 3, [0.5, 1.5] * 3)
+        self.assertEqual(2 * lst, [0.5, 1.5] * 2)
+        lst *= 3
+        self.assertEqual(lst, [0.5, 1.5] * 3)
+        lst *= 0
+        self.assertEqual(lst, [])
+
+    def test_sum(self):
+        self.assertEqual(FloatArrayList().sum(), 0.0)
+        for size in (1, 7, 17, 100, 1003):
+            data = [float32(random.uniform(-1, 1)) for _ in range(size)]
+            self.assertTrue(math.isclose(FloatArrayList(data).sum(), math.fsum(data), abs_tol=1e-9))
+        self.assertEqual(FloatArrayList([0.5] * 1000).sum(), 500.0)
+        self.assertTrue(math.isnan(FloatArrayList([1.0, float("nan")] * 20).sum()))
+
+    def test_min_max(self):
+        for size in (1, 7, 17, 100, 1003):
+            data = [float32(random.uniform(-1e3, 1e3)) for _ in range(size)]
+            lst = FloatArrayList(data)
+            self.assertEqual(lst.min(), min(data))
+            self.assertEqual(lst.max(), max(data))
+            self.assertEqual(lst.minmax(), (min(data), max(data)))
+            self.assertEqual(lst.argmin(), data.index(min(data)))
+            self.assertEqual(lst.argmax(), data.index(max(data)))
+
+            # NaN anywhere makes the result NaN, and argmin/argmax point at it
+            for index in (0, size // 2, size - 1):
+                poisoned = list(data)
+                poisoned[index] = float("nan")
+                lst = FloatArrayList(poisoned)
+                self.assertTrue(math.isnan(lst.min()))
+                self.assertTrue(math.isnan(lst.max()))
+                self.assertTrue(all(math.isnan(x) for x in lst.minmax()))
+                self.assertEqual(lst.argmin(), index)
+                self.assertEqual(lst.argmax(), index)
+
+        self.assertEqual(FloatArrayList([5, 1, 9, 1, 9]).argmin(), 1)
+        self.assertEqual(FloatArrayList([5, 1, 9, 1, 9]).argmax(), 2)
+
+        for method in (FloatArrayList.min, FloatArrayList.max, FloatArrayList.minmax, FloatArrayList.argmin, FloatArrayList.argmax):
+            with self.assertRaises(ValueError):
+                method(FloatArrayList())
+
+    def test_dot(self):
+        for size in (0, 1, 7, 17, 100, 1003):
+            a = [float32(random.uniform(-1, 1)) for _ in range(size)]
+            b = [float32(random.uniform(-1, 1)) for _ in range(size)]
+            expected = math.fsum(x * y for x, y in zip(a, b))
+            lst = FloatArrayList(a)
+            for other in (FloatArrayList(b), FloatArrayList(b) if True else DoubleArrayList(b),
+                          numpy.array(b, dtype=numpy.float32)):
+                self.assertTrue(math.isclose(lst.dot(other), expected, abs_tol=1e-6))
+        self.assertEqual(FloatArrayList([1, 2, 3]).dot(FloatArrayList([4, 5, 6])), 32.0)
+        with self.assertRaises(ValueError):
+            FloatArrayList([1.0]).dot(FloatArrayList([1.0, 2.0]))
+        with self.assertRaises(TypeError):
+            FloatArrayList([1.0]).dot(numpy.array([1], dtype=numpy.int64))
+
+    def test_search(self):
+        data = [random.randint(-5, 5) / 2 for _ in range(100)]
+        lst = FloatArrayList(data)
+        for value in [x / 2 for x in range(-12, 13)]:
+            self.assertEqual(lst.count(value), data.count(value))
+            self.assertEqual(value in lst, value in data)
+            if value in data:
+                self.assertEqual(lst.index(value), data.index(value))
+            else:
+                with self.assertRaises(ValueError):
+                    lst.index(value)
+        self.assertEqual(FloatArrayList([1.5, 2.5, 1.5]).index(1.5, 1), 2)
+        self.assertNotIn(float("nan"), FloatArrayList([float("nan")]))
+        self.assertNotIn(2 ** 1100, FloatArrayList([1.0]))
+        self.assertNotIn("1.0", FloatArrayList([1.0]))
+
+    def test_comparisons(self):
+        lst = FloatArrayList([1.5, 2.5, 3.5])
+        self.assertEqual(lst, FloatArrayList([1.5, 2.5, 3.5]))
+        self.assertEqual(lst, [1.5, 2.5, 3.5])
+        self.assertNotEqual(lst, FloatArrayList([1.5, 2.5]))
+        self.assertLess(lst, FloatArrayList([1.5, 3.5]))
+        self.assertLess(FloatArrayList([1.5, 2.5]), lst)
+        self.assertGreaterEqual(lst, [1.5, 2.5, 3.5])
+        self.assertNotEqual(FloatArrayList([float("nan")]), FloatArrayList([float("nan")]))
+        self.assertEqual(FloatArrayList([-0.0]), FloatArrayList([0.0]))
+
+    def test_copy_resize(self):
+        lst = FloatArrayList([1.5, 2.5])
+        lst_copy = lst.copy()
+        self.assertEqual(lst, lst_copy)
+        self.assertIsNot(lst, lst_copy)
+        lst.resize(4)
+        self.assertEqual(lst, [1.5, 2.5, 0.0, 0.0])
+        lst.resize(1)
+        self.assertEqual(lst, [1.5])
+        with self.assertRaises(ValueError):
+            lst.resize(-1)
+
+    def test_numpy(self):
+        data = numpy.array([-1.5, 0.0, 2.25, numpy.inf], dtype=numpy.float32)
+        lst = FloatArrayList(data)
+        self.assertTrue(numpy.array_equal(numpy.asarray(lst), data))
+        self.assertEqual(numpy.asarray(lst).dtype, numpy.float32)
+        self.assertEqual(numpy.array(lst).tolist(), data.tolist())
+
+    def test_buffer(self):
+        data = numpy.array([-1.5, 0.0, 0.1, 1e30, numpy.inf], dtype=numpy.float32)
+        for source in (data, memoryview(data), FloatArrayList(data.tolist())):
+            self.assertEqual(FloatArrayList.frombuffer(source), data.tolist())
+            self.assertEqual(FloatArrayList(source), data.tolist())
+        other = data.astype(numpy.float64)
+        self.assertEqual(FloatArrayList.frombuffer(other), other.astype(numpy.float32).tolist())
+        self.assertEqual(FloatArrayList.frombuffer(numpy.array([], dtype=numpy.float32)), [])
+        self.assertEqual(FloatArrayList(numpy.array([1, 2], dtype=numpy.int64)), [1.0, 2.0])
+        with self.assertRaises(TypeError):
+            FloatArrayList.frombuffer(numpy.array([1], dtype=numpy.int32))
+        with self.assertRaises((BufferError, ValueError)):
+            FloatArrayList.frombuffer(data[::2])
+        # doubles out of float range become inf
+        self.assertEqual(FloatArrayList.frombuffer(numpy.array([1e300, -1e300])), [math.inf, -math.inf])
+
+        lst = FloatArrayList([1.5, 2.5, 3.5])
+        array = numpy.asarray(lst)
+        array[0] = 10
+        self.assertEqual(lst, [10.0, 2.5, 3.5])
+        for resize in (lambda: lst.append(4), lambda: lst.pop(), lambda: lst.clear(), lambda: lst.extend([1]),
+                       lambda: lst.insert(0, 1), lambda: lst.remove(2.5), lambda: lst.resize(5)):
+            with self.assertRaises(BufferError):
+                resize()
+        with self.assertRaises(BufferError):
+            del lst[0]
+        lst[1:3] = [5, 6]
+        lst.sort(reverse=True)
+        self.assertEqual(array.tolist(), [10.0, 6.0, 5.0])
+        del array
+        lst.append(4)
+        self.assertEqual(lst, [10.0, 6.0, 5.0, 4.0])
+
+        view = lst.view(readonly=True)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.format, "f")
+        self.assertEqual(view.tolist(), [10.0, 6.0, 5.0, 4.0])
+        with self.assertRaises(TypeError):
+            view[0] = 1.0
+        with self.assertRaises(BufferError):
+            lst.append(5)
+        view.release()
+        lst.append(5)
+        self.assertFalse(lst.view().readonly)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,106 @@
+import unittest
+import random
+from pyfastutil.ints import IndexedIntHeap
+
+
+class TestIndexedIntHeap(unittest.TestCase):
+
+    def test_creation_empty(self):
+        heap = IndexedIntHeap()
+        self.assertEqual(len(heap), 0)
+        self.assertEqual(heap.to_list(), [])
+
+    def test_push_pop(self):
+        heap = IndexedIntHeap()
+        heap.push(0, 10)
+        heap.push(1, 5)
+        heap.push(2, 7)
+        self.assertEqual(heap.peek(), (1, 5))
+        self.assertEqual([heap.pop() for _ in range(3)], [(1, 5), (2, 7), (0, 10)])
+        with self.assertRaises(IndexError):
+            heap.pop()
+
+    def test_push_existing(self):
+        heap = IndexedIntHeap()
+        heap.push(3, 1)
+        with self.assertRaises(ValueError):
+            heap.push(3, 2)
+        with self.assertRaises(ValueError):
+            heap.push(-1, 2)
+
+    def test_decrease_key(self):
+        heap = IndexedIntHeap()
+        for node in range(10):
+            heap.push(node, 100 + node)
+        heap.decrease_key(9, 0)
+        self.assertEqual(heap.peek(), (9, 0))
+        with self.assertRaises(ValueError):
+            heap.decrease_key(9, 1)
+        with self.assertRaises(KeyError):
+            heap.decrease_key(10, 0)
+
+    def test_update(self):
+        heap = IndexedIntHeap()
+        heap.update(4, 10)
+        heap.update(5, 20)
+        heap.update(4, 30)
+        self.assertEqual(heap.to_list(), [(5, 20), (4, 30)])
+
+    def test_mapping(self):
+        heap = IndexedIntHeap()
+        heap.push(2, 20)
+        self.assertIn(2, heap)
+        self.assertNotIn(3, heap)
+        self.assertNotIn(-1, heap)
+        self.assertNotIn("2", heap)
+        self.assertEqual(heap[2], 20)
+        with self.assertRaises(KeyError):
+            _ = heap[3]
+
+    def test_remove(self):
+        heap = IndexedIntHeap()
+        for node in range(5):
+            heap.push(node, node)
+        self.assertEqual(heap.remove(2), 2)
+        self.assertNotIn(2, heap)
+        self.assertEqual(heap.to_list(), [(0, 0), (1, 1), (3, 3), (4, 4)])
+        with self.assertRaises(KeyError):
+            heap.remove(2)
+
+    def test_clear(self):
+        heap = IndexedIntHeap()
+        heap.push(1, 1)
+        heap.clear()
+        self.assertEqual(len(heap), 0)
+        self.assertNotIn(1, heap)
+        heap.push(1, 2)
+        self.assertEqual(heap.pop(), (1, 2))
+
+    def test_dijkstra(self):
+        rnd = random.Random(0)
+        n = 200
+        edges = [[(rnd.randrange(n), rnd.randrange(1, 100)) for _ in range(5)] for _ in range(n)]
+
+        # reference: Bellman-Ford
+        expected = [float("inf")] * n
+        expected[0] = 0
+        for _ in range(n):
+            for u in range(n):
+                for v, w in edges[u]:
+                    expected[v] = min(expected[v], expected[u] + w)
+
+        dist = [float("inf")] * n
+        dist[0] = 0
+        heap = IndexedIntHeap()
+        heap.push(0, 0)
+        while heap:
+            u, d = heap.pop()
+            for v, w in edges[u]:
+                if d + w < dist[v]:
+                    dist[v] = d + w
+                    heap.update(v, d + w)
+        self.assertEqual(dist, expected)
+
+
+if __name__ == '__main__':
+    unittest.main()
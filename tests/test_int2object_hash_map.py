@@ -0,0 +1,122 @@
+import gc
+import unittest
+import weakref
+from pyfastutil.ints import Int2ObjectHashMap, IntArrayList
+
+
+class Node:
+    pass
+
+
+class TestInt2ObjectHashMap(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation(self):
+        self.assertEqual(Int2ObjectHashMap(), {})
+        self.assertEqual(Int2ObjectHashMap({1: "a", 2: None}), {1: "a", 2: None})
+        self.assertEqual(Int2ObjectHashMap([(1, "a"), (1, "b")]), {1: "b"})
+        m = Int2ObjectHashMap({1: [1]})
+        self.assertEqual(Int2ObjectHashMap(m), m)
+
+    def test_creation_invalid(self):
+        with self.assertRaises(OverflowError):
+            Int2ObjectHashMap({2 ** 40: "a"})
+        with self.assertRaises(TypeError):
+            Int2ObjectHashMap({"a": "a"})
+        with self.assertRaises(ValueError):
+            Int2ObjectHashMap([(1, 2, 3)])
+
+    # Test mapping protocol
+    def test_getitem_setitem_delitem(self):
+        m = Int2ObjectHashMap()
+        value = object()
+        m[1] = value
+        m[-1] = "x"
+        m[-1] = "y"
+        self.assertIs(m[1], value)
+        self.assertEqual(m[-1], "y")
+        del m[1]
+        self.assertNotIn(1, m)
+        with self.assertRaises(KeyError):
+            _ = m[1]
+        with self.assertRaises(KeyError):
+            del m["1"]
+
+    def test_contains_iter(self):
+        m = Int2ObjectHashMap({1: "a", 3: "b"})
+        self.assertIn(1, m)
+        self.assertNotIn(2, m)
+        self.assertNotIn(2 ** 40, m)
+        self.assertNotIn("a", m)
+        self.assertEqual(sorted(m), [1, 3])
+
+    # Test dict methods
+    def test_get_pop_setdefault(self):
+        m = Int2ObjectHashMap({1: "a"})
+        self.assertEqual(m.get(1), "a")
+        self.assertIsNone(m.get(2))
+        self.assertEqual(m.get(2, "z"), "z")
+        self.assertEqual(m.setdefault(2, "b"), "b")
+        self.assertEqual(m.setdefault(2, "c"), "b")
+        self.assertIsNone(m.setdefault(3))
+        self.assertEqual(m.pop(1), "a")
+        self.assertEqual(m.pop(1, "z"), "z")
+        with self.assertRaises(KeyError):
+            m.pop(1)
+
+    def test_items_keys_values(self):
+        data = {i: str(i) for i in range(100)}
+        m = Int2ObjectHashMap(data)
+        self.assertEqual(sorted(m.items()), sorted(data.items()))
+        self.assertIsInstance(m.keys(), IntArrayList)
+        self.assertEqual(sorted(m.keys()), sorted(data.keys()))
+        self.assertEqual(sorted(m.values()), sorted(data.values()))
+
+    def test_update_clear_copy(self):
+        m = Int2ObjectHashMap({1: "a"})
+        m.update({1: "b", 2: "c"})
+        m.update(Int2ObjectHashMap({3: "d"}))
+        copy = m.copy()
+        m.clear()
+        self.assertEqual(len(m), 0)
+        self.assertEqual(copy, {1: "b", 2: "c", 3: "d"})
+
+    def test_eq(self):
+        self.assertEqual(Int2ObjectHashMap({1: [1]}), Int2ObjectHashMap({1: [1]}))
+        self.assertNotEqual(Int2ObjectHashMap({1: [1]}), {1: [2]})
+        self.assertNotEqual(Int2ObjectHashMap({1: "a"}), {"1": "a"})
+        self.assertNotEqual(Int2ObjectHashMap(), [])
+
+    # Test reference counting and gc
+    def test_refcount(self):
+        value = object()
+        m = Int2ObjectHashMap()
+        node = Node()
+        ref = weakref.ref(node)
+        m[1] = node
+        m[2] = value
+        del node
+        self.assertIsNotNone(ref())
+        m[1] = value
+        self.assertIsNone(ref())
+
+    def test_gc_cycle(self):
+        m = Int2ObjectHashMap()
+        node = Node()
+        node.map = m
+        m[1] = node
+        ref = weakref.ref(node)
+        del m, node
+        gc.collect()
+        self.assertIsNone(ref())
+
+    def test_repr(self):
+        self.assertEqual(repr(Int2ObjectHashMap()), "{}")
+        self.assertEqual(repr(Int2ObjectHashMap({1: "a", -2: None})), "{1: 'a', -2: None}")
+        m = Int2ObjectHashMap()
+        m[1] = m
+        self.assertEqual(repr(m), "{1: {...}}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,215 @@
+import unittest
+import random
+from collections import deque
+from pyfastutil.ints import IntArrayDeque, IntArrayList
+
+
+class TestIntArrayDeque(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation_empty(self):
+        dq = IntArrayDeque()
+        self.assertEqual(len(dq), 0)
+        self.assertEqual(dq, [])
+        self.assertFalse(dq)
+
+    def test_creation_with_values(self):
+        dq = IntArrayDeque([1, 2, 3])
+        self.assertEqual(len(dq), 3)
+        self.assertEqual(dq, [1, 2, 3])
+        self.assertEqual(IntArrayDeque(IntArrayList([1, 2])), [1, 2])
+        self.assertEqual(IntArrayDeque(dq), dq)
+        self.assertEqual(IntArrayDeque(iter(range(5))), [0, 1, 2, 3, 4])
+
+    # Test both ends
+    def test_append_pop(self):
+        dq = IntArrayDeque()
+        dq.append(1)
+        dq.append(2)
+        dq.appendleft(0)
+        self.assertEqual(dq, [0, 1, 2])
+        self.assertEqual(dq.pop(), 2)
+        self.assertEqual(dq.popleft(), 0)
+        self.assertEqual(dq, [1])
+
+    def test_pop_empty(self):
+        dq = IntArrayDeque()
+        with self.assertRaises(IndexError):
+            dq.pop()
+        with self.assertRaises(IndexError):
+            dq.popleft()
+
+    def test_extend(self):
+        dq = IntArrayDeque([1, 2])
+        dq.extend([3, 4])
+        dq.extendleft((0, -1))
+        self.assertEqual(dq, [-1, 0, 1, 2, 3, 4])
+
+    def test_extend_self(self):
+        dq = IntArrayDeque([1, 2])
+        dq.extend(dq)
+        self.assertEqual(dq, [1, 2, 1, 2])
+        dq.extendleft(dq)
+        self.assertEqual(dq, [2, 1, 2, 1, 1, 2, 1, 2])
+
+    def test_wrap_around(self):
+        dq = IntArrayDeque()
+        expected = deque()
+        for i in range(100):
+            dq.appendleft(i)
+            expected.appendleft(i)
+            dq.append(-i)
+            expected.append(-i)
+            if i % 3 == 0:
+                self.assertEqual(dq.popleft(), expected.popleft())
+        self.assertEqual(dq, list(expected))
+        self.assertEqual(list(reversed(dq)), list(reversed(expected)))
+
+    def test_drain(self):
+        dq = IntArrayDeque(range(10))
+        drained = dq.drain(4)
+        self.assertIsInstance(drained, IntArrayList)
+        self.assertEqual(drained, [0, 1, 2, 3])
+        self.assertEqual(dq, [4, 5, 6, 7, 8, 9])
+        self.assertEqual(dq.drain(100), [4, 5, 6, 7, 8, 9])
+        self.assertEqual(dq.drain(), [])
+
+    def test_drain_wrapped(self):
+        dq = IntArrayDeque(range(10))
+        dq.extendleft(range(10, 15))
+        self.assertEqual(dq.drain(), [14, 13, 12, 11, 10, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9])
+        self.assertEqual(len(dq), 0)
+
+    def test_rotate(self):
+        for n in range(-12, 13):
+            dq = IntArrayDeque(range(10))
+            expected = deque(range(10))
+            dq.rotate(n)
+            expected.rotate(n)
+            self.assertEqual(dq, list(expected))
+        dq = IntArrayDeque([1, 2, 3])
+        dq.rotate()
+        self.assertEqual(dq, [3, 1, 2])
+
+    def test_reverse(self):
+        dq = IntArrayDeque([1, 2, 3])
+        dq.appendleft(0)
+        dq.reverse()
+        self.assertEqual(dq, [3, 2, 1, 0])
+
+    # Test indexing and searching
+    def test_index_access(self):
+        dq = IntArrayDeque([1, 2, 3])
+        dq.appendleft(0)
+        self.assertEqual(dq[0], 0)
+        self.assertEqual(dq[-1], 3)
+        dq[1] = 10
+        self.assertEqual(dq, [0, 10, 2, 3])
+        del dq[2]
+        self.assertEqual(dq, [0, 10, 3])
+        with self.assertRaises(IndexError):
+            _ = dq[3]
+
+    def test_insert_remove(self):
+        dq = IntArrayDeque([1, 3])
+        dq.insert(1, 2)
+        dq.insert(-100, 0)
+        dq.insert(100, 4)
+        self.assertEqual(dq, [0, 1, 2, 3, 4])
+        dq.remove(2)
+        self.assertEqual(dq, [0, 1, 3, 4])
+        with self.assertRaises(ValueError):
+            dq.remove(2)
+
+    def test_count_index_contains(self):
+        dq = IntArrayDeque([1, 2, 3, 2])
+        dq.appendleft(2)
+        self.assertEqual(dq.count(2), 3)
+        self.assertEqual(dq.index(2), 0)
+        self.assertEqual(dq.index(2, 1), 2)
+        self.assertEqual(dq.index(2, 3), 4)
+        with self.assertRaises(ValueError):
+            dq.index(2, 3, -1)
+        self.assertIn(3, dq)
+        self.assertNotIn(5, dq)
+        self.assertNotIn("2", dq)
+        self.assertNotIn(2 ** 100, dq)
+        with self.assertRaises(ValueError):
+            dq.index(5)
+
+    def test_overflow(self):
+        dq = IntArrayDeque()
+        with self.assertRaises(OverflowError):
+            dq.append(2 ** 100)
+        with self.assertRaises(TypeError):
+            dq.append("1")
+
+    # Test protocols
+    def test_operators(self):
+        dq = IntArrayDeque([1, 2])
+        self.assertEqual(dq + IntArrayDeque([3]), [1, 2, 3])
+        self.assertEqual(dq * 2, [1, 2, 1, 2])
+        dq += [3]
+        self.assertEqual(dq, [1, 2, 3])
+        dq *= 0
+        self.assertEqual(dq, [])
+
+    def test_copy(self):
+        dq = IntArrayDeque([1, 2, 3])
+        copy = dq.copy()
+        copy.append(4)
+        self.assertEqual(dq, [1, 2, 3])
+        self.assertEqual(copy, [1, 2, 3, 4])
+
+    def test_clear(self):
+        dq = IntArrayDeque([1, 2, 3])
+        dq.clear()
+        self.assertEqual(len(dq), 0)
+        dq.append(1)
+        self.assertEqual(dq, [1])
+
+    def test_repr(self):
+        self.assertEqual(repr(IntArrayDeque([1, 2, 3])), "[1, 2, 3]")
+        self.assertEqual(str(IntArrayDeque()), "[]")
+
+    def test_iter_after_mutation(self):
+        dq = IntArrayDeque([1, 2, 3])
+        with self.assertRaises(RuntimeError):
+            for _ in dq:
+                dq.append(0)
+
+    def test_against_deque(self):
+        rnd = random.Random(0)
+        dq = IntArrayDeque()
+        expected = deque()
+        for _ in range(5000):
+            op = rnd.randrange(7)
+            value = rnd.randrange(100)
+            if op == 0:
+                dq.append(value)
+                expected.append(value)
+            elif op == 1:
+                dq.appendleft(value)
+                expected.appendleft(value)
+            elif op == 2 and expected:
+                self.assertEqual(dq.pop(), expected.pop())
+            elif op == 3 and expected:
+                self.assertEqual(dq.popleft(), expected.popleft())
+            elif op == 4:
+                n = rnd.randrange(-20, 20)
+                dq.rotate(n)
+                expected.rotate(n)
+            elif op == 5:
+                index = rnd.randrange(-len(expected) - 1, len(expected) + 1)
+                dq.insert(index, value)
+                expected.insert(index, value)
+            elif op == 6 and expected:
+                index = rnd.randrange(len(expected))
+                self.assertEqual(dq[index], expected[index])
+                del dq[index]
+                del expected[index]
+        self.assertEqual(dq, list(expected))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,7 +1,14 @@
+import bisect
+import itertools
+import random
+import subprocess
+import sys
 import unittest
+from collections import Counter
 import numpy
 import ctypes
-from pyfastutil.ints import IntArrayList
+from pyfastutil.ints import IntArrayList, BigIntArrayList, BitSet, IntIntHashMap
+from pyfastutil.objects import ObjectArrayList
 from tests.benchmark import benchmark_list
 
 
@@ -99,6 +106,384 @@ class TestIntArrayList(unittest.TestCase):
         lst.sort(reverse=True)
         self.assertEqual(lst, [7, 6, 5, 4, 3, 2, 1])
 
+    def test_sort_key(self):
+        data = [random.randint(-1000, 1000) for _ in range(3000)] + [-2 ** 31, 2 ** 31 - 1]
+        keys = (
+            lambda x: x % 7,
+            lambda x: -x,
+            lambda x: x * 2 ** 70,
+            lambda x: x / 3,
+            lambda x: -0.0 if x % 2 else 0.0,
+            lambda x: x > 0,
+            lambda x: str(x),
+            lambda x: (x % 3, -x),
+            lambda x: x if x % 2 else float(x),
+        )
+        for key in keys:
+            for reverse in (False, True):
+                lst = IntArrayList(data)
+                lst.sort(key=key, reverse=reverse)
+                self.assertEqual(lst, sorted(data, key=key, reverse=reverse))
+
+        # NaN keys have no defined order, only check that nothing is lost
+        lst = IntArrayList(data)
+        lst.sort(key=lambda x: float("nan") if x % 5 == 0 else float(x))
+        self.assertEqual(sorted(lst), sorted(data))
+
+        calls = []
+        lst = IntArrayList([3, 1, 2])
+        lst.sort(key=lambda x: calls.append(x) or x)
+        self.assertEqual(calls, [3, 1, 2])
+
+        lst = IntArrayList([3, 1, 2])
+        with self.assertRaises(ZeroDivisionError):
+            lst.sort(key=lambda x: 1 // (x - 2))
+        self.assertEqual(lst, [3, 1, 2])
+        with self.assertRaises(ValueError):
+            lst.sort(key=lambda x: lst.append(x) or x)
+
+    def test_sort_large(self):
+        rng = numpy.random.default_rng(0)
+        for size in (8, 17, 100, 1000, 4999, 5001, 100000):
+            data = rng.integers(-2 ** 31, 2 ** 31, size).tolist()
+            lst = IntArrayList(data)
+            lst.sort()
+            self.assertEqual(lst, sorted(data))
+            lst.sort(reverse=True)
+            self.assertEqual(lst, sorted(data, reverse=True))
+
+    def test_sort_parallel(self):
+        for size in (10, 300_000, 1_000_003):
+            data = [random.randint(-2 ** 31, 2 ** 31 - 1) for _ in range(size)]
+            for threads in (0, 1, 3, 8):
+                lst = IntArrayList(data)
+                lst.sort(parallel=True, threads=threads)
+                self.assertEqual(lst, sorted(data))
+            lst = IntArrayList(data)
+            lst.sort(reverse=True, parallel=True)
+            self.assertEqual(lst, sorted(data, reverse=True))
+
+        with self.assertRaises(ValueError):
+            IntArrayList([1]).sort(parallel=True, threads=-1)
+
+    def test_methods_in_fresh_interpreter(self):
+        # methods must be found on instances before anything touched the type itself
+        code = "from pyfastutil.ints import IntArrayList; lst = IntArrayList([3, 1, 2]); lst.sort(**{}); print(lst)"
+        result = subprocess.run([sys.executable, "-c", code], capture_output=True, text=True)
+        self.assertEqual(result.stdout.strip(), "[1, 2, 3]", result.stderr)
+
+    def test_sort_algorithms(self):
+        for size in (0, 1, 7, 100, 300, 5000, 100_003):
+            for lo, hi in ((-2 ** 31, 2 ** 31 - 1), (-3, 3), (1000, 1100), (-2 ** 20, 0)):
+                data = [random.randint(lo, hi) for _ in range(size)]
+                for algorithm in ("auto", "bitonic", "radix"):
+                    lst = IntArrayList(data)
+                    lst.sort(algorithm=algorithm)
+                    self.assertEqual(lst, sorted(data))
+                    lst.sort(reverse=True, algorithm=algorithm)
+                    self.assertEqual(lst, sorted(data, reverse=True))
+
+        data = [random.randint(-2 ** 31, 2 ** 31 - 1) for _ in range(300_000)]
+        lst = IntArrayList(data)
+        lst.sort(parallel=True, threads=3, algorithm="radix")
+        self.assertEqual(lst, sorted(data))
+
+        with self.assertRaises(ValueError):
+            IntArrayList([1]).sort(algorithm="bogo")
+
+    def test_argsort(self):
+        for size in (0, 1, 7, 100, 5000):
+            data = [random.randint(-20, 20) for _ in range(size)]
+            lst = IntArrayList(data)
+            for reverse in (False, True):
+                expected = sorted(range(size), key=lambda i: data[i], reverse=reverse)
+                self.assertEqual(lst.argsort(reverse), expected)
+                self.assertEqual(lst.argsort(reverse=reverse, stable=True), expected)
+                self.assertEqual([data[i] for i in lst.argsort(reverse, stable=False)],
+                                 sorted(data, reverse=reverse))
+            self.assertEqual(lst, data)
+
+    def test_sort_with(self):
+        for size in (0, 7, 5000):
+            data = [random.randint(-2 ** 31, 2 ** 31 - 1) for _ in range(size)]
+            for reverse in (False, True):
+                order = sorted(range(size), key=lambda i: data[i], reverse=reverse)
+
+                lst = IntArrayList(data)
+                ints = IntArrayList(range(size))
+                lst.sort_with(ints, reverse=reverse)
+                self.assertEqual(lst, sorted(data, reverse=reverse))
+                self.assertEqual(ints, order)
+
+                lst = IntArrayList(data)
+                longs = BigIntArrayList([i * 2 ** 40 for i in range(size)])
+                lst.sort_with(longs, reverse)
+                self.assertEqual(longs, [i * 2 ** 40 for i in order])
+
+                lst = IntArrayList(data)
+                objects = ObjectArrayList([str(i) for i in range(size)])
+                lst.sort_with(objects, reverse=reverse)
+                self.assertEqual(objects, [str(i) for i in order])
+
+        lst = IntArrayList([3, 1, 2])
+        lst.sort_with(lst)
+        self.assertEqual(lst, [1, 2, 3])
+        with self.assertRaises(ValueError):
+            lst.sort_with(IntArrayList([1]))
+        with self.assertRaises(TypeError):
+            lst.sort_with([1, 2, 3])
+        self.assertEqual(lst, [1, 2, 3])
+
+    def test_select(self):
+        for size in (1, 7, 300, 5000):
+            for low, high in ((-20, 20), (-2 ** 31, 2 ** 31 - 1)):
+                data = [random.randint(low, high) for _ in range(size)]
+                expected = sorted(data)
+
+                for k in (0, size // 2, size - 1, -1):
+                    lst = IntArrayList(data)
+                    self.assertEqual(lst.nth_element(k), expected[k])
+                    self.assertEqual(sorted(lst), expected)
+                    self.assertTrue(all(x <= lst[k] for x in lst[:k]))
+                    self.assertTrue(all(x >= lst[k] for x in lst[k:]))
+
+                for k in (0, 1, size // 3, size, size + 5):
+                    lst = IntArrayList(data)
+                    lst.partial_sort(k)
+                    self.assertEqual(lst[:k], expected[:k])
+                    self.assertEqual(sorted(lst), expected)
+                    lst.partial_sort(k, reverse=True)
+                    self.assertEqual(lst[:k], expected[::-1][:k])
+
+                    lst = IntArrayList(data)
+                    self.assertEqual(lst.top_k(k), expected[::-1][:k])
+                    self.assertEqual(lst.top_k(k, reverse=False), expected[:k])
+                    self.assertEqual(lst, data)
+
+        self.assertEqual(IntArrayList([3] * 1000).nth_element(500), 3)
+        self.assertEqual(IntArrayList(range(1000)).top_k(3), [999, 998, 997])
+        with self.assertRaises(IndexError):
+            IntArrayList().nth_element(0)
+        with self.assertRaises(IndexError):
+            IntArrayList([1, 2]).nth_element(2)
+        with self.assertRaises(ValueError):
+            IntArrayList([1, 2]).partial_sort(-1)
+        with self.assertRaises(ValueError):
+            IntArrayList([1, 2]).top_k(-1)
+
+    def test_select_bitset(self):
+        for size in (0, 1, 15, 64, 100, 1000, 4099):
+            data = [random.randint(-2 ** 31, 2 ** 31 - 1) for _ in range(size)]
+            lst = IntArrayList(data)
+            for density in (0.0, 0.1, 0.5, 0.9, 1.0):
+                bits = [random.random() < density for _ in range(size)]
+                self.assertEqual(lst.select(BitSet(bits)), [x for x, bit in zip(data, bits) if bit])
+
+        with self.assertRaises(ValueError):
+            IntArrayList([1, 2]).select(BitSet(3))
+        with self.assertRaises(TypeError):
+            IntArrayList([1, 2]).select([True, False])
+
+    def test_to_bitset(self):
+        for universe in (1, 64, 1000):
+            values = [random.randrange(universe) for _ in range(universe // 2)]
+            bits = IntArrayList(values).to_bitset(universe)
+            self.assertEqual(len(bits), universe)
+            self.assertEqual(bits.to_list(), [i in values for i in range(universe)])
+
+        self.assertEqual(len(IntArrayList().to_bitset(0)), 0)
+        for value in (-1, 10):
+            with self.assertRaises(ValueError):
+                IntArrayList([value]).to_bitset(10)
+        with self.assertRaises(ValueError):
+            IntArrayList().to_bitset(-1)
+
+    def test_mul_imul(self):
+        lst = IntArrayList(range(5))
+        self.assertEqual(lst * 3, list(range(5)) * 3)
+        lst *= 3
+        self.assertEqual(lst, list(range(5)) * 3)
+
+    def test_sum(self):
+        self.assertEqual(IntArrayList().sum(), 0)
+        for size in (1, 7, 17, 100, 1003):
+            data = [random.randint(-2 ** 31, 2 ** 31 - 1) for _ in range(size)]
+            self.assertEqual(IntArrayList(data).sum(), sum(data))
+        # doesn't overflow
+        self.assertEqual(IntArrayList([2 ** 31 - 1] * 1000).sum(), (2 ** 31 - 1) * 1000)
+        self.assertEqual(IntArrayList([-2 ** 31] * 1000).sum(), -2 ** 31 * 1000)
+
+    def test_min_max(self):
+        for size in (1, 7, 17, 100, 1003):
+            data = [random.randint(-2 ** 31, 2 ** 31 - 1) for _ in range(size)]
+            lst = IntArrayList(data)
+            self.assertEqual(lst.min(), min(data))
+            self.assertEqual(lst.max(), max(data))
+            self.assertEqual(lst.minmax(), (min(data), max(data)))
+            self.assertEqual(lst.argmin(), data.index(min(data)))
+            self.assertEqual(lst.argmax(), data.index(max(data)))
+
+        # first index wins
+        self.assertEqual(IntArrayList([5, 1, 9, 1, 9]).argmin(), 1)
+        self.assertEqual(IntArrayList([5, 1, 9, 1, 9]).argmax(), 2)
+
+        for method in (IntArrayList.min, IntArrayList.max, IntArrayList.minmax, IntArrayList.argmin, IntArrayList.argmax):
+            with self.assertRaises(ValueError):
+                method(IntArrayList())
+
+    def test_search(self):
+        for size in (0, 1, 7, 17, 100, 1003):
+            data = [random.randint(-5, 5) for _ in range(size)]
+            lst = IntArrayList(data)
+            for value in range(-6, 7):
+                self.assertEqual(lst.count(value), data.count(value))
+                self.assertEqual(value in lst, value in data)
+                if value in data:
+                    self.assertEqual(lst.index(value), data.index(value))
+                else:
+                    with self.assertRaises(ValueError):
+                        lst.index(value)
+
+        lst = IntArrayList(range(100))
+        self.assertEqual(lst.index(50, 20, 60), 50)
+        with self.assertRaises(ValueError):
+            lst.index(50, 60)
+        lst.remove(70)
+        self.assertEqual(lst, [i for i in range(100) if i != 70])
+        with self.assertRaises(ValueError):
+            lst.remove(70)
+        self.assertNotIn(2 ** 32 + 1, lst)
+
+    def test_count_all(self):
+        data = [random.randint(-20, 20) for _ in range(1003)]
+        lst = IntArrayList(data)
+        for needles in ([], [3], [5, -5, 5, 100], list(range(-25, 25)), list(range(10)) * 3):
+            expected = [data.count(value) for value in needles]
+            self.assertEqual(lst.count_all(needles), expected)
+            self.assertEqual(lst.count_all(IntArrayList(needles)), expected)
+            self.assertEqual(lst.count_all(numpy.array(needles, dtype=numpy.int64)), expected)
+        self.assertEqual(lst.count_all([2 ** 32 + 1]), [0])
+        with self.assertRaises(TypeError):
+            lst.count_all(["1"])
+
+    def test_sorted_set_ops(self):
+        def sample(size, high):
+            return sorted(random.randint(-high, high) for _ in range(size))
+
+        for leftSize, rightSize, high in ((0, 0, 10), (0, 50, 10), (200, 200, 50), (300, 300, 10 ** 6),
+                                          (3, 5000, 10 ** 4), (5000, 3, 10 ** 4), (1000, 1000, 2 ** 31 - 1)):
+            left = sample(leftSize, high)
+            right = sample(rightSize, high)
+            a, b = IntArrayList(left), IntArrayList(right)
+            counts, otherCounts = Counter(left), Counter(right)
+            self.assertEqual(a.sorted_intersect(b), sorted((counts & otherCounts).elements()))
+            self.assertEqual(a.sorted_union(b), sorted((counts | otherCounts).elements()))
+            self.assertEqual(a.sorted_difference(b), sorted((counts - otherCounts).elements()))
+            self.assertEqual(a.merge(b), sorted(left + right))
+            self.assertEqual(a, left)
+            self.assertIsInstance(a.merge(b), IntArrayList)
+
+        strict = IntArrayList(range(0, 1000, 2))
+        self.assertEqual(strict.sorted_intersect(IntArrayList(range(0, 1000, 3))), list(range(0, 1000, 6)))
+        self.assertEqual(strict.sorted_intersect(strict), strict)
+        self.assertEqual(strict.sorted_difference(strict), [])
+        with self.assertRaises(TypeError):
+            strict.sorted_union([1, 2])
+        with self.assertRaises(TypeError):
+            strict.merge(BigIntArrayList([1, 2]))
+
+    def test_merge_many(self):
+        runs = [sorted(random.randint(-100, 100) for _ in range(random.randrange(50))) for _ in range(9)]
+        self.assertEqual(IntArrayList.merge_many([IntArrayList(run) for run in runs]), sorted(sum(runs, [])))
+        self.assertEqual(IntArrayList.merge_many((IntArrayList([3]),)), [3])
+        self.assertEqual(IntArrayList.merge_many([]), [])
+        self.assertIsInstance(IntArrayList.merge_many([]), IntArrayList)
+        with self.assertRaises(TypeError):
+            IntArrayList.merge_many([IntArrayList([1]), [2]])
+
+    def test_bisect(self):
+        data = sorted(random.randint(-50, 50) for _ in range(300))
+        lst = IntArrayList(data)
+        for value in list(range(-52, 53)) + [2 ** 31 - 1, -2 ** 31, 2 ** 100, -2 ** 100]:
+            self.assertEqual(lst.bisect_left(value), bisect.bisect_left(data, value))
+            self.assertEqual(lst.bisect_right(value), bisect.bisect_right(data, value))
+            self.assertEqual(lst.contains_sorted(value), value in data)
+            self.assertEqual(lst.bisect_left(value, 10, 200), bisect.bisect_left(data, value, 10, 200))
+            self.assertEqual(lst.bisect_right(value, lo=10, hi=200), bisect.bisect_right(data, value, 10, 200))
+
+        self.assertEqual(lst.bisect_left(0, 500), 500)
+        self.assertEqual(lst.bisect_left(2 ** 31 - 1, hi=1000), len(data))
+        self.assertEqual(IntArrayList().bisect_right(1), 0)
+        self.assertFalse(IntArrayList().contains_sorted(1))
+        self.assertFalse(lst.contains_sorted("1"))
+        with self.assertRaises(ValueError):
+            lst.bisect_left(1, -1)
+        with self.assertRaises(TypeError):
+            lst.bisect_left("1")
+
+    def test_searchsorted(self):
+        # Large enough for the breadth first layout, and small
+        for size, needleCount in ((100000, 10000), (1000, 100), (0, 10)):
+            data = sorted(random.randint(-2 ** 31, 2 ** 31 - 1) for _ in range(size))
+            needles = [random.randint(-2 ** 31, 2 ** 31 - 1) for _ in range(needleCount)]
+            needles += data[:5] + [2 ** 31 - 1, -2 ** 31]
+            lst = IntArrayList(data)
+            left = lst.searchsorted(IntArrayList(needles))
+            self.assertIsInstance(left, IntArrayList)
+            self.assertEqual(left, [bisect.bisect_left(data, value) for value in needles])
+            self.assertEqual(lst.searchsorted(IntArrayList(needles), side="right"),
+                             [bisect.bisect_right(data, value) for value in needles])
+
+        self.assertEqual(IntArrayList([1, 2]).searchsorted(IntArrayList()), [])
+        with self.assertRaises(ValueError):
+            IntArrayList([1, 2]).searchsorted(IntArrayList([1]), side="middle")
+        with self.assertRaises(TypeError):
+            IntArrayList([1, 2]).searchsorted([1])
+
+    def test_unique(self):
+        # Few distinct values go through a hash set, many through a sort
+        for data in ([random.randint(-20, 20) for _ in range(1000)],
+                     random.sample(range(-2 ** 31, 2 ** 31 - 1), 300000),
+                     sorted(random.randint(-5, 5) for _ in range(100)), []):
+            lst = IntArrayList(data)
+            self.assertEqual(lst.unique(), list(dict.fromkeys(data)))
+            self.assertEqual(lst.unique(sorted=True), sorted(set(data)))
+            self.assertIsInstance(lst.unique(), IntArrayList)
+            self.assertEqual(lst, data)
+
+    def test_dedupe_sorted(self):
+        for size in (0, 1, 7, 8, 9, 16, 17, 100, 1000):
+            data = [random.randint(-3, 3) for _ in range(size)]
+            lst = IntArrayList(data)
+            lst.dedupe_sorted()
+            self.assertEqual(lst, [value for value, _ in itertools.groupby(data)])
+
+            data.sort()
+            lst = IntArrayList(data)
+            lst.dedupe_sorted()
+            self.assertEqual(lst, sorted(set(data)))
+
+        lst = IntArrayList([1, 1, 2])
+        view = lst.view()
+        with self.assertRaises(BufferError):
+            lst.dedupe_sorted()
+        view.release()
+
+    def test_value_counts(self):
+        data = [random.randint(-50, 50) for _ in range(5000)] + [-2 ** 31, 2 ** 31 - 1]
+        counts = sorted(Counter(data).items())
+        values, valueCounts = IntArrayList(data).value_counts()
+        self.assertIsInstance(values, IntArrayList)
+        self.assertEqual(values, [value for value, _ in counts])
+        self.assertEqual(valueCounts, [count for _, count in counts])
+
+        mapping = IntArrayList(data).value_counts(as_map=True)
+        self.assertIsInstance(mapping, IntIntHashMap)
+        self.assertEqual(dict(mapping.items()), dict(counts))
+
+        self.assertEqual(IntArrayList().value_counts(), ([], []))
+        self.assertEqual(len(IntArrayList().value_counts(as_map=True)), 0)
+
     def test_copy(self):
         lst = IntArrayList([1, 2, 3])
         lst_copy = lst.copy()
@@ -197,6 +582,48 @@ class TestIntArrayList(unittest.TestCase):
         self.assertEqual(lst, numpyLst)
         self.assertEqual(lst, numpyLstFast)
 
+    def test_buffer(self):
+        data = numpy.array([-2 ** 31, -1, 0, 1, 2 ** 31 - 1], dtype=numpy.int32)
+        for source in (data, data.astype(numpy.int64), memoryview(data), IntArrayList(data.tolist())):
+            self.assertEqual(IntArrayList.frombuffer(source), data.tolist())
+            self.assertEqual(IntArrayList(source), data.tolist())
+        self.assertEqual(IntArrayList.frombuffer(numpy.array([], dtype=numpy.int32)), [])
+        self.assertEqual(IntArrayList(b"\x01\x02"), [1, 2])
+        with self.assertRaises(TypeError):
+            IntArrayList.frombuffer(numpy.array([1.5]))
+        with self.assertRaises((BufferError, ValueError)):
+            IntArrayList.frombuffer(data[::2])
+        with self.assertRaises(OverflowError):
+            IntArrayList.frombuffer(numpy.array([2 ** 31]))
+        lst = IntArrayList([1, 2, 3])
+        array = numpy.asarray(lst)
+        array[0] = 10
+        self.assertEqual(lst, [10, 2, 3])
+        for resize in (lambda: lst.append(4), lambda: lst.pop(), lambda: lst.clear(), lambda: lst.extend([1]),
+                       lambda: lst.insert(0, 1), lambda: lst.remove(2), lambda: lst.resize(5)):
+            with self.assertRaises(BufferError):
+                resize()
+        with self.assertRaises(BufferError):
+            del lst[0]
+        lst[1:3] = [5, 6]
+        lst.sort(key=lambda x: -x)
+        self.assertEqual(array.tolist(), [10, 6, 5])
+        del array
+        lst.append(4)
+        self.assertEqual(lst, [10, 6, 5, 4])
+
+        view = lst.view(readonly=True)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.format, "i")
+        self.assertEqual(view.tolist(), [10, 6, 5, 4])
+        with self.assertRaises(TypeError):
+            view[0] = 1
+        self.assertFalse(numpy.asarray(view).flags.writeable)
+        with self.assertRaises(BufferError):
+            lst.append(5)
+        view.release()
+        lst.append(5)
+        self.assertFalse(lst.view().readonly)
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,166 @@
+import unittest
+import numpy
+from pyfastutil.ints import IntHashSet, IntArrayList, BigIntArrayList
+
+
+class TestIntHashSet(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation_empty(self):
+        s = IntHashSet()
+        self.assertEqual(len(s), 0)
+        self.assertEqual(s, set())
+
+    def test_creation_with_iterable(self):
+        self.assertEqual(IntHashSet([3, 1, 3, -2]), {3, 1, -2})
+        self.assertEqual(IntHashSet(range(100)), set(range(100)))
+        self.assertEqual(IntHashSet(IntHashSet([1, 2])), {1, 2})
+
+    def test_creation_with_buffer(self):
+        self.assertEqual(IntHashSet(IntArrayList([1, 1, 2])), {1, 2})
+        self.assertEqual(IntHashSet(BigIntArrayList([5, -5])), {5, -5})
+        self.assertEqual(IntHashSet(numpy.array([7, 8, 7], dtype=numpy.int64)), {7, 8})
+
+    def test_creation_invalid(self):
+        with self.assertRaises(OverflowError):
+            IntHashSet([2 ** 40])
+        with self.assertRaises(OverflowError):
+            IntHashSet(BigIntArrayList([2 ** 40]))
+        with self.assertRaises(TypeError):
+            IntHashSet(["a"])
+        with self.assertRaises(TypeError):
+            IntHashSet(numpy.array([1.0]))
+
+    # Test set methods
+    def test_add_discard_remove(self):
+        s = IntHashSet()
+        s.add(1)
+        s.add(1)
+        s.add(-7)
+        self.assertEqual(s, {1, -7})
+        s.discard(1)
+        s.discard(100)
+        s.discard("a")
+        self.assertEqual(s, {-7})
+        s.remove(-7)
+        with self.assertRaises(KeyError):
+            s.remove(-7)
+        with self.assertRaises(KeyError):
+            s.remove(2 ** 40)
+
+    def test_contains(self):
+        s = IntHashSet([1, 2])
+        self.assertIn(1, s)
+        self.assertNotIn(3, s)
+        self.assertNotIn("1", s)
+        self.assertNotIn(2 ** 40, s)
+
+    def test_pop_clear(self):
+        s = IntHashSet([1, 2, 3])
+        popped = {s.pop() for _ in range(3)}
+        self.assertEqual(popped, {1, 2, 3})
+        with self.assertRaises(KeyError):
+            s.pop()
+        s.update([4, 5])
+        s.clear()
+        self.assertEqual(len(s), 0)
+
+    def test_copy(self):
+        s = IntHashSet([1])
+        copy = s.copy()
+        copy.add(2)
+        self.assertEqual(s, {1})
+        self.assertEqual(copy, {1, 2})
+
+    def test_iter(self):
+        s = IntHashSet([5, 3, 1])
+        self.assertEqual(sorted(s), [1, 3, 5])
+        with self.assertRaises(RuntimeError):
+            for value in s:
+                s.add(value + 100)
+
+    # Test bulk updates
+    def test_update(self):
+        s = IntHashSet([1])
+        s.update(IntArrayList([2, 3]))
+        s.update(numpy.array([4], dtype=numpy.int32))
+        s.update(IntHashSet([5]))
+        s.update(iter([6]))
+        self.assertEqual(s, {1, 2, 3, 4, 5, 6})
+
+    def test_intersection_update(self):
+        s = IntHashSet(range(10))
+        s.intersection_update(IntArrayList([1, 2, 3, 100]))
+        self.assertEqual(s, {1, 2, 3})
+        s.intersection_update(BigIntArrayList([2, 3, 2 ** 40]))
+        self.assertEqual(s, {2, 3})
+        s.intersection_update([3, "a"])
+        self.assertEqual(s, {3})
+        s.intersection_update(s)
+        self.assertEqual(s, {3})
+
+    def test_difference_update(self):
+        s = IntHashSet(range(10))
+        s.difference_update(IntArrayList.from_range(5))
+        self.assertEqual(s, set(range(5, 10)))
+        s.difference_update(IntHashSet([5, 6]))
+        s.difference_update(numpy.array([7, 2 ** 40], dtype=numpy.int64))
+        self.assertEqual(s, {8, 9})
+        s.difference_update(s)
+        self.assertEqual(s, set())
+
+    def test_symmetric_difference_update(self):
+        s = IntHashSet([1, 2, 3])
+        s.symmetric_difference_update(IntArrayList([3, 4, 4]))
+        self.assertEqual(s, {1, 2, 4})
+        s.symmetric_difference_update(IntHashSet([1, 5]))
+        self.assertEqual(s, {2, 4, 5})
+        s.symmetric_difference_update([2, 2])
+        self.assertEqual(s, {4, 5})
+
+    # Test set algebra
+    def test_operators(self):
+        a = IntHashSet([1, 2, 3])
+        b = IntHashSet([3, 4])
+        self.assertEqual(a | b, {1, 2, 3, 4})
+        self.assertEqual(a & b, {3})
+        self.assertEqual(b & a, {3})
+        self.assertEqual(a - b, {1, 2})
+        self.assertEqual(a ^ b, {1, 2, 4})
+        self.assertIsInstance(a | b, IntHashSet)
+        self.assertEqual(a, {1, 2, 3})
+        with self.assertRaises(TypeError):
+            _ = a | {1}
+
+    def test_inplace_operators(self):
+        s = IntHashSet([1, 2, 3])
+        original = s
+        s |= IntHashSet([4])
+        s &= IntHashSet([2, 3, 4])
+        s -= IntHashSet([2])
+        s ^= IntHashSet([4, 5])
+        self.assertIs(s, original)
+        self.assertEqual(s, {3, 5})
+
+    def test_large(self):
+        a = IntHashSet(IntArrayList.from_range(0, 100000, 2))
+        b = IntHashSet(IntArrayList.from_range(0, 100000, 3))
+        self.assertEqual(a & b, set(range(0, 100000, 6)))
+        self.assertEqual(len(a | b), len(set(range(0, 100000, 2)) | set(range(0, 100000, 3))))
+
+    def test_eq(self):
+        self.assertEqual(IntHashSet([1, 2]), IntHashSet([2, 1]))
+        self.assertEqual(IntHashSet([1, 2]), frozenset([1, 2]))
+        self.assertNotEqual(IntHashSet([1, 2]), {1, 3})
+        self.assertNotEqual(IntHashSet([1]), {"a"})
+        self.assertNotEqual(IntHashSet([1]), [1])
+        with self.assertRaises(TypeError):
+            hash(IntHashSet())
+
+    def test_repr(self):
+        self.assertEqual(repr(IntHashSet()), "set()")
+        self.assertEqual(repr(IntHashSet([1, -2])), "{1, -2}")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,217 @@
+import threading
+import unittest
+import numpy
+from pyfastutil.ints import IntIntHashMap, IntArrayList, BigIntArrayList
+from tests.benchmark import benchmark_dict
+
+
+class TestIntIntHashMap(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation_empty(self):
+        m = IntIntHashMap()
+        self.assertEqual(len(m), 0)
+        self.assertEqual(m, {})
+
+    def test_creation_with_dict(self):
+        m = IntIntHashMap({1: 2, 3: 4})
+        self.assertEqual(len(m), 2)
+        self.assertEqual(m, {1: 2, 3: 4})
+
+    def test_creation_with_pairs(self):
+        self.assertEqual(IntIntHashMap([(1, 2), [3, 4]]), {1: 2, 3: 4})
+        self.assertEqual(IntIntHashMap(iter([(1, 2), (1, 3)])), {1: 3})
+
+    def test_creation_with_map(self):
+        m = IntIntHashMap({1: 2})
+        self.assertEqual(IntIntHashMap(m), m)
+
+    def test_creation_invalid(self):
+        with self.assertRaises(ValueError):
+            IntIntHashMap([(1, 2, 3)])
+        with self.assertRaises(OverflowError):
+            IntIntHashMap({2 ** 40: 1})
+        with self.assertRaises(TypeError):
+            IntIntHashMap({"a": 1})
+
+    # Test mapping protocol
+    def test_getitem_setitem(self):
+        m = IntIntHashMap()
+        m[1] = 10
+        m[-5] = -50
+        m[1] = 11
+        self.assertEqual(m[1], 11)
+        self.assertEqual(m[-5], -50)
+        with self.assertRaises(KeyError):
+            _ = m[2]
+        with self.assertRaises(KeyError):
+            _ = m["1"]
+
+    def test_delitem(self):
+        m = IntIntHashMap({1: 2, 3: 4})
+        del m[1]
+        self.assertEqual(m, {3: 4})
+        with self.assertRaises(KeyError):
+            del m[1]
+
+    def test_contains(self):
+        m = IntIntHashMap({1: 2})
+        self.assertIn(1, m)
+        self.assertNotIn(2, m)
+        self.assertNotIn("1", m)
+        self.assertNotIn(2 ** 40, m)
+
+    def test_iter(self):
+        m = IntIntHashMap({1: 2, 3: 4, 5: 6})
+        self.assertEqual(sorted(m), [1, 3, 5])
+        with self.assertRaises(RuntimeError):
+            for key in m:
+                m[key + 100] = 0
+
+    # Test dict methods
+    def test_get(self):
+        m = IntIntHashMap({1: 2})
+        self.assertEqual(m.get(1), 2)
+        self.assertIsNone(m.get(2))
+        self.assertEqual(m.get(2, -1), -1)
+
+    def test_pop(self):
+        m = IntIntHashMap({1: 2})
+        self.assertEqual(m.pop(2, -1), -1)
+        self.assertEqual(m.pop(1), 2)
+        self.assertEqual(len(m), 0)
+        with self.assertRaises(KeyError):
+            m.pop(1)
+
+    def test_setdefault(self):
+        m = IntIntHashMap()
+        self.assertEqual(m.setdefault(1, 5), 5)
+        self.assertEqual(m.setdefault(1, 6), 5)
+        self.assertEqual(m.setdefault(2), 0)
+        self.assertEqual(m, {1: 5, 2: 0})
+
+    def test_add_to(self):
+        m = IntIntHashMap()
+        self.assertEqual(m.add_to(7, 3), 0)
+        self.assertEqual(m.add_to(7, 4), 3)
+        self.assertEqual(m[7], 7)
+        m[8] = 2 ** 31 - 1
+        m.add_to(8, 1)
+        self.assertEqual(m[8], -2 ** 31)
+
+    def test_items_keys_values(self):
+        data = {i: i * 2 for i in range(100)}
+        m = IntIntHashMap(data)
+        self.assertEqual(sorted(m.items()), sorted(data.items()))
+        self.assertIsInstance(m.keys(), IntArrayList)
+        self.assertIsInstance(m.values(), IntArrayList)
+        self.assertEqual(sorted(m.keys()), sorted(data.keys()))
+        self.assertEqual(sorted(m.values()), sorted(data.values()))
+
+    def test_update_clear(self):
+        m = IntIntHashMap({1: 2})
+        m.update({1: 3, 4: 5})
+        m.update(IntIntHashMap({6: 7}))
+        self.assertEqual(m, {1: 3, 4: 5, 6: 7})
+        m.clear()
+        self.assertEqual(len(m), 0)
+
+    def test_copy(self):
+        m = IntIntHashMap({1: 2})
+        copy = m.copy()
+        copy[3] = 4
+        self.assertEqual(m, {1: 2})
+        self.assertEqual(copy, {1: 2, 3: 4})
+
+    # Test bulk operations
+    def test_get_many(self):
+        m = IntIntHashMap({1: 2, 3: 4})
+        self.assertEqual(m.get_many(IntArrayList([3, 5, 1])), [4, 0, 2])
+        self.assertEqual(m.get_many(BigIntArrayList([1, 2 ** 40]), -1), [2, -1])
+        self.assertEqual(m.get_many(numpy.array([3, 1], dtype=numpy.int32), -1), [4, 2])
+        self.assertEqual(m.get_many(IntArrayList()), [])
+        with self.assertRaises(TypeError):
+            m.get_many([1, 2])
+        with self.assertRaises(TypeError):
+            m.get_many(numpy.array([1.0]))
+
+    def test_put_many(self):
+        m = IntIntHashMap({1: 0})
+        m.put_many(IntArrayList.from_range(1000), IntArrayList.from_range(0, 2000, 2))
+        self.assertEqual(len(m), 1000)
+        self.assertEqual(m[1], 2)
+        self.assertEqual(m[999], 1998)
+        m.put_many(numpy.array([-1], dtype=numpy.int64), BigIntArrayList([-2]))
+        self.assertEqual(m[-1], -2)
+        with self.assertRaises(ValueError):
+            m.put_many(IntArrayList([1, 2]), IntArrayList([1]))
+        with self.assertRaises(OverflowError):
+            m.put_many(BigIntArrayList([5000, 2 ** 40]), IntArrayList([1, 2]))
+        self.assertNotIn(5000, m)
+
+    def test_contains_many(self):
+        m = IntIntHashMap({i: i for i in range(0, 100, 3)})
+        keys = IntArrayList.from_range(100)
+        mask = m.contains_many(keys)
+        self.assertEqual(list(mask), [int(i % 3 == 0) for i in range(100)])
+        self.assertEqual(numpy.frombuffer(m.contains_many(numpy.array([3, 4], dtype=numpy.int32)), dtype=bool).tolist(),
+                         [True, False])
+        self.assertEqual(IntIntHashMap().contains_many(keys), bytes(100))
+
+    def test_many_releases_lists(self):
+        # the batch methods pin their list arguments only while they run
+        m = IntIntHashMap()
+        keys, values = IntArrayList([1, 2]), BigIntArrayList([3, 4])
+        m.put_many(keys, values)
+        m.get_many(keys)
+        m.contains_many(values)
+        with self.assertRaises(ValueError):
+            m.put_many(keys, BigIntArrayList([1]))
+        keys.append(5)
+        values.extend([6, 7])
+        self.assertEqual(keys, [1, 2, 5])
+        self.assertEqual(values, [3, 4, 6, 7])
+
+    def test_mutate_during_batch(self):
+        m = IntIntHashMap({i: i for i in range(100000)})
+        keys = IntArrayList.from_range(2000000)
+        errors = []
+
+        def lookup():
+            for _ in range(20):
+                m.get_many(keys)
+                m.contains_many(keys)
+
+        thread = threading.Thread(target=lookup)
+        thread.start()
+        while thread.is_alive() and not errors:
+            self.assertEqual(m.get(5), 5)  # reading is still allowed
+            try:
+                m[1] = 1
+            except BufferError as e:
+                errors.append(e)
+        thread.join()
+
+        self.assertTrue(errors)
+        m[1] = 2  # allowed again once the batch calls are done
+        self.assertEqual(m[1], 2)
+
+    def test_large(self):
+        m = IntIntHashMap()
+        for i in range(10000):
+            m[i * 7919] = i
+        for i in range(0, 10000, 2):
+            del m[i * 7919]
+        self.assertEqual(len(m), 5000)
+        self.assertEqual(m[7919], 1)
+
+    def test_repr(self):
+        self.assertEqual(repr(IntIntHashMap()), "{}")
+        self.assertEqual(repr(IntIntHashMap({1: -2})), "{1: -2}")
+
+    def test_benchmark(self):
+        self.assertEqual(benchmark_dict.main(IntIntHashMap), None)
+
+
+if __name__ == "__main__":
+    unittest.main()
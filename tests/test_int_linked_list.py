@@ -1,4 +1,5 @@
 import unittest
+import random
 import numpy
 import ctypes
 from pyfastutil.ints import IntLinkedList
@@ -162,6 +163,76 @@ class TestIntLinkedList(unittest.TestCase):
         with self.assertRaises(ValueError):
             lst.remove(99)
 
+    # Test lists spanning many nodes
+    def test_many_nodes(self):
+        rng = random.Random(0)
+        expected = list(range(1000))
+        lst = IntLinkedList(expected)
+        for _ in range(3000):
+            op = rng.randrange(4)
+            if op == 0:
+                index = rng.randint(-len(expected) - 1, len(expected) + 1)
+                value = rng.randint(-100, 100)
+                expected.insert(index, value)
+                lst.insert(index, value)
+            elif op == 1 and expected:
+                index = rng.randrange(len(expected))
+                self.assertEqual(lst.pop(index), expected.pop(index))
+            elif op == 2 and expected:
+                start = rng.randrange(len(expected))
+                stop = min(len(expected), start + rng.randint(0, 200))
+                values = [rng.randint(-100, 100) for _ in range(rng.randint(0, 200))]
+                expected[start:stop] = values
+                lst[start:stop] = values
+            elif expected:
+                index = rng.randrange(len(expected))
+                self.assertEqual(lst[index], expected[index])
+        self.assertEqual(lst, expected)
+        self.assertEqual(lst[::7], expected[::7])
+        self.assertEqual(list(reversed(lst)), expected[::-1])
+        self.assertEqual(lst.count(0), expected.count(0))
+
+    def test_index_near_previous(self):
+        expected = list(range(5000))
+        lst = IntLinkedList(expected)
+        for i in range(0, 5000, 3):
+            self.assertEqual(lst[i], expected[i])
+            if i % 2 == 0:
+                expected.insert(i, -i)
+                lst.insert(i, -i)
+            else:
+                del expected[i - 1]
+                del lst[i - 1]
+            lst.insert(0, i)
+            expected.insert(0, i)
+            self.assertEqual(lst.pop(), expected.pop())
+        self.assertEqual(lst, expected)
+        self.assertEqual(lst[5::3], expected[5::3])
+        self.assertEqual(lst[::-2], expected[::-2])
+
+    def test_iter_after_mutation(self):
+        lst = IntLinkedList(range(200))
+        it = iter(lst)
+        self.assertEqual([next(it) for _ in range(10)], list(range(10)))
+        lst.insert(0, -1)
+        self.assertEqual(next(it), 9)
+        del lst[:150]
+        self.assertEqual(list(it), list(range(160, 200)))
+
+        lst = IntLinkedList(range(200))
+        it = reversed(lst)
+        self.assertEqual(next(it), 199)
+        lst.pop()
+        self.assertEqual(list(it), list(range(198, -1, -1)))
+
+    def test_imul(self):
+        lst = IntLinkedList(range(100))
+        lst *= 3
+        self.assertEqual(lst, list(range(100)) * 3)
+        self.assertEqual(lst * 2, list(range(100)) * 6)
+        lst *= 0
+        self.assertEqual(lst, [])
+
     def test_benchmark(self):
         self.assertEqual(benchmark_list.main(IntLinkedList), None)
 
@@ -0,0 +1,74 @@
+import unittest
+import numpy
+from pyfastutil.ints import LongHashSet, IntArrayList, BigIntArrayList
+
+
+class TestLongHashSet(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation(self):
+        self.assertEqual(LongHashSet(), set())
+        self.assertEqual(LongHashSet([2 ** 40, 1, 2 ** 40]), {2 ** 40, 1})
+        self.assertEqual(LongHashSet(IntArrayList([1, 2])), {1, 2})
+        self.assertEqual(LongHashSet(BigIntArrayList([-2 ** 63, 2 ** 63 - 1])), {-2 ** 63, 2 ** 63 - 1})
+        self.assertEqual(LongHashSet(numpy.array([3, 3], dtype=numpy.int64)), {3})
+
+    def test_creation_invalid(self):
+        with self.assertRaises(OverflowError):
+            LongHashSet([2 ** 63])
+        with self.assertRaises(TypeError):
+            LongHashSet(["a"])
+
+    # Test set methods
+    def test_add_discard_remove(self):
+        s = LongHashSet()
+        s.add(2 ** 50)
+        s.add(-1)
+        self.assertIn(2 ** 50, s)
+        self.assertNotIn(2 ** 70, s)
+        s.discard(2 ** 70)
+        s.remove(2 ** 50)
+        self.assertEqual(s, {-1})
+        with self.assertRaises(KeyError):
+            s.remove(2 ** 50)
+        self.assertEqual(s.pop(), -1)
+        with self.assertRaises(KeyError):
+            s.pop()
+
+    def test_iter(self):
+        s = LongHashSet([2 ** 40, 1])
+        self.assertEqual(sorted(s), [1, 2 ** 40])
+        with self.assertRaises(RuntimeError):
+            for value in s:
+                s.add(value + 100)
+
+    # Test bulk updates
+    def test_bulk_updates(self):
+        s = LongHashSet(range(10))
+        s.update(BigIntArrayList([2 ** 40]))
+        s.intersection_update(numpy.array([1, 2, 3, 2 ** 40], dtype=numpy.int64))
+        self.assertEqual(s, {1, 2, 3, 2 ** 40})
+        s.difference_update(IntArrayList([1]))
+        s.symmetric_difference_update(LongHashSet([2, 4]))
+        self.assertEqual(s, {3, 4, 2 ** 40})
+
+    # Test set algebra
+    def test_operators(self):
+        a = LongHashSet([1, 2, 2 ** 40])
+        b = LongHashSet([2 ** 40, 4])
+        self.assertEqual(a | b, {1, 2, 4, 2 ** 40})
+        self.assertEqual(a & b, {2 ** 40})
+        self.assertEqual(a - b, {1, 2})
+        self.assertEqual(a ^ b, {1, 2, 4})
+        a &= b
+        self.assertEqual(a, {2 ** 40})
+
+    def test_eq_repr(self):
+        self.assertEqual(LongHashSet([1, 2]), LongHashSet([2, 1]))
+        self.assertEqual(LongHashSet([2 ** 40]), {2 ** 40})
+        self.assertEqual(repr(LongHashSet()), "set()")
+        self.assertEqual(repr(LongHashSet([2 ** 40])), "{1099511627776}")
+
+
+if __name__ == "__main__":
+    unittest.main()
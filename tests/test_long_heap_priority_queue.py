@@ -0,0 +1,112 @@
+import unittest
+import random
+import heapq
+from pyfastutil.ints import LongHeapPriorityQueue
+
+
+class TestLongHeapPriorityQueue(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation_empty(self):
+        queue = LongHeapPriorityQueue()
+        self.assertEqual(len(queue), 0)
+        self.assertFalse(queue)
+        self.assertFalse(queue.is_paired())
+
+    def test_creation_with_values(self):
+        queue = LongHeapPriorityQueue([5, 1, 3])
+        self.assertEqual(len(queue), 3)
+        self.assertEqual(queue.to_list(), [1, 3, 5])
+        self.assertEqual(len(queue), 3)
+
+    def test_creation_paired(self):
+        queue = LongHeapPriorityQueue([(5, 50), (1, 10)], paired=True)
+        self.assertTrue(queue.is_paired())
+        self.assertEqual(queue.to_list(), [(1, 10), (5, 50)])
+        with self.assertRaises(TypeError):
+            LongHeapPriorityQueue([1], paired=True)
+
+    # Test queue operations
+    def test_push_pop(self):
+        queue = LongHeapPriorityQueue()
+        for value in [4, -2, 7, 0]:
+            queue.push(value)
+        self.assertEqual(queue.peek(), -2)
+        self.assertEqual([queue.pop() for _ in range(4)], [-2, 0, 4, 7])
+
+    def test_push_pop_paired(self):
+        queue = LongHeapPriorityQueue(paired=True)
+        queue.push(3, 30)
+        queue.push(1, 10)
+        queue.push(2, 20)
+        self.assertEqual(queue.peek(), (1, 10))
+        self.assertEqual([queue.pop() for _ in range(3)], [(1, 10), (2, 20), (3, 30)])
+
+    def test_push_arguments(self):
+        with self.assertRaises(TypeError):
+            LongHeapPriorityQueue().push(1, 2)
+        with self.assertRaises(TypeError):
+            LongHeapPriorityQueue(paired=True).push(1)
+        with self.assertRaises(TypeError):
+            LongHeapPriorityQueue().push("1")
+
+    def test_empty(self):
+        queue = LongHeapPriorityQueue()
+        with self.assertRaises(IndexError):
+            queue.pop()
+        with self.assertRaises(IndexError):
+            queue.peek()
+
+    def test_push_many(self):
+        queue = LongHeapPriorityQueue(range(100, 0, -1))
+        queue.push_many([0, 50, 200])
+        queue.push_many(range(1000, 500, -1))
+        self.assertEqual(queue.to_list(), sorted(list(range(100, 0, -1)) + [0, 50, 200] + list(range(1000, 500, -1))))
+
+    def test_push_many_paired(self):
+        queue = LongHeapPriorityQueue(paired=True)
+        queue.push_many([3, 1, 2], [30, 10, 20])
+        self.assertEqual(queue.to_list(), [(1, 10), (2, 20), (3, 30)])
+        with self.assertRaises(ValueError):
+            queue.push_many([1, 2], [1])
+        with self.assertRaises(TypeError):
+            queue.push_many([1, 2])
+
+    def test_large_values(self):
+        queue = LongHeapPriorityQueue(paired=True)
+        queue.push(2 ** 62, -2 ** 63)
+        queue.push(-2 ** 63, 2 ** 62)
+        self.assertEqual(queue.pop(), (-2 ** 63, 2 ** 62))
+        self.assertEqual(queue.pop(), (2 ** 62, -2 ** 63))
+        with self.assertRaises(OverflowError):
+            queue.push(2 ** 63, 0)
+
+    def test_clear(self):
+        queue = LongHeapPriorityQueue([1, 2, 3])
+        queue.clear()
+        self.assertEqual(len(queue), 0)
+        queue.push(1)
+        self.assertEqual(queue.pop(), 1)
+
+    def test_repr(self):
+        self.assertEqual(repr(LongHeapPriorityQueue([2, 1])), "LongHeapPriorityQueue([1, 2])")
+
+    def test_against_heapq(self):
+        rnd = random.Random(0)
+        queue = LongHeapPriorityQueue(paired=True)
+        expected = []
+        for i in range(5000):
+            if rnd.random() < 0.6:
+                priority = rnd.randrange(-1000, 1000)
+                queue.push(priority, i)
+                heapq.heappush(expected, (priority, i))
+            elif expected:
+                priority, payload = queue.pop()
+                self.assertEqual(priority, expected[0][0])
+                expected.remove((priority, payload))
+                heapq.heapify(expected)
+            self.assertEqual(len(queue), len(expected))
+
+
+if __name__ == '__main__':
+    unittest.main()
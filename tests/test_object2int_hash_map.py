@@ -0,0 +1,153 @@
+import gc
+import unittest
+import weakref
+from pyfastutil.ints import IntArrayList
+from pyfastutil.objects import Object2IntHashMap
+
+
+class Key:
+    def __init__(self, value):
+        self.value = value
+
+    def __hash__(self):
+        return hash(self.value)
+
+    def __eq__(self, other):
+        return isinstance(other, Key) and self.value == other.value
+
+
+class BadKey:
+    def __hash__(self):
+        return 0
+
+    def __eq__(self, other):
+        raise ValueError("bad key")
+
+
+class TestObject2IntHashMap(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation(self):
+        self.assertEqual(Object2IntHashMap(), {})
+        self.assertEqual(Object2IntHashMap({"a": 1, (1, 2): 2}), {"a": 1, (1, 2): 2})
+        self.assertEqual(Object2IntHashMap([("a", 1), ("a", 2)]), {"a": 2})
+        m = Object2IntHashMap({"a": 1})
+        self.assertEqual(Object2IntHashMap(m), m)
+
+    def test_creation_invalid(self):
+        with self.assertRaises(OverflowError):
+            Object2IntHashMap({"a": 2 ** 40})
+        with self.assertRaises(TypeError):
+            Object2IntHashMap({"a": "b"})
+        with self.assertRaises(TypeError):
+            Object2IntHashMap([([1], 1)])
+
+    # Test mapping protocol
+    def test_getitem_setitem_delitem(self):
+        m = Object2IntHashMap()
+        m["a"] = 1
+        m[Key(5)] = 2
+        m["a"] = 3
+        self.assertEqual(m["a"], 3)
+        self.assertEqual(m[Key(5)], 2)
+        m[1] = 4
+        self.assertEqual(m[1.0], 4)  # same hash and equal, like dict
+        del m["a"]
+        self.assertNotIn("a", m)
+        with self.assertRaises(KeyError):
+            _ = m["a"]
+        with self.assertRaises(KeyError):
+            del m["a"]
+        with self.assertRaises(TypeError):
+            _ = m[[1]]
+
+    def test_eq_raises(self):
+        m = Object2IntHashMap({BadKey(): 1})
+        with self.assertRaises(ValueError):
+            _ = m[BadKey()]
+
+    def test_contains_iter(self):
+        m = Object2IntHashMap({"a": 1, "b": 2})
+        self.assertIn("a", m)
+        self.assertNotIn("c", m)
+        self.assertEqual(sorted(m), ["a", "b"])
+        with self.assertRaises(RuntimeError):
+            for key in m:
+                m[key + "x"] = 0
+
+    # Test dict methods
+    def test_get_pop_setdefault_add_to(self):
+        m = Object2IntHashMap({"a": 1})
+        self.assertEqual(m.get("a"), 1)
+        self.assertIsNone(m.get("b"))
+        self.assertEqual(m.get("b", -1), -1)
+        self.assertEqual(m.setdefault("b", 5), 5)
+        self.assertEqual(m.setdefault("b", 6), 5)
+        self.assertEqual(m.add_to("c", 2), 0)
+        self.assertEqual(m.add_to("c", 2), 2)
+        self.assertEqual(m["c"], 4)
+        self.assertEqual(m.pop("a"), 1)
+        self.assertEqual(m.pop("a", -1), -1)
+        with self.assertRaises(KeyError):
+            m.pop("a")
+
+    def test_items_keys_values(self):
+        data = {str(i): i for i in range(100)}
+        m = Object2IntHashMap(data)
+        self.assertEqual(sorted(m.items()), sorted(data.items()))
+        self.assertEqual(sorted(m.keys()), sorted(data.keys()))
+        self.assertIsInstance(m.values(), IntArrayList)
+        self.assertEqual(sorted(m.values()), sorted(data.values()))
+
+    def test_update_clear_copy(self):
+        m = Object2IntHashMap({"a": 1})
+        m.update({"a": 2, "b": 3})
+        m.update(Object2IntHashMap({"c": 4}))
+        copy = m.copy()
+        m.clear()
+        self.assertEqual(len(m), 0)
+        self.assertEqual(copy, {"a": 2, "b": 3, "c": 4})
+
+    def test_eq(self):
+        self.assertEqual(Object2IntHashMap({"a": 1}), Object2IntHashMap({"a": 1}))
+        self.assertNotEqual(Object2IntHashMap({"a": 1}), {"a": 2})
+        self.assertNotEqual(Object2IntHashMap({"a": 1}), {"a": "1"})
+        self.assertNotEqual(Object2IntHashMap(), [])
+
+    # Test reference counting and gc
+    def test_refcount(self):
+        m = Object2IntHashMap()
+        key = Key(1)
+        ref = weakref.ref(key)
+        m[key] = 1
+        del key
+        self.assertIsNotNone(ref())
+        del m[Key(1)]
+        self.assertIsNone(ref())
+
+    def test_gc_cycle(self):
+        m = Object2IntHashMap()
+        key = Key(1)
+        key.map = m
+        m[key] = 1
+        ref = weakref.ref(key)
+        del m, key
+        gc.collect()
+        self.assertIsNone(ref())
+
+    def test_large(self):
+        m = Object2IntHashMap()
+        for i in range(10000):
+            m[f"key{i}"] = i
+        for i in range(0, 10000, 2):
+            del m[f"key{i}"]
+        self.assertEqual(len(m), 5000)
+        self.assertEqual(m["key1"], 1)
+
+    def test_repr(self):
+        self.assertEqual(repr(Object2IntHashMap()), "{}")
+        self.assertEqual(repr(Object2IntHashMap({"a": 1, None: -2})), "{'a': 1, None: -2}")
+
+
+if __name__ == "__main__":
+    unittest.main()
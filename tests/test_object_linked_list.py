@@ -1,4 +1,6 @@
 import ctypes
+import random
+import sys
 import unittest
 
 import numpy
@@ -76,6 +78,21 @@ class TestObjectLinkedList(unittest.TestCase):
         self.assertEqual(lst[2:], [3, 4, 5])
         self.assertEqual(lst[1:4], [2, 3, 4])
 
+    def test_slice_assignment(self):
+        for _ in range(500):
+            expected = list(range(random.randint(0, 10)))
+            lst = ObjectLinkedList(expected)
+            s = slice(random.randint(-12, 12), random.randint(-12, 12), random.choice([None, 1, 2, -1]))
+            value = [100 + i for i in range(random.randint(0, 4))]
+            try:
+                expected[s] = value
+            except ValueError:
+                with self.assertRaises(ValueError):
+                    lst[s] = value
+                continue
+            lst[s] = value
+            self.assertEqual(lst, expected)
+
     def test_reverse(self):
         lst = ObjectLinkedList([1, 2, 3])
         lst.reverse()
@@ -154,6 +171,57 @@ class TestObjectLinkedList(unittest.TestCase):
         with self.assertRaises(ValueError):
             lst.remove(99)
 
+    # Test lists spanning many nodes
+    def test_many_nodes(self):
+        rng = random.Random(0)
+        expected = [str(i) for i in range(1000)]
+        lst = ObjectLinkedList(expected)
+        for _ in range(3000):
+            op = rng.randrange(4)
+            if op == 0:
+                index = rng.randint(-len(expected) - 1, len(expected) + 1)
+                value = str(rng.randint(-100, 100))
+                expected.insert(index, value)
+                lst.insert(index, value)
+            elif op == 1 and expected:
+                index = rng.randrange(len(expected))
+                self.assertEqual(lst.pop(index), expected.pop(index))
+            elif op == 2 and expected:
+                start = rng.randrange(len(expected))
+                stop = min(len(expected), start + rng.randint(0, 200))
+                values = [str(rng.randint(-100, 100)) for _ in range(rng.randint(0, 200))]
+                expected[start:stop] = values
+                lst[start:stop] = values
+            elif expected:
+                index = rng.randrange(len(expected))
+                self.assertEqual(lst[index], expected[index])
+        self.assertEqual(lst, expected)
+        self.assertEqual(lst[::7], expected[::7])
+        self.assertEqual(list(reversed(lst)), expected[::-1])
+
+    def test_iter_after_mutation(self):
+        lst = ObjectLinkedList(range(200))
+        it = iter(lst)
+        self.assertEqual([next(it) for _ in range(10)], list(range(10)))
+        lst.insert(0, -1)
+        self.assertEqual(next(it), 9)
+        del lst[:150]
+        self.assertEqual(list(it), list(range(160, 200)))
+
+    def test_refcount(self):
+        item = object()
+        before = sys.getrefcount(item)
+        lst = ObjectLinkedList([item] * 100)
+        lst *= 3
+        lst[10:20] = [item] * 30
+        lst[5:200] = [item]
+        lst.pop(0)
+        lst *= 0
+        lst.extend([item] * 10)
+        lst.clear()
+        del lst
+        self.assertEqual(sys.getrefcount(item), before)
+
     def test_benchmark(self):
         self.assertEqual(benchmark_list.main(ObjectLinkedList), None)
 
@@ -0,0 +1,170 @@
+import random
+import unittest
+
+from pyfastutil.ints import RoaringBitmap, IntArrayList, UnsignedIntArrayList
+
+
+def random_values(count, high=1 << 32):
+    return [random.randrange(high) for _ in range(count)]
+
+
+def mixed_values():
+    """Values that end up in array, bitmap and run containers."""
+    base = random.randrange(1 << 10) << 16
+    values = set(random_values(500))
+    values.update(base + random.randrange(1 << 16) for _ in range(20000))
+    values.update(range((base + (3 << 16)), base + (3 << 16) + 30000))
+    return values
+
+
+class TestRoaringBitmap(unittest.TestCase):
+
+    def assertSame(self, bitmap, expected):
+        self.assertEqual(len(bitmap), len(expected))
+        self.assertEqual(list(bitmap), sorted(expected))
+
+    # Test creation and basic properties
+    def test_creation(self):
+        self.assertEqual(len(RoaringBitmap()), 0)
+        self.assertSame(RoaringBitmap([5, 1, 5, 2 ** 32 - 1]), {1, 5, 2 ** 32 - 1})
+        self.assertSame(RoaringBitmap(x * 3 for x in range(10)), {x * 3 for x in range(10)})
+        self.assertEqual(repr(RoaringBitmap([3, 1])), "RoaringBitmap({1, 3})")
+        self.assertEqual(repr(RoaringBitmap()), "RoaringBitmap()")
+        for bad in ([-1], [2 ** 32]):
+            with self.assertRaises(OverflowError):
+                RoaringBitmap(bad)
+        with self.assertRaises(TypeError):
+            RoaringBitmap([1.5])
+
+    def test_add_remove(self):
+        bitmap = RoaringBitmap()
+        expected = set()
+        for value in random_values(3000, 1 << 18) + list(range(70000, 80000)):
+            bitmap.add(value)
+            expected.add(value)
+        self.assertSame(bitmap, expected)
+        for value in random.sample(sorted(expected), len(expected) // 2):
+            bitmap.remove(value)
+            expected.remove(value)
+        bitmap.discard(-1)
+        bitmap.discard(2 ** 40)
+        self.assertSame(bitmap, expected)
+        self.assertTrue(all(value in bitmap for value in expected))
+        self.assertNotIn(-1, bitmap)
+        self.assertNotIn("1", bitmap)
+        with self.assertRaises(KeyError):
+            bitmap.remove(2 ** 32 - 1)
+        bitmap.clear()
+        self.assertEqual(len(bitmap), 0)
+
+    def test_bulk(self):
+        values = mixed_values()
+        shuffled = list(values)
+        random.shuffle(shuffled)
+        self.assertSame(RoaringBitmap(UnsignedIntArrayList(shuffled)), values)
+
+        small = [value for value in values if value < 2 ** 31]
+        bitmap = RoaringBitmap()
+        bitmap.add_many(IntArrayList(small))
+        bitmap.add_many(small[:10])
+        self.assertSame(bitmap, set(small))
+        self.assertEqual(bitmap.to_int_array_list(), IntArrayList(sorted(small)))
+        with self.assertRaises(OverflowError):
+            bitmap.add_many(IntArrayList([-1]))
+
+        large = RoaringBitmap(values).to_int_array_list()
+        self.assertIsInstance(large, UnsignedIntArrayList)
+        self.assertEqual(large, UnsignedIntArrayList(sorted(values)))
+        self.assertEqual(RoaringBitmap([2 ** 31, 2 ** 32 - 1, 7]).to_int_array_list(), [7, 2 ** 31, 2 ** 32 - 1])
+        self.assertEqual(RoaringBitmap(small).to_unsigned_int_array_list(), UnsignedIntArrayList(sorted(small)))
+        self.assertEqual(RoaringBitmap().to_unsigned_int_array_list(), [])
+
+        bitmap = RoaringBitmap([1, 2 ** 32 - 1])
+        bitmap.add_range(5, 200000)
+        bitmap.add_range(2 ** 32 - 10, 2 ** 32)
+        self.assertSame(bitmap, {1, *range(5, 200000), *range(2 ** 32 - 10, 2 ** 32)})
+        with self.assertRaises(ValueError):
+            bitmap.add_range(0, 2 ** 32 + 1)
+
+    def test_set_operations(self):
+        for _ in range(5):
+            left = mixed_values()
+            right = mixed_values() | set(random.sample(sorted(left), 5000))
+            a = RoaringBitmap(left)
+            b = RoaringBitmap(right)
+            if random.random() < 0.5:
+                a.run_optimize()
+            self.assertSame(a & b, left & right)
+            self.assertSame(a | b, left | right)
+            self.assertSame(a - b, left - right)
+            self.assertSame(b - a, right - left)
+            c = a.copy()
+            c &= b
+            self.assertEqual(c, a & b)
+            c |= a
+            self.assertEqual(c, a)
+            c -= b
+            self.assertEqual(c, a - b)
+        self.assertSame(RoaringBitmap(range(10)) - RoaringBitmap(range(10)), set())
+        with self.assertRaises(TypeError):
+            RoaringBitmap() & {1}
+
+    def test_rank_select(self):
+        values = sorted(mixed_values())
+        bitmap = RoaringBitmap(values)
+        for index in random.sample(range(len(values)), 200):
+            value = values[index]
+            self.assertEqual(bitmap.select(index), value)
+            self.assertEqual(bitmap.rank(value), index + 1)
+        self.assertEqual(bitmap.rank(0), 1 if values[0] == 0 else 0)
+        self.assertEqual(bitmap.rank(2 ** 32 - 1), len(values))
+        self.assertEqual(bitmap.min(), values[0])
+        self.assertEqual(bitmap.max(), values[-1])
+        for index in (len(values), -1):
+            with self.assertRaises(IndexError):
+                bitmap.select(index)
+        with self.assertRaises(ValueError):
+            RoaringBitmap().min()
+
+    def test_run_optimize(self):
+        values = mixed_values()
+        bitmap = RoaringBitmap(values)
+        self.assertTrue(bitmap.run_optimize())
+        self.assertFalse(bitmap.run_optimize())
+        self.assertSame(bitmap, values)
+        self.assertEqual(bitmap, RoaringBitmap(values))
+        self.assertLess(len(bitmap.serialize()), len(RoaringBitmap(values).serialize()))
+        bitmap.add(random.randrange(2 ** 32))
+        bitmap.remove(min(values))
+        self.assertSame(bitmap - RoaringBitmap(values), set(bitmap) - values)
+
+    def test_serialize(self):
+        # the examples of the portable format spec, without and with a run container
+        self.assertEqual(RoaringBitmap([1, 2, 3]).serialize(),
+                         bytes.fromhex("3a300000 01000000 00000200 10000000 010002000300"))
+        ranged = RoaringBitmap()
+        ranged.add_range(0, 100)
+        self.assertEqual(ranged.serialize(), bytes.fromhex("3b300000 01 00006300 0100 00006300"))
+        for bitmap in (RoaringBitmap(), RoaringBitmap(mixed_values()), ranged):
+            for optimize in (False, True):
+                if optimize:
+                    bitmap.run_optimize()
+                data = bitmap.serialize()
+                self.assertEqual(RoaringBitmap.deserialize(data), bitmap)
+                self.assertEqual(RoaringBitmap.deserialize(memoryview(data)), bitmap)
+                for broken in (data[:-1], data + b"\0", b"\0" * 8):
+                    with self.assertRaises(ValueError):
+                        RoaringBitmap.deserialize(broken)
+
+    def test_iteration(self):
+        bitmap = RoaringBitmap([1, 2, 3, 70000])
+        seen = []
+        for value in bitmap:
+            seen.append(value)
+            bitmap.discard(2)
+            bitmap.add(80000)
+        self.assertEqual(seen, [1, 3, 70000, 80000])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,184 @@
+import random
+import unittest
+
+import numpy
+
+from pyfastutil.ints import UnsignedIntArrayList, IntArrayList
+
+MIN = 0
+MAX = 2 ** 32 - 1
+
+
+def random_values(size):
+    return [random.choice((MIN, MAX, random.randint(MIN, MAX))) for _ in range(size)]
+
+
+class TestUnsignedIntArrayList(unittest.TestCase):
+
+    # Test creation and basic properties
+    def test_creation(self):
+        self.assertEqual(UnsignedIntArrayList(), [])
+        self.assertEqual(UnsignedIntArrayList([MIN, 0, MAX]), [MIN, 0, MAX])
+        self.assertEqual(UnsignedIntArrayList(x for x in range(5)), [0, 1, 2, 3, 4])
+        self.assertEqual(UnsignedIntArrayList(UnsignedIntArrayList([1, 2])), [1, 2])
+        self.assertEqual(UnsignedIntArrayList(10), [])
+
+    def test_out_of_range(self):
+        for value in (MIN - 1, MAX + 1, 2 ** 100, -2 ** 100):
+            with self.assertRaises(OverflowError):
+                UnsignedIntArrayList([value])
+            lst = UnsignedIntArrayList([1])
+            with self.assertRaises(OverflowError):
+                lst.append(value)
+            with self.assertRaises(OverflowError):
+                lst.insert(0, value)
+            with self.assertRaises(OverflowError):
+                lst[0] = value
+            with self.assertRaises(OverflowError):
+                lst[0:1] = [2, value]
+            self.assertEqual(lst, [1])
+
+            # never in the list, rather than an error
+            self.assertNotIn(value, lst)
+            self.assertEqual(lst.count(value), 0)
+            with self.assertRaises(ValueError):
+                lst.index(value)
+            with self.assertRaises(ValueError):
+                lst.remove(value)
+
+        with self.assertRaises(TypeError):
+            UnsignedIntArrayList([1.5])
+
+    # Test basic list operations
+    def test_list_operations(self):
+        lst = UnsignedIntArrayList([1, 2, 3])
+        lst.append(4)
+        lst.insert(0, 0)
+        lst.extend([5, 6])
+        lst += UnsignedIntArrayList([7])
+        self.assertEqual(lst, list(range(8)))
+        self.assertEqual(lst.pop(), 7)
+        self.assertEqual(lst.pop(0), 0)
+        lst.remove(3)
+        del lst[0]
+        self.assertEqual(lst, [2, 4, 5, 6])
+        lst[1:3] = [9, 9, 9]
+        self.assertEqual(lst, [2, 9, 9, 9, 6])
+        self.assertEqual(lst[::2], [2, 9, 6])
+        self.assertEqual(lst[-1], 6)
+        self.assertEqual(list(reversed(lst)), [6, 9, 9, 9, 2])
+        lst.reverse()
+        self.assertEqual(lst, [6, 9, 9, 9, 2])
+        self.assertEqual(lst * 2, [6, 9, 9, 9, 2] * 2)
+        self.assertEqual(repr(UnsignedIntArrayList([MIN, MAX])), repr([MIN, MAX]))
+        lst.clear()
+        with self.assertRaises(IndexError):
+            lst.pop()
+
+    def test_search(self):
+        for size in (0, 1, 31, 100, 1000):
+            data = [random.randint(0, 9) for _ in range(size)] + [MIN, MAX]
+            lst = UnsignedIntArrayList(data)
+            for value in (MIN, MAX, 0, 5, 9):
+                self.assertEqual(lst.count(value), data.count(value))
+                self.assertEqual(value in lst, value in data)
+                if value in data:
+                    self.assertEqual(lst.index(value), data.index(value))
+            self.assertEqual(lst.index(MAX, size // 2), size + 1)
+
+    def test_sort(self):
+        for size in (0, 1, 7, 100, 300, 5000, 20000, 100_003):
+            data = random_values(size)
+            for algorithm in ("auto", "bitonic", "radix"):
+                for reverse in (False, True):
+                    lst = UnsignedIntArrayList(data)
+                    lst.sort(reverse=reverse, algorithm=algorithm)
+                    self.assertEqual(lst, sorted(data, reverse=reverse))
+
+        with self.assertRaises(ValueError):
+            UnsignedIntArrayList([1]).sort(algorithm="bogo")
+
+    def test_sort_key(self):
+        data = random_values(3000)
+        for key in (lambda x: -x, lambda x: x % 7, str):
+            for reverse in (False, True):
+                lst = UnsignedIntArrayList(data)
+                lst.sort(key=key, reverse=reverse)
+                self.assertEqual(lst, sorted(data, key=key, reverse=reverse))
+
+    def test_argsort(self):
+        for size in (0, 1, 7, 100, 5000, 20000):
+            data = [random.choice((MIN, MAX, 0, 1)) for _ in range(size)]
+            lst = UnsignedIntArrayList(data)
+            for reverse in (False, True):
+                indices = lst.argsort(reverse)
+                self.assertIsInstance(indices, IntArrayList)
+                self.assertEqual(indices, sorted(range(size), key=lambda i: data[i], reverse=reverse))
+                self.assertEqual([data[i] for i in lst.argsort(reverse, stable=False)], sorted(data, reverse=reverse))
+            self.assertEqual(lst, data)
+
+    def test_reductions(self):
+        for size in (1, 7, 31, 33, 64, 65, 1000, 10000):
+            data = random_values(size)
+            lst = UnsignedIntArrayList(data)
+            self.assertEqual(lst.sum(), sum(data))
+            self.assertEqual(lst.min(), min(data))
+            self.assertEqual(lst.max(), max(data))
+            self.assertEqual(lst.minmax(), (min(data), max(data)))
+            self.assertEqual(lst.argmin(), data.index(min(data)))
+            self.assertEqual(lst.argmax(), data.index(max(data)))
+
+        self.assertEqual(UnsignedIntArrayList().sum(), 0)
+        self.assertEqual(UnsignedIntArrayList([MAX] * 1000).sum(), MAX * 1000)
+        for method in (UnsignedIntArrayList.min, UnsignedIntArrayList.max, UnsignedIntArrayList.minmax, UnsignedIntArrayList.argmin, UnsignedIntArrayList.argmax):
+            with self.assertRaises(ValueError):
+                method(UnsignedIntArrayList())
+
+    def test_comparisons(self):
+        lst = UnsignedIntArrayList([1, 2, 3])
+        self.assertEqual(lst, UnsignedIntArrayList([1, 2, 3]))
+        self.assertEqual(lst, [1, 2, 3])
+        self.assertLess(lst, UnsignedIntArrayList([1, 3]))
+        self.assertGreater(UnsignedIntArrayList([MAX]), UnsignedIntArrayList([MIN]))
+        self.assertNotEqual(lst, UnsignedIntArrayList([1, 2]))
+
+    def test_buffer(self):
+        data = numpy.array([MIN, 0, 1, MAX], dtype=numpy.uint32)
+        for source in (data, memoryview(data), UnsignedIntArrayList(data.tolist())):
+            self.assertEqual(UnsignedIntArrayList.frombuffer(source), data.tolist())
+            self.assertEqual(UnsignedIntArrayList(source), data.tolist())
+        self.assertEqual(UnsignedIntArrayList.frombuffer(numpy.array([], dtype=numpy.uint32)), [])
+
+        # other dtypes aren't converted by frombuffer, the constructor checks every element
+        other = numpy.array([1, 2], dtype=numpy.int32)
+        with self.assertRaises(TypeError):
+            UnsignedIntArrayList.frombuffer(other)
+        self.assertEqual(UnsignedIntArrayList(other), [1, 2])
+        with self.assertRaises(OverflowError):
+            UnsignedIntArrayList(numpy.array([MAX + 1], dtype=object))
+        with self.assertRaises((BufferError, ValueError)):
+            UnsignedIntArrayList.frombuffer(data[::2])
+
+        lst = UnsignedIntArrayList([1, 2, 3])
+        array = numpy.asarray(lst)
+        self.assertEqual(array.dtype, numpy.uint32)
+        array[0] = 10
+        self.assertEqual(lst, [10, 2, 3])
+        with self.assertRaises(BufferError):
+            lst.append(4)
+        del array
+        lst.append(4)
+
+        view = lst.view(readonly=True)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.format, "I")
+        self.assertEqual(view.tolist(), [10, 2, 3, 4])
+        view.release()
+
+    def test_memory(self):
+        lst = UnsignedIntArrayList(range(100))
+        self.assertEqual(lst.view().nbytes, 100 * numpy.dtype(numpy.uint32).itemsize)
+
+
+if __name__ == '__main__':
+    unittest.main()